@@ -1,7 +1,7 @@
 QMAKE_CXXFLAGS += -Werror -std=c++11 -z defs
 QMAKE_LFLAGS += -std=c++11 -z defs
 
-QT += network serialbus
+QT += network serialport serialbus
 
 CONFIG += link_pkgconfig
 PKGCONFIG += nymea
@@ -17,11 +17,29 @@ gcc {
 
 HEADERS += \
     modbusdatautils.h \
-    modbustcpmaster.h
+    modbusreachabilitymonitor.h \
+    modbusregisterdump.h \
+    modbusregisterhistory.h \
+    modbusregistertable.h \
+    modbusrequestpacer.h \
+    modbusrtubusscheduler.h \
+    modbusstatistics.h \
+    modbustcpmaster.h \
+    modbustcpmasterregistry.h \
+    modbuswritetransaction.h
 
 SOURCES += \
     modbusdatautils.cpp \
-    modbustcpmaster.cpp
+    modbusreachabilitymonitor.cpp \
+    modbusregisterdump.cpp \
+    modbusregisterhistory.cpp \
+    modbusregistertable.cpp \
+    modbusrequestpacer.cpp \
+    modbusrtubusscheduler.cpp \
+    modbusstatistics.cpp \
+    modbustcpmaster.cpp \
+    modbustcpmasterregistry.cpp \
+    modbuswritetransaction.cpp
 
 
 # define install target
@@ -31,7 +49,7 @@ INSTALLS += target
 # install modbustool for external plugins
 modbustoolpri.files = modbus-tool.pri
 modbustoolpri.path = $$[QT_INSTALL_PREFIX]/include/nymea-modbus/
-modbustool.files = tools/generate-connection.py
+modbustool.files = tools/generate-connection.py tools/modbus-test-server.py
 modbustool.path = $$[QT_INSTALL_PREFIX]/include/nymea-modbus/tools/
 modbustoolmodules.files = tools/connectiontool/*.py
 modbustoolmodules.path = $$[QT_INSTALL_PREFIX]/include/nymea-modbus/tools/connectiontool/
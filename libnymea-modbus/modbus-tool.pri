@@ -29,20 +29,27 @@
 
 #   # Generate modbus connection
 #   MODBUS_CONNECTIONS += modbus-registers.json
-#   MODBUS_TOOLS_CONFIG += VERBOSE
+#   MODBUS_TOOLS_CONFIG += VERBOSE SIMULATOR
 #   include($$[QT_INSTALL_PREFIX]/include/nymea-modbus/modbus-tool.pri)
 
 # On each qmake run the classes will be generated in the build directory.
 
+# With SIMULATOR the simulated device classes will be generated and added to the project as well.
+
 GENERATE_MODBUS_CONNECTION_BINARY=$${PWD}/tools/generate-connection.py
 
+GENERATE_MODBUS_CONNECTION_ARGS=
+contains(MODBUS_TOOLS_CONFIG, SIMULATOR) {
+    GENERATE_MODBUS_CONNECTION_ARGS += -s
+}
+
 for(registerDefinition, MODBUS_CONNECTIONS) {
     contains(MODBUS_TOOLS_CONFIG, VERBOSE) {
         message("Generating modbus connection class for $${registerDefinition} (verbose)")
-        system(python3 $${GENERATE_MODBUS_CONNECTION_BINARY} -j $${_PRO_FILE_PWD_}/$${registerDefinition} -o $${OUT_PWD}/autogenerated -v)
+        system(python3 $${GENERATE_MODBUS_CONNECTION_BINARY} -j $${_PRO_FILE_PWD_}/$${registerDefinition} -o $${OUT_PWD}/autogenerated $${GENERATE_MODBUS_CONNECTION_ARGS} -v)
     } else {
         message("Generating class for $${registerDefinition}")
-        system(python3 $${GENERATE_MODBUS_CONNECTION_BINARY} -j $${_PRO_FILE_PWD_}/$${registerDefinition} -o $${OUT_PWD}/autogenerated)
+        system(python3 $${GENERATE_MODBUS_CONNECTION_BINARY} -j $${_PRO_FILE_PWD_}/$${registerDefinition} -o $${OUT_PWD}/autogenerated $${GENERATE_MODBUS_CONNECTION_ARGS})
     }
 }
 
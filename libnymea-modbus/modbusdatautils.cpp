@@ -39,137 +39,131 @@ ModbusDataUtils::ModbusDataUtils()
 
 quint16 ModbusDataUtils::convertToUInt16(const QVector<quint16> &registers)
 {
-    Q_ASSERT_X(registers.count() == 1,  "ModbusDataUtils", "invalid raw data size for converting value to quint16");
-    return registers.at(0);
+    return ModbusDataUtils::convertToUInt16(registers.constData(), registers.count());
 }
 
 qint16 ModbusDataUtils::convertToInt16(const QVector<quint16> &registers)
 {
-    Q_ASSERT_X(registers.count() == 1,  "ModbusDataUtils", "invalid raw data size for converting value to qint16");
-    return static_cast<qint16>(registers.at(0));
+    return ModbusDataUtils::convertToInt16(registers.constData(), registers.count());
 }
 
 quint32 ModbusDataUtils::convertToUInt32(const QVector<quint16> &registers, ByteOrder byteOrder)
 {
-    Q_ASSERT_X(registers.count() == 2,  "ModbusDataUtils", "invalid raw data size for converting value to quint32");
-    QByteArray data;
-    QDataStream inputStream(&data, QIODevice::WriteOnly);
-    if (byteOrder == ByteOrderBigEndian) {
-        inputStream << registers.at(0);
-        inputStream << registers.at(1);
-    } else {
-        inputStream << registers.at(1);
-        inputStream << registers.at(0);
-    }
-
-    QDataStream outputStream(&data, QIODevice::ReadOnly);
-    quint32 result = 0;
-    outputStream >> result;
-    return result;
+    return ModbusDataUtils::convertToUInt32(registers.constData(), registers.count(), byteOrder);
 }
 
 qint32 ModbusDataUtils::convertToInt32(const QVector<quint16> &registers, ByteOrder byteOrder)
 {
-    Q_ASSERT_X(registers.count() == 2,  "ModbusDataUtils", "invalid raw data size for converting value to quint32");
-    QByteArray data;
-    QDataStream inputStream(&data, QIODevice::WriteOnly);
-    if (byteOrder == ByteOrderBigEndian) {
-        inputStream << registers.at(0);
-        inputStream << registers.at(1);
-    } else {
-        inputStream << registers.at(1);
-        inputStream << registers.at(0);
-    }
-
-    QDataStream outputStream(&data, QIODevice::ReadOnly);
-    qint32 result = 0;
-    outputStream >> result;
-    return result;
+    return ModbusDataUtils::convertToInt32(registers.constData(), registers.count(), byteOrder);
 }
 
 quint64 ModbusDataUtils::convertToUInt64(const QVector<quint16> &registers, ByteOrder byteOrder)
 {
-    Q_ASSERT_X(registers.count() == 4,  "ModbusDataUtils", "invalid raw data size for converting value to quint64");
-    QByteArray data;
-    QDataStream inputStream(&data, QIODevice::WriteOnly);
-    if (byteOrder == ByteOrderBigEndian) {
-        inputStream << registers.at(0);
-        inputStream << registers.at(1);
-        inputStream << registers.at(2);
-        inputStream << registers.at(3);
-    } else {
-        inputStream << registers.at(3);
-        inputStream << registers.at(2);
-        inputStream << registers.at(1);
-        inputStream << registers.at(0);
-    }
-
-    QDataStream outputStream(&data, QIODevice::ReadOnly);
-    quint64 result = 0;
-    outputStream >> result;
-    return result;
+    return ModbusDataUtils::convertToUInt64(registers.constData(), registers.count(), byteOrder);
 }
 
 qint64 ModbusDataUtils::convertToInt64(const QVector<quint16> &registers, ByteOrder byteOrder)
 {
-    Q_ASSERT_X(registers.count() == 4,  "ModbusDataUtils", "invalid raw data size for converting value to qint64");
-    QByteArray data;
-    QDataStream inputStream(&data, QIODevice::WriteOnly);
-    if (byteOrder == ByteOrderBigEndian) {
-        inputStream << registers.at(0);
-        inputStream << registers.at(1);
-        inputStream << registers.at(2);
-        inputStream << registers.at(3);
-    } else {
-        inputStream << registers.at(3);
-        inputStream << registers.at(2);
-        inputStream << registers.at(1);
-        inputStream << registers.at(0);
-    }
-
-    QDataStream outputStream(&data, QIODevice::ReadOnly);
-    qint64 result = 0;
-    outputStream >> result;
-    return result;
+    return ModbusDataUtils::convertToInt64(registers.constData(), registers.count(), byteOrder);
 }
 
 QString ModbusDataUtils::convertToString(const QVector<quint16> &registers, ByteOrder characterByteOrder)
 {
-    QByteArray bytes;
-    QDataStream stream(&bytes, QIODevice::WriteOnly);
+    return ModbusDataUtils::convertToString(registers.constData(), registers.count(), characterByteOrder);
+}
+
+QByteArray ModbusDataUtils::convertToByteArray(const QVector<quint16> &registers)
+{
+    return ModbusDataUtils::convertToByteArray(registers.constData(), registers.count());
+}
+
+float ModbusDataUtils::convertToFloat32(const QVector<quint16> &registers, ByteOrder byteOrder)
+{
+    return ModbusDataUtils::convertToFloat32(registers.constData(), registers.count(), byteOrder);
+}
+
+double ModbusDataUtils::convertToFloat64(const QVector<quint16> &registers, ByteOrder byteOrder)
+{
+    return ModbusDataUtils::convertToFloat64(registers.constData(), registers.count(), byteOrder);
+}
+
+quint16 ModbusDataUtils::convertToUInt16(const quint16 *registers, int count)
+{
+    Q_ASSERT_X(count == 1,  "ModbusDataUtils", "invalid raw data size for converting value to quint16");
+    return registers[0];
+}
+
+qint16 ModbusDataUtils::convertToInt16(const quint16 *registers, int count)
+{
+    Q_ASSERT_X(count == 1,  "ModbusDataUtils", "invalid raw data size for converting value to qint16");
+    return static_cast<qint16>(registers[0]);
+}
+
+quint32 ModbusDataUtils::convertToUInt32(const quint16 *registers, int count, ByteOrder byteOrder)
+{
+    if (byteOrder == ByteOrderBigEndian)
+        return ModbusDataUtils::convertToUInt32<ByteOrderBigEndian>(registers, count);
+
+    return ModbusDataUtils::convertToUInt32<ByteOrderLittleEndian>(registers, count);
+}
+
+qint32 ModbusDataUtils::convertToInt32(const quint16 *registers, int count, ByteOrder byteOrder)
+{
+    return static_cast<qint32>(ModbusDataUtils::convertToUInt32(registers, count, byteOrder));
+}
+
+quint64 ModbusDataUtils::convertToUInt64(const quint16 *registers, int count, ByteOrder byteOrder)
+{
+    if (byteOrder == ByteOrderBigEndian)
+        return ModbusDataUtils::convertToUInt64<ByteOrderBigEndian>(registers, count);
+
+    return ModbusDataUtils::convertToUInt64<ByteOrderLittleEndian>(registers, count);
+}
+
+qint64 ModbusDataUtils::convertToInt64(const quint16 *registers, int count, ByteOrder byteOrder)
+{
+    return static_cast<qint64>(ModbusDataUtils::convertToUInt64(registers, count, byteOrder));
+}
+
+QString ModbusDataUtils::convertToString(const quint16 *registers, int count, ByteOrder characterByteOrder)
+{
     // Note: some devices use little endian within the register uint16 representation of the 2 characters.
-    stream.setByteOrder(characterByteOrder == ByteOrderBigEndian ? QDataStream::BigEndian : QDataStream::LittleEndian);
-    for (int i = 0; i < registers.count(); i++) {
-        stream << registers.at(i);
+    QByteArray bytes(count * 2, Qt::Uninitialized);
+    char *data = bytes.data();
+    for (int i = 0; i < count; i++) {
+        const char high = static_cast<char>(registers[i] >> 8);
+        const char low = static_cast<char>(registers[i] & 0xff);
+        data[i * 2] = (characterByteOrder == ByteOrderBigEndian ? high : low);
+        data[i * 2 + 1] = (characterByteOrder == ByteOrderBigEndian ? low : high);
     }
 
     return QString::fromUtf8(bytes).trimmed();
 }
 
-QByteArray ModbusDataUtils::convertToByteArray(const QVector<quint16> &registers)
+QByteArray ModbusDataUtils::convertToByteArray(const quint16 *registers, int count)
 {
-    QByteArray bytes;
-    QDataStream stream(&bytes, QIODevice::WriteOnly);
-    for (int i = 0; i < registers.count(); i++) {
-        stream << registers.at(i);
+    QByteArray bytes(count * 2, Qt::Uninitialized);
+    char *data = bytes.data();
+    for (int i = 0; i < count; i++) {
+        data[i * 2] = static_cast<char>(registers[i] >> 8);
+        data[i * 2 + 1] = static_cast<char>(registers[i] & 0xff);
     }
     return bytes;
 }
 
-float ModbusDataUtils::convertToFloat32(const QVector<quint16> &registers, ByteOrder byteOrder)
+float ModbusDataUtils::convertToFloat32(const quint16 *registers, int count, ByteOrder byteOrder)
 {
-    Q_ASSERT_X(registers.count() == 2,  "ModbusDataUtils", "invalid raw data size for converting value to float32");
-    quint32 rawValue = ModbusDataUtils::convertToUInt32(registers, byteOrder);
+    Q_ASSERT_X(count == 2,  "ModbusDataUtils", "invalid raw data size for converting value to float32");
+    quint32 rawValue = ModbusDataUtils::convertToUInt32(registers, count, byteOrder);
     float value = 0;
     memcpy(&value, &rawValue, sizeof(quint32));
     return value;
 }
 
-double ModbusDataUtils::convertToFloat64(const QVector<quint16> &registers, ByteOrder byteOrder)
+double ModbusDataUtils::convertToFloat64(const quint16 *registers, int count, ByteOrder byteOrder)
 {
-
-    Q_ASSERT_X(registers.count() == 4,  "ModbusDataUtils", "invalid raw data size for converting value to float64");
-    quint64 rawValue = ModbusDataUtils::convertToUInt64(registers, byteOrder);
+    Q_ASSERT_X(count == 4,  "ModbusDataUtils", "invalid raw data size for converting value to float64");
+    quint64 rawValue = ModbusDataUtils::convertToUInt64(registers, count, byteOrder);
     double value = 0;
     memcpy(&value, &rawValue, sizeof(quint64));
     return value;
@@ -187,22 +181,8 @@ QVector<quint16> ModbusDataUtils::convertFromInt16(qint16 value)
 
 QVector<quint16> ModbusDataUtils::convertFromUInt32(quint32 value, ByteOrder byteOrder)
 {
-    QByteArray data;
-    QDataStream inputStream(&data, QIODevice::WriteOnly);
-    inputStream << value;
-
-    QDataStream outputStream(&data, QIODevice::ReadOnly);
-    QVector<quint16> values;
-    for (int i = 0; i < 2; i++) {
-        quint16 registerValue = 0;
-        outputStream >> registerValue;
-        if (byteOrder == ByteOrderBigEndian) {
-            values.append(registerValue);
-        } else {
-            values.prepend(registerValue);
-        }
-    }
-
+    QVector<quint16> values(2);
+    ModbusDataUtils::convertFromUInt32(value, values.data(), byteOrder);
     return values;
 }
 
@@ -213,42 +193,14 @@ QVector<quint16> ModbusDataUtils::convertFromInt32(qint32 value, ByteOrder byteO
 
 QVector<quint16> ModbusDataUtils::convertFromUInt64(quint64 value, ByteOrder byteOrder)
 {
-    QByteArray data;
-    QDataStream inputStream(&data, QIODevice::WriteOnly);
-    inputStream << value;
-
-    QDataStream outputStream(&data, QIODevice::ReadOnly);
-    QVector<quint16> values;
-    for (int i = 0; i < 4; i++) {
-        quint16 registerValue = 0;
-        outputStream >> registerValue;
-        if (byteOrder == ByteOrderBigEndian) {
-            values.append(registerValue);
-        } else {
-            values.prepend(registerValue);
-        }
-    }
+    QVector<quint16> values(4);
+    ModbusDataUtils::convertFromUInt64(value, values.data(), byteOrder);
     return values;
 }
 
 QVector<quint16> ModbusDataUtils::convertFromInt64(qint64 value, ByteOrder byteOrder)
 {
-    QByteArray data;
-    QDataStream inputStream(&data, QIODevice::WriteOnly);
-    inputStream << value;
-
-    QDataStream outputStream(&data, QIODevice::ReadOnly);
-    QVector<quint16> values;
-    for (int i = 0; i < 4; i++) {
-        quint16 registerValue = 0;
-        outputStream >> registerValue;
-        if (byteOrder == ByteOrderBigEndian) {
-            values.append(registerValue);
-        } else {
-            values.prepend(registerValue);
-        }
-    }
-    return values;
+    return ModbusDataUtils::convertFromUInt64(static_cast<quint64>(value), byteOrder);
 }
 
 QVector<quint16> ModbusDataUtils::convertFromString(const QString &value, quint16 stringLength, ByteOrder characterByteOrder)
@@ -281,6 +233,58 @@ QVector<quint16> ModbusDataUtils::convertFromFloat64(double value, ByteOrder byt
     return ModbusDataUtils::convertFromUInt64(rawValue, byteOrder);
 }
 
+void ModbusDataUtils::convertFromUInt16(quint16 value, quint16 *registers)
+{
+    registers[0] = value;
+}
+
+void ModbusDataUtils::convertFromInt16(qint16 value, quint16 *registers)
+{
+    registers[0] = static_cast<quint16>(value);
+}
+
+void ModbusDataUtils::convertFromUInt32(quint32 value, quint16 *registers, ByteOrder byteOrder)
+{
+    if (byteOrder == ByteOrderBigEndian) {
+        ModbusDataUtils::convertFromUInt32<ByteOrderBigEndian>(value, registers);
+    } else {
+        ModbusDataUtils::convertFromUInt32<ByteOrderLittleEndian>(value, registers);
+    }
+}
+
+void ModbusDataUtils::convertFromInt32(qint32 value, quint16 *registers, ByteOrder byteOrder)
+{
+    ModbusDataUtils::convertFromUInt32(static_cast<quint32>(value), registers, byteOrder);
+}
+
+void ModbusDataUtils::convertFromUInt64(quint64 value, quint16 *registers, ByteOrder byteOrder)
+{
+    if (byteOrder == ByteOrderBigEndian) {
+        ModbusDataUtils::convertFromUInt64<ByteOrderBigEndian>(value, registers);
+    } else {
+        ModbusDataUtils::convertFromUInt64<ByteOrderLittleEndian>(value, registers);
+    }
+}
+
+void ModbusDataUtils::convertFromInt64(qint64 value, quint16 *registers, ByteOrder byteOrder)
+{
+    ModbusDataUtils::convertFromUInt64(static_cast<quint64>(value), registers, byteOrder);
+}
+
+void ModbusDataUtils::convertFromFloat32(float value, quint16 *registers, ByteOrder byteOrder)
+{
+    quint32 rawValue = 0;
+    memcpy(&rawValue, &value, sizeof(float));
+    ModbusDataUtils::convertFromUInt32(rawValue, registers, byteOrder);
+}
+
+void ModbusDataUtils::convertFromFloat64(double value, quint16 *registers, ByteOrder byteOrder)
+{
+    quint64 rawValue = 0;
+    memcpy(&rawValue, &value, sizeof(double));
+    ModbusDataUtils::convertFromUInt64(rawValue, registers, byteOrder);
+}
+
 QString ModbusDataUtils::exceptionCodeToString(QModbusPdu::ExceptionCode exception)
 {
     QString exceptionString;
@@ -35,6 +35,8 @@
 #include <QObject>
 #include <QModbusPdu>
 
+#include <cstring>
+
 class ModbusDataUtils
 {
     Q_GADGET
@@ -94,6 +96,71 @@ public:
     static float convertToFloat32(const QVector<quint16> &registers, ByteOrder byteOrder = ByteOrderLittleEndian);
     static double convertToFloat64(const QVector<quint16> &registers, ByteOrder byteOrder = ByteOrderLittleEndian);
 
+    // Convert to, working directly on a register span without any heap allocation
+    static quint16 convertToUInt16(const quint16 *registers, int count);
+    static qint16 convertToInt16(const quint16 *registers, int count);
+    static quint32 convertToUInt32(const quint16 *registers, int count, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static qint32 convertToInt32(const quint16 *registers, int count, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static quint64 convertToUInt64(const quint16 *registers, int count, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static qint64 convertToInt64(const quint16 *registers, int count, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static QString convertToString(const quint16 *registers, int count, ByteOrder characterByteOrder = ByteOrderLittleEndian);
+    static QByteArray convertToByteArray(const quint16 *registers, int count);
+    static float convertToFloat32(const quint16 *registers, int count, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static double convertToFloat64(const quint16 *registers, int count, ByteOrder byteOrder = ByteOrderLittleEndian);
+
+    // Convert to, with the byte order known at compile time
+    template<ByteOrder byteOrder>
+    static inline quint32 convertToUInt32(const quint16 *registers, int count)
+    {
+        Q_ASSERT_X(count == 2,  "ModbusDataUtils", "invalid raw data size for converting value to quint32");
+        if (byteOrder == ByteOrderBigEndian)
+            return static_cast<quint32>(registers[0]) << 16 | registers[1];
+
+        return static_cast<quint32>(registers[1]) << 16 | registers[0];
+    }
+
+    template<ByteOrder byteOrder>
+    static inline qint32 convertToInt32(const quint16 *registers, int count)
+    {
+        return static_cast<qint32>(convertToUInt32<byteOrder>(registers, count));
+    }
+
+    template<ByteOrder byteOrder>
+    static inline quint64 convertToUInt64(const quint16 *registers, int count)
+    {
+        Q_ASSERT_X(count == 4,  "ModbusDataUtils", "invalid raw data size for converting value to quint64");
+        quint64 result = 0;
+        for (int i = 0; i < 4; i++) {
+            result <<= 16;
+            result |= registers[byteOrder == ByteOrderBigEndian ? i : 3 - i];
+        }
+        return result;
+    }
+
+    template<ByteOrder byteOrder>
+    static inline qint64 convertToInt64(const quint16 *registers, int count)
+    {
+        return static_cast<qint64>(convertToUInt64<byteOrder>(registers, count));
+    }
+
+    template<ByteOrder byteOrder>
+    static inline float convertToFloat32(const quint16 *registers, int count)
+    {
+        quint32 rawValue = convertToUInt32<byteOrder>(registers, count);
+        float value = 0;
+        memcpy(&value, &rawValue, sizeof(quint32));
+        return value;
+    }
+
+    template<ByteOrder byteOrder>
+    static inline double convertToFloat64(const quint16 *registers, int count)
+    {
+        quint64 rawValue = convertToUInt64<byteOrder>(registers, count);
+        double value = 0;
+        memcpy(&value, &rawValue, sizeof(quint64));
+        return value;
+    }
+
     // Convert from
     static QVector<quint16> convertFromUInt16(quint16 value);
     static QVector<quint16> convertFromInt16(qint16 value);
@@ -105,6 +172,33 @@ public:
     static QVector<quint16> convertFromFloat32(float value, ByteOrder byteOrder = ByteOrderLittleEndian);
     static QVector<quint16> convertFromFloat64(double value, ByteOrder byteOrder = ByteOrderLittleEndian);
 
+    // Convert from, writing into a caller provided register buffer of the required size
+    static void convertFromUInt16(quint16 value, quint16 *registers);
+    static void convertFromInt16(qint16 value, quint16 *registers);
+    static void convertFromUInt32(quint32 value, quint16 *registers, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static void convertFromInt32(qint32 value, quint16 *registers, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static void convertFromUInt64(quint64 value, quint16 *registers, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static void convertFromInt64(qint64 value, quint16 *registers, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static void convertFromFloat32(float value, quint16 *registers, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static void convertFromFloat64(double value, quint16 *registers, ByteOrder byteOrder = ByteOrderLittleEndian);
+
+    // Convert from, with the byte order known at compile time
+    template<ByteOrder byteOrder>
+    static inline void convertFromUInt32(quint32 value, quint16 *registers)
+    {
+        registers[byteOrder == ByteOrderBigEndian ? 0 : 1] = static_cast<quint16>(value >> 16);
+        registers[byteOrder == ByteOrderBigEndian ? 1 : 0] = static_cast<quint16>(value);
+    }
+
+    template<ByteOrder byteOrder>
+    static inline void convertFromUInt64(quint64 value, quint16 *registers)
+    {
+        for (int i = 3; i >= 0; i--) {
+            registers[byteOrder == ByteOrderBigEndian ? i : 3 - i] = static_cast<quint16>(value);
+            value >>= 16;
+        }
+    }
+
     static QString exceptionCodeToString(QModbusPdu::ExceptionCode exception);
 };
 
@@ -0,0 +1,130 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+#include "modbusreachabilitymonitor.h"
+
+#include <QtAlgorithms>
+
+ModbusReachabilityMonitor::ModbusReachabilityMonitor(int errorLimit, int errorWindow, int probeIdleTime) :
+    m_probeIdleTime(probeIdleTime)
+{
+    setErrorWindow(errorWindow);
+    setErrorLimit(errorLimit);
+}
+
+int ModbusReachabilityMonitor::errorLimit() const
+{
+    return m_errorLimit;
+}
+
+void ModbusReachabilityMonitor::setErrorLimit(int errorLimit)
+{
+    m_errorLimit = qBound(1, errorLimit, m_errorWindow);
+}
+
+int ModbusReachabilityMonitor::errorWindow() const
+{
+    return m_errorWindow;
+}
+
+void ModbusReachabilityMonitor::setErrorWindow(int errorWindow)
+{
+    m_errorWindow = qBound(1, errorWindow, maxErrorWindow);
+    m_errorLimit = qMin(m_errorLimit, m_errorWindow);
+    m_errors &= windowMask();
+}
+
+int ModbusReachabilityMonitor::probeIdleTime() const
+{
+    return m_probeIdleTime;
+}
+
+void ModbusReachabilityMonitor::setProbeIdleTime(int probeIdleTime)
+{
+    m_probeIdleTime = probeIdleTime;
+}
+
+bool ModbusReachabilityMonitor::addReply(bool success)
+{
+    m_lastReply.start();
+
+    // Bit 0 is the latest reply, a set bit an error
+    m_errors = ((m_errors << 1) | (success ? 0 : 1)) & windowMask();
+
+    if (success) {
+        if (m_communicationWorking)
+            return false;
+
+        // Start over with a clean window, errors from before the recovery must not count again
+        m_errors = 0;
+        m_communicationWorking = true;
+        return true;
+    }
+
+    if (!m_communicationWorking || errorCount() < m_errorLimit)
+        return false;
+
+    m_communicationWorking = false;
+    return true;
+}
+
+bool ModbusReachabilityMonitor::communicationWorking() const
+{
+    return m_communicationWorking;
+}
+
+int ModbusReachabilityMonitor::errorCount() const
+{
+    return static_cast<int>(qPopulationCount(m_errors));
+}
+
+bool ModbusReachabilityMonitor::idle() const
+{
+    if (m_probeIdleTime <= 0)
+        return true;
+
+    return !m_lastReply.isValid() || m_lastReply.hasExpired(m_probeIdleTime);
+}
+
+void ModbusReachabilityMonitor::reset()
+{
+    m_errors = 0;
+    m_communicationWorking = false;
+    m_lastReply.invalidate();
+}
+
+quint64 ModbusReachabilityMonitor::windowMask() const
+{
+    if (m_errorWindow >= maxErrorWindow)
+        return ~Q_UINT64_C(0);
+
+    return (Q_UINT64_C(1) << m_errorWindow) - 1;
+}
@@ -0,0 +1,86 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+#ifndef MODBUSREACHABILITYMONITOR_H
+#define MODBUSREACHABILITYMONITOR_H
+
+#include <QElapsedTimer>
+
+// Derives the reachability of a device from the replies of the regular traffic.
+//
+// The result of the last error window replies is kept as bit mask. The communication
+// is considered not working any more once the error limit has been reached within the
+// window and working again with the first successful reply, which also clears the window.
+// With an error window equal to the error limit this matches a limit of consecutive
+// errors, a bigger window also detects a device answering only sporadically.
+//
+// Dedicated reachability probes are only required if the connection has been idle,
+// i.e. no reply has been received within the probe idle time. With a probe idle time
+// of 0 the connection is always idle, so a probe may be sent on every occasion.
+
+class ModbusReachabilityMonitor
+{
+public:
+    static const int maxErrorWindow = 64;
+
+    explicit ModbusReachabilityMonitor(int errorLimit = 10, int errorWindow = 10, int probeIdleTime = 0);
+
+    int errorLimit() const;
+    void setErrorLimit(int errorLimit);
+
+    int errorWindow() const;
+    void setErrorWindow(int errorWindow);
+
+    int probeIdleTime() const;
+    void setProbeIdleTime(int probeIdleTime);
+
+    // Returns true if the communication working state changed
+    bool addReply(bool success);
+
+    bool communicationWorking() const;
+    int errorCount() const;
+    bool idle() const;
+
+    void reset();
+
+private:
+    int m_errorLimit = 10;
+    int m_errorWindow = 10;
+    int m_probeIdleTime = 0;
+
+    quint64 m_errors = 0;
+    bool m_communicationWorking = false;
+    QElapsedTimer m_lastReply;
+
+    quint64 windowMask() const;
+};
+
+#endif // MODBUSREACHABILITYMONITOR_H
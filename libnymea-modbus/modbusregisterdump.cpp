@@ -0,0 +1,112 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "modbusregisterdump.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonDocument>
+
+bool ModbusRegisterDump::load(const QString &fileName)
+{
+    clear();
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        m_errorString = QString("Could not open %1: %2").arg(fileName, file.errorString());
+        return false;
+    }
+
+    QJsonParseError error;
+    QJsonDocument jsonDoc = QJsonDocument::fromJson(file.readAll(), &error);
+    if (error.error != QJsonParseError::NoError) {
+        m_errorString = QString("Could not parse %1: %2").arg(fileName, error.errorString());
+        return false;
+    }
+
+    QVector<Step> steps;
+    foreach (const QJsonValue &stepValue, jsonDoc.array()) {
+        Step step;
+        foreach (const QJsonValue &rangeValue, stepValue.toArray()) {
+            QJsonObject rangeObject = rangeValue.toObject();
+            QString registerTypeString = rangeObject.value("registerType").toString();
+            QModbusDataUnit::RegisterType registerType = QModbusDataUnit::Invalid;
+            if (registerTypeString == "coils") {
+                registerType = QModbusDataUnit::Coils;
+            } else if (registerTypeString == "discreteInputs") {
+                registerType = QModbusDataUnit::DiscreteInputs;
+            } else if (registerTypeString == "holdingRegister") {
+                registerType = QModbusDataUnit::HoldingRegisters;
+            } else if (registerTypeString == "inputRegister") {
+                registerType = QModbusDataUnit::InputRegisters;
+            } else {
+                m_errorString = QString("Invalid register type \"%1\" in step %2 of %3").arg(registerTypeString).arg(steps.count()).arg(fileName);
+                return false;
+            }
+
+            QVector<quint16> values;
+            foreach (const QJsonValue &value, rangeObject.value("values").toArray())
+                values.append(static_cast<quint16>(value.toInt()));
+
+            step.append(QModbusDataUnit(registerType, rangeObject.value("address").toInt(), values));
+        }
+        steps.append(step);
+    }
+
+    m_steps = steps;
+    return true;
+}
+
+void ModbusRegisterDump::clear()
+{
+    m_steps.clear();
+    m_errorString.clear();
+}
+
+bool ModbusRegisterDump::isEmpty() const
+{
+    return m_steps.isEmpty();
+}
+
+int ModbusRegisterDump::count() const
+{
+    return m_steps.count();
+}
+
+ModbusRegisterDump::Step ModbusRegisterDump::step(int index) const
+{
+    return m_steps.value(index);
+}
+
+QString ModbusRegisterDump::errorString() const
+{
+    return m_errorString;
+}
@@ -0,0 +1,70 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef MODBUSREGISTERDUMP_H
+#define MODBUSREGISTERDUMP_H
+
+#include <QVector>
+#include <QString>
+#include <QModbusDataUnit>
+
+// Recorded register values of a device, used for replaying them in simulators.
+//
+// The dump is a JSON array of steps. Each step is an array of register ranges
+// containing the registerType (coils, discreteInputs, holdingRegister or
+// inputRegister), the start address and the raw register values:
+//
+// [
+//     [ { "registerType": "inputRegister", "address": 100, "values": [ 0, 1250 ] } ],
+//     [ { "registerType": "inputRegister", "address": 100, "values": [ 0, 1310 ] } ]
+// ]
+
+class ModbusRegisterDump
+{
+public:
+    typedef QVector<QModbusDataUnit> Step;
+
+    explicit ModbusRegisterDump() = default;
+
+    bool load(const QString &fileName);
+    void clear();
+
+    bool isEmpty() const;
+    int count() const;
+    Step step(int index) const;
+
+    QString errorString() const;
+
+private:
+    QVector<Step> m_steps;
+    QString m_errorString;
+};
+
+#endif // MODBUSREGISTERDUMP_H
@@ -0,0 +1,136 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+#include "modbusregisterhistory.h"
+
+#include <QDeadlineTimer>
+
+ModbusRegisterHistory::ModbusRegisterHistory(int capacity) :
+    m_samples(qMax(capacity, 1))
+{
+
+}
+
+int ModbusRegisterHistory::capacity() const
+{
+    return m_samples.count();
+}
+
+int ModbusRegisterHistory::count() const
+{
+    return m_count;
+}
+
+bool ModbusRegisterHistory::isEmpty() const
+{
+    return m_count == 0;
+}
+
+void ModbusRegisterHistory::append(double value)
+{
+    append(QDeadlineTimer::current().deadline(), value);
+}
+
+void ModbusRegisterHistory::append(qint64 timestamp, double value)
+{
+    // m_head is the position of the next sample, i.e. the oldest one if full
+    Sample &sample = m_samples[m_head];
+    sample.timestamp = timestamp;
+    sample.value = value;
+
+    m_head = (m_head + 1) % m_samples.count();
+    if (m_count < m_samples.count())
+        m_count++;
+}
+
+void ModbusRegisterHistory::clear()
+{
+    m_head = 0;
+    m_count = 0;
+}
+
+ModbusRegisterHistory::Sample ModbusRegisterHistory::at(int index) const
+{
+    if (index < 0 || index >= m_count)
+        return Sample();
+
+    return m_samples.at((m_head - m_count + index + m_samples.count()) % m_samples.count());
+}
+
+ModbusRegisterHistory::Sample ModbusRegisterHistory::latest() const
+{
+    return at(m_count - 1);
+}
+
+ModbusRegisterHistory::Statistics ModbusRegisterHistory::statistics(qint64 window) const
+{
+    Statistics statistics;
+    const qint64 oldest = QDeadlineTimer::current().deadline() - window;
+    double sum = 0;
+    int position = m_head;
+    for (int i = 0; i < m_count; i++) {
+        position = (position == 0 ? m_samples.count() : position) - 1;
+        const Sample &sample = m_samples.at(position);
+        if (sample.timestamp < oldest)
+            break;
+
+        if (statistics.count == 0) {
+            statistics.minimum = sample.value;
+            statistics.maximum = sample.value;
+        } else {
+            statistics.minimum = qMin(statistics.minimum, sample.value);
+            statistics.maximum = qMax(statistics.maximum, sample.value);
+        }
+
+        sum += sample.value;
+        statistics.count++;
+    }
+
+    if (statistics.count > 0)
+        statistics.mean = sum / statistics.count;
+
+    return statistics;
+}
+
+double ModbusRegisterHistory::minimum(qint64 window) const
+{
+    return statistics(window).minimum;
+}
+
+double ModbusRegisterHistory::maximum(qint64 window) const
+{
+    return statistics(window).maximum;
+}
+
+double ModbusRegisterHistory::mean(qint64 window) const
+{
+    return statistics(window).mean;
+}
@@ -0,0 +1,89 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+#ifndef MODBUSREGISTERHISTORY_H
+#define MODBUSREGISTERHISTORY_H
+
+#include <QVector>
+
+// Fixed size ring buffer of timestamped register values.
+//
+// The memory for all samples is allocated on construction, appending a sample
+// overwrites the oldest one once the history is full and never allocates. Window
+// queries walk back from the latest sample and stop at the first sample older
+// than the window, so they only touch the samples within the window.
+
+class ModbusRegisterHistory
+{
+public:
+    struct Sample {
+        qint64 timestamp = 0; // ms of the monotonic clock, see QDeadlineTimer::current()
+        double value = 0;
+    };
+
+    struct Statistics {
+        int count = 0;
+        double minimum = 0;
+        double maximum = 0;
+        double mean = 0;
+    };
+
+    explicit ModbusRegisterHistory(int capacity = 1);
+
+    int capacity() const;
+    int count() const;
+    bool isEmpty() const;
+
+    // Samples are timestamped using the monotonic clock, so changes of the system
+    // time don't move them in or out of a window. An explicit timestamp has to be
+    // taken from the same clock, i.e. QDeadlineTimer::current().deadline().
+    void append(double value);
+    void append(qint64 timestamp, double value);
+    void clear();
+
+    // Index 0 is the oldest sample
+    Sample at(int index) const;
+    Sample latest() const;
+
+    // Statistics of the samples not older than window ms. Without samples
+    // in the window all values are 0.
+    Statistics statistics(qint64 window) const;
+    double minimum(qint64 window) const;
+    double maximum(qint64 window) const;
+    double mean(qint64 window) const;
+
+private:
+    QVector<Sample> m_samples;
+    int m_head = 0;
+    int m_count = 0;
+};
+
+#endif // MODBUSREGISTERHISTORY_H
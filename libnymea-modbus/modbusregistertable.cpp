@@ -0,0 +1,140 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "modbusregistertable.h"
+#include "modbustcpmaster.h"
+#include "modbusrtubusscheduler.h"
+
+#include <math.h>
+
+QModbusReply *ModbusRegisterTable::sendReadRequest(ModbusTcpMaster *modbusTcpMaster, quint16 slaveId, const Request &request)
+{
+    return modbusTcpMaster->sendReadRequest(QModbusDataUnit(request.registerType, request.address, request.size), slaveId);
+}
+
+ModbusRtuReply *ModbusRegisterTable::sendReadRequest(ModbusRtuBusScheduler *busScheduler, quint16 slaveId, const Request &request)
+{
+    switch (request.registerType) {
+    case QModbusDataUnit::Coils:
+        return busScheduler->readCoil(slaveId, request.address, request.size);
+    case QModbusDataUnit::DiscreteInputs:
+        return busScheduler->readDiscreteInput(slaveId, request.address, request.size);
+    case QModbusDataUnit::InputRegisters:
+        return busScheduler->readInputRegister(slaveId, request.address, request.size);
+    default:
+        return busScheduler->readHoldingRegister(slaveId, request.address, request.size);
+    }
+}
+
+QString ModbusRegisterTable::description(const char *descriptions, const Request &request)
+{
+    // The descriptions are stored as null terminated strings one after another
+    return QString::fromUtf8(descriptions + request.descriptionOffset);
+}
+
+qint64 ModbusRegisterTable::toInteger(const Register &tableRegister, const quint16 *values, ModbusDataUtils::ByteOrder byteOrder)
+{
+    const quint16 *registerValues = values + tableRegister.offset;
+    switch (tableRegister.dataType) {
+    case DataTypeUInt16:
+        return ModbusDataUtils::convertToUInt16(registerValues, tableRegister.size);
+    case DataTypeInt16:
+        return ModbusDataUtils::convertToInt16(registerValues, tableRegister.size);
+    case DataTypeUInt32:
+        return ModbusDataUtils::convertToUInt32(registerValues, tableRegister.size, byteOrder);
+    case DataTypeInt32:
+        return ModbusDataUtils::convertToInt32(registerValues, tableRegister.size, byteOrder);
+    case DataTypeUInt64:
+        // Casting back to quint64 restores the value
+        return static_cast<qint64>(ModbusDataUtils::convertToUInt64(registerValues, tableRegister.size, byteOrder));
+    case DataTypeInt64:
+        return ModbusDataUtils::convertToInt64(registerValues, tableRegister.size, byteOrder);
+    default:
+        return qRound64(toNumber(tableRegister, values, byteOrder));
+    }
+}
+
+double ModbusRegisterTable::toNumber(const Register &tableRegister, const quint16 *values, ModbusDataUtils::ByteOrder byteOrder, int scaleFactor)
+{
+    const quint16 *registerValues = values + tableRegister.offset;
+    double value = 0;
+    switch (tableRegister.dataType) {
+    case DataTypeUInt16:
+        value = ModbusDataUtils::convertToUInt16(registerValues, tableRegister.size);
+        break;
+    case DataTypeInt16:
+        value = ModbusDataUtils::convertToInt16(registerValues, tableRegister.size);
+        break;
+    case DataTypeUInt32:
+        value = ModbusDataUtils::convertToUInt32(registerValues, tableRegister.size, byteOrder);
+        break;
+    case DataTypeInt32:
+        value = ModbusDataUtils::convertToInt32(registerValues, tableRegister.size, byteOrder);
+        break;
+    case DataTypeUInt64:
+        value = ModbusDataUtils::convertToUInt64(registerValues, tableRegister.size, byteOrder);
+        break;
+    case DataTypeInt64:
+        value = ModbusDataUtils::convertToInt64(registerValues, tableRegister.size, byteOrder);
+        break;
+    case DataTypeFloat32:
+        value = ModbusDataUtils::convertToFloat32(registerValues, tableRegister.size, byteOrder);
+        break;
+    case DataTypeFloat64:
+        value = ModbusDataUtils::convertToFloat64(registerValues, tableRegister.size, byteOrder);
+        break;
+    default:
+        return 0;
+    }
+
+    scaleFactor += tableRegister.scaleFactor;
+    if (scaleFactor == 0)
+        return value;
+
+    return value * pow(10, scaleFactor);
+}
+
+QString ModbusRegisterTable::toString(const Register &tableRegister, const quint16 *values, ModbusDataUtils::ByteOrder characterByteOrder)
+{
+    return ModbusDataUtils::convertToString(values + tableRegister.offset, tableRegister.size, characterByteOrder);
+}
+
+QByteArray ModbusRegisterTable::toByteArray(const Register &tableRegister, const quint16 *values)
+{
+    return ModbusDataUtils::convertToByteArray(values + tableRegister.offset, tableRegister.size);
+}
+
+QVector<quint16> ModbusRegisterTable::toRaw(const Register &tableRegister, const quint16 *values)
+{
+    // Raw values are stored as they are
+    QVector<quint16> rawValues(tableRegister.size);
+    memcpy(rawValues.data(), values + tableRegister.offset, tableRegister.size * sizeof(quint16));
+    return rawValues;
+}
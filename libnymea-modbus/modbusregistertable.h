@@ -0,0 +1,104 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef MODBUSREGISTERTABLE_H
+#define MODBUSREGISTERTABLE_H
+
+#include <QModbusDataUnit>
+
+#include "modbusdatautils.h"
+
+class QModbusReply;
+class ModbusRtuReply;
+class ModbusTcpMaster;
+class ModbusRtuBusScheduler;
+
+// Register descriptor tables of table driven generated connections.
+//
+// Instead of expanding the read and response handling code for each register,
+// the generator describes all reads of a connection in constant tables and
+// the connection walks them using one generic implementation. The tables do
+// not contain any pointers, they end up in read only data without relocations.
+// The registers get decoded from the table as well, only the assignment of the
+// decoded value to the typed property remains per register.
+class ModbusRegisterTable
+{
+public:
+    enum DataType : quint8 {
+        DataTypeUInt16,
+        DataTypeInt16,
+        DataTypeUInt32,
+        DataTypeInt32,
+        DataTypeUInt64,
+        DataTypeInt64,
+        DataTypeFloat32,
+        DataTypeFloat64,
+        DataTypeString,
+        DataTypeByteArray,
+        DataTypeRaw
+    };
+
+    // A read request, containing a single register, a block or merged registers
+    struct Request {
+        quint16 address;
+        quint16 size;
+        QModbusDataUnit::RegisterType registerType;
+        quint16 firstRegister;
+        quint16 registerCount;
+        quint32 interval;
+        quint16 descriptionOffset;
+    };
+
+    // A register decoded from the values of a request. The index refers to the
+    // request reading only this register, the offset to the start of the request.
+    // The scale factor is the static scale factor of the register, 0 if unscaled.
+    struct Register {
+        quint16 request;
+        quint16 offset;
+        quint16 size;
+        DataType dataType;
+        qint8 scaleFactor;
+    };
+
+    static QModbusReply *sendReadRequest(ModbusTcpMaster *modbusTcpMaster, quint16 slaveId, const Request &request);
+    static ModbusRtuReply *sendReadRequest(ModbusRtuBusScheduler *busScheduler, quint16 slaveId, const Request &request);
+
+    static QString description(const char *descriptions, const Request &request);
+
+    // Decode a register from the values of the request containing it. Numbers get scaled
+    // by the static scale factor of the register and the scale factor read from the device.
+    static qint64 toInteger(const Register &tableRegister, const quint16 *values, ModbusDataUtils::ByteOrder byteOrder);
+    static double toNumber(const Register &tableRegister, const quint16 *values, ModbusDataUtils::ByteOrder byteOrder, int scaleFactor = 0);
+    static QString toString(const Register &tableRegister, const quint16 *values, ModbusDataUtils::ByteOrder characterByteOrder);
+    static QByteArray toByteArray(const Register &tableRegister, const quint16 *values);
+    static QVector<quint16> toRaw(const Register &tableRegister, const quint16 *values);
+};
+
+#endif // MODBUSREGISTERTABLE_H
@@ -0,0 +1,143 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+#include "modbusrequestpacer.h"
+
+#include <QtMath>
+#include <QModbusReply>
+
+ModbusRequestPacer::ModbusRequestPacer(double requestRate, int burstSize) :
+    m_requestRate(qMax(requestRate, 0.001)),
+    m_currentRequestRate(m_requestRate),
+    m_burstSize(qMax(burstSize, 1)),
+    m_tokens(m_burstSize)
+{
+
+}
+
+double ModbusRequestPacer::requestRate() const
+{
+    return m_requestRate;
+}
+
+void ModbusRequestPacer::setRequestRate(double requestRate)
+{
+    m_requestRate = qMax(requestRate, 0.001);
+    m_currentRequestRate = qBound(effectiveMinimumRequestRate(), m_currentRequestRate, m_requestRate);
+}
+
+int ModbusRequestPacer::burstSize() const
+{
+    return m_burstSize;
+}
+
+void ModbusRequestPacer::setBurstSize(int burstSize)
+{
+    m_burstSize = qMax(burstSize, 1);
+    m_tokens = qMin(m_tokens, static_cast<double>(m_burstSize));
+}
+
+double ModbusRequestPacer::minimumRequestRate() const
+{
+    return effectiveMinimumRequestRate();
+}
+
+void ModbusRequestPacer::setMinimumRequestRate(double minimumRequestRate)
+{
+    m_minimumRequestRate = minimumRequestRate;
+    m_currentRequestRate = qBound(effectiveMinimumRequestRate(), m_currentRequestRate, m_requestRate);
+}
+
+double ModbusRequestPacer::currentRequestRate() const
+{
+    return m_currentRequestRate;
+}
+
+int ModbusRequestPacer::nextDelay()
+{
+    refill();
+    m_tokens -= 1;
+    if (m_tokens >= 0)
+        return 0;
+
+    // The token has been taken in advance, wait until it would have been refilled
+    return qCeil(-m_tokens * 1000 / m_currentRequestRate);
+}
+
+void ModbusRequestPacer::recordReply(QModbusReply *reply)
+{
+    if (!reply)
+        return;
+
+    int exceptionCode = 0;
+    if (reply->error() == QModbusDevice::ProtocolError && reply->rawResult().isException())
+        exceptionCode = reply->rawResult().exceptionCode();
+
+    recordResult(reply->error(), exceptionCode);
+}
+
+void ModbusRequestPacer::recordResult(QModbusDevice::Error error, int exceptionCode)
+{
+    refill();
+    if (error == QModbusDevice::TimeoutError || (error == QModbusDevice::ProtocolError && exceptionCode == QModbusPdu::ServerDeviceBusy)) {
+        // Multiplicative decrease, and do not spend the remaining burst on a busy device
+        m_currentRequestRate = qMax(m_currentRequestRate / 2, effectiveMinimumRequestRate());
+        m_tokens = qMin(m_tokens, 0.0);
+    } else if (error == QModbusDevice::NoError) {
+        // Additive increase in steps of 1/20 of the configured rate
+        m_currentRequestRate = qMin(m_currentRequestRate + m_requestRate / 20, m_requestRate);
+    }
+}
+
+void ModbusRequestPacer::reset()
+{
+    m_currentRequestRate = m_requestRate;
+    m_tokens = m_burstSize;
+    m_clock.invalidate();
+}
+
+void ModbusRequestPacer::refill()
+{
+    if (!m_clock.isValid()) {
+        m_clock.start();
+        return;
+    }
+
+    m_tokens = qMin(m_tokens + m_clock.restart() * m_currentRequestRate / 1000, static_cast<double>(m_burstSize));
+}
+
+double ModbusRequestPacer::effectiveMinimumRequestRate() const
+{
+    if (m_minimumRequestRate > 0)
+        return qMin(m_minimumRequestRate, m_requestRate);
+
+    return m_requestRate / 16;
+}
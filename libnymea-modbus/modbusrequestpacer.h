@@ -0,0 +1,89 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+#ifndef MODBUSREQUESTPACER_H
+#define MODBUSREQUESTPACER_H
+
+#include <QElapsedTimer>
+#include <QModbusDevice>
+
+class QModbusReply;
+
+// Token bucket rate limiter for queued requests of a connection.
+//
+// Tokens are refilled with the current request rate up to the burst size, each
+// request takes one token. If the bucket is empty, the delay until the next token
+// is available will be returned, so an idle device gets polled without any delay
+// and a busy one no faster than the configured rate.
+//
+// The current rate adapts to the device: each successful reply increases it by a
+// fraction of the configured rate, a timeout or a "Slave Device Busy" exception
+// halves it, down to the minimum rate. The bucket will be emptied on back-off.
+
+class ModbusRequestPacer
+{
+public:
+    // Rate in requests per second
+    explicit ModbusRequestPacer(double requestRate = 10, int burstSize = 1);
+
+    double requestRate() const;
+    void setRequestRate(double requestRate);
+
+    int burstSize() const;
+    void setBurstSize(int burstSize);
+
+    // Lower limit of the current rate while backing off, by default 1/16 of the request rate
+    double minimumRequestRate() const;
+    void setMinimumRequestRate(double minimumRequestRate);
+
+    double currentRequestRate() const;
+
+    // Takes a token and returns the delay in milliseconds until the request may be sent
+    int nextDelay();
+
+    void recordReply(QModbusReply *reply);
+    void recordResult(QModbusDevice::Error error, int exceptionCode = 0);
+
+    void reset();
+
+private:
+    double m_requestRate = 10;
+    double m_minimumRequestRate = -1;
+    double m_currentRequestRate = 10;
+    int m_burstSize = 1;
+    double m_tokens = 1;
+    QElapsedTimer m_clock;
+
+    void refill();
+    double effectiveMinimumRequestRate() const;
+};
+
+#endif // MODBUSREQUESTPACER_H
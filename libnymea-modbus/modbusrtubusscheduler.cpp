@@ -0,0 +1,456 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "modbusrtubusscheduler.h"
+
+#include <QtMath>
+#include <QSharedPointer>
+
+Q_LOGGING_CATEGORY(dcModbusRtuBusScheduler, "ModbusRtuBusScheduler")
+
+QHash<ModbusRtuMaster *, ModbusRtuBusScheduler *> ModbusRtuBusScheduler::s_schedulers;
+
+ModbusRtuScheduledReply::ModbusRtuScheduledReply(int slaveAddress, int registerAddress, QObject *parent) :
+    ModbusRtuReply(parent),
+    m_slaveAddress(slaveAddress),
+    m_registerAddress(registerAddress)
+{
+
+}
+
+bool ModbusRtuScheduledReply::isFinished() const
+{
+    return m_finished;
+}
+
+int ModbusRtuScheduledReply::slaveAddress() const
+{
+    return m_slaveAddress;
+}
+
+int ModbusRtuScheduledReply::registerAddress() const
+{
+    return m_registerAddress;
+}
+
+QString ModbusRtuScheduledReply::errorString() const
+{
+    return m_errorString;
+}
+
+ModbusRtuReply::Error ModbusRtuScheduledReply::error() const
+{
+    return m_error;
+}
+
+QVector<quint16> ModbusRtuScheduledReply::result() const
+{
+    return m_result;
+}
+
+void ModbusRtuScheduledReply::finish(ModbusRtuReply::Error error, const QString &errorString, const QVector<quint16> &result)
+{
+    if (m_finished)
+        return;
+
+    m_finished = true;
+    m_error = error;
+    m_errorString = errorString;
+    m_result = result;
+
+    if (m_error != ModbusRtuReply::NoError)
+        emit errorOccurred(m_error);
+
+    emit finished();
+}
+
+ModbusRtuBusScheduler *ModbusRtuBusScheduler::instance(ModbusRtuMaster *modbusRtuMaster)
+{
+    if (!modbusRtuMaster)
+        return nullptr;
+
+    if (s_schedulers.contains(modbusRtuMaster))
+        return s_schedulers.value(modbusRtuMaster);
+
+    ModbusRtuBusScheduler *scheduler = new ModbusRtuBusScheduler(modbusRtuMaster, modbusRtuMaster);
+    s_schedulers.insert(modbusRtuMaster, scheduler);
+    connect(scheduler, &ModbusRtuBusScheduler::destroyed, [modbusRtuMaster](){
+        s_schedulers.remove(modbusRtuMaster);
+    });
+
+    qCDebug(dcModbusRtuBusScheduler()) << "Created bus scheduler for" << modbusRtuMaster->serialPort();
+    return scheduler;
+}
+
+ModbusRtuBusScheduler::ModbusRtuBusScheduler(ModbusRtuMaster *modbusRtuMaster, QObject *parent) :
+    QObject(parent),
+    m_modbusRtuMaster(modbusRtuMaster)
+{
+    m_clock.start();
+
+    m_interFrameTimer = new QTimer(this);
+    m_interFrameTimer->setSingleShot(true);
+    m_interFrameTimer->setTimerType(Qt::PreciseTimer);
+    connect(m_interFrameTimer, &QTimer::timeout, this, &ModbusRtuBusScheduler::sendNextRequest);
+
+    connect(m_modbusRtuMaster, &ModbusRtuMaster::connectedChanged, this, [this](bool connected){
+        if (!connected) {
+            clearRequestQueue();
+        }
+    });
+}
+
+ModbusRtuMaster *ModbusRtuBusScheduler::modbusRtuMaster() const
+{
+    return m_modbusRtuMaster;
+}
+
+int ModbusRtuBusScheduler::interFrameDelay() const
+{
+    return m_interFrameDelay;
+}
+
+void ModbusRtuBusScheduler::setInterFrameDelay(int interFrameDelay)
+{
+    m_interFrameDelay = interFrameDelay;
+}
+
+int ModbusRtuBusScheduler::backoffThreshold() const
+{
+    return m_backoffThreshold;
+}
+
+void ModbusRtuBusScheduler::setBackoffThreshold(int backoffThreshold)
+{
+    m_backoffThreshold = qMax(1, backoffThreshold);
+}
+
+int ModbusRtuBusScheduler::maxBackoffInterval() const
+{
+    return m_maxBackoffInterval;
+}
+
+void ModbusRtuBusScheduler::setMaxBackoffInterval(int maxBackoffInterval)
+{
+    m_maxBackoffInterval = qMax(m_minBackoffInterval, maxBackoffInterval);
+}
+
+int ModbusRtuBusScheduler::slaveTimeout(int slaveAddress, int frameBytes) const
+{
+    // Until enough responses have been seen, wait as long as the hardware resource does
+    int hardwareTimeout = m_modbusRtuMaster->timeout() * (m_modbusRtuMaster->numberOfRetries() + 1);
+    SlaveState slaveState = m_slaveStates.value(slaveAddress);
+    if (slaveState.latencySamples < m_minLatencySamples)
+        return hardwareTimeout;
+
+    // The learned latency is the processing time of the slave, the transfer time depends on the request
+    int learnedTimeout = qCeil(frameTransferTime(frameBytes) + slaveState.smoothedLatency + 4 * slaveState.latencyVariation);
+    return qBound(m_minSlaveTimeout, learnedTimeout, qMax(m_minSlaveTimeout, hardwareTimeout));
+}
+
+bool ModbusRtuBusScheduler::slaveBackedOff(int slaveAddress) const
+{
+    return m_slaveStates.value(slaveAddress).consecutiveTimeouts >= m_backoffThreshold;
+}
+
+int ModbusRtuBusScheduler::pendingRequests() const
+{
+    return m_queuedRequestsCount + (m_busy ? 1 : 0);
+}
+
+ModbusRtuReply *ModbusRtuBusScheduler::readCoil(int slaveAddress, int registerAddress, quint16 size)
+{
+    // Request: address, function, start, quantity, CRC. Response: address, function, byte count, data, CRC
+    return enqueueRequest(slaveAddress, registerAddress, 8 + 5 + (size + 7) / 8, [=](){
+        return m_modbusRtuMaster->readCoil(slaveAddress, registerAddress, size);
+    });
+}
+
+ModbusRtuReply *ModbusRtuBusScheduler::readDiscreteInput(int slaveAddress, int registerAddress, quint16 size)
+{
+    return enqueueRequest(slaveAddress, registerAddress, 8 + 5 + (size + 7) / 8, [=](){
+        return m_modbusRtuMaster->readDiscreteInput(slaveAddress, registerAddress, size);
+    });
+}
+
+ModbusRtuReply *ModbusRtuBusScheduler::readInputRegister(int slaveAddress, int registerAddress, quint16 size)
+{
+    return enqueueRequest(slaveAddress, registerAddress, 8 + 5 + 2 * size, [=](){
+        return m_modbusRtuMaster->readInputRegister(slaveAddress, registerAddress, size);
+    });
+}
+
+ModbusRtuReply *ModbusRtuBusScheduler::readHoldingRegister(int slaveAddress, int registerAddress, quint16 size)
+{
+    return enqueueRequest(slaveAddress, registerAddress, 8 + 5 + 2 * size, [=](){
+        return m_modbusRtuMaster->readHoldingRegister(slaveAddress, registerAddress, size);
+    });
+}
+
+ModbusRtuReply *ModbusRtuBusScheduler::writeCoils(int slaveAddress, int registerAddress, const QVector<quint16> &values)
+{
+    // Request: address, function, start, quantity, byte count, data, CRC. Response: address, function, start, quantity, CRC
+    return enqueueRequest(slaveAddress, registerAddress, 9 + (values.count() + 7) / 8 + 8, [=](){
+        return m_modbusRtuMaster->writeCoils(slaveAddress, registerAddress, values);
+    });
+}
+
+ModbusRtuReply *ModbusRtuBusScheduler::writeHoldingRegisters(int slaveAddress, int registerAddress, const QVector<quint16> &values)
+{
+    return enqueueRequest(slaveAddress, registerAddress, 9 + 2 * values.count() + 8, [=](){
+        return m_modbusRtuMaster->writeHoldingRegisters(slaveAddress, registerAddress, values);
+    });
+}
+
+ModbusRtuReply *ModbusRtuBusScheduler::enqueueRequest(int slaveAddress, int registerAddress, int frameBytes, const RequestFunction &requestFunction)
+{
+    ModbusRtuScheduledReply *reply = new ModbusRtuScheduledReply(slaveAddress, registerAddress, this);
+    connect(reply, &ModbusRtuScheduledReply::finished, reply, &ModbusRtuScheduledReply::deleteLater);
+
+    if (!m_modbusRtuMaster->connected()) {
+        finishLater(reply, ModbusRtuReply::ConnectionError, "The hardware resource is not connected.");
+        return reply;
+    }
+
+    if (!slaveAvailable(slaveAddress)) {
+        finishLater(reply, ModbusRtuReply::TimeoutError, QString("Slave %1 is not responding. Skipping the request until the next probe.").arg(slaveAddress));
+        return reply;
+    }
+
+    QueuedRequest queuedRequest;
+    queuedRequest.reply = reply;
+    queuedRequest.requestFunction = requestFunction;
+    queuedRequest.frameBytes = frameBytes;
+
+    if (!m_requestQueues.contains(slaveAddress))
+        m_requestQueueOrder.enqueue(slaveAddress);
+
+    m_requestQueues[slaveAddress].enqueue(queuedRequest);
+    m_queuedRequestsCount++;
+
+    sendNextRequest();
+    return reply;
+}
+
+void ModbusRtuBusScheduler::sendNextRequest()
+{
+    // Only one frame on the bus, followed by the silent interval
+    if (m_busy || m_interFrameTimer->isActive())
+        return;
+
+    while (m_queuedRequestsCount > 0) {
+        int slaveAddress = m_requestQueueOrder.head();
+        QueuedRequest queuedRequest = takeNextQueuedRequest();
+        QPointer<ModbusRtuScheduledReply> scheduledReply = queuedRequest.reply;
+        if (scheduledReply.isNull()) {
+            // The reply has been deleted in the meantime, nobody is interested in the result any more
+            continue;
+        }
+
+        if (!slaveAvailable(slaveAddress)) {
+            finishLater(scheduledReply, ModbusRtuReply::TimeoutError, QString("Slave %1 is not responding. Skipping the request until the next probe.").arg(slaveAddress));
+            continue;
+        }
+
+        SlaveState &slaveState = m_slaveStates[slaveAddress];
+        if (slaveState.consecutiveTimeouts >= m_backoffThreshold) {
+            // This request is the probe, all other requests will be skipped until the next one
+            qCDebug(dcModbusRtuBusScheduler()) << "Probing backed off slave" << slaveAddress << "on" << m_modbusRtuMaster->serialPort();
+            slaveState.nextProbe = m_clock.elapsed() + slaveState.backoffInterval;
+        }
+
+        ModbusRtuReply *reply = queuedRequest.requestFunction();
+        if (!reply) {
+            finishLater(scheduledReply, ModbusRtuReply::ConnectionError, "Could not send the request using the hardware resource.");
+            continue;
+        }
+
+        if (reply->isFinished()) {
+            // Broadcast requests will not be answered
+            finishLater(scheduledReply, reply->error(), reply->errorString(), reply->result());
+            m_interFrameTimer->start(effectiveInterFrameDelay());
+            return;
+        }
+
+        m_busy = true;
+        int frameBytes = queuedRequest.frameBytes;
+        qint64 requestStart = m_clock.elapsed();
+        QSharedPointer<bool> timedOut(new bool(false));
+
+        if (m_slaveStates.value(slaveAddress).latencySamples >= m_minLatencySamples) {
+            int timeout = slaveTimeout(slaveAddress, frameBytes);
+            QTimer::singleShot(timeout, scheduledReply.data(), [this, scheduledReply, slaveAddress, frameBytes, timeout, timedOut](){
+                if (scheduledReply->isFinished())
+                    return;
+
+                // The hardware resource keeps waiting for the response, but the caller can go on
+                qCDebug(dcModbusRtuBusScheduler()) << "Slave" << slaveAddress << "did not respond within the learned timeout of" << timeout << "ms";
+                *timedOut = true;
+                scheduledReply->finish(ModbusRtuReply::TimeoutError, QString("Slave %1 did not respond within %2 ms.").arg(slaveAddress).arg(timeout));
+                evaluateResponse(slaveAddress, ModbusRtuReply::TimeoutError, -1, frameBytes);
+            });
+        }
+
+        connect(reply, &ModbusRtuReply::finished, this, [this, reply, scheduledReply, slaveAddress, frameBytes, requestStart, timedOut](){
+            qint64 latency = m_clock.elapsed() - requestStart;
+            if (!*timedOut) {
+                if (!scheduledReply.isNull())
+                    scheduledReply->finish(reply->error(), reply->errorString(), reply->result());
+
+                evaluateResponse(slaveAddress, reply->error(), latency, frameBytes);
+            } else if (reply->error() == ModbusRtuReply::NoError) {
+                // Late response, the slave is alive but slower than learned
+                evaluateResponse(slaveAddress, reply->error(), latency, frameBytes);
+            }
+
+            m_busy = false;
+            m_interFrameTimer->start(effectiveInterFrameDelay());
+        });
+
+        return;
+    }
+}
+
+ModbusRtuBusScheduler::QueuedRequest ModbusRtuBusScheduler::takeNextQueuedRequest()
+{
+    // Take one request from the next slave and move the slave to the end of the line
+    int slaveAddress = m_requestQueueOrder.dequeue();
+    QQueue<QueuedRequest> &requestQueue = m_requestQueues[slaveAddress];
+    QueuedRequest queuedRequest = requestQueue.dequeue();
+    m_queuedRequestsCount--;
+
+    if (requestQueue.isEmpty()) {
+        m_requestQueues.remove(slaveAddress);
+    } else {
+        m_requestQueueOrder.enqueue(slaveAddress);
+    }
+
+    return queuedRequest;
+}
+
+void ModbusRtuBusScheduler::clearRequestQueue()
+{
+    while (m_queuedRequestsCount > 0) {
+        QPointer<ModbusRtuScheduledReply> queuedReply = takeNextQueuedRequest().reply;
+        if (!queuedReply.isNull()) {
+            finishLater(queuedReply, ModbusRtuReply::ConnectionError, "The hardware resource disconnected before the request could be sent.");
+        }
+    }
+}
+
+bool ModbusRtuBusScheduler::slaveAvailable(int slaveAddress) const
+{
+    if (!slaveBackedOff(slaveAddress))
+        return true;
+
+    return m_clock.elapsed() >= m_slaveStates.value(slaveAddress).nextProbe;
+}
+
+void ModbusRtuBusScheduler::finishLater(ModbusRtuScheduledReply *reply, ModbusRtuReply::Error error, const QString &errorString, const QVector<quint16> &result)
+{
+    // The caller expects a pending reply for connecting to it
+    QTimer::singleShot(0, reply, [reply, error, errorString, result](){
+        reply->finish(error, errorString, result);
+    });
+}
+
+void ModbusRtuBusScheduler::evaluateResponse(int slaveAddress, ModbusRtuReply::Error error, qint64 latency, int frameBytes)
+{
+    SlaveState &slaveState = m_slaveStates[slaveAddress];
+    if (error == ModbusRtuReply::TimeoutError) {
+        slaveState.consecutiveTimeouts++;
+        if (slaveState.consecutiveTimeouts < m_backoffThreshold)
+            return;
+
+        if (slaveState.consecutiveTimeouts == m_backoffThreshold) {
+            slaveState.backoffInterval = m_minBackoffInterval;
+            qCWarning(dcModbusRtuBusScheduler()) << "Slave" << slaveAddress << "on" << m_modbusRtuMaster->serialPort() << "did not respond" << slaveState.consecutiveTimeouts << "times. Backing off for" << slaveState.backoffInterval << "ms";
+            emit slaveBackedOffChanged(slaveAddress, true);
+        } else {
+            slaveState.backoffInterval = qMin(slaveState.backoffInterval * 2, m_maxBackoffInterval);
+            qCDebug(dcModbusRtuBusScheduler()) << "Slave" << slaveAddress << "still not responding. Backing off for" << slaveState.backoffInterval << "ms";
+        }
+
+        slaveState.nextProbe = m_clock.elapsed() + slaveState.backoffInterval;
+        return;
+    }
+
+    // Only responses of the slave, including exception responses, tell something about the slave
+    if (error != ModbusRtuReply::NoError && error != ModbusRtuReply::ProtocolError)
+        return;
+
+    if (slaveState.consecutiveTimeouts >= m_backoffThreshold) {
+        qCDebug(dcModbusRtuBusScheduler()) << "Slave" << slaveAddress << "on" << m_modbusRtuMaster->serialPort() << "is responding again.";
+        emit slaveBackedOffChanged(slaveAddress, false);
+    }
+
+    slaveState.consecutiveTimeouts = 0;
+    slaveState.backoffInterval = 0;
+    slaveState.nextProbe = 0;
+
+    // Learn the processing time only, the transfer time depends on the size of the request.
+    // Exception responses are shorter than expected, which only makes the estimation a bit longer.
+    double processingTime = qMax(0.0, latency - frameTransferTime(frameBytes));
+
+    // Smoothed latency and its variation like the TCP retransmission timeout (RFC 6298)
+    if (slaveState.latencySamples == 0) {
+        slaveState.smoothedLatency = processingTime;
+        slaveState.latencyVariation = processingTime / 2.0;
+    } else {
+        slaveState.latencyVariation = 0.75 * slaveState.latencyVariation + 0.25 * qAbs(slaveState.smoothedLatency - processingTime);
+        slaveState.smoothedLatency = 0.875 * slaveState.smoothedLatency + 0.125 * processingTime;
+    }
+
+    slaveState.latencySamples++;
+}
+
+int ModbusRtuBusScheduler::effectiveInterFrameDelay() const
+{
+    if (m_interFrameDelay >= 0)
+        return m_interFrameDelay;
+
+    // 3.5 characters of 11 bits (start, 8 data, parity or second stop and stop bit),
+    // a fixed value of 1.75 ms above 19200 baud, rounded up to the timer resolution
+    qint32 baudrate = m_modbusRtuMaster->baudrate();
+    if (baudrate <= 0 || baudrate > 19200)
+        return 2;
+
+    return qCeil(3.5 * 11 * 1000.0 / baudrate);
+}
+
+double ModbusRtuBusScheduler::frameTransferTime(int frameBytes) const
+{
+    // 11 bits for each character on the line
+    qint32 baudrate = m_modbusRtuMaster->baudrate();
+    if (baudrate <= 0)
+        return 0;
+
+    return frameBytes * 11 * 1000.0 / baudrate;
+}
@@ -0,0 +1,183 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef MODBUSRTUBUSSCHEDULER_H
+#define MODBUSRTUBUSSCHEDULER_H
+
+#include <QHash>
+#include <QQueue>
+#include <QTimer>
+#include <QObject>
+#include <QPointer>
+#include <QElapsedTimer>
+#include <QLoggingCategory>
+
+#include <functional>
+
+#include <hardware/modbus/modbusrtumaster.h>
+
+Q_DECLARE_LOGGING_CATEGORY(dcModbusRtuBusScheduler)
+
+// Reply returned by the scheduler for a request which might not have been sent yet.
+// It forwards the result of the actual request once the request has been executed.
+
+class ModbusRtuScheduledReply : public ModbusRtuReply
+{
+    Q_OBJECT
+public:
+    explicit ModbusRtuScheduledReply(int slaveAddress, int registerAddress, QObject *parent = nullptr);
+
+    bool isFinished() const override;
+    int slaveAddress() const override;
+    int registerAddress() const override;
+    QString errorString() const override;
+    ModbusRtuReply::Error error() const override;
+    QVector<quint16> result() const override;
+
+    void finish(ModbusRtuReply::Error error, const QString &errorString, const QVector<quint16> &result = QVector<quint16>());
+
+private:
+    int m_slaveAddress = 0;
+    int m_registerAddress = 0;
+    bool m_finished = false;
+    ModbusRtuReply::Error m_error = ModbusRtuReply::NoError;
+    QString m_errorString;
+    QVector<quint16> m_result;
+};
+
+// Bus level scheduler for all connections sharing one ModbusRtuMaster.
+//
+// Only one request will be on the bus at any time. Requests are queued for each slave
+// and the slaves are served round robin, so a slave with many registers or a slow response
+// can not delay the other slaves on the line for a whole update cycle. After each response
+// the bus stays silent for the inter frame delay before the next frame will be sent.
+//
+// The response times of each slave are tracked to learn a slave specific timeout. The time
+// required to transfer the request and response frames at the configured baudrate gets
+// subtracted from each sample and added again for each request, so the learned timeout
+// fits small and big requests alike. Requests exceeding it will be reported as timed out
+// to the caller without waiting for the timeout and retries of the hardware resource.
+// Slaves not responding several times in a row will be backed off: their requests fail
+// immediately without using the bus and only one probe request will be sent each backoff
+// interval, doubling up to the max backoff interval until the slave responds again.
+
+class ModbusRtuBusScheduler : public QObject
+{
+    Q_OBJECT
+public:
+    // Returns the scheduler for the given hardware resource, creating it on first use.
+    // The scheduler will be deleted together with the ModbusRtuMaster.
+    static ModbusRtuBusScheduler *instance(ModbusRtuMaster *modbusRtuMaster);
+
+    explicit ModbusRtuBusScheduler(ModbusRtuMaster *modbusRtuMaster, QObject *parent = nullptr);
+
+    ModbusRtuMaster *modbusRtuMaster() const;
+
+    // Silent time between two frames in milliseconds. By default 3.5 character times
+    // of the configured baudrate, or 1.75 ms for baudrates above 19200 as recommended
+    // by the modbus serial line specification. Set -1 to use the default.
+    int interFrameDelay() const;
+    void setInterFrameDelay(int interFrameDelay);
+
+    // Consecutive timeouts until a slave will be backed off
+    int backoffThreshold() const;
+    void setBackoffThreshold(int backoffThreshold);
+
+    // Maximum time in milliseconds between two probe requests to a backed off slave
+    int maxBackoffInterval() const;
+    void setMaxBackoffInterval(int maxBackoffInterval);
+
+    // Learned timeout for a request with the given size of request and response frame in bytes
+    int slaveTimeout(int slaveAddress, int frameBytes = 0) const;
+    bool slaveBackedOff(int slaveAddress) const;
+    int pendingRequests() const;
+
+    ModbusRtuReply *readCoil(int slaveAddress, int registerAddress, quint16 size = 1);
+    ModbusRtuReply *readDiscreteInput(int slaveAddress, int registerAddress, quint16 size = 1);
+    ModbusRtuReply *readInputRegister(int slaveAddress, int registerAddress, quint16 size = 1);
+    ModbusRtuReply *readHoldingRegister(int slaveAddress, int registerAddress, quint16 size = 1);
+
+    ModbusRtuReply *writeCoils(int slaveAddress, int registerAddress, const QVector<quint16> &values);
+    ModbusRtuReply *writeHoldingRegisters(int slaveAddress, int registerAddress, const QVector<quint16> &values);
+
+signals:
+    void slaveBackedOffChanged(int slaveAddress, bool backedOff);
+
+private:
+    typedef std::function<ModbusRtuReply *(void)> RequestFunction;
+
+    struct QueuedRequest {
+        QPointer<ModbusRtuScheduledReply> reply;
+        RequestFunction requestFunction;
+        int frameBytes = 0;
+    };
+
+    struct SlaveState {
+        double smoothedLatency = 0;
+        double latencyVariation = 0;
+        int latencySamples = 0;
+        int consecutiveTimeouts = 0;
+        int backoffInterval = 0;
+        qint64 nextProbe = 0;
+    };
+
+    static QHash<ModbusRtuMaster *, ModbusRtuBusScheduler *> s_schedulers;
+
+    ModbusRtuMaster *m_modbusRtuMaster = nullptr;
+    int m_interFrameDelay = -1;
+    int m_backoffThreshold = 3;
+    int m_maxBackoffInterval = 60000;
+    int m_minBackoffInterval = 1000;
+    int m_minSlaveTimeout = 100;
+    int m_minLatencySamples = 5;
+
+    // One queue for each slave, served round robin
+    QHash<int, QQueue<QueuedRequest>> m_requestQueues;
+    QQueue<int> m_requestQueueOrder;
+    int m_queuedRequestsCount = 0;
+    bool m_busy = false;
+
+    QHash<int, SlaveState> m_slaveStates;
+    QTimer *m_interFrameTimer = nullptr;
+    QElapsedTimer m_clock;
+
+    ModbusRtuReply *enqueueRequest(int slaveAddress, int registerAddress, int frameBytes, const RequestFunction &requestFunction);
+    void sendNextRequest();
+    QueuedRequest takeNextQueuedRequest();
+    void clearRequestQueue();
+
+    bool slaveAvailable(int slaveAddress) const;
+    void finishLater(ModbusRtuScheduledReply *reply, ModbusRtuReply::Error error, const QString &errorString, const QVector<quint16> &result = QVector<quint16>());
+    void evaluateResponse(int slaveAddress, ModbusRtuReply::Error error, qint64 latency, int frameBytes);
+    int effectiveInterFrameDelay() const;
+    double frameTransferTime(int frameBytes) const;
+};
+
+#endif // MODBUSRTUBUSSCHEDULER_H
@@ -0,0 +1,191 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "modbusstatistics.h"
+
+// Size of the MBAP header preceding each PDU on the wire
+static const int mbapHeaderSize = 7;
+
+// Upper limits of the latency buckets in milliseconds, the last bucket takes everything above
+const qint64 ModbusStatistics::s_latencyBucketLimits[s_latencyBucketCount - 1] = {
+    1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000, 60000
+};
+
+ModbusStatistics::ModbusStatistics()
+{
+
+}
+
+quint64 ModbusStatistics::requestCount() const
+{
+    return m_requestCount;
+}
+
+quint64 ModbusStatistics::requestCount(QModbusPdu::FunctionCode functionCode) const
+{
+    return m_requestCounts.value(functionCode, 0);
+}
+
+QMap<QModbusPdu::FunctionCode, quint64> ModbusStatistics::requestCounts() const
+{
+    return m_requestCounts;
+}
+
+quint64 ModbusStatistics::replyCount() const
+{
+    return m_replyCount;
+}
+
+quint64 ModbusStatistics::timeoutCount() const
+{
+    return m_timeoutCount;
+}
+
+quint64 ModbusStatistics::exceptionCount() const
+{
+    return m_exceptionCount;
+}
+
+quint64 ModbusStatistics::errorCount() const
+{
+    return m_errorCount;
+}
+
+quint64 ModbusStatistics::retryCount() const
+{
+    return m_retryCount;
+}
+
+quint64 ModbusStatistics::bytesSent() const
+{
+    return m_bytesSent;
+}
+
+quint64 ModbusStatistics::bytesReceived() const
+{
+    return m_bytesReceived;
+}
+
+QDateTime ModbusStatistics::lastSuccess() const
+{
+    return m_lastSuccess;
+}
+
+qint64 ModbusStatistics::latencyPercentile(double percentile) const
+{
+    if (m_replyCount == 0)
+        return 0;
+
+    // Rank of the requested percentile, at least the first sample
+    quint64 rank = qMax<quint64>(1, static_cast<quint64>(qBound(0.0, percentile, 100.0) / 100.0 * m_replyCount + 0.5));
+    quint64 count = 0;
+    for (int i = 0; i < s_latencyBucketCount - 1; i++) {
+        count += m_latencyBuckets[i];
+        if (count >= rank) {
+            return qMin(s_latencyBucketLimits[i], m_latencyMax);
+        }
+    }
+
+    return m_latencyMax;
+}
+
+qint64 ModbusStatistics::latencyMax() const
+{
+    return m_latencyMax;
+}
+
+void ModbusStatistics::recordRequest(QModbusPdu::FunctionCode functionCode, int requestSize)
+{
+    m_requestCount++;
+    m_requestCounts[functionCode]++;
+    m_bytesSent += mbapHeaderSize + requestSize;
+}
+
+void ModbusStatistics::recordReply(const QModbusReply *reply, qint64 latency, int timeout, int numberOfRetries)
+{
+    m_replyCount++;
+
+    int bucket = 0;
+    while (bucket < s_latencyBucketCount - 1 && latency > s_latencyBucketLimits[bucket])
+        bucket++;
+
+    m_latencyBuckets[bucket]++;
+    m_latencyMax = qMax(m_latencyMax, latency);
+
+    const QModbusResponse response = reply->rawResult();
+    if (response.isValid())
+        m_bytesReceived += mbapHeaderSize + response.size();
+
+    switch (reply->error()) {
+    case QModbusDevice::NoError:
+        m_lastSuccess = QDateTime::currentDateTimeUtc();
+        // Each retry has been sent after the previous attempt timed out
+        if (timeout > 0)
+            m_retryCount += qMin<qint64>(latency / timeout, numberOfRetries);
+
+        break;
+    case QModbusDevice::TimeoutError:
+        m_timeoutCount++;
+        m_retryCount += numberOfRetries;
+        break;
+    default:
+        if (response.isException()) {
+            m_exceptionCount++;
+        } else {
+            m_errorCount++;
+        }
+        break;
+    }
+}
+
+void ModbusStatistics::reset()
+{
+    *this = ModbusStatistics();
+}
+
+QDebug operator<<(QDebug debug, const ModbusStatistics &statistics)
+{
+    debug.nospace().noquote() << "ModbusStatistics(";
+    debug << "requests: " << statistics.requestCount();
+    QMap<QModbusPdu::FunctionCode, quint64> requestCounts = statistics.requestCounts();
+    foreach (QModbusPdu::FunctionCode functionCode, requestCounts.keys()) {
+        debug << ", FC" << static_cast<int>(functionCode) << ": " << requestCounts.value(functionCode);
+    }
+
+    debug << ", latency p50/p95/p99/max: " << statistics.latencyPercentile(50) << "/" << statistics.latencyPercentile(95) << "/" << statistics.latencyPercentile(99) << "/" << statistics.latencyMax() << " ms";
+    debug << ", timeouts: " << statistics.timeoutCount();
+    debug << ", exceptions: " << statistics.exceptionCount();
+    debug << ", errors: " << statistics.errorCount();
+    debug << ", retries: " << statistics.retryCount();
+    debug << ", bytes out/in: " << statistics.bytesSent() << "/" << statistics.bytesReceived();
+    debug << ", last success: " << (statistics.lastSuccess().isValid() ? statistics.lastSuccess().toString(Qt::ISODate) : QString("never"));
+    debug << ")";
+    return debug.space().quote();
+}
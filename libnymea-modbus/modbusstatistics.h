@@ -0,0 +1,97 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef MODBUSSTATISTICS_H
+#define MODBUSSTATISTICS_H
+
+#include <QMap>
+#include <QDebug>
+#include <QDateTime>
+#include <QModbusReply>
+
+// Request statistics of a modbus connection.
+//
+// Counts the requests for each function code, the timeouts, exception responses,
+// other errors and the bytes on the wire (ADU size including the MBAP header).
+// The latencies are collected in a fixed logarithmic histogram, the percentiles
+// are therefore the upper bound of the bucket containing the requested percentile.
+// QModbusClient does not report retries, they are estimated from the latency
+// and the configured timeout.
+
+class ModbusStatistics
+{
+public:
+    explicit ModbusStatistics();
+
+    quint64 requestCount() const;
+    quint64 requestCount(QModbusPdu::FunctionCode functionCode) const;
+    QMap<QModbusPdu::FunctionCode, quint64> requestCounts() const;
+
+    quint64 replyCount() const;
+    quint64 timeoutCount() const;
+    quint64 exceptionCount() const;
+    quint64 errorCount() const;
+    quint64 retryCount() const;
+
+    quint64 bytesSent() const;
+    quint64 bytesReceived() const;
+
+    QDateTime lastSuccess() const;
+
+    // Latencies in milliseconds of all finished requests
+    qint64 latencyPercentile(double percentile) const;
+    qint64 latencyMax() const;
+
+    void recordRequest(QModbusPdu::FunctionCode functionCode, int requestSize);
+    void recordReply(const QModbusReply *reply, qint64 latency, int timeout, int numberOfRetries);
+    void reset();
+
+private:
+    static const int s_latencyBucketCount = 16;
+    static const qint64 s_latencyBucketLimits[s_latencyBucketCount - 1];
+
+    QMap<QModbusPdu::FunctionCode, quint64> m_requestCounts;
+    quint64 m_requestCount = 0;
+    quint64 m_replyCount = 0;
+    quint64 m_timeoutCount = 0;
+    quint64 m_exceptionCount = 0;
+    quint64 m_errorCount = 0;
+    quint64 m_retryCount = 0;
+    quint64 m_bytesSent = 0;
+    quint64 m_bytesReceived = 0;
+    QDateTime m_lastSuccess;
+
+    quint64 m_latencyBuckets[s_latencyBucketCount] = {};
+    qint64 m_latencyMax = 0;
+};
+
+QDebug operator<<(QDebug debug, const ModbusStatistics &statistics);
+
+#endif // MODBUSSTATISTICS_H
@@ -50,6 +50,9 @@ ModbusTcpMaster::ModbusTcpMaster(const QHostAddress &hostAddress, uint port, QOb
     m_reconnectTimer->setSingleShot(true);
     m_reconnectTimer->setInterval(4000);
     connect(m_reconnectTimer, &QTimer::timeout, this, &ModbusTcpMaster::connectDevice);
+
+    m_statisticsLogTimer = new QTimer(this);
+    connect(m_statisticsLogTimer, &QTimer::timeout, this, &ModbusTcpMaster::logStatistics);
 }
 
 ModbusTcpMaster::~ModbusTcpMaster()
@@ -152,6 +155,80 @@ void ModbusTcpMaster::setTimeout(int timeout)
     m_modbusTcpClient->setTimeout(timeout);
 }
 
+int ModbusTcpMaster::maxRequestWindow() const
+{
+    return m_maxRequestWindow;
+}
+
+void ModbusTcpMaster::setMaxRequestWindow(int maxRequestWindow)
+{
+    m_maxRequestWindow = qBound(1, maxRequestWindow, 16);
+    resetRequestWindows();
+    sendNextRequests();
+}
+
+bool ModbusTcpMaster::requestWindowAutoDetection() const
+{
+    return m_requestWindowAutoDetection;
+}
+
+void ModbusTcpMaster::setRequestWindowAutoDetection(bool requestWindowAutoDetection)
+{
+    m_requestWindowAutoDetection = requestWindowAutoDetection;
+    resetRequestWindows();
+    sendNextRequests();
+}
+
+int ModbusTcpMaster::requestWindow(int serverAddress) const
+{
+    if (!m_requestWindows.contains(serverAddress))
+        return m_maxRequestWindow;
+
+    return m_requestWindows.value(serverAddress).window;
+}
+
+int ModbusTcpMaster::pendingRequests() const
+{
+    return m_requestsInFlight.count() + m_queuedRequestsCount;
+}
+
+ModbusStatistics ModbusTcpMaster::statistics() const
+{
+    return m_statistics;
+}
+
+ModbusStatistics ModbusTcpMaster::statistics(int serverAddress) const
+{
+    return m_unitStatistics.value(serverAddress);
+}
+
+QList<int> ModbusTcpMaster::statisticsServerAddresses() const
+{
+    return m_unitStatistics.keys();
+}
+
+void ModbusTcpMaster::resetStatistics()
+{
+    m_statistics.reset();
+    m_unitStatistics.clear();
+}
+
+int ModbusTcpMaster::statisticsLogInterval() const
+{
+    return m_statisticsLogTimer->interval() / 1000;
+}
+
+void ModbusTcpMaster::setStatisticsLogInterval(int statisticsLogInterval)
+{
+    if (statisticsLogInterval <= 0) {
+        m_statisticsLogTimer->stop();
+        m_statisticsLogTimer->setInterval(0);
+        return;
+    }
+
+    m_statisticsLogTimer->start(statisticsLogInterval * 1000);
+}
+
 QString ModbusTcpMaster::errorString() const
 {
     return m_modbusTcpClient->errorString();
@@ -167,7 +244,7 @@ QUuid ModbusTcpMaster::readCoil(uint slaveAddress, uint registerAddress, uint si
     QUuid requestId = QUuid::createUuid();
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::Coils, registerAddress, size);
 
-    if (QModbusReply *reply = m_modbusTcpClient->sendReadRequest(request, slaveAddress)) {
+    if (QModbusReply *reply = sendReadRequest(request, slaveAddress)) {
         if (!reply->isFinished()) {
             connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);
             connect(reply, &QModbusReply::finished, this, [reply, requestId, this] {
@@ -204,7 +281,7 @@ QUuid ModbusTcpMaster::writeHoldingRegisters(uint slaveAddress, uint registerAdd
     QUuid requestId = QUuid::createUuid();
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, registerAddress, values.length());
     request.setValues(values);
-    if (QModbusReply *reply = m_modbusTcpClient->sendWriteRequest(request, slaveAddress)) {
+    if (QModbusReply *reply = sendWriteRequest(request, slaveAddress)) {
         if (!reply->isFinished()) {
             connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);
             connect(reply, &QModbusReply::finished, this, [reply, requestId, this] {
@@ -239,22 +316,58 @@ QUuid ModbusTcpMaster::writeHoldingRegisters(uint slaveAddress, uint registerAdd
 
 QModbusReply *ModbusTcpMaster::sendRawRequest(const QModbusRequest &request, int serverAddress)
 {
-    return m_modbusTcpClient->sendRawRequest(request, serverAddress);
+    return sendRequest(QModbusReply::Raw, serverAddress, request.functionCode(), request.size(), [this, request, serverAddress](){
+        return m_modbusTcpClient->sendRawRequest(request, serverAddress);
+    });
 }
 
 QModbusReply *ModbusTcpMaster::sendReadRequest(const QModbusDataUnit &read, int serverAddress)
 {
-    return m_modbusTcpClient->sendReadRequest(read, serverAddress);
+    QModbusPdu::FunctionCode functionCode = QModbusPdu::ReadHoldingRegisters;
+    switch (read.registerType()) {
+    case QModbusDataUnit::Coils:
+        functionCode = QModbusPdu::ReadCoils;
+        break;
+    case QModbusDataUnit::DiscreteInputs:
+        functionCode = QModbusPdu::ReadDiscreteInputs;
+        break;
+    case QModbusDataUnit::InputRegisters:
+        functionCode = QModbusPdu::ReadInputRegisters;
+        break;
+    default:
+        break;
+    }
+
+    // Function code, start address, quantity
+    return sendRequest(QModbusReply::Common, serverAddress, functionCode, 5, [this, read, serverAddress](){
+        return m_modbusTcpClient->sendReadRequest(read, serverAddress);
+    });
 }
 
 QModbusReply *ModbusTcpMaster::sendReadWriteRequest(const QModbusDataUnit &read, const QModbusDataUnit &write, int serverAddress)
 {
-    return m_modbusTcpClient->sendReadWriteRequest(read, write, serverAddress);
+    // Function code, read address and quantity, write address and quantity, byte count, values
+    return sendRequest(QModbusReply::Common, serverAddress, QModbusPdu::ReadWriteMultipleRegisters, 10 + write.valueCount() * 2, [this, read, write, serverAddress](){
+        return m_modbusTcpClient->sendReadWriteRequest(read, write, serverAddress);
+    });
 }
 
 QModbusReply *ModbusTcpMaster::sendWriteRequest(const QModbusDataUnit &write, int serverAddress)
 {
-    return m_modbusTcpClient->sendWriteRequest(write, serverAddress);
+    // Single values will be written using the single coil / register function codes
+    QModbusPdu::FunctionCode functionCode = QModbusPdu::WriteMultipleRegisters;
+    int requestSize = 6 + write.valueCount() * 2;
+    if (write.registerType() == QModbusDataUnit::Coils) {
+        functionCode = write.valueCount() == 1 ? QModbusPdu::WriteSingleCoil : QModbusPdu::WriteMultipleCoils;
+        requestSize = write.valueCount() == 1 ? 5 : 6 + (write.valueCount() + 7) / 8;
+    } else if (write.valueCount() == 1) {
+        functionCode = QModbusPdu::WriteSingleRegister;
+        requestSize = 5;
+    }
+
+    return sendRequest(serverAddress == 0 ? QModbusReply::Broadcast : QModbusReply::Common, serverAddress, functionCode, requestSize, [this, write, serverAddress](){
+        return m_modbusTcpClient->sendWriteRequest(write, serverAddress);
+    });
 }
 
 QUuid ModbusTcpMaster::readDiscreteInput(uint slaveAddress, uint registerAddress, uint size)
@@ -263,7 +376,7 @@ QUuid ModbusTcpMaster::readDiscreteInput(uint slaveAddress, uint registerAddress
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::DiscreteInputs, registerAddress, size);
 
-    if (QModbusReply *reply = m_modbusTcpClient->sendReadRequest(request, slaveAddress)) {
+    if (QModbusReply *reply = sendReadRequest(request, slaveAddress)) {
         if (!reply->isFinished()) {
             connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);
             connect(reply, &QModbusReply::finished, this, [reply, requestId, this] {
@@ -304,7 +417,7 @@ QUuid ModbusTcpMaster::readInputRegister(uint slaveAddress, uint registerAddress
     QUuid requestId = QUuid::createUuid();
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::InputRegisters, registerAddress, size);
 
-    if (QModbusReply *reply = m_modbusTcpClient->sendReadRequest(request, slaveAddress)) {
+    if (QModbusReply *reply = sendReadRequest(request, slaveAddress)) {
         if (!reply->isFinished()) {
             connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);
             connect(reply, &QModbusReply::finished, this, [reply, requestId, this] {
@@ -343,7 +456,7 @@ QUuid ModbusTcpMaster::readHoldingRegister(uint slaveAddress, uint registerAddre
     QUuid requestId = QUuid::createUuid();
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, registerAddress, size);
 
-    if (QModbusReply *reply = m_modbusTcpClient->sendReadRequest(request, slaveAddress)) {
+    if (QModbusReply *reply = sendReadRequest(request, slaveAddress)) {
         if (!reply->isFinished()) {
             connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);
             connect(reply, &QModbusReply::finished, this, [reply, requestId, this] {
@@ -391,7 +504,7 @@ QUuid ModbusTcpMaster::writeCoils(uint slaveAddress, uint registerAddress, const
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::Coils, registerAddress, values.length());
     request.setValues(values);
 
-    if (QModbusReply *reply = m_modbusTcpClient->sendWriteRequest(request, slaveAddress)) {
+    if (QModbusReply *reply = sendWriteRequest(request, slaveAddress)) {
         if (!reply->isFinished()) {
             connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);
             connect(reply, &QModbusReply::finished, this, [reply, requestId, this] () {
@@ -431,6 +544,228 @@ QUuid ModbusTcpMaster::writeHoldingRegister(uint slaveAddress, uint registerAddr
     return writeHoldingRegisters(slaveAddress, registerAddress, QVector<quint16>() << value);
 }
 
+QModbusReply *ModbusTcpMaster::sendRequest(QModbusReply::ReplyType replyType, int serverAddress, QModbusPdu::FunctionCode functionCode, int requestSize, const RequestFunction &requestFunction)
+{
+    // Send the request directly if nothing is queued for this unit and the request window allows it.
+    // If we are not connected, the client will fail the request and set the error accordingly.
+    if (!m_connected || (!m_requestQueues.contains(serverAddress) && requestWindowAvailable(serverAddress))) {
+        QModbusReply *reply = requestFunction();
+        trackRequest(reply, functionCode, requestSize);
+        return reply;
+    }
+
+    // The request window is exhausted. Return a reply which will be finished
+    // once the actual request has been sent and finished.
+    QModbusReply *reply = new QModbusReply(replyType, serverAddress, this);
+
+    QueuedRequest queuedRequest;
+    queuedRequest.reply = reply;
+    queuedRequest.requestFunction = requestFunction;
+    queuedRequest.functionCode = functionCode;
+    queuedRequest.requestSize = requestSize;
+    if (!m_requestQueues.contains(serverAddress))
+        m_requestQueueOrder.enqueue(serverAddress);
+
+    m_requestQueues[serverAddress].enqueue(queuedRequest);
+    m_queuedRequestsCount++;
+    return reply;
+}
+
+void ModbusTcpMaster::trackRequest(QModbusReply *reply, QModbusPdu::FunctionCode functionCode, int requestSize)
+{
+    if (!reply)
+        return;
+
+    m_statistics.recordRequest(functionCode, requestSize);
+    m_unitStatistics[reply->serverAddress()].recordRequest(functionCode, requestSize);
+    if (reply->isFinished())
+        return;
+
+    QElapsedTimer requestTimer;
+    requestTimer.start();
+
+    m_requestsInFlight.append(reply);
+    connect(reply, &QModbusReply::finished, this, [this, reply, requestTimer](){
+        if (m_requestsInFlight.removeAll(reply) == 0)
+            return;
+
+        qint64 latency = requestTimer.elapsed();
+        m_statistics.recordReply(reply, latency, m_timeout, m_numberOfRetries);
+        m_unitStatistics[reply->serverAddress()].recordReply(reply, latency, m_timeout, m_numberOfRetries);
+
+        evaluateRequestWindow(reply);
+        sendNextRequests();
+    });
+
+    // Make sure the window gets released if the reply gets deleted before finishing
+    connect(reply, &QModbusReply::destroyed, this, [this, reply](){
+        if (m_requestsInFlight.removeAll(reply) > 0) {
+            sendNextRequests();
+        }
+    });
+}
+
+void ModbusTcpMaster::sendNextRequests()
+{
+    // Units which exhausted their own request window get skipped until one of their requests finished
+    int skippedServerAddresses = 0;
+    while (m_queuedRequestsCount > 0 && m_requestsInFlight.count() < m_maxRequestWindow && skippedServerAddresses < m_requestQueueOrder.count()) {
+        if (!requestWindowAvailable(m_requestQueueOrder.head())) {
+            m_requestQueueOrder.enqueue(m_requestQueueOrder.dequeue());
+            skippedServerAddresses++;
+            continue;
+        }
+
+        skippedServerAddresses = 0;
+        QueuedRequest queuedRequest = takeNextQueuedRequest();
+        QPointer<QModbusReply> queuedReply = queuedRequest.reply;
+        if (queuedReply.isNull()) {
+            // The reply has been deleted in the meantime, nobody is interested in the result any more
+            continue;
+        }
+
+        QModbusReply *reply = queuedRequest.requestFunction();
+        if (!reply) {
+            queuedReply->setError(m_modbusTcpClient->error(), m_modbusTcpClient->errorString());
+            continue;
+        }
+
+        trackRequest(reply, queuedRequest.functionCode, queuedRequest.requestSize);
+        if (reply->isFinished()) {
+            finishQueuedRequest(reply, queuedReply);
+            reply->deleteLater(); // Broadcast replies return immediately
+            continue;
+        }
+
+        connect(reply, &QModbusReply::finished, this, [this, reply, queuedReply](){
+            if (!queuedReply.isNull())
+                finishQueuedRequest(reply, queuedReply);
+
+            reply->deleteLater();
+        });
+    }
+}
+
+ModbusTcpMaster::QueuedRequest ModbusTcpMaster::takeNextQueuedRequest()
+{
+    // Take one request from the next server address and move the address to the end of the line
+    int serverAddress = m_requestQueueOrder.dequeue();
+    QQueue<QueuedRequest> &requestQueue = m_requestQueues[serverAddress];
+    QueuedRequest queuedRequest = requestQueue.dequeue();
+    m_queuedRequestsCount--;
+
+    if (requestQueue.isEmpty()) {
+        m_requestQueues.remove(serverAddress);
+    } else {
+        m_requestQueueOrder.enqueue(serverAddress);
+    }
+
+    return queuedRequest;
+}
+
+void ModbusTcpMaster::clearRequestQueue()
+{
+    while (m_queuedRequestsCount > 0) {
+        QPointer<QModbusReply> queuedReply = takeNextQueuedRequest().reply;
+        if (!queuedReply.isNull()) {
+            queuedReply->setError(QModbusDevice::ConnectionError, "Device disconnected before the request could be sent.");
+        }
+    }
+}
+
+void ModbusTcpMaster::finishQueuedRequest(QModbusReply *reply, QModbusReply *queuedReply)
+{
+    queuedReply->setResult(reply->result());
+    queuedReply->setRawResult(reply->rawResult());
+    if (reply->error() != QModbusDevice::NoError) {
+        queuedReply->setError(reply->error(), reply->errorString());
+    } else {
+        queuedReply->setFinished(true);
+    }
+}
+
+bool ModbusTcpMaster::requestWindowAvailable(int serverAddress) const
+{
+    if (m_requestsInFlight.count() >= m_maxRequestWindow)
+        return false;
+
+    int requestsInFlight = 0;
+    foreach (QModbusReply *reply, m_requestsInFlight) {
+        if (reply->serverAddress() == serverAddress) {
+            requestsInFlight++;
+        }
+    }
+
+    return requestsInFlight < requestWindow(serverAddress);
+}
+
+void ModbusTcpMaster::setRequestWindow(int serverAddress, int requestWindow)
+{
+    RequestWindow &unitRequestWindow = m_requestWindows[serverAddress];
+    if (unitRequestWindow.window == requestWindow)
+        return;
+
+    qCDebug(dcModbusTcpMaster()) << "Request window changed for" << connectionUrl() << "unit" << serverAddress << "from" << unitRequestWindow.window << "to" << requestWindow;
+    unitRequestWindow.window = requestWindow;
+    emit requestWindowChanged(serverAddress, requestWindow);
+}
+
+void ModbusTcpMaster::resetRequestWindows()
+{
+    foreach (int serverAddress, m_requestWindows.keys()) {
+        m_requestWindows[serverAddress].successCounter = 0;
+        m_requestWindows[serverAddress].growThreshold = 32;
+        setRequestWindow(serverAddress, m_maxRequestWindow);
+    }
+}
+
+void ModbusTcpMaster::evaluateRequestWindow(QModbusReply *reply)
+{
+    if (!m_requestWindowAutoDetection)
+        return;
+
+    bool deviceBusy = false;
+    if (reply->error() == QModbusDevice::ProtocolError) {
+        QModbusResponse response = reply->rawResult();
+        deviceBusy = response.isException() && response.exceptionCode() == QModbusPdu::ServerDeviceBusy;
+    }
+
+    int serverAddress = reply->serverAddress();
+    if (!m_requestWindows.contains(serverAddress))
+        m_requestWindows[serverAddress].window = m_maxRequestWindow;
+
+    RequestWindow &unitRequestWindow = m_requestWindows[serverAddress];
+    if (reply->error() == QModbusDevice::TimeoutError || deviceBusy) {
+        unitRequestWindow.successCounter = 0;
+        if (unitRequestWindow.window > 1) {
+            // Devices not able to handle concurrent requests normally drop them or report to be busy.
+            // Reduce the window down to serial mode and wait longer before trying to grow it again.
+            qCWarning(dcModbusTcpMaster()) << "Device" << connectionUrl() << "unit" << serverAddress << "seems not to handle" << unitRequestWindow.window << "concurrent requests:" << reply->errorString() << "Reducing request window.";
+            unitRequestWindow.growThreshold = qMin(unitRequestWindow.growThreshold * 2, 4096);
+            setRequestWindow(serverAddress, unitRequestWindow.window / 2);
+        }
+        return;
+    }
+
+    if (reply->error() != QModbusDevice::NoError || unitRequestWindow.window >= m_maxRequestWindow)
+        return;
+
+    unitRequestWindow.successCounter++;
+    if (unitRequestWindow.successCounter >= unitRequestWindow.growThreshold) {
+        unitRequestWindow.successCounter = 0;
+        setRequestWindow(serverAddress, unitRequestWindow.window + 1);
+        sendNextRequests();
+    }
+}
+
+void ModbusTcpMaster::logStatistics()
+{
+    qCInfo(dcModbusTcpMaster()) << "Statistics of" << connectionUrl() << m_statistics;
+    foreach (int serverAddress, m_unitStatistics.keys()) {
+        qCInfo(dcModbusTcpMaster()) << "Statistics of" << connectionUrl() << "unit" << serverAddress << m_unitStatistics.value(serverAddress);
+    }
+}
+
 void ModbusTcpMaster::onModbusErrorOccurred(QModbusDevice::Error error)
 {
     qCWarning(dcModbusTcpMaster()) << "An error occurred for device" << connectionUrl() << ":" << error;
@@ -451,6 +786,7 @@ void ModbusTcpMaster::onModbusStateChanged(QModbusDevice::State state)
     if (m_connected) {
         m_reconnectTimer->stop();
     } else if (state == QModbusDevice::UnconnectedState) {
+        clearRequestQueue();
         m_reconnectTimer->start();
     }
 }
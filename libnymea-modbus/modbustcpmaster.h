@@ -32,12 +32,19 @@
 #define MODBUSTCPMASTER_H
 
 #include <QUuid>
+#include <QQueue>
 #include <QTimer>
 #include <QObject>
+#include <QPointer>
+#include <QElapsedTimer>
 #include <QHostAddress>
 #include <QtSerialBus>
 #include <QLoggingCategory>
 
+#include <functional>
+
+#include "modbusstatistics.h"
+
 Q_DECLARE_LOGGING_CATEGORY(dcModbusTcpMaster)
 
 class ModbusTcpMaster : public QObject
@@ -65,6 +72,30 @@ public:
     int timeout() const;
     void setTimeout(int timeout);
 
+    // Amount of requests sent to the device without waiting for the responses (1 - 16).
+    // Responses will be matched using the transaction ID, independent of the order they arrive.
+    int maxRequestWindow() const;
+    void setMaxRequestWindow(int maxRequestWindow);
+
+    // If enabled, the request window of each server address shrinks on timeouts or busy units down to
+    // serial mode and grows again up to the max request window while the unit responds reliably.
+    // The max request window limits the requests in flight of all server addresses together.
+    bool requestWindowAutoDetection() const;
+    void setRequestWindowAutoDetection(bool requestWindowAutoDetection);
+
+    int requestWindow(int serverAddress) const;
+    int pendingRequests() const;
+
+    // Request statistics of the whole connection or of a single server address
+    ModbusStatistics statistics() const;
+    ModbusStatistics statistics(int serverAddress) const;
+    QList<int> statisticsServerAddresses() const;
+    void resetStatistics();
+
+    // Interval in seconds for writing the statistics to the log, 0 disables the log output
+    int statisticsLogInterval() const;
+    void setStatisticsLogInterval(int statisticsLogInterval);
+
     QString errorString() const;
     QModbusDevice::Error error() const;
 
@@ -100,6 +131,52 @@ protected:
     int m_numberOfRetries = 3;
     bool m_connected = false;
 
+private:
+    typedef std::function<QModbusReply *(void)> RequestFunction;
+
+    struct QueuedRequest {
+        QPointer<QModbusReply> reply;
+        RequestFunction requestFunction;
+        QModbusPdu::FunctionCode functionCode = QModbusPdu::Invalid;
+        int requestSize = 0;
+    };
+
+    struct RequestWindow {
+        int window = 16;
+        int successCounter = 0;
+        int growThreshold = 32;
+    };
+
+    int m_maxRequestWindow = 16;
+    bool m_requestWindowAutoDetection = true;
+    QVector<QModbusReply *> m_requestsInFlight;
+
+    // Window and grow back off of each server address, so a unit timing out
+    // behind a shared gateway does not slow down the other units.
+    QHash<int, RequestWindow> m_requestWindows;
+
+    // One queue for each server address, served round robin so a busy
+    // unit behind a shared gateway can not starve the other units.
+    QHash<int, QQueue<QueuedRequest>> m_requestQueues;
+    QQueue<int> m_requestQueueOrder;
+    int m_queuedRequestsCount = 0;
+
+    ModbusStatistics m_statistics;
+    QHash<int, ModbusStatistics> m_unitStatistics;
+    QTimer *m_statisticsLogTimer = nullptr;
+
+    QModbusReply *sendRequest(QModbusReply::ReplyType replyType, int serverAddress, QModbusPdu::FunctionCode functionCode, int requestSize, const RequestFunction &requestFunction);
+    void trackRequest(QModbusReply *reply, QModbusPdu::FunctionCode functionCode, int requestSize);
+    void sendNextRequests();
+    QueuedRequest takeNextQueuedRequest();
+    void clearRequestQueue();
+    void finishQueuedRequest(QModbusReply *reply, QModbusReply *queuedReply);
+    bool requestWindowAvailable(int serverAddress) const;
+    void setRequestWindow(int serverAddress, int requestWindow);
+    void resetRequestWindows();
+    void evaluateRequestWindow(QModbusReply *reply);
+    void logStatistics();
+
 private slots:
     void onModbusErrorOccurred(QModbusDevice::Error error);
     void onModbusStateChanged(QModbusDevice::State state);
@@ -107,6 +184,7 @@ private slots:
 signals:
     void connectionStateChanged(bool status);
     void connectionErrorOccurred(QModbusDevice::Error error);
+    void requestWindowChanged(int serverAddress, int requestWindow);
 
     void writeRequestExecuted(const QUuid &requestId, bool success);
     void writeRequestError(const QUuid &requestId, const QString &error);
@@ -0,0 +1,122 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "modbustcpmasterregistry.h"
+
+QHash<QString, ModbusTcpMasterRegistry::Entry> ModbusTcpMasterRegistry::s_entries;
+
+ModbusTcpMaster *ModbusTcpMasterRegistry::acquire(const QHostAddress &hostAddress, uint port)
+{
+    QString key = buildKey(hostAddress, port);
+    if (s_entries.contains(key)) {
+        Entry &entry = s_entries[key];
+        entry.referenceCount++;
+        qCDebug(dcModbusTcpMaster()) << "Sharing existing connection to" << key << "with" << entry.referenceCount << "users";
+        return entry.modbusTcpMaster;
+    }
+
+    Entry entry;
+    entry.modbusTcpMaster = new ModbusTcpMaster(hostAddress, port);
+    entry.referenceCount = 1;
+    s_entries.insert(key, entry);
+
+    // Clean up if somebody deletes the master directly. The key might already
+    // belong to a new master if this one has been released and deleted later.
+    ModbusTcpMaster *modbusTcpMaster = entry.modbusTcpMaster;
+    QObject::connect(modbusTcpMaster, &ModbusTcpMaster::destroyed, [key, modbusTcpMaster](){
+        if (s_entries.contains(key) && s_entries.value(key).modbusTcpMaster == modbusTcpMaster) {
+            s_entries.remove(key);
+        }
+    });
+
+    qCDebug(dcModbusTcpMaster()) << "Created shared connection to" << key;
+    entry.modbusTcpMaster->connectDevice();
+    return entry.modbusTcpMaster;
+}
+
+void ModbusTcpMasterRegistry::release(ModbusTcpMaster *modbusTcpMaster)
+{
+    if (!modbusTcpMaster)
+        return;
+
+    // Look up by pointer, the host address of the master might have been changed in the meantime
+    QString key = findKey(modbusTcpMaster);
+    if (key.isEmpty()) {
+        qCWarning(dcModbusTcpMaster()) << "Tried to release connection to" << modbusTcpMaster->connectionUrl() << "which is not managed by the registry.";
+        return;
+    }
+
+    Entry &entry = s_entries[key];
+    entry.referenceCount--;
+    if (entry.referenceCount > 0) {
+        qCDebug(dcModbusTcpMaster()) << "Released shared connection to" << key << "still used by" << entry.referenceCount << "users";
+        return;
+    }
+
+    qCDebug(dcModbusTcpMaster()) << "Last user released the shared connection to" << key << ". Closing connection.";
+    s_entries.remove(key);
+    modbusTcpMaster->disconnectDevice();
+    modbusTcpMaster->deleteLater();
+}
+
+int ModbusTcpMasterRegistry::referenceCount(ModbusTcpMaster *modbusTcpMaster)
+{
+    QString key = findKey(modbusTcpMaster);
+    if (key.isEmpty())
+        return 0;
+
+    return s_entries.value(key).referenceCount;
+}
+
+QList<ModbusTcpMaster *> ModbusTcpMasterRegistry::modbusTcpMasters()
+{
+    QList<ModbusTcpMaster *> modbusTcpMasters;
+    foreach (const Entry &entry, s_entries) {
+        modbusTcpMasters.append(entry.modbusTcpMaster);
+    }
+
+    return modbusTcpMasters;
+}
+
+QString ModbusTcpMasterRegistry::buildKey(const QHostAddress &hostAddress, uint port)
+{
+    return QString("%1:%2").arg(hostAddress.toString()).arg(port);
+}
+
+QString ModbusTcpMasterRegistry::findKey(ModbusTcpMaster *modbusTcpMaster)
+{
+    for (QHash<QString, Entry>::const_iterator it = s_entries.constBegin(); it != s_entries.constEnd(); ++it) {
+        if (it.value().modbusTcpMaster == modbusTcpMaster) {
+            return it.key();
+        }
+    }
+
+    return QString();
+}
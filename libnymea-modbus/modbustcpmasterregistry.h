@@ -0,0 +1,70 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef MODBUSTCPMASTERREGISTRY_H
+#define MODBUSTCPMASTERREGISTRY_H
+
+#include <QHash>
+#include <QObject>
+#include <QHostAddress>
+
+#include "modbustcpmaster.h"
+
+// Process wide registry sharing one ModbusTcpMaster for each host:port.
+//
+// Many RS485 to TCP gateways accept only a few TCP clients. Devices behind the same
+// gateway should therefore acquire the master from this registry and pass it together
+// with their unit ID to the generated connection class. Requests from different unit IDs
+// will be scheduled round robin on the shared socket. The master gets connected on the
+// first acquire and will be disconnected and deleted once the last user released it.
+// Users of a shared master should call release() instead of disconnectDevice().
+
+class ModbusTcpMasterRegistry
+{
+public:
+    static ModbusTcpMaster *acquire(const QHostAddress &hostAddress, uint port = 502);
+    static void release(ModbusTcpMaster *modbusTcpMaster);
+
+    static int referenceCount(ModbusTcpMaster *modbusTcpMaster);
+    static QList<ModbusTcpMaster *> modbusTcpMasters();
+
+private:
+    typedef struct Entry {
+        ModbusTcpMaster *modbusTcpMaster = nullptr;
+        int referenceCount = 0;
+    } Entry;
+
+    static QHash<QString, Entry> s_entries;
+
+    static QString buildKey(const QHostAddress &hostAddress, uint port);
+    static QString findKey(ModbusTcpMaster *modbusTcpMaster);
+};
+
+#endif // MODBUSTCPMASTERREGISTRY_H
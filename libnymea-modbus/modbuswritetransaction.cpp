@@ -0,0 +1,227 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+#include "modbuswritetransaction.h"
+#include "modbustcpmaster.h"
+
+#include <algorithm>
+
+bool ModbusWriteTransaction::isActive() const
+{
+    return m_active;
+}
+
+int ModbusWriteTransaction::count() const
+{
+    return m_writes.count();
+}
+
+void ModbusWriteTransaction::begin()
+{
+    // Writes staged by a previous transaction without commit will be sent with this one
+    m_active = true;
+}
+
+bool ModbusWriteTransaction::isStaged(int order) const
+{
+    foreach (const StagedWrite &write, m_writes) {
+        if (write.order == order && (!write.reply.isNull() || !write.rtuReply.isNull())) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+QModbusReply *ModbusWriteTransaction::stageWrite(int order, const QModbusDataUnit &unit, int serverAddress, QObject *parent)
+{
+    StagedWrite *stagedWrite = findStagedWrite(order);
+    if (stagedWrite && !stagedWrite->reply.isNull()) {
+        stagedWrite->unit = unit;
+        return stagedWrite->reply;
+    }
+
+    StagedWrite write;
+    write.order = order;
+    write.unit = unit;
+    write.reply = new QModbusReply(QModbusReply::Common, serverAddress, parent);
+    m_writes.append(write);
+    return write.reply;
+}
+
+ModbusRtuReply *ModbusWriteTransaction::stageRtuWrite(int order, const QModbusDataUnit &unit, int slaveAddress, QObject *parent)
+{
+    StagedWrite *stagedWrite = findStagedWrite(order);
+    if (stagedWrite && !stagedWrite->rtuReply.isNull()) {
+        stagedWrite->unit = unit;
+        return stagedWrite->rtuReply;
+    }
+
+    StagedWrite write;
+    write.order = order;
+    write.unit = unit;
+    write.rtuReply = new ModbusRtuScheduledReply(slaveAddress, unit.startAddress(), parent);
+    m_writes.append(write);
+    return write.rtuReply;
+}
+
+bool ModbusWriteTransaction::commit(ModbusTcpMaster *modbusTcpMaster, int serverAddress)
+{
+    if (!m_active)
+        return false;
+
+    foreach (const Request &request, takeRequests()) {
+        QModbusReply *reply = modbusTcpMaster->sendWriteRequest(request.unit, serverAddress);
+        if (!reply) {
+            foreach (const StagedWrite &write, request.writes) {
+                if (!write.reply.isNull()) {
+                    write.reply->setError(QModbusDevice::ConnectionError, modbusTcpMaster->errorString());
+                }
+            }
+            continue;
+        }
+
+        // Finish the staged replies of all writes contained in this request
+        QVector<StagedWrite> writes = request.writes;
+        auto finishWrites = [reply, writes](){
+            foreach (const StagedWrite &write, writes) {
+                if (write.reply.isNull())
+                    continue;
+
+                write.reply->setResult(write.unit);
+                write.reply->setRawResult(reply->rawResult());
+                if (reply->error() != QModbusDevice::NoError) {
+                    write.reply->setError(reply->error(), reply->errorString());
+                } else {
+                    write.reply->setFinished(true);
+                }
+            }
+        };
+
+        if (reply->isFinished()) {
+            finishWrites(); // Broadcast replies return immediately
+            reply->deleteLater();
+            continue;
+        }
+
+        QObject::connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);
+        QObject::connect(reply, &QModbusReply::finished, reply, finishWrites);
+    }
+
+    return true;
+}
+
+bool ModbusWriteTransaction::commit(ModbusRtuBusScheduler *busScheduler, int slaveAddress)
+{
+    if (!m_active)
+        return false;
+
+    foreach (const Request &request, takeRequests()) {
+        ModbusRtuReply *reply = nullptr;
+        if (request.unit.registerType() == QModbusDataUnit::Coils) {
+            reply = busScheduler->writeCoils(slaveAddress, request.unit.startAddress(), request.unit.values());
+        } else {
+            reply = busScheduler->writeHoldingRegisters(slaveAddress, request.unit.startAddress(), request.unit.values());
+        }
+
+        // The scheduler always returns a reply and finishes it later on errors
+        QVector<StagedWrite> writes = request.writes;
+        QObject::connect(reply, &ModbusRtuReply::finished, reply, [reply, writes](){
+            foreach (const StagedWrite &write, writes) {
+                if (!write.rtuReply.isNull()) {
+                    write.rtuReply->finish(reply->error(), reply->errorString(), write.unit.values());
+                }
+            }
+        });
+    }
+
+    return true;
+}
+
+void ModbusWriteTransaction::abort()
+{
+    foreach (const StagedWrite &write, m_writes) {
+        if (!write.reply.isNull())
+            write.reply->setError(QModbusDevice::UnknownError, "The write transaction has been aborted.");
+
+        if (!write.rtuReply.isNull())
+            write.rtuReply->finish(ModbusRtuReply::UnknownError, "The write transaction has been aborted.");
+    }
+
+    m_writes.clear();
+    m_active = false;
+}
+
+ModbusWriteTransaction::StagedWrite *ModbusWriteTransaction::findStagedWrite(int order)
+{
+    for (int i = 0; i < m_writes.count(); i++) {
+        if (m_writes.at(i).order == order) {
+            return &m_writes[i];
+        }
+    }
+
+    return nullptr;
+}
+
+QVector<ModbusWriteTransaction::Request> ModbusWriteTransaction::takeRequests()
+{
+    QVector<StagedWrite> writes;
+    writes.swap(m_writes);
+    m_active = false;
+
+    std::stable_sort(writes.begin(), writes.end(), [](const StagedWrite &a, const StagedWrite &b){
+        return a.order < b.order;
+    });
+
+    // Merge holding register writes continuing the previous request
+    QVector<Request> requests;
+    foreach (const StagedWrite &write, writes) {
+        if (!requests.isEmpty()) {
+            Request &request = requests.last();
+            if (write.unit.registerType() == QModbusDataUnit::HoldingRegisters
+                    && request.unit.registerType() == QModbusDataUnit::HoldingRegisters
+                    && write.unit.startAddress() == request.unit.startAddress() + static_cast<int>(request.unit.valueCount())
+                    && static_cast<int>(request.unit.valueCount() + write.unit.valueCount()) <= maxRequestSize) {
+                request.unit.setValues(request.unit.values() + write.unit.values());
+                request.unit.setValueCount(request.unit.values().count());
+                request.writes.append(write);
+                continue;
+            }
+        }
+
+        Request request;
+        request.unit = write.unit;
+        request.writes.append(write);
+        requests.append(request);
+    }
+
+    return requests;
+}
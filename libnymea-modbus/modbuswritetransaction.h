@@ -0,0 +1,97 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+#ifndef MODBUSWRITETRANSACTION_H
+#define MODBUSWRITETRANSACTION_H
+
+#include <QVector>
+#include <QPointer>
+#include <QModbusReply>
+#include <QModbusDataUnit>
+
+#include "modbusrtubusscheduler.h"
+
+class ModbusTcpMaster;
+
+// Collects the writes of several setters and sends them at once.
+//
+// Between begin() and commit() writes will only be staged, each returning a reply
+// which finishes once the request containing the write has finished. On commit the
+// writes are sorted by their order, i.e. the position of the register in the register
+// JSON, and adjacent holding register writes get merged into as few write multiple
+// registers requests (function code 16) as possible. Writing the same register again
+// within a transaction replaces the staged value and returns the same reply.
+
+class ModbusWriteTransaction
+{
+public:
+    // Maximum number of registers within one write multiple registers request
+    static const int maxRequestSize = 123;
+
+    bool isActive() const;
+    int count() const;
+
+    void begin();
+
+    // True if a write with the given order has been staged already, staging it again returns the same reply
+    bool isStaged(int order) const;
+
+    QModbusReply *stageWrite(int order, const QModbusDataUnit &unit, int serverAddress, QObject *parent);
+    ModbusRtuReply *stageRtuWrite(int order, const QModbusDataUnit &unit, int slaveAddress, QObject *parent);
+
+    // Sends the staged writes and ends the transaction. Returns false if no transaction was active.
+    bool commit(ModbusTcpMaster *modbusTcpMaster, int serverAddress);
+    bool commit(ModbusRtuBusScheduler *busScheduler, int slaveAddress);
+
+    // Ends the transaction without sending, the staged replies finish with an error
+    void abort();
+
+private:
+    struct StagedWrite {
+        int order = 0;
+        QModbusDataUnit unit;
+        QPointer<QModbusReply> reply;
+        QPointer<ModbusRtuScheduledReply> rtuReply;
+    };
+
+    struct Request {
+        QModbusDataUnit unit;
+        QVector<StagedWrite> writes;
+    };
+
+    bool m_active = false;
+    QVector<StagedWrite> m_writes;
+
+    StagedWrite *findStagedWrite(int order);
+    QVector<Request> takeRequests();
+};
+
+#endif // MODBUSWRITETRANSACTION_H
@@ -40,7 +40,7 @@ def writePropertyGetSetMethodDeclarationsRtu(fileDescriptor, registerDefinitions
         writeLine(fileDescriptor)
 
 
-def writePropertyGetSetMethodImplementationsRtu(fileDescriptor, className, registerDefinitions):
+def writePropertyGetSetMethodImplementationsRtu(fileDescriptor, className, registerDefinitions, registerJson = None, writeTransactions = False, tableDriven = False):
     for registerDefinition in registerDefinitions:
         propertyName = registerDefinition['id']
         propertyTyp = getCppDataType(registerDefinition)
@@ -65,13 +65,31 @@ def writePropertyGetSetMethodImplementationsRtu(fileDescriptor, className, regis
             writeLine(fileDescriptor, '    QVector<quint16> values = %s;' % getConversionToValueMethod(registerDefinition))
             writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Write \\"%s\\" register:" << %s << "size:" << %s << values;' % (className, registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
             if registerDefinition['registerType'] == 'holdingRegister':
-                writeLine(fileDescriptor, '    return m_modbusRtuMaster->writeHoldingRegisters(m_slaveId, %s, values);' % (registerDefinition['address']))
+                writeRequest = 'm_busScheduler->writeHoldingRegisters(m_slaveId, %s, values)' % (registerDefinition['address'])
             elif registerDefinition['registerType'] == 'coils':
-                writeLine(fileDescriptor, '    return m_modbusRtuMaster->writeCoils(m_slaveId, %s, values);' % (registerDefinition['address']))
+                writeRequest = 'm_busScheduler->writeCoils(m_slaveId, %s, values)' % (registerDefinition['address'])
             else:
                 logger.warning('Error: invalid register type for writing.')
                 exit(1)
 
+            if writeTransactions:
+                registerType = 'QModbusDataUnit::HoldingRegisters' if registerDefinition['registerType'] == 'holdingRegister' else 'QModbusDataUnit::Coils'
+                writeLine(fileDescriptor)
+                writeWriteTransactionStage(fileDescriptor, className, registerJson, registerDefinition, 'QModbusDataUnit(%s, %s, values)' % (registerType, registerDefinition['address']), 'ModbusRtuReply', 'ModbusRtuReply::NoError', True, tableDriven)
+
+            if 'readBack' in registerDefinition:
+                # The modbus RTU master does not provide function code 23, always read back using a separate request
+                readBackTarget = getReadBackTarget(registerJson, registerDefinition['readBack'])
+                writeLine(fileDescriptor, '    ModbusRtuReply *reply = %s;' % writeRequest)
+                writeLine(fileDescriptor, '    if (!reply || reply->isFinished())')
+                writeLine(fileDescriptor, '        return reply;')
+                writeLine(fileDescriptor)
+                writeReadBackAfterWrite(fileDescriptor, className, readBackTarget, 'ModbusRtuReply', 'ModbusRtuReply::NoError', True, '    ', tableDriven)
+                writeLine(fileDescriptor)
+                writeLine(fileDescriptor, '    return reply;')
+            else:
+                writeLine(fileDescriptor, '    return %s;' % writeRequest)
+
             writeLine(fileDescriptor, '}')
             writeLine(fileDescriptor)
 
@@ -142,14 +160,14 @@ def writeBlockUpdateMethodImplementationsRtu(fileDescriptor, className, blockDef
 
         # Build request depending on the register type
         if registerType == 'inputRegister':
-            writeLine(fileDescriptor, '    ModbusRtuReply *reply = m_modbusRtuMaster->readInputRegister(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
+            writeLine(fileDescriptor, '    ModbusRtuReply *reply = m_busScheduler->readInputRegister(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
         elif registerType == 'discreteInputs':
-            writeLine(fileDescriptor, '    ModbusRtuReply *reply = m_modbusRtuMaster->readDiscreteInput(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
+            writeLine(fileDescriptor, '    ModbusRtuReply *reply = m_busScheduler->readDiscreteInput(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
         elif registerType == 'coils':
-            writeLine(fileDescriptor, '    ModbusRtuReply *reply = m_modbusRtuMaster->readCoil(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
+            writeLine(fileDescriptor, '    ModbusRtuReply *reply = m_busScheduler->readCoil(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
         else:
             #Default to holdingRegister
-            writeLine(fileDescriptor, '    ModbusRtuReply *reply = m_modbusRtuMaster->readHoldingRegister(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
+            writeLine(fileDescriptor, '    ModbusRtuReply *reply = m_busScheduler->readHoldingRegister(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
 
         writeLine(fileDescriptor, '    if (!reply) {')
         writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading block \\"%s\\" registers";' % (className, blockName))
@@ -168,7 +186,7 @@ def writeBlockUpdateMethodImplementationsRtu(fileDescriptor, className, blockDef
         offset = 0
         for i, blockRegister in enumerate(blockRegisters):
             propertyName = blockRegister['id']
-            writeLine(fileDescriptor, '                    process%sRegisterValues(blockValues.mid(%s, %s));' % (propertyName[0].upper() + propertyName[1:], offset, blockSize))
+            writeLine(fileDescriptor, '                    process%sRegisterValues(blockValues.constData() + %s, %s);' % (propertyName[0].upper() + propertyName[1:], offset, blockRegister['size']))
             offset += blockRegister['size']
 
         writeLine(fileDescriptor, '                } else {')
@@ -200,14 +218,14 @@ def writeInternalPropertyReadMethodImplementationsRtu(fileDescriptor, className,
 
         # Build request depending on the register type
         if registerDefinition['registerType'] == 'inputRegister':
-            writeLine(fileDescriptor, '    return m_modbusRtuMaster->readInputRegister(m_slaveId, %s, %s);' % (registerDefinition['address'], registerDefinition['size']))
+            writeLine(fileDescriptor, '    return m_busScheduler->readInputRegister(m_slaveId, %s, %s);' % (registerDefinition['address'], registerDefinition['size']))
         elif registerDefinition['registerType'] == 'discreteInputs':
-            writeLine(fileDescriptor, '    return m_modbusRtuMaster->readDiscreteInput(m_slaveId, %s, %s);' % (registerDefinition['address'], registerDefinition['size']))
+            writeLine(fileDescriptor, '    return m_busScheduler->readDiscreteInput(m_slaveId, %s, %s);' % (registerDefinition['address'], registerDefinition['size']))
         elif registerDefinition['registerType'] == 'coils':
-            writeLine(fileDescriptor, '    return m_modbusRtuMaster->readCoil(m_slaveId, %s, %s);' % (registerDefinition['address'], registerDefinition['size']))
+            writeLine(fileDescriptor, '    return m_busScheduler->readCoil(m_slaveId, %s, %s);' % (registerDefinition['address'], registerDefinition['size']))
         else:
             #Default to holdingRegister
-            writeLine(fileDescriptor, '    return m_modbusRtuMaster->readHoldingRegister(m_slaveId, %s, %s);' % (registerDefinition['address'], registerDefinition['size']))
+            writeLine(fileDescriptor, '    return m_busScheduler->readHoldingRegister(m_slaveId, %s, %s);' % (registerDefinition['address'], registerDefinition['size']))
 
         writeLine(fileDescriptor, '}')
         writeLine(fileDescriptor)
@@ -265,23 +283,26 @@ def writeInternalBlockReadMethodImplementationsRtu(fileDescriptor, className, bl
 
         # Build request depending on the register type
         if registerType == 'inputRegister':
-            writeLine(fileDescriptor, '    return m_modbusRtuMaster->readInputRegister(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
+            writeLine(fileDescriptor, '    return m_busScheduler->readInputRegister(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
         elif registerType == 'discreteInputs':
-            writeLine(fileDescriptor, '    return m_modbusRtuMaster->readDiscreteInput(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
+            writeLine(fileDescriptor, '    return m_busScheduler->readDiscreteInput(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
         elif registerType == 'coils':
-            writeLine(fileDescriptor, '    return m_modbusRtuMaster->readCoil(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
+            writeLine(fileDescriptor, '    return m_busScheduler->readCoil(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
         else:
             #Default to holdingRegister
-            writeLine(fileDescriptor, '    return m_modbusRtuMaster->readHoldingRegister(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
+            writeLine(fileDescriptor, '    return m_busScheduler->readHoldingRegister(m_slaveId, %s, %s);' % (blockStartAddress, blockSize))
 
         writeLine(fileDescriptor, '}')
         writeLine(fileDescriptor)
 
 ##############################################################
 
-def writeTestReachabilityImplementationsRtu(fileDescriptor, className, registerDefinitions, checkReachableRegister):
+def writeTestReachabilityImplementationsRtu(fileDescriptor, className, registerDefinitions, checkReachableRegister, tableDriven = False):
 
     propertyName = checkReachableRegister['id']
+    readCall = 'read%s()' % (propertyName[0].upper() + propertyName[1:])
+    if tableDriven:
+        readCall = 'readTableRequest(TableRequest%s)' % (propertyName[0].upper() + propertyName[1:])
     propertyTyp = getCppDataType(checkReachableRegister)
 
     writeLine(fileDescriptor, 'void %s::testReachability()' % (className))
@@ -291,7 +312,7 @@ def writeTestReachabilityImplementationsRtu(fileDescriptor, className, registerD
     writeLine(fileDescriptor)
     writeLine(fileDescriptor, '    // Try to read the check reachability register %s in order to verify if the communication is working or not.' % checkReachableRegister['id'])
     writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Test reachability by reading \\"%s\\" register:" << %s << "size:" << %s;' % (className, checkReachableRegister['description'], checkReachableRegister['address'], checkReachableRegister['size']))
-    writeLine(fileDescriptor, '    m_checkRechableReply = read%s();' % (propertyName[0].upper() + propertyName[1:]))
+    writeLine(fileDescriptor, '    m_checkRechableReply = %s;' % readCall)
     writeLine(fileDescriptor, '    if (!m_checkRechableReply) {')
     writeLine(fileDescriptor, '        qCDebug(dc%s()) << "Error occurred verifying reachability by reading \\"%s\\" register";' % (className, checkReachableRegister['description']))
     writeLine(fileDescriptor, '        onReachabilityCheckFailed();')
@@ -450,7 +471,7 @@ def writeInitMethodImplementationRtu(fileDescriptor, className, registerDefiniti
                 for i, blockRegister in enumerate(blockRegisters):
                     propertyName = blockRegister['id']
                     propertyTyp = getCppDataType(blockRegister)
-                    writeLine(fileDescriptor, '        process%sRegisterValues(blockValues.mid(%s, %s));' % (propertyName[0].upper() + propertyName[1:], offset, blockRegister['size']))
+                    writeLine(fileDescriptor, '        process%sRegisterValues(blockValues.constData() + %s, %s);' % (propertyName[0].upper() + propertyName[1:], offset, blockRegister['size']))
                     offset += blockRegister['size']
 
                 writeLine(fileDescriptor, '        } else {')
@@ -473,23 +494,196 @@ def writeInitMethodImplementationRtu(fileDescriptor, className, registerDefiniti
     writeLine(fileDescriptor)
 
 
-def writeUpdateMethodRtu(fileDescriptor, className, registerDefinitions, blockDefinitions):
-    writeLine(fileDescriptor, 'bool %s::update()' % (className))
-    writeLine(fileDescriptor, '{')
+def writeReadPlanMethodDeclarationsRtu(fileDescriptor, readPlan):
+    for readRequest in readPlan:
+        requestName = readRequest['id']
+        writeReadPlanMethodDeclarationComment(fileDescriptor, readRequest)
+        writeLine(fileDescriptor, '    ModbusRtuReply *read%s();' % (requestName[0].upper() + requestName[1:]))
+        writeLine(fileDescriptor)
 
-    # First check if there are any init registers
-    updateRequired = False
-    for registerDefinition in registerDefinitions:
-        if registerDefinition['readSchedule'] == 'update':
-            updateRequired = True
-            break
 
-    for blockDefinition in blockDefinitions:
-        if 'readSchedule' in blockDefinition and blockDefinition['readSchedule'] == 'update':
-            updateRequired = True
-            break
+def writeReadPlanReadMethodImplementationsRtu(fileDescriptor, className, readPlan):
+    for readRequest in readPlan:
+        requestName = readRequest['id']
+        writeLine(fileDescriptor, 'ModbusRtuReply *%s::read%s()' % (className, requestName[0].upper() + requestName[1:]))
+        writeLine(fileDescriptor, '{')
+
+        # Build request depending on the register type
+        if readRequest['registerType'] == 'inputRegister':
+            writeLine(fileDescriptor, '    return m_busScheduler->readInputRegister(m_slaveId, %s, %s);' % (readRequest['address'], readRequest['size']))
+        elif readRequest['registerType'] == 'discreteInputs':
+            writeLine(fileDescriptor, '    return m_busScheduler->readDiscreteInput(m_slaveId, %s, %s);' % (readRequest['address'], readRequest['size']))
+        elif readRequest['registerType'] == 'coils':
+            writeLine(fileDescriptor, '    return m_busScheduler->readCoil(m_slaveId, %s, %s);' % (readRequest['address'], readRequest['size']))
+        else:
+            #Default to holdingRegister
+            writeLine(fileDescriptor, '    return m_busScheduler->readHoldingRegister(m_slaveId, %s, %s);' % (readRequest['address'], readRequest['size']))
+
+        writeLine(fileDescriptor, '}')
+        writeLine(fileDescriptor)
+
+##############################################################
+
+def writeReadPlanUpdateRtu(fileDescriptor, className, readRequest, updateIntervalName = None):
+    requestName = readRequest['id']
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    // Read merged registers %s' % ', '.join(registerDefinition['id'] for registerDefinition in readRequest['registers']))
+    writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read merged registers \\"%s\\" from:" << %s << "size:" << %s;' % (className, requestName, readRequest['address'], readRequest['size']))
+    writeLine(fileDescriptor, '    reply = read%s();' % (requestName[0].upper() + requestName[1:]))
+    writeLine(fileDescriptor, '    if (!reply) {')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading merged registers \\"%s\\"";' % (className, requestName))
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    if (reply->isFinished()) {')
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
+    writeLine(fileDescriptor, '        return false; // Broadcast reply returns immediatly')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    m_pendingUpdateReplies.append(reply);')
+    writeLine(fileDescriptor, '    connect(reply, &ModbusRtuReply::finished, this, [this, reply](){')
+    writeLine(fileDescriptor, '        handleModbusError(reply->error());')
+    writeLine(fileDescriptor, '        m_pendingUpdateReplies.removeAll(reply);')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '        if (reply->error() != ModbusRtuReply::NoError) {')
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '            ')
+    writeLine(fileDescriptor, '            verifyUpdateFinished();')
+    writeLine(fileDescriptor, '            return;')
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '        QVector<quint16> values = reply->result();')
+    writeLine(fileDescriptor, '        qCDebug(dc%s()) << "<-- Response from reading merged registers \\"%s\\"" << %s << "size:" << %s << values;' % (className, requestName, readRequest['address'], readRequest['size']))
+    writeLine(fileDescriptor, '        if (values.size() == %s) {' % (readRequest['size']))
+    writeReadPlanProcessValues(fileDescriptor, readRequest, 'values', '            ')
+    writeLine(fileDescriptor, '        } else {')
+    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Reading from merged registers \\"%s\\"" << %s << "size:" << %s << "returned different size than requested. Ignoring incomplete data" << values;' % (className, requestName, readRequest['address'], readRequest['size']))
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor, '        verifyUpdateFinished();')
+    writeLine(fileDescriptor, '    });')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    connect(reply, &ModbusRtuReply::errorOccurred, this, [reply] (ModbusRtuReply::Error error){')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "ModbusRtu reply error occurred while updating merged registers \\"%s\\"" << error << reply->errorString();' % (className, requestName))
+    writeLine(fileDescriptor, '    });')
+
+##############################################################
+
+def writeRegisterUpdateRtu(fileDescriptor, className, registerDefinition, updateIntervalName = None):
+    propertyName = registerDefinition['id']
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    // Read %s' % registerDefinition['description'])
+    writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read \\"%s\\" register:" << %s << "size:" << %s;' % (className, registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
+    writeLine(fileDescriptor, '    reply = read%s();' % (propertyName[0].upper() + propertyName[1:]))
+    writeLine(fileDescriptor, '    if (!reply) {')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading \\"%s\\" registers";' % (className, registerDefinition['description']))
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    if (reply->isFinished()) {')
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
+    writeLine(fileDescriptor, '        return false; // Broadcast reply returns immediatly')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    m_pendingUpdateReplies.append(reply);')
+    writeLine(fileDescriptor, '    connect(reply, &ModbusRtuReply::finished, this, [this, reply](){')
+    writeLine(fileDescriptor, '        handleModbusError(reply->error());')
+    writeLine(fileDescriptor, '        m_pendingUpdateReplies.removeAll(reply);')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '        if (reply->error() != ModbusRtuReply::NoError) {')
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '            ')
+    writeLine(fileDescriptor, '            verifyUpdateFinished();')
+    writeLine(fileDescriptor, '            return;')
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '        QVector<quint16> values = reply->result();')
+    writeLine(fileDescriptor, '        qCDebug(dc%s()) << "<-- Response from \\"%s\\" register" << %s << "size:" << %s << values;' % (className, registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
+    writeLine(fileDescriptor, '        if (values.size() == %s) {' % (registerDefinition['size']))
+    writeLine(fileDescriptor, '            process%sRegisterValues(values);' % (propertyName[0].upper() + propertyName[1:]))
+    writeLine(fileDescriptor, '        } else {')
+    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Reading from \\"%s\\" registers" << %s << "size:" << %s << "returned different size than requested. Ignoring incomplete data" << values;' % (className, registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor, '        verifyUpdateFinished();')
+    writeLine(fileDescriptor, '    });')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    connect(reply, &ModbusRtuReply::errorOccurred, this, [reply] (ModbusRtuReply::Error error){')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "ModbusRtu reply error occurred while updating \\"%s\\" registers" << error << reply->errorString();' % (className, registerDefinition['description']))
+    writeLine(fileDescriptor, '    });')
+
+
+def writeBlockUpdateRtu(fileDescriptor, className, blockDefinition, updateIntervalName = None):
+    blockName = blockDefinition['id']
+    blockRegisters = blockDefinition['registers']
+
+    blockStartAddress = 0
+    registerCount = 0
+    blockSize = 0
+    registerType = ""
+
+    for i, blockRegister in enumerate(blockRegisters):
+        if i == 0:
+            blockStartAddress = blockRegister['address']
+            registerType = blockRegister['registerType']
 
-    if updateRequired:
+        registerCount += 1
+        blockSize += blockRegister['size']
+
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    // Read %s' % blockName)
+    writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read block \\"%s\\" registers from:" << %s << "size:" << %s;' % (className, blockName, blockStartAddress, blockSize))
+    writeLine(fileDescriptor, '    reply = readBlock%s();' % (blockName[0].upper() + blockName[1:]))
+    writeLine(fileDescriptor, '    if (!reply) {')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading block \\"%s\\" registers";' % (className, blockName))
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    if (reply->isFinished()) {')
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
+    writeLine(fileDescriptor, '        return false; // Broadcast reply returns immediatly')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    m_pendingUpdateReplies.append(reply);')
+    writeLine(fileDescriptor, '    connect(reply, &ModbusRtuReply::finished, this, [this, reply](){')
+    writeLine(fileDescriptor, '        handleModbusError(reply->error());')
+    writeLine(fileDescriptor, '        m_pendingUpdateReplies.removeAll(reply);')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '        if (reply->error() != ModbusRtuReply::NoError) {')
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '            ')
+    writeLine(fileDescriptor, '            verifyUpdateFinished();')
+    writeLine(fileDescriptor, '            return;')
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '        QVector<quint16> blockValues = reply->result();')
+    writeLine(fileDescriptor, '        qCDebug(dc%s()) << "<-- Response from reading block \\"%s\\" register" << %s << "size:" << %s << blockValues;' % (className, blockName, blockStartAddress, blockSize))
+    writeLine(fileDescriptor, '        if (blockValues.size() == %s) {' % (blockSize))
+
+    # Start parsing the registers using offsets
+    offset = 0
+    for i, blockRegister in enumerate(blockRegisters):
+        propertyName = blockRegister['id']
+        propertyTyp = getCppDataType(blockRegister)
+        writeLine(fileDescriptor, '        process%sRegisterValues(blockValues.constData() + %s, %s);' % (propertyName[0].upper() + propertyName[1:], offset, blockRegister['size']))
+        offset += blockRegister['size']
+
+    writeLine(fileDescriptor, '        } else {')
+    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Reading from \\"%s\\" register" << %s << "size:" << %s << "returned different size than requested. Ignoring incomplete data" << blockValues;' % (className, blockName, blockStartAddress, blockSize))
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor, '        verifyUpdateFinished();')
+    writeLine(fileDescriptor, '    });')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    connect(reply, &ModbusRtuReply::errorOccurred, this, [reply] (ModbusRtuReply::Error error){')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "ModbusRtu reply error occurred while updating block \\"%s\\" registers" << error << reply->errorString();' % (className, blockName))
+    writeLine(fileDescriptor, '    });')
+    writeLine(fileDescriptor)
+
+
+def writeUpdateMethodRtu(fileDescriptor, className, updateItems, valuesChangedSignal = False, snapshot = False):
+    writeLine(fileDescriptor, 'bool %s::update()' % (className))
+    writeLine(fileDescriptor, '{')
+
+    # First check if there are any update registers
+    if updateItems:
         writeLine(fileDescriptor, '    if (!m_modbusRtuMaster->connected()) {')
         writeLine(fileDescriptor, '        qCDebug(dc%s()) << "Tried to update the registers but the hardware resource seems not to be connected.";' % className)
         writeLine(fileDescriptor, '        return false;')
@@ -502,127 +696,206 @@ def writeUpdateMethodRtu(fileDescriptor, className, registerDefinitions, blockDe
         writeLine(fileDescriptor)
 
         writeLine(fileDescriptor, '    // Hardware resource available but communication not working. ')
-        writeLine(fileDescriptor, '    // Try to read the check reachability register to re-evaluatoe the communication... ')
-        writeLine(fileDescriptor, '    if (m_modbusRtuMaster->connected() && !m_communicationWorking) {')
-        writeLine(fileDescriptor, '        testReachability();')
+        writeLine(fileDescriptor, '    // Try to read the check reachability register to re-evaluatoe the communication once the connection has been idle... ')
+        writeLine(fileDescriptor, '    if (m_modbusRtuMaster->connected() && !m_reachabilityMonitor.communicationWorking()) {')
+        writeLine(fileDescriptor, '        if (m_reachabilityMonitor.idle())')
+        writeLine(fileDescriptor, '            testReachability();')
+        writeLine(fileDescriptor)
         writeLine(fileDescriptor, '        return false;')
         writeLine(fileDescriptor, '    }')
         writeLine(fileDescriptor)
+        writeUpdateIntervalTimerStart(fileDescriptor, updateItems)
 
         writeLine(fileDescriptor, '    ModbusRtuReply *reply = nullptr;')
 
-        # Read individual registers
-        for registerDefinition in registerDefinitions:
-            propertyName = registerDefinition['id']
-            propertyTyp = getCppDataType(registerDefinition)
+        for updateItem in updateItems:
+            if updateItem['type'] == 'merged':
+                writeScheduledUpdate(fileDescriptor, updateItem, lambda fileDescriptor: writeReadPlanUpdateRtu(fileDescriptor, className, updateItem['definition'], getUpdateIntervalName(updateItems, updateItem['name'])))
+            elif updateItem['type'] == 'block':
+                writeScheduledUpdate(fileDescriptor, updateItem, lambda fileDescriptor: writeBlockUpdateRtu(fileDescriptor, className, updateItem['definition'], getUpdateIntervalName(updateItems, updateItem['name'])))
+            else:
+                writeScheduledUpdate(fileDescriptor, updateItem, lambda fileDescriptor: writeRegisterUpdateRtu(fileDescriptor, className, updateItem['definition'], getUpdateIntervalName(updateItems, updateItem['name'])))
 
-            if 'readSchedule' in registerDefinition and registerDefinition['readSchedule'] == 'update':
-                writeLine(fileDescriptor)
-                writeLine(fileDescriptor, '    // Read %s' % registerDefinition['description'])
-                writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read \\"%s\\" register:" << %s << "size:" << %s;' % (className, registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
-                writeLine(fileDescriptor, '    reply = read%s();' % (propertyName[0].upper() + propertyName[1:]))
-                writeLine(fileDescriptor, '    if (!reply) {')
-                writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading \\"%s\\" registers";' % (className, registerDefinition['description']))
-                writeLine(fileDescriptor, '        return false;')
-                writeLine(fileDescriptor, '    }')
-                writeLine(fileDescriptor)
-                writeLine(fileDescriptor, '    if (reply->isFinished()) {')
-                writeLine(fileDescriptor, '        return false; // Broadcast reply returns immediatly')
-                writeLine(fileDescriptor, '    }')
-                writeLine(fileDescriptor)
-                writeLine(fileDescriptor, '    m_pendingUpdateReplies.append(reply);')
-                writeLine(fileDescriptor, '    connect(reply, &ModbusRtuReply::finished, this, [this, reply](){')
-                writeLine(fileDescriptor, '        handleModbusError(reply->error());')
-                writeLine(fileDescriptor, '        m_pendingUpdateReplies.removeAll(reply);')
-                writeLine(fileDescriptor)
-                writeLine(fileDescriptor, '        if (reply->error() != ModbusRtuReply::NoError) {')
-                writeLine(fileDescriptor, '            verifyUpdateFinished();')
-                writeLine(fileDescriptor, '            return;')
-                writeLine(fileDescriptor, '        }')
-                writeLine(fileDescriptor)
-                writeLine(fileDescriptor, '        QVector<quint16> values = reply->result();')
-                writeLine(fileDescriptor, '        qCDebug(dc%s()) << "<-- Response from \\"%s\\" register" << %s << "size:" << %s << values;' % (className, registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
-                writeLine(fileDescriptor, '        if (values.size() == %s) {' % (registerDefinition['size']))
-                writeLine(fileDescriptor, '            process%sRegisterValues(values);' % (propertyName[0].upper() + propertyName[1:]))
-                writeLine(fileDescriptor, '        } else {')
-                writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Reading from \\"%s\\" registers" << %s << "size:" << %s << "returned different size than requested. Ignoring incomplete data" << values;' % (className, registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
-                writeLine(fileDescriptor, '        }')
-                writeLine(fileDescriptor, '        verifyUpdateFinished();')
-                writeLine(fileDescriptor, '    });')
-                writeLine(fileDescriptor)
-                writeLine(fileDescriptor, '    connect(reply, &ModbusRtuReply::errorOccurred, this, [reply] (ModbusRtuReply::Error error){')
-                writeLine(fileDescriptor, '        qCWarning(dc%s()) << "ModbusRtu reply error occurred while updating \\"%s\\" registers" << error << reply->errorString();' % (className, registerDefinition['description']))
-                writeLine(fileDescriptor, '    });')
+        if updateMayReadNothing(updateItems):
+            writeLine(fileDescriptor, '    if (m_pendingUpdateReplies.isEmpty()) {')
+            writeLine(fileDescriptor, '        // No read due in this update cycle')
+            writeEmitUpdateFinished(fileDescriptor, valuesChangedSignal, '        ', snapshot)
+            writeLine(fileDescriptor, '    }')
+            writeLine(fileDescriptor)
 
-        # Read init blocks
-        for blockDefinition in blockDefinitions:
-            blockName = blockDefinition['id']
-            blockRegisters = blockDefinition['registers']
+    else:
+        writeLine(fileDescriptor, '    // No update registers defined. Nothing to be done and we are finished.')
+        writeEmitUpdateFinished(fileDescriptor, valuesChangedSignal, '    ', snapshot)
 
-            if 'readSchedule' in blockDefinition and blockDefinition['readSchedule'] == 'update':
-                blockStartAddress = 0
-                registerCount = 0
-                blockSize = 0
-                registerType = ""
+    writeLine(fileDescriptor, '    return true;')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
 
-                for i, blockRegister in enumerate(blockRegisters):
-                    if i == 0:
-                        blockStartAddress = blockRegister['address']
-                        registerType = blockRegister['registerType']
+##############################################################
 
-                    registerCount += 1
-                    blockSize += blockRegister['size']
+def writeInitMethodImplementationTableRtu(fileDescriptor, className, registerTable):
+    writeLine(fileDescriptor, 'bool %s::initialize()' % (className))
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    if (!m_reachable) {')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Tried to initialize but the device is not to be reachable.";' % className)
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor, '    }')
 
-                writeLine(fileDescriptor)
-                writeLine(fileDescriptor, '    // Read %s' % blockName)
-                writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read block \\"%s\\" registers from:" << %s << "size:" << %s;' % (className, blockName, blockStartAddress, blockSize))
-                writeLine(fileDescriptor, '    reply = readBlock%s();' % (blockName[0].upper() + blockName[1:]))
-                writeLine(fileDescriptor, '    if (!reply) {')
-                writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading block \\"%s\\" registers";' % (className, blockName))
-                writeLine(fileDescriptor, '        return false;')
-                writeLine(fileDescriptor, '    }')
-                writeLine(fileDescriptor)
-                writeLine(fileDescriptor, '    if (reply->isFinished()) {')
-                writeLine(fileDescriptor, '        return false; // Broadcast reply returns immediatly')
-                writeLine(fileDescriptor, '    }')
-                writeLine(fileDescriptor)
-                writeLine(fileDescriptor, '    m_pendingUpdateReplies.append(reply);')
-                writeLine(fileDescriptor, '    connect(reply, &ModbusRtuReply::finished, this, [this, reply](){')
-                writeLine(fileDescriptor, '        handleModbusError(reply->error());')
-                writeLine(fileDescriptor, '        m_pendingUpdateReplies.removeAll(reply);')
-                writeLine(fileDescriptor)
-                writeLine(fileDescriptor, '        if (reply->error() != ModbusRtuReply::NoError) {')
-                writeLine(fileDescriptor, '            verifyUpdateFinished();')
-                writeLine(fileDescriptor, '            return;')
-                writeLine(fileDescriptor, '        }')
-                writeLine(fileDescriptor)
-                writeLine(fileDescriptor, '        QVector<quint16> blockValues = reply->result();')
-                writeLine(fileDescriptor, '        qCDebug(dc%s()) << "<-- Response from reading block \\"%s\\" register" << %s << "size:" << %s << blockValues;' % (className, blockName, blockStartAddress, blockSize))
-                writeLine(fileDescriptor, '        if (blockValues.size() == %s) {' % (blockSize))
+    if registerTable['initRequests']:
+        writeLine(fileDescriptor, '    if (m_initObject) {')
+        writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Tried to initialize but the init process is already running.";' % className)
+        writeLine(fileDescriptor, '        return false;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    // Parent object for the init process')
+        writeLine(fileDescriptor, '    m_initObject = new QObject(this);')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    for (int request : s_initRequests) {')
+        writeLine(fileDescriptor, '        if (!sendInitTableRequest(request))')
+        writeLine(fileDescriptor, '            return false;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+    else:
+        writeLine(fileDescriptor, '    // No init registers defined. Nothing to be done and we are finished.')
+        writeLine(fileDescriptor, '    emit initializationFinished(true);')
 
-                # Start parsing the registers using offsets
-                offset = 0
-                for i, blockRegister in enumerate(blockRegisters):
-                    propertyName = blockRegister['id']
-                    propertyTyp = getCppDataType(blockRegister)
-                    writeLine(fileDescriptor, '        process%sRegisterValues(blockValues.mid(%s, %s));' % (propertyName[0].upper() + propertyName[1:], offset, blockRegister['size']))
-                    offset += blockRegister['size']
+    writeLine(fileDescriptor, '    return true;')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
 
-                writeLine(fileDescriptor, '        } else {')
-                writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Reading from \\"%s\\" register" << %s << "size:" << %s << "returned different size than requested. Ignoring incomplete data" << blockValues;' % (className, blockName, blockStartAddress, blockSize))
-                writeLine(fileDescriptor, '        }')
-                writeLine(fileDescriptor, '        verifyUpdateFinished();')
-                writeLine(fileDescriptor, '    });')
-                writeLine(fileDescriptor)
-                writeLine(fileDescriptor, '    connect(reply, &ModbusRtuReply::errorOccurred, this, [reply] (ModbusRtuReply::Error error){')
-                writeLine(fileDescriptor, '        qCWarning(dc%s()) << "ModbusRtu reply error occurred while updating block \\"%s\\" registers" << error << reply->errorString();' % (className, blockName))
-                writeLine(fileDescriptor, '    });')
-                writeLine(fileDescriptor)
 
+def writeUpdateMethodTableRtu(fileDescriptor, className, registerTable, updateItems, valuesChangedSignal = False, snapshot = False):
+    writeLine(fileDescriptor, 'bool %s::update()' % (className))
+    writeLine(fileDescriptor, '{')
+
+    if registerTable['updateRequests']:
+        writeLine(fileDescriptor, '    if (!m_modbusRtuMaster->connected()) {')
+        writeLine(fileDescriptor, '        qCDebug(dc%s()) << "Tried to update the registers but the hardware resource seems not to be connected.";' % className)
+        writeLine(fileDescriptor, '        return false;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    if (!m_pendingUpdateReplies.isEmpty()) {')
+        writeLine(fileDescriptor, '        qCDebug(dc%s()) << "Tried to update the registers but there are still some update replies pending. Waiting for them to be finished...";' % className)
+        writeLine(fileDescriptor, '        return true;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    // Hardware resource available but communication not working. ')
+        writeLine(fileDescriptor, '    // Try to read the check reachability register to re-evaluatoe the communication once the connection has been idle... ')
+        writeLine(fileDescriptor, '    if (m_modbusRtuMaster->connected() && !m_reachabilityMonitor.communicationWorking()) {')
+        writeLine(fileDescriptor, '        if (m_reachabilityMonitor.idle())')
+        writeLine(fileDescriptor, '            testReachability();')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '        return false;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+        writeUpdateIntervalTimerStart(fileDescriptor, updateItems)
+        writeTableUpdateLoop(fileDescriptor, updateItems, [ 'if (!sendUpdateTableRequest(request))', '    return false;' ])
+        if updateMayReadNothing(updateItems):
+            writeLine(fileDescriptor, '    if (m_pendingUpdateReplies.isEmpty()) {')
+            writeLine(fileDescriptor, '        // No read due in this update cycle')
+            writeEmitUpdateFinished(fileDescriptor, valuesChangedSignal, '        ', snapshot)
+            writeLine(fileDescriptor, '    }')
+            writeLine(fileDescriptor)
     else:
         writeLine(fileDescriptor, '    // No update registers defined. Nothing to be done and we are finished.')
-        writeLine(fileDescriptor, '    emit updateFinished();')
+        writeEmitUpdateFinished(fileDescriptor, valuesChangedSignal, '    ', snapshot)
 
     writeLine(fileDescriptor, '    return true;')
     writeLine(fileDescriptor, '}')
     writeLine(fileDescriptor)
+
+
+def writeTableRequestMethodImplementationsRtu(fileDescriptor, className, updateIntervals = False):
+    writeLine(fileDescriptor, 'bool %s::sendInitTableRequest(int request)' % (className))
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read init" << tableDescription(request) << "registers from:" << s_requests[request].address << "size:" << s_requests[request].size;' % className)
+    writeLine(fileDescriptor, '    ModbusRtuReply *reply = ModbusRegisterTable::sendReadRequest(m_busScheduler, m_slaveId, s_requests[request]);')
+    writeLine(fileDescriptor, '    if (!reply) {')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading init" << tableDescription(request) << "registers";' % className)
+    writeLine(fileDescriptor, '        finishInitialization(false);')
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    if (reply->isFinished()) {')
+    writeLine(fileDescriptor, '        finishInitialization(false); // Broadcast reply returns immediatly')
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    m_pendingInitReplies.append(reply);')
+    writeLine(fileDescriptor, '    connect(reply, &ModbusRtuReply::finished, m_initObject, [this, reply, request](){')
+    writeLine(fileDescriptor, '        handleModbusError(reply->error());')
+    writeLine(fileDescriptor, '        m_pendingInitReplies.removeAll(reply);')
+    writeLine(fileDescriptor, '        if (reply->error() != ModbusRtuReply::NoError) {')
+    writeLine(fileDescriptor, '            printTableRequestError(request, reply);')
+    writeLine(fileDescriptor, '            finishInitialization(false);')
+    writeLine(fileDescriptor, '            return;')
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '        processTableRequestValues(request, reply->result());')
+    writeLine(fileDescriptor, '        verifyInitFinished();')
+    writeLine(fileDescriptor, '    });')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    return true;')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+    writeLine(fileDescriptor, 'bool %s::sendUpdateTableRequest(int request)' % (className))
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read" << tableDescription(request) << "registers from:" << s_requests[request].address << "size:" << s_requests[request].size;' % className)
+    writeLine(fileDescriptor, '    ModbusRtuReply *reply = ModbusRegisterTable::sendReadRequest(m_busScheduler, m_slaveId, s_requests[request]);')
+    writeLine(fileDescriptor, '    if (!reply) {')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading" << tableDescription(request) << "registers";' % className)
+    writeTableUpdateIntervalReset(fileDescriptor, updateIntervals, '        ')
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    if (reply->isFinished()) {')
+    writeTableUpdateIntervalReset(fileDescriptor, updateIntervals, '        ')
+    writeLine(fileDescriptor, '        return false; // Broadcast reply returns immediatly')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    m_pendingUpdateReplies.append(reply);')
+    writeLine(fileDescriptor, '    connect(reply, &ModbusRtuReply::finished, this, [this, reply, request](){')
+    writeLine(fileDescriptor, '        handleModbusError(reply->error());')
+    writeLine(fileDescriptor, '        m_pendingUpdateReplies.removeAll(reply);')
+    writeLine(fileDescriptor, '        if (reply->error() == ModbusRtuReply::NoError) {')
+    writeLine(fileDescriptor, '            processTableRequestValues(request, reply->result());')
+    writeLine(fileDescriptor, '        } else {')
+    writeLine(fileDescriptor, '            printTableRequestError(request, reply);')
+    writeTableUpdateIntervalReset(fileDescriptor, updateIntervals, '            ')
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor, '        verifyUpdateFinished();')
+    writeLine(fileDescriptor, '    });')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    return true;')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+    writeLine(fileDescriptor, 'void %s::updateTableRequest(TableRequest request)' % (className))
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read" << tableDescription(request) << "registers from:" << s_requests[request].address << "size:" << s_requests[request].size;' % className)
+    writeLine(fileDescriptor, '    ModbusRtuReply *reply = ModbusRegisterTable::sendReadRequest(m_busScheduler, m_slaveId, s_requests[request]);')
+    writeLine(fileDescriptor, '    if (!reply) {')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading" << tableDescription(request) << "registers";' % className)
+    writeLine(fileDescriptor, '        return;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    if (reply->isFinished())')
+    writeLine(fileDescriptor, '        return; // Broadcast reply returns immediatly')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    connect(reply, &ModbusRtuReply::finished, this, [this, reply, request](){')
+    writeLine(fileDescriptor, '        handleModbusError(reply->error());')
+    writeLine(fileDescriptor, '        if (reply->error() == ModbusRtuReply::NoError) {')
+    writeLine(fileDescriptor, '            processTableRequestValues(request, reply->result());')
+    writeLine(fileDescriptor, '        } else {')
+    writeLine(fileDescriptor, '            printTableRequestError(request, reply);')
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor, '    });')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+    writeLine(fileDescriptor, 'void %s::printTableRequestError(int request, ModbusRtuReply *reply)' % (className))
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    qCWarning(dc%s()) << "ModbusRtu reply error occurred while reading" << tableDescription(request) << "registers" << reply->error() << reply->errorString();' % className)
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
@@ -0,0 +1,355 @@
+# Copyright (C) 2023 nymea GmbH <developer@nymea.io>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; either version 2
+# of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+import logging
+
+from .toolcommon import *
+
+##############################################################
+
+def getSimulatorRegisters(registerJson):
+    registerDefinitions = list(registerJson['registers'])
+    for blockDefinition in registerJson.get('blocks', []):
+        registerDefinitions += blockDefinition['registers']
+
+    # Scale factors have to be written before the registers using them
+    scaleFactorIds = [ registerDefinition['scaleFactor'] for registerDefinition in registerDefinitions if 'scaleFactor' in registerDefinition ]
+    registerDefinitions.sort(key = lambda registerDefinition: 0 if registerDefinition['id'] in scaleFactorIds else 1)
+    return registerDefinitions
+
+
+def getSimulatorRegisterType(registerDefinition):
+    return getTableRegisterType(registerDefinition.get('registerType', 'holdingRegister'))
+
+
+def getSimulatorDataUnitSizes(registerJson):
+    # The data unit of each register type covers all addresses from 0 up to the last register
+    dataUnitSizes = {}
+    for registerDefinition in getSimulatorRegisters(registerJson):
+        registerType = getSimulatorRegisterType(registerDefinition)
+        dataUnitSizes[registerType] = max(dataUnitSizes.get(registerType, 0), registerDefinition['address'] + registerDefinition['size'])
+
+    return dataUnitSizes
+
+
+def isSimulatorRandomRegister(registerDefinition):
+    if 'enum' in registerDefinition:
+        return False
+
+    return getCppDataType(registerDefinition) in ['quint16', 'qint16', 'quint32', 'qint32', 'quint64', 'qint64', 'float', 'double']
+
+
+def useScaleFactorGetter(conversion, registerDefinition):
+    # The server has no scale factor members, the current scale factor value gets read from the data
+    if 'scaleFactor' in registerDefinition:
+        return conversion.replace('m_%s' % registerDefinition['scaleFactor'], '%s()' % registerDefinition['scaleFactor'])
+
+    return conversion
+
+
+def writeSimulatorRegistersEnum(fileDescriptor, registerJson):
+    # Unlike the address based enum of the connections each register gets its own value,
+    # registers of different types sharing an address can be addressed independently
+    registerDefinitions = sorted(getSimulatorRegisters(registerJson), key = lambda registerDefinition: (getSimulatorRegisterType(registerDefinition), registerDefinition['address']))
+
+    writeLine(fileDescriptor, '    enum Registers {')
+    for i, registerDefinition in enumerate(registerDefinitions):
+        propertyName = registerDefinition['id']
+        writeLine(fileDescriptor, '        Register%s%s' % (propertyName[0].upper() + propertyName[1:], ',' if i < len(registerDefinitions) - 1 else ''))
+    writeLine(fileDescriptor, '    };')
+    writeLine(fileDescriptor, '    Q_ENUM(Registers)')
+    writeLine(fileDescriptor)
+
+
+def writeSimulatorHeaderFile(fileDescriptor, className, registerJson, protocol, endianness, stringEndianness):
+    writeLicenseHeader(fileDescriptor)
+    writeLine(fileDescriptor, '#ifndef %s_H' % className.upper())
+    writeLine(fileDescriptor, '#define %s_H' % className.upper())
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '#include <QHash>')
+    writeLine(fileDescriptor, '#include <QTimer>')
+    writeLine(fileDescriptor, '#include <QObject>')
+    if protocol == 'TCP':
+        writeLine(fileDescriptor, '#include <QHostAddress>')
+        writeLine(fileDescriptor, '#include <QModbusTcpServer>')
+    else:
+        writeLine(fileDescriptor, '#include <QSerialPort>')
+        writeLine(fileDescriptor, '#include <QModbusRtuSerialSlave>')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '#include <modbusdatautils.h>')
+    writeLine(fileDescriptor, '#include <modbusregisterdump.h>')
+    writeLine(fileDescriptor)
+
+    baseClassName = 'QModbusTcpServer' if protocol == 'TCP' else 'QModbusRtuSerialSlave'
+    writeLine(fileDescriptor, '// Simulated device serving the registers of the register JSON file')
+    writeLine(fileDescriptor, 'class %s : public %s' % (className, baseClassName))
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    Q_OBJECT')
+    writeLine(fileDescriptor, 'public:')
+    writeSimulatorRegistersEnum(fileDescriptor, registerJson)
+    for enumDefinition in registerJson.get('enums', []):
+        writeEnumDefinition(fileDescriptor, enumDefinition)
+
+    if protocol == 'TCP':
+        writeLine(fileDescriptor, '    explicit %s(const QHostAddress &hostAddress, uint port, quint16 slaveId, QObject *parent = nullptr);' % className)
+    else:
+        writeLine(fileDescriptor, '    explicit %s(const QString &serialPort, int baudrate, QSerialPort::Parity parity, QSerialPort::DataBits dataBits, QSerialPort::StopBits stopBits, quint16 slaveId, QObject *parent = nullptr);' % className)
+    writeLine(fileDescriptor, '    ~%s() = default;' % className)
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    ModbusDataUtils::ByteOrder endianness() const;')
+    writeLine(fileDescriptor, '    void setEndianness(ModbusDataUtils::ByteOrder endianness);')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    ModbusDataUtils::ByteOrder stringEndianness() const;')
+    writeLine(fileDescriptor, '    void setStringEndianness(ModbusDataUtils::ByteOrder stringEndianness);')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    // Sets all registers to zero followed by the default values of the register JSON file')
+    writeLine(fileDescriptor, '    void resetValues();')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    // Calls step() periodically, 0 stops the simulation')
+    writeLine(fileDescriptor, '    int stepInterval() const;')
+    writeLine(fileDescriptor, '    void setStepInterval(int stepInterval);')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    // Each step sets a new random value within the range to the given register')
+    writeLine(fileDescriptor, '    void setRandomRange(Registers modbusRegister, double minimum, double maximum);')
+    writeLine(fileDescriptor, '    void removeRandomRange(Registers modbusRegister);')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    // Each step writes the next recorded step of the dump, starting over once all steps have been replayed')
+    writeLine(fileDescriptor, '    bool loadDump(const QString &fileName);')
+    writeLine(fileDescriptor, '    void clearDump();')
+    writeLine(fileDescriptor)
+
+    for registerDefinition in getSimulatorRegisters(registerJson):
+        propertyName = registerDefinition['id']
+        propertyTyp = getCppDataType(registerDefinition)
+        writeLine(fileDescriptor, '    /* %s - Address: %s, Size: %s */' % (registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
+        writeLine(fileDescriptor, '    %s %s() const;' % (propertyTyp, propertyName))
+        if propertyTyp == 'QByteArray':
+            writeLine(fileDescriptor)
+            continue
+
+        if propertyTyp in ['QString', 'QVector<quint16>']:
+            writeLine(fileDescriptor, '    void set%s(const %s &%s);' % (propertyName[0].upper() + propertyName[1:], propertyTyp, propertyName))
+        else:
+            writeLine(fileDescriptor, '    void set%s(%s %s);' % (propertyName[0].upper() + propertyName[1:], propertyTyp, propertyName))
+        writeLine(fileDescriptor)
+
+    writeLine(fileDescriptor, 'public slots:')
+    writeLine(fileDescriptor, '    void step();')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, 'signals:')
+    writeLine(fileDescriptor, '    // Emitted after each step, scripted simulations can set their values here')
+    writeLine(fileDescriptor, '    void stepped(quint64 step);')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, 'private:')
+    writeLine(fileDescriptor, '    ModbusDataUtils::ByteOrder m_endianness = ModbusDataUtils::ByteOrder%s;' % endianness)
+    writeLine(fileDescriptor, '    ModbusDataUtils::ByteOrder m_stringEndianness = ModbusDataUtils::ByteOrder%s;' % stringEndianness)
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    QTimer m_stepTimer;')
+    writeLine(fileDescriptor, '    quint64 m_step = 0;')
+    writeLine(fileDescriptor, '    QHash<Registers, QPair<double, double>> m_randomRanges;')
+    writeLine(fileDescriptor, '    ModbusRegisterDump m_dump;')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    void setRandomValue(Registers modbusRegister, double value);')
+    writeLine(fileDescriptor, '};')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '#endif // %s_H' % className.upper())
+
+
+def writeSimulatorSourceFile(fileDescriptor, className, headerFileName, registerJson, protocol):
+    writeLicenseHeader(fileDescriptor)
+    writeLine(fileDescriptor, '#include "%s"' % headerFileName)
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '#include <loggingcategories.h>')
+    writeLine(fileDescriptor, '#include <math.h>')
+    writeLine(fileDescriptor, '#include <QRandomGenerator>')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, 'NYMEA_LOGGING_CATEGORY(dc%s, "%s")' % (className, className))
+    writeLine(fileDescriptor)
+
+    # Constructor
+    if protocol == 'TCP':
+        writeLine(fileDescriptor, '%s::%s(const QHostAddress &hostAddress, uint port, quint16 slaveId, QObject *parent) :' % (className, className))
+        writeLine(fileDescriptor, '    QModbusTcpServer(parent)')
+        writeLine(fileDescriptor, '{')
+        writeLine(fileDescriptor, '    setConnectionParameter(QModbusDevice::NetworkAddressParameter, hostAddress.toString());')
+        writeLine(fileDescriptor, '    setConnectionParameter(QModbusDevice::NetworkPortParameter, port);')
+    else:
+        writeLine(fileDescriptor, '%s::%s(const QString &serialPort, int baudrate, QSerialPort::Parity parity, QSerialPort::DataBits dataBits, QSerialPort::StopBits stopBits, quint16 slaveId, QObject *parent) :' % (className, className))
+        writeLine(fileDescriptor, '    QModbusRtuSerialSlave(parent)')
+        writeLine(fileDescriptor, '{')
+        writeLine(fileDescriptor, '    setConnectionParameter(QModbusDevice::SerialPortNameParameter, serialPort);')
+        writeLine(fileDescriptor, '    setConnectionParameter(QModbusDevice::SerialBaudRateParameter, baudrate);')
+        writeLine(fileDescriptor, '    setConnectionParameter(QModbusDevice::SerialParityParameter, parity);')
+        writeLine(fileDescriptor, '    setConnectionParameter(QModbusDevice::SerialDataBitsParameter, dataBits);')
+        writeLine(fileDescriptor, '    setConnectionParameter(QModbusDevice::SerialStopBitsParameter, stopBits);')
+    writeLine(fileDescriptor, '    setServerAddress(slaveId);')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    connect(&m_stepTimer, &QTimer::timeout, this, &%s::step);' % className)
+    writeLine(fileDescriptor, '    resetValues();')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+    # Endianness
+    writeLine(fileDescriptor, 'ModbusDataUtils::ByteOrder %s::endianness() const' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    return m_endianness;')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, 'void %s::setEndianness(ModbusDataUtils::ByteOrder endianness)' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    m_endianness = endianness;')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, 'ModbusDataUtils::ByteOrder %s::stringEndianness() const' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    return m_stringEndianness;')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, 'void %s::setStringEndianness(ModbusDataUtils::ByteOrder stringEndianness)' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    m_stringEndianness = stringEndianness;')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+    # Default values
+    writeLine(fileDescriptor, 'void %s::resetValues()' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    QModbusDataUnitMap dataUnitMap;')
+    for registerType, size in sorted(getSimulatorDataUnitSizes(registerJson).items()):
+        writeLine(fileDescriptor, '    dataUnitMap.insert(%s, QModbusDataUnit(%s, 0, %s));' % (registerType, registerType, size))
+    writeLine(fileDescriptor, '    setMap(dataUnitMap);')
+    writeLine(fileDescriptor)
+    for registerDefinition in getSimulatorRegisters(registerJson):
+        if 'defaultValue' in registerDefinition and getCppDataType(registerDefinition) != 'QByteArray':
+            propertyName = registerDefinition['id']
+            writeLine(fileDescriptor, '    set%s(%s);' % (propertyName[0].upper() + propertyName[1:], registerDefinition['defaultValue']))
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+    # Simulation
+    writeLine(fileDescriptor, 'int %s::stepInterval() const' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    return m_stepTimer.isActive() ? m_stepTimer.interval() : 0;')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, 'void %s::setStepInterval(int stepInterval)' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    if (stepInterval <= 0) {')
+    writeLine(fileDescriptor, '        m_stepTimer.stop();')
+    writeLine(fileDescriptor, '        return;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    m_stepTimer.start(stepInterval);')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, 'void %s::setRandomRange(Registers modbusRegister, double minimum, double maximum)' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    m_randomRanges.insert(modbusRegister, qMakePair(minimum, maximum));')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, 'void %s::removeRandomRange(Registers modbusRegister)' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    m_randomRanges.remove(modbusRegister);')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, 'bool %s::loadDump(const QString &fileName)' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    if (!m_dump.load(fileName)) {')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Could not load register dump:" << m_dump.errorString();' % className)
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    qCDebug(dc%s()) << "Loaded register dump" << fileName << "containing" << m_dump.count() << "steps";' % className)
+    writeLine(fileDescriptor, '    m_step = 0;')
+    writeLine(fileDescriptor, '    return true;')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, 'void %s::clearDump()' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    m_dump.clear();')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, 'void %s::step()' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    if (!m_dump.isEmpty()) {')
+    writeLine(fileDescriptor, '        foreach (const QModbusDataUnit &dataUnit, m_dump.step(m_step % m_dump.count())) {')
+    writeLine(fileDescriptor, '            setData(dataUnit);')
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    for (auto it = m_randomRanges.constBegin(); it != m_randomRanges.constEnd(); ++it) {')
+    writeLine(fileDescriptor, '        setRandomValue(it.key(), it.value().first + QRandomGenerator::global()->generateDouble() * (it.value().second - it.value().first));')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    m_step++;')
+    writeLine(fileDescriptor, '    emit stepped(m_step);')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+    # Typed register access
+    for registerDefinition in getSimulatorRegisters(registerJson):
+        propertyName = registerDefinition['id']
+        propertyTyp = getCppDataType(registerDefinition)
+        registerType = getSimulatorRegisterType(registerDefinition)
+        writeLine(fileDescriptor, '%s %s::%s() const' % (propertyTyp, className, propertyName))
+        writeLine(fileDescriptor, '{')
+        writeLine(fileDescriptor, '    QModbusDataUnit dataUnit(%s, %s, %s);' % (registerType, registerDefinition['address'], registerDefinition['size']))
+        writeLine(fileDescriptor, '    data(&dataUnit);')
+        if propertyTyp == 'QVector<quint16>':
+            writeLine(fileDescriptor, '    return dataUnit.values();')
+        else:
+            writeLine(fileDescriptor, '    const QVector<quint16> unitValues = dataUnit.values();')
+            writeLine(fileDescriptor, '    const quint16 *values = unitValues.constData();')
+            writeLine(fileDescriptor, '    const int count = unitValues.count();')
+            writeLine(fileDescriptor, '    return %s;' % useScaleFactorGetter(getValueConversionMethod(registerDefinition), registerDefinition))
+        writeLine(fileDescriptor, '}')
+        writeLine(fileDescriptor)
+
+        if propertyTyp == 'QByteArray':
+            continue
+
+        if propertyTyp in ['QString', 'QVector<quint16>']:
+            writeLine(fileDescriptor, 'void %s::set%s(const %s &%s)' % (className, propertyName[0].upper() + propertyName[1:], propertyTyp, propertyName))
+        else:
+            writeLine(fileDescriptor, 'void %s::set%s(%s %s)' % (className, propertyName[0].upper() + propertyName[1:], propertyTyp, propertyName))
+        writeLine(fileDescriptor, '{')
+        if propertyTyp == 'QVector<quint16>':
+            writeLine(fileDescriptor, '    setData(QModbusDataUnit(%s, %s, %s));' % (registerType, registerDefinition['address'], propertyName))
+        elif propertyTyp == 'QString':
+            writeLine(fileDescriptor, '    setData(QModbusDataUnit(%s, %s, ModbusDataUtils::convertFromString(%s, %s, m_stringEndianness)));' % (registerType, registerDefinition['address'], propertyName, registerDefinition['size']))
+        else:
+            writeLine(fileDescriptor, '    setData(QModbusDataUnit(%s, %s, %s));' % (registerType, registerDefinition['address'], useScaleFactorGetter(getConversionToValueMethod(registerDefinition), registerDefinition)))
+        writeLine(fileDescriptor, '}')
+        writeLine(fileDescriptor)
+
+    # Random values of numeric registers
+    writeLine(fileDescriptor, 'void %s::setRandomValue(Registers modbusRegister, double value)' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    switch (modbusRegister) {')
+    for registerDefinition in getSimulatorRegisters(registerJson):
+        propertyName = registerDefinition['id']
+        if not isSimulatorRandomRegister(registerDefinition):
+            continue
+
+        writeLine(fileDescriptor, '    case Register%s:' % (propertyName[0].upper() + propertyName[1:]))
+        writeLine(fileDescriptor, '        set%s(static_cast<%s>(value));' % (propertyName[0].upper() + propertyName[1:], getCppDataType(registerDefinition)))
+        writeLine(fileDescriptor, '        break;')
+    writeLine(fileDescriptor, '    default:')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Random values are not supported for register" << modbusRegister;' % className)
+    writeLine(fileDescriptor, '        break;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
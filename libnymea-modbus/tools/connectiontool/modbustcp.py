@@ -38,7 +38,7 @@ def writePropertyGetSetMethodDeclarationsTcp(fileDescriptor, registerDefinitions
         writeLine(fileDescriptor)
 
 
-def writePropertyGetSetMethodImplementationsTcp(fileDescriptor, className, registerDefinitions):
+def writePropertyGetSetMethodImplementationsTcp(fileDescriptor, className, registerDefinitions, registerJson = None, readWriteMultipleRegisters = False, writeTransactions = False, tableDriven = False):
     for registerDefinition in registerDefinitions:
         propertyName = registerDefinition['id']
         propertyTyp = getCppDataType(registerDefinition)
@@ -71,13 +71,50 @@ def writePropertyGetSetMethodImplementationsTcp(fileDescriptor, className, regis
                 exit(1)
 
             writeLine(fileDescriptor, '    request.setValues(values);')
-            writeLine(fileDescriptor, '    return m_modbusTcpMaster->sendWriteRequest(request, m_slaveId);')
+            if writeTransactions:
+                writeLine(fileDescriptor)
+                writeWriteTransactionStage(fileDescriptor, className, registerJson, registerDefinition, 'request', 'QModbusReply', 'QModbusDevice::NoError', False, tableDriven)
+
+            if 'readBack' in registerDefinition:
+                readBackTarget = getReadBackTarget(registerJson, registerDefinition['readBack'])
+                if readWriteMultipleRegisters and registerDefinition['registerType'] == 'holdingRegister' and readBackTarget['registerType'] == 'holdingRegister':
+                    writeLine(fileDescriptor)
+                    writeLine(fileDescriptor, '    // Write and read back \"%s\" within one request (function code 23)' % readBackTarget['description'])
+                    writeLine(fileDescriptor, '    QModbusDataUnit readBackRequest = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, %s, %s);' % (readBackTarget['address'], readBackTarget['size']))
+                    writeLine(fileDescriptor, '    QModbusReply *reply = m_modbusTcpMaster->sendReadWriteRequest(readBackRequest, request, m_slaveId);')
+                    writeLine(fileDescriptor, '    if (!reply || reply->isFinished())')
+                    writeLine(fileDescriptor, '        return reply;')
+                    writeLine(fileDescriptor)
+                    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, this, [this, reply](){')
+                    writeLine(fileDescriptor, '        if (reply->error() != QModbusDevice::NoError)')
+                    writeLine(fileDescriptor, '            return;')
+                    writeLine(fileDescriptor)
+                    writeLine(fileDescriptor, '        const QVector<quint16> values = reply->result().values();')
+                    writeReadBackProcessValues(fileDescriptor, className, readBackTarget, 'values', '        ', tableDriven)
+                    writeLine(fileDescriptor, '    });')
+                else:
+                    writeLine(fileDescriptor, '    QModbusReply *reply = m_modbusTcpMaster->sendWriteRequest(request, m_slaveId);')
+                    writeLine(fileDescriptor, '    if (!reply || reply->isFinished())')
+                    writeLine(fileDescriptor, '        return reply;')
+                    writeLine(fileDescriptor)
+                    writeReadBackAfterWrite(fileDescriptor, className, readBackTarget, 'QModbusReply', 'QModbusDevice::NoError', False, '    ', tableDriven)
+
+                writeLine(fileDescriptor)
+                writeLine(fileDescriptor, '    return reply;')
+            else:
+                writeLine(fileDescriptor, '    return m_modbusTcpMaster->sendWriteRequest(request, m_slaveId);')
             writeLine(fileDescriptor, '}')
             writeLine(fileDescriptor)
 
 ##############################################################
 
-def writePropertyUpdateMethodImplementationsTcp(fileDescriptor, className, registerDefinitions, queuedRequests, queuedRequestsDelay):
+def writeRequestPacerRecord(fileDescriptor, replyName, requestPacer, indentation):
+    # Let the request pacer adapt the request rate to timeouts and busy exceptions of the device
+    if requestPacer:
+        writeLine(fileDescriptor, '%sm_requestPacer.recordReply(%s);' % (indentation, replyName))
+
+
+def writePropertyUpdateMethodImplementationsTcp(fileDescriptor, className, registerDefinitions, queuedRequests, queuedRequestsDelay, requestPacer = False, updateItems = []):
     for registerDefinition in registerDefinitions:
         
         if 'access' in registerDefinition:
@@ -86,6 +123,7 @@ def writePropertyUpdateMethodImplementationsTcp(fileDescriptor, className, regis
 
 
         propertyName = registerDefinition['id']
+        updateIntervalName = getUpdateIntervalName(updateItems, propertyName)
         writeLine(fileDescriptor, 'void %s::update%s()' % (className, propertyName[0].upper() + propertyName[1:]))
         writeLine(fileDescriptor, '{')
         writeLine(fileDescriptor, '    // Update registers from %s' % registerDefinition['description'])
@@ -115,6 +153,7 @@ def writePropertyUpdateMethodImplementationsTcp(fileDescriptor, className, regis
                 writeLine(fileDescriptor, '    connect(m_currentInitReply, &QModbusReply::finished, m_currentInitReply, &QModbusReply::deleteLater);')
                 writeLine(fileDescriptor, '    connect(m_currentInitReply, &QModbusReply::finished, this, [this](){')
                 writeLine(fileDescriptor, '        handleModbusError(m_currentInitReply->error());')
+                writeRequestPacerRecord(fileDescriptor, 'm_currentInitReply', requestPacer, '        ')
                 writeLine(fileDescriptor)
                 writeLine(fileDescriptor, '        if (m_currentInitReply->error() != QModbusDevice::NoError) {')
                 writeLine(fileDescriptor, '            QModbusResponse response = m_currentInitReply->rawResult();')
@@ -150,6 +189,7 @@ def writePropertyUpdateMethodImplementationsTcp(fileDescriptor, className, regis
                 writeLine(fileDescriptor, '    m_currentUpdateReply = read%s();' % (propertyName[0].upper() + propertyName[1:]))
                 writeLine(fileDescriptor, '    if (!m_currentUpdateReply) {')
                 writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading \\"%s\\" registers from" << m_modbusTcpMaster->hostAddress().toString() << m_modbusTcpMaster->errorString();' % (className, registerDefinition['description']))
+                writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
                 writeLine(fileDescriptor, '        if (!verifyUpdateFinished())')
                 writeLine(fileDescriptor, '            QTimer::singleShot(%s, this, &%s::sendNextQueuedRequest);' % (queuedRequestsDelay, className))
                 writeLine(fileDescriptor)
@@ -159,6 +199,7 @@ def writePropertyUpdateMethodImplementationsTcp(fileDescriptor, className, regis
                 writeLine(fileDescriptor, '    if (m_currentUpdateReply->isFinished()) {')
                 writeLine(fileDescriptor, '        m_currentUpdateReply->deleteLater(); // Broadcast reply returns immediatly')
                 writeLine(fileDescriptor, '        m_currentUpdateReply = nullptr;')
+                writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
                 writeLine(fileDescriptor, '        if (!verifyUpdateFinished())')
                 writeLine(fileDescriptor, '            QTimer::singleShot(%s, this, &%s::sendNextQueuedRequest);' % (queuedRequestsDelay, className))
                 writeLine(fileDescriptor)
@@ -167,6 +208,7 @@ def writePropertyUpdateMethodImplementationsTcp(fileDescriptor, className, regis
                 writeLine(fileDescriptor)
                 writeLine(fileDescriptor, '    connect(m_currentUpdateReply, &QModbusReply::finished, this, [this](){')
                 writeLine(fileDescriptor, '        handleModbusError(m_currentUpdateReply->error());')
+                writeRequestPacerRecord(fileDescriptor, 'm_currentUpdateReply', requestPacer, '        ')
                 writeLine(fileDescriptor, '        if (m_currentUpdateReply->error() == QModbusDevice::NoError) {')
                 writeLine(fileDescriptor, '            const QModbusDataUnit unit = m_currentUpdateReply->result();')
                 writeLine(fileDescriptor, '            qCDebug(dc%s()) << "<-- Response from \\"%s\\" register" << %s << "size:" << %s << unit.values();' % (className, registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
@@ -175,6 +217,9 @@ def writePropertyUpdateMethodImplementationsTcp(fileDescriptor, className, regis
                 writeLine(fileDescriptor, '            } else {')
                 writeLine(fileDescriptor, '                qCWarning(dc%s()) << "Reading from \\"%s\\" registers" << %s << "size:" << %s << "returned different size than requested. Ignoring incomplete data" << unit.values();' % (className, registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
                 writeLine(fileDescriptor, '            }')
+                if updateIntervalName:
+                    writeLine(fileDescriptor, '        } else {')
+                    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '            ')
                 writeLine(fileDescriptor, '        }')
                 writeLine(fileDescriptor)
                 writeLine(fileDescriptor, '        m_currentUpdateReply->deleteLater();')
@@ -232,10 +277,11 @@ def writePropertyUpdateMethodImplementationsTcp(fileDescriptor, className, regis
 
 ##############################################################
 
-def writeBlockUpdateMethodImplementationsTcp(fileDescriptor, className, blockDefinitions, queuedRequests, queuedRequestsDelay):
+def writeBlockUpdateMethodImplementationsTcp(fileDescriptor, className, blockDefinitions, queuedRequests, queuedRequestsDelay, requestPacer = False, updateItems = []):
     for blockDefinition in blockDefinitions:
         blockName = blockDefinition['id']
         blockRegisters = blockDefinition['registers']
+        updateIntervalName = getUpdateIntervalName(updateItems, 'block' + blockName[0].upper() + blockName[1:])
         blockStartAddress = 0
         registerCount = 0
         blockSize = 0
@@ -275,6 +321,7 @@ def writeBlockUpdateMethodImplementationsTcp(fileDescriptor, className, blockDef
                 writeLine(fileDescriptor, '    connect(m_currentInitReply, &QModbusReply::finished, m_currentInitReply, &QModbusReply::deleteLater);')
                 writeLine(fileDescriptor, '    connect(m_currentInitReply, &QModbusReply::finished, this, [this](){')
                 writeLine(fileDescriptor, '        handleModbusError(m_currentInitReply->error());')
+                writeRequestPacerRecord(fileDescriptor, 'm_currentInitReply', requestPacer, '        ')
                 writeLine(fileDescriptor)
                 writeLine(fileDescriptor, '        if (m_currentInitReply->error() != QModbusDevice::NoError) {')
                 writeLine(fileDescriptor, '            QModbusResponse response = m_currentInitReply->rawResult();')
@@ -299,7 +346,7 @@ def writeBlockUpdateMethodImplementationsTcp(fileDescriptor, className, blockDef
                 offset = 0
                 for i, blockRegister in enumerate(blockRegisters):
                     propertyName = blockRegister['id']
-                    writeLine(fileDescriptor, '            process%sRegisterValues(blockValues.mid(%s, %s));' % (propertyName[0].upper() + propertyName[1:], offset, blockRegister['size']))
+                    writeLine(fileDescriptor, '            process%sRegisterValues(blockValues.constData() + %s, %s);' % (propertyName[0].upper() + propertyName[1:], offset, blockRegister['size']))
                     offset += blockRegister['size']
 
                 writeLine(fileDescriptor, '        } else {')
@@ -315,6 +362,7 @@ def writeBlockUpdateMethodImplementationsTcp(fileDescriptor, className, blockDef
                 writeLine(fileDescriptor, '    m_currentUpdateReply = readBlock%s();' % (blockName[0].upper() + blockName[1:]))
                 writeLine(fileDescriptor, '    if (!m_currentUpdateReply) {')
                 writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading block \\"%s\\" registers";' % (className, blockName))
+                writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
                 writeLine(fileDescriptor, '        if (!verifyUpdateFinished())')
                 writeLine(fileDescriptor, '            QTimer::singleShot(%s, this, &%s::sendNextQueuedRequest);' % (queuedRequestsDelay, className))
                 writeLine(fileDescriptor)
@@ -324,6 +372,7 @@ def writeBlockUpdateMethodImplementationsTcp(fileDescriptor, className, blockDef
                 writeLine(fileDescriptor, '    if (m_currentUpdateReply->isFinished()) {')
                 writeLine(fileDescriptor, '        m_currentUpdateReply->deleteLater(); // Broadcast reply returns immediatly')
                 writeLine(fileDescriptor, '        m_currentUpdateReply = nullptr;')
+                writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
                 writeLine(fileDescriptor, '        if (!verifyUpdateFinished())')
                 writeLine(fileDescriptor, '            QTimer::singleShot(%s, this, &%s::sendNextQueuedRequest);' % (queuedRequestsDelay, className))
                 writeLine(fileDescriptor)
@@ -332,6 +381,7 @@ def writeBlockUpdateMethodImplementationsTcp(fileDescriptor, className, blockDef
                 writeLine(fileDescriptor)
                 writeLine(fileDescriptor, '    connect(m_currentUpdateReply, &QModbusReply::finished, this, [this](){')
                 writeLine(fileDescriptor, '        handleModbusError(m_currentUpdateReply->error());')
+                writeRequestPacerRecord(fileDescriptor, 'm_currentUpdateReply', requestPacer, '        ')
                 writeLine(fileDescriptor, '        if (m_currentUpdateReply->error() == QModbusDevice::NoError) {')
                 writeLine(fileDescriptor, '            const QModbusDataUnit unit = m_currentUpdateReply->result();')
                 writeLine(fileDescriptor, '            const QVector<quint16> blockValues = unit.values();')
@@ -342,7 +392,7 @@ def writeBlockUpdateMethodImplementationsTcp(fileDescriptor, className, blockDef
                 offset = 0
                 for i, blockRegister in enumerate(blockRegisters):
                     propertyName = blockRegister['id']
-                    writeLine(fileDescriptor, '                process%sRegisterValues(blockValues.mid(%s, %s));' % (propertyName[0].upper() + propertyName[1:], offset, blockRegister['size']))
+                    writeLine(fileDescriptor, '                process%sRegisterValues(blockValues.constData() + %s, %s);' % (propertyName[0].upper() + propertyName[1:], offset, blockRegister['size']))
                     offset += blockRegister['size']
 
                 writeLine(fileDescriptor, '            } else {')
@@ -353,6 +403,9 @@ def writeBlockUpdateMethodImplementationsTcp(fileDescriptor, className, blockDef
                 writeLine(fileDescriptor, '        if (!verifyUpdateFinished())')
                 writeLine(fileDescriptor, '            QTimer::singleShot(%s, this, &%s::sendNextQueuedRequest);' % (queuedRequestsDelay, className))
                 writeLine(fileDescriptor)
+                if updateIntervalName:
+                    writeLine(fileDescriptor, '        } else {')
+                    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '            ')
                 writeLine(fileDescriptor, '        }')
                 writeLine(fileDescriptor, '    });')
                 writeLine(fileDescriptor)
@@ -389,7 +442,7 @@ def writeBlockUpdateMethodImplementationsTcp(fileDescriptor, className, blockDef
             offset = 0
             for i, blockRegister in enumerate(blockRegisters):
                 propertyName = blockRegister['id']
-                writeLine(fileDescriptor, '                process%sRegisterValues(blockValues.mid(%s, %s));' % (propertyName[0].upper() + propertyName[1:], offset, blockRegister['size']))
+                writeLine(fileDescriptor, '                process%sRegisterValues(blockValues.constData() + %s, %s);' % (propertyName[0].upper() + propertyName[1:], offset, blockRegister['size']))
                 offset += blockRegister['size']
 
             writeLine(fileDescriptor, '            } else {')
@@ -511,9 +564,12 @@ def writeInternalBlockReadMethodImplementationsTcp(fileDescriptor, className, bl
 
 ##############################################################
 
-def writeTestReachabilityImplementationsTcp(fileDescriptor, className, registerDefinitions, checkReachableRegister):
+def writeTestReachabilityImplementationsTcp(fileDescriptor, className, registerDefinitions, checkReachableRegister, tableDriven = False):
 
     propertyName = checkReachableRegister['id']
+    readCall = 'read%s()' % (propertyName[0].upper() + propertyName[1:])
+    if tableDriven:
+        readCall = 'readTableRequest(TableRequest%s)' % (propertyName[0].upper() + propertyName[1:])
 
     writeLine(fileDescriptor, 'void %s::testReachability()' % (className))
     writeLine(fileDescriptor, '{')
@@ -522,7 +578,7 @@ def writeTestReachabilityImplementationsTcp(fileDescriptor, className, registerD
     writeLine(fileDescriptor)
     writeLine(fileDescriptor, '    // Try to read the check reachability register %s in order to verify if the communication is working or not.' % checkReachableRegister['id'])
     writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Test reachability by reading \\"%s\\" register:" << %s << "size:" << %s;' % (className, checkReachableRegister['description'], checkReachableRegister['address'], checkReachableRegister['size']))
-    writeLine(fileDescriptor, '    m_checkRechableReply = read%s();' % (propertyName[0].upper() + propertyName[1:]))
+    writeLine(fileDescriptor, '    m_checkRechableReply = %s;' % readCall)
     writeLine(fileDescriptor, '    if (!m_checkRechableReply) {')
     writeLine(fileDescriptor, '        qCDebug(dc%s()) << "Error occurred verifying reachability by reading \\"%s\\" register";' % (className, checkReachableRegister['description']))
     writeLine(fileDescriptor, '        onReachabilityCheckFailed();')
@@ -551,7 +607,8 @@ def writeTestReachabilityImplementationsTcp(fileDescriptor, className, registerD
     writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Modbus reply error occurred while verifying reachability by reading \\"%s\\" register" << error << m_checkRechableReply->errorString() << ModbusDataUtils::exceptionCodeToString(response.exceptionCode());' % (className, checkReachableRegister['description']))
     writeLine(fileDescriptor, '            // Note: if we get an exception on the reachability register, the modbus server is probably not ready')
     writeLine(fileDescriptor, '            // For some reasons on some devices the reply will never be finished on exception response. A reconnect might fix it.')
-    writeLine(fileDescriptor, '            QTimer::singleShot(2000, m_modbusTcpMaster, &ModbusTcpMaster::reconnectDevice);')
+    writeLine(fileDescriptor, '            // A connection shared with other units will not be reconnected, the other units are not affected by this exception.')
+    writeLine(fileDescriptor, '            QTimer::singleShot(2000, this, &%s::reconnectDevice);' % className)
     writeLine(fileDescriptor, '        } else {')
     writeLine(fileDescriptor, '            qCDebug(dc%s()) << "Modbus reply error occurred while verifying reachability by reading \\"%s\\" register" << error << m_checkRechableReply->errorString();' % (className, checkReachableRegister['description']))
     writeLine(fileDescriptor, '        }')
@@ -727,7 +784,7 @@ def writeInitMethodImplementationTcp(fileDescriptor, className, registerDefiniti
                     for i, blockRegister in enumerate(blockRegisters):
                         propertyName = blockRegister['id']
                         propertyTyp = getCppDataType(blockRegister)
-                        writeLine(fileDescriptor, '            process%sRegisterValues(blockValues.mid(%s, %s));' % (propertyName[0].upper() + propertyName[1:], offset, blockRegister['size']))
+                        writeLine(fileDescriptor, '            process%sRegisterValues(blockValues.constData() + %s, %s);' % (propertyName[0].upper() + propertyName[1:], offset, blockRegister['size']))
                         offset += blockRegister['size']
 
                     writeLine(fileDescriptor, '        } else {')
@@ -757,23 +814,290 @@ def writeInitMethodImplementationTcp(fileDescriptor, className, registerDefiniti
 
 ##############################################################
 
-def writeUpdateMethodTcp(fileDescriptor, className, registerDefinitions, blockDefinitions, queuedRequests):
+def writeReadPlanMethodDeclarationsTcp(fileDescriptor, readPlan, queuedRequests):
+    for readRequest in readPlan:
+        requestName = readRequest['id']
+        writeReadPlanMethodDeclarationComment(fileDescriptor, readRequest)
+        writeLine(fileDescriptor, '    QModbusReply *read%s();' % (requestName[0].upper() + requestName[1:]))
+        if queuedRequests:
+            writeLine(fileDescriptor, '    void update%s();' % (requestName[0].upper() + requestName[1:]))
+
+        writeLine(fileDescriptor)
+
+##############################################################
+
+def writeReadPlanReadMethodImplementationsTcp(fileDescriptor, className, readPlan):
+    for readRequest in readPlan:
+        requestName = readRequest['id']
+        writeLine(fileDescriptor, 'QModbusReply *%s::read%s()' % (className, requestName[0].upper() + requestName[1:]))
+        writeLine(fileDescriptor, '{')
+
+        # Build request depending on the register type
+        if readRequest['registerType'] == 'inputRegister':
+            writeLine(fileDescriptor, '    QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::InputRegisters, %s, %s);' % (readRequest['address'], readRequest['size']))
+        elif readRequest['registerType'] == 'discreteInputs':
+            writeLine(fileDescriptor, '    QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::DiscreteInputs, %s, %s);' % (readRequest['address'], readRequest['size']))
+        elif readRequest['registerType'] == 'coils':
+            writeLine(fileDescriptor, '    QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::Coils, %s, %s);' % (readRequest['address'], readRequest['size']))
+        else:
+            #Default to holdingRegister
+            writeLine(fileDescriptor, '    QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, %s, %s);' % (readRequest['address'], readRequest['size']))
+
+        writeLine(fileDescriptor, '    return m_modbusTcpMaster->sendReadRequest(request, m_slaveId);')
+        writeLine(fileDescriptor, '}')
+        writeLine(fileDescriptor)
+
+##############################################################
+
+def writeReadPlanUpdateMethodImplementationsTcp(fileDescriptor, className, readPlan, queuedRequestsDelay, requestPacer = False, updateItems = []):
+    for readRequest in readPlan:
+        requestName = readRequest['id']
+        updateIntervalName = getUpdateIntervalName(updateItems, requestName)
+        writeLine(fileDescriptor, 'void %s::update%s()' % (className, requestName[0].upper() + requestName[1:]))
+        writeLine(fileDescriptor, '{')
+        writeLine(fileDescriptor, '    // Update merged registers \"%s\"' % requestName)
+        writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read merged registers \\"%s\\" from:" << %s << "size:" << %s;' % (className, requestName, readRequest['address'], readRequest['size']))
+        writeLine(fileDescriptor, '    if (m_currentUpdateReply)')
+        writeLine(fileDescriptor, '        return;')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    m_currentUpdateReply = read%s();' % (requestName[0].upper() + requestName[1:]))
+        writeLine(fileDescriptor, '    if (!m_currentUpdateReply) {')
+        writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading merged registers \\"%s\\" from" << m_modbusTcpMaster->hostAddress().toString() << m_modbusTcpMaster->errorString();' % (className, requestName))
+        writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
+        writeLine(fileDescriptor, '        if (!verifyUpdateFinished())')
+        writeLine(fileDescriptor, '            QTimer::singleShot(%s, this, &%s::sendNextQueuedRequest);' % (queuedRequestsDelay, className))
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '        return;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    if (m_currentUpdateReply->isFinished()) {')
+        writeLine(fileDescriptor, '        m_currentUpdateReply->deleteLater(); // Broadcast reply returns immediatly')
+        writeLine(fileDescriptor, '        m_currentUpdateReply = nullptr;')
+        writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
+        writeLine(fileDescriptor, '        if (!verifyUpdateFinished())')
+        writeLine(fileDescriptor, '            QTimer::singleShot(%s, this, &%s::sendNextQueuedRequest);' % (queuedRequestsDelay, className))
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '        return;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    connect(m_currentUpdateReply, &QModbusReply::finished, this, [this](){')
+        writeLine(fileDescriptor, '        handleModbusError(m_currentUpdateReply->error());')
+        writeRequestPacerRecord(fileDescriptor, 'm_currentUpdateReply', requestPacer, '        ')
+        writeLine(fileDescriptor, '        if (m_currentUpdateReply->error() == QModbusDevice::NoError) {')
+        writeLine(fileDescriptor, '            const QModbusDataUnit unit = m_currentUpdateReply->result();')
+        writeLine(fileDescriptor, '            const QVector<quint16> values = unit.values();')
+        writeLine(fileDescriptor, '            qCDebug(dc%s()) << "<-- Response from reading merged registers \\"%s\\"" << %s << "size:" << %s << values;' % (className, requestName, readRequest['address'], readRequest['size']))
+        writeLine(fileDescriptor, '            if (values.size() == %s) {' % (readRequest['size']))
+        writeReadPlanProcessValues(fileDescriptor, readRequest, 'values', '                ')
+        writeLine(fileDescriptor, '            } else {')
+        writeLine(fileDescriptor, '                qCWarning(dc%s()) << "Reading from merged registers \\"%s\\"" << %s << "size:" << %s << "returned different size than requested. Ignoring incomplete data" << values;' % (className, requestName, readRequest['address'], readRequest['size']))
+        writeLine(fileDescriptor, '            }')
+        if updateIntervalName:
+            writeLine(fileDescriptor, '        } else {')
+            writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '            ')
+        writeLine(fileDescriptor, '        }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '        m_currentUpdateReply->deleteLater();')
+        writeLine(fileDescriptor, '        m_currentUpdateReply = nullptr;')
+        writeLine(fileDescriptor, '        if (!verifyUpdateFinished())')
+        writeLine(fileDescriptor, '            QTimer::singleShot(%s, this, &%s::sendNextQueuedRequest);' % (queuedRequestsDelay, className))
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    });')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    connect(m_currentUpdateReply, &QModbusReply::errorOccurred, this, [this] (QModbusDevice::Error error){')
+        writeLine(fileDescriptor, '        QModbusResponse response = m_currentUpdateReply->rawResult();')
+        writeLine(fileDescriptor, '        if (m_currentUpdateReply->error() == QModbusDevice::ProtocolError && response.isException()) {')
+        writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Modbus reply error occurred while updating merged registers \\"%s\\" from" << m_modbusTcpMaster->hostAddress().toString() << ModbusDataUtils::exceptionCodeToString(response.exceptionCode());' % (className, requestName))
+        writeLine(fileDescriptor, '        } else {')
+        writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Modbus reply error occurred while updating merged registers \\"%s\\" from" << m_modbusTcpMaster->hostAddress().toString() << error << m_currentUpdateReply->errorString();' % (className, requestName))
+        writeLine(fileDescriptor, '        }')
+        writeLine(fileDescriptor, '    });')
+        writeLine(fileDescriptor, '}')
+        writeLine(fileDescriptor)
+
+##############################################################
+
+def writeReadPlanUpdateTcp(fileDescriptor, className, readRequest, updateIntervalName = None):
+    requestName = readRequest['id']
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    // Read merged registers %s' % ', '.join(registerDefinition['id'] for registerDefinition in readRequest['registers']))
+    writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read merged registers \\"%s\\" from:" << %s << "size:" << %s;' % (className, requestName, readRequest['address'], readRequest['size']))
+    writeLine(fileDescriptor, '    reply = read%s();' % (requestName[0].upper() + requestName[1:]))
+    writeLine(fileDescriptor, '    if (!reply) {')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading merged registers \\"%s\\" from" << m_modbusTcpMaster->hostAddress().toString() << m_modbusTcpMaster->errorString();' % (className, requestName))
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    if (reply->isFinished()) {')
+    writeLine(fileDescriptor, '        reply->deleteLater(); // Broadcast reply returns immediatly')
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    m_pendingUpdateReplies.append(reply);')
+    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);')
+    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, this, [this, reply](){')
+    writeLine(fileDescriptor, '        m_pendingUpdateReplies.removeAll(reply);')
+    writeLine(fileDescriptor, '        handleModbusError(reply->error());')
+    writeLine(fileDescriptor, '        if (reply->error() != QModbusDevice::NoError) {')
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '            ')
+    writeLine(fileDescriptor, '            verifyUpdateFinished();')
+    writeLine(fileDescriptor, '            return;')
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '        const QModbusDataUnit unit = reply->result();')
+    writeLine(fileDescriptor, '        const QVector<quint16> values = unit.values();')
+    writeLine(fileDescriptor, '        qCDebug(dc%s()) << "<-- Response from reading merged registers \\"%s\\"" << %s << "size:" << %s << values;' % (className, requestName, readRequest['address'], readRequest['size']))
+    writeLine(fileDescriptor, '        if (values.size() == %s) {' % (readRequest['size']))
+    writeReadPlanProcessValues(fileDescriptor, readRequest, 'values', '            ')
+    writeLine(fileDescriptor, '        } else {')
+    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Reading from merged registers \\"%s\\"" << %s << "size:" << %s << "returned different size than requested. Ignoring incomplete data" << values;' % (className, requestName, readRequest['address'], readRequest['size']))
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor, '        verifyUpdateFinished();')
+    writeLine(fileDescriptor, '    });')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::errorOccurred, this, [this, reply] (QModbusDevice::Error error){')
+    writeLine(fileDescriptor, '        QModbusResponse response = reply->rawResult();')
+    writeLine(fileDescriptor, '        if (reply->error() == QModbusDevice::ProtocolError && response.isException()) {')
+    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Modbus reply error occurred while reading merged registers \\"%s\\" from" << m_modbusTcpMaster->hostAddress().toString() << error << reply->errorString() << ModbusDataUtils::exceptionCodeToString(response.exceptionCode());' % (className, requestName))
+    writeLine(fileDescriptor, '        } else {')
+    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Modbus reply error occurred while reading merged registers \\"%s\\" from" << m_modbusTcpMaster->hostAddress().toString() << error << reply->errorString();' % (className, requestName))
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor, '    });')
+
+##############################################################
+
+def writeRegisterUpdateTcp(fileDescriptor, className, registerDefinition, updateIntervalName = None):
+    propertyName = registerDefinition['id']
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    // Read %s' % registerDefinition['description'])
+    writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read \\"%s\\" register:" << %s << "size:" << %s;' % (className, registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
+    writeLine(fileDescriptor, '    reply = read%s();' % (propertyName[0].upper() + propertyName[1:]))
+    writeLine(fileDescriptor, '    if (!reply) {')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading \\"%s\\" registers from" << m_modbusTcpMaster->hostAddress().toString() << m_modbusTcpMaster->errorString();' % (className, registerDefinition['description']))
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    if (reply->isFinished()) {')
+    writeLine(fileDescriptor, '        reply->deleteLater(); // Broadcast reply returns immediatly')
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    m_pendingUpdateReplies.append(reply);')
+    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);')
+    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, this, [this, reply](){')
+    writeLine(fileDescriptor, '        m_pendingUpdateReplies.removeAll(reply);')
+    writeLine(fileDescriptor, '        handleModbusError(reply->error());')
+    writeLine(fileDescriptor, '        if (reply->error() != QModbusDevice::NoError) {')
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '            ')
+    writeLine(fileDescriptor, '            verifyUpdateFinished();')
+    writeLine(fileDescriptor, '            return;')
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '        const QModbusDataUnit unit = reply->result();')
+    writeLine(fileDescriptor, '        qCDebug(dc%s()) << "<-- Response from \\"%s\\" register" << %s << "size:" << %s << unit.values();' % (className, registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
+    writeLine(fileDescriptor, '        if (unit.values().size() == %s) {' % (registerDefinition['size']))
+    writeLine(fileDescriptor, '            process%sRegisterValues(unit.values());' % (propertyName[0].upper() + propertyName[1:]))
+    writeLine(fileDescriptor, '        } else {')
+    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Reading from \\"%s\\" registers" << %s << "size:" << %s << "returned different size than requested. Ignoring incomplete data" << unit.values();' % (className, registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor, '        verifyUpdateFinished();')
+    writeLine(fileDescriptor, '    });')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::errorOccurred, this, [this, reply] (QModbusDevice::Error error){')
+    writeLine(fileDescriptor, '        QModbusResponse response = reply->rawResult();')
+    writeLine(fileDescriptor, '        if (reply->error() == QModbusDevice::ProtocolError && response.isException()) {')
+    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Modbus reply error occurred while reading \\"%s\\" registers from" << m_modbusTcpMaster->hostAddress().toString() << error << reply->errorString() << ModbusDataUtils::exceptionCodeToString(response.exceptionCode());' % (className, registerDefinition['description']))
+    writeLine(fileDescriptor, '        } else {')
+    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Modbus reply error occurred while reading \\"%s\\" registers from" << m_modbusTcpMaster->hostAddress().toString() << error << reply->errorString();' % (className, registerDefinition['description']))
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor, '    });')
+
+
+def writeBlockUpdateTcp(fileDescriptor, className, blockDefinition, updateIntervalName = None):
+    blockName = blockDefinition['id']
+    blockRegisters = blockDefinition['registers']
+
+    blockStartAddress = 0
+    registerCount = 0
+    blockSize = 0
+    registerType = ""
+
+    for i, blockRegister in enumerate(blockRegisters):
+        if i == 0:
+            blockStartAddress = blockRegister['address']
+            registerType = blockRegister['registerType']
+
+        registerCount += 1
+        blockSize += blockRegister['size']
+
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    // Read %s' % blockName)
+    writeLine(fileDescriptor, '    reply = readBlock%s();' % (blockName[0].upper() + blockName[1:]))
+    writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read block \\"%s\\" registers from:" << %s << "size:" << %s;' % (className, blockName, blockStartAddress, blockSize))
+    writeLine(fileDescriptor, '    if (!reply) {')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading block \\"%s\\" registers";' % (className, blockName))
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    if (reply->isFinished()) {')
+    writeLine(fileDescriptor, '        reply->deleteLater(); // Broadcast reply returns immediatly')
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '        ')
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    m_pendingUpdateReplies.append(reply);')
+    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);')
+    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, this, [this, reply](){')
+    writeLine(fileDescriptor, '        m_pendingUpdateReplies.removeAll(reply);')
+    writeLine(fileDescriptor, '        handleModbusError(reply->error());')
+    writeLine(fileDescriptor, '        if (reply->error() != QModbusDevice::NoError) {')
+    writeUpdateIntervalReset(fileDescriptor, updateIntervalName, '            ')
+    writeLine(fileDescriptor, '            verifyUpdateFinished();')
+    writeLine(fileDescriptor, '            return;')
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '        const QModbusDataUnit unit = reply->result();')
+    writeLine(fileDescriptor, '        const QVector<quint16> blockValues = unit.values();')
+    writeLine(fileDescriptor, '        qCDebug(dc%s()) << "<-- Response from reading block \\"%s\\" register" << %s << "size:" << %s << blockValues;' % (className, blockName, blockStartAddress, blockSize))
+    writeLine(fileDescriptor, '        if (blockValues.size() == %s) {' % (blockSize))
+
+    # Start parsing the registers using offsets
+    offset = 0
+    for i, blockRegister in enumerate(blockRegisters):
+        propertyName = blockRegister['id']
+        propertyTyp = getCppDataType(blockRegister)
+        writeLine(fileDescriptor, '            process%sRegisterValues(blockValues.constData() + %s, %s);' % (propertyName[0].upper() + propertyName[1:], offset, blockRegister['size']))
+        offset += blockRegister['size']
+
+    writeLine(fileDescriptor, '        } else {')
+    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Reading from \\"%s\\" block registers" << %s << "size:" << %s << "returned different size than requested. Ignoring incomplete data" << blockValues;' % (className, blockName, blockStartAddress, blockSize))
+    writeLine(fileDescriptor, '        }')
+
+    writeLine(fileDescriptor, '        verifyUpdateFinished();')
+    writeLine(fileDescriptor, '    });')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::errorOccurred, this, [reply] (QModbusDevice::Error error){')
+    writeLine(fileDescriptor, '        QModbusResponse response = reply->rawResult();')
+    writeLine(fileDescriptor, '        if (reply->error() == QModbusDevice::ProtocolError && response.isException()) {')
+    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Modbus reply error occurred while updating block \\"%s\\" registers" << error << reply->errorString() << ModbusDataUtils::exceptionCodeToString(response.exceptionCode());' % (className, blockName))
+    writeLine(fileDescriptor, '        } else {')
+    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Modbus reply error occurred while updating block \\"%s\\" registers" << error << reply->errorString();' % (className, blockName))
+    writeLine(fileDescriptor, '        }')
+    writeLine(fileDescriptor, '    });')
+    writeLine(fileDescriptor)
+
+
+def writeUpdateMethodTcp(fileDescriptor, className, updateItems, queuedRequests, valuesChangedSignal = False, snapshot = False):
     writeLine(fileDescriptor, 'bool %s::update()' % (className))
     writeLine(fileDescriptor, '{')
 
     # First check if there are any update registers
-    updateRequired = False
-    for registerDefinition in registerDefinitions:
-        if registerDefinition['readSchedule'] == 'update':
-            updateRequired = True
-            break
-
-    for blockDefinition in blockDefinitions:  
-        if 'readSchedule' in blockDefinition and blockDefinition['readSchedule'] == 'update':
-            updateRequired = True
-            break
-
-    if updateRequired:
+    if updateItems:
         if queuedRequests:
             writeLine(fileDescriptor, '    if (!m_modbusTcpMaster->connected()) {')
             writeLine(fileDescriptor, '        m_updateRequestQueue.clear();')
@@ -786,20 +1110,44 @@ def writeUpdateMethodTcp(fileDescriptor, className, registerDefinitions, blockDe
             writeLine(fileDescriptor, '        return true;')
             writeLine(fileDescriptor, '    }')
             writeLine(fileDescriptor)
+            writeUpdateIntervalTimerStart(fileDescriptor, updateItems)
+
+            # Enqueue the registers and merged registers first, followed by the blocks.
+            # Scheduled reads get separated by an empty line from the surrounding requests.
+            blocksStarted = False
+            separated = True
+            for updateItem in updateItems:
+                if updateItem['type'] == 'block' and not blocksStarted:
+                    blocksStarted = True
+                    if not separated:
+                        writeLine(fileDescriptor)
+                        separated = True
+
+                scheduled = updateItem['interval'] > 0 or getUpdateDemand(updateItem)
+                if scheduled and not separated:
+                    writeLine(fileDescriptor)
 
-            # Read individual registers
-            for registerDefinition in registerDefinitions:
-                propertyName = registerDefinition['id']
-                
-                if 'readSchedule' in registerDefinition and registerDefinition['readSchedule'] == 'update':
-                    writeLine(fileDescriptor, '    enqueueRequest(&%s::update%s);' % (className, propertyName[0].upper() + propertyName[1:]))
+                updateMethodName = updateItem['name'][0].upper() + updateItem['name'][1:]
+                if updateItem['type'] == 'block':
+                    updateMethodName = updateItem['definition']['id'][0].upper() + updateItem['definition']['id'][1:] + 'Block'
 
-            # Read init blocks
-            writeLine(fileDescriptor)
-            for blockDefinition in blockDefinitions:
-                blockName = blockDefinition['id']
-                if 'readSchedule' in blockDefinition and blockDefinition['readSchedule'] == 'update':
-                    writeLine(fileDescriptor, '    enqueueRequest(&%s::update%sBlock);' % (className, blockName[0].upper() + blockName[1:]))
+                writeScheduledUpdate(fileDescriptor, updateItem, lambda fileDescriptor: writeLine(fileDescriptor, '    enqueueRequest(&%s::update%s);' % (className, updateMethodName)))
+                separated = bool(scheduled)
+                if separated:
+                    writeLine(fileDescriptor)
+
+            if updateMayReadNothing(updateItems):
+                if not separated:
+                    writeLine(fileDescriptor)
+
+                writeLine(fileDescriptor, '    if (m_updateRequestQueue.isEmpty()) {')
+                writeLine(fileDescriptor, '        // No read due in this update cycle')
+                writeEmitUpdateFinished(fileDescriptor, valuesChangedSignal, '        ', snapshot)
+                writeLine(fileDescriptor, '        return true;')
+                writeLine(fileDescriptor, '    }')
+                writeLine(fileDescriptor)
+            elif not blocksStarted:
+                writeLine(fileDescriptor)
 
             writeLine(fileDescriptor, '    sendNextQueuedRequest();');
         else:
@@ -812,134 +1160,336 @@ def writeUpdateMethodTcp(fileDescriptor, className, registerDefinitions, blockDe
             writeLine(fileDescriptor, '        return true;')
             writeLine(fileDescriptor, '    }')
             writeLine(fileDescriptor)
+            writeUpdateIntervalTimerStart(fileDescriptor, updateItems)
             writeLine(fileDescriptor, '    QModbusReply *reply = nullptr;')
 
-            # Read individual registers
-            for registerDefinition in registerDefinitions:
-                propertyName = registerDefinition['id']
-                propertyTyp = getCppDataType(registerDefinition)
+            for updateItem in updateItems:
+                if updateItem['type'] == 'merged':
+                    writeScheduledUpdate(fileDescriptor, updateItem, lambda fileDescriptor: writeReadPlanUpdateTcp(fileDescriptor, className, updateItem['definition'], getUpdateIntervalName(updateItems, updateItem['name'])))
+                elif updateItem['type'] == 'block':
+                    writeScheduledUpdate(fileDescriptor, updateItem, lambda fileDescriptor: writeBlockUpdateTcp(fileDescriptor, className, updateItem['definition'], getUpdateIntervalName(updateItems, updateItem['name'])))
+                else:
+                    writeScheduledUpdate(fileDescriptor, updateItem, lambda fileDescriptor: writeRegisterUpdateTcp(fileDescriptor, className, updateItem['definition'], getUpdateIntervalName(updateItems, updateItem['name'])))
+
+            if updateMayReadNothing(updateItems):
+                writeLine(fileDescriptor, '    if (m_pendingUpdateReplies.isEmpty()) {')
+                writeLine(fileDescriptor, '        // No read due in this update cycle')
+                writeEmitUpdateFinished(fileDescriptor, valuesChangedSignal, '        ', snapshot)
+                writeLine(fileDescriptor, '    }')
+                writeLine(fileDescriptor)
 
-                if 'readSchedule' in registerDefinition and registerDefinition['readSchedule'] == 'update':
-                    writeLine(fileDescriptor)
-                    writeLine(fileDescriptor, '    // Read %s' % registerDefinition['description'])
-                    writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read \\"%s\\" register:" << %s << "size:" << %s;' % (className, registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
-                    writeLine(fileDescriptor, '    reply = read%s();' % (propertyName[0].upper() + propertyName[1:]))
-                    writeLine(fileDescriptor, '    if (!reply) {')
-                    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading \\"%s\\" registers from" << m_modbusTcpMaster->hostAddress().toString() << m_modbusTcpMaster->errorString();' % (className, registerDefinition['description']))
-                    writeLine(fileDescriptor, '        return false;')
-                    writeLine(fileDescriptor, '    }')
-                    writeLine(fileDescriptor)
-                    writeLine(fileDescriptor, '    if (reply->isFinished()) {')
-                    writeLine(fileDescriptor, '        reply->deleteLater(); // Broadcast reply returns immediatly')
-                    writeLine(fileDescriptor, '        return false;')
-                    writeLine(fileDescriptor, '    }')
-                    writeLine(fileDescriptor)
-                    writeLine(fileDescriptor, '    m_pendingUpdateReplies.append(reply);')
-                    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);')
-                    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, this, [this, reply](){')
-                    writeLine(fileDescriptor, '        m_pendingUpdateReplies.removeAll(reply);')
-                    writeLine(fileDescriptor, '        handleModbusError(reply->error());')
-                    writeLine(fileDescriptor, '        if (reply->error() != QModbusDevice::NoError) {')
-                    writeLine(fileDescriptor, '            verifyUpdateFinished();')
-                    writeLine(fileDescriptor, '            return;')
-                    writeLine(fileDescriptor, '        }')
-                    writeLine(fileDescriptor)
-                    writeLine(fileDescriptor, '        const QModbusDataUnit unit = reply->result();')
-                    writeLine(fileDescriptor, '        qCDebug(dc%s()) << "<-- Response from \\"%s\\" register" << %s << "size:" << %s << unit.values();' % (className, registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
-                    writeLine(fileDescriptor, '        if (unit.values().size() == %s) {' % (registerDefinition['size']))
-                    writeLine(fileDescriptor, '            process%sRegisterValues(unit.values());' % (propertyName[0].upper() + propertyName[1:]))
-                    writeLine(fileDescriptor, '        } else {')
-                    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Reading from \\"%s\\" registers" << %s << "size:" << %s << "returned different size than requested. Ignoring incomplete data" << unit.values();' % (className, registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
-                    writeLine(fileDescriptor, '        }')
-                    writeLine(fileDescriptor, '        verifyUpdateFinished();')
-                    writeLine(fileDescriptor, '    });')
-                    writeLine(fileDescriptor)
-                    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::errorOccurred, this, [this, reply] (QModbusDevice::Error error){')
-                    writeLine(fileDescriptor, '        QModbusResponse response = reply->rawResult();')
-                    writeLine(fileDescriptor, '        if (reply->error() == QModbusDevice::ProtocolError && response.isException()) {')
-                    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Modbus reply error occurred while reading \\"%s\\" registers from" << m_modbusTcpMaster->hostAddress().toString() << error << reply->errorString() << ModbusDataUtils::exceptionCodeToString(response.exceptionCode());' % (className, registerDefinition['description']))
-                    writeLine(fileDescriptor, '        } else {')
-                    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Modbus reply error occurred while reading \\"%s\\" registers from" << m_modbusTcpMaster->hostAddress().toString() << error << reply->errorString();' % (className, registerDefinition['description']))
-                    writeLine(fileDescriptor, '        }')
-                    writeLine(fileDescriptor, '    });')
+    else:
+        writeLine(fileDescriptor, '    // No update registers defined. Nothing to be done and we are finished.')
+        writeEmitUpdateFinished(fileDescriptor, valuesChangedSignal, '    ', snapshot)
 
-            # Read init blocks
-            for blockDefinition in blockDefinitions:
-                blockName = blockDefinition['id']
-                blockRegisters = blockDefinition['registers']
+    writeLine(fileDescriptor, '    return true;')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
 
-                if 'readSchedule' in blockDefinition and blockDefinition['readSchedule'] == 'update':
-                    blockStartAddress = 0
-                    registerCount = 0
-                    blockSize = 0
-                    registerType = ""
+##############################################################
 
-                    for i, blockRegister in enumerate(blockRegisters):
-                        if i == 0:
-                            blockStartAddress = blockRegister['address']
-                            registerType = blockRegister['registerType']
+def writeInitMethodImplementationTableTcp(fileDescriptor, className, registerTable, queuedRequests):
+    writeLine(fileDescriptor, 'bool %s::initialize()' % (className))
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    if (!m_reachable) {')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Tried to initialize but the device is not to be reachable.";' % className)
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor, '    }')
 
-                        registerCount += 1
-                        blockSize += blockRegister['size']
+    if registerTable['initRequests']:
+        if queuedRequests:
+            writeLine(fileDescriptor)
+            writeLine(fileDescriptor, '    if (!m_modbusTcpMaster->connected()) {')
+            writeLine(fileDescriptor, '        m_initRequestQueue.clear();')
+            writeLine(fileDescriptor, '        return false;')
+            writeLine(fileDescriptor, '    }')
+            writeLine(fileDescriptor)
+            writeLine(fileDescriptor, '    m_initializing = true;')
+            writeLine(fileDescriptor)
+            writeLine(fileDescriptor, '    for (int request : s_initRequests)')
+            writeLine(fileDescriptor, '        enqueueInitRequest(request);')
+            writeLine(fileDescriptor)
+            writeLine(fileDescriptor, '    sendNextQueuedInitRequest();')
+        else:
+            writeLine(fileDescriptor)
+            writeLine(fileDescriptor, '    if (m_initObject) {')
+            writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Tried to initialize but the init process is already running.";' % className)
+            writeLine(fileDescriptor, '        return false;')
+            writeLine(fileDescriptor, '    }')
+            writeLine(fileDescriptor)
+            writeLine(fileDescriptor, '    m_initializing = true;')
+            writeLine(fileDescriptor)
+            writeLine(fileDescriptor, '    // Parent object for the init process')
+            writeLine(fileDescriptor, '    m_initObject = new QObject(this);')
+            writeLine(fileDescriptor)
+            writeLine(fileDescriptor, '    for (int request : s_initRequests) {')
+            writeLine(fileDescriptor, '        if (!sendInitTableRequest(request))')
+            writeLine(fileDescriptor, '            return false;')
+            writeLine(fileDescriptor, '    }')
+            writeLine(fileDescriptor)
+    else:
+        writeLine(fileDescriptor, '    // No init registers defined. Nothing to be done and we are finished.')
+        writeLine(fileDescriptor, '    m_initializing = false;')
+        writeLine(fileDescriptor, '    emit initializationFinished(true);')
 
-                    writeLine(fileDescriptor)
-                    writeLine(fileDescriptor, '    // Read %s' % blockName)
-                    writeLine(fileDescriptor, '    reply = readBlock%s();' % (blockName[0].upper() + blockName[1:]))
-                    writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read block \\"%s\\" registers from:" << %s << "size:" << %s;' % (className, blockName, blockStartAddress, blockSize))
-                    writeLine(fileDescriptor, '    if (!reply) {')
-                    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading block \\"%s\\" registers";' % (className, blockName))
-                    writeLine(fileDescriptor, '        return false;')
-                    writeLine(fileDescriptor, '    }')
-                    writeLine(fileDescriptor)
-                    writeLine(fileDescriptor, '    if (reply->isFinished()) {')
-                    writeLine(fileDescriptor, '        reply->deleteLater(); // Broadcast reply returns immediatly')
-                    writeLine(fileDescriptor, '        return false;')
-                    writeLine(fileDescriptor, '    }')
-                    writeLine(fileDescriptor)
-                    writeLine(fileDescriptor, '    m_pendingUpdateReplies.append(reply);')
-                    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);')
-                    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, this, [this, reply](){')
-                    writeLine(fileDescriptor, '        m_pendingUpdateReplies.removeAll(reply);')
-                    writeLine(fileDescriptor, '        handleModbusError(reply->error());')
-                    writeLine(fileDescriptor, '        if (reply->error() != QModbusDevice::NoError) {')
-                    writeLine(fileDescriptor, '            verifyUpdateFinished();')
-                    writeLine(fileDescriptor, '            return;')
-                    writeLine(fileDescriptor, '        }')
-                    writeLine(fileDescriptor)
-                    writeLine(fileDescriptor, '        const QModbusDataUnit unit = reply->result();')
-                    writeLine(fileDescriptor, '        const QVector<quint16> blockValues = unit.values();')
-                    writeLine(fileDescriptor, '        qCDebug(dc%s()) << "<-- Response from reading block \\"%s\\" register" << %s << "size:" << %s << blockValues;' % (className, blockName, blockStartAddress, blockSize))
-                    writeLine(fileDescriptor, '        if (blockValues.size() == %s) {' % (blockSize))
+    writeLine(fileDescriptor, '    return true;')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
 
-                    # Start parsing the registers using offsets
-                    offset = 0
-                    for i, blockRegister in enumerate(blockRegisters):
-                        propertyName = blockRegister['id']
-                        propertyTyp = getCppDataType(blockRegister)
-                        writeLine(fileDescriptor, '            process%sRegisterValues(blockValues.mid(%s, %s));' % (propertyName[0].upper() + propertyName[1:], offset, blockRegister['size']))
-                        offset += blockRegister['size']
 
-                    writeLine(fileDescriptor, '        } else {')
-                    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Reading from \\"%s\\" block registers" << %s << "size:" << %s << "returned different size than requested. Ignoring incomplete data" << blockValues;' % (className, blockName, blockStartAddress, blockSize))
-                    writeLine(fileDescriptor, '        }')
+def writeUpdateMethodTableTcp(fileDescriptor, className, registerTable, updateItems, queuedRequests, valuesChangedSignal = False, snapshot = False):
+    writeLine(fileDescriptor, 'bool %s::update()' % (className))
+    writeLine(fileDescriptor, '{')
 
-                    writeLine(fileDescriptor, '        verifyUpdateFinished();')
-                    writeLine(fileDescriptor, '    });')
-                    writeLine(fileDescriptor)
-                    writeLine(fileDescriptor, '    connect(reply, &QModbusReply::errorOccurred, this, [reply] (QModbusDevice::Error error){')
-                    writeLine(fileDescriptor, '        QModbusResponse response = reply->rawResult();')
-                    writeLine(fileDescriptor, '        if (reply->error() == QModbusDevice::ProtocolError && response.isException()) {')
-                    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Modbus reply error occurred while updating block \\"%s\\" registers" << error << reply->errorString() << ModbusDataUtils::exceptionCodeToString(response.exceptionCode());' % (className, blockName))
-                    writeLine(fileDescriptor, '        } else {')
-                    writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Modbus reply error occurred while updating block \\"%s\\" registers" << error << reply->errorString();' % (className, blockName))
-                    writeLine(fileDescriptor, '        }')
-                    writeLine(fileDescriptor, '    });')
-                    writeLine(fileDescriptor)
+    if registerTable['updateRequests']:
+        if queuedRequests:
+            writeLine(fileDescriptor, '    if (!m_modbusTcpMaster->connected()) {')
+            writeLine(fileDescriptor, '        m_updateRequestQueue.clear();')
+            writeLine(fileDescriptor, '        return false;')
+            writeLine(fileDescriptor, '    }')
+            writeLine(fileDescriptor)
+            writeLine(fileDescriptor, '    if (!m_updateRequestQueue.isEmpty()) {')
+            writeLine(fileDescriptor, '        qCDebug(dc%s()) << "Tried to update but there are still some update requests pending. Waiting for them to be finished..." << m_updateRequestQueue.count();' % className)
+            writeLine(fileDescriptor, '        return true;')
+            writeLine(fileDescriptor, '    }')
+            writeLine(fileDescriptor)
+            writeUpdateIntervalTimerStart(fileDescriptor, updateItems)
+            writeTableUpdateLoop(fileDescriptor, updateItems, [ 'enqueueRequest(request);' ])
+            if updateMayReadNothing(updateItems):
+                writeLine(fileDescriptor, '    if (m_updateRequestQueue.isEmpty()) {')
+                writeLine(fileDescriptor, '        // No read due in this update cycle')
+                writeEmitUpdateFinished(fileDescriptor, valuesChangedSignal, '        ', snapshot)
+                writeLine(fileDescriptor, '        return true;')
+                writeLine(fileDescriptor, '    }')
+                writeLine(fileDescriptor)
 
+            writeLine(fileDescriptor, '    sendNextQueuedRequest();')
+        else:
+            writeLine(fileDescriptor, '    if (!m_modbusTcpMaster->connected())')
+            writeLine(fileDescriptor, '        return false;')
+            writeLine(fileDescriptor)
+            writeLine(fileDescriptor, '    if (!m_pendingUpdateReplies.isEmpty()) {')
+            writeLine(fileDescriptor, '        qCDebug(dc%s()) << "Tried to update but there are still some update replies pending. Waiting for them to be finished...";' % className)
+            writeLine(fileDescriptor, '        return true;')
+            writeLine(fileDescriptor, '    }')
+            writeLine(fileDescriptor)
+            writeUpdateIntervalTimerStart(fileDescriptor, updateItems)
+            writeTableUpdateLoop(fileDescriptor, updateItems, [ 'if (!sendUpdateTableRequest(request))', '    return false;' ])
+            if updateMayReadNothing(updateItems):
+                writeLine(fileDescriptor, '    if (m_pendingUpdateReplies.isEmpty()) {')
+                writeLine(fileDescriptor, '        // No read due in this update cycle')
+                writeEmitUpdateFinished(fileDescriptor, valuesChangedSignal, '        ', snapshot)
+                writeLine(fileDescriptor, '    }')
+                writeLine(fileDescriptor)
     else:
         writeLine(fileDescriptor, '    // No update registers defined. Nothing to be done and we are finished.')
-        writeLine(fileDescriptor, '    emit updateFinished();')
+        writeEmitUpdateFinished(fileDescriptor, valuesChangedSignal, '    ', snapshot)
 
     writeLine(fileDescriptor, '    return true;')
     writeLine(fileDescriptor, '}')
     writeLine(fileDescriptor)
+
+
+def writeTableRequestMethodImplementationsTcp(fileDescriptor, className, queuedRequests, queuedRequestsDelay, requestPacer = False, updateIntervals = False):
+    if queuedRequests:
+        writeLine(fileDescriptor, 'void %s::sendNextQueuedInitRequest()' % (className))
+        writeLine(fileDescriptor, '{')
+        writeLine(fileDescriptor, '    if (m_initRequestQueue.isEmpty())')
+        writeLine(fileDescriptor, '        return;')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    if (m_currentInitReply)')
+        writeLine(fileDescriptor, '        return;')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    const int request = m_initRequestQueue.dequeue();')
+        writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read init" << tableDescription(request) << "registers from:" << s_requests[request].address << "size:" << s_requests[request].size;' % className)
+        writeLine(fileDescriptor, '    QModbusReply *reply = ModbusRegisterTable::sendReadRequest(m_modbusTcpMaster, m_slaveId, s_requests[request]);')
+        writeLine(fileDescriptor, '    if (!reply) {')
+        writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading init" << tableDescription(request) << "registers from" << m_modbusTcpMaster->hostAddress().toString() << m_modbusTcpMaster->errorString();' % className)
+        writeLine(fileDescriptor, '        finishInitialization(false);')
+        writeLine(fileDescriptor, '        return;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    if (reply->isFinished()) {')
+        writeLine(fileDescriptor, '        reply->deleteLater(); // Broadcast reply returns immediatly')
+        writeLine(fileDescriptor, '        if (!verifyInitFinished())')
+        writeLine(fileDescriptor, '            QTimer::singleShot(%s, this, &%s::sendNextQueuedInitRequest);' % (queuedRequestsDelay, className))
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '        return;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    m_currentInitReply = reply;')
+        writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);')
+        writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, this, [this, reply, request](){')
+        writeLine(fileDescriptor, '        m_currentInitReply = nullptr;')
+        writeLine(fileDescriptor, '        handleModbusError(reply->error());')
+        writeRequestPacerRecord(fileDescriptor, 'reply', requestPacer, '        ')
+        writeLine(fileDescriptor, '        if (reply->error() != QModbusDevice::NoError) {')
+        writeLine(fileDescriptor, '            printTableRequestError(request, reply);')
+        writeLine(fileDescriptor, '            finishInitialization(false);')
+        writeLine(fileDescriptor, '            return;')
+        writeLine(fileDescriptor, '        }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '        processTableRequestValues(request, reply->result().values());')
+        writeLine(fileDescriptor, '        if (!verifyInitFinished())')
+        writeLine(fileDescriptor, '            QTimer::singleShot(%s, this, &%s::sendNextQueuedInitRequest);' % (queuedRequestsDelay, className))
+        writeLine(fileDescriptor, '    });')
+        writeLine(fileDescriptor, '}')
+        writeLine(fileDescriptor)
+
+        writeLine(fileDescriptor, 'void %s::sendNextQueuedRequest()' % (className))
+        writeLine(fileDescriptor, '{')
+        writeLine(fileDescriptor, '    if (m_updateRequestQueue.isEmpty())')
+        writeLine(fileDescriptor, '        return;')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    if (m_currentUpdateReply)')
+        writeLine(fileDescriptor, '        return;')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    const int request = m_updateRequestQueue.dequeue();')
+        writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read" << tableDescription(request) << "registers from:" << s_requests[request].address << "size:" << s_requests[request].size;' % className)
+        writeLine(fileDescriptor, '    QModbusReply *reply = ModbusRegisterTable::sendReadRequest(m_modbusTcpMaster, m_slaveId, s_requests[request]);')
+        writeLine(fileDescriptor, '    if (!reply || reply->isFinished()) {')
+        writeLine(fileDescriptor, '        if (!reply) {')
+        writeLine(fileDescriptor, '            qCWarning(dc%s()) << "Error occurred while reading" << tableDescription(request) << "registers from" << m_modbusTcpMaster->hostAddress().toString() << m_modbusTcpMaster->errorString();' % className)
+        writeLine(fileDescriptor, '        } else {')
+        writeLine(fileDescriptor, '            reply->deleteLater(); // Broadcast reply returns immediatly')
+        writeLine(fileDescriptor, '        }')
+        writeLine(fileDescriptor)
+        writeTableUpdateIntervalReset(fileDescriptor, updateIntervals, '        ')
+        writeLine(fileDescriptor, '        if (!verifyUpdateFinished())')
+        writeLine(fileDescriptor, '            QTimer::singleShot(%s, this, &%s::sendNextQueuedRequest);' % (queuedRequestsDelay, className))
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '        return;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    m_currentUpdateReply = reply;')
+        writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);')
+        writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, this, [this, reply, request](){')
+        writeLine(fileDescriptor, '        m_currentUpdateReply = nullptr;')
+        writeLine(fileDescriptor, '        handleModbusError(reply->error());')
+        writeRequestPacerRecord(fileDescriptor, 'reply', requestPacer, '        ')
+        writeLine(fileDescriptor, '        if (reply->error() == QModbusDevice::NoError) {')
+        writeLine(fileDescriptor, '            processTableRequestValues(request, reply->result().values());')
+        writeLine(fileDescriptor, '        } else {')
+        writeLine(fileDescriptor, '            printTableRequestError(request, reply);')
+        writeTableUpdateIntervalReset(fileDescriptor, updateIntervals, '            ')
+        writeLine(fileDescriptor, '        }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '        if (!verifyUpdateFinished())')
+        writeLine(fileDescriptor, '            QTimer::singleShot(%s, this, &%s::sendNextQueuedRequest);' % (queuedRequestsDelay, className))
+        writeLine(fileDescriptor, '    });')
+        writeLine(fileDescriptor, '}')
+        writeLine(fileDescriptor)
+
+        writeLine(fileDescriptor, 'void %s::updateTableRequest(TableRequest request)' % (className))
+        writeLine(fileDescriptor, '{')
+        writeLine(fileDescriptor, '    enqueueRequest(request);')
+        writeLine(fileDescriptor, '    sendNextQueuedRequest();')
+        writeLine(fileDescriptor, '}')
+        writeLine(fileDescriptor)
+
+        writeTableEnqueueMethodImplementations(fileDescriptor, className)
+    else:
+        writeLine(fileDescriptor, 'bool %s::sendInitTableRequest(int request)' % (className))
+        writeLine(fileDescriptor, '{')
+        writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read init" << tableDescription(request) << "registers from:" << s_requests[request].address << "size:" << s_requests[request].size;' % className)
+        writeLine(fileDescriptor, '    QModbusReply *reply = ModbusRegisterTable::sendReadRequest(m_modbusTcpMaster, m_slaveId, s_requests[request]);')
+        writeLine(fileDescriptor, '    if (!reply) {')
+        writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading init" << tableDescription(request) << "registers from" << m_modbusTcpMaster->hostAddress().toString() << m_modbusTcpMaster->errorString();' % className)
+        writeLine(fileDescriptor, '        finishInitialization(false);')
+        writeLine(fileDescriptor, '        return false;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    if (reply->isFinished()) {')
+        writeLine(fileDescriptor, '        reply->deleteLater(); // Broadcast reply returns immediatly')
+        writeLine(fileDescriptor, '        return false;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    m_pendingInitReplies.append(reply);')
+        writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);')
+        writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, m_initObject, [this, reply, request](){')
+        writeLine(fileDescriptor, '        handleModbusError(reply->error());')
+        writeLine(fileDescriptor, '        m_pendingInitReplies.removeAll(reply);')
+        writeLine(fileDescriptor, '        if (reply->error() != QModbusDevice::NoError) {')
+        writeLine(fileDescriptor, '            printTableRequestError(request, reply);')
+        writeLine(fileDescriptor, '            finishInitialization(false);')
+        writeLine(fileDescriptor, '            return;')
+        writeLine(fileDescriptor, '        }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '        processTableRequestValues(request, reply->result().values());')
+        writeLine(fileDescriptor, '        verifyInitFinished();')
+        writeLine(fileDescriptor, '    });')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    return true;')
+        writeLine(fileDescriptor, '}')
+        writeLine(fileDescriptor)
+
+        writeLine(fileDescriptor, 'bool %s::sendUpdateTableRequest(int request)' % (className))
+        writeLine(fileDescriptor, '{')
+        writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read" << tableDescription(request) << "registers from:" << s_requests[request].address << "size:" << s_requests[request].size;' % className)
+        writeLine(fileDescriptor, '    QModbusReply *reply = ModbusRegisterTable::sendReadRequest(m_modbusTcpMaster, m_slaveId, s_requests[request]);')
+        writeLine(fileDescriptor, '    if (!reply) {')
+        writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading" << tableDescription(request) << "registers from" << m_modbusTcpMaster->hostAddress().toString() << m_modbusTcpMaster->errorString();' % className)
+        writeTableUpdateIntervalReset(fileDescriptor, updateIntervals, '        ')
+        writeLine(fileDescriptor, '        return false;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    if (reply->isFinished()) {')
+        writeLine(fileDescriptor, '        reply->deleteLater(); // Broadcast reply returns immediatly')
+        writeTableUpdateIntervalReset(fileDescriptor, updateIntervals, '        ')
+        writeLine(fileDescriptor, '        return false;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    m_pendingUpdateReplies.append(reply);')
+        writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);')
+        writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, this, [this, reply, request](){')
+        writeLine(fileDescriptor, '        m_pendingUpdateReplies.removeAll(reply);')
+        writeLine(fileDescriptor, '        handleModbusError(reply->error());')
+        writeLine(fileDescriptor, '        if (reply->error() == QModbusDevice::NoError) {')
+        writeLine(fileDescriptor, '            processTableRequestValues(request, reply->result().values());')
+        writeLine(fileDescriptor, '        } else {')
+        writeLine(fileDescriptor, '            printTableRequestError(request, reply);')
+        writeTableUpdateIntervalReset(fileDescriptor, updateIntervals, '            ')
+        writeLine(fileDescriptor, '        }')
+        writeLine(fileDescriptor, '        verifyUpdateFinished();')
+        writeLine(fileDescriptor, '    });')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    return true;')
+        writeLine(fileDescriptor, '}')
+        writeLine(fileDescriptor)
+
+        writeLine(fileDescriptor, 'void %s::updateTableRequest(TableRequest request)' % (className))
+        writeLine(fileDescriptor, '{')
+        writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Read" << tableDescription(request) << "registers from:" << s_requests[request].address << "size:" << s_requests[request].size;' % className)
+        writeLine(fileDescriptor, '    QModbusReply *reply = ModbusRegisterTable::sendReadRequest(m_modbusTcpMaster, m_slaveId, s_requests[request]);')
+        writeLine(fileDescriptor, '    if (!reply) {')
+        writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Error occurred while reading" << tableDescription(request) << "registers from" << m_modbusTcpMaster->hostAddress().toString() << m_modbusTcpMaster->errorString();' % className)
+        writeLine(fileDescriptor, '        return;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    if (reply->isFinished()) {')
+        writeLine(fileDescriptor, '        reply->deleteLater(); // Broadcast reply returns immediatly')
+        writeLine(fileDescriptor, '        return;')
+        writeLine(fileDescriptor, '    }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);')
+        writeLine(fileDescriptor, '    connect(reply, &QModbusReply::finished, this, [this, reply, request](){')
+        writeLine(fileDescriptor, '        handleModbusError(reply->error());')
+        writeLine(fileDescriptor, '        if (reply->error() == QModbusDevice::NoError) {')
+        writeLine(fileDescriptor, '            processTableRequestValues(request, reply->result().values());')
+        writeLine(fileDescriptor, '        } else {')
+        writeLine(fileDescriptor, '            printTableRequestError(request, reply);')
+        writeLine(fileDescriptor, '        }')
+        writeLine(fileDescriptor, '    });')
+        writeLine(fileDescriptor, '}')
+        writeLine(fileDescriptor)
+
+    writeLine(fileDescriptor, 'void %s::printTableRequestError(int request, QModbusReply *reply)' % (className))
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    QModbusResponse response = reply->rawResult();')
+    writeLine(fileDescriptor, '    if (reply->error() == QModbusDevice::ProtocolError && response.isException()) {')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Modbus reply error occurred while reading" << tableDescription(request) << "registers from" << m_modbusTcpMaster->hostAddress().toString() << reply->error() << reply->errorString() << ModbusDataUtils::exceptionCodeToString(response.exceptionCode());' % className)
+    writeLine(fileDescriptor, '    } else {')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Modbus reply error occurred while reading" << tableDescription(request) << "registers from" << m_modbusTcpMaster->hostAddress().toString() << reply->error() << reply->errorString();' % className)
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
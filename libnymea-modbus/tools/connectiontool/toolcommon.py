@@ -14,6 +14,7 @@
 # along with this program; if not, write to the Free Software
 # Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 
+import io
 import os
 import re
 import sys
@@ -118,6 +119,20 @@ def writeLicenseHeader(fileDescriptor):
     writeLine(fileDescriptor)
 
 
+def getRegistersEnumIds(registerJson):
+    # Registers sharing the same address will be represented by the last one defined
+    registerEnums = {}
+    if 'blocks' in registerJson:
+        for blockDefinition in registerJson['blocks']:
+            for blockRegister in blockDefinition['registers']:
+                registerEnums[blockRegister['address']] = blockRegister['id']
+
+    for registerDefinition in registerJson['registers']:
+        registerEnums[registerDefinition['address']] = registerDefinition['id']
+
+    return list(registerEnums.values())
+
+
 def writeRegistersEnum(fileDescriptor, registerJson):
     logger.debug('Writing enum for all registers')
 
@@ -291,58 +306,58 @@ def getValueConversionMethod(registerDefinition):
     if 'enum' in registerDefinition:
         enumName = registerDefinition['enum']
         if registerDefinition['type'] == 'uint16':
-            return ('static_cast<%s>(ModbusDataUtils::convertToUInt16(values))' % (enumName))
+            return ('static_cast<%s>(ModbusDataUtils::convertToUInt16(values, count))' % (enumName))
         elif registerDefinition['type'] == 'int16':
-            return ('static_cast<%s>(ModbusDataUtils::convertToInt16(values))' % (enumName))
+            return ('static_cast<%s>(ModbusDataUtils::convertToInt16(values, count))' % (enumName))
         elif registerDefinition['type'] == 'uint32':
-            return ('static_cast<%s>(ModbusDataUtils::convertToUInt32(values, m_endianness))' % (enumName))
+            return ('static_cast<%s>(ModbusDataUtils::convertToUInt32(values, count, m_endianness))' % (enumName))
         elif registerDefinition['type'] == 'int32':
-            return ('static_cast<%s>(ModbusDataUtils::convertToInt32(values, m_endianness))' % (enumName))
+            return ('static_cast<%s>(ModbusDataUtils::convertToInt32(values, count, m_endianness))' % (enumName))
 
     # Handle scale factors
     if 'scaleFactor' in registerDefinition:
         scaleFactorProperty = 'm_%s' % registerDefinition['scaleFactor']
         if registerDefinition['type'] == 'uint16':
-            return ('ModbusDataUtils::convertToUInt16(values) * 1.0 * pow(10, %s)' % (scaleFactorProperty))
+            return ('ModbusDataUtils::convertToUInt16(values, count) * 1.0 * pow(10, %s)' % (scaleFactorProperty))
         elif registerDefinition['type'] == 'int16':
-            return ('ModbusDataUtils::convertToInt16(values) * 1.0 * pow(10, %s)' % (scaleFactorProperty))
+            return ('ModbusDataUtils::convertToInt16(values, count) * 1.0 * pow(10, %s)' % (scaleFactorProperty))
         elif registerDefinition['type'] == 'uint32':
-            return ('ModbusDataUtils::convertToUInt32(values, m_endianness) * 1.0 * pow(10, %s)' % (scaleFactorProperty))
+            return ('ModbusDataUtils::convertToUInt32(values, count, m_endianness) * 1.0 * pow(10, %s)' % (scaleFactorProperty))
         elif registerDefinition['type'] == 'int32':
-            return ('ModbusDataUtils::convertToInt32(values, m_endianness) * 1.0 * pow(10, %s)' % (scaleFactorProperty))
+            return ('ModbusDataUtils::convertToInt32(values, count, m_endianness) * 1.0 * pow(10, %s)' % (scaleFactorProperty))
 
     elif 'staticScaleFactor' in registerDefinition:
         scaleFactor = registerDefinition['staticScaleFactor']
         if registerDefinition['type'] == 'uint16':
-            return ('ModbusDataUtils::convertToUInt16(values) * 1.0 * pow(10, %s)' % (scaleFactor))
+            return ('ModbusDataUtils::convertToUInt16(values, count) * 1.0 * pow(10, %s)' % (scaleFactor))
         elif registerDefinition['type'] == 'int16':
-            return ('ModbusDataUtils::convertToInt16(values) * 1.0 * pow(10, %s)' % (scaleFactor))
+            return ('ModbusDataUtils::convertToInt16(values, count) * 1.0 * pow(10, %s)' % (scaleFactor))
         elif registerDefinition['type'] == 'uint32':
-            return ('ModbusDataUtils::convertToUInt32(values, m_endianness) * 1.0 * pow(10, %s)' % (scaleFactor))
+            return ('ModbusDataUtils::convertToUInt32(values, count, m_endianness) * 1.0 * pow(10, %s)' % (scaleFactor))
         elif registerDefinition['type'] == 'int32':
-            return ('ModbusDataUtils::convertToInt32(values, m_endianness) * 1.0 * pow(10, %s)' % (scaleFactor))
+            return ('ModbusDataUtils::convertToInt32(values, count, m_endianness) * 1.0 * pow(10, %s)' % (scaleFactor))
 
     # Handle default types
     elif registerDefinition['type'] == 'uint16':
-        return ('ModbusDataUtils::convertToUInt16(values)')
+        return ('ModbusDataUtils::convertToUInt16(values, count)')
     elif registerDefinition['type'] == 'int16':
-        return ('ModbusDataUtils::convertToInt16(values)')
+        return ('ModbusDataUtils::convertToInt16(values, count)')
     elif registerDefinition['type'] == 'uint32':
-        return ('ModbusDataUtils::convertToUInt32(values, m_endianness)')
+        return ('ModbusDataUtils::convertToUInt32(values, count, m_endianness)')
     elif registerDefinition['type'] == 'int32':
-        return ('ModbusDataUtils::convertToInt32(values, m_endianness)')
+        return ('ModbusDataUtils::convertToInt32(values, count, m_endianness)')
     elif registerDefinition['type'] == 'uint64':
-        return ('ModbusDataUtils::convertToUInt64(values, m_endianness)')
+        return ('ModbusDataUtils::convertToUInt64(values, count, m_endianness)')
     elif registerDefinition['type'] == 'int64':
-        return ('ModbusDataUtils::convertToInt64(values, m_endianness)')
+        return ('ModbusDataUtils::convertToInt64(values, count, m_endianness)')
     elif registerDefinition['type'] == 'float':
-        return ('ModbusDataUtils::convertToFloat32(values, m_endianness)')
+        return ('ModbusDataUtils::convertToFloat32(values, count, m_endianness)')
     elif registerDefinition['type'] == 'float64':
-        return ('ModbusDataUtils::convertToFloat64(values, m_endianness)')
+        return ('ModbusDataUtils::convertToFloat64(values, count, m_endianness)')
     elif registerDefinition['type'] == 'string':
-        return ('ModbusDataUtils::convertToString(values, m_stringEndianness)')
+        return ('ModbusDataUtils::convertToString(values, count, m_stringEndianness)')
     elif registerDefinition['type'] == 'bytearray':
-        return ('ModbusDataUtils::convertToByteArray(values)')
+        return ('ModbusDataUtils::convertToByteArray(values, count)')
     elif registerDefinition['type'] == 'raw':
         return ('values')
 
@@ -408,6 +423,552 @@ def validateBlocks(blockDefinitions):
         logger.debug('Define valid block \"%s\" starting at %s with length %s containing %s properties to read.' % (blockName, blockStartAddress, blockSize, registerCount))
 
 
+def computeReadPlan(registerDefinitions, maxGap = 0, maxSize = 125):
+    # Collect all readable update registers which are allowed to be merged, grouped by register type
+    registerGroups = {}
+    for registerDefinition in registerDefinitions:
+        if not 'readSchedule' in registerDefinition or registerDefinition['readSchedule'] != 'update':
+            continue
+
+        if 'access' in registerDefinition and not 'R' in registerDefinition['access']:
+            continue
+
+        if 'noMerge' in registerDefinition and registerDefinition['noMerge']:
+            continue
+
+        registerType = 'holdingRegister'
+        if 'registerType' in registerDefinition:
+            registerType = registerDefinition['registerType']
+
+        # Registers polled at different intervals can not share a request
+        registerGroups.setdefault((registerType, getUpdateInterval(registerDefinition)), []).append(registerDefinition)
+
+    # Merge address adjacent registers as long as the gap and the request size are within the limits
+    readRequests = []
+    for (registerType, interval), registers in registerGroups.items():
+        currentRequest = None
+        for registerDefinition in sorted(registers, key = lambda registerDefinition: registerDefinition['address']):
+            registerStartAddress = registerDefinition['address']
+            registerEndAddress = registerStartAddress + registerDefinition['size']
+            if currentRequest is not None:
+                requestEndAddress = currentRequest['address'] + currentRequest['size']
+                if registerStartAddress - requestEndAddress <= maxGap and registerEndAddress - currentRequest['address'] <= maxSize:
+                    currentRequest['registers'].append(registerDefinition)
+                    currentRequest['size'] = max(requestEndAddress, registerEndAddress) - currentRequest['address']
+                    continue
+
+                readRequests.append(currentRequest)
+
+            currentRequest = { 'registerType': registerType, 'address': registerStartAddress, 'size': registerDefinition['size'], 'interval': interval, 'registers': [ registerDefinition ] }
+
+        if currentRequest is not None:
+            readRequests.append(currentRequest)
+
+    # Only requests containing more than one register are worth merging, the others will be read as usual.
+    # Keep the order of the register definitions so the read sequence stays the same as without merging.
+    registerIds = [ registerDefinition['id'] for registerDefinition in registerDefinitions ]
+    readPlan = [ readRequest for readRequest in readRequests if len(readRequest['registers']) > 1 ]
+    readPlan.sort(key = lambda readRequest: min(registerIds.index(registerDefinition['id']) for registerDefinition in readRequest['registers']))
+    for i, readRequest in enumerate(readPlan):
+        readRequest['id'] = 'mergedRegisters%s' % i
+        readRequest['priority'] = max(getUpdatePriority(registerDefinition) for registerDefinition in readRequest['registers'])
+        logger.debug('Define merged request \"%s\" starting at %s with length %s containing %s properties to read.' % (readRequest['id'], readRequest['address'], readRequest['size'], len(readRequest['registers'])))
+
+    return readPlan
+
+
+def getUpdateInterval(definition):
+    if 'interval' in definition:
+        return definition['interval']
+
+    return 0
+
+
+def getUpdatePriority(definition):
+    if 'priority' in definition:
+        return definition['priority']
+
+    return 0
+
+
+def validateUpdateSchedules(registerDefinitions, blockDefinitions):
+    for definition in registerDefinitions + blockDefinitions:
+        if not 'interval' in definition and not 'priority' in definition:
+            continue
+
+        if not 'readSchedule' in definition or definition['readSchedule'] != 'update':
+            logger.warning('Error: %s defines an update interval or priority but is not read on update. Please set the \"readSchedule\" to \"update\".' % definition['id'])
+            exit(1)
+
+        if 'interval' in definition and (not isinstance(definition['interval'], int) or definition['interval'] <= 0):
+            logger.warning('Error: Invalid \"interval\" %s in %s. The interval must be a positive number of milliseconds.' % (definition['interval'], definition['id']))
+            exit(1)
+
+        if 'priority' in definition and not isinstance(definition['priority'], int):
+            logger.warning('Error: Invalid \"priority\" %s in %s. The priority must be an integer.' % (definition['priority'], definition['id']))
+            exit(1)
+
+    for blockDefinition in blockDefinitions:
+        for blockRegister in blockDefinition['registers']:
+            if 'interval' in blockRegister or 'priority' in blockRegister:
+                logger.warning('Error: Register %s in block %s defines an update interval or priority. Please define them for the entire block.' % (blockRegister['id'], blockDefinition['id']))
+                exit(1)
+
+
+def getUpdateItems(registerDefinitions, blockDefinitions, readPlan):
+    # All reads of an update cycle in the order they get sent. Merged requests will be sent in place
+    # of their first register, blocks after the registers. Higher priorities will be sent first.
+    updateItems = []
+    for registerDefinition in registerDefinitions:
+        if not 'readSchedule' in registerDefinition or registerDefinition['readSchedule'] != 'update':
+            continue
+
+        readRequest = getReadPlanRequest(readPlan, registerDefinition)
+        if readRequest:
+            if isFirstReadPlanRegister(readRequest, registerDefinitions, registerDefinition):
+                updateItems.append({ 'type': 'merged', 'name': readRequest['id'], 'definition': readRequest, 'interval': readRequest['interval'], 'priority': readRequest['priority'] })
+            continue
+
+        updateItems.append({ 'type': 'register', 'name': registerDefinition['id'], 'definition': registerDefinition, 'interval': getUpdateInterval(registerDefinition), 'priority': getUpdatePriority(registerDefinition) })
+
+    for blockDefinition in blockDefinitions:
+        if not 'readSchedule' in blockDefinition or blockDefinition['readSchedule'] != 'update':
+            continue
+
+        blockName = blockDefinition['id']
+        updateItems.append({ 'type': 'block', 'name': 'block' + blockName[0].upper() + blockName[1:], 'definition': blockDefinition, 'interval': getUpdateInterval(blockDefinition), 'priority': getUpdatePriority(blockDefinition) })
+
+    updateItems.sort(key = lambda updateItem: -updateItem['priority'])
+    return updateItems
+
+
+def getRegisterEnumNames(registerJson):
+    # Registers sharing the same address will be represented by the last one defined
+    registerEnumNames = {}
+    for blockDefinition in registerJson.get('blocks', []):
+        for blockRegister in blockDefinition['registers']:
+            registerEnumNames[blockRegister['address']] = 'Register' + blockRegister['id'][0].upper() + blockRegister['id'][1:]
+
+    for registerDefinition in registerJson['registers']:
+        registerEnumNames[registerDefinition['address']] = 'Register' + registerDefinition['id'][0].upper() + registerDefinition['id'][1:]
+
+    return registerEnumNames
+
+
+def assignUpdateDemands(updateItems, registerJson, checkReachableRegister):
+    # The registers which have to be subscribed for reading an update item. The item containing
+    # the check reachable register will always be read in order to keep detecting the reachability.
+    registerEnumNames = getRegisterEnumNames(registerJson)
+    for updateItem in updateItems:
+        if updateItem['type'] == 'register':
+            registerDefinitions = [ updateItem['definition'] ]
+        else:
+            registerDefinitions = updateItem['definition']['registers']
+
+        updateItem['demand'] = []
+        if checkReachableRegister['id'] in [ registerDefinition['id'] for registerDefinition in registerDefinitions ]:
+            continue
+
+        for registerDefinition in registerDefinitions:
+            if not 'R' in registerDefinition.get('access', 'R'):
+                continue
+
+            registerEnumName = registerEnumNames[registerDefinition['address']]
+            if not registerEnumName in updateItem['demand']:
+                updateItem['demand'].append(registerEnumName)
+
+
+def getUpdateDemand(updateItem):
+    return updateItem.get('demand', [])
+
+
+def updateMayReadNothing(updateItems):
+    # True if an update cycle might not send any request due to intervals or missing subscriptions
+    for updateItem in updateItems:
+        if updateItem['interval'] == 0 and not getUpdateDemand(updateItem):
+            return False
+
+    return True
+
+
+def writeSubscriptionMethodDeclarations(fileDescriptor):
+    writeLine(fileDescriptor, '    // Once registers have been subscribed, update() reads only the subscribed registers and the')
+    writeLine(fileDescriptor, '    // check reachable register. Without any subscription all update registers will be read.')
+    writeLine(fileDescriptor, '    void subscribe(Registers modbusRegister);')
+    writeLine(fileDescriptor, '    void unsubscribe(Registers modbusRegister);')
+    writeLine(fileDescriptor)
+
+
+def writeSubscriptionMembers(fileDescriptor, tableDriven = False):
+    writeLine(fileDescriptor, '    QHash<Registers, int> m_subscriptions;')
+    writeLine(fileDescriptor, '    bool demanded(std::initializer_list<Registers> registers) const;')
+    if tableDriven:
+        writeLine(fileDescriptor, '    bool demanded(int request) const;')
+    writeLine(fileDescriptor)
+
+
+def writeSubscriptionMethodImplementations(fileDescriptor, className, updateItems = [], tableDriven = False):
+    writeLine(fileDescriptor, 'void %s::subscribe(Registers modbusRegister)' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    // Subscriptions are counted, each subscribe requires a matching unsubscribe')
+    writeLine(fileDescriptor, '    m_subscriptions[modbusRegister]++;')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+    writeLine(fileDescriptor, 'void %s::unsubscribe(Registers modbusRegister)' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    if (!m_subscriptions.contains(modbusRegister))')
+    writeLine(fileDescriptor, '        return;')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    if (--m_subscriptions[modbusRegister] <= 0)')
+    writeLine(fileDescriptor, '        m_subscriptions.remove(modbusRegister);')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+    writeLine(fileDescriptor, 'bool %s::demanded(std::initializer_list<Registers> registers) const' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    if (m_subscriptions.isEmpty())')
+    writeLine(fileDescriptor, '        return true;')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    for (Registers modbusRegister : registers) {')
+    writeLine(fileDescriptor, '        if (m_subscriptions.contains(modbusRegister))')
+    writeLine(fileDescriptor, '            return true;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    return false;')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+    if not tableDriven:
+        return
+
+    writeLine(fileDescriptor, 'bool %s::demanded(int request) const' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    switch (request) {')
+    for updateItem in updateItems:
+        if getUpdateDemand(updateItem):
+            writeLine(fileDescriptor, '    case TableRequest%s:' % (updateItem['name'][0].upper() + updateItem['name'][1:]))
+            writeLine(fileDescriptor, '        return demanded({%s});' % ', '.join(getUpdateDemand(updateItem)))
+    writeLine(fileDescriptor, '    default:')
+    writeLine(fileDescriptor, '        return true;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+
+def hasUpdateIntervals(updateItems):
+    for updateItem in updateItems:
+        if updateItem['interval'] > 0:
+            return True
+
+    return False
+
+
+def writeUpdateIntervalMembers(fileDescriptor, updateItems):
+    if not hasUpdateIntervals(updateItems):
+        return
+
+    writeLine(fileDescriptor, '    QElapsedTimer m_updateIntervalTimer;')
+    for updateItem in updateItems:
+        if updateItem['interval'] > 0:
+            writeLine(fileDescriptor, '    qint64 m_%sNextUpdate = 0;' % updateItem['name'])
+
+    writeLine(fileDescriptor)
+
+
+def writeUpdateIntervalTimerStart(fileDescriptor, updateItems):
+    if not hasUpdateIntervals(updateItems):
+        return
+
+    writeLine(fileDescriptor, '    if (!m_updateIntervalTimer.isValid())')
+    writeLine(fileDescriptor, '        m_updateIntervalTimer.start();')
+    writeLine(fileDescriptor)
+
+
+def getUpdateIntervalName(updateItems, name):
+    # The name of the next update member of the update item, None if the item is read on every update
+    for updateItem in updateItems:
+        if updateItem['name'] == name and updateItem['interval'] > 0:
+            return name
+
+    return None
+
+
+def writeUpdateIntervalReset(fileDescriptor, updateIntervalName, indentation):
+    # A failed read will be retried on the next update instead of waiting for the entire interval
+    if updateIntervalName:
+        writeLine(fileDescriptor, indentation + 'm_%sNextUpdate = 0;' % updateIntervalName)
+
+
+def writeTableUpdateIntervalReset(fileDescriptor, updateIntervals, indentation):
+    if updateIntervals:
+        writeLine(fileDescriptor, indentation + 'm_tableRequestNextUpdate[request] = 0;')
+
+
+def writeScheduledUpdate(fileDescriptor, updateItem, writeUpdate):
+    demand = getUpdateDemand(updateItem)
+    if updateItem['interval'] == 0 and not demand:
+        writeUpdate(fileDescriptor)
+        return
+
+    # Write the read into a buffer and send it only if the item is subscribed and the interval elapsed
+    buffer = io.StringIO()
+    writeUpdate(buffer)
+    lines = buffer.getvalue().split('\n')
+    leadingLines = 0
+    while lines and lines[0] == '':
+        lines.pop(0)
+        leadingLines += 1
+
+    trailingLines = 0
+    while lines and lines[-1] == '':
+        lines.pop()
+        trailingLines += 1
+
+    # Keep the spacing of the read around the condition
+    for i in range(leadingLines):
+        writeLine(fileDescriptor)
+
+    conditions = []
+    if demand:
+        conditions.append('demanded({%s})' % ', '.join(demand))
+
+    if updateItem['interval'] > 0:
+        writeLine(fileDescriptor, '    // Read every %s ms' % updateItem['interval'])
+        conditions.append('m_updateIntervalTimer.elapsed() >= m_%sNextUpdate' % updateItem['name'])
+
+    writeLine(fileDescriptor, '    if (%s) {' % ' && '.join(conditions))
+    if updateItem['interval'] > 0:
+        writeLine(fileDescriptor, '        m_%sNextUpdate = m_updateIntervalTimer.elapsed() + %s;' % (updateItem['name'], updateItem['interval']))
+    for line in lines:
+        writeLine(fileDescriptor, '    ' + line if line else '')
+
+    writeLine(fileDescriptor, '    }')
+    for i in range(trailingLines - 1):
+        writeLine(fileDescriptor)
+
+
+def getReadBackTarget(registerJson, targetId):
+    # A register or an entire block which can be read back after writing a register
+    for registerDefinition in registerJson['registers']:
+        if registerDefinition['id'] == targetId:
+            return { 'type': 'register', 'id': targetId, 'description': registerDefinition['description'], 'address': registerDefinition['address'], 'size': registerDefinition['size'], 'registerType': registerDefinition['registerType'], 'registers': [ registerDefinition ] }
+
+    for blockDefinition in registerJson.get('blocks', []):
+        blockRegisters = blockDefinition['registers']
+        if blockDefinition['id'] == targetId:
+            blockSize = sum(blockRegister['size'] for blockRegister in blockRegisters)
+            return { 'type': 'block', 'id': targetId, 'description': targetId, 'address': blockRegisters[0]['address'], 'size': blockSize, 'registerType': blockRegisters[0]['registerType'], 'registers': blockRegisters }
+
+        for blockRegister in blockRegisters:
+            if blockRegister['id'] == targetId:
+                return { 'type': 'register', 'id': targetId, 'description': blockRegister['description'], 'address': blockRegister['address'], 'size': blockRegister['size'], 'registerType': blockRegister['registerType'], 'registers': [ blockRegister ] }
+
+    return None
+
+
+def validateReadBack(registerJson):
+    registerDefinitions = list(registerJson['registers'])
+    for blockDefinition in registerJson.get('blocks', []):
+        registerDefinitions += blockDefinition['registers']
+
+    for registerDefinition in registerDefinitions:
+        if not 'readBack' in registerDefinition:
+            continue
+
+        if not 'W' in registerDefinition['access']:
+            logger.warning('Error: Register %s defines a \"readBack\" but is not writable.' % registerDefinition['id'])
+            exit(1)
+
+        readBackTarget = getReadBackTarget(registerJson, registerDefinition['readBack'])
+        if not readBackTarget:
+            logger.warning('Error: Could not find register or block \"%s\" for reading back after writing %s.' % (registerDefinition['readBack'], registerDefinition['id']))
+            exit(1)
+
+        for targetRegister in readBackTarget['registers']:
+            if not 'R' in targetRegister['access']:
+                logger.warning('Error: Register %s can not be read back after writing %s because it is not readable.' % (targetRegister['id'], registerDefinition['id']))
+                exit(1)
+
+
+def getReadBackTableRequestName(readBackTarget):
+    requestName = readBackTarget['id'][0].upper() + readBackTarget['id'][1:]
+    if readBackTarget['type'] == 'block':
+        requestName = 'Block' + requestName
+
+    return 'TableRequest' + requestName
+
+
+def writeReadBackProcessValues(fileDescriptor, className, readBackTarget, valuesName, indentation, tableDriven = False):
+    if tableDriven:
+        # The table request verifies the size of the values
+        writeLine(fileDescriptor, indentation + 'processTableRequestValues(%s, %s);' % (getReadBackTableRequestName(readBackTarget), valuesName))
+        return
+
+    writeLine(fileDescriptor, indentation + 'qCDebug(dc%s()) << "<-- Read back \\"%s\\" registers" << %s << "size:" << %s << %s;' % (className, readBackTarget['description'], readBackTarget['address'], readBackTarget['size'], valuesName))
+    writeLine(fileDescriptor, indentation + 'if (%s.size() == %s) {' % (valuesName, readBackTarget['size']))
+    if readBackTarget['type'] == 'register':
+        propertyName = readBackTarget['id']
+        writeLine(fileDescriptor, indentation + '    process%sRegisterValues(%s);' % (propertyName[0].upper() + propertyName[1:], valuesName))
+    else:
+        offset = 0
+        for blockRegister in readBackTarget['registers']:
+            propertyName = blockRegister['id']
+            writeLine(fileDescriptor, indentation + '    process%sRegisterValues(%s.constData() + %s, %s);' % (propertyName[0].upper() + propertyName[1:], valuesName, offset, blockRegister['size']))
+            offset += blockRegister['size']
+
+    writeLine(fileDescriptor, indentation + '} else {')
+    writeLine(fileDescriptor, indentation + '    qCWarning(dc%s()) << "Reading back \\"%s\\" registers" << %s << "size:" << %s << "returned different size than requested. Ignoring incomplete data" << %s;' % (className, readBackTarget['description'], readBackTarget['address'], readBackTarget['size'], valuesName))
+    writeLine(fileDescriptor, indentation + '}')
+
+
+def writeReadBackAfterWrite(fileDescriptor, className, readBackTarget, replyType, noError, rtu = False, indentation = '    ', tableDriven = False):
+    # Send a targeted read once the write request has been executed successfully
+    readMethodName = readBackTarget['id'][0].upper() + readBackTarget['id'][1:]
+    if readBackTarget['type'] == 'block':
+        readMethodName = 'Block' + readMethodName
+
+    readCall = 'read%s()' % readMethodName
+    if tableDriven:
+        readCall = 'readTableRequest(%s)' % getReadBackTableRequestName(readBackTarget)
+
+    writeLine(fileDescriptor, indentation + '// Read back \"%s\" once the write request has been executed' % readBackTarget['description'])
+    writeLine(fileDescriptor, indentation + 'connect(reply, &%s::finished, this, [this, reply](){' % replyType)
+    writeLine(fileDescriptor, indentation + '    if (reply->error() != %s)' % noError)
+    writeLine(fileDescriptor, indentation + '        return;')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, indentation + '    qCDebug(dc%s()) << "--> Read back \\"%s\\" registers from:" << %s << "size:" << %s;' % (className, readBackTarget['description'], readBackTarget['address'], readBackTarget['size']))
+    writeLine(fileDescriptor, indentation + '    %s *readBackReply = %s;' % (replyType, readCall))
+    writeLine(fileDescriptor, indentation + '    if (!readBackReply) {')
+    writeLine(fileDescriptor, indentation + '        qCWarning(dc%s()) << "Error occurred while reading back \\"%s\\" registers";' % (className, readBackTarget['description']))
+    writeLine(fileDescriptor, indentation + '        return;')
+    writeLine(fileDescriptor, indentation + '    }')
+    writeLine(fileDescriptor)
+    if rtu:
+        writeLine(fileDescriptor, indentation + '    if (readBackReply->isFinished())')
+        writeLine(fileDescriptor, indentation + '        return; // Broadcast reply returns immediatly')
+    else:
+        writeLine(fileDescriptor, indentation + '    if (readBackReply->isFinished()) {')
+        writeLine(fileDescriptor, indentation + '        readBackReply->deleteLater(); // Broadcast reply returns immediatly')
+        writeLine(fileDescriptor, indentation + '        return;')
+        writeLine(fileDescriptor, indentation + '    }')
+    writeLine(fileDescriptor)
+    if not rtu:
+        writeLine(fileDescriptor, indentation + '    connect(readBackReply, &%s::finished, readBackReply, &%s::deleteLater);' % (replyType, replyType))
+
+    writeLine(fileDescriptor, indentation + '    connect(readBackReply, &%s::finished, this, [this, readBackReply](){' % replyType)
+    writeLine(fileDescriptor, indentation + '        handleModbusError(readBackReply->error());')
+    writeLine(fileDescriptor, indentation + '        if (readBackReply->error() != %s) {' % noError)
+    writeLine(fileDescriptor, indentation + '            qCWarning(dc%s()) << "Modbus reply error occurred while reading back \\"%s\\" registers" << readBackReply->error() << readBackReply->errorString();' % (className, readBackTarget['description']))
+    writeLine(fileDescriptor, indentation + '            return;')
+    writeLine(fileDescriptor, indentation + '        }')
+    writeLine(fileDescriptor)
+    if rtu:
+        writeLine(fileDescriptor, indentation + '        const QVector<quint16> values = readBackReply->result();')
+    else:
+        writeLine(fileDescriptor, indentation + '        const QVector<quint16> values = readBackReply->result().values();')
+    writeReadBackProcessValues(fileDescriptor, className, readBackTarget, 'values', indentation + '        ', tableDriven)
+    writeLine(fileDescriptor, indentation + '    });')
+    writeLine(fileDescriptor, indentation + '});')
+
+
+def getRegisterOrder(registerJson, registerDefinition):
+    registerDefinitions = list(registerJson['registers'])
+    for blockDefinition in registerJson.get('blocks', []):
+        registerDefinitions += blockDefinition['registers']
+
+    return registerDefinitions.index(registerDefinition)
+
+
+def writeWriteTransactionMethodDeclarations(fileDescriptor):
+    writeLine(fileDescriptor, '    // Setters called between beginWrite() and commit() will be sent together on commit(),')
+    writeLine(fileDescriptor, '    // adjacent holding registers merged into one request. Each setter reply reports its own write.')
+    writeLine(fileDescriptor, '    void beginWrite();')
+    writeLine(fileDescriptor, '    bool commit();')
+    writeLine(fileDescriptor, '    void abortWrite();')
+    writeLine(fileDescriptor)
+
+
+def writeWriteTransactionMethodImplementations(fileDescriptor, className, commitTarget):
+    writeLine(fileDescriptor, 'void %s::beginWrite()' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    m_writeTransaction.begin();')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+    writeLine(fileDescriptor, 'bool %s::commit()' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    qCDebug(dc%s()) << "--> Commit write transaction containing" << m_writeTransaction.count() << "writes";' % className)
+    writeLine(fileDescriptor, '    return m_writeTransaction.commit(%s, m_slaveId);' % commitTarget)
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+    writeLine(fileDescriptor, 'void %s::abortWrite()' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    m_writeTransaction.abort();')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+
+def writeWriteTransactionStage(fileDescriptor, className, registerJson, registerDefinition, unit, replyType, noError, rtu = False, tableDriven = False):
+    stageMethod = 'stageRtuWrite' if rtu else 'stageWrite'
+    stageCall = 'm_writeTransaction.%s(%s, %s, m_slaveId, this)' % (stageMethod, getRegisterOrder(registerJson, registerDefinition), unit)
+    if 'readBack' in registerDefinition:
+        readBackTarget = getReadBackTarget(registerJson, registerDefinition['readBack'])
+        writeLine(fileDescriptor, '    if (m_writeTransaction.isActive()) {')
+        writeLine(fileDescriptor, '        // The write will be sent on commit(). Staging it again only replaces the value, the read back is connected already.')
+        writeLine(fileDescriptor, '        if (m_writeTransaction.isStaged(%s)) {' % getRegisterOrder(registerJson, registerDefinition))
+        writeLine(fileDescriptor, '            return %s;' % stageCall)
+        writeLine(fileDescriptor, '        }')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '        %s *reply = %s;' % (replyType, stageCall))
+        writeLine(fileDescriptor)
+        writeReadBackAfterWrite(fileDescriptor, className, readBackTarget, replyType, noError, rtu, '        ', tableDriven)
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '        return reply;')
+        writeLine(fileDescriptor, '    }')
+    else:
+        writeLine(fileDescriptor, '    // Within a write transaction the write will be sent on commit()')
+        writeLine(fileDescriptor, '    if (m_writeTransaction.isActive())')
+        writeLine(fileDescriptor, '        return %s;' % stageCall)
+
+    writeLine(fileDescriptor)
+
+
+def getReadPlanRequest(readPlan, registerDefinition):
+    for readRequest in readPlan:
+        for mergedRegisterDefinition in readRequest['registers']:
+            if mergedRegisterDefinition['id'] == registerDefinition['id']:
+                return readRequest
+
+    return None
+
+
+def isFirstReadPlanRegister(readRequest, registerDefinitions, registerDefinition):
+    # The merged request will be sent in place of the first member in the register definition order
+    for currentRegisterDefinition in registerDefinitions:
+        if currentRegisterDefinition in readRequest['registers']:
+            return currentRegisterDefinition['id'] == registerDefinition['id']
+
+    return False
+
+
+def writeReadPlanMethodDeclarationComment(fileDescriptor, readRequest):
+    writeLine(fileDescriptor, '    /* Read merged registers from start addess %s with size of %s registers containing following %s properties:' % (readRequest['address'], readRequest['size'], len(readRequest['registers'])))
+    for registerDefinition in readRequest['registers']:
+        if 'unit' in registerDefinition and registerDefinition['unit'] != '':
+            writeLine(fileDescriptor, '      - %s [%s] - Address: %s, Size: %s' % (registerDefinition['description'], registerDefinition['unit'], registerDefinition['address'], registerDefinition['size']))
+        else:
+            writeLine(fileDescriptor, '      - %s - Address: %s, Size: %s' % (registerDefinition['description'], registerDefinition['address'], registerDefinition['size']))
+    writeLine(fileDescriptor, '    */' )
+
+
+def writeReadPlanProcessValues(fileDescriptor, readRequest, valuesName, indentation):
+    for registerDefinition in readRequest['registers']:
+        propertyName = registerDefinition['id']
+        writeLine(fileDescriptor, '%sprocess%sRegisterValues(%s.constData() + %s, %s);' % (indentation, propertyName[0].upper() + propertyName[1:], valuesName, registerDefinition['address'] - readRequest['address'], registerDefinition['size']))
+
+
 def writeBlocksUpdateMethodDeclarations(fileDescriptor, blockDefinitions):
     for blockDefinition in blockDefinitions:
         blockName = blockDefinition['id']
@@ -488,6 +1049,184 @@ def writeProtectedPropertyMembers(fileDescriptor, registerDefinitions):
         else:
             writeLine(fileDescriptor, '    %s m_%s;' % (propertyTyp, propertyName))
 
+        # The last value notified using the changed signal and the earliest time for the next notification
+        if hasChangeFilter(registerDefinition):
+            if 'defaultValue' in registerDefinition:
+                writeLine(fileDescriptor, '    %s m_%sEmitted = %s;' % (propertyTyp, propertyName, registerDefinition['defaultValue']))
+            else:
+                writeLine(fileDescriptor, '    %s m_%sEmitted;' % (propertyTyp, propertyName))
+
+        if 'minEmitInterval' in registerDefinition:
+            writeLine(fileDescriptor, '    qint64 m_%sNextEmit = 0;' % propertyName)
+
+        if 'history' in registerDefinition:
+            writeLine(fileDescriptor, '    ModbusRegisterHistory m_%sHistory = ModbusRegisterHistory(%s);' % (propertyName, registerDefinition['history']))
+
+
+def hasChangeFilter(registerDefinition):
+    return 'deadband' in registerDefinition or 'relativeDeadband' in registerDefinition or 'minEmitInterval' in registerDefinition
+
+
+def hasMinEmitIntervals(registerJson):
+    registerDefinitions = list(registerJson['registers'])
+    for blockDefinition in registerJson.get('blocks', []):
+        registerDefinitions += blockDefinition['registers']
+
+    for registerDefinition in registerDefinitions:
+        if 'minEmitInterval' in registerDefinition:
+            return True
+
+    return False
+
+
+def writeChangeNotificationMembers(fileDescriptor, registerJson, valuesChangedSignal):
+    if hasMinEmitIntervals(registerJson):
+        writeLine(fileDescriptor, '    QElapsedTimer m_emitIntervalTimer;')
+        writeLine(fileDescriptor)
+
+    if valuesChangedSignal:
+        writeLine(fileDescriptor, '    QVector<Registers> m_changedRegisters;')
+        writeLine(fileDescriptor)
+
+
+def validateChangeFilters(registerJson):
+    registerDefinitions = list(registerJson['registers'])
+    for blockDefinition in registerJson.get('blocks', []):
+        registerDefinitions += blockDefinition['registers']
+
+    for registerDefinition in registerDefinitions:
+        if 'deadband' in registerDefinition or 'relativeDeadband' in registerDefinition:
+            if 'deadband' in registerDefinition and 'relativeDeadband' in registerDefinition:
+                logger.warning('Error: Register %s defines both \"deadband\" and \"relativeDeadband\". Please use only one of them.' % registerDefinition['id'])
+                exit(1)
+
+            if getCppDataType(registerDefinition) not in ['quint16', 'qint16', 'quint32', 'qint32', 'quint64', 'qint64', 'float', 'double']:
+                logger.warning('Error: Register %s defines a deadband but is not numeric. A deadband can only be used for numeric values without enum.' % registerDefinition['id'])
+                exit(1)
+
+            for key in ['deadband', 'relativeDeadband']:
+                if key in registerDefinition and (not isinstance(registerDefinition[key], (int, float)) or registerDefinition[key] < 0):
+                    logger.warning('Error: Invalid \"%s\" %s in %s. The deadband must be a positive number.' % (key, registerDefinition[key], registerDefinition['id']))
+                    exit(1)
+
+        if 'minEmitInterval' in registerDefinition and (not isinstance(registerDefinition['minEmitInterval'], int) or registerDefinition['minEmitInterval'] <= 0):
+            logger.warning('Error: Invalid \"minEmitInterval\" %s in %s. The interval must be a positive number of milliseconds.' % (registerDefinition['minEmitInterval'], registerDefinition['id']))
+            exit(1)
+
+
+def getHistoryRegisters(registerJson):
+    registerDefinitions = list(registerJson['registers'])
+    for blockDefinition in registerJson.get('blocks', []):
+        registerDefinitions += blockDefinition['registers']
+
+    return [registerDefinition for registerDefinition in registerDefinitions if 'history' in registerDefinition and 'R' in registerDefinition.get('access', 'R')]
+
+
+def validateHistories(registerJson):
+    registerDefinitions = list(registerJson['registers'])
+    for blockDefinition in registerJson.get('blocks', []):
+        registerDefinitions += blockDefinition['registers']
+
+    for registerDefinition in registerDefinitions:
+        if not 'history' in registerDefinition:
+            continue
+
+        if getCppDataType(registerDefinition) not in ['quint16', 'qint16', 'quint32', 'qint32', 'quint64', 'qint64', 'float', 'double']:
+            logger.warning('Error: Register %s defines a history but is not numeric. A history can only be kept for numeric values without enum.' % registerDefinition['id'])
+            exit(1)
+
+        if not isinstance(registerDefinition['history'], int) or isinstance(registerDefinition['history'], bool) or registerDefinition['history'] <= 0:
+            logger.warning('Error: Invalid \"history\" %s in %s. The history must be a positive number of samples.' % (registerDefinition['history'], registerDefinition['id']))
+            exit(1)
+
+
+def writeHistoryMethodDeclarations(fileDescriptor, registerJson):
+    historyRegisters = getHistoryRegisters(registerJson)
+    if not historyRegisters:
+        return
+
+    writeLine(fileDescriptor, '    // Recent values of registers with a history, one sample for each read')
+    for registerDefinition in historyRegisters:
+        writeLine(fileDescriptor, '    const ModbusRegisterHistory &%sHistory() const;' % registerDefinition['id'])
+
+    writeLine(fileDescriptor)
+
+
+def writeHistoryMethodImplementations(fileDescriptor, className, registerJson):
+    for registerDefinition in getHistoryRegisters(registerJson):
+        writeLine(fileDescriptor, 'const ModbusRegisterHistory &%s::%sHistory() const' % (className, registerDefinition['id']))
+        writeLine(fileDescriptor, '{')
+        writeLine(fileDescriptor, '    return m_%sHistory;' % registerDefinition['id'])
+        writeLine(fileDescriptor, '}')
+        writeLine(fileDescriptor)
+
+
+def getSnapshotRegisters(registerJson):
+    registerDefinitions = list(registerJson['registers'])
+    for blockDefinition in registerJson.get('blocks', []):
+        registerDefinitions += blockDefinition['registers']
+
+    return [registerDefinition for registerDefinition in registerDefinitions if 'R' in registerDefinition.get('access', 'R')]
+
+
+def writeSnapshotDefinition(fileDescriptor, registerJson):
+    writeLine(fileDescriptor, '    // Copy of all register values, published at the end of each update cycle')
+    writeLine(fileDescriptor, '    struct Snapshot {')
+    writeLine(fileDescriptor, '        quint64 cycle = 0;')
+    writeLine(fileDescriptor, '        QDateTime timestamp;')
+    for registerDefinition in getSnapshotRegisters(registerJson):
+        propertyTyp = getCppDataType(registerDefinition)
+        if 'defaultValue' in registerDefinition:
+            writeLine(fileDescriptor, '        %s %s = %s;' % (propertyTyp, registerDefinition['id'], registerDefinition['defaultValue']))
+        else:
+            writeLine(fileDescriptor, '        %s %s;' % (propertyTyp, registerDefinition['id']))
+    writeLine(fileDescriptor, '    };')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    // Thread safe. Returns the values of the last finished update cycle, nullptr before the first one.')
+    writeLine(fileDescriptor, '    std::shared_ptr<const Snapshot> snapshot() const;')
+    writeLine(fileDescriptor)
+
+
+def writeSnapshotMembers(fileDescriptor):
+    writeLine(fileDescriptor, '    std::shared_ptr<const Snapshot> m_snapshot;')
+    writeLine(fileDescriptor, '    quint64 m_snapshotCycle = 0;')
+    writeLine(fileDescriptor, '    void publishSnapshot();')
+    writeLine(fileDescriptor)
+
+
+def writeSnapshotMethodImplementations(fileDescriptor, className, registerJson):
+    writeLine(fileDescriptor, 'std::shared_ptr<const %s::Snapshot> %s::snapshot() const' % (className, className))
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    return std::atomic_load(&m_snapshot);')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+    writeLine(fileDescriptor, 'void %s::publishSnapshot()' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    // Readers keep the previous snapshot alive as long as they are using it')
+    writeLine(fileDescriptor, '    std::shared_ptr<Snapshot> snapshot = std::make_shared<Snapshot>();')
+    writeLine(fileDescriptor, '    snapshot->cycle = ++m_snapshotCycle;')
+    writeLine(fileDescriptor, '    snapshot->timestamp = QDateTime::currentDateTimeUtc();')
+    for registerDefinition in getSnapshotRegisters(registerJson):
+        writeLine(fileDescriptor, '    snapshot->%s = m_%s;' % (registerDefinition['id'], registerDefinition['id']))
+    writeLine(fileDescriptor, '    std::atomic_store(&m_snapshot, std::shared_ptr<const Snapshot>(snapshot));')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+
+def writeEmitUpdateFinished(fileDescriptor, valuesChangedSignal, indentation = '    ', snapshot = False):
+    if snapshot:
+        writeLine(fileDescriptor, indentation + 'publishSnapshot();')
+
+    if valuesChangedSignal:
+        writeLine(fileDescriptor, indentation + 'if (!m_changedRegisters.isEmpty()) {')
+        writeLine(fileDescriptor, indentation + '    QVector<Registers> changedRegisters;')
+        writeLine(fileDescriptor, indentation + '    changedRegisters.swap(m_changedRegisters);')
+        writeLine(fileDescriptor, indentation + '    emit valuesChanged(changedRegisters);')
+        writeLine(fileDescriptor, indentation + '}')
+
+    writeLine(fileDescriptor, indentation + 'emit updateFinished();')
+
 
 def writePropertyProcessMethodDeclaration(fileDescriptor, registerDefinitions):
     for registerDefinition in registerDefinitions:
@@ -497,11 +1236,12 @@ def writePropertyProcessMethodDeclaration(fileDescriptor, registerDefinitions):
 
         propertyName = registerDefinition['id']
         writeLine(fileDescriptor, '    void process%sRegisterValues(const QVector<quint16> &values);' % (propertyName[0].upper() + propertyName[1:]))
+        writeLine(fileDescriptor, '    void process%sRegisterValues(const quint16 *values, int count);' % (propertyName[0].upper() + propertyName[1:]))
 
     writeLine(fileDescriptor)
     
 
-def writePropertyProcessMethodImplementations(fileDescriptor, className, registerDefinitions):
+def writePropertyProcessMethodImplementations(fileDescriptor, className, registerDefinitions, changedRegisterIds = []):
     for registerDefinition in registerDefinitions:
         if 'access' in registerDefinition:
             if not 'R' in registerDefinition['access']:
@@ -512,15 +1252,385 @@ def writePropertyProcessMethodImplementations(fileDescriptor, className, registe
 
         writeLine(fileDescriptor, 'void %s::process%sRegisterValues(const QVector<quint16> &values)' % (className, propertyName[0].upper() + propertyName[1:]))
         writeLine(fileDescriptor, '{')
-        writeLine(fileDescriptor, '    %s received%s = %s;' % (propertyTyp, propertyName[0].upper() + propertyName[1:], getValueConversionMethod(registerDefinition)))
-        writeLine(fileDescriptor, '    emit %sReadFinished(received%s);' % (propertyName, propertyName[0].upper() + propertyName[1:]))
+        writeLine(fileDescriptor, '    process%sRegisterValues(values.constData(), values.count());' % (propertyName[0].upper() + propertyName[1:]))
+        writeLine(fileDescriptor, '}')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, 'void %s::process%sRegisterValues(const quint16 *values, int count)' % (className, propertyName[0].upper() + propertyName[1:]))
+        writeLine(fileDescriptor, '{')
+        if registerDefinition['type'] == 'raw':
+            # Raw values are stored as they are, this is the only case requiring a copy of the span
+            writeLine(fileDescriptor, '    %s received%s(count);' % (propertyTyp, propertyName[0].upper() + propertyName[1:]))
+            writeLine(fileDescriptor, '    memcpy(received%s.data(), values, count * sizeof(quint16));' % (propertyName[0].upper() + propertyName[1:]))
+        else:
+            writeLine(fileDescriptor, '    %s received%s = %s;' % (propertyTyp, propertyName[0].upper() + propertyName[1:], getValueConversionMethod(registerDefinition)))
+        writePropertyReceivedValue(fileDescriptor, registerDefinition, changedRegisterIds)
+        writeLine(fileDescriptor, '}')
+        writeLine(fileDescriptor)
+
+
+def writePropertyReceivedValue(fileDescriptor, registerDefinition, changedRegisterIds):
+    propertyName = registerDefinition['id']
+    writeLine(fileDescriptor, '    emit %sReadFinished(received%s);' % (propertyName, propertyName[0].upper() + propertyName[1:]))
+    writeLine(fileDescriptor)
+    if 'history' in registerDefinition:
+        writeLine(fileDescriptor, '    m_%sHistory.append(received%s);' % (propertyName, propertyName[0].upper() + propertyName[1:]))
         writeLine(fileDescriptor)
+    if hasChangeFilter(registerDefinition):
+        writePropertyChangeFilter(fileDescriptor, registerDefinition, propertyName in changedRegisterIds)
+    else:
         writeLine(fileDescriptor, '    if (m_%s != received%s) {' % (propertyName, propertyName[0].upper() + propertyName[1:]))
         writeLine(fileDescriptor, '        m_%s = received%s;' % (propertyName, propertyName[0].upper() + propertyName[1:]))
         writeLine(fileDescriptor, '        emit %sChanged(m_%s);' % (propertyName, propertyName))
+        if propertyName in changedRegisterIds:
+            writeLine(fileDescriptor, '        if (!m_changedRegisters.contains(Register%s))' % (propertyName[0].upper() + propertyName[1:]))
+            writeLine(fileDescriptor, '            m_changedRegisters.append(Register%s);' % (propertyName[0].upper() + propertyName[1:]))
         writeLine(fileDescriptor, '    }')
-        writeLine(fileDescriptor, '}')
+
+
+def writePropertyChangeFilter(fileDescriptor, registerDefinition, notifyChangedRegister):
+    propertyName = registerDefinition['id']
+    receivedName = 'received' + propertyName[0].upper() + propertyName[1:]
+
+    # The property always holds the latest value, only the changed signal will be filtered
+    writeLine(fileDescriptor, '    m_%s = %s;' % (propertyName, receivedName))
+
+    conditions = [ 'm_%sEmitted != %s' % (propertyName, receivedName) ]
+    if 'deadband' in registerDefinition:
+        conditions.append('qAbs(static_cast<double>(%s) - static_cast<double>(m_%sEmitted)) >= %s' % (receivedName, propertyName, registerDefinition['deadband']))
+    elif 'relativeDeadband' in registerDefinition:
+        conditions.append('qAbs(static_cast<double>(%s) - static_cast<double>(m_%sEmitted)) >= qAbs(static_cast<double>(m_%sEmitted)) * %s' % (receivedName, propertyName, propertyName, registerDefinition['relativeDeadband'] / 100.0))
+
+    if 'deadband' in registerDefinition:
+        writeLine(fileDescriptor, '    // Notify only changes exceeding the deadband of %s' % registerDefinition['deadband'])
+    elif 'relativeDeadband' in registerDefinition:
+        writeLine(fileDescriptor, '    // Notify only changes exceeding %s %% of the last notified value' % registerDefinition['relativeDeadband'])
+
+    writeLine(fileDescriptor, '    if (%s) {' % ' && '.join(conditions))
+    indentation = '        '
+    if 'minEmitInterval' in registerDefinition:
+        writeLine(fileDescriptor, '        // Notify at most every %s ms, a suppressed change will be notified on a later read' % registerDefinition['minEmitInterval'])
+        writeLine(fileDescriptor, '        if (!m_emitIntervalTimer.isValid())')
+        writeLine(fileDescriptor, '            m_emitIntervalTimer.start();')
         writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '        if (m_emitIntervalTimer.elapsed() >= m_%sNextEmit) {' % propertyName)
+        writeLine(fileDescriptor, '            m_%sNextEmit = m_emitIntervalTimer.elapsed() + %s;' % (propertyName, registerDefinition['minEmitInterval']))
+        indentation = '            '
+
+    writeLine(fileDescriptor, indentation + 'm_%sEmitted = %s;' % (propertyName, receivedName))
+    writeLine(fileDescriptor, indentation + 'emit %sChanged(m_%s);' % (propertyName, propertyName))
+    if notifyChangedRegister:
+        writeLine(fileDescriptor, indentation + 'if (!m_changedRegisters.contains(Register%s))' % (propertyName[0].upper() + propertyName[1:]))
+        writeLine(fileDescriptor, indentation + '    m_changedRegisters.append(Register%s);' % (propertyName[0].upper() + propertyName[1:]))
+
+    if 'minEmitInterval' in registerDefinition:
+        writeLine(fileDescriptor, '        }')
+
+    writeLine(fileDescriptor, '    }')
+
+
+def getTableRegisterType(registerType):
+    if registerType == 'inputRegister':
+        return 'QModbusDataUnit::InputRegisters'
+    elif registerType == 'discreteInputs':
+        return 'QModbusDataUnit::DiscreteInputs'
+    elif registerType == 'coils':
+        return 'QModbusDataUnit::Coils'
+
+    return 'QModbusDataUnit::HoldingRegisters'
+
+
+def buildRegisterTable(registerJson, readPlan, updateItems):
+    # One request for each register, each block and each merged request. The request of a
+    # register is also used to address the register itself while processing other requests.
+    requests = []
+    requestIndexes = {}
+
+    def addRequest(requestType, name, description, address, size, registerType, registers):
+        requestIndexes[name] = len(requests)
+        readableRegisters = [ registerDefinition for registerDefinition in registers if not 'access' in registerDefinition or 'R' in registerDefinition['access'] ]
+        requests.append({ 'type': requestType, 'name': name, 'description': description, 'address': address, 'size': size, 'registerType': registerType, 'registers': readableRegisters, 'interval': 0 })
+
+    registerDefinitions = list(registerJson['registers'])
+    blockDefinitions = []
+    if 'blocks' in registerJson:
+        blockDefinitions = registerJson['blocks']
+        for blockDefinition in blockDefinitions:
+            registerDefinitions += blockDefinition['registers']
+
+    for registerDefinition in registerDefinitions:
+        propertyName = registerDefinition['id']
+        addRequest('register', propertyName[0].upper() + propertyName[1:], registerDefinition['description'], registerDefinition['address'], registerDefinition['size'], registerDefinition['registerType'], [ registerDefinition ])
+
+    for blockDefinition in blockDefinitions:
+        blockName = blockDefinition['id']
+        blockRegisters = blockDefinition['registers']
+        blockSize = sum(blockRegister['size'] for blockRegister in blockRegisters)
+        addRequest('block', 'Block' + blockName[0].upper() + blockName[1:], blockName, blockRegisters[0]['address'], blockSize, blockRegisters[0]['registerType'], blockRegisters)
+
+    for readRequest in readPlan:
+        requestName = readRequest['id']
+        addRequest('merged', requestName[0].upper() + requestName[1:], requestName, readRequest['address'], readRequest['size'], readRequest['registerType'], readRequest['registers'])
+
+    # Init reads, registers first followed by the blocks
+    initRequests = []
+    for registerDefinition in registerJson['registers']:
+        if 'readSchedule' in registerDefinition and registerDefinition['readSchedule'] == 'init':
+            initRequests.append(requestIndexes[registerDefinition['id'][0].upper() + registerDefinition['id'][1:]])
+
+    for blockDefinition in blockDefinitions:
+        if 'readSchedule' in blockDefinition and blockDefinition['readSchedule'] == 'init':
+            initRequests.append(requestIndexes['Block' + blockDefinition['id'][0].upper() + blockDefinition['id'][1:]])
+
+    # Update reads in the order they get sent
+    updateRequests = []
+    for updateItem in updateItems:
+        requestIndex = requestIndexes[updateItem['name'][0].upper() + updateItem['name'][1:]]
+        requests[requestIndex]['interval'] = updateItem['interval']
+        updateRequests.append(requestIndex)
+
+    # The descriptions are stored in one string, each request refers to the offset of its description
+    descriptionOffset = 0
+    for request in requests:
+        request['descriptionOffset'] = descriptionOffset
+        descriptionOffset += len(request['description'].encode('utf-8')) + 1
+
+    return { 'requests': requests, 'initRequests': initRequests, 'updateRequests': updateRequests }
+
+
+def getTableRequestName(registerTable, requestIndex):
+    return 'TableRequest' + registerTable['requests'][requestIndex]['name']
+
+
+def getTableDataType(registerDefinition):
+    dataTypes = { 'uint16': 'UInt16', 'int16': 'Int16', 'uint32': 'UInt32', 'int32': 'Int32', 'uint64': 'UInt64', 'int64': 'Int64', 'float': 'Float32', 'float64': 'Float64', 'string': 'String', 'bytearray': 'ByteArray', 'raw': 'Raw' }
+    return 'ModbusRegisterTable::DataType' + dataTypes[registerDefinition['type']]
+
+
+def writeTableRequestEnum(fileDescriptor, registerTable):
+    requests = registerTable['requests']
+    writeLine(fileDescriptor, '    // Read requests for each register, each block and each merged request')
+    writeLine(fileDescriptor, '    enum TableRequest {')
+    for i, request in enumerate(requests):
+        writeLine(fileDescriptor, '        TableRequest%s%s' % (request['name'], ',' if i < len(requests) - 1 else ''))
+    writeLine(fileDescriptor, '    };')
+    writeLine(fileDescriptor, '    Q_ENUM(TableRequest)')
+    writeLine(fileDescriptor)
+
+
+def writeTableRequestMethodDeclarations(fileDescriptor, replyType):
+    writeLine(fileDescriptor, '    // Read the registers of a table request, updateTableRequest() also updates the properties')
+    writeLine(fileDescriptor, '    %s *readTableRequest(TableRequest request);' % replyType)
+    writeLine(fileDescriptor, '    void updateTableRequest(TableRequest request);')
+    writeLine(fileDescriptor)
+
+
+def writeRegisterTable(fileDescriptor, className, registerTable):
+    requests = registerTable['requests']
+
+    writeLine(fileDescriptor, 'namespace {')
+    writeLine(fileDescriptor)
+
+    writeLine(fileDescriptor, 'constexpr char s_descriptions[] =')
+    for i, request in enumerate(requests):
+        description = request['description'].replace('\\', '\\\\').replace('"', '\\"')
+        writeLine(fileDescriptor, '    "%s\\0"%s' % (description, ';' if i == len(requests) - 1 else ''))
+    writeLine(fileDescriptor)
+
+    # Address, size, register type, first register, register count, update interval, description offset
+    registerIndex = 0
+    writeLine(fileDescriptor, 'constexpr ModbusRegisterTable::Request s_requests[] = {')
+    for i, request in enumerate(requests):
+        writeLine(fileDescriptor, '    { %s, %s, %s, %s, %s, %s, %s }%s' % (request['address'], request['size'], getTableRegisterType(request['registerType']), registerIndex, len(request['registers']), request['interval'], request['descriptionOffset'], ',' if i < len(requests) - 1 else ''))
+        registerIndex += len(request['registers'])
+    writeLine(fileDescriptor, '};')
+    writeLine(fileDescriptor)
+
+    # Request of the register, offset within the request values, size, data type, static scale factor
+    tableRegisters = []
+    for request in requests:
+        for registerDefinition in request['registers']:
+            propertyName = registerDefinition['id']
+            tableRegisters.append('{ %s::TableRequest%s, %s, %s, %s, %s }' % (className, propertyName[0].upper() + propertyName[1:], registerDefinition['address'] - request['address'], registerDefinition['size'], getTableDataType(registerDefinition), registerDefinition.get('staticScaleFactor', 0)))
+
+    writeLine(fileDescriptor, 'constexpr ModbusRegisterTable::Register s_registers[] = {')
+    for i, tableRegister in enumerate(tableRegisters):
+        writeLine(fileDescriptor, '    %s%s' % (tableRegister, ',' if i < len(tableRegisters) - 1 else ''))
+    writeLine(fileDescriptor, '};')
+    writeLine(fileDescriptor)
+
+    if registerTable['initRequests']:
+        writeLine(fileDescriptor, 'constexpr int s_initRequests[] = {')
+        for i, requestIndex in enumerate(registerTable['initRequests']):
+            writeLine(fileDescriptor, '    %s::%s%s' % (className, getTableRequestName(registerTable, requestIndex), ',' if i < len(registerTable['initRequests']) - 1 else ''))
+        writeLine(fileDescriptor, '};')
+        writeLine(fileDescriptor)
+
+    if registerTable['updateRequests']:
+        writeLine(fileDescriptor, 'constexpr int s_updateRequests[] = {')
+        for i, requestIndex in enumerate(registerTable['updateRequests']):
+            writeLine(fileDescriptor, '    %s::%s%s' % (className, getTableRequestName(registerTable, requestIndex), ',' if i < len(registerTable['updateRequests']) - 1 else ''))
+        writeLine(fileDescriptor, '};')
+        writeLine(fileDescriptor)
+
+    writeLine(fileDescriptor, 'QString tableDescription(int request)')
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    return ModbusRegisterTable::description(s_descriptions, s_requests[request]);')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+
+def writeTableUpdateIntervalMembers(fileDescriptor, registerTable, updateItems):
+    if not hasUpdateIntervals(updateItems):
+        return
+
+    writeLine(fileDescriptor, '    QElapsedTimer m_updateIntervalTimer;')
+    writeLine(fileDescriptor, '    qint64 m_tableRequestNextUpdate[%s] = {};' % len(registerTable['requests']))
+    writeLine(fileDescriptor)
+
+
+def writeTableMethodDeclarations(fileDescriptor, replyType, queuedRequests):
+    if not queuedRequests:
+        writeLine(fileDescriptor, '    bool sendInitTableRequest(int request);')
+        writeLine(fileDescriptor, '    bool sendUpdateTableRequest(int request);')
+
+    writeLine(fileDescriptor, '    void printTableRequestError(int request, %s *reply);' % replyType)
+    writeLine(fileDescriptor, '    void processTableRequestValues(int request, const QVector<quint16> &values);')
+    writeLine(fileDescriptor, '    void processTableRegisterValues(const ModbusRegisterTable::Register &tableRegister, const quint16 *values);')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    template<typename T, typename Signal>')
+    writeLine(fileDescriptor, '    bool applyTableValue(T &property, const T &value, Signal readFinished, Signal changed);')
+    writeLine(fileDescriptor)
+
+
+def writeTableUpdateLoop(fileDescriptor, updateItems, sendStatements):
+    writeLine(fileDescriptor, '    for (int request : s_updateRequests) {')
+    writeLine(fileDescriptor, '        if (!demanded(request))')
+    writeLine(fileDescriptor, '            continue;')
+    writeLine(fileDescriptor)
+    if hasUpdateIntervals(updateItems):
+        writeLine(fileDescriptor, '        // Read only once the update interval of the request elapsed')
+        writeLine(fileDescriptor, '        if (s_requests[request].interval > 0) {')
+        writeLine(fileDescriptor, '            if (m_updateIntervalTimer.elapsed() < m_tableRequestNextUpdate[request])')
+        writeLine(fileDescriptor, '                continue;')
+        writeLine(fileDescriptor)
+        writeLine(fileDescriptor, '            m_tableRequestNextUpdate[request] = m_updateIntervalTimer.elapsed() + s_requests[request].interval;')
+        writeLine(fileDescriptor, '        }')
+        writeLine(fileDescriptor)
+
+    for sendStatement in sendStatements:
+        writeLine(fileDescriptor, '        ' + sendStatement if sendStatement else '')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+
+
+def writeTableReadMethodImplementations(fileDescriptor, className, replyType, master):
+    writeLine(fileDescriptor, '%s *%s::readTableRequest(TableRequest request)' % (replyType, className))
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    return ModbusRegisterTable::sendReadRequest(%s, m_slaveId, s_requests[request]);' % master)
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+
+def getTableValueConversionMethod(registerDefinition):
+    propertyTyp = getCppDataType(registerDefinition)
+    if registerDefinition['type'] == 'raw':
+        return 'ModbusRegisterTable::toRaw(tableRegister, values)'
+    elif registerDefinition['type'] == 'string':
+        return 'ModbusRegisterTable::toString(tableRegister, values, m_stringEndianness)'
+    elif registerDefinition['type'] == 'bytearray':
+        return 'ModbusRegisterTable::toByteArray(tableRegister, values)'
+    elif 'scaleFactor' in registerDefinition:
+        return 'static_cast<float>(ModbusRegisterTable::toNumber(tableRegister, values, m_endianness, m_%s))' % registerDefinition['scaleFactor']
+    elif propertyTyp == 'float' or propertyTyp == 'double':
+        return 'static_cast<%s>(ModbusRegisterTable::toNumber(tableRegister, values, m_endianness))' % propertyTyp
+
+    return 'static_cast<%s>(ModbusRegisterTable::toInteger(tableRegister, values, m_endianness))' % propertyTyp
+
+
+def writeTableProcessMethodImplementations(fileDescriptor, className, registerTable, changedRegisterIds = []):
+    writeLine(fileDescriptor, 'template<typename T, typename Signal>')
+    writeLine(fileDescriptor, 'bool %s::applyTableValue(T &property, const T &value, Signal readFinished, Signal changed)' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    emit (this->*readFinished)(value);')
+    writeLine(fileDescriptor, '    if (property == value)')
+    writeLine(fileDescriptor, '        return false;')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    property = value;')
+    writeLine(fileDescriptor, '    emit (this->*changed)(property);')
+    writeLine(fileDescriptor, '    return true;')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+    writeLine(fileDescriptor, 'void %s::processTableRequestValues(int request, const QVector<quint16> &values)' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    const ModbusRegisterTable::Request &tableRequest = s_requests[request];')
+    writeLine(fileDescriptor, '    qCDebug(dc%s()) << "<-- Response from" << tableDescription(request) << "registers" << tableRequest.address << "size:" << tableRequest.size << values;' % className)
+    writeLine(fileDescriptor, '    if (values.size() != tableRequest.size) {')
+    writeLine(fileDescriptor, '        qCWarning(dc%s()) << "Reading from" << tableDescription(request) << "registers" << tableRequest.address << "size:" << tableRequest.size << "returned different size than requested. Ignoring incomplete data" << values;' % className)
+    writeLine(fileDescriptor, '        return;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    for (int i = tableRequest.firstRegister; i < tableRequest.firstRegister + tableRequest.registerCount; i++)')
+    writeLine(fileDescriptor, '        processTableRegisterValues(s_registers[i], values.constData());')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+    # Registers without history and change filter only assign the decoded value, all others keep their own handling
+    writeLine(fileDescriptor, 'void %s::processTableRegisterValues(const ModbusRegisterTable::Register &tableRegister, const quint16 *values)' % className)
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    switch (tableRegister.request) {')
+    for request in registerTable['requests']:
+        if request['type'] != 'register' or not request['registers']:
+            continue
+
+        registerDefinition = request['registers'][0]
+        propertyName = registerDefinition['id']
+        if 'history' in registerDefinition or hasChangeFilter(registerDefinition):
+            buffer = io.StringIO()
+            writeLine(buffer, '    %s received%s = %s;' % (getCppDataType(registerDefinition), request['name'], getTableValueConversionMethod(registerDefinition)))
+            writePropertyReceivedValue(buffer, registerDefinition, changedRegisterIds)
+            writeLine(fileDescriptor, '    case TableRequest%s: {' % request['name'])
+            for line in buffer.getvalue().rstrip('\n').split('\n'):
+                writeLine(fileDescriptor, '    ' + line if line else '')
+            writeLine(fileDescriptor, '        break;')
+            writeLine(fileDescriptor, '    }')
+            continue
+
+        applyValue = 'applyTableValue(m_%s, %s, &%s::%sReadFinished, &%s::%sChanged)' % (propertyName, getTableValueConversionMethod(registerDefinition), className, propertyName, className, propertyName)
+        writeLine(fileDescriptor, '    case TableRequest%s:' % request['name'])
+        if propertyName in changedRegisterIds:
+            writeLine(fileDescriptor, '        if (%s && !m_changedRegisters.contains(Register%s))' % (applyValue, request['name']))
+            writeLine(fileDescriptor, '            m_changedRegisters.append(Register%s);' % request['name'])
+        else:
+            writeLine(fileDescriptor, '        %s;' % applyValue)
+        writeLine(fileDescriptor, '        break;')
+
+    writeLine(fileDescriptor, '    default:')
+    writeLine(fileDescriptor, '        break;')
+    writeLine(fileDescriptor, '    }')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+
+def writeTableEnqueueMethodImplementations(fileDescriptor, className):
+    writeLine(fileDescriptor, 'void %s::enqueueInitRequest(int request)' % (className))
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    if (m_initRequestQueue.contains(request))')
+    writeLine(fileDescriptor, '        return;')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    m_initRequestQueue.enqueue(request);')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, 'void %s::enqueueRequest(int request)' % (className))
+    writeLine(fileDescriptor, '{')
+    writeLine(fileDescriptor, '    if (m_updateRequestQueue.contains(request))')
+    writeLine(fileDescriptor, '        return;')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '    m_updateRequestQueue.enqueue(request);')
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
 
 
 def writeSendNextQueuedInitRequestMethodImplementation(fileDescriptor, className):
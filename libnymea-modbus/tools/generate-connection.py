@@ -31,6 +31,7 @@ import logging
 from connectiontool.toolcommon import * 
 from connectiontool.modbusrtu import * 
 from connectiontool.modbustcp import * 
+from connectiontool.modbussimulator import *
 
 def writeTcpHeaderFile():
     logger.info('Writing modbus TCP header file %s' % headerFilePath)
@@ -40,10 +41,27 @@ def writeTcpHeaderFile():
     writeLine(headerFile, '#ifndef %s_H' % className.upper())
     writeLine(headerFile, '#define %s_H' % className.upper())
     writeLine(headerFile)
+    writeLine(headerFile, '#include <QHash>')
     writeLine(headerFile, '#include <QObject>')
+    if hasUpdateIntervals(updateItems) or hasMinEmitIntervals(registerJson):
+        writeLine(headerFile, '#include <QElapsedTimer>')
+    if snapshot:
+        writeLine(headerFile, '#include <QDateTime>')
+        writeLine(headerFile)
+        writeLine(headerFile, '#include <memory>')
     writeLine(headerFile)
     writeLine(headerFile, '#include <modbusdatautils.h>')
+    writeLine(headerFile, '#include <modbusreachabilitymonitor.h>')
+    if getHistoryRegisters(registerJson):
+        writeLine(headerFile, '#include <modbusregisterhistory.h>')
+    if tableDriven:
+        writeLine(headerFile, '#include <modbusregistertable.h>')
+    if requestPacer:
+        writeLine(headerFile, '#include <modbusrequestpacer.h>')
     writeLine(headerFile, '#include <modbustcpmaster.h>')
+    writeLine(headerFile, '#include <modbustcpmasterregistry.h>')
+    if writeTransactions:
+        writeLine(headerFile, '#include <modbuswritetransaction.h>')
     writeLine(headerFile)
 
     # Begin of class
@@ -62,7 +80,10 @@ def writeTcpHeaderFile():
         for enumDefinition in registerJson['enums']:
             writeEnumDefinition(headerFile, enumDefinition)
 
-    if queuedRequests:
+    if tableDriven:
+        writeTableRequestEnum(headerFile, registerTable)
+
+    if queuedRequests and not tableDriven:
         writeLine(headerFile, '    typedef void(%s::*Function)(void);' % className)
         writeLine(headerFile)
 
@@ -74,6 +95,11 @@ def writeTcpHeaderFile():
     writeLine(headerFile, '    ModbusTcpMaster *modbusTcpMaster() const;')
     writeLine(headerFile, '    quint16 slaveId() const;')
     writeLine(headerFile)
+    writeLine(headerFile, '    ModbusStatistics statistics() const;')
+    writeLine(headerFile)
+    if requestPacer:
+        writeLine(headerFile, '    ModbusRequestPacer *requestPacer();')
+        writeLine(headerFile)
     writeLine(headerFile, '    bool reachable() const;')
     writeLine(headerFile, '    bool initializing() const;')
     writeLine(headerFile)
@@ -93,30 +119,47 @@ def writeTcpHeaderFile():
     writeLine(headerFile, '    void setCheckReachableRetries(uint checkReachableRetries);')
     writeLine(headerFile)
 
+    writeSubscriptionMethodDeclarations(headerFile)
+    writeHistoryMethodDeclarations(headerFile, registerJson)
+    if writeTransactions:
+        writeWriteTransactionMethodDeclarations(headerFile)
+
+    if snapshot:
+        writeSnapshotDefinition(headerFile, registerJson)
+
     # Write registers get method declarations
     writePropertyGetSetMethodDeclarationsTcp(headerFile, registerJson['registers'])
     if 'blocks' in registerJson:
         for blockDefinition in registerJson['blocks']:
             writePropertyGetSetMethodDeclarationsTcp(headerFile, blockDefinition['registers'])
 
+    if tableDriven:
+        # Registers and blocks get read and updated using their table request
+        writeTableRequestMethodDeclarations(headerFile, 'QModbusReply')
+    else:
         # Write block get/set method declarations
-        writeBlocksUpdateMethodDeclarations(headerFile, registerJson['blocks'])
+        if 'blocks' in registerJson:
+            writeBlocksUpdateMethodDeclarations(headerFile, registerJson['blocks'])
 
-    writePropertyUpdateMethodDeclarations(headerFile, registerJson['registers'])
-    writeLine(headerFile)
-    if 'blocks' in registerJson:
-        for blockDefinition in registerJson['blocks']:
-            writePropertyUpdateMethodDeclarations(headerFile, blockDefinition['registers'])
+        writePropertyUpdateMethodDeclarations(headerFile, registerJson['registers'])
+        writeLine(headerFile)
+        if 'blocks' in registerJson:
+            for blockDefinition in registerJson['blocks']:
+                writePropertyUpdateMethodDeclarations(headerFile, blockDefinition['registers'])
 
-    writeLine(headerFile)
+        writeLine(headerFile)
 
-    writeInternalPropertyReadMethodDeclarationsTcp(headerFile, registerJson['registers'])
-    if 'blocks' in registerJson:
-        for blockDefinition in registerJson['blocks']:
-            writeInternalPropertyReadMethodDeclarationsTcp(headerFile, blockDefinition['registers'])
+        writeInternalPropertyReadMethodDeclarationsTcp(headerFile, registerJson['registers'])
+        if 'blocks' in registerJson:
+            for blockDefinition in registerJson['blocks']:
+                writeInternalPropertyReadMethodDeclarationsTcp(headerFile, blockDefinition['registers'])
+
+            writeLine(headerFile)
+            writeInternalBlockReadMethodDeclarationsTcp(headerFile, registerJson['blocks'])
 
+    if readPlan and not tableDriven:
         writeLine(headerFile)
-        writeInternalBlockReadMethodDeclarationsTcp(headerFile, registerJson['blocks'])
+        writeReadPlanMethodDeclarationsTcp(headerFile, readPlan, queuedRequests)
 
     writeLine(headerFile)
 
@@ -134,6 +177,8 @@ def writeTcpHeaderFile():
     writeLine(headerFile)
     writeLine(headerFile, '    void initializationFinished(bool success);')
     writeLine(headerFile, '    void updateFinished();')
+    if valuesChangedSignal:
+        writeLine(headerFile, '    void valuesChanged(const QVector<Registers> &registers);')
     writeLine(headerFile)
     writeLine(headerFile, '    void endiannessChanged(ModbusDataUtils::ByteOrder endianness);')
     writeLine(headerFile, '    void stringEndiannessChanged(ModbusDataUtils::ByteOrder stringEndianness);')
@@ -156,10 +201,13 @@ def writeTcpHeaderFile():
 
         writeLine(headerFile)
 
-    writePropertyProcessMethodDeclaration(headerFile, registerJson['registers'])
-    if 'blocks' in registerJson:
-        for blockDefinition in registerJson['blocks']:
-            writePropertyProcessMethodDeclaration(headerFile, blockDefinition['registers'])
+    if tableDriven:
+        writeTableMethodDeclarations(headerFile, 'QModbusReply', queuedRequests)
+    else:
+        writePropertyProcessMethodDeclaration(headerFile, registerJson['registers'])
+        if 'blocks' in registerJson:
+            for blockDefinition in registerJson['blocks']:
+                writePropertyProcessMethodDeclaration(headerFile, blockDefinition['registers'])
 
     writeLine(headerFile, '    void handleModbusError(QModbusDevice::Error error);')
     writeLine(headerFile, '    void testReachability();')
@@ -173,10 +221,13 @@ def writeTcpHeaderFile():
     writeLine(headerFile)
 
     if queuedRequests:
+        queueType = 'int' if tableDriven else '%s::Function' % className
         writeLine(headerFile, '    QModbusReply *m_currentInitReply = nullptr;')
-        writeLine(headerFile, '    QQueue<%s::Function> m_initRequestQueue;' % className)
+        writeLine(headerFile, '    QQueue<%s> m_initRequestQueue;' % queueType)
         writeLine(headerFile, '    QModbusReply *m_currentUpdateReply = nullptr;')
-        writeLine(headerFile, '    QQueue<%s::Function> m_updateRequestQueue;' % className)
+        writeLine(headerFile, '    QQueue<%s> m_updateRequestQueue;' % queueType)
+        if requestPacer:
+            writeLine(headerFile, '    ModbusRequestPacer m_requestPacer = ModbusRequestPacer(%s, %s);' % (requestRate, requestBurst))
         writeLine(headerFile)
 
     writeLine(headerFile, '    bool m_reachable = false;')
@@ -184,13 +235,22 @@ def writeTcpHeaderFile():
     writeLine(headerFile, '    QModbusReply *m_checkRechableReply = nullptr;')
     writeLine(headerFile, '    uint m_checkReachableRetries = 0;')
     writeLine(headerFile, '    uint m_checkReachableRetriesCount = 0;')
-    writeLine(headerFile, '    bool m_communicationWorking = false;')
-    writeLine(headerFile, '    quint8 m_communicationFailedMax = %s;' % (errorLimitUntilNotReachable))
-    writeLine(headerFile, '    quint8 m_communicationFailedCounter = 0;')
+    writeLine(headerFile, '    ModbusReachabilityMonitor m_reachabilityMonitor = ModbusReachabilityMonitor(%s, %s, %s);' % (errorLimitUntilNotReachable, errorWindow, probeIdleTime))
     writeLine(headerFile)
     writeLine(headerFile, '    QVector<QModbusReply *> m_pendingInitReplies;')
     writeLine(headerFile, '    QVector<QModbusReply *> m_pendingUpdateReplies;')
     writeLine(headerFile)
+    if tableDriven:
+        writeTableUpdateIntervalMembers(headerFile, registerTable, updateItems)
+    else:
+        writeUpdateIntervalMembers(headerFile, updateItems)
+    writeChangeNotificationMembers(headerFile, registerJson, valuesChangedSignal)
+    writeSubscriptionMembers(headerFile, tableDriven)
+    if snapshot:
+        writeSnapshotMembers(headerFile)
+    if writeTransactions:
+        writeLine(headerFile, '    ModbusWriteTransaction m_writeTransaction;')
+        writeLine(headerFile)
     writeLine(headerFile, '    QObject *m_initObject = nullptr;')
     writeLine(headerFile, '    bool verifyInitFinished();')
     writeLine(headerFile, '    void finishInitialization(bool success);')
@@ -206,9 +266,15 @@ def writeTcpHeaderFile():
     if queuedRequests:
         writeLine(headerFile)
         writeLine(headerFile, '    void sendNextQueuedInitRequest();')
-        writeLine(headerFile, '    void enqueueInitRequest(%s::Function function);' % (className))
+        if tableDriven:
+            writeLine(headerFile, '    void enqueueInitRequest(int request);')
+        else:
+            writeLine(headerFile, '    void enqueueInitRequest(%s::Function function);' % (className))
         writeLine(headerFile, '    void sendNextQueuedRequest();')
-        writeLine(headerFile, '    void enqueueRequest(%s::Function function);' % (className))
+        if tableDriven:
+            writeLine(headerFile, '    void enqueueRequest(int request);')
+        else:
+            writeLine(headerFile, '    void enqueueRequest(%s::Function function);' % (className))
 
     # End of class
     writeLine(headerFile)
@@ -236,6 +302,8 @@ def writeTcpSourceFile():
     writeLine(sourceFile)
     writeLine(sourceFile, 'NYMEA_LOGGING_CATEGORY(dc%s, "%s")' % (className, className))
     writeLine(sourceFile)
+    if tableDriven:
+        writeRegisterTable(sourceFile, className, registerTable)
 
     # Constructor
     writeLine(sourceFile, '%s::%s(const QHostAddress &hostAddress, uint port, quint16 slaveId, QObject *parent) :' % (className, className))
@@ -268,6 +336,19 @@ def writeTcpSourceFile():
     writeLine(sourceFile, '}')
     writeLine(sourceFile)
 
+    writeLine(sourceFile, 'ModbusStatistics %s::statistics() const' % (className))
+    writeLine(sourceFile, '{')
+    writeLine(sourceFile, '    return m_modbusTcpMaster->statistics(m_slaveId);')
+    writeLine(sourceFile, '}')
+    writeLine(sourceFile)
+
+    if requestPacer:
+        writeLine(sourceFile, 'ModbusRequestPacer *%s::requestPacer()' % (className))
+        writeLine(sourceFile, '{')
+        writeLine(sourceFile, '    return &m_requestPacer;')
+        writeLine(sourceFile, '}')
+        writeLine(sourceFile)
+
     writeLine(sourceFile, 'bool %s::reachable() const' % (className))
     writeLine(sourceFile, '{')
     writeLine(sourceFile, '    return m_reachable;')
@@ -296,6 +377,14 @@ def writeTcpSourceFile():
     writeLine(sourceFile, '}')
     writeLine(sourceFile)
 
+    writeSubscriptionMethodImplementations(sourceFile, className, updateItems, tableDriven)
+    writeHistoryMethodImplementations(sourceFile, className, registerJson)
+    if writeTransactions:
+        writeWriteTransactionMethodImplementations(sourceFile, className, 'm_modbusTcpMaster')
+
+    if snapshot:
+        writeSnapshotMethodImplementations(sourceFile, className, registerJson)
+
     writeLine(sourceFile, 'ModbusDataUtils::ByteOrder %s::endianness() const' % (className))
     writeLine(sourceFile, '{')
     writeLine(sourceFile, '    return m_endianness;')
@@ -329,18 +418,22 @@ def writeTcpSourceFile():
     writeLine(sourceFile)
 
     # Property get methods
-    writePropertyGetSetMethodImplementationsTcp(sourceFile, className, registerJson['registers'])
+    writePropertyGetSetMethodImplementationsTcp(sourceFile, className, registerJson['registers'], registerJson, readWriteMultipleRegisters, writeTransactions, tableDriven)
     if 'blocks' in registerJson:
         for blockDefinition in registerJson['blocks']:
-            writePropertyGetSetMethodImplementationsTcp(sourceFile, className, blockDefinition['registers'])
+            writePropertyGetSetMethodImplementationsTcp(sourceFile, className, blockDefinition['registers'], registerJson, readWriteMultipleRegisters, writeTransactions, tableDriven)
 
     # Write init and update method implementation
     blocks = []
     if 'blocks' in registerJson:
         blocks = registerJson['blocks']
 
-    writeInitMethodImplementationTcp(sourceFile, className, registerJson['registers'], blocks, queuedRequests)
-    writeUpdateMethodTcp(sourceFile, className, registerJson['registers'], blocks, queuedRequests)
+    if tableDriven:
+        writeInitMethodImplementationTableTcp(sourceFile, className, registerTable, queuedRequests)
+        writeUpdateMethodTableTcp(sourceFile, className, registerTable, updateItems, queuedRequests, valuesChangedSignal, snapshot)
+    else:
+        writeInitMethodImplementationTcp(sourceFile, className, registerJson['registers'], blocks, queuedRequests)
+        writeUpdateMethodTcp(sourceFile, className, updateItems, queuedRequests, valuesChangedSignal, snapshot)
 
     writeLine(sourceFile, 'bool %s::connectDevice()' % (className))
     writeLine(sourceFile, '{')
@@ -348,63 +441,86 @@ def writeTcpSourceFile():
     writeLine(sourceFile, '}')
     writeLine(sourceFile)
 
+    # The socket of a shared master is used by other units too, it gets closed by the registry once released by everybody
     writeLine(sourceFile, 'void %s::disconnectDevice()' % (className))
     writeLine(sourceFile, '{')
+    writeLine(sourceFile, '    if (ModbusTcpMasterRegistry::referenceCount(m_modbusTcpMaster) > 1) {')
+    writeLine(sourceFile, '        qCDebug(dc%s()) << "Not disconnecting" << m_modbusTcpMaster->connectionUrl() << "since the connection is shared with other units.";' % (className))
+    writeLine(sourceFile, '        return;')
+    writeLine(sourceFile, '    }')
+    writeLine(sourceFile)
     writeLine(sourceFile, '    m_modbusTcpMaster->disconnectDevice();')
     writeLine(sourceFile, '}')
     writeLine(sourceFile)
 
     writeLine(sourceFile, 'bool %s::reconnectDevice()' % (className))
     writeLine(sourceFile, '{')
+    writeLine(sourceFile, '    if (ModbusTcpMasterRegistry::referenceCount(m_modbusTcpMaster) > 1) {')
+    writeLine(sourceFile, '        qCDebug(dc%s()) << "Not reconnecting" << m_modbusTcpMaster->connectionUrl() << "since the connection is shared with other units.";' % (className))
+    writeLine(sourceFile, '        return false;')
+    writeLine(sourceFile, '    }')
+    writeLine(sourceFile)
     writeLine(sourceFile, '    return m_modbusTcpMaster->reconnectDevice();')
     writeLine(sourceFile, '}')
     writeLine(sourceFile)
 
-    # Write update methods
-    writePropertyUpdateMethodImplementationsTcp(sourceFile, className, registerJson['registers'], queuedRequests, queuedRequestsDelay)
-    if 'blocks' in registerJson:
-        for blockDefinition in registerJson['blocks']:
-            writePropertyUpdateMethodImplementationsTcp(sourceFile, className, blockDefinition['registers'], queuedRequests, queuedRequestsDelay)
+    # The request pacer replaces the fixed delay between queued requests
+    requestDelay = queuedRequestsDelay
+    if requestPacer:
+        requestDelay = 'm_requestPacer.nextDelay()'
 
-        # Write block update method
-        writeBlockUpdateMethodImplementationsTcp(sourceFile, className, registerJson['blocks'], queuedRequests, queuedRequestsDelay)
+    if tableDriven:
+        # Write update and read methods using the register table
+        writeTableReadMethodImplementations(sourceFile, className, 'QModbusReply', 'm_modbusTcpMaster')
+        writeTableRequestMethodImplementationsTcp(sourceFile, className, queuedRequests, requestDelay, requestPacer, hasUpdateIntervals(updateItems))
+        writeTableProcessMethodImplementations(sourceFile, className, registerTable, changedRegisterIds)
+    else:
+        # Write update methods
+        writePropertyUpdateMethodImplementationsTcp(sourceFile, className, registerJson['registers'], queuedRequests, requestDelay, requestPacer, updateItems)
+        if 'blocks' in registerJson:
+            for blockDefinition in registerJson['blocks']:
+                writePropertyUpdateMethodImplementationsTcp(sourceFile, className, blockDefinition['registers'], queuedRequests, requestDelay, requestPacer)
 
-    # Write internal protected property read method implementations
-    writeInternalPropertyReadMethodImplementationsTcp(sourceFile, className, registerJson['registers'])
-    if 'blocks' in registerJson:
-        for blockDefinition in registerJson['blocks']:
-            writeInternalPropertyReadMethodImplementationsTcp(sourceFile, className, blockDefinition['registers'])
+            # Write block update method
+            writeBlockUpdateMethodImplementationsTcp(sourceFile, className, registerJson['blocks'], queuedRequests, requestDelay, requestPacer, updateItems)
 
-        writeInternalBlockReadMethodImplementationsTcp(sourceFile, className, registerJson['blocks'])
+        # Write merged registers update methods
+        if queuedRequests:
+            writeReadPlanUpdateMethodImplementationsTcp(sourceFile, className, readPlan, requestDelay, requestPacer, updateItems)
 
-    # Write internal processors of properties
-    writePropertyProcessMethodImplementations(sourceFile, className, registerJson['registers'])
-    if 'blocks' in registerJson:
-        for blockDefinition in registerJson['blocks']:
-            writePropertyProcessMethodImplementations(sourceFile, className, blockDefinition['registers'])
+        # Write internal protected property read method implementations
+        writeInternalPropertyReadMethodImplementationsTcp(sourceFile, className, registerJson['registers'])
+        if 'blocks' in registerJson:
+            for blockDefinition in registerJson['blocks']:
+                writeInternalPropertyReadMethodImplementationsTcp(sourceFile, className, blockDefinition['registers'])
+
+            writeInternalBlockReadMethodImplementationsTcp(sourceFile, className, registerJson['blocks'])
+
+        writeReadPlanReadMethodImplementationsTcp(sourceFile, className, readPlan)
+
+        # Write internal processors of properties
+        writePropertyProcessMethodImplementations(sourceFile, className, registerJson['registers'], changedRegisterIds)
+        if 'blocks' in registerJson:
+            for blockDefinition in registerJson['blocks']:
+                writePropertyProcessMethodImplementations(sourceFile, className, blockDefinition['registers'], changedRegisterIds)
 
     writeLine(sourceFile, 'void %s::handleModbusError(QModbusDevice::Error error)' % (className))
     writeLine(sourceFile, '{')
-    writeLine(sourceFile, '    if (error == QModbusDevice::NoError) {')
-    writeLine(sourceFile, '        // Reset the communication counter and we know we can reach the device')
-    writeLine(sourceFile, '        m_communicationFailedCounter = 0;')
-    writeLine(sourceFile, '        if (!m_communicationWorking)')
-    writeLine(sourceFile, '            qCDebug(dc%s()) << "Received a reply without any errors. The communication with the device seems to work now.";' % (className))
+    writeLine(sourceFile, '    // Each reply of the regular traffic counts for the reachability, no dedicated requests required')
+    writeLine(sourceFile, '    if (!m_reachabilityMonitor.addReply(error == QModbusDevice::NoError))')
+    writeLine(sourceFile, '        return;')
     writeLine(sourceFile)
-    writeLine(sourceFile, '        m_communicationWorking = true;')
-    writeLine(sourceFile, '        evaluateReachableState();')
+    writeLine(sourceFile, '    if (m_reachabilityMonitor.communicationWorking()) {')
+    writeLine(sourceFile, '        qCDebug(dc%s()) << "Received a reply without any errors. The communication with the device seems to work now.";' % (className))
     writeLine(sourceFile, '    } else {')
-    writeLine(sourceFile, '        m_communicationFailedCounter++;')
-    writeLine(sourceFile, '        if (m_communicationWorking && m_communicationFailedCounter >= m_communicationFailedMax) {')
-    writeLine(sourceFile, '            m_communicationWorking = false;')
-    writeLine(sourceFile, '            qCWarning(dc%s()) << "Received" << m_communicationFailedCounter << "errors while communicating with the TCP master. Mark as not reachable until the communication works again.";' % (className))
-    writeLine(sourceFile, '            evaluateReachableState();')
-    writeLine(sourceFile, '        }')
+    writeLine(sourceFile, '        qCWarning(dc%s()) << "Received" << m_reachabilityMonitor.errorCount() << "errors within the last" << m_reachabilityMonitor.errorWindow() << "replies while communicating with the TCP master. Mark as not reachable until the communication works again.";' % (className))
     writeLine(sourceFile, '    }')
+    writeLine(sourceFile)
+    writeLine(sourceFile, '    evaluateReachableState();')
     writeLine(sourceFile, '}')
     writeLine(sourceFile)
 
-    writeTestReachabilityImplementationsTcp(sourceFile, className, registerJson['registers'], checkReachableRegister)
+    writeTestReachabilityImplementationsTcp(sourceFile, className, registerJson['registers'], checkReachableRegister, tableDriven)
 
     writeLine(sourceFile, 'bool %s::verifyInitFinished()' % (className))
     writeLine(sourceFile, '{')
@@ -459,14 +575,12 @@ def writeTcpSourceFile():
         writeLine(sourceFile, '            m_updateRequestQueue.clear();')
         writeLine(sourceFile, '            m_initRequestQueue.clear();')
 
-    writeLine(sourceFile, '            m_communicationWorking = false;')
-    writeLine(sourceFile, '            m_communicationFailedCounter = 0;')
+    writeLine(sourceFile, '            m_reachabilityMonitor.reset();')
     writeLine(sourceFile, '            m_checkReachableRetriesCount = 0;')
     writeLine(sourceFile, '            testReachability();')
     writeLine(sourceFile, '        } else {')
     writeLine(sourceFile, '            qCWarning(dc%s()) << "Modbus TCP connection diconnected from" << m_modbusTcpMaster->hostAddress().toString() << ". The connection is not reachable any more.";' % (className))
-    writeLine(sourceFile, '            m_communicationWorking = false;')
-    writeLine(sourceFile, '            m_communicationFailedCounter = 0;')
+    writeLine(sourceFile, '            m_reachabilityMonitor.reset();')
     writeLine(sourceFile, '            m_checkReachableRetriesCount = 0;')
     writeLine(sourceFile, '            m_initializing = false;')
 
@@ -485,11 +599,11 @@ def writeTcpSourceFile():
     writeLine(sourceFile, '{')
     if queuedRequests:
         writeLine(sourceFile, '    if (m_updateRequestQueue.isEmpty() && !m_currentUpdateReply) {')
-        writeLine(sourceFile, '        emit updateFinished();')
+        writeEmitUpdateFinished(sourceFile, valuesChangedSignal, '        ', snapshot)
         writeLine(sourceFile, '        return true;')
     else:
         writeLine(sourceFile, '    if (m_pendingUpdateReplies.isEmpty()) {')
-        writeLine(sourceFile, '        emit updateFinished();')
+        writeEmitUpdateFinished(sourceFile, valuesChangedSignal, '        ', snapshot)
         writeLine(sourceFile, '        return true;')
     writeLine(sourceFile, '    }')
     writeLine(sourceFile, '    return false;')
@@ -513,7 +627,7 @@ def writeTcpSourceFile():
 
     writeLine(sourceFile, 'void %s::evaluateReachableState()' % (className))
     writeLine(sourceFile, '{')
-    writeLine(sourceFile, '    bool reachable = m_communicationWorking && m_modbusTcpMaster->connected();')
+    writeLine(sourceFile, '    bool reachable = m_reachabilityMonitor.communicationWorking() && m_modbusTcpMaster->connected();')
     writeLine(sourceFile, '    if (m_reachable == reachable)')
     writeLine(sourceFile, '        return;')
     writeLine(sourceFile)
@@ -523,7 +637,7 @@ def writeTcpSourceFile():
     writeLine(sourceFile, '}')
     writeLine(sourceFile)
 
-    if queuedRequests:
+    if queuedRequests and not tableDriven:
         writeSendNextQueuedInitRequestMethodImplementation(sourceFile, className)
         writeEnqueueInitRequestMethodImplementation(sourceFile, className)
         writeSendNextQueuedRequestMethodImplementation(sourceFile, className)
@@ -555,9 +669,24 @@ def writeRtuHeaderFile():
     writeLine(headerFile, '#ifndef %s_H' % className.upper())
     writeLine(headerFile, '#define %s_H' % className.upper())
     writeLine(headerFile)
+    writeLine(headerFile, '#include <QHash>')
     writeLine(headerFile, '#include <QObject>')
+    if hasUpdateIntervals(updateItems) or hasMinEmitIntervals(registerJson):
+        writeLine(headerFile, '#include <QElapsedTimer>')
+    if snapshot:
+        writeLine(headerFile, '#include <QDateTime>')
+        writeLine(headerFile)
+        writeLine(headerFile, '#include <memory>')
     writeLine(headerFile)
     writeLine(headerFile, '#include <modbusdatautils.h>')
+    writeLine(headerFile, '#include <modbusreachabilitymonitor.h>')
+    if getHistoryRegisters(registerJson):
+        writeLine(headerFile, '#include <modbusregisterhistory.h>')
+    if tableDriven:
+        writeLine(headerFile, '#include <modbusregistertable.h>')
+    writeLine(headerFile, '#include <modbusrtubusscheduler.h>')
+    if writeTransactions:
+        writeLine(headerFile, '#include <modbuswritetransaction.h>')
     writeLine(headerFile, '#include <hardware/modbus/modbusrtumaster.h>')
 
     writeLine(headerFile)
@@ -578,11 +707,15 @@ def writeRtuHeaderFile():
         for enumDefinition in registerJson['enums']:
             writeEnumDefinition(headerFile, enumDefinition)
 
+    if tableDriven:
+        writeTableRequestEnum(headerFile, registerTable)
+
     # Constructor
     writeLine(headerFile, '    explicit %s(ModbusRtuMaster *modbusRtuMaster, quint16 slaveId, QObject *parent = nullptr);' % className)
     writeLine(headerFile, '    ~%s() = default;' % className)
     writeLine(headerFile)
     writeLine(headerFile, '    ModbusRtuMaster *modbusRtuMaster() const;')
+    writeLine(headerFile, '    ModbusRtuBusScheduler *busScheduler() const;')
     writeLine(headerFile, '    quint16 slaveId() const;')
     writeLine(headerFile)
     writeLine(headerFile, '    bool reachable() const;')
@@ -590,6 +723,14 @@ def writeRtuHeaderFile():
     writeLine(headerFile, '    uint checkReachableRetries() const;')
     writeLine(headerFile, '    void setCheckReachableRetries(uint checkReachableRetries);')
     writeLine(headerFile)
+
+    writeSubscriptionMethodDeclarations(headerFile)
+    writeHistoryMethodDeclarations(headerFile, registerJson)
+    if writeTransactions:
+        writeWriteTransactionMethodDeclarations(headerFile)
+
+    if snapshot:
+        writeSnapshotDefinition(headerFile, registerJson)
     writeLine(headerFile, '    ModbusDataUtils::ByteOrder endianness() const;')
     writeLine(headerFile, '    void setEndianness(ModbusDataUtils::ByteOrder endianness);')
     writeLine(headerFile)
@@ -603,24 +744,33 @@ def writeRtuHeaderFile():
         for blockDefinition in registerJson['blocks']:
             writePropertyGetSetMethodDeclarationsRtu(headerFile, blockDefinition['registers'])
 
+    if tableDriven:
+        # Registers and blocks get read and updated using their table request
+        writeTableRequestMethodDeclarations(headerFile, 'ModbusRtuReply')
+    else:
         # Write block get/set method declarations
-        writeBlocksUpdateMethodDeclarations(headerFile, registerJson['blocks'])
+        if 'blocks' in registerJson:
+            writeBlocksUpdateMethodDeclarations(headerFile, registerJson['blocks'])
 
-    writePropertyUpdateMethodDeclarations(headerFile, registerJson['registers'])
-    writeLine(headerFile)
-    if 'blocks' in registerJson:
-        for blockDefinition in registerJson['blocks']:
-            writePropertyUpdateMethodDeclarations(headerFile, blockDefinition['registers'])
+        writePropertyUpdateMethodDeclarations(headerFile, registerJson['registers'])
+        writeLine(headerFile)
+        if 'blocks' in registerJson:
+            for blockDefinition in registerJson['blocks']:
+                writePropertyUpdateMethodDeclarations(headerFile, blockDefinition['registers'])
 
-    writeLine(headerFile)
+        writeLine(headerFile)
 
-    writeInternalPropertyReadMethodDeclarationsRtu(headerFile, registerJson['registers'])
-    if 'blocks' in registerJson:
-        for blockDefinition in registerJson['blocks']:
-            writeInternalPropertyReadMethodDeclarationsRtu(headerFile, blockDefinition['registers'])
+        writeInternalPropertyReadMethodDeclarationsRtu(headerFile, registerJson['registers'])
+        if 'blocks' in registerJson:
+            for blockDefinition in registerJson['blocks']:
+                writeInternalPropertyReadMethodDeclarationsRtu(headerFile, blockDefinition['registers'])
+
+            writeLine(headerFile)
+            writeInternalBlockReadMethodDeclarationsRtu(headerFile, registerJson['blocks'])
 
+    if readPlan and not tableDriven:
         writeLine(headerFile)
-        writeInternalBlockReadMethodDeclarationsRtu(headerFile, registerJson['blocks'])
+        writeReadPlanMethodDeclarationsRtu(headerFile, readPlan)
 
     # Write init and update method declarations
     writeLine(headerFile, '    virtual bool initialize();')
@@ -635,6 +785,8 @@ def writeRtuHeaderFile():
     writeLine(headerFile)
     writeLine(headerFile, '    void initializationFinished(bool success);')
     writeLine(headerFile, '    void updateFinished();')
+    if valuesChangedSignal:
+        writeLine(headerFile, '    void valuesChanged(const QVector<Registers> &registers);')
     writeLine(headerFile)
     writeLine(headerFile, '    void endiannessChanged(ModbusDataUtils::ByteOrder endianness);')
     writeLine(headerFile, '    void stringEndiannessChanged(ModbusDataUtils::ByteOrder stringEndianness);')
@@ -655,12 +807,15 @@ def writeRtuHeaderFile():
 
     writeLine(headerFile)
 
-    writePropertyProcessMethodDeclaration(headerFile, registerJson['registers'])
-    if 'blocks' in registerJson:
-        for blockDefinition in registerJson['blocks']:
-            writePropertyProcessMethodDeclaration(headerFile, blockDefinition['registers'])
+    if tableDriven:
+        writeTableMethodDeclarations(headerFile, 'ModbusRtuReply', False)
+    else:
+        writePropertyProcessMethodDeclaration(headerFile, registerJson['registers'])
+        if 'blocks' in registerJson:
+            for blockDefinition in registerJson['blocks']:
+                writePropertyProcessMethodDeclaration(headerFile, blockDefinition['registers'])
 
-        writeLine(headerFile)
+            writeLine(headerFile)
 
     writeLine(headerFile, '    void handleModbusError(ModbusRtuReply::Error error);')
     writeLine(headerFile, '    void testReachability();')
@@ -669,6 +824,7 @@ def writeRtuHeaderFile():
     # Private members
     writeLine(headerFile, '    /* Internals */')
     writeLine(headerFile, '    ModbusRtuMaster *m_modbusRtuMaster = nullptr;')
+    writeLine(headerFile, '    ModbusRtuBusScheduler *m_busScheduler = nullptr;')
     writeLine(headerFile, '    ModbusDataUtils::ByteOrder m_endianness = ModbusDataUtils::ByteOrder%s;' % endianness)
     writeLine(headerFile, '    ModbusDataUtils::ByteOrder m_stringEndianness = ModbusDataUtils::ByteOrder%s;' % stringEndianness)
     writeLine(headerFile, '    quint16 m_slaveId = 1;')
@@ -677,13 +833,22 @@ def writeRtuHeaderFile():
     writeLine(headerFile, '    ModbusRtuReply *m_checkRechableReply = nullptr;')
     writeLine(headerFile, '    uint m_checkReachableRetries = 0;')
     writeLine(headerFile, '    uint m_checkReachableRetriesCount = 0;')
-    writeLine(headerFile, '    bool m_communicationWorking = false;')
-    writeLine(headerFile, '    quint8 m_communicationFailedMax = %s;' % (errorLimitUntilNotReachable))
-    writeLine(headerFile, '    quint8 m_communicationFailedCounter = 0;')
+    writeLine(headerFile, '    ModbusReachabilityMonitor m_reachabilityMonitor = ModbusReachabilityMonitor(%s, %s, %s);' % (errorLimitUntilNotReachable, errorWindow, probeIdleTime))
     writeLine(headerFile)
     writeLine(headerFile, '    QVector<ModbusRtuReply *> m_pendingInitReplies;')
     writeLine(headerFile, '    QVector<ModbusRtuReply *> m_pendingUpdateReplies;')
     writeLine(headerFile)
+    if tableDriven:
+        writeTableUpdateIntervalMembers(headerFile, registerTable, updateItems)
+    else:
+        writeUpdateIntervalMembers(headerFile, updateItems)
+    writeChangeNotificationMembers(headerFile, registerJson, valuesChangedSignal)
+    writeSubscriptionMembers(headerFile, tableDriven)
+    if snapshot:
+        writeSnapshotMembers(headerFile)
+    if writeTransactions:
+        writeLine(headerFile, '    ModbusWriteTransaction m_writeTransaction;')
+        writeLine(headerFile)
     writeLine(headerFile, '    QObject *m_initObject = nullptr;')
     writeLine(headerFile, '    void verifyInitFinished();')
     writeLine(headerFile, '    void finishInitialization(bool success);')
@@ -718,11 +883,14 @@ def writeRtuSourceFile():
     writeLine(sourceFile)
     writeLine(sourceFile, 'NYMEA_LOGGING_CATEGORY(dc%s, "%s")' % (className, className))
     writeLine(sourceFile)
+    if tableDriven:
+        writeRegisterTable(sourceFile, className, registerTable)
 
     # Constructor
     writeLine(sourceFile, '%s::%s(ModbusRtuMaster *modbusRtuMaster, quint16 slaveId, QObject *parent) :' % (className, className))
     writeLine(sourceFile, '    QObject(parent),')
     writeLine(sourceFile, '    m_modbusRtuMaster(modbusRtuMaster),')
+    writeLine(sourceFile, '    m_busScheduler(ModbusRtuBusScheduler::instance(modbusRtuMaster)),')
     writeLine(sourceFile, '    m_slaveId(slaveId)')
     writeLine(sourceFile, '{')
     writeLine(sourceFile, '    connect(m_modbusRtuMaster, &ModbusRtuMaster::connectedChanged, this, [=](bool connected){')
@@ -730,14 +898,12 @@ def writeRtuSourceFile():
     writeLine(sourceFile, '            qCDebug(dc%s()) << "Modbus RTU resource" << m_modbusRtuMaster->serialPort() << "connected again. Start testing if the connection is reachable...";' % (className))
     writeLine(sourceFile, '            m_pendingInitReplies.clear();')
     writeLine(sourceFile, '            m_pendingUpdateReplies.clear();')
-    writeLine(sourceFile, '            m_communicationWorking = false;')
-    writeLine(sourceFile, '            m_communicationFailedCounter = 0;')
+    writeLine(sourceFile, '            m_reachabilityMonitor.reset();')
     writeLine(sourceFile, '            m_checkReachableRetriesCount = 0;')
     writeLine(sourceFile, '            testReachability();')
     writeLine(sourceFile, '        } else {')
     writeLine(sourceFile, '            qCWarning(dc%s()) << "Modbus RTU resource" << m_modbusRtuMaster->serialPort() << "disconnected. The connection is not reachable any more.";' % (className))
-    writeLine(sourceFile, '            m_communicationWorking = false;')
-    writeLine(sourceFile, '            m_communicationFailedCounter = 0;')
+    writeLine(sourceFile, '            m_reachabilityMonitor.reset();')
     writeLine(sourceFile, '            m_checkReachableRetriesCount = 0;')
     writeLine(sourceFile, '        }')
     writeLine(sourceFile)
@@ -756,6 +922,12 @@ def writeRtuSourceFile():
     writeLine(sourceFile, '{')
     writeLine(sourceFile, '    return m_modbusRtuMaster;')
     writeLine(sourceFile, '}')
+    writeLine(sourceFile)
+
+    writeLine(sourceFile, 'ModbusRtuBusScheduler *%s::busScheduler() const' % (className))
+    writeLine(sourceFile, '{')
+    writeLine(sourceFile, '    return m_busScheduler;')
+    writeLine(sourceFile, '}')
 
     writeLine(sourceFile, 'quint16 %s::slaveId() const' % (className))
     writeLine(sourceFile, '{')
@@ -785,6 +957,14 @@ def writeRtuSourceFile():
     writeLine(sourceFile, '}')
     writeLine(sourceFile)
 
+    writeSubscriptionMethodImplementations(sourceFile, className, updateItems, tableDriven)
+    writeHistoryMethodImplementations(sourceFile, className, registerJson)
+    if writeTransactions:
+        writeWriteTransactionMethodImplementations(sourceFile, className, 'm_busScheduler')
+
+    if snapshot:
+        writeSnapshotMethodImplementations(sourceFile, className, registerJson)
+
     writeLine(sourceFile, 'ModbusDataUtils::ByteOrder %s::endianness() const' % (className))
     writeLine(sourceFile, '{')
     writeLine(sourceFile, '    return m_endianness;')
@@ -817,65 +997,71 @@ def writeRtuSourceFile():
     writeLine(sourceFile)
 
     # Property get methods
-    writePropertyGetSetMethodImplementationsRtu(sourceFile, className, registerJson['registers'])
+    writePropertyGetSetMethodImplementationsRtu(sourceFile, className, registerJson['registers'], registerJson, writeTransactions, tableDriven)
     if 'blocks' in registerJson:
         for blockDefinition in registerJson['blocks']:
-            writePropertyGetSetMethodImplementationsRtu(sourceFile, className, blockDefinition['registers'])
+            writePropertyGetSetMethodImplementationsRtu(sourceFile, className, blockDefinition['registers'], registerJson, writeTransactions, tableDriven)
 
     # Write init and update method implementation
     blocks = []
     if 'blocks' in registerJson:
         blocks = registerJson['blocks']
 
-    writeInitMethodImplementationRtu(sourceFile, className, registerJson['registers'], blocks)
-    writeUpdateMethodRtu(sourceFile, className, registerJson['registers'], blocks)
+    if tableDriven:
+        writeInitMethodImplementationTableRtu(sourceFile, className, registerTable)
+        writeUpdateMethodTableRtu(sourceFile, className, registerTable, updateItems, valuesChangedSignal, snapshot)
 
-    # Write update methods
-    writePropertyUpdateMethodImplementationsRtu(sourceFile, className, registerJson['registers'])
-    if 'blocks' in registerJson:
-        for blockDefinition in registerJson['blocks']:
-            writePropertyUpdateMethodImplementationsRtu(sourceFile, className, blockDefinition['registers'])
+        # Write update and read methods using the register table
+        writeTableReadMethodImplementations(sourceFile, className, 'ModbusRtuReply', 'm_busScheduler')
+        writeTableRequestMethodImplementationsRtu(sourceFile, className, hasUpdateIntervals(updateItems))
+        writeTableProcessMethodImplementations(sourceFile, className, registerTable, changedRegisterIds)
+    else:
+        writeInitMethodImplementationRtu(sourceFile, className, registerJson['registers'], blocks)
+        writeUpdateMethodRtu(sourceFile, className, updateItems, valuesChangedSignal, snapshot)
 
-        # Write block update method
-        writeBlockUpdateMethodImplementationsRtu(sourceFile, className, registerJson['blocks'])
+        # Write update methods
+        writePropertyUpdateMethodImplementationsRtu(sourceFile, className, registerJson['registers'])
+        if 'blocks' in registerJson:
+            for blockDefinition in registerJson['blocks']:
+                writePropertyUpdateMethodImplementationsRtu(sourceFile, className, blockDefinition['registers'])
 
-    # Write internal protected property read method implementations
-    writeInternalPropertyReadMethodImplementationsRtu(sourceFile, className, registerJson['registers'])
-    if 'blocks' in registerJson:
-        for blockDefinition in registerJson['blocks']:
-            writeInternalPropertyReadMethodImplementationsRtu(sourceFile, className, blockDefinition['registers'])
+            # Write block update method
+            writeBlockUpdateMethodImplementationsRtu(sourceFile, className, registerJson['blocks'])
 
-        writeInternalBlockReadMethodImplementationsRtu(sourceFile, className, registerJson['blocks'])
+        # Write internal protected property read method implementations
+        writeInternalPropertyReadMethodImplementationsRtu(sourceFile, className, registerJson['registers'])
+        if 'blocks' in registerJson:
+            for blockDefinition in registerJson['blocks']:
+                writeInternalPropertyReadMethodImplementationsRtu(sourceFile, className, blockDefinition['registers'])
 
-    # Write internal processors of properties
-    writePropertyProcessMethodImplementations(sourceFile, className, registerJson['registers'])
-    if 'blocks' in registerJson:
-        for blockDefinition in registerJson['blocks']:
-            writePropertyProcessMethodImplementations(sourceFile, className, blockDefinition['registers'])
+            writeInternalBlockReadMethodImplementationsRtu(sourceFile, className, registerJson['blocks'])
+
+        writeReadPlanReadMethodImplementationsRtu(sourceFile, className, readPlan)
+
+        # Write internal processors of properties
+        writePropertyProcessMethodImplementations(sourceFile, className, registerJson['registers'], changedRegisterIds)
+        if 'blocks' in registerJson:
+            for blockDefinition in registerJson['blocks']:
+                writePropertyProcessMethodImplementations(sourceFile, className, blockDefinition['registers'], changedRegisterIds)
 
 
     writeLine(sourceFile, 'void %s::handleModbusError(ModbusRtuReply::Error error)' % (className))
     writeLine(sourceFile, '{')
-    writeLine(sourceFile, '    if (error == ModbusRtuReply::NoError) {')
-    writeLine(sourceFile, '        // Reset the communication counter and we know we can reach the device')
-    writeLine(sourceFile, '        m_communicationFailedCounter = 0;')
-    writeLine(sourceFile, '        if (!m_communicationWorking)')
-    writeLine(sourceFile, '            qCDebug(dc%s()) << "Received a reply without any errors. The communication with the device seems to work now.";' % (className))
+    writeLine(sourceFile, '    // Each reply of the regular traffic counts for the reachability, no dedicated requests required')
+    writeLine(sourceFile, '    if (!m_reachabilityMonitor.addReply(error == ModbusRtuReply::NoError))')
+    writeLine(sourceFile, '        return;')
     writeLine(sourceFile)
-    writeLine(sourceFile, '        m_communicationWorking = true;')
-    writeLine(sourceFile, '        evaluateReachableState();')
+    writeLine(sourceFile, '    if (m_reachabilityMonitor.communicationWorking()) {')
+    writeLine(sourceFile, '        qCDebug(dc%s()) << "Received a reply without any errors. The communication with the device seems to work now.";' % (className))
     writeLine(sourceFile, '    } else {')
-    writeLine(sourceFile, '        m_communicationFailedCounter++;')
-    writeLine(sourceFile, '        if (m_communicationWorking && m_communicationFailedCounter >= m_communicationFailedMax) {')
-    writeLine(sourceFile, '            m_communicationWorking = false;')
-    writeLine(sourceFile, '            qCWarning(dc%s()) << "Received" << m_communicationFailedCounter << "errors while communicating with the RTU master. Mark as not reachable until the communication works again.";' % (className))
-    writeLine(sourceFile, '            evaluateReachableState();')
-    writeLine(sourceFile, '        }')
+    writeLine(sourceFile, '        qCWarning(dc%s()) << "Received" << m_reachabilityMonitor.errorCount() << "errors within the last" << m_reachabilityMonitor.errorWindow() << "replies while communicating with the RTU master. Mark as not reachable until the communication works again.";' % (className))
     writeLine(sourceFile, '    }')
+    writeLine(sourceFile)
+    writeLine(sourceFile, '    evaluateReachableState();')
     writeLine(sourceFile, '}')
     writeLine(sourceFile)
 
-    writeTestReachabilityImplementationsRtu(sourceFile, className, registerJson['registers'], checkReachableRegister)
+    writeTestReachabilityImplementationsRtu(sourceFile, className, registerJson['registers'], checkReachableRegister, tableDriven)
 
     writeLine(sourceFile, 'void %s::verifyInitFinished()' % (className))
     writeLine(sourceFile, '{')
@@ -914,7 +1100,7 @@ def writeRtuSourceFile():
     writeLine(sourceFile, 'bool %s::verifyUpdateFinished()' % (className))
     writeLine(sourceFile, '{')
     writeLine(sourceFile, '    if (m_pendingUpdateReplies.isEmpty()) {')
-    writeLine(sourceFile, '        emit updateFinished();')
+    writeEmitUpdateFinished(sourceFile, valuesChangedSignal, '        ', snapshot)
     writeLine(sourceFile, '        return true;')
     writeLine(sourceFile, '    }')
     writeLine(sourceFile, '    return false;')
@@ -938,7 +1124,7 @@ def writeRtuSourceFile():
 
     writeLine(sourceFile, 'void %s::evaluateReachableState()' % (className))
     writeLine(sourceFile, '{')
-    writeLine(sourceFile, '    bool reachable = m_communicationWorking && m_modbusRtuMaster->connected();')
+    writeLine(sourceFile, '    bool reachable = m_reachabilityMonitor.communicationWorking() && m_modbusRtuMaster->connected();')
     writeLine(sourceFile, '    if (m_reachable == reachable)')
     writeLine(sourceFile, '        return;')
     writeLine(sourceFile)
@@ -980,6 +1166,7 @@ logger.addHandler(ch)
 parser = argparse.ArgumentParser(description='Generate modbus tcp connection class from JSON register definitions file.')
 parser.add_argument('-j', '--json', metavar='<file>', help='The JSON file containing the register definitions.')
 parser.add_argument('-o', '--output-directory', metavar='<directory>', help='The output directory for the resulting class.')
+parser.add_argument('-s', '--simulator', dest='simulator', action='store_true', help='Additionally generate simulated device classes serving the registers.')
 parser.add_argument('-v', '--verbose', dest='verboseOutput', action='store_true', help='More verbose output.')
 args = parser.parse_args()
 
@@ -1017,6 +1204,21 @@ errorLimitUntilNotReachable = 10
 if 'errorLimitUntilNotReachable' in registerJson:
     errorLimitUntilNotReachable = registerJson['errorLimitUntilNotReachable']
 
+# The number of recent replies in which errorLimitUntilNotReachable errors mark the device as not reachable
+errorWindow = errorLimitUntilNotReachable
+if 'errorWindow' in registerJson:
+    errorWindow = registerJson['errorWindow']
+
+if errorLimitUntilNotReachable < 1 or errorWindow < errorLimitUntilNotReachable or errorWindow > 64:
+    logger.warning('Error: Invalid \"errorWindow\" %s. The window must contain at least \"errorLimitUntilNotReachable\" %s and at most 64 replies.' % (errorWindow, errorLimitUntilNotReachable))
+    exit(1)
+
+# Dedicated reachability requests will only be sent if no reply has been received within this time in ms,
+# by default the register will be read on every update() call while the communication is not working
+probeIdleTime = 0
+if 'probeIdleTime' in registerJson:
+    probeIdleTime = registerJson['probeIdleTime']
+
 # Check if the developer has specified an
 checkReachableRegister = {}
 if not 'checkReachableRegister' in registerJson:
@@ -1064,6 +1266,68 @@ if 'queuedRequests' in registerJson:
 if 'queuedRequestsDelay' in registerJson:
     queuedRequestsDelay = registerJson['queuedRequestsDelay']
 
+# Pace queued requests using a token bucket with the given rate in requests per second instead of the fixed delay
+requestRate = 0
+requestBurst = 1
+
+if 'requestRate' in registerJson:
+    requestRate = registerJson['requestRate']
+
+if 'requestBurst' in registerJson:
+    requestBurst = registerJson['requestBurst']
+
+if requestRate < 0 or requestBurst < 1:
+    logger.warning('Error: Invalid \"requestRate\" %s or \"requestBurst\" %s. The rate must be positive and the burst at least 1 request.' % (requestRate, requestBurst))
+    exit(1)
+
+requestPacer = queuedRequests and requestRate > 0
+if requestRate > 0 and not queuedRequests:
+    logger.warning('Warning: \"requestRate\" has no effect without \"queuedRequests\".')
+
+# Merge update registers into as few requests as possible. This is opt-in, one unsupported register
+# fails the whole merged request, so each register JSON has to be checked before enabling it.
+mergeRequests = False
+mergeRequestsMaxGap = 0
+mergeRequestsMaxSize = 125
+
+if 'mergeRequests' in registerJson:
+    mergeRequests = registerJson['mergeRequests']
+
+if 'mergeRequestsMaxGap' in registerJson:
+    mergeRequestsMaxGap = registerJson['mergeRequestsMaxGap']
+
+if 'mergeRequestsMaxSize' in registerJson:
+    mergeRequestsMaxSize = registerJson['mergeRequestsMaxSize']
+
+if mergeRequestsMaxSize < 1 or mergeRequestsMaxSize > 125:
+    logger.warning('Error: Invalid \"mergeRequestsMaxSize\" %s. A modbus request can read 1 up to 125 registers.' % mergeRequestsMaxSize)
+    exit(1)
+
+# The device supports read/write multiple registers (function code 23)
+readWriteMultipleRegisters = False
+if 'readWriteMultipleRegisters' in registerJson:
+    readWriteMultipleRegisters = registerJson['readWriteMultipleRegisters']
+
+# Emit all registers changed within an update cycle using one signal
+valuesChangedSignal = False
+if 'valuesChangedSignal' in registerJson:
+    valuesChangedSignal = registerJson['valuesChangedSignal']
+
+# Generate a register table and one generic read engine instead of per register request code
+tableDriven = False
+if 'tableDriven' in registerJson:
+    tableDriven = registerJson['tableDriven']
+
+# Publish a copy of all values at the end of each update cycle
+snapshot = False
+if 'snapshot' in registerJson:
+    snapshot = registerJson['snapshot']
+
+# Collect the writes of several setters and send them merged on commit()
+writeTransactions = False
+if 'writeTransactions' in registerJson:
+    writeTransactions = registerJson['writeTransactions']
+
 # Inform about parsed and validated configs if debugging enabled
 logger.debug('Script path: %s' % scriptPath)
 logger.debug('Output directory: %s' % outputDirectory)
@@ -1072,8 +1336,19 @@ logger.debug('Endianness: %s' % endianness)
 logger.debug('String endianness: %s' % stringEndianness)
 logger.debug('Queued requests: %s' % queuedRequests)
 logger.debug('Queued requests delay: %s ms' % queuedRequestsDelay)
+logger.debug('Request rate: %s/s burst: %s' % (requestRate, requestBurst))
+logger.debug('Merge requests: %s' % mergeRequests)
+logger.debug('Merge requests max gap: %s' % mergeRequestsMaxGap)
+logger.debug('Merge requests max size: %s' % mergeRequestsMaxSize)
+logger.debug('Values changed signal: %s' % valuesChangedSignal)
+logger.debug('Read write multiple registers: %s' % readWriteMultipleRegisters)
+logger.debug('Table driven: %s' % tableDriven)
+logger.debug('Snapshot: %s' % snapshot)
+logger.debug('Write transactions: %s' % writeTransactions)
 
 logger.debug('Error limit until not reachable: %s' % errorLimitUntilNotReachable)
+logger.debug('Error window: %s' % errorWindow)
+logger.debug('Probe idle time: %s ms' % probeIdleTime)
 logger.debug('Check reachable register: %s' % checkReachableRegister['id'])
 
 
@@ -1084,6 +1359,29 @@ if 'protocol' in registerJson:
 if 'blocks' in registerJson:
     validateBlocks(registerJson['blocks'])
 
+validateUpdateSchedules(registerJson['registers'], registerJson.get('blocks', []))
+validateChangeFilters(registerJson)
+validateHistories(registerJson)
+validateReadBack(registerJson)
+
+readPlan = []
+if mergeRequests:
+    readPlan = computeReadPlan(registerJson['registers'], mergeRequestsMaxGap, mergeRequestsMaxSize)
+
+updateItems = getUpdateItems(registerJson['registers'], registerJson.get('blocks', []), readPlan)
+assignUpdateDemands(updateItems, registerJson, checkReachableRegister)
+
+registerTable = None
+if tableDriven:
+    registerTable = buildRegisterTable(registerJson, readPlan, updateItems)
+
+changedRegisterIds = []
+if valuesChangedSignal:
+    changedRegisterIds = getRegistersEnumIds(registerJson)
+    for registerDefinition in registerJson['registers'] + [blockRegister for blockDefinition in registerJson.get('blocks', []) for blockRegister in blockDefinition['registers']]:
+        if not registerDefinition['id'] in changedRegisterIds:
+            logger.warning('Warning: Register %s shares the address %s with an other register and will not be listed in the valuesChanged() signal.' % (registerDefinition['id'], registerDefinition['address']))
+
 # Create classes depending on the protocol
 writeTcp = protocol in ["TCP", "BOTH"]
 writeRtu = protocol in ["RTU", "BOTH"]
@@ -1129,6 +1427,30 @@ if writeRtu:
     writeRtuHeaderFile()
     writeRtuSourceFile()
 
+# Write simulator classes
+if args.simulator:
+    for simulatorProtocol in [ 'TCP', 'RTU' ]:
+        if (simulatorProtocol == 'TCP' and not writeTcp) or (simulatorProtocol == 'RTU' and not writeRtu):
+            continue
+
+        className = classNamePrefix + ('ModbusTcpServer' if simulatorProtocol == 'TCP' else 'ModbusRtuServer')
+        headerFileName = className.lower() + '.h'
+        headerFiles.append(headerFileName)
+        sourceFileName = className.lower() + '.cpp'
+        sourceFiles.append(sourceFileName)
+        headerFilePath = os.path.join(outputDirectory, headerFileName)
+        sourceFilePath = os.path.join(outputDirectory, sourceFileName)
+
+        logger.info('Writing modbus %s simulator header file %s' % (simulatorProtocol, headerFilePath))
+        headerFile = open(headerFilePath, 'w')
+        writeSimulatorHeaderFile(headerFile, className, registerJson, simulatorProtocol, endianness, stringEndianness)
+        headerFile.close()
+
+        logger.info('Writing modbus %s simulator source file %s' % (simulatorProtocol, sourceFilePath))
+        sourceFile = open(sourceFilePath, 'w')
+        writeSimulatorSourceFile(sourceFile, className, headerFileName, registerJson, simulatorProtocol)
+        sourceFile.close()
+
 # Write pri file
 projectIncludeFileName = classNamePrefix.lower() + '.pri'
 projectIncludeFilePath = os.path.join(outputDirectory, projectIncludeFileName)
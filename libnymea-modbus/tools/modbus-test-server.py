@@ -0,0 +1,342 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2023 nymea GmbH <developer@nymea.io>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; either version 2
+# of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+# Local modbus TCP test server serving the register map of one or more register JSON files.
+# Latency, jitter and exception responses can be injected in order to test and benchmark
+# the connection classes and the ModbusTcpMaster against a reproducible device.
+
+import sys
+import json
+import time
+import random
+import struct
+import asyncio
+import argparse
+import logging
+
+# Function codes
+ReadCoils = 0x01
+ReadDiscreteInputs = 0x02
+ReadHoldingRegisters = 0x03
+ReadInputRegisters = 0x04
+WriteSingleCoil = 0x05
+WriteSingleRegister = 0x06
+WriteMultipleCoils = 0x0F
+WriteMultipleRegisters = 0x10
+ReadWriteMultipleRegisters = 0x17
+
+# Exception codes
+IllegalFunction = 0x01
+IllegalDataAddress = 0x02
+IllegalDataValue = 0x03
+
+registerTypes = ['coils', 'discreteInputs', 'holdingRegister', 'inputRegister']
+
+
+def loadJsonFile(filePath):
+    logger.debug('Loading JSON file %s', filePath)
+    jsonFile = open(filePath, 'r')
+    return json.load(jsonFile)
+
+
+def parseUnitIds(unitIdsString):
+    unitIds = []
+    for part in unitIdsString.split(','):
+        if '-' in part:
+            first, last = part.split('-')
+            unitIds.extend(range(int(first), int(last) + 1))
+        else:
+            unitIds.append(int(part))
+    return unitIds
+
+
+def getDefaultValue(registerDefinition, enums):
+    if not 'defaultValue' in registerDefinition:
+        return 0
+
+    defaultValue = registerDefinition['defaultValue']
+    if 'enum' in registerDefinition and registerDefinition['enum'] in enums:
+        for enumValue in enums[registerDefinition['enum']]['values']:
+            if enumValue['key'] == defaultValue:
+                return enumValue['value']
+
+    if isinstance(defaultValue, (int, float)):
+        value = defaultValue
+    elif defaultValue == 'true' or defaultValue == 'false':
+        value = 1 if defaultValue == 'true' else 0
+    else:
+        try:
+            value = float(defaultValue)
+        except ValueError:
+            # Strings and other C++ expressions are served as zero
+            return 0
+
+    if 'staticScaleFactor' in registerDefinition:
+        value = value * pow(10, -registerDefinition['staticScaleFactor'])
+
+    return value
+
+
+def encodeRegisterValue(registerDefinition, value, byteOrder):
+    registerType = registerDefinition['type']
+    size = registerDefinition['size']
+
+    if registerType in ['float', 'float64']:
+        data = struct.pack('>f' if registerType == 'float' else '>d', float(value))
+    elif registerType in ['int16', 'int32', 'int64']:
+        data = int(value).to_bytes(size * 2, 'big', signed=True)
+    elif registerType in ['uint16', 'uint32', 'uint64']:
+        data = (int(value) & ((1 << (size * 16)) - 1)).to_bytes(size * 2, 'big')
+    else:
+        # Strings, byte arrays and raw registers
+        return [0] * size
+
+    registers = [int.from_bytes(data[i:i + 2], 'big') for i in range(0, len(data), 2)]
+    if byteOrder == 'LittleEndian':
+        registers.reverse()
+
+    return registers
+
+
+class RegisterMap():
+    def __init__(self):
+        self.values = {}
+        for registerType in registerTypes:
+            self.values[registerType] = {}
+
+    def load(self, registerJson):
+        byteOrder = registerJson.get('endianness', 'LittleEndian')
+        enums = {}
+        if 'enums' in registerJson:
+            for enumDefinition in registerJson['enums']:
+                enums[enumDefinition['name']] = enumDefinition
+
+        registerDefinitions = list(registerJson['registers'])
+        if 'blocks' in registerJson:
+            for blockDefinition in registerJson['blocks']:
+                registerDefinitions.extend(blockDefinition['registers'])
+
+        for registerDefinition in registerDefinitions:
+            registers = encodeRegisterValue(registerDefinition, getDefaultValue(registerDefinition, enums), byteOrder)
+            for i, registerValue in enumerate(registers):
+                self.values[registerDefinition['registerType']][registerDefinition['address'] + i] = registerValue
+
+    def read(self, registerType, address, count):
+        if not strictAddresses:
+            return [self.values[registerType].get(address + i, 0) for i in range(count)]
+
+        registers = []
+        for i in range(count):
+            if not address + i in self.values[registerType]:
+                return None
+            registers.append(self.values[registerType][address + i])
+        return registers
+
+    def write(self, registerType, address, registers):
+        for i, registerValue in enumerate(registers):
+            self.values[registerType][address + i] = registerValue
+
+
+class Statistics():
+    def __init__(self):
+        self.requests = 0
+        self.exceptions = 0
+        self.functionCodes = {}
+
+    def record(self, functionCode, exception):
+        self.requests += 1
+        self.functionCodes[functionCode] = self.functionCodes.get(functionCode, 0) + 1
+        if exception:
+            self.exceptions += 1
+
+
+def exceptionResponse(functionCode, exceptionCode):
+    return struct.pack('>BB', functionCode | 0x80, exceptionCode)
+
+
+def packBits(bits):
+    data = bytearray((len(bits) + 7) // 8)
+    for i, bit in enumerate(bits):
+        if bit:
+            data[i // 8] |= 1 << (i % 8)
+    return bytes(data)
+
+
+def unpackBits(data, count):
+    return [(data[i // 8] >> (i % 8)) & 0x01 for i in range(count)]
+
+
+def processRequest(registerMap, pdu):
+    functionCode = pdu[0]
+    try:
+        if functionCode in [ReadCoils, ReadDiscreteInputs]:
+            address, count = struct.unpack('>HH', pdu[1:5])
+            if count < 1 or count > 2000:
+                return exceptionResponse(functionCode, IllegalDataValue)
+            bits = registerMap.read('coils' if functionCode == ReadCoils else 'discreteInputs', address, count)
+            if bits is None:
+                return exceptionResponse(functionCode, IllegalDataAddress)
+            data = packBits(bits)
+            return struct.pack('>BB', functionCode, len(data)) + data
+
+        if functionCode in [ReadHoldingRegisters, ReadInputRegisters]:
+            address, count = struct.unpack('>HH', pdu[1:5])
+            if count < 1 or count > 125:
+                return exceptionResponse(functionCode, IllegalDataValue)
+            registers = registerMap.read('holdingRegister' if functionCode == ReadHoldingRegisters else 'inputRegister', address, count)
+            if registers is None:
+                return exceptionResponse(functionCode, IllegalDataAddress)
+            return struct.pack('>BB%dH' % count, functionCode, count * 2, *registers)
+
+        if functionCode == WriteSingleCoil:
+            address, value = struct.unpack('>HH', pdu[1:5])
+            registerMap.write('coils', address, [1 if value == 0xFF00 else 0])
+            return pdu[0:5]
+
+        if functionCode == WriteSingleRegister:
+            address, value = struct.unpack('>HH', pdu[1:5])
+            registerMap.write('holdingRegister', address, [value])
+            return pdu[0:5]
+
+        if functionCode == WriteMultipleCoils:
+            address, count, byteCount = struct.unpack('>HHB', pdu[1:6])
+            registerMap.write('coils', address, unpackBits(pdu[6:6 + byteCount], count))
+            return pdu[0:5]
+
+        if functionCode == WriteMultipleRegisters:
+            address, count, byteCount = struct.unpack('>HHB', pdu[1:6])
+            registerMap.write('holdingRegister', address, list(struct.unpack('>%dH' % count, pdu[6:6 + byteCount])))
+            return pdu[0:5]
+
+        if functionCode == ReadWriteMultipleRegisters:
+            readAddress, readCount, writeAddress, writeCount, byteCount = struct.unpack('>HHHHB', pdu[1:10])
+            registerMap.write('holdingRegister', writeAddress, list(struct.unpack('>%dH' % writeCount, pdu[10:10 + byteCount])))
+            registers = registerMap.read('holdingRegister', readAddress, readCount)
+            if registers is None:
+                return exceptionResponse(functionCode, IllegalDataAddress)
+            return struct.pack('>BB%dH' % readCount, functionCode, readCount * 2, *registers)
+
+    except struct.error:
+        return exceptionResponse(functionCode, IllegalDataValue)
+
+    return exceptionResponse(functionCode, IllegalFunction)
+
+
+async def handleRequest(writer, transactionId, unitId, pdu):
+    delay = max(0, args.latency + random.uniform(-args.jitter, args.jitter)) / 1000.0
+    if delay > 0:
+        await asyncio.sleep(delay)
+
+    if not unitId in registerMaps:
+        # Gateways do not respond for units which are not available
+        logger.debug('Ignoring request for unknown unit %s', unitId)
+        return
+
+    if random.random() < args.exceptionRate:
+        response = exceptionResponse(pdu[0], args.exceptionCode)
+    else:
+        response = processRequest(registerMaps[unitId], pdu)
+
+    statistics.record(pdu[0], response[0] & 0x80)
+    if writer.is_closing():
+        return
+
+    writer.write(struct.pack('>HHHB', transactionId, 0, len(response) + 1, unitId) + response)
+
+
+async def handleClient(reader, writer):
+    peer = writer.get_extra_info('peername')
+    logger.info('Client connected %s', peer)
+    try:
+        while True:
+            header = await reader.readexactly(7)
+            transactionId, protocolId, length, unitId = struct.unpack('>HHHB', header)
+            pdu = await reader.readexactly(length - 1)
+            logger.debug('--> %s unit %s transaction %s PDU %s', peer, unitId, transactionId, pdu.hex())
+            # Requests get processed concurrently, responses might be sent out of order like on real gateways
+            asyncio.ensure_future(handleRequest(writer, transactionId, unitId, pdu))
+    except (asyncio.IncompleteReadError, ConnectionResetError):
+        logger.info('Client disconnected %s', peer)
+    finally:
+        writer.close()
+
+
+async def printStatistics():
+    lastRequests = 0
+    lastTimestamp = time.monotonic()
+    while True:
+        await asyncio.sleep(args.statisticsInterval)
+        timestamp = time.monotonic()
+        requestsPerSecond = (statistics.requests - lastRequests) / (timestamp - lastTimestamp)
+        functionCodes = ', '.join('FC%d: %d' % (functionCode, count) for functionCode, count in sorted(statistics.functionCodes.items()))
+        logger.info('%.1f requests/s, total %d requests, %d exceptions (%s)', requestsPerSecond, statistics.requests, statistics.exceptions, functionCodes)
+        lastRequests = statistics.requests
+        lastTimestamp = timestamp
+
+
+async def runServer():
+    server = await asyncio.start_server(handleClient, args.address, args.port)
+    logger.info('Serving %s unit(s) on %s:%s', len(registerMaps), args.address, args.port)
+    if args.statisticsInterval > 0:
+        asyncio.ensure_future(printStatistics())
+
+    async with server:
+        await server.serve_forever()
+
+
+# Main
+logger = logging.getLogger('modbus-test-server')
+logger.setLevel(logging.INFO)
+ch = logging.StreamHandler(sys.stdout)
+ch.setLevel(logging.INFO)
+formatter = logging.Formatter('%(name)s: %(message)s')
+ch.setFormatter(formatter)
+logger.addHandler(ch)
+
+parser = argparse.ArgumentParser(description='Local modbus TCP test server serving the registers of JSON register definition files.')
+parser.add_argument('-j', '--json', metavar='<file>', action='append', required=True, help='The JSON file containing the register definitions. Can be passed multiple times, the register maps will be combined.')
+parser.add_argument('-a', '--address', metavar='<address>', default='127.0.0.1', help='The address to listen on. Default is 127.0.0.1.')
+parser.add_argument('-p', '--port', metavar='<port>', type=int, default=5020, help='The TCP port to listen on. Default is 5020.')
+parser.add_argument('-u', '--unit-ids', dest='unitIds', metavar='<ids>', default='1', help='The unit IDs to serve, for example "1", "1,2,5" or "1-100". Each unit gets its own register map. Default is 1.')
+parser.add_argument('-l', '--latency', metavar='<ms>', type=float, default=0, help='Latency in milliseconds added to each response.')
+parser.add_argument('--jitter', metavar='<ms>', type=float, default=0, help='Random jitter in milliseconds added to or subtracted from the latency.')
+parser.add_argument('--exception-rate', dest='exceptionRate', metavar='<rate>', type=float, default=0, help='Probability between 0 and 1 of answering a request with an exception.')
+parser.add_argument('--exception-code', dest='exceptionCode', metavar='<code>', type=int, default=6, help='The exception code for injected exceptions. Default is 6 (server device busy).')
+parser.add_argument('--strict', dest='strictAddresses', action='store_true', help='Respond with illegal data address for registers not defined in the JSON files.')
+parser.add_argument('-s', '--statistics-interval', dest='statisticsInterval', metavar='<s>', type=float, default=10, help='Interval in seconds for printing the request statistics, 0 disables them. Default is 10.')
+parser.add_argument('-v', '--verbose', dest='verboseOutput', action='store_true', help='More verbose output.')
+args = parser.parse_args()
+
+if args.verboseOutput:
+    logger.setLevel(logging.DEBUG)
+    ch.setLevel(logging.DEBUG)
+
+strictAddresses = args.strictAddresses
+statistics = Statistics()
+registerJsons = [loadJsonFile(jsonFilePath) for jsonFilePath in args.json]
+registerMaps = {}
+for unitId in parseUnitIds(args.unitIds):
+    registerMap = RegisterMap()
+    for registerJson in registerJsons:
+        registerMap.load(registerJson)
+    registerMaps[unitId] = registerMap
+
+try:
+    asyncio.run(runServer())
+except KeyboardInterrupt:
+    logger.info('Server stopped')
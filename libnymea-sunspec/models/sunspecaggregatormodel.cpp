@@ -31,6 +31,33 @@
 #include "sunspecaggregatormodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexAid
+    { "AID", "AID", "Aggregated model id", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 2, 0, 1 },
+    // DataPointIndexN
+    { "N", "N", "Number of aggregated models", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 3, 1, 1 },
+    // DataPointIndexUn
+    { "UN", "UN", "Update Number.  Incrementing number each time the mapping is changed.  If the number is not changed from the last reading the direct access to a specific offset will result in reading the same logical model as before.  Otherwise the entire model must be read to refresh the changes", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 4, 2, 1 },
+    // DataPointIndexStatus
+    { "St", "Status", "Enumerated status code", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, true, 5, 3, 1 },
+    // DataPointIndexVendorStatus
+    { "StVnd", "Vendor Status", "Vendor specific status code", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, false, 6, 4, 1 },
+    // DataPointIndexEventCode
+    { "Evt", "Event Code", "Bitmask event code", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, true, 7, 5, 2 },
+    // DataPointIndexVendorEventCode
+    { "EvtVnd", "Vendor Event Code", "Vendor specific event code", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 9, 7, 2 },
+    // DataPointIndexControl
+    { "Ctl", "Control", "Control register for all aggregated devices", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, false, 11, 9, 1 },
+    // DataPointIndexVendorControl
+    { "CtlVnd", "Vendor Control", "Vendor control register for all aggregated devices", nullptr, nullptr, "enum32", nullptr, SunSpecDataPoint::Enum32, SunSpecDataPoint::AccessReadOnly, false, 12, 10, 2 },
+    // DataPointIndexControlValue
+    { "CtlVl", "Control Value", "Numerical value used as a parameter to the control", nullptr, nullptr, "enum32", nullptr, SunSpecDataPoint::Enum32, SunSpecDataPoint::AccessReadOnly, false, 14, 12, 2 }
+};
+
 SunSpecAggregatorModel::SunSpecAggregatorModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 2, modelLength, byteOrder, parent)
 {
@@ -101,177 +128,45 @@ quint32 SunSpecAggregatorModel::controlValue() const
 }
 void SunSpecAggregatorModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint aidDataPoint;
-    aidDataPoint.setName("AID");
-    aidDataPoint.setLabel("AID");
-    aidDataPoint.setDescription("Aggregated model id");
-    aidDataPoint.setMandatory(true);
-    aidDataPoint.setSize(1);
-    aidDataPoint.setAddressOffset(2);
-    aidDataPoint.setBlockOffset(0);
-    aidDataPoint.setSunSpecDataType("uint16");
-    aidDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(aidDataPoint.name(), aidDataPoint);
-
-    SunSpecDataPoint nDataPoint;
-    nDataPoint.setName("N");
-    nDataPoint.setLabel("N");
-    nDataPoint.setDescription("Number of aggregated models");
-    nDataPoint.setMandatory(true);
-    nDataPoint.setSize(1);
-    nDataPoint.setAddressOffset(3);
-    nDataPoint.setBlockOffset(1);
-    nDataPoint.setSunSpecDataType("uint16");
-    nDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(nDataPoint.name(), nDataPoint);
-
-    SunSpecDataPoint unDataPoint;
-    unDataPoint.setName("UN");
-    unDataPoint.setLabel("UN");
-    unDataPoint.setDescription("Update Number.  Incrementing number each time the mapping is changed.  If the number is not changed from the last reading the direct access to a specific offset will result in reading the same logical model as before.  Otherwise the entire model must be read to refresh the changes");
-    unDataPoint.setMandatory(true);
-    unDataPoint.setSize(1);
-    unDataPoint.setAddressOffset(4);
-    unDataPoint.setBlockOffset(2);
-    unDataPoint.setSunSpecDataType("uint16");
-    unDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(unDataPoint.name(), unDataPoint);
-
-    SunSpecDataPoint statusDataPoint;
-    statusDataPoint.setName("St");
-    statusDataPoint.setLabel("Status");
-    statusDataPoint.setDescription("Enumerated status code");
-    statusDataPoint.setMandatory(true);
-    statusDataPoint.setSize(1);
-    statusDataPoint.setAddressOffset(5);
-    statusDataPoint.setBlockOffset(3);
-    statusDataPoint.setSunSpecDataType("enum16");
-    statusDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(statusDataPoint.name(), statusDataPoint);
-
-    SunSpecDataPoint vendorStatusDataPoint;
-    vendorStatusDataPoint.setName("StVnd");
-    vendorStatusDataPoint.setLabel("Vendor Status");
-    vendorStatusDataPoint.setDescription("Vendor specific status code");
-    vendorStatusDataPoint.setSize(1);
-    vendorStatusDataPoint.setAddressOffset(6);
-    vendorStatusDataPoint.setBlockOffset(4);
-    vendorStatusDataPoint.setSunSpecDataType("enum16");
-    vendorStatusDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vendorStatusDataPoint.name(), vendorStatusDataPoint);
-
-    SunSpecDataPoint eventCodeDataPoint;
-    eventCodeDataPoint.setName("Evt");
-    eventCodeDataPoint.setLabel("Event Code");
-    eventCodeDataPoint.setDescription("Bitmask event code");
-    eventCodeDataPoint.setMandatory(true);
-    eventCodeDataPoint.setSize(2);
-    eventCodeDataPoint.setAddressOffset(7);
-    eventCodeDataPoint.setBlockOffset(5);
-    eventCodeDataPoint.setSunSpecDataType("bitfield32");
-    eventCodeDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(eventCodeDataPoint.name(), eventCodeDataPoint);
-
-    SunSpecDataPoint vendorEventCodeDataPoint;
-    vendorEventCodeDataPoint.setName("EvtVnd");
-    vendorEventCodeDataPoint.setLabel("Vendor Event Code");
-    vendorEventCodeDataPoint.setDescription("Vendor specific event code");
-    vendorEventCodeDataPoint.setSize(2);
-    vendorEventCodeDataPoint.setAddressOffset(9);
-    vendorEventCodeDataPoint.setBlockOffset(7);
-    vendorEventCodeDataPoint.setSunSpecDataType("bitfield32");
-    vendorEventCodeDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vendorEventCodeDataPoint.name(), vendorEventCodeDataPoint);
-
-    SunSpecDataPoint controlDataPoint;
-    controlDataPoint.setName("Ctl");
-    controlDataPoint.setLabel("Control");
-    controlDataPoint.setDescription("Control register for all aggregated devices");
-    controlDataPoint.setSize(1);
-    controlDataPoint.setAddressOffset(11);
-    controlDataPoint.setBlockOffset(9);
-    controlDataPoint.setSunSpecDataType("enum16");
-    controlDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(controlDataPoint.name(), controlDataPoint);
-
-    SunSpecDataPoint vendorControlDataPoint;
-    vendorControlDataPoint.setName("CtlVnd");
-    vendorControlDataPoint.setLabel("Vendor Control");
-    vendorControlDataPoint.setDescription("Vendor control register for all aggregated devices");
-    vendorControlDataPoint.setSize(2);
-    vendorControlDataPoint.setAddressOffset(12);
-    vendorControlDataPoint.setBlockOffset(10);
-    vendorControlDataPoint.setSunSpecDataType("enum32");
-    vendorControlDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vendorControlDataPoint.name(), vendorControlDataPoint);
-
-    SunSpecDataPoint controlValueDataPoint;
-    controlValueDataPoint.setName("CtlVl");
-    controlValueDataPoint.setLabel("Control Value");
-    controlValueDataPoint.setDescription("Numerical value used as a parameter to the control");
-    controlValueDataPoint.setSize(2);
-    controlValueDataPoint.setAddressOffset(14);
-    controlValueDataPoint.setBlockOffset(12);
-    controlValueDataPoint.setSunSpecDataType("enum32");
-    controlValueDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(controlValueDataPoint.name(), controlValueDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 12;
 }
 
 void SunSpecAggregatorModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("AID").isValid())
-        m_aid = m_dataPoints.value("AID").toUInt16();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_aid = SunSpecDataPoint::convertToUInt16(registers + 2, 1);
 
-    if (m_dataPoints.value("N").isValid())
-        m_n = m_dataPoints.value("N").toUInt16();
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_n = SunSpecDataPoint::convertToUInt16(registers + 3, 1);
 
-    if (m_dataPoints.value("UN").isValid())
-        m_un = m_dataPoints.value("UN").toUInt16();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_un = SunSpecDataPoint::convertToUInt16(registers + 4, 1);
 
-    if (m_dataPoints.value("St").isValid())
-        m_status = static_cast<St>(m_dataPoints.value("St").toUInt16());
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_status = static_cast<St>(SunSpecDataPoint::convertToUInt16(registers + 5, 1));
 
-    if (m_dataPoints.value("StVnd").isValid())
-        m_vendorStatus = m_dataPoints.value("StVnd").toUInt16();
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_vendorStatus = SunSpecDataPoint::convertToUInt16(registers + 6, 1);
 
-    if (m_dataPoints.value("Evt").isValid())
-        m_eventCode = static_cast<EvtFlags>(m_dataPoints.value("Evt").toUInt32());
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 7, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_eventCode = static_cast<EvtFlags>(SunSpecDataPoint::convertToUInt32(registers + 7, 2, m_byteOrder));
 
-    if (m_dataPoints.value("EvtVnd").isValid())
-        m_vendorEventCode = m_dataPoints.value("EvtVnd").toUInt32();
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 9, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_vendorEventCode = SunSpecDataPoint::convertToUInt32(registers + 9, 2, m_byteOrder);
 
-    if (m_dataPoints.value("Ctl").isValid())
-        m_control = static_cast<Ctl>(m_dataPoints.value("Ctl").toUInt16());
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_control = static_cast<Ctl>(SunSpecDataPoint::convertToUInt16(registers + 11, 1));
 
-    if (m_dataPoints.value("CtlVnd").isValid())
-        m_vendorControl = m_dataPoints.value("CtlVnd").toUInt32();
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 12, 2, SunSpecDataPoint::Enum32, m_byteOrder))
+        m_vendorControl = SunSpecDataPoint::convertToUInt32(registers + 12, 2, m_byteOrder);
 
-    if (m_dataPoints.value("CtlVl").isValid())
-        m_controlValue = m_dataPoints.value("CtlVl").toUInt32();
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 14, 2, SunSpecDataPoint::Enum32, m_byteOrder))
+        m_controlValue = SunSpecDataPoint::convertToUInt32(registers + 14, 2, m_byteOrder);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -280,71 +175,71 @@ void SunSpecAggregatorModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecAggregatorModel *model)
 {
     debug.nospace().noquote() << "SunSpecAggregatorModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("AID") << "-->";
-    if (model->dataPoints().value("AID").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecAggregatorModel::DataPointIndexAid) << "-->";
+    if (model->dataPoint(SunSpecAggregatorModel::DataPointIndexAid).isValid()) {
         debug.nospace().noquote() << model->aid() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("N") << "-->";
-    if (model->dataPoints().value("N").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecAggregatorModel::DataPointIndexN) << "-->";
+    if (model->dataPoint(SunSpecAggregatorModel::DataPointIndexN).isValid()) {
         debug.nospace().noquote() << model->n() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("UN") << "-->";
-    if (model->dataPoints().value("UN").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecAggregatorModel::DataPointIndexUn) << "-->";
+    if (model->dataPoint(SunSpecAggregatorModel::DataPointIndexUn).isValid()) {
         debug.nospace().noquote() << model->un() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("St") << "-->";
-    if (model->dataPoints().value("St").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecAggregatorModel::DataPointIndexStatus) << "-->";
+    if (model->dataPoint(SunSpecAggregatorModel::DataPointIndexStatus).isValid()) {
         debug.nospace().noquote() << model->status() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StVnd") << "-->";
-    if (model->dataPoints().value("StVnd").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecAggregatorModel::DataPointIndexVendorStatus) << "-->";
+    if (model->dataPoint(SunSpecAggregatorModel::DataPointIndexVendorStatus).isValid()) {
         debug.nospace().noquote() << model->vendorStatus() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Evt") << "-->";
-    if (model->dataPoints().value("Evt").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecAggregatorModel::DataPointIndexEventCode) << "-->";
+    if (model->dataPoint(SunSpecAggregatorModel::DataPointIndexEventCode).isValid()) {
         debug.nospace().noquote() << model->eventCode() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("EvtVnd") << "-->";
-    if (model->dataPoints().value("EvtVnd").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecAggregatorModel::DataPointIndexVendorEventCode) << "-->";
+    if (model->dataPoint(SunSpecAggregatorModel::DataPointIndexVendorEventCode).isValid()) {
         debug.nospace().noquote() << model->vendorEventCode() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Ctl") << "-->";
-    if (model->dataPoints().value("Ctl").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecAggregatorModel::DataPointIndexControl) << "-->";
+    if (model->dataPoint(SunSpecAggregatorModel::DataPointIndexControl).isValid()) {
         debug.nospace().noquote() << model->control() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CtlVnd") << "-->";
-    if (model->dataPoints().value("CtlVnd").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecAggregatorModel::DataPointIndexVendorControl) << "-->";
+    if (model->dataPoint(SunSpecAggregatorModel::DataPointIndexVendorControl).isValid()) {
         debug.nospace().noquote() << model->vendorControl() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CtlVl") << "-->";
-    if (model->dataPoints().value("CtlVl").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecAggregatorModel::DataPointIndexControlValue) << "-->";
+    if (model->dataPoint(SunSpecAggregatorModel::DataPointIndexControlValue).isValid()) {
         debug.nospace().noquote() << model->controlValue() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
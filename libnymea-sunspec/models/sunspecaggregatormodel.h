@@ -85,6 +85,21 @@ public:
     Q_DECLARE_FLAGS(EvtFlags, Evt)
     Q_FLAG(Evt)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexAid,
+        DataPointIndexN,
+        DataPointIndexUn,
+        DataPointIndexStatus,
+        DataPointIndexVendorStatus,
+        DataPointIndexEventCode,
+        DataPointIndexVendorEventCode,
+        DataPointIndexControl,
+        DataPointIndexVendorControl,
+        DataPointIndexControlValue
+    };
+
     explicit SunSpecAggregatorModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecAggregatorModel() override; 
 
@@ -31,6 +31,35 @@
 #include "sunspecbasemetmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexAmbientTemperature
+    { "TmpAmb", "Ambient Temperature", nullptr, nullptr, "C", "int16", "-1", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 2, 0, 1 },
+    // DataPointIndexRelativeHumidity
+    { "RH", "Relative Humidity", nullptr, nullptr, "Pct", "int16", nullptr, SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 3, 1, 1 },
+    // DataPointIndexBarometricPressure
+    { "Pres", "Barometric Pressure", nullptr, nullptr, "HPa", "int16", nullptr, SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 4, 2, 1 },
+    // DataPointIndexWindSpeed
+    { "WndSpd", "Wind Speed", nullptr, nullptr, "mps", "int16", nullptr, SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 5, 3, 1 },
+    // DataPointIndexWindDirection
+    { "WndDir", "Wind Direction", nullptr, nullptr, "deg", "int16", nullptr, SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 6, 4, 1 },
+    // DataPointIndexRainfall
+    { "Rain", "Rainfall", nullptr, nullptr, "mm", "int16", nullptr, SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 7, 5, 1 },
+    // DataPointIndexSnowDepth
+    { "Snw", "Snow Depth", nullptr, nullptr, "mm", "int16", nullptr, SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 8, 6, 1 },
+    // DataPointIndexPrecipitationType
+    { "PPT", "Precipitation Type", "Precipitation Type (WMO 4680 SYNOP code reference)", nullptr, nullptr, "int16", nullptr, SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 9, 7, 1 },
+    // DataPointIndexElectricField
+    { "ElecFld", "Electric Field", nullptr, nullptr, "Vm", "int16", nullptr, SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 10, 8, 1 },
+    // DataPointIndexSurfaceWetness
+    { "SurWet", "Surface Wetness", nullptr, nullptr, "kO", "int16", nullptr, SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 11, 9, 1 },
+    // DataPointIndexSoilWetness
+    { "SoilWet", "Soil Wetness", nullptr, nullptr, "Pct", "int16", nullptr, SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 12, 10, 1 }
+};
+
 SunSpecBaseMetModel::SunSpecBaseMetModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 307, modelLength, byteOrder, parent)
 {
@@ -105,187 +134,48 @@ qint16 SunSpecBaseMetModel::soilWetness() const
 }
 void SunSpecBaseMetModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint ambientTemperatureDataPoint;
-    ambientTemperatureDataPoint.setName("TmpAmb");
-    ambientTemperatureDataPoint.setLabel("Ambient Temperature");
-    ambientTemperatureDataPoint.setUnits("C");
-    ambientTemperatureDataPoint.setSize(1);
-    ambientTemperatureDataPoint.setAddressOffset(2);
-    ambientTemperatureDataPoint.setBlockOffset(0);
-    ambientTemperatureDataPoint.setScaleFactorName("-1");
-    ambientTemperatureDataPoint.setSunSpecDataType("int16");
-    ambientTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ambientTemperatureDataPoint.name(), ambientTemperatureDataPoint);
-
-    SunSpecDataPoint relativeHumidityDataPoint;
-    relativeHumidityDataPoint.setName("RH");
-    relativeHumidityDataPoint.setLabel("Relative Humidity");
-    relativeHumidityDataPoint.setUnits("Pct");
-    relativeHumidityDataPoint.setSize(1);
-    relativeHumidityDataPoint.setAddressOffset(3);
-    relativeHumidityDataPoint.setBlockOffset(1);
-    relativeHumidityDataPoint.setSunSpecDataType("int16");
-    relativeHumidityDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(relativeHumidityDataPoint.name(), relativeHumidityDataPoint);
-
-    SunSpecDataPoint barometricPressureDataPoint;
-    barometricPressureDataPoint.setName("Pres");
-    barometricPressureDataPoint.setLabel("Barometric Pressure");
-    barometricPressureDataPoint.setUnits("HPa");
-    barometricPressureDataPoint.setSize(1);
-    barometricPressureDataPoint.setAddressOffset(4);
-    barometricPressureDataPoint.setBlockOffset(2);
-    barometricPressureDataPoint.setSunSpecDataType("int16");
-    barometricPressureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(barometricPressureDataPoint.name(), barometricPressureDataPoint);
-
-    SunSpecDataPoint windSpeedDataPoint;
-    windSpeedDataPoint.setName("WndSpd");
-    windSpeedDataPoint.setLabel("Wind Speed");
-    windSpeedDataPoint.setUnits("mps");
-    windSpeedDataPoint.setSize(1);
-    windSpeedDataPoint.setAddressOffset(5);
-    windSpeedDataPoint.setBlockOffset(3);
-    windSpeedDataPoint.setSunSpecDataType("int16");
-    windSpeedDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(windSpeedDataPoint.name(), windSpeedDataPoint);
-
-    SunSpecDataPoint windDirectionDataPoint;
-    windDirectionDataPoint.setName("WndDir");
-    windDirectionDataPoint.setLabel("Wind Direction");
-    windDirectionDataPoint.setUnits("deg");
-    windDirectionDataPoint.setSize(1);
-    windDirectionDataPoint.setAddressOffset(6);
-    windDirectionDataPoint.setBlockOffset(4);
-    windDirectionDataPoint.setSunSpecDataType("int16");
-    windDirectionDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(windDirectionDataPoint.name(), windDirectionDataPoint);
-
-    SunSpecDataPoint rainfallDataPoint;
-    rainfallDataPoint.setName("Rain");
-    rainfallDataPoint.setLabel("Rainfall");
-    rainfallDataPoint.setUnits("mm");
-    rainfallDataPoint.setSize(1);
-    rainfallDataPoint.setAddressOffset(7);
-    rainfallDataPoint.setBlockOffset(5);
-    rainfallDataPoint.setSunSpecDataType("int16");
-    rainfallDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rainfallDataPoint.name(), rainfallDataPoint);
-
-    SunSpecDataPoint snowDepthDataPoint;
-    snowDepthDataPoint.setName("Snw");
-    snowDepthDataPoint.setLabel("Snow Depth");
-    snowDepthDataPoint.setUnits("mm");
-    snowDepthDataPoint.setSize(1);
-    snowDepthDataPoint.setAddressOffset(8);
-    snowDepthDataPoint.setBlockOffset(6);
-    snowDepthDataPoint.setSunSpecDataType("int16");
-    snowDepthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(snowDepthDataPoint.name(), snowDepthDataPoint);
-
-    SunSpecDataPoint precipitationTypeDataPoint;
-    precipitationTypeDataPoint.setName("PPT");
-    precipitationTypeDataPoint.setLabel("Precipitation Type");
-    precipitationTypeDataPoint.setDescription("Precipitation Type (WMO 4680 SYNOP code reference)");
-    precipitationTypeDataPoint.setSize(1);
-    precipitationTypeDataPoint.setAddressOffset(9);
-    precipitationTypeDataPoint.setBlockOffset(7);
-    precipitationTypeDataPoint.setSunSpecDataType("int16");
-    precipitationTypeDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(precipitationTypeDataPoint.name(), precipitationTypeDataPoint);
-
-    SunSpecDataPoint electricFieldDataPoint;
-    electricFieldDataPoint.setName("ElecFld");
-    electricFieldDataPoint.setLabel("Electric Field");
-    electricFieldDataPoint.setUnits("Vm");
-    electricFieldDataPoint.setSize(1);
-    electricFieldDataPoint.setAddressOffset(10);
-    electricFieldDataPoint.setBlockOffset(8);
-    electricFieldDataPoint.setSunSpecDataType("int16");
-    electricFieldDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(electricFieldDataPoint.name(), electricFieldDataPoint);
-
-    SunSpecDataPoint surfaceWetnessDataPoint;
-    surfaceWetnessDataPoint.setName("SurWet");
-    surfaceWetnessDataPoint.setLabel("Surface Wetness");
-    surfaceWetnessDataPoint.setUnits("kO");
-    surfaceWetnessDataPoint.setSize(1);
-    surfaceWetnessDataPoint.setAddressOffset(11);
-    surfaceWetnessDataPoint.setBlockOffset(9);
-    surfaceWetnessDataPoint.setSunSpecDataType("int16");
-    surfaceWetnessDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(surfaceWetnessDataPoint.name(), surfaceWetnessDataPoint);
-
-    SunSpecDataPoint soilWetnessDataPoint;
-    soilWetnessDataPoint.setName("SoilWet");
-    soilWetnessDataPoint.setLabel("Soil Wetness");
-    soilWetnessDataPoint.setUnits("Pct");
-    soilWetnessDataPoint.setSize(1);
-    soilWetnessDataPoint.setAddressOffset(12);
-    soilWetnessDataPoint.setBlockOffset(10);
-    soilWetnessDataPoint.setSunSpecDataType("int16");
-    soilWetnessDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(soilWetnessDataPoint.name(), soilWetnessDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 13;
 }
 
 void SunSpecBaseMetModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("TmpAmb").isValid())
-        m_ambientTemperature = m_dataPoints.value("TmpAmb").toFloatWithSSF(-1);
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_ambientTemperature = SunSpecDataPoint::convertToInt16(registers + 2, 1) * SunSpecDataPoint::scaleFactorMultiplier(-1);
 
-    if (m_dataPoints.value("RH").isValid())
-        m_relativeHumidity = m_dataPoints.value("RH").toInt16();
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_relativeHumidity = SunSpecDataPoint::convertToInt16(registers + 3, 1);
 
-    if (m_dataPoints.value("Pres").isValid())
-        m_barometricPressure = m_dataPoints.value("Pres").toInt16();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_barometricPressure = SunSpecDataPoint::convertToInt16(registers + 4, 1);
 
-    if (m_dataPoints.value("WndSpd").isValid())
-        m_windSpeed = m_dataPoints.value("WndSpd").toInt16();
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_windSpeed = SunSpecDataPoint::convertToInt16(registers + 5, 1);
 
-    if (m_dataPoints.value("WndDir").isValid())
-        m_windDirection = m_dataPoints.value("WndDir").toInt16();
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_windDirection = SunSpecDataPoint::convertToInt16(registers + 6, 1);
 
-    if (m_dataPoints.value("Rain").isValid())
-        m_rainfall = m_dataPoints.value("Rain").toInt16();
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_rainfall = SunSpecDataPoint::convertToInt16(registers + 7, 1);
 
-    if (m_dataPoints.value("Snw").isValid())
-        m_snowDepth = m_dataPoints.value("Snw").toInt16();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_snowDepth = SunSpecDataPoint::convertToInt16(registers + 8, 1);
 
-    if (m_dataPoints.value("PPT").isValid())
-        m_precipitationType = m_dataPoints.value("PPT").toInt16();
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_precipitationType = SunSpecDataPoint::convertToInt16(registers + 9, 1);
 
-    if (m_dataPoints.value("ElecFld").isValid())
-        m_electricField = m_dataPoints.value("ElecFld").toInt16();
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_electricField = SunSpecDataPoint::convertToInt16(registers + 10, 1);
 
-    if (m_dataPoints.value("SurWet").isValid())
-        m_surfaceWetness = m_dataPoints.value("SurWet").toInt16();
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_surfaceWetness = SunSpecDataPoint::convertToInt16(registers + 11, 1);
 
-    if (m_dataPoints.value("SoilWet").isValid())
-        m_soilWetness = m_dataPoints.value("SoilWet").toInt16();
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 12, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_soilWetness = SunSpecDataPoint::convertToInt16(registers + 12, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -294,78 +184,78 @@ void SunSpecBaseMetModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecBaseMetModel *model)
 {
     debug.nospace().noquote() << "SunSpecBaseMetModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("TmpAmb") << "-->";
-    if (model->dataPoints().value("TmpAmb").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecBaseMetModel::DataPointIndexAmbientTemperature) << "-->";
+    if (model->dataPoint(SunSpecBaseMetModel::DataPointIndexAmbientTemperature).isValid()) {
         debug.nospace().noquote() << model->ambientTemperature() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("RH") << "-->";
-    if (model->dataPoints().value("RH").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecBaseMetModel::DataPointIndexRelativeHumidity) << "-->";
+    if (model->dataPoint(SunSpecBaseMetModel::DataPointIndexRelativeHumidity).isValid()) {
         debug.nospace().noquote() << model->relativeHumidity() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Pres") << "-->";
-    if (model->dataPoints().value("Pres").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecBaseMetModel::DataPointIndexBarometricPressure) << "-->";
+    if (model->dataPoint(SunSpecBaseMetModel::DataPointIndexBarometricPressure).isValid()) {
         debug.nospace().noquote() << model->barometricPressure() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WndSpd") << "-->";
-    if (model->dataPoints().value("WndSpd").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecBaseMetModel::DataPointIndexWindSpeed) << "-->";
+    if (model->dataPoint(SunSpecBaseMetModel::DataPointIndexWindSpeed).isValid()) {
         debug.nospace().noquote() << model->windSpeed() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WndDir") << "-->";
-    if (model->dataPoints().value("WndDir").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecBaseMetModel::DataPointIndexWindDirection) << "-->";
+    if (model->dataPoint(SunSpecBaseMetModel::DataPointIndexWindDirection).isValid()) {
         debug.nospace().noquote() << model->windDirection() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Rain") << "-->";
-    if (model->dataPoints().value("Rain").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecBaseMetModel::DataPointIndexRainfall) << "-->";
+    if (model->dataPoint(SunSpecBaseMetModel::DataPointIndexRainfall).isValid()) {
         debug.nospace().noquote() << model->rainfall() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Snw") << "-->";
-    if (model->dataPoints().value("Snw").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecBaseMetModel::DataPointIndexSnowDepth) << "-->";
+    if (model->dataPoint(SunSpecBaseMetModel::DataPointIndexSnowDepth).isValid()) {
         debug.nospace().noquote() << model->snowDepth() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("PPT") << "-->";
-    if (model->dataPoints().value("PPT").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecBaseMetModel::DataPointIndexPrecipitationType) << "-->";
+    if (model->dataPoint(SunSpecBaseMetModel::DataPointIndexPrecipitationType).isValid()) {
         debug.nospace().noquote() << model->precipitationType() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ElecFld") << "-->";
-    if (model->dataPoints().value("ElecFld").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecBaseMetModel::DataPointIndexElectricField) << "-->";
+    if (model->dataPoint(SunSpecBaseMetModel::DataPointIndexElectricField).isValid()) {
         debug.nospace().noquote() << model->electricField() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("SurWet") << "-->";
-    if (model->dataPoints().value("SurWet").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecBaseMetModel::DataPointIndexSurfaceWetness) << "-->";
+    if (model->dataPoint(SunSpecBaseMetModel::DataPointIndexSurfaceWetness).isValid()) {
         debug.nospace().noquote() << model->surfaceWetness() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("SoilWet") << "-->";
-    if (model->dataPoints().value("SoilWet").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecBaseMetModel::DataPointIndexSoilWetness) << "-->";
+    if (model->dataPoint(SunSpecBaseMetModel::DataPointIndexSoilWetness).isValid()) {
         debug.nospace().noquote() << model->soilWetness() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
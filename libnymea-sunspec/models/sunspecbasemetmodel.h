@@ -42,6 +42,22 @@ class SunSpecBaseMetModel : public SunSpecModel
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexAmbientTemperature,
+        DataPointIndexRelativeHumidity,
+        DataPointIndexBarometricPressure,
+        DataPointIndexWindSpeed,
+        DataPointIndexWindDirection,
+        DataPointIndexRainfall,
+        DataPointIndexSnowDepth,
+        DataPointIndexPrecipitationType,
+        DataPointIndexElectricField,
+        DataPointIndexSurfaceWetness,
+        DataPointIndexSoilWetness
+    };
+
     explicit SunSpecBaseMetModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecBaseMetModel() override; 
 
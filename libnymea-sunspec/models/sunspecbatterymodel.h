@@ -141,6 +141,67 @@ public:
     Q_DECLARE_FLAGS(Evt1Flags, Evt1)
     Q_FLAG(Evt1)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexNameplateChargeCapacity,
+        DataPointIndexNameplateEnergyCapacity,
+        DataPointIndexNameplateMaxChargeRate,
+        DataPointIndexNameplateMaxDischargeRate,
+        DataPointIndexSelfDischargeRate,
+        DataPointIndexNameplateMaxSoC,
+        DataPointIndexNameplateMinSoC,
+        DataPointIndexMaxReservePercent,
+        DataPointIndexMinReservePercent,
+        DataPointIndexStateOfCharge,
+        DataPointIndexDepthOfDischarge,
+        DataPointIndexStateOfHealth,
+        DataPointIndexCycleCount,
+        DataPointIndexChargeStatus,
+        DataPointIndexControlMode,
+        DataPointIndexBatteryHeartbeat,
+        DataPointIndexControllerHeartbeat,
+        DataPointIndexAlarmReset,
+        DataPointIndexBatteryType,
+        DataPointIndexStateOfTheBatteryBank,
+        DataPointIndexVendorBatteryBankState,
+        DataPointIndexWarrantyDate,
+        DataPointIndexBatteryEvent1Bitfield,
+        DataPointIndexBatteryEvent2Bitfield,
+        DataPointIndexVendorEventBitfield1,
+        DataPointIndexVendorEventBitfield2,
+        DataPointIndexExternalBatteryVoltage,
+        DataPointIndexMaxBatteryVoltage,
+        DataPointIndexMinBatteryVoltage,
+        DataPointIndexMaxCellVoltage,
+        DataPointIndexMaxCellVoltageString,
+        DataPointIndexMaxCellVoltageModule,
+        DataPointIndexMinCellVoltage,
+        DataPointIndexMinCellVoltageString,
+        DataPointIndexMinCellVoltageModule,
+        DataPointIndexAverageCellVoltage,
+        DataPointIndexTotalDcCurrent,
+        DataPointIndexMaxChargeCurrent,
+        DataPointIndexMaxDischargeCurrent,
+        DataPointIndexTotalPower,
+        DataPointIndexInverterStateRequest,
+        DataPointIndexBatteryPowerRequest,
+        DataPointIndexSetOperation,
+        DataPointIndexSetInverterState,
+        DataPointIndexAHRtg_SF,
+        DataPointIndexWHRtg_SF,
+        DataPointIndexWChaDisChaMax_SF,
+        DataPointIndexDisChaRte_SF,
+        DataPointIndexSoC_SF,
+        DataPointIndexDoD_SF,
+        DataPointIndexSoH_SF,
+        DataPointIndexV_SF,
+        DataPointIndexCellV_SF,
+        DataPointIndexA_SF,
+        DataPointIndexAMax_SF,
+        DataPointIndexW_SF
+    };
+
     explicit SunSpecBatteryModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecBatteryModel() override; 
 
@@ -326,17 +387,29 @@ private:
     Setop m_setOperation;
     Setinvstate m_setInverterState;
     qint16 m_aHRtg_SF = 0;
+    double m_aHRtg_SFMultiplier = 1;
     qint16 m_wHRtg_SF = 0;
+    double m_wHRtg_SFMultiplier = 1;
     qint16 m_wChaDisChaMax_SF = 0;
+    double m_wChaDisChaMax_SFMultiplier = 1;
     qint16 m_disChaRte_SF = 0;
+    double m_disChaRte_SFMultiplier = 1;
     qint16 m_soC_SF = 0;
+    double m_soC_SFMultiplier = 1;
     qint16 m_doD_SF = 0;
+    double m_doD_SFMultiplier = 1;
     qint16 m_soH_SF = 0;
+    double m_soH_SFMultiplier = 1;
     qint16 m_v_SF = 0;
+    double m_v_SFMultiplier = 1;
     qint16 m_cellV_SF = 0;
+    double m_cellV_SFMultiplier = 1;
     qint16 m_a_SF = 0;
+    double m_a_SFMultiplier = 1;
     qint16 m_aMax_SF = 0;
+    double m_aMax_SFMultiplier = 1;
     qint16 m_w_SF = 0;
+    double m_w_SFMultiplier = 1;
 
 
 };
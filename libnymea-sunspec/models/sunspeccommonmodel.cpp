@@ -31,6 +31,27 @@
 #include "sunspeccommonmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexManufacturer
+    { "Mn", "Manufacturer", "Well known value registered with SunSpec for compliance", nullptr, nullptr, "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadOnly, true, 2, 0, 16 },
+    // DataPointIndexModel
+    { "Md", "Model", "Manufacturer specific value (32 chars)", nullptr, nullptr, "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadOnly, true, 18, 16, 16 },
+    // DataPointIndexOptions
+    { "Opt", "Options", "Manufacturer specific value (16 chars)", nullptr, nullptr, "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadOnly, false, 34, 32, 8 },
+    // DataPointIndexVersion
+    { "Vr", "Version", "Manufacturer specific value (16 chars)", nullptr, nullptr, "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadOnly, false, 42, 40, 8 },
+    // DataPointIndexSerialNumber
+    { "SN", "Serial Number", "Manufacturer specific value (32 chars)", nullptr, nullptr, "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadOnly, true, 50, 48, 16 },
+    // DataPointIndexDeviceAddress
+    { "DA", "Device Address", "Modbus device address", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 66, 64, 1 },
+    // DataPointIndexPad
+    { "Pad", nullptr, "Force even alignment", nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, false, 67, 65, 1 }
+};
+
 SunSpecCommonModel::SunSpecCommonModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 1, modelLength, byteOrder, parent)
 {
@@ -89,7 +110,7 @@ QModbusReply *SunSpecCommonModel::setDeviceAddress(quint16 deviceAddress)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("DA");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexDeviceAddress]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(deviceAddress);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -103,133 +124,36 @@ quint16 SunSpecCommonModel::pad() const
 }
 void SunSpecCommonModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint manufacturerDataPoint;
-    manufacturerDataPoint.setName("Mn");
-    manufacturerDataPoint.setLabel("Manufacturer");
-    manufacturerDataPoint.setDescription("Well known value registered with SunSpec for compliance");
-    manufacturerDataPoint.setMandatory(true);
-    manufacturerDataPoint.setSize(16);
-    manufacturerDataPoint.setAddressOffset(2);
-    manufacturerDataPoint.setBlockOffset(0);
-    manufacturerDataPoint.setSunSpecDataType("string");
-    manufacturerDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(manufacturerDataPoint.name(), manufacturerDataPoint);
-
-    SunSpecDataPoint modelDataPoint;
-    modelDataPoint.setName("Md");
-    modelDataPoint.setLabel("Model");
-    modelDataPoint.setDescription("Manufacturer specific value (32 chars)");
-    modelDataPoint.setMandatory(true);
-    modelDataPoint.setSize(16);
-    modelDataPoint.setAddressOffset(18);
-    modelDataPoint.setBlockOffset(16);
-    modelDataPoint.setSunSpecDataType("string");
-    modelDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelDataPoint.name(), modelDataPoint);
-
-    SunSpecDataPoint optionsDataPoint;
-    optionsDataPoint.setName("Opt");
-    optionsDataPoint.setLabel("Options");
-    optionsDataPoint.setDescription("Manufacturer specific value (16 chars)");
-    optionsDataPoint.setSize(8);
-    optionsDataPoint.setAddressOffset(34);
-    optionsDataPoint.setBlockOffset(32);
-    optionsDataPoint.setSunSpecDataType("string");
-    optionsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(optionsDataPoint.name(), optionsDataPoint);
-
-    SunSpecDataPoint versionDataPoint;
-    versionDataPoint.setName("Vr");
-    versionDataPoint.setLabel("Version");
-    versionDataPoint.setDescription("Manufacturer specific value (16 chars)");
-    versionDataPoint.setSize(8);
-    versionDataPoint.setAddressOffset(42);
-    versionDataPoint.setBlockOffset(40);
-    versionDataPoint.setSunSpecDataType("string");
-    versionDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(versionDataPoint.name(), versionDataPoint);
-
-    SunSpecDataPoint serialNumberDataPoint;
-    serialNumberDataPoint.setName("SN");
-    serialNumberDataPoint.setLabel("Serial Number");
-    serialNumberDataPoint.setDescription("Manufacturer specific value (32 chars)");
-    serialNumberDataPoint.setMandatory(true);
-    serialNumberDataPoint.setSize(16);
-    serialNumberDataPoint.setAddressOffset(50);
-    serialNumberDataPoint.setBlockOffset(48);
-    serialNumberDataPoint.setSunSpecDataType("string");
-    serialNumberDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(serialNumberDataPoint.name(), serialNumberDataPoint);
-
-    SunSpecDataPoint deviceAddressDataPoint;
-    deviceAddressDataPoint.setName("DA");
-    deviceAddressDataPoint.setLabel("Device Address");
-    deviceAddressDataPoint.setDescription("Modbus device address");
-    deviceAddressDataPoint.setSize(1);
-    deviceAddressDataPoint.setAddressOffset(66);
-    deviceAddressDataPoint.setBlockOffset(64);
-    deviceAddressDataPoint.setSunSpecDataType("uint16");
-    deviceAddressDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    deviceAddressDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(deviceAddressDataPoint.name(), deviceAddressDataPoint);
-
-    SunSpecDataPoint padDataPoint;
-    padDataPoint.setName("Pad");
-    padDataPoint.setDescription("Force even alignment");
-    padDataPoint.setSize(1);
-    padDataPoint.setAddressOffset(67);
-    padDataPoint.setBlockOffset(65);
-    padDataPoint.setSunSpecDataType("pad");
-    padDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(padDataPoint.name(), padDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 9;
 }
 
 void SunSpecCommonModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("Mn").isValid())
-        m_manufacturer = m_dataPoints.value("Mn").toString();
+    if (registerCount >= 18 && SunSpecDataPoint::isValid(registers + 2, 16, SunSpecDataPoint::String, m_byteOrder))
+        m_manufacturer = SunSpecDataPoint::convertToString(registers + 2, 16);
 
-    if (m_dataPoints.value("Md").isValid())
-        m_model = m_dataPoints.value("Md").toString();
+    if (registerCount >= 34 && SunSpecDataPoint::isValid(registers + 18, 16, SunSpecDataPoint::String, m_byteOrder))
+        m_model = SunSpecDataPoint::convertToString(registers + 18, 16);
 
-    if (m_dataPoints.value("Opt").isValid())
-        m_options = m_dataPoints.value("Opt").toString();
+    if (registerCount >= 42 && SunSpecDataPoint::isValid(registers + 34, 8, SunSpecDataPoint::String, m_byteOrder))
+        m_options = SunSpecDataPoint::convertToString(registers + 34, 8);
 
-    if (m_dataPoints.value("Vr").isValid())
-        m_version = m_dataPoints.value("Vr").toString();
+    if (registerCount >= 50 && SunSpecDataPoint::isValid(registers + 42, 8, SunSpecDataPoint::String, m_byteOrder))
+        m_version = SunSpecDataPoint::convertToString(registers + 42, 8);
 
-    if (m_dataPoints.value("SN").isValid())
-        m_serialNumber = m_dataPoints.value("SN").toString();
+    if (registerCount >= 66 && SunSpecDataPoint::isValid(registers + 50, 16, SunSpecDataPoint::String, m_byteOrder))
+        m_serialNumber = SunSpecDataPoint::convertToString(registers + 50, 16);
 
-    if (m_dataPoints.value("DA").isValid())
-        m_deviceAddress = m_dataPoints.value("DA").toUInt16();
+    if (registerCount >= 67 && SunSpecDataPoint::isValid(registers + 66, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_deviceAddress = SunSpecDataPoint::convertToUInt16(registers + 66, 1);
 
-    if (m_dataPoints.value("Pad").isValid())
-        m_pad = m_dataPoints.value("Pad").toUInt16();
+    if (registerCount >= 68 && SunSpecDataPoint::isValid(registers + 67, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad = SunSpecDataPoint::convertToUInt16(registers + 67, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -238,50 +162,50 @@ void SunSpecCommonModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecCommonModel *model)
 {
     debug.nospace().noquote() << "SunSpecCommonModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Mn") << "-->";
-    if (model->dataPoints().value("Mn").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecCommonModel::DataPointIndexManufacturer) << "-->";
+    if (model->dataPoint(SunSpecCommonModel::DataPointIndexManufacturer).isValid()) {
         debug.nospace().noquote() << model->manufacturer() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Md") << "-->";
-    if (model->dataPoints().value("Md").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecCommonModel::DataPointIndexModel) << "-->";
+    if (model->dataPoint(SunSpecCommonModel::DataPointIndexModel).isValid()) {
         debug.nospace().noquote() << model->model() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Opt") << "-->";
-    if (model->dataPoints().value("Opt").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecCommonModel::DataPointIndexOptions) << "-->";
+    if (model->dataPoint(SunSpecCommonModel::DataPointIndexOptions).isValid()) {
         debug.nospace().noquote() << model->options() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Vr") << "-->";
-    if (model->dataPoints().value("Vr").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecCommonModel::DataPointIndexVersion) << "-->";
+    if (model->dataPoint(SunSpecCommonModel::DataPointIndexVersion).isValid()) {
         debug.nospace().noquote() << model->version() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("SN") << "-->";
-    if (model->dataPoints().value("SN").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecCommonModel::DataPointIndexSerialNumber) << "-->";
+    if (model->dataPoint(SunSpecCommonModel::DataPointIndexSerialNumber).isValid()) {
         debug.nospace().noquote() << model->serialNumber() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("DA") << "-->";
-    if (model->dataPoints().value("DA").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecCommonModel::DataPointIndexDeviceAddress) << "-->";
+    if (model->dataPoint(SunSpecCommonModel::DataPointIndexDeviceAddress).isValid()) {
         debug.nospace().noquote() << model->deviceAddress() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Pad") << "-->";
-    if (model->dataPoints().value("Pad").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecCommonModel::DataPointIndexPad) << "-->";
+    if (model->dataPoint(SunSpecCommonModel::DataPointIndexPad).isValid()) {
         debug.nospace().noquote() << model->pad() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
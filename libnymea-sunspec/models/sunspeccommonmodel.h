@@ -42,6 +42,18 @@ class SunSpecCommonModel : public SunSpecModel
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexManufacturer,
+        DataPointIndexModel,
+        DataPointIndexOptions,
+        DataPointIndexVersion,
+        DataPointIndexSerialNumber,
+        DataPointIndexDeviceAddress,
+        DataPointIndexPad
+    };
+
     explicit SunSpecCommonModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecCommonModel() override; 
 
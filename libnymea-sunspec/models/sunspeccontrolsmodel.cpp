@@ -31,6 +31,61 @@
 #include "sunspeccontrolsmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexConnWinTms
+    { "Conn_WinTms", "Conn_WinTms", "Time window for connect/disconnect.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 2, 0, 1 },
+    // DataPointIndexConnRvrtTms
+    { "Conn_RvrtTms", "Conn_RvrtTms", "Timeout period for connect/disconnect.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 3, 1, 1 },
+    // DataPointIndexConn
+    { "Conn", "Conn", "Enumerated valued.  Connection control.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, true, 4, 2, 1 },
+    // DataPointIndexWMaxLimPct
+    { "WMaxLimPct", "WMaxLimPct", "Set power output to specified level.", nullptr, "% WMax", "uint16", "WMaxLimPct_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 5, 3, 1 },
+    // DataPointIndexWMaxLimPctWinTms
+    { "WMaxLimPct_WinTms", "WMaxLimPct_WinTms", "Time window for power limit change.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 6, 4, 1 },
+    // DataPointIndexWMaxLimPctRvrtTms
+    { "WMaxLimPct_RvrtTms", "WMaxLimPct_RvrtTms", "Timeout period for power limit.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 7, 5, 1 },
+    // DataPointIndexWMaxLimPctRmpTms
+    { "WMaxLimPct_RmpTms", "WMaxLimPct_RmpTms", "Ramp time for moving from current setpoint to new setpoint.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 8, 6, 1 },
+    // DataPointIndexWMaxLimEna
+    { "WMaxLim_Ena", "WMaxLim_Ena", "Enumerated valued.  Throttle enable/disable control.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, true, 9, 7, 1 },
+    // DataPointIndexOutPfSet
+    { "OutPFSet", "OutPFSet", "Set power factor to specific value - cosine of angle.", nullptr, "cos()", "int16", "OutPFSet_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, true, 10, 8, 1 },
+    // DataPointIndexOutPfSetWinTms
+    { "OutPFSet_WinTms", "OutPFSet_WinTms", "Time window for power factor change.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 11, 9, 1 },
+    // DataPointIndexOutPfSetRvrtTms
+    { "OutPFSet_RvrtTms", "OutPFSet_RvrtTms", "Timeout period for power factor.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 12, 10, 1 },
+    // DataPointIndexOutPfSetRmpTms
+    { "OutPFSet_RmpTms", "OutPFSet_RmpTms", "Ramp time for moving from current setpoint to new setpoint.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 13, 11, 1 },
+    // DataPointIndexOutPfSetEna
+    { "OutPFSet_Ena", "OutPFSet_Ena", "Enumerated valued.  Fixed power factor enable/disable control.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, true, 14, 12, 1 },
+    // DataPointIndexVArWMaxPct
+    { "VArWMaxPct", "VArWMaxPct", "Reactive power in percent of WMax.", nullptr, "% WMax", "int16", "VArPct_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 15, 13, 1 },
+    // DataPointIndexVArMaxPct
+    { "VArMaxPct", "VArMaxPct", "Reactive power in percent of VArMax.", nullptr, "% VArMax", "int16", "VArPct_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 16, 14, 1 },
+    // DataPointIndexVArAvalPct
+    { "VArAvalPct", "VArAvalPct", "Reactive power in percent of VArAval.", nullptr, "% VArAval", "int16", "VArPct_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 17, 15, 1 },
+    // DataPointIndexVArPctWinTms
+    { "VArPct_WinTms", "VArPct_WinTms", "Time window for VAR limit change.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 18, 16, 1 },
+    // DataPointIndexVArPctRvrtTms
+    { "VArPct_RvrtTms", "VArPct_RvrtTms", "Timeout period for VAR limit.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 19, 17, 1 },
+    // DataPointIndexVArPctRmpTms
+    { "VArPct_RmpTms", "VArPct_RmpTms", "Ramp time for moving from current setpoint to new setpoint.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 20, 18, 1 },
+    // DataPointIndexVArPctMod
+    { "VArPct_Mod", "VArPct_Mod", "Enumerated value. VAR percent limit mode.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, false, 21, 19, 1 },
+    // DataPointIndexVArPctEna
+    { "VArPct_Ena", "VArPct_Ena", "Enumerated valued.  Percent limit VAr enable/disable control.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, true, 22, 20, 1 },
+    // DataPointIndexWMaxLimPctSf
+    { "WMaxLimPct_SF", "WMaxLimPct_SF", "Scale factor for power output percent.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 23, 21, 1 },
+    // DataPointIndexOutPfSetSf
+    { "OutPFSet_SF", "OutPFSet_SF", "Scale factor for power factor.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 24, 22, 1 },
+    // DataPointIndexVArPctSf
+    { "VArPct_SF", "VArPct_SF", "Scale factor for reactive power percent.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 25, 23, 1 }
+};
+
 SunSpecControlsModel::SunSpecControlsModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 123, modelLength, byteOrder, parent)
 {
@@ -69,7 +124,7 @@ QModbusReply *SunSpecControlsModel::setConnWinTms(quint16 connWinTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("Conn_WinTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexConnWinTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(connWinTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -87,7 +142,7 @@ QModbusReply *SunSpecControlsModel::setConnRvrtTms(quint16 connRvrtTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("Conn_RvrtTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexConnRvrtTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(connRvrtTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -105,7 +160,7 @@ QModbusReply *SunSpecControlsModel::setConn(Conn conn)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("Conn");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexConn]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(conn));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -123,7 +178,7 @@ QModbusReply *SunSpecControlsModel::setWMaxLimPct(float wMaxLimPct)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("WMaxLimPct");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexWMaxLimPct]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(wMaxLimPct, m_wMaxLimPctSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -141,7 +196,7 @@ QModbusReply *SunSpecControlsModel::setWMaxLimPctWinTms(quint16 wMaxLimPctWinTms
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("WMaxLimPct_WinTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexWMaxLimPctWinTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(wMaxLimPctWinTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -159,7 +214,7 @@ QModbusReply *SunSpecControlsModel::setWMaxLimPctRvrtTms(quint16 wMaxLimPctRvrtT
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("WMaxLimPct_RvrtTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexWMaxLimPctRvrtTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(wMaxLimPctRvrtTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -177,7 +232,7 @@ QModbusReply *SunSpecControlsModel::setWMaxLimPctRmpTms(quint16 wMaxLimPctRmpTms
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("WMaxLimPct_RmpTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexWMaxLimPctRmpTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(wMaxLimPctRmpTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -195,7 +250,7 @@ QModbusReply *SunSpecControlsModel::setWMaxLimEna(Wmaxlim_ena wMaxLimEna)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("WMaxLim_Ena");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexWMaxLimEna]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(wMaxLimEna));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -213,7 +268,7 @@ QModbusReply *SunSpecControlsModel::setOutPfSet(float outPfSet)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("OutPFSet");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexOutPfSet]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(outPfSet, m_outPfSetSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -231,7 +286,7 @@ QModbusReply *SunSpecControlsModel::setOutPfSetWinTms(quint16 outPfSetWinTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("OutPFSet_WinTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexOutPfSetWinTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(outPfSetWinTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -249,7 +304,7 @@ QModbusReply *SunSpecControlsModel::setOutPfSetRvrtTms(quint16 outPfSetRvrtTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("OutPFSet_RvrtTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexOutPfSetRvrtTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(outPfSetRvrtTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -267,7 +322,7 @@ QModbusReply *SunSpecControlsModel::setOutPfSetRmpTms(quint16 outPfSetRmpTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("OutPFSet_RmpTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexOutPfSetRmpTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(outPfSetRmpTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -285,7 +340,7 @@ QModbusReply *SunSpecControlsModel::setOutPfSetEna(Outpfset_ena outPfSetEna)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("OutPFSet_Ena");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexOutPfSetEna]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(outPfSetEna));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -303,7 +358,7 @@ QModbusReply *SunSpecControlsModel::setVArWMaxPct(float vArWMaxPct)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VArWMaxPct");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVArWMaxPct]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(vArWMaxPct, m_vArPctSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -321,7 +376,7 @@ QModbusReply *SunSpecControlsModel::setVArMaxPct(float vArMaxPct)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VArMaxPct");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVArMaxPct]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(vArMaxPct, m_vArPctSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -339,7 +394,7 @@ QModbusReply *SunSpecControlsModel::setVArAvalPct(float vArAvalPct)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VArAvalPct");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVArAvalPct]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(vArAvalPct, m_vArPctSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -357,7 +412,7 @@ QModbusReply *SunSpecControlsModel::setVArPctWinTms(quint16 vArPctWinTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VArPct_WinTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVArPctWinTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(vArPctWinTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -375,7 +430,7 @@ QModbusReply *SunSpecControlsModel::setVArPctRvrtTms(quint16 vArPctRvrtTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VArPct_RvrtTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVArPctRvrtTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(vArPctRvrtTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -393,7 +448,7 @@ QModbusReply *SunSpecControlsModel::setVArPctRmpTms(quint16 vArPctRmpTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VArPct_RmpTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVArPctRmpTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(vArPctRmpTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -411,7 +466,7 @@ QModbusReply *SunSpecControlsModel::setVArPctMod(Varpct_mod vArPctMod)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VArPct_Mod");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVArPctMod]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(vArPctMod));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -429,7 +484,7 @@ QModbusReply *SunSpecControlsModel::setVArPctEna(Varpct_ena vArPctEna)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VArPct_Ena");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVArPctEna]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(vArPctEna));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -451,429 +506,104 @@ qint16 SunSpecControlsModel::vArPctSf() const
 }
 void SunSpecControlsModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint connWinTmsDataPoint;
-    connWinTmsDataPoint.setName("Conn_WinTms");
-    connWinTmsDataPoint.setLabel("Conn_WinTms");
-    connWinTmsDataPoint.setDescription("Time window for connect/disconnect.");
-    connWinTmsDataPoint.setUnits("Secs");
-    connWinTmsDataPoint.setSize(1);
-    connWinTmsDataPoint.setAddressOffset(2);
-    connWinTmsDataPoint.setBlockOffset(0);
-    connWinTmsDataPoint.setSunSpecDataType("uint16");
-    connWinTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    connWinTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(connWinTmsDataPoint.name(), connWinTmsDataPoint);
-
-    SunSpecDataPoint connRvrtTmsDataPoint;
-    connRvrtTmsDataPoint.setName("Conn_RvrtTms");
-    connRvrtTmsDataPoint.setLabel("Conn_RvrtTms");
-    connRvrtTmsDataPoint.setDescription("Timeout period for connect/disconnect.");
-    connRvrtTmsDataPoint.setUnits("Secs");
-    connRvrtTmsDataPoint.setSize(1);
-    connRvrtTmsDataPoint.setAddressOffset(3);
-    connRvrtTmsDataPoint.setBlockOffset(1);
-    connRvrtTmsDataPoint.setSunSpecDataType("uint16");
-    connRvrtTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    connRvrtTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(connRvrtTmsDataPoint.name(), connRvrtTmsDataPoint);
-
-    SunSpecDataPoint connDataPoint;
-    connDataPoint.setName("Conn");
-    connDataPoint.setLabel("Conn");
-    connDataPoint.setDescription("Enumerated valued.  Connection control.");
-    connDataPoint.setMandatory(true);
-    connDataPoint.setSize(1);
-    connDataPoint.setAddressOffset(4);
-    connDataPoint.setBlockOffset(2);
-    connDataPoint.setSunSpecDataType("enum16");
-    connDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    connDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(connDataPoint.name(), connDataPoint);
-
-    SunSpecDataPoint wMaxLimPctDataPoint;
-    wMaxLimPctDataPoint.setName("WMaxLimPct");
-    wMaxLimPctDataPoint.setLabel("WMaxLimPct");
-    wMaxLimPctDataPoint.setDescription("Set power output to specified level.");
-    wMaxLimPctDataPoint.setUnits("% WMax");
-    wMaxLimPctDataPoint.setMandatory(true);
-    wMaxLimPctDataPoint.setSize(1);
-    wMaxLimPctDataPoint.setAddressOffset(5);
-    wMaxLimPctDataPoint.setBlockOffset(3);
-    wMaxLimPctDataPoint.setScaleFactorName("WMaxLimPct_SF");
-    wMaxLimPctDataPoint.setSunSpecDataType("uint16");
-    wMaxLimPctDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    wMaxLimPctDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wMaxLimPctDataPoint.name(), wMaxLimPctDataPoint);
-
-    SunSpecDataPoint wMaxLimPctWinTmsDataPoint;
-    wMaxLimPctWinTmsDataPoint.setName("WMaxLimPct_WinTms");
-    wMaxLimPctWinTmsDataPoint.setLabel("WMaxLimPct_WinTms");
-    wMaxLimPctWinTmsDataPoint.setDescription("Time window for power limit change.");
-    wMaxLimPctWinTmsDataPoint.setUnits("Secs");
-    wMaxLimPctWinTmsDataPoint.setSize(1);
-    wMaxLimPctWinTmsDataPoint.setAddressOffset(6);
-    wMaxLimPctWinTmsDataPoint.setBlockOffset(4);
-    wMaxLimPctWinTmsDataPoint.setSunSpecDataType("uint16");
-    wMaxLimPctWinTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    wMaxLimPctWinTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wMaxLimPctWinTmsDataPoint.name(), wMaxLimPctWinTmsDataPoint);
-
-    SunSpecDataPoint wMaxLimPctRvrtTmsDataPoint;
-    wMaxLimPctRvrtTmsDataPoint.setName("WMaxLimPct_RvrtTms");
-    wMaxLimPctRvrtTmsDataPoint.setLabel("WMaxLimPct_RvrtTms");
-    wMaxLimPctRvrtTmsDataPoint.setDescription("Timeout period for power limit.");
-    wMaxLimPctRvrtTmsDataPoint.setUnits("Secs");
-    wMaxLimPctRvrtTmsDataPoint.setSize(1);
-    wMaxLimPctRvrtTmsDataPoint.setAddressOffset(7);
-    wMaxLimPctRvrtTmsDataPoint.setBlockOffset(5);
-    wMaxLimPctRvrtTmsDataPoint.setSunSpecDataType("uint16");
-    wMaxLimPctRvrtTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    wMaxLimPctRvrtTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wMaxLimPctRvrtTmsDataPoint.name(), wMaxLimPctRvrtTmsDataPoint);
-
-    SunSpecDataPoint wMaxLimPctRmpTmsDataPoint;
-    wMaxLimPctRmpTmsDataPoint.setName("WMaxLimPct_RmpTms");
-    wMaxLimPctRmpTmsDataPoint.setLabel("WMaxLimPct_RmpTms");
-    wMaxLimPctRmpTmsDataPoint.setDescription("Ramp time for moving from current setpoint to new setpoint.");
-    wMaxLimPctRmpTmsDataPoint.setUnits("Secs");
-    wMaxLimPctRmpTmsDataPoint.setSize(1);
-    wMaxLimPctRmpTmsDataPoint.setAddressOffset(8);
-    wMaxLimPctRmpTmsDataPoint.setBlockOffset(6);
-    wMaxLimPctRmpTmsDataPoint.setSunSpecDataType("uint16");
-    wMaxLimPctRmpTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    wMaxLimPctRmpTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wMaxLimPctRmpTmsDataPoint.name(), wMaxLimPctRmpTmsDataPoint);
-
-    SunSpecDataPoint wMaxLimEnaDataPoint;
-    wMaxLimEnaDataPoint.setName("WMaxLim_Ena");
-    wMaxLimEnaDataPoint.setLabel("WMaxLim_Ena");
-    wMaxLimEnaDataPoint.setDescription("Enumerated valued.  Throttle enable/disable control.");
-    wMaxLimEnaDataPoint.setMandatory(true);
-    wMaxLimEnaDataPoint.setSize(1);
-    wMaxLimEnaDataPoint.setAddressOffset(9);
-    wMaxLimEnaDataPoint.setBlockOffset(7);
-    wMaxLimEnaDataPoint.setSunSpecDataType("enum16");
-    wMaxLimEnaDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    wMaxLimEnaDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wMaxLimEnaDataPoint.name(), wMaxLimEnaDataPoint);
-
-    SunSpecDataPoint outPfSetDataPoint;
-    outPfSetDataPoint.setName("OutPFSet");
-    outPfSetDataPoint.setLabel("OutPFSet");
-    outPfSetDataPoint.setDescription("Set power factor to specific value - cosine of angle.");
-    outPfSetDataPoint.setUnits("cos()");
-    outPfSetDataPoint.setMandatory(true);
-    outPfSetDataPoint.setSize(1);
-    outPfSetDataPoint.setAddressOffset(10);
-    outPfSetDataPoint.setBlockOffset(8);
-    outPfSetDataPoint.setScaleFactorName("OutPFSet_SF");
-    outPfSetDataPoint.setSunSpecDataType("int16");
-    outPfSetDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    outPfSetDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(outPfSetDataPoint.name(), outPfSetDataPoint);
-
-    SunSpecDataPoint outPfSetWinTmsDataPoint;
-    outPfSetWinTmsDataPoint.setName("OutPFSet_WinTms");
-    outPfSetWinTmsDataPoint.setLabel("OutPFSet_WinTms");
-    outPfSetWinTmsDataPoint.setDescription("Time window for power factor change.");
-    outPfSetWinTmsDataPoint.setUnits("Secs");
-    outPfSetWinTmsDataPoint.setSize(1);
-    outPfSetWinTmsDataPoint.setAddressOffset(11);
-    outPfSetWinTmsDataPoint.setBlockOffset(9);
-    outPfSetWinTmsDataPoint.setSunSpecDataType("uint16");
-    outPfSetWinTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    outPfSetWinTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(outPfSetWinTmsDataPoint.name(), outPfSetWinTmsDataPoint);
-
-    SunSpecDataPoint outPfSetRvrtTmsDataPoint;
-    outPfSetRvrtTmsDataPoint.setName("OutPFSet_RvrtTms");
-    outPfSetRvrtTmsDataPoint.setLabel("OutPFSet_RvrtTms");
-    outPfSetRvrtTmsDataPoint.setDescription("Timeout period for power factor.");
-    outPfSetRvrtTmsDataPoint.setUnits("Secs");
-    outPfSetRvrtTmsDataPoint.setSize(1);
-    outPfSetRvrtTmsDataPoint.setAddressOffset(12);
-    outPfSetRvrtTmsDataPoint.setBlockOffset(10);
-    outPfSetRvrtTmsDataPoint.setSunSpecDataType("uint16");
-    outPfSetRvrtTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    outPfSetRvrtTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(outPfSetRvrtTmsDataPoint.name(), outPfSetRvrtTmsDataPoint);
-
-    SunSpecDataPoint outPfSetRmpTmsDataPoint;
-    outPfSetRmpTmsDataPoint.setName("OutPFSet_RmpTms");
-    outPfSetRmpTmsDataPoint.setLabel("OutPFSet_RmpTms");
-    outPfSetRmpTmsDataPoint.setDescription("Ramp time for moving from current setpoint to new setpoint.");
-    outPfSetRmpTmsDataPoint.setUnits("Secs");
-    outPfSetRmpTmsDataPoint.setSize(1);
-    outPfSetRmpTmsDataPoint.setAddressOffset(13);
-    outPfSetRmpTmsDataPoint.setBlockOffset(11);
-    outPfSetRmpTmsDataPoint.setSunSpecDataType("uint16");
-    outPfSetRmpTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    outPfSetRmpTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(outPfSetRmpTmsDataPoint.name(), outPfSetRmpTmsDataPoint);
-
-    SunSpecDataPoint outPfSetEnaDataPoint;
-    outPfSetEnaDataPoint.setName("OutPFSet_Ena");
-    outPfSetEnaDataPoint.setLabel("OutPFSet_Ena");
-    outPfSetEnaDataPoint.setDescription("Enumerated valued.  Fixed power factor enable/disable control.");
-    outPfSetEnaDataPoint.setMandatory(true);
-    outPfSetEnaDataPoint.setSize(1);
-    outPfSetEnaDataPoint.setAddressOffset(14);
-    outPfSetEnaDataPoint.setBlockOffset(12);
-    outPfSetEnaDataPoint.setSunSpecDataType("enum16");
-    outPfSetEnaDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    outPfSetEnaDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(outPfSetEnaDataPoint.name(), outPfSetEnaDataPoint);
-
-    SunSpecDataPoint vArWMaxPctDataPoint;
-    vArWMaxPctDataPoint.setName("VArWMaxPct");
-    vArWMaxPctDataPoint.setLabel("VArWMaxPct");
-    vArWMaxPctDataPoint.setDescription("Reactive power in percent of WMax.");
-    vArWMaxPctDataPoint.setUnits("% WMax");
-    vArWMaxPctDataPoint.setSize(1);
-    vArWMaxPctDataPoint.setAddressOffset(15);
-    vArWMaxPctDataPoint.setBlockOffset(13);
-    vArWMaxPctDataPoint.setScaleFactorName("VArPct_SF");
-    vArWMaxPctDataPoint.setSunSpecDataType("int16");
-    vArWMaxPctDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vArWMaxPctDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArWMaxPctDataPoint.name(), vArWMaxPctDataPoint);
-
-    SunSpecDataPoint vArMaxPctDataPoint;
-    vArMaxPctDataPoint.setName("VArMaxPct");
-    vArMaxPctDataPoint.setLabel("VArMaxPct");
-    vArMaxPctDataPoint.setDescription("Reactive power in percent of VArMax.");
-    vArMaxPctDataPoint.setUnits("% VArMax");
-    vArMaxPctDataPoint.setSize(1);
-    vArMaxPctDataPoint.setAddressOffset(16);
-    vArMaxPctDataPoint.setBlockOffset(14);
-    vArMaxPctDataPoint.setScaleFactorName("VArPct_SF");
-    vArMaxPctDataPoint.setSunSpecDataType("int16");
-    vArMaxPctDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vArMaxPctDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArMaxPctDataPoint.name(), vArMaxPctDataPoint);
-
-    SunSpecDataPoint vArAvalPctDataPoint;
-    vArAvalPctDataPoint.setName("VArAvalPct");
-    vArAvalPctDataPoint.setLabel("VArAvalPct");
-    vArAvalPctDataPoint.setDescription("Reactive power in percent of VArAval.");
-    vArAvalPctDataPoint.setUnits("% VArAval");
-    vArAvalPctDataPoint.setSize(1);
-    vArAvalPctDataPoint.setAddressOffset(17);
-    vArAvalPctDataPoint.setBlockOffset(15);
-    vArAvalPctDataPoint.setScaleFactorName("VArPct_SF");
-    vArAvalPctDataPoint.setSunSpecDataType("int16");
-    vArAvalPctDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vArAvalPctDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArAvalPctDataPoint.name(), vArAvalPctDataPoint);
-
-    SunSpecDataPoint vArPctWinTmsDataPoint;
-    vArPctWinTmsDataPoint.setName("VArPct_WinTms");
-    vArPctWinTmsDataPoint.setLabel("VArPct_WinTms");
-    vArPctWinTmsDataPoint.setDescription("Time window for VAR limit change.");
-    vArPctWinTmsDataPoint.setUnits("Secs");
-    vArPctWinTmsDataPoint.setSize(1);
-    vArPctWinTmsDataPoint.setAddressOffset(18);
-    vArPctWinTmsDataPoint.setBlockOffset(16);
-    vArPctWinTmsDataPoint.setSunSpecDataType("uint16");
-    vArPctWinTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vArPctWinTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArPctWinTmsDataPoint.name(), vArPctWinTmsDataPoint);
-
-    SunSpecDataPoint vArPctRvrtTmsDataPoint;
-    vArPctRvrtTmsDataPoint.setName("VArPct_RvrtTms");
-    vArPctRvrtTmsDataPoint.setLabel("VArPct_RvrtTms");
-    vArPctRvrtTmsDataPoint.setDescription("Timeout period for VAR limit.");
-    vArPctRvrtTmsDataPoint.setUnits("Secs");
-    vArPctRvrtTmsDataPoint.setSize(1);
-    vArPctRvrtTmsDataPoint.setAddressOffset(19);
-    vArPctRvrtTmsDataPoint.setBlockOffset(17);
-    vArPctRvrtTmsDataPoint.setSunSpecDataType("uint16");
-    vArPctRvrtTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vArPctRvrtTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArPctRvrtTmsDataPoint.name(), vArPctRvrtTmsDataPoint);
-
-    SunSpecDataPoint vArPctRmpTmsDataPoint;
-    vArPctRmpTmsDataPoint.setName("VArPct_RmpTms");
-    vArPctRmpTmsDataPoint.setLabel("VArPct_RmpTms");
-    vArPctRmpTmsDataPoint.setDescription("Ramp time for moving from current setpoint to new setpoint.");
-    vArPctRmpTmsDataPoint.setUnits("Secs");
-    vArPctRmpTmsDataPoint.setSize(1);
-    vArPctRmpTmsDataPoint.setAddressOffset(20);
-    vArPctRmpTmsDataPoint.setBlockOffset(18);
-    vArPctRmpTmsDataPoint.setSunSpecDataType("uint16");
-    vArPctRmpTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vArPctRmpTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArPctRmpTmsDataPoint.name(), vArPctRmpTmsDataPoint);
-
-    SunSpecDataPoint vArPctModDataPoint;
-    vArPctModDataPoint.setName("VArPct_Mod");
-    vArPctModDataPoint.setLabel("VArPct_Mod");
-    vArPctModDataPoint.setDescription("Enumerated value. VAR percent limit mode.");
-    vArPctModDataPoint.setSize(1);
-    vArPctModDataPoint.setAddressOffset(21);
-    vArPctModDataPoint.setBlockOffset(19);
-    vArPctModDataPoint.setSunSpecDataType("enum16");
-    vArPctModDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vArPctModDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArPctModDataPoint.name(), vArPctModDataPoint);
-
-    SunSpecDataPoint vArPctEnaDataPoint;
-    vArPctEnaDataPoint.setName("VArPct_Ena");
-    vArPctEnaDataPoint.setLabel("VArPct_Ena");
-    vArPctEnaDataPoint.setDescription("Enumerated valued.  Percent limit VAr enable/disable control.");
-    vArPctEnaDataPoint.setMandatory(true);
-    vArPctEnaDataPoint.setSize(1);
-    vArPctEnaDataPoint.setAddressOffset(22);
-    vArPctEnaDataPoint.setBlockOffset(20);
-    vArPctEnaDataPoint.setSunSpecDataType("enum16");
-    vArPctEnaDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vArPctEnaDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArPctEnaDataPoint.name(), vArPctEnaDataPoint);
-
-    SunSpecDataPoint wMaxLimPctSfDataPoint;
-    wMaxLimPctSfDataPoint.setName("WMaxLimPct_SF");
-    wMaxLimPctSfDataPoint.setLabel("WMaxLimPct_SF");
-    wMaxLimPctSfDataPoint.setDescription("Scale factor for power output percent.");
-    wMaxLimPctSfDataPoint.setMandatory(true);
-    wMaxLimPctSfDataPoint.setSize(1);
-    wMaxLimPctSfDataPoint.setAddressOffset(23);
-    wMaxLimPctSfDataPoint.setBlockOffset(21);
-    wMaxLimPctSfDataPoint.setSunSpecDataType("sunssf");
-    wMaxLimPctSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wMaxLimPctSfDataPoint.name(), wMaxLimPctSfDataPoint);
-
-    SunSpecDataPoint outPfSetSfDataPoint;
-    outPfSetSfDataPoint.setName("OutPFSet_SF");
-    outPfSetSfDataPoint.setLabel("OutPFSet_SF");
-    outPfSetSfDataPoint.setDescription("Scale factor for power factor.");
-    outPfSetSfDataPoint.setMandatory(true);
-    outPfSetSfDataPoint.setSize(1);
-    outPfSetSfDataPoint.setAddressOffset(24);
-    outPfSetSfDataPoint.setBlockOffset(22);
-    outPfSetSfDataPoint.setSunSpecDataType("sunssf");
-    outPfSetSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(outPfSetSfDataPoint.name(), outPfSetSfDataPoint);
-
-    SunSpecDataPoint vArPctSfDataPoint;
-    vArPctSfDataPoint.setName("VArPct_SF");
-    vArPctSfDataPoint.setLabel("VArPct_SF");
-    vArPctSfDataPoint.setDescription("Scale factor for reactive power percent.");
-    vArPctSfDataPoint.setSize(1);
-    vArPctSfDataPoint.setAddressOffset(25);
-    vArPctSfDataPoint.setBlockOffset(23);
-    vArPctSfDataPoint.setSunSpecDataType("sunssf");
-    vArPctSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArPctSfDataPoint.name(), vArPctSfDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 26;
 }
 
 void SunSpecControlsModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("WMaxLimPct_SF").isValid())
-        m_wMaxLimPctSf = m_dataPoints.value("WMaxLimPct_SF").toInt16();
+    if (registerCount >= 24 && SunSpecDataPoint::isValid(registers + 23, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 23, 1);
+        if (scaleFactor != m_wMaxLimPctSf) {
+            m_wMaxLimPctSf = scaleFactor;
+            m_wMaxLimPctSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("OutPFSet_SF").isValid())
-        m_outPfSetSf = m_dataPoints.value("OutPFSet_SF").toInt16();
+    if (registerCount >= 25 && SunSpecDataPoint::isValid(registers + 24, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 24, 1);
+        if (scaleFactor != m_outPfSetSf) {
+            m_outPfSetSf = scaleFactor;
+            m_outPfSetSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("VArPct_SF").isValid())
-        m_vArPctSf = m_dataPoints.value("VArPct_SF").toInt16();
+    if (registerCount >= 26 && SunSpecDataPoint::isValid(registers + 25, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 25, 1);
+        if (scaleFactor != m_vArPctSf) {
+            m_vArPctSf = scaleFactor;
+            m_vArPctSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("Conn_WinTms").isValid())
-        m_connWinTms = m_dataPoints.value("Conn_WinTms").toUInt16();
-
-    if (m_dataPoints.value("Conn_RvrtTms").isValid())
-        m_connRvrtTms = m_dataPoints.value("Conn_RvrtTms").toUInt16();
-
-    if (m_dataPoints.value("Conn").isValid())
-        m_conn = static_cast<Conn>(m_dataPoints.value("Conn").toUInt16());
-
-    if (m_dataPoints.value("WMaxLimPct").isValid())
-        m_wMaxLimPct = m_dataPoints.value("WMaxLimPct").toFloatWithSSF(m_wMaxLimPctSf);
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_connWinTms = SunSpecDataPoint::convertToUInt16(registers + 2, 1);
 
-    if (m_dataPoints.value("WMaxLimPct_WinTms").isValid())
-        m_wMaxLimPctWinTms = m_dataPoints.value("WMaxLimPct_WinTms").toUInt16();
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_connRvrtTms = SunSpecDataPoint::convertToUInt16(registers + 3, 1);
 
-    if (m_dataPoints.value("WMaxLimPct_RvrtTms").isValid())
-        m_wMaxLimPctRvrtTms = m_dataPoints.value("WMaxLimPct_RvrtTms").toUInt16();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_conn = static_cast<Conn>(SunSpecDataPoint::convertToUInt16(registers + 4, 1));
 
-    if (m_dataPoints.value("WMaxLimPct_RmpTms").isValid())
-        m_wMaxLimPctRmpTms = m_dataPoints.value("WMaxLimPct_RmpTms").toUInt16();
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_wMaxLimPct = SunSpecDataPoint::convertToUInt16(registers + 5, 1) * m_wMaxLimPctSfMultiplier;
 
-    if (m_dataPoints.value("WMaxLim_Ena").isValid())
-        m_wMaxLimEna = static_cast<Wmaxlim_ena>(m_dataPoints.value("WMaxLim_Ena").toUInt16());
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_wMaxLimPctWinTms = SunSpecDataPoint::convertToUInt16(registers + 6, 1);
 
-    if (m_dataPoints.value("OutPFSet").isValid())
-        m_outPfSet = m_dataPoints.value("OutPFSet").toFloatWithSSF(m_outPfSetSf);
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_wMaxLimPctRvrtTms = SunSpecDataPoint::convertToUInt16(registers + 7, 1);
 
-    if (m_dataPoints.value("OutPFSet_WinTms").isValid())
-        m_outPfSetWinTms = m_dataPoints.value("OutPFSet_WinTms").toUInt16();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_wMaxLimPctRmpTms = SunSpecDataPoint::convertToUInt16(registers + 8, 1);
 
-    if (m_dataPoints.value("OutPFSet_RvrtTms").isValid())
-        m_outPfSetRvrtTms = m_dataPoints.value("OutPFSet_RvrtTms").toUInt16();
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_wMaxLimEna = static_cast<Wmaxlim_ena>(SunSpecDataPoint::convertToUInt16(registers + 9, 1));
 
-    if (m_dataPoints.value("OutPFSet_RmpTms").isValid())
-        m_outPfSetRmpTms = m_dataPoints.value("OutPFSet_RmpTms").toUInt16();
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_outPfSet = SunSpecDataPoint::convertToInt16(registers + 10, 1) * m_outPfSetSfMultiplier;
 
-    if (m_dataPoints.value("OutPFSet_Ena").isValid())
-        m_outPfSetEna = static_cast<Outpfset_ena>(m_dataPoints.value("OutPFSet_Ena").toUInt16());
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_outPfSetWinTms = SunSpecDataPoint::convertToUInt16(registers + 11, 1);
 
-    if (m_dataPoints.value("VArWMaxPct").isValid())
-        m_vArWMaxPct = m_dataPoints.value("VArWMaxPct").toFloatWithSSF(m_vArPctSf);
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 12, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_outPfSetRvrtTms = SunSpecDataPoint::convertToUInt16(registers + 12, 1);
 
-    if (m_dataPoints.value("VArMaxPct").isValid())
-        m_vArMaxPct = m_dataPoints.value("VArMaxPct").toFloatWithSSF(m_vArPctSf);
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 13, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_outPfSetRmpTms = SunSpecDataPoint::convertToUInt16(registers + 13, 1);
 
-    if (m_dataPoints.value("VArAvalPct").isValid())
-        m_vArAvalPct = m_dataPoints.value("VArAvalPct").toFloatWithSSF(m_vArPctSf);
+    if (registerCount >= 15 && SunSpecDataPoint::isValid(registers + 14, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_outPfSetEna = static_cast<Outpfset_ena>(SunSpecDataPoint::convertToUInt16(registers + 14, 1));
 
-    if (m_dataPoints.value("VArPct_WinTms").isValid())
-        m_vArPctWinTms = m_dataPoints.value("VArPct_WinTms").toUInt16();
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 15, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_vArWMaxPct = SunSpecDataPoint::convertToInt16(registers + 15, 1) * m_vArPctSfMultiplier;
 
-    if (m_dataPoints.value("VArPct_RvrtTms").isValid())
-        m_vArPctRvrtTms = m_dataPoints.value("VArPct_RvrtTms").toUInt16();
+    if (registerCount >= 17 && SunSpecDataPoint::isValid(registers + 16, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_vArMaxPct = SunSpecDataPoint::convertToInt16(registers + 16, 1) * m_vArPctSfMultiplier;
 
-    if (m_dataPoints.value("VArPct_RmpTms").isValid())
-        m_vArPctRmpTms = m_dataPoints.value("VArPct_RmpTms").toUInt16();
+    if (registerCount >= 18 && SunSpecDataPoint::isValid(registers + 17, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_vArAvalPct = SunSpecDataPoint::convertToInt16(registers + 17, 1) * m_vArPctSfMultiplier;
 
-    if (m_dataPoints.value("VArPct_Mod").isValid())
-        m_vArPctMod = static_cast<Varpct_mod>(m_dataPoints.value("VArPct_Mod").toUInt16());
+    if (registerCount >= 19 && SunSpecDataPoint::isValid(registers + 18, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_vArPctWinTms = SunSpecDataPoint::convertToUInt16(registers + 18, 1);
 
-    if (m_dataPoints.value("VArPct_Ena").isValid())
-        m_vArPctEna = static_cast<Varpct_ena>(m_dataPoints.value("VArPct_Ena").toUInt16());
+    if (registerCount >= 20 && SunSpecDataPoint::isValid(registers + 19, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_vArPctRvrtTms = SunSpecDataPoint::convertToUInt16(registers + 19, 1);
 
-    if (m_dataPoints.value("WMaxLimPct_SF").isValid())
-        m_wMaxLimPctSf = m_dataPoints.value("WMaxLimPct_SF").toInt16();
+    if (registerCount >= 21 && SunSpecDataPoint::isValid(registers + 20, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_vArPctRmpTms = SunSpecDataPoint::convertToUInt16(registers + 20, 1);
 
-    if (m_dataPoints.value("OutPFSet_SF").isValid())
-        m_outPfSetSf = m_dataPoints.value("OutPFSet_SF").toInt16();
+    if (registerCount >= 22 && SunSpecDataPoint::isValid(registers + 21, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_vArPctMod = static_cast<Varpct_mod>(SunSpecDataPoint::convertToUInt16(registers + 21, 1));
 
-    if (m_dataPoints.value("VArPct_SF").isValid())
-        m_vArPctSf = m_dataPoints.value("VArPct_SF").toInt16();
+    if (registerCount >= 23 && SunSpecDataPoint::isValid(registers + 22, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_vArPctEna = static_cast<Varpct_ena>(SunSpecDataPoint::convertToUInt16(registers + 22, 1));
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -882,148 +612,148 @@ void SunSpecControlsModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecControlsModel *model)
 {
     debug.nospace().noquote() << "SunSpecControlsModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Conn_WinTms") << "-->";
-    if (model->dataPoints().value("Conn_WinTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexConnWinTms) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexConnWinTms).isValid()) {
         debug.nospace().noquote() << model->connWinTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Conn_RvrtTms") << "-->";
-    if (model->dataPoints().value("Conn_RvrtTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexConnRvrtTms) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexConnRvrtTms).isValid()) {
         debug.nospace().noquote() << model->connRvrtTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Conn") << "-->";
-    if (model->dataPoints().value("Conn").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexConn) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexConn).isValid()) {
         debug.nospace().noquote() << model->conn() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WMaxLimPct") << "-->";
-    if (model->dataPoints().value("WMaxLimPct").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexWMaxLimPct) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexWMaxLimPct).isValid()) {
         debug.nospace().noquote() << model->wMaxLimPct() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WMaxLimPct_WinTms") << "-->";
-    if (model->dataPoints().value("WMaxLimPct_WinTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexWMaxLimPctWinTms) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexWMaxLimPctWinTms).isValid()) {
         debug.nospace().noquote() << model->wMaxLimPctWinTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WMaxLimPct_RvrtTms") << "-->";
-    if (model->dataPoints().value("WMaxLimPct_RvrtTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexWMaxLimPctRvrtTms) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexWMaxLimPctRvrtTms).isValid()) {
         debug.nospace().noquote() << model->wMaxLimPctRvrtTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WMaxLimPct_RmpTms") << "-->";
-    if (model->dataPoints().value("WMaxLimPct_RmpTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexWMaxLimPctRmpTms) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexWMaxLimPctRmpTms).isValid()) {
         debug.nospace().noquote() << model->wMaxLimPctRmpTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WMaxLim_Ena") << "-->";
-    if (model->dataPoints().value("WMaxLim_Ena").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexWMaxLimEna) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexWMaxLimEna).isValid()) {
         debug.nospace().noquote() << model->wMaxLimEna() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("OutPFSet") << "-->";
-    if (model->dataPoints().value("OutPFSet").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexOutPfSet) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexOutPfSet).isValid()) {
         debug.nospace().noquote() << model->outPfSet() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("OutPFSet_WinTms") << "-->";
-    if (model->dataPoints().value("OutPFSet_WinTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexOutPfSetWinTms) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexOutPfSetWinTms).isValid()) {
         debug.nospace().noquote() << model->outPfSetWinTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("OutPFSet_RvrtTms") << "-->";
-    if (model->dataPoints().value("OutPFSet_RvrtTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexOutPfSetRvrtTms) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexOutPfSetRvrtTms).isValid()) {
         debug.nospace().noquote() << model->outPfSetRvrtTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("OutPFSet_RmpTms") << "-->";
-    if (model->dataPoints().value("OutPFSet_RmpTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexOutPfSetRmpTms) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexOutPfSetRmpTms).isValid()) {
         debug.nospace().noquote() << model->outPfSetRmpTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("OutPFSet_Ena") << "-->";
-    if (model->dataPoints().value("OutPFSet_Ena").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexOutPfSetEna) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexOutPfSetEna).isValid()) {
         debug.nospace().noquote() << model->outPfSetEna() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArWMaxPct") << "-->";
-    if (model->dataPoints().value("VArWMaxPct").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexVArWMaxPct) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexVArWMaxPct).isValid()) {
         debug.nospace().noquote() << model->vArWMaxPct() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArMaxPct") << "-->";
-    if (model->dataPoints().value("VArMaxPct").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexVArMaxPct) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexVArMaxPct).isValid()) {
         debug.nospace().noquote() << model->vArMaxPct() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArAvalPct") << "-->";
-    if (model->dataPoints().value("VArAvalPct").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexVArAvalPct) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexVArAvalPct).isValid()) {
         debug.nospace().noquote() << model->vArAvalPct() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArPct_WinTms") << "-->";
-    if (model->dataPoints().value("VArPct_WinTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexVArPctWinTms) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexVArPctWinTms).isValid()) {
         debug.nospace().noquote() << model->vArPctWinTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArPct_RvrtTms") << "-->";
-    if (model->dataPoints().value("VArPct_RvrtTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexVArPctRvrtTms) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexVArPctRvrtTms).isValid()) {
         debug.nospace().noquote() << model->vArPctRvrtTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArPct_RmpTms") << "-->";
-    if (model->dataPoints().value("VArPct_RmpTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexVArPctRmpTms) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexVArPctRmpTms).isValid()) {
         debug.nospace().noquote() << model->vArPctRmpTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArPct_Mod") << "-->";
-    if (model->dataPoints().value("VArPct_Mod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexVArPctMod) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexVArPctMod).isValid()) {
         debug.nospace().noquote() << model->vArPctMod() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArPct_Ena") << "-->";
-    if (model->dataPoints().value("VArPct_Ena").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecControlsModel::DataPointIndexVArPctEna) << "-->";
+    if (model->dataPoint(SunSpecControlsModel::DataPointIndexVArPctEna).isValid()) {
         debug.nospace().noquote() << model->vArPctEna() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
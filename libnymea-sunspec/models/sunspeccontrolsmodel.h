@@ -74,6 +74,35 @@ public:
     };
     Q_ENUM(Varpct_ena)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexConnWinTms,
+        DataPointIndexConnRvrtTms,
+        DataPointIndexConn,
+        DataPointIndexWMaxLimPct,
+        DataPointIndexWMaxLimPctWinTms,
+        DataPointIndexWMaxLimPctRvrtTms,
+        DataPointIndexWMaxLimPctRmpTms,
+        DataPointIndexWMaxLimEna,
+        DataPointIndexOutPfSet,
+        DataPointIndexOutPfSetWinTms,
+        DataPointIndexOutPfSetRvrtTms,
+        DataPointIndexOutPfSetRmpTms,
+        DataPointIndexOutPfSetEna,
+        DataPointIndexVArWMaxPct,
+        DataPointIndexVArMaxPct,
+        DataPointIndexVArAvalPct,
+        DataPointIndexVArPctWinTms,
+        DataPointIndexVArPctRvrtTms,
+        DataPointIndexVArPctRmpTms,
+        DataPointIndexVArPctMod,
+        DataPointIndexVArPctEna,
+        DataPointIndexWMaxLimPctSf,
+        DataPointIndexOutPfSetSf,
+        DataPointIndexVArPctSf
+    };
+
     explicit SunSpecControlsModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecControlsModel() override; 
 
@@ -202,8 +231,11 @@ private:
     Varpct_mod m_vArPctMod;
     Varpct_ena m_vArPctEna;
     qint16 m_wMaxLimPctSf = 0;
+    double m_wMaxLimPctSfMultiplier = 1;
     qint16 m_outPfSetSf = 0;
+    double m_outPfSetSfMultiplier = 1;
     qint16 m_vArPctSf = 0;
+    double m_vArPctSfMultiplier = 1;
 
 
 };
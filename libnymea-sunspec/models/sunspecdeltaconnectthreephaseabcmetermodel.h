@@ -76,6 +76,73 @@ public:
     Q_DECLARE_FLAGS(EvtFlags, Evt)
     Q_FLAG(Evt)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexAmps,
+        DataPointIndexAmpsPhaseA,
+        DataPointIndexAmpsPhaseB,
+        DataPointIndexAmpsPhaseC,
+        DataPointIndexVoltageLn,
+        DataPointIndexPhaseVoltageAn,
+        DataPointIndexPhaseVoltageBn,
+        DataPointIndexPhaseVoltageCn,
+        DataPointIndexVoltageLl,
+        DataPointIndexPhaseVoltageAb,
+        DataPointIndexPhaseVoltageBc,
+        DataPointIndexPhaseVoltageCa,
+        DataPointIndexHz,
+        DataPointIndexWatts,
+        DataPointIndexWattsPhaseA,
+        DataPointIndexWattsPhaseB,
+        DataPointIndexWattsPhaseC,
+        DataPointIndexVa,
+        DataPointIndexVaPhaseA,
+        DataPointIndexVaPhaseB,
+        DataPointIndexVaPhaseC,
+        DataPointIndexVar,
+        DataPointIndexVarPhaseA,
+        DataPointIndexVarPhaseB,
+        DataPointIndexVarPhaseC,
+        DataPointIndexPf,
+        DataPointIndexPfPhaseA,
+        DataPointIndexPfPhaseB,
+        DataPointIndexPfPhaseC,
+        DataPointIndexTotalWattHoursExported,
+        DataPointIndexTotalWattHoursExportedPhaseA,
+        DataPointIndexTotalWattHoursExportedPhaseB,
+        DataPointIndexTotalWattHoursExportedPhaseC,
+        DataPointIndexTotalWattHoursImported,
+        DataPointIndexTotalWattHoursImportedPhaseA,
+        DataPointIndexTotalWattHoursImportedPhaseB,
+        DataPointIndexTotalWattHoursImportedPhaseC,
+        DataPointIndexTotalVaHoursExported,
+        DataPointIndexTotalVaHoursExportedPhaseA,
+        DataPointIndexTotalVaHoursExportedPhaseB,
+        DataPointIndexTotalVaHoursExportedPhaseC,
+        DataPointIndexTotalVaHoursImported,
+        DataPointIndexTotalVaHoursImportedPhaseA,
+        DataPointIndexTotalVaHoursImportedPhaseB,
+        DataPointIndexTotalVaHoursImportedPhaseC,
+        DataPointIndexTotalVarHoursImportedQ1,
+        DataPointIndexTotalVArHoursImportedQ1PhaseA,
+        DataPointIndexTotalVArHoursImportedQ1PhaseB,
+        DataPointIndexTotalVArHoursImportedQ1PhaseC,
+        DataPointIndexTotalVArHoursImportedQ2,
+        DataPointIndexTotalVArHoursImportedQ2PhaseA,
+        DataPointIndexTotalVArHoursImportedQ2PhaseB,
+        DataPointIndexTotalVArHoursImportedQ2PhaseC,
+        DataPointIndexTotalVArHoursExportedQ3,
+        DataPointIndexTotalVArHoursExportedQ3PhaseA,
+        DataPointIndexTotalVArHoursExportedQ3PhaseB,
+        DataPointIndexTotalVArHoursExportedQ3PhaseC,
+        DataPointIndexTotalVArHoursExportedQ4,
+        DataPointIndexTotalVArHoursExportedQ4ImportedPhaseA,
+        DataPointIndexTotalVArHoursExportedQ4ImportedPhaseB,
+        DataPointIndexTotalVArHoursExportedQ4ImportedPhaseC,
+        DataPointIndexEvents
+    };
+
     explicit SunSpecDeltaConnectThreePhaseAbcMeterModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecDeltaConnectThreePhaseAbcMeterModel() override; 
 
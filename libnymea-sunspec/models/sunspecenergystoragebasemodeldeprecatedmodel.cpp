@@ -31,6 +31,15 @@
 #include "sunspecenergystoragebasemodeldeprecatedmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexDeprecatedModel
+    { "DEPRECATED", "Deprecated Model", "This model has been deprecated.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, true, 2, 0, 1 }
+};
+
 SunSpecEnergyStorageBaseModelDeprecatedModel::SunSpecEnergyStorageBaseModelDeprecatedModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 801, modelLength, byteOrder, parent)
 {
@@ -65,47 +74,18 @@ quint16 SunSpecEnergyStorageBaseModelDeprecatedModel::deprecatedModel() const
 }
 void SunSpecEnergyStorageBaseModelDeprecatedModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint deprecatedModelDataPoint;
-    deprecatedModelDataPoint.setName("DEPRECATED");
-    deprecatedModelDataPoint.setLabel("Deprecated Model");
-    deprecatedModelDataPoint.setDescription("This model has been deprecated.");
-    deprecatedModelDataPoint.setMandatory(true);
-    deprecatedModelDataPoint.setSize(1);
-    deprecatedModelDataPoint.setAddressOffset(2);
-    deprecatedModelDataPoint.setBlockOffset(0);
-    deprecatedModelDataPoint.setSunSpecDataType("enum16");
-    deprecatedModelDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(deprecatedModelDataPoint.name(), deprecatedModelDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 3;
 }
 
 void SunSpecEnergyStorageBaseModelDeprecatedModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("DEPRECATED").isValid())
-        m_deprecatedModel = m_dataPoints.value("DEPRECATED").toUInt16();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_deprecatedModel = SunSpecDataPoint::convertToUInt16(registers + 2, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -114,8 +94,8 @@ void SunSpecEnergyStorageBaseModelDeprecatedModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecEnergyStorageBaseModelDeprecatedModel *model)
 {
     debug.nospace().noquote() << "SunSpecEnergyStorageBaseModelDeprecatedModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("DEPRECATED") << "-->";
-    if (model->dataPoints().value("DEPRECATED").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecEnergyStorageBaseModelDeprecatedModel::DataPointIndexDeprecatedModel) << "-->";
+    if (model->dataPoint(SunSpecEnergyStorageBaseModelDeprecatedModel::DataPointIndexDeprecatedModel).isValid()) {
         debug.nospace().noquote() << model->deprecatedModel() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
@@ -42,6 +42,12 @@ class SunSpecEnergyStorageBaseModelDeprecatedModel : public SunSpecModel
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexDeprecatedModel
+    };
+
     explicit SunSpecEnergyStorageBaseModelDeprecatedModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecEnergyStorageBaseModelDeprecatedModel() override; 
 
@@ -31,6 +31,29 @@
 #include "sunspecextsettingsmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexRampUpRate
+    { "NomRmpUpRte", "Ramp Up Rate", "Ramp up rate as a percentage of max current.", nullptr, "Pct", "uint16", "Rmp_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 2, 0, 1 },
+    // DataPointIndexNomRmpDnRte
+    { "NomRmpDnRte", "NomRmpDnRte", "Ramp down rate as a percentage of max current.", nullptr, "Pct", "uint16", "Rmp_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 3, 1, 1 },
+    // DataPointIndexEmergencyRampUpRate
+    { "EmgRmpUpRte", "Emergency Ramp Up Rate", "Emergency ramp up rate as a percentage of max current.", nullptr, "Pct", "uint16", "Rmp_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 4, 2, 1 },
+    // DataPointIndexEmergencyRampDownRate
+    { "EmgRmpDnRte", "Emergency Ramp Down Rate", "Emergency ramp down rate as a percentage of max current.", nullptr, "Pct", "uint16", "Rmp_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 5, 3, 1 },
+    // DataPointIndexConnectRampUpRate
+    { "ConnRmpUpRte", "Connect Ramp Up Rate", "Connect ramp up rate as a percentage of max current.", nullptr, "Pct", "uint16", "Rmp_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 6, 4, 1 },
+    // DataPointIndexConnectRampDownRate
+    { "ConnRmpDnRte", "Connect Ramp Down Rate", "Connect ramp down rate as a percentage of max current.", nullptr, "Pct", "uint16", "Rmp_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 7, 5, 1 },
+    // DataPointIndexDefaultRampRate
+    { "AGra", "Default Ramp Rate", "Ramp rate specified in percent of max current.", nullptr, "Pct", "uint16", "Rmp_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 8, 6, 1 },
+    // DataPointIndexRampRateScaleFactor
+    { "Rmp_SF", "Ramp Rate Scale Factor", "Ramp Rate Scale Factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 9, 7, 1 }
+};
+
 SunSpecExtSettingsModel::SunSpecExtSettingsModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 145, modelLength, byteOrder, parent)
 {
@@ -69,7 +92,7 @@ QModbusReply *SunSpecExtSettingsModel::setRampUpRate(float rampUpRate)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("NomRmpUpRte");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexRampUpRate]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(rampUpRate, m_rampRateScaleFactor, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -87,7 +110,7 @@ QModbusReply *SunSpecExtSettingsModel::setNomRmpDnRte(float nomRmpDnRte)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("NomRmpDnRte");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexNomRmpDnRte]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(nomRmpDnRte, m_rampRateScaleFactor, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -105,7 +128,7 @@ QModbusReply *SunSpecExtSettingsModel::setEmergencyRampUpRate(float emergencyRam
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("EmgRmpUpRte");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexEmergencyRampUpRate]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(emergencyRampUpRate, m_rampRateScaleFactor, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -123,7 +146,7 @@ QModbusReply *SunSpecExtSettingsModel::setEmergencyRampDownRate(float emergencyR
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("EmgRmpDnRte");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexEmergencyRampDownRate]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(emergencyRampDownRate, m_rampRateScaleFactor, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -141,7 +164,7 @@ QModbusReply *SunSpecExtSettingsModel::setConnectRampUpRate(float connectRampUpR
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ConnRmpUpRte");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexConnectRampUpRate]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(connectRampUpRate, m_rampRateScaleFactor, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -159,7 +182,7 @@ QModbusReply *SunSpecExtSettingsModel::setConnectRampDownRate(float connectRampD
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ConnRmpDnRte");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexConnectRampDownRate]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(connectRampDownRate, m_rampRateScaleFactor, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -177,7 +200,7 @@ QModbusReply *SunSpecExtSettingsModel::setDefaultRampRate(float defaultRampRate)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("AGra");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexDefaultRampRate]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(defaultRampRate, m_rampRateScaleFactor, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -191,170 +214,46 @@ qint16 SunSpecExtSettingsModel::rampRateScaleFactor() const
 }
 void SunSpecExtSettingsModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint rampUpRateDataPoint;
-    rampUpRateDataPoint.setName("NomRmpUpRte");
-    rampUpRateDataPoint.setLabel("Ramp Up Rate");
-    rampUpRateDataPoint.setDescription("Ramp up rate as a percentage of max current.");
-    rampUpRateDataPoint.setUnits("Pct");
-    rampUpRateDataPoint.setSize(1);
-    rampUpRateDataPoint.setAddressOffset(2);
-    rampUpRateDataPoint.setBlockOffset(0);
-    rampUpRateDataPoint.setScaleFactorName("Rmp_SF");
-    rampUpRateDataPoint.setSunSpecDataType("uint16");
-    rampUpRateDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    rampUpRateDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rampUpRateDataPoint.name(), rampUpRateDataPoint);
-
-    SunSpecDataPoint nomRmpDnRteDataPoint;
-    nomRmpDnRteDataPoint.setName("NomRmpDnRte");
-    nomRmpDnRteDataPoint.setLabel("NomRmpDnRte");
-    nomRmpDnRteDataPoint.setDescription("Ramp down rate as a percentage of max current.");
-    nomRmpDnRteDataPoint.setUnits("Pct");
-    nomRmpDnRteDataPoint.setSize(1);
-    nomRmpDnRteDataPoint.setAddressOffset(3);
-    nomRmpDnRteDataPoint.setBlockOffset(1);
-    nomRmpDnRteDataPoint.setScaleFactorName("Rmp_SF");
-    nomRmpDnRteDataPoint.setSunSpecDataType("uint16");
-    nomRmpDnRteDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    nomRmpDnRteDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(nomRmpDnRteDataPoint.name(), nomRmpDnRteDataPoint);
-
-    SunSpecDataPoint emergencyRampUpRateDataPoint;
-    emergencyRampUpRateDataPoint.setName("EmgRmpUpRte");
-    emergencyRampUpRateDataPoint.setLabel("Emergency Ramp Up Rate");
-    emergencyRampUpRateDataPoint.setDescription("Emergency ramp up rate as a percentage of max current.");
-    emergencyRampUpRateDataPoint.setUnits("Pct");
-    emergencyRampUpRateDataPoint.setSize(1);
-    emergencyRampUpRateDataPoint.setAddressOffset(4);
-    emergencyRampUpRateDataPoint.setBlockOffset(2);
-    emergencyRampUpRateDataPoint.setScaleFactorName("Rmp_SF");
-    emergencyRampUpRateDataPoint.setSunSpecDataType("uint16");
-    emergencyRampUpRateDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    emergencyRampUpRateDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(emergencyRampUpRateDataPoint.name(), emergencyRampUpRateDataPoint);
-
-    SunSpecDataPoint emergencyRampDownRateDataPoint;
-    emergencyRampDownRateDataPoint.setName("EmgRmpDnRte");
-    emergencyRampDownRateDataPoint.setLabel("Emergency Ramp Down Rate");
-    emergencyRampDownRateDataPoint.setDescription("Emergency ramp down rate as a percentage of max current.");
-    emergencyRampDownRateDataPoint.setUnits("Pct");
-    emergencyRampDownRateDataPoint.setSize(1);
-    emergencyRampDownRateDataPoint.setAddressOffset(5);
-    emergencyRampDownRateDataPoint.setBlockOffset(3);
-    emergencyRampDownRateDataPoint.setScaleFactorName("Rmp_SF");
-    emergencyRampDownRateDataPoint.setSunSpecDataType("uint16");
-    emergencyRampDownRateDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    emergencyRampDownRateDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(emergencyRampDownRateDataPoint.name(), emergencyRampDownRateDataPoint);
-
-    SunSpecDataPoint connectRampUpRateDataPoint;
-    connectRampUpRateDataPoint.setName("ConnRmpUpRte");
-    connectRampUpRateDataPoint.setLabel("Connect Ramp Up Rate");
-    connectRampUpRateDataPoint.setDescription("Connect ramp up rate as a percentage of max current.");
-    connectRampUpRateDataPoint.setUnits("Pct");
-    connectRampUpRateDataPoint.setSize(1);
-    connectRampUpRateDataPoint.setAddressOffset(6);
-    connectRampUpRateDataPoint.setBlockOffset(4);
-    connectRampUpRateDataPoint.setScaleFactorName("Rmp_SF");
-    connectRampUpRateDataPoint.setSunSpecDataType("uint16");
-    connectRampUpRateDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    connectRampUpRateDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(connectRampUpRateDataPoint.name(), connectRampUpRateDataPoint);
-
-    SunSpecDataPoint connectRampDownRateDataPoint;
-    connectRampDownRateDataPoint.setName("ConnRmpDnRte");
-    connectRampDownRateDataPoint.setLabel("Connect Ramp Down Rate");
-    connectRampDownRateDataPoint.setDescription("Connect ramp down rate as a percentage of max current.");
-    connectRampDownRateDataPoint.setUnits("Pct");
-    connectRampDownRateDataPoint.setSize(1);
-    connectRampDownRateDataPoint.setAddressOffset(7);
-    connectRampDownRateDataPoint.setBlockOffset(5);
-    connectRampDownRateDataPoint.setScaleFactorName("Rmp_SF");
-    connectRampDownRateDataPoint.setSunSpecDataType("uint16");
-    connectRampDownRateDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    connectRampDownRateDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(connectRampDownRateDataPoint.name(), connectRampDownRateDataPoint);
-
-    SunSpecDataPoint defaultRampRateDataPoint;
-    defaultRampRateDataPoint.setName("AGra");
-    defaultRampRateDataPoint.setLabel("Default Ramp Rate");
-    defaultRampRateDataPoint.setDescription("Ramp rate specified in percent of max current.");
-    defaultRampRateDataPoint.setUnits("Pct");
-    defaultRampRateDataPoint.setSize(1);
-    defaultRampRateDataPoint.setAddressOffset(8);
-    defaultRampRateDataPoint.setBlockOffset(6);
-    defaultRampRateDataPoint.setScaleFactorName("Rmp_SF");
-    defaultRampRateDataPoint.setSunSpecDataType("uint16");
-    defaultRampRateDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    defaultRampRateDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(defaultRampRateDataPoint.name(), defaultRampRateDataPoint);
-
-    SunSpecDataPoint rampRateScaleFactorDataPoint;
-    rampRateScaleFactorDataPoint.setName("Rmp_SF");
-    rampRateScaleFactorDataPoint.setLabel("Ramp Rate Scale Factor");
-    rampRateScaleFactorDataPoint.setDescription("Ramp Rate Scale Factor");
-    rampRateScaleFactorDataPoint.setSize(1);
-    rampRateScaleFactorDataPoint.setAddressOffset(9);
-    rampRateScaleFactorDataPoint.setBlockOffset(7);
-    rampRateScaleFactorDataPoint.setSunSpecDataType("sunssf");
-    rampRateScaleFactorDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rampRateScaleFactorDataPoint.name(), rampRateScaleFactorDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 10;
 }
 
 void SunSpecExtSettingsModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("Rmp_SF").isValid())
-        m_rampRateScaleFactor = m_dataPoints.value("Rmp_SF").toInt16();
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 9, 1);
+        if (scaleFactor != m_rampRateScaleFactor) {
+            m_rampRateScaleFactor = scaleFactor;
+            m_rampRateScaleFactorMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("NomRmpUpRte").isValid())
-        m_rampUpRate = m_dataPoints.value("NomRmpUpRte").toFloatWithSSF(m_rampRateScaleFactor);
-
-    if (m_dataPoints.value("NomRmpDnRte").isValid())
-        m_nomRmpDnRte = m_dataPoints.value("NomRmpDnRte").toFloatWithSSF(m_rampRateScaleFactor);
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_rampUpRate = SunSpecDataPoint::convertToUInt16(registers + 2, 1) * m_rampRateScaleFactorMultiplier;
 
-    if (m_dataPoints.value("EmgRmpUpRte").isValid())
-        m_emergencyRampUpRate = m_dataPoints.value("EmgRmpUpRte").toFloatWithSSF(m_rampRateScaleFactor);
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_nomRmpDnRte = SunSpecDataPoint::convertToUInt16(registers + 3, 1) * m_rampRateScaleFactorMultiplier;
 
-    if (m_dataPoints.value("EmgRmpDnRte").isValid())
-        m_emergencyRampDownRate = m_dataPoints.value("EmgRmpDnRte").toFloatWithSSF(m_rampRateScaleFactor);
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_emergencyRampUpRate = SunSpecDataPoint::convertToUInt16(registers + 4, 1) * m_rampRateScaleFactorMultiplier;
 
-    if (m_dataPoints.value("ConnRmpUpRte").isValid())
-        m_connectRampUpRate = m_dataPoints.value("ConnRmpUpRte").toFloatWithSSF(m_rampRateScaleFactor);
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_emergencyRampDownRate = SunSpecDataPoint::convertToUInt16(registers + 5, 1) * m_rampRateScaleFactorMultiplier;
 
-    if (m_dataPoints.value("ConnRmpDnRte").isValid())
-        m_connectRampDownRate = m_dataPoints.value("ConnRmpDnRte").toFloatWithSSF(m_rampRateScaleFactor);
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_connectRampUpRate = SunSpecDataPoint::convertToUInt16(registers + 6, 1) * m_rampRateScaleFactorMultiplier;
 
-    if (m_dataPoints.value("AGra").isValid())
-        m_defaultRampRate = m_dataPoints.value("AGra").toFloatWithSSF(m_rampRateScaleFactor);
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_connectRampDownRate = SunSpecDataPoint::convertToUInt16(registers + 7, 1) * m_rampRateScaleFactorMultiplier;
 
-    if (m_dataPoints.value("Rmp_SF").isValid())
-        m_rampRateScaleFactor = m_dataPoints.value("Rmp_SF").toInt16();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_defaultRampRate = SunSpecDataPoint::convertToUInt16(registers + 8, 1) * m_rampRateScaleFactorMultiplier;
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -363,50 +262,50 @@ void SunSpecExtSettingsModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecExtSettingsModel *model)
 {
     debug.nospace().noquote() << "SunSpecExtSettingsModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NomRmpUpRte") << "-->";
-    if (model->dataPoints().value("NomRmpUpRte").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecExtSettingsModel::DataPointIndexRampUpRate) << "-->";
+    if (model->dataPoint(SunSpecExtSettingsModel::DataPointIndexRampUpRate).isValid()) {
         debug.nospace().noquote() << model->rampUpRate() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NomRmpDnRte") << "-->";
-    if (model->dataPoints().value("NomRmpDnRte").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecExtSettingsModel::DataPointIndexNomRmpDnRte) << "-->";
+    if (model->dataPoint(SunSpecExtSettingsModel::DataPointIndexNomRmpDnRte).isValid()) {
         debug.nospace().noquote() << model->nomRmpDnRte() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("EmgRmpUpRte") << "-->";
-    if (model->dataPoints().value("EmgRmpUpRte").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecExtSettingsModel::DataPointIndexEmergencyRampUpRate) << "-->";
+    if (model->dataPoint(SunSpecExtSettingsModel::DataPointIndexEmergencyRampUpRate).isValid()) {
         debug.nospace().noquote() << model->emergencyRampUpRate() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("EmgRmpDnRte") << "-->";
-    if (model->dataPoints().value("EmgRmpDnRte").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecExtSettingsModel::DataPointIndexEmergencyRampDownRate) << "-->";
+    if (model->dataPoint(SunSpecExtSettingsModel::DataPointIndexEmergencyRampDownRate).isValid()) {
         debug.nospace().noquote() << model->emergencyRampDownRate() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ConnRmpUpRte") << "-->";
-    if (model->dataPoints().value("ConnRmpUpRte").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecExtSettingsModel::DataPointIndexConnectRampUpRate) << "-->";
+    if (model->dataPoint(SunSpecExtSettingsModel::DataPointIndexConnectRampUpRate).isValid()) {
         debug.nospace().noquote() << model->connectRampUpRate() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ConnRmpDnRte") << "-->";
-    if (model->dataPoints().value("ConnRmpDnRte").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecExtSettingsModel::DataPointIndexConnectRampDownRate) << "-->";
+    if (model->dataPoint(SunSpecExtSettingsModel::DataPointIndexConnectRampDownRate).isValid()) {
         debug.nospace().noquote() << model->connectRampDownRate() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("AGra") << "-->";
-    if (model->dataPoints().value("AGra").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecExtSettingsModel::DataPointIndexDefaultRampRate) << "-->";
+    if (model->dataPoint(SunSpecExtSettingsModel::DataPointIndexDefaultRampRate).isValid()) {
         debug.nospace().noquote() << model->defaultRampRate() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
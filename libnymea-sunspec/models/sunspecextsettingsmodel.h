@@ -42,6 +42,19 @@ class SunSpecExtSettingsModel : public SunSpecModel
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexRampUpRate,
+        DataPointIndexNomRmpDnRte,
+        DataPointIndexEmergencyRampUpRate,
+        DataPointIndexEmergencyRampDownRate,
+        DataPointIndexConnectRampUpRate,
+        DataPointIndexConnectRampDownRate,
+        DataPointIndexDefaultRampRate,
+        DataPointIndexRampRateScaleFactor
+    };
+
     explicit SunSpecExtSettingsModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecExtSettingsModel() override; 
 
@@ -96,6 +109,7 @@ private:
     float m_connectRampDownRate = 0;
     float m_defaultRampRate = 0;
     qint16 m_rampRateScaleFactor = 0;
+    double m_rampRateScaleFactorMultiplier = 1;
 
 
 };
@@ -31,6 +31,11 @@
 #include "sunspecflowbatterymodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata repeatingBlockDataPointMetadata[] = {
+    // DataPointIndexBatteryStringPointsToBeDetermined
+    { "BatStTBD", "Battery String Points To Be Determined", nullptr, nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 }
+};
+
 SunSpecFlowBatteryModelRepeatingBlock::SunSpecFlowBatteryModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecFlowBatteryModel *parent) :
     SunSpecModelRepeatingBlock(blockIndex, blockSize, modbusStartRegister, parent)
 {
@@ -55,31 +60,35 @@ quint16 SunSpecFlowBatteryModelRepeatingBlock::batteryStringPointsToBeDetermined
 
 void SunSpecFlowBatteryModelRepeatingBlock::initDataPoints()
 {
-    SunSpecDataPoint batteryStringPointsToBeDeterminedDataPoint;
-    batteryStringPointsToBeDeterminedDataPoint.setName("BatStTBD");
-    batteryStringPointsToBeDeterminedDataPoint.setLabel("Battery String Points To Be Determined");
-    batteryStringPointsToBeDeterminedDataPoint.setMandatory(true);
-    batteryStringPointsToBeDeterminedDataPoint.setSize(1);
-    batteryStringPointsToBeDeterminedDataPoint.setAddressOffset(0);
-    batteryStringPointsToBeDeterminedDataPoint.setSunSpecDataType("uint16");
-    batteryStringPointsToBeDeterminedDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(batteryStringPointsToBeDeterminedDataPoint.name(), batteryStringPointsToBeDeterminedDataPoint);
-
+    m_dataPointMetadata = repeatingBlockDataPointMetadata;
+    m_dataPointCount = 1;
 }
 
 void SunSpecFlowBatteryModelRepeatingBlock::processBlockData(const QVector<quint16> blockData)
 {
     m_blockData = blockData;
 
+    const quint16 *registers = m_blockData.constData();
+    const int registerCount = m_blockData.count();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("BatStTBD").isValid())
-        m_batteryStringPointsToBeDetermined = m_dataPoints.value("BatStTBD").toUInt16();
+    if (registerCount >= 1 && SunSpecDataPoint::isValid(registers + 0, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_batteryStringPointsToBeDetermined = SunSpecDataPoint::convertToUInt16(registers + 0, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
 }
 
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexBatteryPointsToBeDetermined
+    { "BatTBD", "Battery Points To Be Determined", nullptr, nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 2, 0, 1 }
+};
+
 SunSpecFlowBatteryModel::SunSpecFlowBatteryModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 806, modelLength, byteOrder, parent)
 {
@@ -114,46 +123,18 @@ quint16 SunSpecFlowBatteryModel::batteryPointsToBeDetermined() const
 }
 void SunSpecFlowBatteryModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint batteryPointsToBeDeterminedDataPoint;
-    batteryPointsToBeDeterminedDataPoint.setName("BatTBD");
-    batteryPointsToBeDeterminedDataPoint.setLabel("Battery Points To Be Determined");
-    batteryPointsToBeDeterminedDataPoint.setMandatory(true);
-    batteryPointsToBeDeterminedDataPoint.setSize(1);
-    batteryPointsToBeDeterminedDataPoint.setAddressOffset(2);
-    batteryPointsToBeDeterminedDataPoint.setBlockOffset(0);
-    batteryPointsToBeDeterminedDataPoint.setSunSpecDataType("uint16");
-    batteryPointsToBeDeterminedDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(batteryPointsToBeDeterminedDataPoint.name(), batteryPointsToBeDeterminedDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 3;
 }
 
 void SunSpecFlowBatteryModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("BatTBD").isValid())
-        m_batteryPointsToBeDetermined = m_dataPoints.value("BatTBD").toUInt16();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_batteryPointsToBeDetermined = SunSpecDataPoint::convertToUInt16(registers + 2, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -162,8 +143,8 @@ void SunSpecFlowBatteryModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecFlowBatteryModel *model)
 {
     debug.nospace().noquote() << "SunSpecFlowBatteryModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("BatTBD") << "-->";
-    if (model->dataPoints().value("BatTBD").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryModel::DataPointIndexBatteryPointsToBeDetermined) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryModel::DataPointIndexBatteryPointsToBeDetermined).isValid()) {
         debug.nospace().noquote() << model->batteryPointsToBeDetermined() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
@@ -44,6 +44,10 @@ class SunSpecFlowBatteryModelRepeatingBlock : public SunSpecModelRepeatingBlock
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexBatteryStringPointsToBeDetermined = 0
+    };
+
     explicit SunSpecFlowBatteryModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecFlowBatteryModel *parent = nullptr);
     ~SunSpecFlowBatteryModelRepeatingBlock() override = default;
 
@@ -72,6 +76,12 @@ class SunSpecFlowBatteryModel : public SunSpecModel
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexBatteryPointsToBeDetermined
+    };
+
     explicit SunSpecFlowBatteryModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecFlowBatteryModel() override; 
 
@@ -31,6 +31,11 @@
 #include "sunspecflowbatterymodulemodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata repeatingBlockDataPointMetadata[] = {
+    // DataPointIndexStackPointsToBeDetermined
+    { "StackTBD", "Stack Points To Be Determined", nullptr, nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 }
+};
+
 SunSpecFlowBatteryModuleModelRepeatingBlock::SunSpecFlowBatteryModuleModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecFlowBatteryModuleModel *parent) :
     SunSpecModelRepeatingBlock(blockIndex, blockSize, modbusStartRegister, parent)
 {
@@ -55,31 +60,35 @@ quint16 SunSpecFlowBatteryModuleModelRepeatingBlock::stackPointsToBeDetermined()
 
 void SunSpecFlowBatteryModuleModelRepeatingBlock::initDataPoints()
 {
-    SunSpecDataPoint stackPointsToBeDeterminedDataPoint;
-    stackPointsToBeDeterminedDataPoint.setName("StackTBD");
-    stackPointsToBeDeterminedDataPoint.setLabel("Stack Points To Be Determined");
-    stackPointsToBeDeterminedDataPoint.setMandatory(true);
-    stackPointsToBeDeterminedDataPoint.setSize(1);
-    stackPointsToBeDeterminedDataPoint.setAddressOffset(0);
-    stackPointsToBeDeterminedDataPoint.setSunSpecDataType("uint16");
-    stackPointsToBeDeterminedDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stackPointsToBeDeterminedDataPoint.name(), stackPointsToBeDeterminedDataPoint);
-
+    m_dataPointMetadata = repeatingBlockDataPointMetadata;
+    m_dataPointCount = 1;
 }
 
 void SunSpecFlowBatteryModuleModelRepeatingBlock::processBlockData(const QVector<quint16> blockData)
 {
     m_blockData = blockData;
 
+    const quint16 *registers = m_blockData.constData();
+    const int registerCount = m_blockData.count();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("StackTBD").isValid())
-        m_stackPointsToBeDetermined = m_dataPoints.value("StackTBD").toUInt16();
+    if (registerCount >= 1 && SunSpecDataPoint::isValid(registers + 0, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_stackPointsToBeDetermined = SunSpecDataPoint::convertToUInt16(registers + 0, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
 }
 
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexModulePointsToBeDetermined
+    { "ModuleTBD", "Module Points To Be Determined", nullptr, nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 2, 0, 1 }
+};
+
 SunSpecFlowBatteryModuleModel::SunSpecFlowBatteryModuleModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 808, modelLength, byteOrder, parent)
 {
@@ -114,46 +123,18 @@ quint16 SunSpecFlowBatteryModuleModel::modulePointsToBeDetermined() const
 }
 void SunSpecFlowBatteryModuleModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint modulePointsToBeDeterminedDataPoint;
-    modulePointsToBeDeterminedDataPoint.setName("ModuleTBD");
-    modulePointsToBeDeterminedDataPoint.setLabel("Module Points To Be Determined");
-    modulePointsToBeDeterminedDataPoint.setMandatory(true);
-    modulePointsToBeDeterminedDataPoint.setSize(1);
-    modulePointsToBeDeterminedDataPoint.setAddressOffset(2);
-    modulePointsToBeDeterminedDataPoint.setBlockOffset(0);
-    modulePointsToBeDeterminedDataPoint.setSunSpecDataType("uint16");
-    modulePointsToBeDeterminedDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modulePointsToBeDeterminedDataPoint.name(), modulePointsToBeDeterminedDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 3;
 }
 
 void SunSpecFlowBatteryModuleModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("ModuleTBD").isValid())
-        m_modulePointsToBeDetermined = m_dataPoints.value("ModuleTBD").toUInt16();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_modulePointsToBeDetermined = SunSpecDataPoint::convertToUInt16(registers + 2, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -162,8 +143,8 @@ void SunSpecFlowBatteryModuleModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecFlowBatteryModuleModel *model)
 {
     debug.nospace().noquote() << "SunSpecFlowBatteryModuleModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModuleTBD") << "-->";
-    if (model->dataPoints().value("ModuleTBD").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryModuleModel::DataPointIndexModulePointsToBeDetermined) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryModuleModel::DataPointIndexModulePointsToBeDetermined).isValid()) {
         debug.nospace().noquote() << model->modulePointsToBeDetermined() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
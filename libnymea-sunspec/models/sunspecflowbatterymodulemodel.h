@@ -44,6 +44,10 @@ class SunSpecFlowBatteryModuleModelRepeatingBlock : public SunSpecModelRepeating
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexStackPointsToBeDetermined = 0
+    };
+
     explicit SunSpecFlowBatteryModuleModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecFlowBatteryModuleModel *parent = nullptr);
     ~SunSpecFlowBatteryModuleModelRepeatingBlock() override = default;
 
@@ -72,6 +76,12 @@ class SunSpecFlowBatteryModuleModel : public SunSpecModel
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexModulePointsToBeDetermined
+    };
+
     explicit SunSpecFlowBatteryModuleModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecFlowBatteryModuleModel() override; 
 
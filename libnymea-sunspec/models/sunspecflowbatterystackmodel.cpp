@@ -31,6 +31,11 @@
 #include "sunspecflowbatterystackmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata repeatingBlockDataPointMetadata[] = {
+    // DataPointIndexCellPointsToBeDetermined
+    { "CellTBD", "Cell Points To Be Determined", nullptr, nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 }
+};
+
 SunSpecFlowBatteryStackModelRepeatingBlock::SunSpecFlowBatteryStackModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecFlowBatteryStackModel *parent) :
     SunSpecModelRepeatingBlock(blockIndex, blockSize, modbusStartRegister, parent)
 {
@@ -55,31 +60,35 @@ quint16 SunSpecFlowBatteryStackModelRepeatingBlock::cellPointsToBeDetermined() c
 
 void SunSpecFlowBatteryStackModelRepeatingBlock::initDataPoints()
 {
-    SunSpecDataPoint cellPointsToBeDeterminedDataPoint;
-    cellPointsToBeDeterminedDataPoint.setName("CellTBD");
-    cellPointsToBeDeterminedDataPoint.setLabel("Cell Points To Be Determined");
-    cellPointsToBeDeterminedDataPoint.setMandatory(true);
-    cellPointsToBeDeterminedDataPoint.setSize(1);
-    cellPointsToBeDeterminedDataPoint.setAddressOffset(0);
-    cellPointsToBeDeterminedDataPoint.setSunSpecDataType("uint16");
-    cellPointsToBeDeterminedDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(cellPointsToBeDeterminedDataPoint.name(), cellPointsToBeDeterminedDataPoint);
-
+    m_dataPointMetadata = repeatingBlockDataPointMetadata;
+    m_dataPointCount = 1;
 }
 
 void SunSpecFlowBatteryStackModelRepeatingBlock::processBlockData(const QVector<quint16> blockData)
 {
     m_blockData = blockData;
 
+    const quint16 *registers = m_blockData.constData();
+    const int registerCount = m_blockData.count();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("CellTBD").isValid())
-        m_cellPointsToBeDetermined = m_dataPoints.value("CellTBD").toUInt16();
+    if (registerCount >= 1 && SunSpecDataPoint::isValid(registers + 0, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_cellPointsToBeDetermined = SunSpecDataPoint::convertToUInt16(registers + 0, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
 }
 
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexStackPointsToBeDetermined
+    { "StackTBD", "Stack Points To Be Determined", nullptr, nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 2, 0, 1 }
+};
+
 SunSpecFlowBatteryStackModel::SunSpecFlowBatteryStackModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 809, modelLength, byteOrder, parent)
 {
@@ -114,46 +123,18 @@ quint16 SunSpecFlowBatteryStackModel::stackPointsToBeDetermined() const
 }
 void SunSpecFlowBatteryStackModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint stackPointsToBeDeterminedDataPoint;
-    stackPointsToBeDeterminedDataPoint.setName("StackTBD");
-    stackPointsToBeDeterminedDataPoint.setLabel("Stack Points To Be Determined");
-    stackPointsToBeDeterminedDataPoint.setMandatory(true);
-    stackPointsToBeDeterminedDataPoint.setSize(1);
-    stackPointsToBeDeterminedDataPoint.setAddressOffset(2);
-    stackPointsToBeDeterminedDataPoint.setBlockOffset(0);
-    stackPointsToBeDeterminedDataPoint.setSunSpecDataType("uint16");
-    stackPointsToBeDeterminedDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stackPointsToBeDeterminedDataPoint.name(), stackPointsToBeDeterminedDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 3;
 }
 
 void SunSpecFlowBatteryStackModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("StackTBD").isValid())
-        m_stackPointsToBeDetermined = m_dataPoints.value("StackTBD").toUInt16();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_stackPointsToBeDetermined = SunSpecDataPoint::convertToUInt16(registers + 2, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -162,8 +143,8 @@ void SunSpecFlowBatteryStackModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecFlowBatteryStackModel *model)
 {
     debug.nospace().noquote() << "SunSpecFlowBatteryStackModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StackTBD") << "-->";
-    if (model->dataPoints().value("StackTBD").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStackModel::DataPointIndexStackPointsToBeDetermined) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStackModel::DataPointIndexStackPointsToBeDetermined).isValid()) {
         debug.nospace().noquote() << model->stackPointsToBeDetermined() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
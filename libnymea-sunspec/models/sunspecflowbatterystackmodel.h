@@ -44,6 +44,10 @@ class SunSpecFlowBatteryStackModelRepeatingBlock : public SunSpecModelRepeatingB
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexCellPointsToBeDetermined = 0
+    };
+
     explicit SunSpecFlowBatteryStackModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecFlowBatteryStackModel *parent = nullptr);
     ~SunSpecFlowBatteryStackModelRepeatingBlock() override = default;
 
@@ -72,6 +76,12 @@ class SunSpecFlowBatteryStackModel : public SunSpecModel
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexStackPointsToBeDetermined
+    };
+
     explicit SunSpecFlowBatteryStackModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecFlowBatteryStackModel() override; 
 
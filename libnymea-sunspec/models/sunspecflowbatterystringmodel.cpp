@@ -31,6 +31,49 @@
 #include "sunspecflowbatterystringmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata repeatingBlockDataPointMetadata[] = {
+    // DataPointIndexModuleIndex
+    { "ModIdx", "Module Index", "Index of the module within the string.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexStackCount
+    { "ModNStk", "Stack Count", "Number of stacks in this module.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexModuleStatus
+    { "ModSt", "Module Status", "Current status of the module.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, true, 2, 0, 2 },
+    // DataPointIndexModuleStateOfCharge
+    { "ModSoC", "Module State of Charge", "State of charge for this module.", nullptr, "%", "uint16", "SoC_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 4, 2, 1 },
+    // DataPointIndexOpenCircuitVoltage
+    { "ModOCV", "Open Circuit Voltage", "Open circuit voltage for this module.", nullptr, "V", "uint16", "OCV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 5, 3, 1 },
+    // DataPointIndexExternalVoltage
+    { "ModV", "External Voltage", "External voltage fo this module.", nullptr, "V", "uint16", "ModV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 6, 4, 1 },
+    // DataPointIndexMaximumCellVoltage
+    { "ModCellVMax", "Maximum Cell Voltage", "Maximum voltage for all cells in this module.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 7, 5, 1 },
+    // DataPointIndexMaxCellVoltageCell
+    { "ModCellVMaxCell", "Max Cell Voltage Cell", "Cell with the maximum cell voltage.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 8, 6, 1 },
+    // DataPointIndexMinimumCellVoltage
+    { "ModCellVMin", "Minimum Cell Voltage", "Minimum voltage for all cells in this module.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 9, 7, 1 },
+    // DataPointIndexMinCellVoltageCell
+    { "ModCellVMinCell", "Min Cell Voltage Cell", "Cell with the minimum cell voltage.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 10, 8, 1 },
+    // DataPointIndexAverageCellVoltage
+    { "ModCellVAvg", "Average Cell Voltage", "Average voltage for all cells in this module.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 11, 9, 1 },
+    // DataPointIndexAnolyteTemperature
+    { "ModAnoTmp", "Anolyte Temperature", nullptr, nullptr, "C", "uint16", "Tmp_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 12, 10, 1 },
+    // DataPointIndexCatholyteTemperature
+    { "ModCatTmp", "Catholyte Temperature", nullptr, nullptr, "C", "uint16", "Tmp_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 13, 11, 1 },
+    // DataPointIndexContactorStatus
+    { "ModConSt", "Contactor Status", nullptr, nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 14, 12, 2 },
+    // DataPointIndexModuleEvent1
+    { "ModEvt1", "Module Event 1", "Alarms, warnings and status values.  Bit flags.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, true, 16, 14, 2 },
+    // DataPointIndexModuleEvent2
+    { "ModEvt2", "Module Event 2", "Alarms, warnings and status values.  Bit flags.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, true, 18, 16, 2 },
+    // DataPointIndexConnectionFailureReason
+    { "ModConFail", "Connection Failure Reason", nullptr, nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, false, 20, 18, 1 },
+    // DataPointIndexEnableDisableModule
+    { "ModSetEna", "Enable/Disable Module", "Enables and disables the module.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, false, 21, 19, 1 },
+    // DataPointIndexConnectDisconnectModule
+    { "ModSetCon", "Connect/Disconnect Module ", "Connects and disconnects the module.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, false, 22, 20, 1 },
+    // DataPointIndexDisabledReason
+    { "ModDisRsn", "Disabled Reason", "Reason why the module is currently disabled.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, false, 23, 21, 1 }
+};
+
 SunSpecFlowBatteryStringModelRepeatingBlock::SunSpecFlowBatteryStringModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecFlowBatteryStringModel *parent) :
     SunSpecModelRepeatingBlock(blockIndex, blockSize, modbusStartRegister, parent)
 {
@@ -123,7 +166,7 @@ SunSpecFlowBatteryStringModelRepeatingBlock::Modsetena SunSpecFlowBatteryStringM
 
 QModbusReply *SunSpecFlowBatteryStringModelRepeatingBlock::setEnableDisableModule(Modsetena enableDisableModule)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("ModSetEna");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexEnableDisableModule]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(enableDisableModule));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -139,7 +182,7 @@ SunSpecFlowBatteryStringModelRepeatingBlock::Modsetcon SunSpecFlowBatteryStringM
 
 QModbusReply *SunSpecFlowBatteryStringModelRepeatingBlock::setConnectDisconnectModule(Modsetcon connectDisconnectModule)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("ModSetCon");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexConnectDisconnectModule]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(connectDisconnectModule));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -155,318 +198,150 @@ SunSpecFlowBatteryStringModelRepeatingBlock::Moddisrsn SunSpecFlowBatteryStringM
 
 void SunSpecFlowBatteryStringModelRepeatingBlock::initDataPoints()
 {
-    SunSpecDataPoint moduleIndexDataPoint;
-    moduleIndexDataPoint.setName("ModIdx");
-    moduleIndexDataPoint.setLabel("Module Index");
-    moduleIndexDataPoint.setDescription("Index of the module within the string.");
-    moduleIndexDataPoint.setMandatory(true);
-    moduleIndexDataPoint.setSize(1);
-    moduleIndexDataPoint.setAddressOffset(0);
-    moduleIndexDataPoint.setSunSpecDataType("uint16");
-    moduleIndexDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(moduleIndexDataPoint.name(), moduleIndexDataPoint);
-
-    SunSpecDataPoint stackCountDataPoint;
-    stackCountDataPoint.setName("ModNStk");
-    stackCountDataPoint.setLabel("Stack Count");
-    stackCountDataPoint.setDescription("Number of stacks in this module.");
-    stackCountDataPoint.setMandatory(true);
-    stackCountDataPoint.setSize(1);
-    stackCountDataPoint.setAddressOffset(1);
-    stackCountDataPoint.setSunSpecDataType("uint16");
-    stackCountDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stackCountDataPoint.name(), stackCountDataPoint);
-
-    SunSpecDataPoint moduleStatusDataPoint;
-    moduleStatusDataPoint.setName("ModSt");
-    moduleStatusDataPoint.setLabel("Module Status");
-    moduleStatusDataPoint.setDescription("Current status of the module.");
-    moduleStatusDataPoint.setMandatory(true);
-    moduleStatusDataPoint.setSize(2);
-    moduleStatusDataPoint.setAddressOffset(2);
-    moduleStatusDataPoint.setBlockOffset(0);
-    moduleStatusDataPoint.setSunSpecDataType("bitfield32");
-    moduleStatusDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(moduleStatusDataPoint.name(), moduleStatusDataPoint);
-
-    SunSpecDataPoint moduleStateOfChargeDataPoint;
-    moduleStateOfChargeDataPoint.setName("ModSoC");
-    moduleStateOfChargeDataPoint.setLabel("Module State of Charge");
-    moduleStateOfChargeDataPoint.setDescription("State of charge for this module.");
-    moduleStateOfChargeDataPoint.setUnits("%");
-    moduleStateOfChargeDataPoint.setMandatory(true);
-    moduleStateOfChargeDataPoint.setSize(1);
-    moduleStateOfChargeDataPoint.setAddressOffset(4);
-    moduleStateOfChargeDataPoint.setBlockOffset(2);
-    moduleStateOfChargeDataPoint.setScaleFactorName("SoC_SF");
-    moduleStateOfChargeDataPoint.setSunSpecDataType("uint16");
-    moduleStateOfChargeDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(moduleStateOfChargeDataPoint.name(), moduleStateOfChargeDataPoint);
-
-    SunSpecDataPoint openCircuitVoltageDataPoint;
-    openCircuitVoltageDataPoint.setName("ModOCV");
-    openCircuitVoltageDataPoint.setLabel("Open Circuit Voltage");
-    openCircuitVoltageDataPoint.setDescription("Open circuit voltage for this module.");
-    openCircuitVoltageDataPoint.setUnits("V");
-    openCircuitVoltageDataPoint.setMandatory(true);
-    openCircuitVoltageDataPoint.setSize(1);
-    openCircuitVoltageDataPoint.setAddressOffset(5);
-    openCircuitVoltageDataPoint.setBlockOffset(3);
-    openCircuitVoltageDataPoint.setScaleFactorName("OCV_SF");
-    openCircuitVoltageDataPoint.setSunSpecDataType("uint16");
-    openCircuitVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(openCircuitVoltageDataPoint.name(), openCircuitVoltageDataPoint);
-
-    SunSpecDataPoint externalVoltageDataPoint;
-    externalVoltageDataPoint.setName("ModV");
-    externalVoltageDataPoint.setLabel("External Voltage");
-    externalVoltageDataPoint.setDescription("External voltage fo this module.");
-    externalVoltageDataPoint.setUnits("V");
-    externalVoltageDataPoint.setMandatory(true);
-    externalVoltageDataPoint.setSize(1);
-    externalVoltageDataPoint.setAddressOffset(6);
-    externalVoltageDataPoint.setBlockOffset(4);
-    externalVoltageDataPoint.setScaleFactorName("ModV_SF");
-    externalVoltageDataPoint.setSunSpecDataType("uint16");
-    externalVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(externalVoltageDataPoint.name(), externalVoltageDataPoint);
-
-    SunSpecDataPoint maximumCellVoltageDataPoint;
-    maximumCellVoltageDataPoint.setName("ModCellVMax");
-    maximumCellVoltageDataPoint.setLabel("Maximum Cell Voltage");
-    maximumCellVoltageDataPoint.setDescription("Maximum voltage for all cells in this module.");
-    maximumCellVoltageDataPoint.setUnits("V");
-    maximumCellVoltageDataPoint.setSize(1);
-    maximumCellVoltageDataPoint.setAddressOffset(7);
-    maximumCellVoltageDataPoint.setBlockOffset(5);
-    maximumCellVoltageDataPoint.setScaleFactorName("CellV_SF");
-    maximumCellVoltageDataPoint.setSunSpecDataType("uint16");
-    maximumCellVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maximumCellVoltageDataPoint.name(), maximumCellVoltageDataPoint);
-
-    SunSpecDataPoint maxCellVoltageCellDataPoint;
-    maxCellVoltageCellDataPoint.setName("ModCellVMaxCell");
-    maxCellVoltageCellDataPoint.setLabel("Max Cell Voltage Cell");
-    maxCellVoltageCellDataPoint.setDescription("Cell with the maximum cell voltage.");
-    maxCellVoltageCellDataPoint.setSize(1);
-    maxCellVoltageCellDataPoint.setAddressOffset(8);
-    maxCellVoltageCellDataPoint.setBlockOffset(6);
-    maxCellVoltageCellDataPoint.setSunSpecDataType("uint16");
-    maxCellVoltageCellDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxCellVoltageCellDataPoint.name(), maxCellVoltageCellDataPoint);
-
-    SunSpecDataPoint minimumCellVoltageDataPoint;
-    minimumCellVoltageDataPoint.setName("ModCellVMin");
-    minimumCellVoltageDataPoint.setLabel("Minimum Cell Voltage");
-    minimumCellVoltageDataPoint.setDescription("Minimum voltage for all cells in this module.");
-    minimumCellVoltageDataPoint.setUnits("V");
-    minimumCellVoltageDataPoint.setSize(1);
-    minimumCellVoltageDataPoint.setAddressOffset(9);
-    minimumCellVoltageDataPoint.setBlockOffset(7);
-    minimumCellVoltageDataPoint.setScaleFactorName("CellV_SF");
-    minimumCellVoltageDataPoint.setSunSpecDataType("uint16");
-    minimumCellVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minimumCellVoltageDataPoint.name(), minimumCellVoltageDataPoint);
-
-    SunSpecDataPoint minCellVoltageCellDataPoint;
-    minCellVoltageCellDataPoint.setName("ModCellVMinCell");
-    minCellVoltageCellDataPoint.setLabel("Min Cell Voltage Cell");
-    minCellVoltageCellDataPoint.setDescription("Cell with the minimum cell voltage.");
-    minCellVoltageCellDataPoint.setSize(1);
-    minCellVoltageCellDataPoint.setAddressOffset(10);
-    minCellVoltageCellDataPoint.setBlockOffset(8);
-    minCellVoltageCellDataPoint.setSunSpecDataType("uint16");
-    minCellVoltageCellDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minCellVoltageCellDataPoint.name(), minCellVoltageCellDataPoint);
-
-    SunSpecDataPoint averageCellVoltageDataPoint;
-    averageCellVoltageDataPoint.setName("ModCellVAvg");
-    averageCellVoltageDataPoint.setLabel("Average Cell Voltage");
-    averageCellVoltageDataPoint.setDescription("Average voltage for all cells in this module.");
-    averageCellVoltageDataPoint.setUnits("V");
-    averageCellVoltageDataPoint.setSize(1);
-    averageCellVoltageDataPoint.setAddressOffset(11);
-    averageCellVoltageDataPoint.setBlockOffset(9);
-    averageCellVoltageDataPoint.setScaleFactorName("CellV_SF");
-    averageCellVoltageDataPoint.setSunSpecDataType("uint16");
-    averageCellVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(averageCellVoltageDataPoint.name(), averageCellVoltageDataPoint);
-
-    SunSpecDataPoint anolyteTemperatureDataPoint;
-    anolyteTemperatureDataPoint.setName("ModAnoTmp");
-    anolyteTemperatureDataPoint.setLabel("Anolyte Temperature");
-    anolyteTemperatureDataPoint.setUnits("C");
-    anolyteTemperatureDataPoint.setSize(1);
-    anolyteTemperatureDataPoint.setAddressOffset(12);
-    anolyteTemperatureDataPoint.setBlockOffset(10);
-    anolyteTemperatureDataPoint.setScaleFactorName("Tmp_SF");
-    anolyteTemperatureDataPoint.setSunSpecDataType("uint16");
-    anolyteTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(anolyteTemperatureDataPoint.name(), anolyteTemperatureDataPoint);
-
-    SunSpecDataPoint catholyteTemperatureDataPoint;
-    catholyteTemperatureDataPoint.setName("ModCatTmp");
-    catholyteTemperatureDataPoint.setLabel("Catholyte Temperature");
-    catholyteTemperatureDataPoint.setUnits("C");
-    catholyteTemperatureDataPoint.setSize(1);
-    catholyteTemperatureDataPoint.setAddressOffset(13);
-    catholyteTemperatureDataPoint.setBlockOffset(11);
-    catholyteTemperatureDataPoint.setScaleFactorName("Tmp_SF");
-    catholyteTemperatureDataPoint.setSunSpecDataType("uint16");
-    catholyteTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(catholyteTemperatureDataPoint.name(), catholyteTemperatureDataPoint);
-
-    SunSpecDataPoint contactorStatusDataPoint;
-    contactorStatusDataPoint.setName("ModConSt");
-    contactorStatusDataPoint.setLabel("Contactor Status");
-    contactorStatusDataPoint.setSize(2);
-    contactorStatusDataPoint.setAddressOffset(14);
-    contactorStatusDataPoint.setBlockOffset(12);
-    contactorStatusDataPoint.setSunSpecDataType("bitfield32");
-    contactorStatusDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(contactorStatusDataPoint.name(), contactorStatusDataPoint);
-
-    SunSpecDataPoint moduleEvent1DataPoint;
-    moduleEvent1DataPoint.setName("ModEvt1");
-    moduleEvent1DataPoint.setLabel("Module Event 1");
-    moduleEvent1DataPoint.setDescription("Alarms, warnings and status values.  Bit flags.");
-    moduleEvent1DataPoint.setMandatory(true);
-    moduleEvent1DataPoint.setSize(2);
-    moduleEvent1DataPoint.setAddressOffset(16);
-    moduleEvent1DataPoint.setBlockOffset(14);
-    moduleEvent1DataPoint.setSunSpecDataType("bitfield32");
-    moduleEvent1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(moduleEvent1DataPoint.name(), moduleEvent1DataPoint);
-
-    SunSpecDataPoint moduleEvent2DataPoint;
-    moduleEvent2DataPoint.setName("ModEvt2");
-    moduleEvent2DataPoint.setLabel("Module Event 2");
-    moduleEvent2DataPoint.setDescription("Alarms, warnings and status values.  Bit flags.");
-    moduleEvent2DataPoint.setMandatory(true);
-    moduleEvent2DataPoint.setSize(2);
-    moduleEvent2DataPoint.setAddressOffset(18);
-    moduleEvent2DataPoint.setBlockOffset(16);
-    moduleEvent2DataPoint.setSunSpecDataType("bitfield32");
-    moduleEvent2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(moduleEvent2DataPoint.name(), moduleEvent2DataPoint);
-
-    SunSpecDataPoint connectionFailureReasonDataPoint;
-    connectionFailureReasonDataPoint.setName("ModConFail");
-    connectionFailureReasonDataPoint.setLabel("Connection Failure Reason");
-    connectionFailureReasonDataPoint.setSize(1);
-    connectionFailureReasonDataPoint.setAddressOffset(20);
-    connectionFailureReasonDataPoint.setBlockOffset(18);
-    connectionFailureReasonDataPoint.setSunSpecDataType("enum16");
-    connectionFailureReasonDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(connectionFailureReasonDataPoint.name(), connectionFailureReasonDataPoint);
-
-    SunSpecDataPoint enableDisableModuleDataPoint;
-    enableDisableModuleDataPoint.setName("ModSetEna");
-    enableDisableModuleDataPoint.setLabel("Enable/Disable Module");
-    enableDisableModuleDataPoint.setDescription("Enables and disables the module.");
-    enableDisableModuleDataPoint.setSize(1);
-    enableDisableModuleDataPoint.setAddressOffset(21);
-    enableDisableModuleDataPoint.setBlockOffset(19);
-    enableDisableModuleDataPoint.setSunSpecDataType("enum16");
-    enableDisableModuleDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    enableDisableModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(enableDisableModuleDataPoint.name(), enableDisableModuleDataPoint);
-
-    SunSpecDataPoint connectDisconnectModuleDataPoint;
-    connectDisconnectModuleDataPoint.setName("ModSetCon");
-    connectDisconnectModuleDataPoint.setLabel("Connect/Disconnect Module ");
-    connectDisconnectModuleDataPoint.setDescription("Connects and disconnects the module.");
-    connectDisconnectModuleDataPoint.setSize(1);
-    connectDisconnectModuleDataPoint.setAddressOffset(22);
-    connectDisconnectModuleDataPoint.setBlockOffset(20);
-    connectDisconnectModuleDataPoint.setSunSpecDataType("enum16");
-    connectDisconnectModuleDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    connectDisconnectModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(connectDisconnectModuleDataPoint.name(), connectDisconnectModuleDataPoint);
-
-    SunSpecDataPoint disabledReasonDataPoint;
-    disabledReasonDataPoint.setName("ModDisRsn");
-    disabledReasonDataPoint.setLabel("Disabled Reason");
-    disabledReasonDataPoint.setDescription("Reason why the module is currently disabled.");
-    disabledReasonDataPoint.setSize(1);
-    disabledReasonDataPoint.setAddressOffset(23);
-    disabledReasonDataPoint.setBlockOffset(21);
-    disabledReasonDataPoint.setSunSpecDataType("enum16");
-    disabledReasonDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(disabledReasonDataPoint.name(), disabledReasonDataPoint);
-
+    m_dataPointMetadata = repeatingBlockDataPointMetadata;
+    m_dataPointCount = 20;
 }
 
 void SunSpecFlowBatteryStringModelRepeatingBlock::processBlockData(const QVector<quint16> blockData)
 {
     m_blockData = blockData;
 
+    const quint16 *registers = m_blockData.constData();
+    const int registerCount = m_blockData.count();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("ModIdx").isValid())
-        m_moduleIndex = m_dataPoints.value("ModIdx").toUInt16();
+    if (registerCount >= 1 && SunSpecDataPoint::isValid(registers + 0, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_moduleIndex = SunSpecDataPoint::convertToUInt16(registers + 0, 1);
 
-    if (m_dataPoints.value("ModNStk").isValid())
-        m_stackCount = m_dataPoints.value("ModNStk").toUInt16();
+    if (registerCount >= 2 && SunSpecDataPoint::isValid(registers + 1, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_stackCount = SunSpecDataPoint::convertToUInt16(registers + 1, 1);
 
-    if (m_dataPoints.value("ModSt").isValid())
-        m_moduleStatus = static_cast<ModstFlags>(m_dataPoints.value("ModSt").toUInt32());
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 2, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_moduleStatus = static_cast<ModstFlags>(SunSpecDataPoint::convertToUInt32(registers + 2, 2, m_byteOrder));
 
-    if (m_dataPoints.value("ModSoC").isValid())
-        m_moduleStateOfCharge = m_dataPoints.value("ModSoC").toFloatWithSSF(m_parentModel->soC_SF());
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_moduleStateOfCharge = SunSpecDataPoint::convertToUInt16(registers + 4, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->soC_SF());
 
-    if (m_dataPoints.value("ModOCV").isValid())
-        m_openCircuitVoltage = m_dataPoints.value("ModOCV").toFloatWithSSF(m_parentModel->oCV_SF());
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_openCircuitVoltage = SunSpecDataPoint::convertToUInt16(registers + 5, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->oCV_SF());
 
-    if (m_dataPoints.value("ModV").isValid())
-        m_externalVoltage = m_dataPoints.value("ModV").toFloatWithSSF(m_parentModel->modV_SF());
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_externalVoltage = SunSpecDataPoint::convertToUInt16(registers + 6, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->modV_SF());
 
-    if (m_dataPoints.value("ModCellVMax").isValid())
-        m_maximumCellVoltage = m_dataPoints.value("ModCellVMax").toFloatWithSSF(m_parentModel->cellV_SF());
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maximumCellVoltage = SunSpecDataPoint::convertToUInt16(registers + 7, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->cellV_SF());
 
-    if (m_dataPoints.value("ModCellVMaxCell").isValid())
-        m_maxCellVoltageCell = m_dataPoints.value("ModCellVMaxCell").toUInt16();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxCellVoltageCell = SunSpecDataPoint::convertToUInt16(registers + 8, 1);
 
-    if (m_dataPoints.value("ModCellVMin").isValid())
-        m_minimumCellVoltage = m_dataPoints.value("ModCellVMin").toFloatWithSSF(m_parentModel->cellV_SF());
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minimumCellVoltage = SunSpecDataPoint::convertToUInt16(registers + 9, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->cellV_SF());
 
-    if (m_dataPoints.value("ModCellVMinCell").isValid())
-        m_minCellVoltageCell = m_dataPoints.value("ModCellVMinCell").toUInt16();
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minCellVoltageCell = SunSpecDataPoint::convertToUInt16(registers + 10, 1);
 
-    if (m_dataPoints.value("ModCellVAvg").isValid())
-        m_averageCellVoltage = m_dataPoints.value("ModCellVAvg").toFloatWithSSF(m_parentModel->cellV_SF());
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_averageCellVoltage = SunSpecDataPoint::convertToUInt16(registers + 11, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->cellV_SF());
 
-    if (m_dataPoints.value("ModAnoTmp").isValid())
-        m_anolyteTemperature = m_dataPoints.value("ModAnoTmp").toFloatWithSSF(m_parentModel->tmp_SF());
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 12, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_anolyteTemperature = SunSpecDataPoint::convertToUInt16(registers + 12, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmp_SF());
 
-    if (m_dataPoints.value("ModCatTmp").isValid())
-        m_catholyteTemperature = m_dataPoints.value("ModCatTmp").toFloatWithSSF(m_parentModel->tmp_SF());
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 13, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_catholyteTemperature = SunSpecDataPoint::convertToUInt16(registers + 13, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmp_SF());
 
-    if (m_dataPoints.value("ModConSt").isValid())
-        m_contactorStatus = static_cast<ModconstFlags>(m_dataPoints.value("ModConSt").toUInt32());
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 14, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_contactorStatus = static_cast<ModconstFlags>(SunSpecDataPoint::convertToUInt32(registers + 14, 2, m_byteOrder));
 
-    if (m_dataPoints.value("ModEvt1").isValid())
-        m_moduleEvent1 = static_cast<Modevt1Flags>(m_dataPoints.value("ModEvt1").toUInt32());
+    if (registerCount >= 18 && SunSpecDataPoint::isValid(registers + 16, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_moduleEvent1 = static_cast<Modevt1Flags>(SunSpecDataPoint::convertToUInt32(registers + 16, 2, m_byteOrder));
 
-    if (m_dataPoints.value("ModEvt2").isValid())
-        m_moduleEvent2 = static_cast<Modevt2Flags>(m_dataPoints.value("ModEvt2").toUInt32());
+    if (registerCount >= 20 && SunSpecDataPoint::isValid(registers + 18, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_moduleEvent2 = static_cast<Modevt2Flags>(SunSpecDataPoint::convertToUInt32(registers + 18, 2, m_byteOrder));
 
-    if (m_dataPoints.value("ModConFail").isValid())
-        m_connectionFailureReason = static_cast<Modconfail>(m_dataPoints.value("ModConFail").toUInt16());
+    if (registerCount >= 21 && SunSpecDataPoint::isValid(registers + 20, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_connectionFailureReason = static_cast<Modconfail>(SunSpecDataPoint::convertToUInt16(registers + 20, 1));
 
-    if (m_dataPoints.value("ModSetEna").isValid())
-        m_enableDisableModule = static_cast<Modsetena>(m_dataPoints.value("ModSetEna").toUInt16());
+    if (registerCount >= 22 && SunSpecDataPoint::isValid(registers + 21, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_enableDisableModule = static_cast<Modsetena>(SunSpecDataPoint::convertToUInt16(registers + 21, 1));
 
-    if (m_dataPoints.value("ModSetCon").isValid())
-        m_connectDisconnectModule = static_cast<Modsetcon>(m_dataPoints.value("ModSetCon").toUInt16());
+    if (registerCount >= 23 && SunSpecDataPoint::isValid(registers + 22, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_connectDisconnectModule = static_cast<Modsetcon>(SunSpecDataPoint::convertToUInt16(registers + 22, 1));
 
-    if (m_dataPoints.value("ModDisRsn").isValid())
-        m_disabledReason = static_cast<Moddisrsn>(m_dataPoints.value("ModDisRsn").toUInt16());
+    if (registerCount >= 24 && SunSpecDataPoint::isValid(registers + 23, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_disabledReason = static_cast<Moddisrsn>(SunSpecDataPoint::convertToUInt16(registers + 23, 1));
 
 
     qCDebug(dcSunSpecModelData()) << this;
 }
 
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexStringIndex
+    { "Idx", "String Index", "Index of the string within the bank.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 2, 0, 1 },
+    // DataPointIndexModuleCount
+    { "NMod", "Module Count", "Number of modules in this string.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 3, 1, 1 },
+    // DataPointIndexConnectedModuleCount
+    { "NModCon", "Connected Module Count", "Number of electrically connected modules in this string.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 4, 2, 1 },
+    // DataPointIndexMaxModuleVoltage
+    { "ModVMax", "Max Module Voltage", "Maximum voltage for all modules in the string.", nullptr, "V", "uint16", "ModV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 5, 3, 1 },
+    // DataPointIndexMaxModuleVoltageModule
+    { "ModVMaxMod", "Max Module Voltage Module", "Module with the maximum voltage.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 6, 4, 1 },
+    // DataPointIndexMinModuleVoltage
+    { "ModVMin", "Min Module Voltage", "Minimum voltage for all modules in the string.", nullptr, "V", "uint16", "ModV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 7, 5, 1 },
+    // DataPointIndexMinModuleVoltageModule
+    { "ModVMinMod", "Min Module Voltage Module", "Module with the minimum voltage.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 8, 6, 1 },
+    // DataPointIndexAverageModuleVoltage
+    { "ModVAvg", "Average Module Voltage", "Average voltage for all modules in the string.", nullptr, "V", "uint16", "ModV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 9, 7, 1 },
+    // DataPointIndexMaxCellVoltage
+    { "CellVMax", "Max Cell Voltage", "Maximum voltage for all cells in the string.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 10, 8, 1 },
+    // DataPointIndexMaxCellVoltageModule
+    { "CellVMaxMod", "Max Cell Voltage Module", "Module containing the cell with the maximum voltage.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 11, 9, 1 },
+    // DataPointIndexMaxCellVoltageStack
+    { "CellVMaxStk", "Max Cell Voltage Stack", "Stack containing the cell with the maximum voltage.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 12, 10, 1 },
+    // DataPointIndexMinCellVoltage
+    { "CellVMin", "Min Cell Voltage", "Minimum voltage for all cells in the string.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 13, 11, 1 },
+    // DataPointIndexMinCellVoltageModule
+    { "CellVMinMod", "Min Cell Voltage Module", "Module containing the cell with the minimum voltage.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 14, 12, 1 },
+    // DataPointIndexMinCellVoltageStack
+    { "CellVMinStk", "Min Cell Voltage Stack", "Stack containing the cell with the minimum voltage.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 15, 13, 1 },
+    // DataPointIndexAverageCellVoltage
+    { "CellVAvg", "Average Cell Voltage", "Average voltage for all cells in the string.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 16, 14, 1 },
+    // DataPointIndexMaxTemperature
+    { "TmpMax", "Max Temperature", "Maximum electrolyte temperature for all modules in the string.", nullptr, "C", "int16", "Tmp_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 17, 15, 1 },
+    // DataPointIndexMaxTemperatureModule
+    { "TmpMaxMod", "Max Temperature Module", "Module with the maximum temperature.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 18, 16, 1 },
+    // DataPointIndexMinTemperature
+    { "TmpMin", "Min Temperature", "Minimum electrolyte temperature for all modules in the string.", nullptr, "C", "int16", "Tmp_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 19, 17, 1 },
+    // DataPointIndexMinTemperatureModule
+    { "TmpMinMod", "Min Temperature Module", "Module with the minimum temperature.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 20, 18, 1 },
+    // DataPointIndexAverageTemperature
+    { "TmpAvg", "Average Temperature", "Average electrolyte temperature for all modules in the string.", nullptr, "C", "int16", "Tmp_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 21, 19, 1 },
+    // DataPointIndexStringEvent1
+    { "Evt1", "String Event 1", "Alarms, warnings and status values.  Bit flags.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, true, 22, 20, 2 },
+    // DataPointIndexStringEvent2
+    { "Evt2", "String Event 2", "Alarms, warnings and status values.  Bit flags.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, true, 24, 22, 2 },
+    // DataPointIndexVendorEventBitfield1
+    { "EvtVnd1", "Vendor Event Bitfield 1", "Vendor defined events.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, true, 26, 24, 2 },
+    // DataPointIndexVendorEventBitfield2
+    { "EvtVnd2", "Vendor Event Bitfield 2", "Vendor defined events.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, true, 28, 26, 2 },
+    // DataPointIndexModV_SF
+    { "ModV_SF", nullptr, nullptr, nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 30, 28, 1 },
+    // DataPointIndexCellV_SF
+    { "CellV_SF", nullptr, "Scale factor for voltage.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 31, 29, 1 },
+    // DataPointIndexTmp_SF
+    { "Tmp_SF", nullptr, "Scale factor for temperature.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 32, 30, 1 },
+    // DataPointIndexSoC_SF
+    { "SoC_SF", nullptr, "Scale factor for state of charge.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 33, 31, 1 },
+    // DataPointIndexOCV_SF
+    { "OCV_SF", nullptr, "Scale factor for open circuit voltage.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 34, 32, 1 },
+    // DataPointIndexPad1
+    { "Pad1", "Pad", "Pad register.", nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, true, 35, 33, 1 }
+};
+
 SunSpecFlowBatteryStringModel::SunSpecFlowBatteryStringModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 807, modelLength, byteOrder, parent)
 {
@@ -617,500 +492,132 @@ quint16 SunSpecFlowBatteryStringModel::pad1() const
 }
 void SunSpecFlowBatteryStringModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint stringIndexDataPoint;
-    stringIndexDataPoint.setName("Idx");
-    stringIndexDataPoint.setLabel("String Index");
-    stringIndexDataPoint.setDescription("Index of the string within the bank.");
-    stringIndexDataPoint.setMandatory(true);
-    stringIndexDataPoint.setSize(1);
-    stringIndexDataPoint.setAddressOffset(2);
-    stringIndexDataPoint.setBlockOffset(0);
-    stringIndexDataPoint.setSunSpecDataType("uint16");
-    stringIndexDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringIndexDataPoint.name(), stringIndexDataPoint);
-
-    SunSpecDataPoint moduleCountDataPoint;
-    moduleCountDataPoint.setName("NMod");
-    moduleCountDataPoint.setLabel("Module Count");
-    moduleCountDataPoint.setDescription("Number of modules in this string.");
-    moduleCountDataPoint.setMandatory(true);
-    moduleCountDataPoint.setSize(1);
-    moduleCountDataPoint.setAddressOffset(3);
-    moduleCountDataPoint.setBlockOffset(1);
-    moduleCountDataPoint.setSunSpecDataType("uint16");
-    moduleCountDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(moduleCountDataPoint.name(), moduleCountDataPoint);
-
-    SunSpecDataPoint connectedModuleCountDataPoint;
-    connectedModuleCountDataPoint.setName("NModCon");
-    connectedModuleCountDataPoint.setLabel("Connected Module Count");
-    connectedModuleCountDataPoint.setDescription("Number of electrically connected modules in this string.");
-    connectedModuleCountDataPoint.setMandatory(true);
-    connectedModuleCountDataPoint.setSize(1);
-    connectedModuleCountDataPoint.setAddressOffset(4);
-    connectedModuleCountDataPoint.setBlockOffset(2);
-    connectedModuleCountDataPoint.setSunSpecDataType("uint16");
-    connectedModuleCountDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(connectedModuleCountDataPoint.name(), connectedModuleCountDataPoint);
-
-    SunSpecDataPoint maxModuleVoltageDataPoint;
-    maxModuleVoltageDataPoint.setName("ModVMax");
-    maxModuleVoltageDataPoint.setLabel("Max Module Voltage");
-    maxModuleVoltageDataPoint.setDescription("Maximum voltage for all modules in the string.");
-    maxModuleVoltageDataPoint.setUnits("V");
-    maxModuleVoltageDataPoint.setMandatory(true);
-    maxModuleVoltageDataPoint.setSize(1);
-    maxModuleVoltageDataPoint.setAddressOffset(5);
-    maxModuleVoltageDataPoint.setBlockOffset(3);
-    maxModuleVoltageDataPoint.setScaleFactorName("ModV_SF");
-    maxModuleVoltageDataPoint.setSunSpecDataType("uint16");
-    maxModuleVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxModuleVoltageDataPoint.name(), maxModuleVoltageDataPoint);
-
-    SunSpecDataPoint maxModuleVoltageModuleDataPoint;
-    maxModuleVoltageModuleDataPoint.setName("ModVMaxMod");
-    maxModuleVoltageModuleDataPoint.setLabel("Max Module Voltage Module");
-    maxModuleVoltageModuleDataPoint.setDescription("Module with the maximum voltage.");
-    maxModuleVoltageModuleDataPoint.setSize(1);
-    maxModuleVoltageModuleDataPoint.setAddressOffset(6);
-    maxModuleVoltageModuleDataPoint.setBlockOffset(4);
-    maxModuleVoltageModuleDataPoint.setSunSpecDataType("uint16");
-    maxModuleVoltageModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxModuleVoltageModuleDataPoint.name(), maxModuleVoltageModuleDataPoint);
-
-    SunSpecDataPoint minModuleVoltageDataPoint;
-    minModuleVoltageDataPoint.setName("ModVMin");
-    minModuleVoltageDataPoint.setLabel("Min Module Voltage");
-    minModuleVoltageDataPoint.setDescription("Minimum voltage for all modules in the string.");
-    minModuleVoltageDataPoint.setUnits("V");
-    minModuleVoltageDataPoint.setMandatory(true);
-    minModuleVoltageDataPoint.setSize(1);
-    minModuleVoltageDataPoint.setAddressOffset(7);
-    minModuleVoltageDataPoint.setBlockOffset(5);
-    minModuleVoltageDataPoint.setScaleFactorName("ModV_SF");
-    minModuleVoltageDataPoint.setSunSpecDataType("uint16");
-    minModuleVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minModuleVoltageDataPoint.name(), minModuleVoltageDataPoint);
-
-    SunSpecDataPoint minModuleVoltageModuleDataPoint;
-    minModuleVoltageModuleDataPoint.setName("ModVMinMod");
-    minModuleVoltageModuleDataPoint.setLabel("Min Module Voltage Module");
-    minModuleVoltageModuleDataPoint.setDescription("Module with the minimum voltage.");
-    minModuleVoltageModuleDataPoint.setSize(1);
-    minModuleVoltageModuleDataPoint.setAddressOffset(8);
-    minModuleVoltageModuleDataPoint.setBlockOffset(6);
-    minModuleVoltageModuleDataPoint.setSunSpecDataType("uint16");
-    minModuleVoltageModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minModuleVoltageModuleDataPoint.name(), minModuleVoltageModuleDataPoint);
-
-    SunSpecDataPoint averageModuleVoltageDataPoint;
-    averageModuleVoltageDataPoint.setName("ModVAvg");
-    averageModuleVoltageDataPoint.setLabel("Average Module Voltage");
-    averageModuleVoltageDataPoint.setDescription("Average voltage for all modules in the string.");
-    averageModuleVoltageDataPoint.setUnits("V");
-    averageModuleVoltageDataPoint.setMandatory(true);
-    averageModuleVoltageDataPoint.setSize(1);
-    averageModuleVoltageDataPoint.setAddressOffset(9);
-    averageModuleVoltageDataPoint.setBlockOffset(7);
-    averageModuleVoltageDataPoint.setScaleFactorName("ModV_SF");
-    averageModuleVoltageDataPoint.setSunSpecDataType("uint16");
-    averageModuleVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(averageModuleVoltageDataPoint.name(), averageModuleVoltageDataPoint);
-
-    SunSpecDataPoint maxCellVoltageDataPoint;
-    maxCellVoltageDataPoint.setName("CellVMax");
-    maxCellVoltageDataPoint.setLabel("Max Cell Voltage");
-    maxCellVoltageDataPoint.setDescription("Maximum voltage for all cells in the string.");
-    maxCellVoltageDataPoint.setUnits("V");
-    maxCellVoltageDataPoint.setSize(1);
-    maxCellVoltageDataPoint.setAddressOffset(10);
-    maxCellVoltageDataPoint.setBlockOffset(8);
-    maxCellVoltageDataPoint.setScaleFactorName("CellV_SF");
-    maxCellVoltageDataPoint.setSunSpecDataType("uint16");
-    maxCellVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxCellVoltageDataPoint.name(), maxCellVoltageDataPoint);
-
-    SunSpecDataPoint maxCellVoltageModuleDataPoint;
-    maxCellVoltageModuleDataPoint.setName("CellVMaxMod");
-    maxCellVoltageModuleDataPoint.setLabel("Max Cell Voltage Module");
-    maxCellVoltageModuleDataPoint.setDescription("Module containing the cell with the maximum voltage.");
-    maxCellVoltageModuleDataPoint.setSize(1);
-    maxCellVoltageModuleDataPoint.setAddressOffset(11);
-    maxCellVoltageModuleDataPoint.setBlockOffset(9);
-    maxCellVoltageModuleDataPoint.setSunSpecDataType("uint16");
-    maxCellVoltageModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxCellVoltageModuleDataPoint.name(), maxCellVoltageModuleDataPoint);
-
-    SunSpecDataPoint maxCellVoltageStackDataPoint;
-    maxCellVoltageStackDataPoint.setName("CellVMaxStk");
-    maxCellVoltageStackDataPoint.setLabel("Max Cell Voltage Stack");
-    maxCellVoltageStackDataPoint.setDescription("Stack containing the cell with the maximum voltage.");
-    maxCellVoltageStackDataPoint.setSize(1);
-    maxCellVoltageStackDataPoint.setAddressOffset(12);
-    maxCellVoltageStackDataPoint.setBlockOffset(10);
-    maxCellVoltageStackDataPoint.setSunSpecDataType("uint16");
-    maxCellVoltageStackDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxCellVoltageStackDataPoint.name(), maxCellVoltageStackDataPoint);
-
-    SunSpecDataPoint minCellVoltageDataPoint;
-    minCellVoltageDataPoint.setName("CellVMin");
-    minCellVoltageDataPoint.setLabel("Min Cell Voltage");
-    minCellVoltageDataPoint.setDescription("Minimum voltage for all cells in the string.");
-    minCellVoltageDataPoint.setUnits("V");
-    minCellVoltageDataPoint.setSize(1);
-    minCellVoltageDataPoint.setAddressOffset(13);
-    minCellVoltageDataPoint.setBlockOffset(11);
-    minCellVoltageDataPoint.setScaleFactorName("CellV_SF");
-    minCellVoltageDataPoint.setSunSpecDataType("uint16");
-    minCellVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minCellVoltageDataPoint.name(), minCellVoltageDataPoint);
-
-    SunSpecDataPoint minCellVoltageModuleDataPoint;
-    minCellVoltageModuleDataPoint.setName("CellVMinMod");
-    minCellVoltageModuleDataPoint.setLabel("Min Cell Voltage Module");
-    minCellVoltageModuleDataPoint.setDescription("Module containing the cell with the minimum voltage.");
-    minCellVoltageModuleDataPoint.setSize(1);
-    minCellVoltageModuleDataPoint.setAddressOffset(14);
-    minCellVoltageModuleDataPoint.setBlockOffset(12);
-    minCellVoltageModuleDataPoint.setSunSpecDataType("uint16");
-    minCellVoltageModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minCellVoltageModuleDataPoint.name(), minCellVoltageModuleDataPoint);
-
-    SunSpecDataPoint minCellVoltageStackDataPoint;
-    minCellVoltageStackDataPoint.setName("CellVMinStk");
-    minCellVoltageStackDataPoint.setLabel("Min Cell Voltage Stack");
-    minCellVoltageStackDataPoint.setDescription("Stack containing the cell with the minimum voltage.");
-    minCellVoltageStackDataPoint.setSize(1);
-    minCellVoltageStackDataPoint.setAddressOffset(15);
-    minCellVoltageStackDataPoint.setBlockOffset(13);
-    minCellVoltageStackDataPoint.setSunSpecDataType("uint16");
-    minCellVoltageStackDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minCellVoltageStackDataPoint.name(), minCellVoltageStackDataPoint);
-
-    SunSpecDataPoint averageCellVoltageDataPoint;
-    averageCellVoltageDataPoint.setName("CellVAvg");
-    averageCellVoltageDataPoint.setLabel("Average Cell Voltage");
-    averageCellVoltageDataPoint.setDescription("Average voltage for all cells in the string.");
-    averageCellVoltageDataPoint.setUnits("V");
-    averageCellVoltageDataPoint.setSize(1);
-    averageCellVoltageDataPoint.setAddressOffset(16);
-    averageCellVoltageDataPoint.setBlockOffset(14);
-    averageCellVoltageDataPoint.setScaleFactorName("CellV_SF");
-    averageCellVoltageDataPoint.setSunSpecDataType("uint16");
-    averageCellVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(averageCellVoltageDataPoint.name(), averageCellVoltageDataPoint);
-
-    SunSpecDataPoint maxTemperatureDataPoint;
-    maxTemperatureDataPoint.setName("TmpMax");
-    maxTemperatureDataPoint.setLabel("Max Temperature");
-    maxTemperatureDataPoint.setDescription("Maximum electrolyte temperature for all modules in the string.");
-    maxTemperatureDataPoint.setUnits("C");
-    maxTemperatureDataPoint.setMandatory(true);
-    maxTemperatureDataPoint.setSize(1);
-    maxTemperatureDataPoint.setAddressOffset(17);
-    maxTemperatureDataPoint.setBlockOffset(15);
-    maxTemperatureDataPoint.setScaleFactorName("Tmp_SF");
-    maxTemperatureDataPoint.setSunSpecDataType("int16");
-    maxTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxTemperatureDataPoint.name(), maxTemperatureDataPoint);
-
-    SunSpecDataPoint maxTemperatureModuleDataPoint;
-    maxTemperatureModuleDataPoint.setName("TmpMaxMod");
-    maxTemperatureModuleDataPoint.setLabel("Max Temperature Module");
-    maxTemperatureModuleDataPoint.setDescription("Module with the maximum temperature.");
-    maxTemperatureModuleDataPoint.setSize(1);
-    maxTemperatureModuleDataPoint.setAddressOffset(18);
-    maxTemperatureModuleDataPoint.setBlockOffset(16);
-    maxTemperatureModuleDataPoint.setSunSpecDataType("uint16");
-    maxTemperatureModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxTemperatureModuleDataPoint.name(), maxTemperatureModuleDataPoint);
-
-    SunSpecDataPoint minTemperatureDataPoint;
-    minTemperatureDataPoint.setName("TmpMin");
-    minTemperatureDataPoint.setLabel("Min Temperature");
-    minTemperatureDataPoint.setDescription("Minimum electrolyte temperature for all modules in the string.");
-    minTemperatureDataPoint.setUnits("C");
-    minTemperatureDataPoint.setMandatory(true);
-    minTemperatureDataPoint.setSize(1);
-    minTemperatureDataPoint.setAddressOffset(19);
-    minTemperatureDataPoint.setBlockOffset(17);
-    minTemperatureDataPoint.setScaleFactorName("Tmp_SF");
-    minTemperatureDataPoint.setSunSpecDataType("int16");
-    minTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minTemperatureDataPoint.name(), minTemperatureDataPoint);
-
-    SunSpecDataPoint minTemperatureModuleDataPoint;
-    minTemperatureModuleDataPoint.setName("TmpMinMod");
-    minTemperatureModuleDataPoint.setLabel("Min Temperature Module");
-    minTemperatureModuleDataPoint.setDescription("Module with the minimum temperature.");
-    minTemperatureModuleDataPoint.setSize(1);
-    minTemperatureModuleDataPoint.setAddressOffset(20);
-    minTemperatureModuleDataPoint.setBlockOffset(18);
-    minTemperatureModuleDataPoint.setSunSpecDataType("uint16");
-    minTemperatureModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minTemperatureModuleDataPoint.name(), minTemperatureModuleDataPoint);
-
-    SunSpecDataPoint averageTemperatureDataPoint;
-    averageTemperatureDataPoint.setName("TmpAvg");
-    averageTemperatureDataPoint.setLabel("Average Temperature");
-    averageTemperatureDataPoint.setDescription("Average electrolyte temperature for all modules in the string.");
-    averageTemperatureDataPoint.setUnits("C");
-    averageTemperatureDataPoint.setMandatory(true);
-    averageTemperatureDataPoint.setSize(1);
-    averageTemperatureDataPoint.setAddressOffset(21);
-    averageTemperatureDataPoint.setBlockOffset(19);
-    averageTemperatureDataPoint.setScaleFactorName("Tmp_SF");
-    averageTemperatureDataPoint.setSunSpecDataType("int16");
-    averageTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(averageTemperatureDataPoint.name(), averageTemperatureDataPoint);
-
-    SunSpecDataPoint stringEvent1DataPoint;
-    stringEvent1DataPoint.setName("Evt1");
-    stringEvent1DataPoint.setLabel("String Event 1");
-    stringEvent1DataPoint.setDescription("Alarms, warnings and status values.  Bit flags.");
-    stringEvent1DataPoint.setMandatory(true);
-    stringEvent1DataPoint.setSize(2);
-    stringEvent1DataPoint.setAddressOffset(22);
-    stringEvent1DataPoint.setBlockOffset(20);
-    stringEvent1DataPoint.setSunSpecDataType("bitfield32");
-    stringEvent1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringEvent1DataPoint.name(), stringEvent1DataPoint);
-
-    SunSpecDataPoint stringEvent2DataPoint;
-    stringEvent2DataPoint.setName("Evt2");
-    stringEvent2DataPoint.setLabel("String Event 2");
-    stringEvent2DataPoint.setDescription("Alarms, warnings and status values.  Bit flags.");
-    stringEvent2DataPoint.setMandatory(true);
-    stringEvent2DataPoint.setSize(2);
-    stringEvent2DataPoint.setAddressOffset(24);
-    stringEvent2DataPoint.setBlockOffset(22);
-    stringEvent2DataPoint.setSunSpecDataType("bitfield32");
-    stringEvent2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringEvent2DataPoint.name(), stringEvent2DataPoint);
-
-    SunSpecDataPoint vendorEventBitfield1DataPoint;
-    vendorEventBitfield1DataPoint.setName("EvtVnd1");
-    vendorEventBitfield1DataPoint.setLabel("Vendor Event Bitfield 1");
-    vendorEventBitfield1DataPoint.setDescription("Vendor defined events.");
-    vendorEventBitfield1DataPoint.setMandatory(true);
-    vendorEventBitfield1DataPoint.setSize(2);
-    vendorEventBitfield1DataPoint.setAddressOffset(26);
-    vendorEventBitfield1DataPoint.setBlockOffset(24);
-    vendorEventBitfield1DataPoint.setSunSpecDataType("bitfield32");
-    vendorEventBitfield1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vendorEventBitfield1DataPoint.name(), vendorEventBitfield1DataPoint);
-
-    SunSpecDataPoint vendorEventBitfield2DataPoint;
-    vendorEventBitfield2DataPoint.setName("EvtVnd2");
-    vendorEventBitfield2DataPoint.setLabel("Vendor Event Bitfield 2");
-    vendorEventBitfield2DataPoint.setDescription("Vendor defined events.");
-    vendorEventBitfield2DataPoint.setMandatory(true);
-    vendorEventBitfield2DataPoint.setSize(2);
-    vendorEventBitfield2DataPoint.setAddressOffset(28);
-    vendorEventBitfield2DataPoint.setBlockOffset(26);
-    vendorEventBitfield2DataPoint.setSunSpecDataType("bitfield32");
-    vendorEventBitfield2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vendorEventBitfield2DataPoint.name(), vendorEventBitfield2DataPoint);
-
-    SunSpecDataPoint modV_SFDataPoint;
-    modV_SFDataPoint.setName("ModV_SF");
-    modV_SFDataPoint.setMandatory(true);
-    modV_SFDataPoint.setSize(1);
-    modV_SFDataPoint.setAddressOffset(30);
-    modV_SFDataPoint.setBlockOffset(28);
-    modV_SFDataPoint.setSunSpecDataType("sunssf");
-    modV_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modV_SFDataPoint.name(), modV_SFDataPoint);
-
-    SunSpecDataPoint cellV_SFDataPoint;
-    cellV_SFDataPoint.setName("CellV_SF");
-    cellV_SFDataPoint.setDescription("Scale factor for voltage.");
-    cellV_SFDataPoint.setMandatory(true);
-    cellV_SFDataPoint.setSize(1);
-    cellV_SFDataPoint.setAddressOffset(31);
-    cellV_SFDataPoint.setBlockOffset(29);
-    cellV_SFDataPoint.setSunSpecDataType("sunssf");
-    cellV_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(cellV_SFDataPoint.name(), cellV_SFDataPoint);
-
-    SunSpecDataPoint tmp_SFDataPoint;
-    tmp_SFDataPoint.setName("Tmp_SF");
-    tmp_SFDataPoint.setDescription("Scale factor for temperature.");
-    tmp_SFDataPoint.setMandatory(true);
-    tmp_SFDataPoint.setSize(1);
-    tmp_SFDataPoint.setAddressOffset(32);
-    tmp_SFDataPoint.setBlockOffset(30);
-    tmp_SFDataPoint.setSunSpecDataType("sunssf");
-    tmp_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tmp_SFDataPoint.name(), tmp_SFDataPoint);
-
-    SunSpecDataPoint soC_SFDataPoint;
-    soC_SFDataPoint.setName("SoC_SF");
-    soC_SFDataPoint.setDescription("Scale factor for state of charge.");
-    soC_SFDataPoint.setMandatory(true);
-    soC_SFDataPoint.setSize(1);
-    soC_SFDataPoint.setAddressOffset(33);
-    soC_SFDataPoint.setBlockOffset(31);
-    soC_SFDataPoint.setSunSpecDataType("sunssf");
-    soC_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(soC_SFDataPoint.name(), soC_SFDataPoint);
-
-    SunSpecDataPoint oCV_SFDataPoint;
-    oCV_SFDataPoint.setName("OCV_SF");
-    oCV_SFDataPoint.setDescription("Scale factor for open circuit voltage.");
-    oCV_SFDataPoint.setMandatory(true);
-    oCV_SFDataPoint.setSize(1);
-    oCV_SFDataPoint.setAddressOffset(34);
-    oCV_SFDataPoint.setBlockOffset(32);
-    oCV_SFDataPoint.setSunSpecDataType("sunssf");
-    oCV_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(oCV_SFDataPoint.name(), oCV_SFDataPoint);
-
-    SunSpecDataPoint pad1DataPoint;
-    pad1DataPoint.setName("Pad1");
-    pad1DataPoint.setLabel("Pad");
-    pad1DataPoint.setDescription("Pad register.");
-    pad1DataPoint.setMandatory(true);
-    pad1DataPoint.setSize(1);
-    pad1DataPoint.setAddressOffset(35);
-    pad1DataPoint.setBlockOffset(33);
-    pad1DataPoint.setSunSpecDataType("pad");
-    pad1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pad1DataPoint.name(), pad1DataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 32;
 }
 
 void SunSpecFlowBatteryStringModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("ModV_SF").isValid())
-        m_modV_SF = m_dataPoints.value("ModV_SF").toInt16();
+    if (registerCount >= 31 && SunSpecDataPoint::isValid(registers + 30, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 30, 1);
+        if (scaleFactor != m_modV_SF) {
+            m_modV_SF = scaleFactor;
+            m_modV_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("CellV_SF").isValid())
-        m_cellV_SF = m_dataPoints.value("CellV_SF").toInt16();
+    if (registerCount >= 32 && SunSpecDataPoint::isValid(registers + 31, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 31, 1);
+        if (scaleFactor != m_cellV_SF) {
+            m_cellV_SF = scaleFactor;
+            m_cellV_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("Tmp_SF").isValid())
-        m_tmp_SF = m_dataPoints.value("Tmp_SF").toInt16();
+    if (registerCount >= 33 && SunSpecDataPoint::isValid(registers + 32, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 32, 1);
+        if (scaleFactor != m_tmp_SF) {
+            m_tmp_SF = scaleFactor;
+            m_tmp_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("SoC_SF").isValid())
-        m_soC_SF = m_dataPoints.value("SoC_SF").toInt16();
+    if (registerCount >= 34 && SunSpecDataPoint::isValid(registers + 33, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 33, 1);
+        if (scaleFactor != m_soC_SF) {
+            m_soC_SF = scaleFactor;
+            m_soC_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("OCV_SF").isValid())
-        m_oCV_SF = m_dataPoints.value("OCV_SF").toInt16();
+    if (registerCount >= 35 && SunSpecDataPoint::isValid(registers + 34, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 34, 1);
+        if (scaleFactor != m_oCV_SF) {
+            m_oCV_SF = scaleFactor;
+            m_oCV_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("Idx").isValid())
-        m_stringIndex = m_dataPoints.value("Idx").toUInt16();
-
-    if (m_dataPoints.value("NMod").isValid())
-        m_moduleCount = m_dataPoints.value("NMod").toUInt16();
-
-    if (m_dataPoints.value("NModCon").isValid())
-        m_connectedModuleCount = m_dataPoints.value("NModCon").toUInt16();
-
-    if (m_dataPoints.value("ModVMax").isValid())
-        m_maxModuleVoltage = m_dataPoints.value("ModVMax").toFloatWithSSF(m_modV_SF);
-
-    if (m_dataPoints.value("ModVMaxMod").isValid())
-        m_maxModuleVoltageModule = m_dataPoints.value("ModVMaxMod").toUInt16();
-
-    if (m_dataPoints.value("ModVMin").isValid())
-        m_minModuleVoltage = m_dataPoints.value("ModVMin").toFloatWithSSF(m_modV_SF);
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_stringIndex = SunSpecDataPoint::convertToUInt16(registers + 2, 1);
 
-    if (m_dataPoints.value("ModVMinMod").isValid())
-        m_minModuleVoltageModule = m_dataPoints.value("ModVMinMod").toUInt16();
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_moduleCount = SunSpecDataPoint::convertToUInt16(registers + 3, 1);
 
-    if (m_dataPoints.value("ModVAvg").isValid())
-        m_averageModuleVoltage = m_dataPoints.value("ModVAvg").toFloatWithSSF(m_modV_SF);
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_connectedModuleCount = SunSpecDataPoint::convertToUInt16(registers + 4, 1);
 
-    if (m_dataPoints.value("CellVMax").isValid())
-        m_maxCellVoltage = m_dataPoints.value("CellVMax").toFloatWithSSF(m_cellV_SF);
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxModuleVoltage = SunSpecDataPoint::convertToUInt16(registers + 5, 1) * m_modV_SFMultiplier;
 
-    if (m_dataPoints.value("CellVMaxMod").isValid())
-        m_maxCellVoltageModule = m_dataPoints.value("CellVMaxMod").toUInt16();
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxModuleVoltageModule = SunSpecDataPoint::convertToUInt16(registers + 6, 1);
 
-    if (m_dataPoints.value("CellVMaxStk").isValid())
-        m_maxCellVoltageStack = m_dataPoints.value("CellVMaxStk").toUInt16();
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minModuleVoltage = SunSpecDataPoint::convertToUInt16(registers + 7, 1) * m_modV_SFMultiplier;
 
-    if (m_dataPoints.value("CellVMin").isValid())
-        m_minCellVoltage = m_dataPoints.value("CellVMin").toFloatWithSSF(m_cellV_SF);
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minModuleVoltageModule = SunSpecDataPoint::convertToUInt16(registers + 8, 1);
 
-    if (m_dataPoints.value("CellVMinMod").isValid())
-        m_minCellVoltageModule = m_dataPoints.value("CellVMinMod").toUInt16();
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_averageModuleVoltage = SunSpecDataPoint::convertToUInt16(registers + 9, 1) * m_modV_SFMultiplier;
 
-    if (m_dataPoints.value("CellVMinStk").isValid())
-        m_minCellVoltageStack = m_dataPoints.value("CellVMinStk").toUInt16();
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxCellVoltage = SunSpecDataPoint::convertToUInt16(registers + 10, 1) * m_cellV_SFMultiplier;
 
-    if (m_dataPoints.value("CellVAvg").isValid())
-        m_averageCellVoltage = m_dataPoints.value("CellVAvg").toFloatWithSSF(m_cellV_SF);
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxCellVoltageModule = SunSpecDataPoint::convertToUInt16(registers + 11, 1);
 
-    if (m_dataPoints.value("TmpMax").isValid())
-        m_maxTemperature = m_dataPoints.value("TmpMax").toFloatWithSSF(m_tmp_SF);
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 12, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxCellVoltageStack = SunSpecDataPoint::convertToUInt16(registers + 12, 1);
 
-    if (m_dataPoints.value("TmpMaxMod").isValid())
-        m_maxTemperatureModule = m_dataPoints.value("TmpMaxMod").toUInt16();
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 13, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minCellVoltage = SunSpecDataPoint::convertToUInt16(registers + 13, 1) * m_cellV_SFMultiplier;
 
-    if (m_dataPoints.value("TmpMin").isValid())
-        m_minTemperature = m_dataPoints.value("TmpMin").toFloatWithSSF(m_tmp_SF);
+    if (registerCount >= 15 && SunSpecDataPoint::isValid(registers + 14, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minCellVoltageModule = SunSpecDataPoint::convertToUInt16(registers + 14, 1);
 
-    if (m_dataPoints.value("TmpMinMod").isValid())
-        m_minTemperatureModule = m_dataPoints.value("TmpMinMod").toUInt16();
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 15, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minCellVoltageStack = SunSpecDataPoint::convertToUInt16(registers + 15, 1);
 
-    if (m_dataPoints.value("TmpAvg").isValid())
-        m_averageTemperature = m_dataPoints.value("TmpAvg").toFloatWithSSF(m_tmp_SF);
+    if (registerCount >= 17 && SunSpecDataPoint::isValid(registers + 16, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_averageCellVoltage = SunSpecDataPoint::convertToUInt16(registers + 16, 1) * m_cellV_SFMultiplier;
 
-    if (m_dataPoints.value("Evt1").isValid())
-        m_stringEvent1 = static_cast<Evt1Flags>(m_dataPoints.value("Evt1").toUInt32());
+    if (registerCount >= 18 && SunSpecDataPoint::isValid(registers + 17, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_maxTemperature = SunSpecDataPoint::convertToInt16(registers + 17, 1) * m_tmp_SFMultiplier;
 
-    if (m_dataPoints.value("Evt2").isValid())
-        m_stringEvent2 = static_cast<Evt2Flags>(m_dataPoints.value("Evt2").toUInt32());
+    if (registerCount >= 19 && SunSpecDataPoint::isValid(registers + 18, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxTemperatureModule = SunSpecDataPoint::convertToUInt16(registers + 18, 1);
 
-    if (m_dataPoints.value("EvtVnd1").isValid())
-        m_vendorEventBitfield1 = m_dataPoints.value("EvtVnd1").toUInt32();
+    if (registerCount >= 20 && SunSpecDataPoint::isValid(registers + 19, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_minTemperature = SunSpecDataPoint::convertToInt16(registers + 19, 1) * m_tmp_SFMultiplier;
 
-    if (m_dataPoints.value("EvtVnd2").isValid())
-        m_vendorEventBitfield2 = m_dataPoints.value("EvtVnd2").toUInt32();
+    if (registerCount >= 21 && SunSpecDataPoint::isValid(registers + 20, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minTemperatureModule = SunSpecDataPoint::convertToUInt16(registers + 20, 1);
 
-    if (m_dataPoints.value("ModV_SF").isValid())
-        m_modV_SF = m_dataPoints.value("ModV_SF").toInt16();
+    if (registerCount >= 22 && SunSpecDataPoint::isValid(registers + 21, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_averageTemperature = SunSpecDataPoint::convertToInt16(registers + 21, 1) * m_tmp_SFMultiplier;
 
-    if (m_dataPoints.value("CellV_SF").isValid())
-        m_cellV_SF = m_dataPoints.value("CellV_SF").toInt16();
+    if (registerCount >= 24 && SunSpecDataPoint::isValid(registers + 22, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_stringEvent1 = static_cast<Evt1Flags>(SunSpecDataPoint::convertToUInt32(registers + 22, 2, m_byteOrder));
 
-    if (m_dataPoints.value("Tmp_SF").isValid())
-        m_tmp_SF = m_dataPoints.value("Tmp_SF").toInt16();
+    if (registerCount >= 26 && SunSpecDataPoint::isValid(registers + 24, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_stringEvent2 = static_cast<Evt2Flags>(SunSpecDataPoint::convertToUInt32(registers + 24, 2, m_byteOrder));
 
-    if (m_dataPoints.value("SoC_SF").isValid())
-        m_soC_SF = m_dataPoints.value("SoC_SF").toInt16();
+    if (registerCount >= 28 && SunSpecDataPoint::isValid(registers + 26, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_vendorEventBitfield1 = SunSpecDataPoint::convertToUInt32(registers + 26, 2, m_byteOrder);
 
-    if (m_dataPoints.value("OCV_SF").isValid())
-        m_oCV_SF = m_dataPoints.value("OCV_SF").toInt16();
+    if (registerCount >= 30 && SunSpecDataPoint::isValid(registers + 28, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_vendorEventBitfield2 = SunSpecDataPoint::convertToUInt32(registers + 28, 2, m_byteOrder);
 
-    if (m_dataPoints.value("Pad1").isValid())
-        m_pad1 = m_dataPoints.value("Pad1").toUInt16();
+    if (registerCount >= 36 && SunSpecDataPoint::isValid(registers + 35, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad1 = SunSpecDataPoint::convertToUInt16(registers + 35, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -1119,176 +626,176 @@ void SunSpecFlowBatteryStringModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecFlowBatteryStringModel *model)
 {
     debug.nospace().noquote() << "SunSpecFlowBatteryStringModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Idx") << "-->";
-    if (model->dataPoints().value("Idx").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexStringIndex) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexStringIndex).isValid()) {
         debug.nospace().noquote() << model->stringIndex() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NMod") << "-->";
-    if (model->dataPoints().value("NMod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexModuleCount) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexModuleCount).isValid()) {
         debug.nospace().noquote() << model->moduleCount() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NModCon") << "-->";
-    if (model->dataPoints().value("NModCon").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexConnectedModuleCount) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexConnectedModuleCount).isValid()) {
         debug.nospace().noquote() << model->connectedModuleCount() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModVMax") << "-->";
-    if (model->dataPoints().value("ModVMax").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMaxModuleVoltage) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMaxModuleVoltage).isValid()) {
         debug.nospace().noquote() << model->maxModuleVoltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModVMaxMod") << "-->";
-    if (model->dataPoints().value("ModVMaxMod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMaxModuleVoltageModule) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMaxModuleVoltageModule).isValid()) {
         debug.nospace().noquote() << model->maxModuleVoltageModule() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModVMin") << "-->";
-    if (model->dataPoints().value("ModVMin").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMinModuleVoltage) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMinModuleVoltage).isValid()) {
         debug.nospace().noquote() << model->minModuleVoltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModVMinMod") << "-->";
-    if (model->dataPoints().value("ModVMinMod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMinModuleVoltageModule) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMinModuleVoltageModule).isValid()) {
         debug.nospace().noquote() << model->minModuleVoltageModule() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModVAvg") << "-->";
-    if (model->dataPoints().value("ModVAvg").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexAverageModuleVoltage) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexAverageModuleVoltage).isValid()) {
         debug.nospace().noquote() << model->averageModuleVoltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CellVMax") << "-->";
-    if (model->dataPoints().value("CellVMax").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMaxCellVoltage) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMaxCellVoltage).isValid()) {
         debug.nospace().noquote() << model->maxCellVoltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CellVMaxMod") << "-->";
-    if (model->dataPoints().value("CellVMaxMod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMaxCellVoltageModule) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMaxCellVoltageModule).isValid()) {
         debug.nospace().noquote() << model->maxCellVoltageModule() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CellVMaxStk") << "-->";
-    if (model->dataPoints().value("CellVMaxStk").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMaxCellVoltageStack) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMaxCellVoltageStack).isValid()) {
         debug.nospace().noquote() << model->maxCellVoltageStack() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CellVMin") << "-->";
-    if (model->dataPoints().value("CellVMin").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMinCellVoltage) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMinCellVoltage).isValid()) {
         debug.nospace().noquote() << model->minCellVoltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CellVMinMod") << "-->";
-    if (model->dataPoints().value("CellVMinMod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMinCellVoltageModule) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMinCellVoltageModule).isValid()) {
         debug.nospace().noquote() << model->minCellVoltageModule() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CellVMinStk") << "-->";
-    if (model->dataPoints().value("CellVMinStk").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMinCellVoltageStack) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMinCellVoltageStack).isValid()) {
         debug.nospace().noquote() << model->minCellVoltageStack() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CellVAvg") << "-->";
-    if (model->dataPoints().value("CellVAvg").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexAverageCellVoltage) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexAverageCellVoltage).isValid()) {
         debug.nospace().noquote() << model->averageCellVoltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("TmpMax") << "-->";
-    if (model->dataPoints().value("TmpMax").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMaxTemperature) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMaxTemperature).isValid()) {
         debug.nospace().noquote() << model->maxTemperature() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("TmpMaxMod") << "-->";
-    if (model->dataPoints().value("TmpMaxMod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMaxTemperatureModule) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMaxTemperatureModule).isValid()) {
         debug.nospace().noquote() << model->maxTemperatureModule() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("TmpMin") << "-->";
-    if (model->dataPoints().value("TmpMin").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMinTemperature) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMinTemperature).isValid()) {
         debug.nospace().noquote() << model->minTemperature() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("TmpMinMod") << "-->";
-    if (model->dataPoints().value("TmpMinMod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMinTemperatureModule) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexMinTemperatureModule).isValid()) {
         debug.nospace().noquote() << model->minTemperatureModule() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("TmpAvg") << "-->";
-    if (model->dataPoints().value("TmpAvg").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexAverageTemperature) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexAverageTemperature).isValid()) {
         debug.nospace().noquote() << model->averageTemperature() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Evt1") << "-->";
-    if (model->dataPoints().value("Evt1").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexStringEvent1) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexStringEvent1).isValid()) {
         debug.nospace().noquote() << model->stringEvent1() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Evt2") << "-->";
-    if (model->dataPoints().value("Evt2").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexStringEvent2) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexStringEvent2).isValid()) {
         debug.nospace().noquote() << model->stringEvent2() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("EvtVnd1") << "-->";
-    if (model->dataPoints().value("EvtVnd1").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexVendorEventBitfield1) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexVendorEventBitfield1).isValid()) {
         debug.nospace().noquote() << model->vendorEventBitfield1() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("EvtVnd2") << "-->";
-    if (model->dataPoints().value("EvtVnd2").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexVendorEventBitfield2) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexVendorEventBitfield2).isValid()) {
         debug.nospace().noquote() << model->vendorEventBitfield2() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Pad1") << "-->";
-    if (model->dataPoints().value("Pad1").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexPad1) << "-->";
+    if (model->dataPoint(SunSpecFlowBatteryStringModel::DataPointIndexPad1).isValid()) {
         debug.nospace().noquote() << model->pad1() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
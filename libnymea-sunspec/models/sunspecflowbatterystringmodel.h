@@ -167,6 +167,29 @@ public:
     Q_DECLARE_FLAGS(Modevt2Flags, Modevt2)
     Q_FLAG(Modevt2)
 
+    enum DataPointIndex {
+        DataPointIndexModuleIndex = 0,
+        DataPointIndexStackCount,
+        DataPointIndexModuleStatus,
+        DataPointIndexModuleStateOfCharge,
+        DataPointIndexOpenCircuitVoltage,
+        DataPointIndexExternalVoltage,
+        DataPointIndexMaximumCellVoltage,
+        DataPointIndexMaxCellVoltageCell,
+        DataPointIndexMinimumCellVoltage,
+        DataPointIndexMinCellVoltageCell,
+        DataPointIndexAverageCellVoltage,
+        DataPointIndexAnolyteTemperature,
+        DataPointIndexCatholyteTemperature,
+        DataPointIndexContactorStatus,
+        DataPointIndexModuleEvent1,
+        DataPointIndexModuleEvent2,
+        DataPointIndexConnectionFailureReason,
+        DataPointIndexEnableDisableModule,
+        DataPointIndexConnectDisconnectModule,
+        DataPointIndexDisabledReason
+    };
+
     explicit SunSpecFlowBatteryStringModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecFlowBatteryStringModel *parent = nullptr);
     ~SunSpecFlowBatteryStringModelRepeatingBlock() override = default;
 
@@ -303,6 +326,41 @@ public:
     Q_DECLARE_FLAGS(Evt2Flags, Evt2)
     Q_FLAG(Evt2)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexStringIndex,
+        DataPointIndexModuleCount,
+        DataPointIndexConnectedModuleCount,
+        DataPointIndexMaxModuleVoltage,
+        DataPointIndexMaxModuleVoltageModule,
+        DataPointIndexMinModuleVoltage,
+        DataPointIndexMinModuleVoltageModule,
+        DataPointIndexAverageModuleVoltage,
+        DataPointIndexMaxCellVoltage,
+        DataPointIndexMaxCellVoltageModule,
+        DataPointIndexMaxCellVoltageStack,
+        DataPointIndexMinCellVoltage,
+        DataPointIndexMinCellVoltageModule,
+        DataPointIndexMinCellVoltageStack,
+        DataPointIndexAverageCellVoltage,
+        DataPointIndexMaxTemperature,
+        DataPointIndexMaxTemperatureModule,
+        DataPointIndexMinTemperature,
+        DataPointIndexMinTemperatureModule,
+        DataPointIndexAverageTemperature,
+        DataPointIndexStringEvent1,
+        DataPointIndexStringEvent2,
+        DataPointIndexVendorEventBitfield1,
+        DataPointIndexVendorEventBitfield2,
+        DataPointIndexModV_SF,
+        DataPointIndexCellV_SF,
+        DataPointIndexTmp_SF,
+        DataPointIndexSoC_SF,
+        DataPointIndexOCV_SF,
+        DataPointIndexPad1
+    };
+
     explicit SunSpecFlowBatteryStringModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecFlowBatteryStringModel() override; 
 
@@ -403,10 +461,15 @@ private:
     quint32 m_vendorEventBitfield1 = 0;
     quint32 m_vendorEventBitfield2 = 0;
     qint16 m_modV_SF = 0;
+    double m_modV_SFMultiplier = 1;
     qint16 m_cellV_SF = 0;
+    double m_cellV_SFMultiplier = 1;
     qint16 m_tmp_SF = 0;
+    double m_tmp_SFMultiplier = 1;
     qint16 m_soC_SF = 0;
+    double m_soC_SFMultiplier = 1;
     qint16 m_oCV_SF = 0;
+    double m_oCV_SFMultiplier = 1;
     quint16 m_pad1 = 0;
 
 
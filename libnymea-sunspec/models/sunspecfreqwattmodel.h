@@ -50,6 +50,60 @@ public:
     };
     Q_ENUM(Readonly)
 
+    enum DataPointIndex {
+        DataPointIndexActPt = 0,
+        DataPointIndexHz1,
+        DataPointIndexW1,
+        DataPointIndexHz2,
+        DataPointIndexW2,
+        DataPointIndexHz3,
+        DataPointIndexW3,
+        DataPointIndexHz4,
+        DataPointIndexW4,
+        DataPointIndexHz5,
+        DataPointIndexW5,
+        DataPointIndexHz6,
+        DataPointIndexW6,
+        DataPointIndexHz7,
+        DataPointIndexW7,
+        DataPointIndexHz8,
+        DataPointIndexW8,
+        DataPointIndexHz9,
+        DataPointIndexW9,
+        DataPointIndexHz10,
+        DataPointIndexW10,
+        DataPointIndexHz11,
+        DataPointIndexW11,
+        DataPointIndexHz12,
+        DataPointIndexW12,
+        DataPointIndexHz13,
+        DataPointIndexW13,
+        DataPointIndexHz14,
+        DataPointIndexW14,
+        DataPointIndexHz15,
+        DataPointIndexW15,
+        DataPointIndexHz16,
+        DataPointIndexW16,
+        DataPointIndexHz17,
+        DataPointIndexW17,
+        DataPointIndexHz18,
+        DataPointIndexW18,
+        DataPointIndexHz19,
+        DataPointIndexW19,
+        DataPointIndexHz20,
+        DataPointIndexW20,
+        DataPointIndexCrvNam,
+        DataPointIndexRmpPt1Tms,
+        DataPointIndexRmpDecTmm,
+        DataPointIndexRmpIncTmm,
+        DataPointIndexRmpRsUp,
+        DataPointIndexSnptW,
+        DataPointIndexWRef,
+        DataPointIndexWRefStrHz,
+        DataPointIndexWRefStopHz,
+        DataPointIndexReadOnly
+    };
+
     explicit SunSpecFreqWattModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecFreqWattModel *parent = nullptr);
     ~SunSpecFreqWattModelRepeatingBlock() override = default;
 
@@ -335,6 +389,21 @@ public:
     Q_DECLARE_FLAGS(ModenaFlags, Modena)
     Q_FLAG(Modena)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexActCrv,
+        DataPointIndexModEna,
+        DataPointIndexWinTms,
+        DataPointIndexRvrtTms,
+        DataPointIndexRmpTms,
+        DataPointIndexNCrv,
+        DataPointIndexNPt,
+        DataPointIndexHzSf,
+        DataPointIndexWSf,
+        DataPointIndexRmpIncDecSf
+    };
+
     explicit SunSpecFreqWattModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecFreqWattModel() override; 
 
@@ -390,8 +459,11 @@ private:
     quint16 m_nCrv = 0;
     quint16 m_nPt = 0;
     qint16 m_hzSf = 0;
+    double m_hzSfMultiplier = 1;
     qint16 m_wSf = 0;
+    double m_wSfMultiplier = 1;
     qint16 m_rmpIncDecSf = 0;
+    double m_rmpIncDecSfMultiplier = 1;
 
 
 };
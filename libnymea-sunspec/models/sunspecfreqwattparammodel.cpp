@@ -31,6 +31,33 @@
 #include "sunspecfreqwattparammodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexWGra
+    { "WGra", "WGra", "The slope of the reduction in the maximum allowed watts output as a function of frequency.", nullptr, "% PM/Hz", "uint16", "WGra_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 2, 0, 1 },
+    // DataPointIndexHzStr
+    { "HzStr", "HzStr", "The frequency deviation from nominal frequency (ECPNomHz) at which a snapshot of the instantaneous power output is taken to act as the CAPPED power level (PM) and above which reduction in power output occurs.", nullptr, "Hz", "int16", "HzStrStop_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, true, 3, 1, 1 },
+    // DataPointIndexHzStop
+    { "HzStop", "HzStop", "The frequency deviation from nominal frequency (ECPNomHz) at which curtailed power output may return to normal and the cap on the power level value is removed.", nullptr, "Hz", "int16", "HzStrStop_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, true, 4, 2, 1 },
+    // DataPointIndexHysEna
+    { "HysEna", "HysEna", "Enable hysteresis", nullptr, nullptr, "bitfield16", nullptr, SunSpecDataPoint::BitField16, SunSpecDataPoint::AccessReadWrite, true, 5, 3, 1 },
+    // DataPointIndexModEna
+    { "ModEna", "ModEna", "Is Parameterized Frequency-Watt control active.", nullptr, nullptr, "bitfield16", nullptr, SunSpecDataPoint::BitField16, SunSpecDataPoint::AccessReadWrite, true, 6, 4, 1 },
+    // DataPointIndexHzStopWGra
+    { "HzStopWGra", "HzStopWGra", "The maximum time-based rate of change at which power output returns to normal after having been capped by an over frequency event.", nullptr, "% WMax/min", "uint16", "RmpIncDec_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 7, 5, 1 },
+    // DataPointIndexWGraSf
+    { "WGra_SF", "WGra_SF", "Scale factor for output gradient.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 8, 6, 1 },
+    // DataPointIndexHzStrStopSf
+    { "HzStrStop_SF", "HzStrStop_SF", "Scale factor for frequency deviations.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 9, 7, 1 },
+    // DataPointIndexRmpIncDecSf
+    { "RmpIncDec_SF", "RmpIncDec_SF", "Scale factor for increment and decrement ramps.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 10, 8, 1 },
+    // DataPointIndexPad
+    { "Pad", nullptr, nullptr, nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, false, 11, 9, 1 }
+};
+
 SunSpecFreqWattParamModel::SunSpecFreqWattParamModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 127, modelLength, byteOrder, parent)
 {
@@ -69,7 +96,7 @@ QModbusReply *SunSpecFreqWattParamModel::setWGra(float wGra)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("WGra");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexWGra]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(wGra, m_wGraSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -87,7 +114,7 @@ QModbusReply *SunSpecFreqWattParamModel::setHzStr(float hzStr)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("HzStr");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHzStr]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hzStr, m_hzStrStopSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -105,7 +132,7 @@ QModbusReply *SunSpecFreqWattParamModel::setHzStop(float hzStop)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("HzStop");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHzStop]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hzStop, m_hzStrStopSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -123,7 +150,7 @@ QModbusReply *SunSpecFreqWattParamModel::setHysEna(HysenaFlags hysEna)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("HysEna");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHysEna]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(hysEna));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -141,7 +168,7 @@ QModbusReply *SunSpecFreqWattParamModel::setModEna(ModenaFlags modEna)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ModEna");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexModEna]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(modEna));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -159,7 +186,7 @@ QModbusReply *SunSpecFreqWattParamModel::setHzStopWGra(float hzStopWGra)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("HzStopWGra");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHzStopWGra]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hzStopWGra, m_rmpIncDecSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -185,200 +212,62 @@ quint16 SunSpecFreqWattParamModel::pad() const
 }
 void SunSpecFreqWattParamModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint wGraDataPoint;
-    wGraDataPoint.setName("WGra");
-    wGraDataPoint.setLabel("WGra");
-    wGraDataPoint.setDescription("The slope of the reduction in the maximum allowed watts output as a function of frequency.");
-    wGraDataPoint.setUnits("% PM/Hz");
-    wGraDataPoint.setMandatory(true);
-    wGraDataPoint.setSize(1);
-    wGraDataPoint.setAddressOffset(2);
-    wGraDataPoint.setBlockOffset(0);
-    wGraDataPoint.setScaleFactorName("WGra_SF");
-    wGraDataPoint.setSunSpecDataType("uint16");
-    wGraDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    wGraDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wGraDataPoint.name(), wGraDataPoint);
-
-    SunSpecDataPoint hzStrDataPoint;
-    hzStrDataPoint.setName("HzStr");
-    hzStrDataPoint.setLabel("HzStr");
-    hzStrDataPoint.setDescription("The frequency deviation from nominal frequency (ECPNomHz) at which a snapshot of the instantaneous power output is taken to act as the CAPPED power level (PM) and above which reduction in power output occurs.");
-    hzStrDataPoint.setUnits("Hz");
-    hzStrDataPoint.setMandatory(true);
-    hzStrDataPoint.setSize(1);
-    hzStrDataPoint.setAddressOffset(3);
-    hzStrDataPoint.setBlockOffset(1);
-    hzStrDataPoint.setScaleFactorName("HzStrStop_SF");
-    hzStrDataPoint.setSunSpecDataType("int16");
-    hzStrDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hzStrDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hzStrDataPoint.name(), hzStrDataPoint);
-
-    SunSpecDataPoint hzStopDataPoint;
-    hzStopDataPoint.setName("HzStop");
-    hzStopDataPoint.setLabel("HzStop");
-    hzStopDataPoint.setDescription("The frequency deviation from nominal frequency (ECPNomHz) at which curtailed power output may return to normal and the cap on the power level value is removed.");
-    hzStopDataPoint.setUnits("Hz");
-    hzStopDataPoint.setMandatory(true);
-    hzStopDataPoint.setSize(1);
-    hzStopDataPoint.setAddressOffset(4);
-    hzStopDataPoint.setBlockOffset(2);
-    hzStopDataPoint.setScaleFactorName("HzStrStop_SF");
-    hzStopDataPoint.setSunSpecDataType("int16");
-    hzStopDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hzStopDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hzStopDataPoint.name(), hzStopDataPoint);
-
-    SunSpecDataPoint hysEnaDataPoint;
-    hysEnaDataPoint.setName("HysEna");
-    hysEnaDataPoint.setLabel("HysEna");
-    hysEnaDataPoint.setDescription("Enable hysteresis");
-    hysEnaDataPoint.setMandatory(true);
-    hysEnaDataPoint.setSize(1);
-    hysEnaDataPoint.setAddressOffset(5);
-    hysEnaDataPoint.setBlockOffset(3);
-    hysEnaDataPoint.setSunSpecDataType("bitfield16");
-    hysEnaDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hysEnaDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hysEnaDataPoint.name(), hysEnaDataPoint);
-
-    SunSpecDataPoint modEnaDataPoint;
-    modEnaDataPoint.setName("ModEna");
-    modEnaDataPoint.setLabel("ModEna");
-    modEnaDataPoint.setDescription("Is Parameterized Frequency-Watt control active.");
-    modEnaDataPoint.setMandatory(true);
-    modEnaDataPoint.setSize(1);
-    modEnaDataPoint.setAddressOffset(6);
-    modEnaDataPoint.setBlockOffset(4);
-    modEnaDataPoint.setSunSpecDataType("bitfield16");
-    modEnaDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    modEnaDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modEnaDataPoint.name(), modEnaDataPoint);
-
-    SunSpecDataPoint hzStopWGraDataPoint;
-    hzStopWGraDataPoint.setName("HzStopWGra");
-    hzStopWGraDataPoint.setLabel("HzStopWGra");
-    hzStopWGraDataPoint.setDescription("The maximum time-based rate of change at which power output returns to normal after having been capped by an over frequency event.");
-    hzStopWGraDataPoint.setUnits("% WMax/min");
-    hzStopWGraDataPoint.setSize(1);
-    hzStopWGraDataPoint.setAddressOffset(7);
-    hzStopWGraDataPoint.setBlockOffset(5);
-    hzStopWGraDataPoint.setScaleFactorName("RmpIncDec_SF");
-    hzStopWGraDataPoint.setSunSpecDataType("uint16");
-    hzStopWGraDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hzStopWGraDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hzStopWGraDataPoint.name(), hzStopWGraDataPoint);
-
-    SunSpecDataPoint wGraSfDataPoint;
-    wGraSfDataPoint.setName("WGra_SF");
-    wGraSfDataPoint.setLabel("WGra_SF");
-    wGraSfDataPoint.setDescription("Scale factor for output gradient.");
-    wGraSfDataPoint.setSize(1);
-    wGraSfDataPoint.setAddressOffset(8);
-    wGraSfDataPoint.setBlockOffset(6);
-    wGraSfDataPoint.setSunSpecDataType("sunssf");
-    wGraSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wGraSfDataPoint.name(), wGraSfDataPoint);
-
-    SunSpecDataPoint hzStrStopSfDataPoint;
-    hzStrStopSfDataPoint.setName("HzStrStop_SF");
-    hzStrStopSfDataPoint.setLabel("HzStrStop_SF");
-    hzStrStopSfDataPoint.setDescription("Scale factor for frequency deviations.");
-    hzStrStopSfDataPoint.setSize(1);
-    hzStrStopSfDataPoint.setAddressOffset(9);
-    hzStrStopSfDataPoint.setBlockOffset(7);
-    hzStrStopSfDataPoint.setSunSpecDataType("sunssf");
-    hzStrStopSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hzStrStopSfDataPoint.name(), hzStrStopSfDataPoint);
-
-    SunSpecDataPoint rmpIncDecSfDataPoint;
-    rmpIncDecSfDataPoint.setName("RmpIncDec_SF");
-    rmpIncDecSfDataPoint.setLabel("RmpIncDec_SF");
-    rmpIncDecSfDataPoint.setDescription("Scale factor for increment and decrement ramps.");
-    rmpIncDecSfDataPoint.setSize(1);
-    rmpIncDecSfDataPoint.setAddressOffset(10);
-    rmpIncDecSfDataPoint.setBlockOffset(8);
-    rmpIncDecSfDataPoint.setSunSpecDataType("sunssf");
-    rmpIncDecSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rmpIncDecSfDataPoint.name(), rmpIncDecSfDataPoint);
-
-    SunSpecDataPoint padDataPoint;
-    padDataPoint.setName("Pad");
-    padDataPoint.setSize(1);
-    padDataPoint.setAddressOffset(11);
-    padDataPoint.setBlockOffset(9);
-    padDataPoint.setSunSpecDataType("pad");
-    padDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(padDataPoint.name(), padDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 12;
 }
 
 void SunSpecFreqWattParamModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("WGra_SF").isValid())
-        m_wGraSf = m_dataPoints.value("WGra_SF").toInt16();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 8, 1);
+        if (scaleFactor != m_wGraSf) {
+            m_wGraSf = scaleFactor;
+            m_wGraSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("HzStrStop_SF").isValid())
-        m_hzStrStopSf = m_dataPoints.value("HzStrStop_SF").toInt16();
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 9, 1);
+        if (scaleFactor != m_hzStrStopSf) {
+            m_hzStrStopSf = scaleFactor;
+            m_hzStrStopSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("RmpIncDec_SF").isValid())
-        m_rmpIncDecSf = m_dataPoints.value("RmpIncDec_SF").toInt16();
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 10, 1);
+        if (scaleFactor != m_rmpIncDecSf) {
+            m_rmpIncDecSf = scaleFactor;
+            m_rmpIncDecSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("WGra").isValid())
-        m_wGra = m_dataPoints.value("WGra").toFloatWithSSF(m_wGraSf);
-
-    if (m_dataPoints.value("HzStr").isValid())
-        m_hzStr = m_dataPoints.value("HzStr").toFloatWithSSF(m_hzStrStopSf);
-
-    if (m_dataPoints.value("HzStop").isValid())
-        m_hzStop = m_dataPoints.value("HzStop").toFloatWithSSF(m_hzStrStopSf);
-
-    if (m_dataPoints.value("HysEna").isValid())
-        m_hysEna = static_cast<HysenaFlags>(m_dataPoints.value("HysEna").toUInt16());
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_wGra = SunSpecDataPoint::convertToUInt16(registers + 2, 1) * m_wGraSfMultiplier;
 
-    if (m_dataPoints.value("ModEna").isValid())
-        m_modEna = static_cast<ModenaFlags>(m_dataPoints.value("ModEna").toUInt16());
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_hzStr = SunSpecDataPoint::convertToInt16(registers + 3, 1) * m_hzStrStopSfMultiplier;
 
-    if (m_dataPoints.value("HzStopWGra").isValid())
-        m_hzStopWGra = m_dataPoints.value("HzStopWGra").toFloatWithSSF(m_rmpIncDecSf);
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_hzStop = SunSpecDataPoint::convertToInt16(registers + 4, 1) * m_hzStrStopSfMultiplier;
 
-    if (m_dataPoints.value("WGra_SF").isValid())
-        m_wGraSf = m_dataPoints.value("WGra_SF").toInt16();
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::BitField16, m_byteOrder))
+        m_hysEna = static_cast<HysenaFlags>(SunSpecDataPoint::convertToUInt16(registers + 5, 1));
 
-    if (m_dataPoints.value("HzStrStop_SF").isValid())
-        m_hzStrStopSf = m_dataPoints.value("HzStrStop_SF").toInt16();
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::BitField16, m_byteOrder))
+        m_modEna = static_cast<ModenaFlags>(SunSpecDataPoint::convertToUInt16(registers + 6, 1));
 
-    if (m_dataPoints.value("RmpIncDec_SF").isValid())
-        m_rmpIncDecSf = m_dataPoints.value("RmpIncDec_SF").toInt16();
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hzStopWGra = SunSpecDataPoint::convertToUInt16(registers + 7, 1) * m_rmpIncDecSfMultiplier;
 
-    if (m_dataPoints.value("Pad").isValid())
-        m_pad = m_dataPoints.value("Pad").toUInt16();
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad = SunSpecDataPoint::convertToUInt16(registers + 11, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -387,50 +276,50 @@ void SunSpecFreqWattParamModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecFreqWattParamModel *model)
 {
     debug.nospace().noquote() << "SunSpecFreqWattParamModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WGra") << "-->";
-    if (model->dataPoints().value("WGra").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFreqWattParamModel::DataPointIndexWGra) << "-->";
+    if (model->dataPoint(SunSpecFreqWattParamModel::DataPointIndexWGra).isValid()) {
         debug.nospace().noquote() << model->wGra() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("HzStr") << "-->";
-    if (model->dataPoints().value("HzStr").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFreqWattParamModel::DataPointIndexHzStr) << "-->";
+    if (model->dataPoint(SunSpecFreqWattParamModel::DataPointIndexHzStr).isValid()) {
         debug.nospace().noquote() << model->hzStr() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("HzStop") << "-->";
-    if (model->dataPoints().value("HzStop").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFreqWattParamModel::DataPointIndexHzStop) << "-->";
+    if (model->dataPoint(SunSpecFreqWattParamModel::DataPointIndexHzStop).isValid()) {
         debug.nospace().noquote() << model->hzStop() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("HysEna") << "-->";
-    if (model->dataPoints().value("HysEna").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFreqWattParamModel::DataPointIndexHysEna) << "-->";
+    if (model->dataPoint(SunSpecFreqWattParamModel::DataPointIndexHysEna).isValid()) {
         debug.nospace().noquote() << model->hysEna() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModEna") << "-->";
-    if (model->dataPoints().value("ModEna").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFreqWattParamModel::DataPointIndexModEna) << "-->";
+    if (model->dataPoint(SunSpecFreqWattParamModel::DataPointIndexModEna).isValid()) {
         debug.nospace().noquote() << model->modEna() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("HzStopWGra") << "-->";
-    if (model->dataPoints().value("HzStopWGra").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFreqWattParamModel::DataPointIndexHzStopWGra) << "-->";
+    if (model->dataPoint(SunSpecFreqWattParamModel::DataPointIndexHzStopWGra).isValid()) {
         debug.nospace().noquote() << model->hzStopWGra() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Pad") << "-->";
-    if (model->dataPoints().value("Pad").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecFreqWattParamModel::DataPointIndexPad) << "-->";
+    if (model->dataPoint(SunSpecFreqWattParamModel::DataPointIndexPad).isValid()) {
         debug.nospace().noquote() << model->pad() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
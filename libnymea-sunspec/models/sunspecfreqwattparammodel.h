@@ -54,6 +54,21 @@ public:
     Q_DECLARE_FLAGS(ModenaFlags, Modena)
     Q_FLAG(Modena)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexWGra,
+        DataPointIndexHzStr,
+        DataPointIndexHzStop,
+        DataPointIndexHysEna,
+        DataPointIndexModEna,
+        DataPointIndexHzStopWGra,
+        DataPointIndexWGraSf,
+        DataPointIndexHzStrStopSf,
+        DataPointIndexRmpIncDecSf,
+        DataPointIndexPad
+    };
+
     explicit SunSpecFreqWattParamModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecFreqWattParamModel() override; 
 
@@ -108,8 +123,11 @@ private:
     ModenaFlags m_modEna;
     float m_hzStopWGra = 0;
     qint16 m_wGraSf = 0;
+    double m_wGraSfMultiplier = 1;
     qint16 m_hzStrStopSf = 0;
+    double m_hzStrStopSfMultiplier = 1;
     qint16 m_rmpIncDecSf = 0;
+    double m_rmpIncDecSfMultiplier = 1;
     quint16 m_pad = 0;
 
 
@@ -50,6 +50,52 @@ public:
     };
     Q_ENUM(Readonly)
 
+    enum DataPointIndex {
+        DataPointIndexActPt = 0,
+        DataPointIndexTms1,
+        DataPointIndexHz1,
+        DataPointIndexTms2,
+        DataPointIndexHz2,
+        DataPointIndexTms3,
+        DataPointIndexHz3,
+        DataPointIndexTms4,
+        DataPointIndexHz4,
+        DataPointIndexTms5,
+        DataPointIndexHz5,
+        DataPointIndexTms6,
+        DataPointIndexHz6,
+        DataPointIndexTms7,
+        DataPointIndexHz7,
+        DataPointIndexTms8,
+        DataPointIndexHz8,
+        DataPointIndexTms9,
+        DataPointIndexHz9,
+        DataPointIndexTms10,
+        DataPointIndexHz10,
+        DataPointIndexTms11,
+        DataPointIndexHz11,
+        DataPointIndexTms12,
+        DataPointIndexHz12,
+        DataPointIndexTms13,
+        DataPointIndexHz13,
+        DataPointIndexTms14,
+        DataPointIndexHz14,
+        DataPointIndexTms15,
+        DataPointIndexHz15,
+        DataPointIndexTms16,
+        DataPointIndexHz16,
+        DataPointIndexTms17,
+        DataPointIndexHz17,
+        DataPointIndexTms18,
+        DataPointIndexHz18,
+        DataPointIndexTms19,
+        DataPointIndexHz19,
+        DataPointIndexTms20,
+        DataPointIndexHz20,
+        DataPointIndexCrvNam,
+        DataPointIndexReadOnly
+    };
+
     explicit SunSpecHfrtcModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecHfrtcModel *parent = nullptr);
     ~SunSpecHfrtcModelRepeatingBlock() override = default;
 
@@ -295,6 +341,21 @@ public:
     Q_DECLARE_FLAGS(ModenaFlags, Modena)
     Q_FLAG(Modena)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexActCrv,
+        DataPointIndexModEna,
+        DataPointIndexWinTms,
+        DataPointIndexRvrtTms,
+        DataPointIndexRmpTms,
+        DataPointIndexNCrv,
+        DataPointIndexNPt,
+        DataPointIndexTmsSf,
+        DataPointIndexHzSf,
+        DataPointIndexPad
+    };
+
     explicit SunSpecHfrtcModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecHfrtcModel() override; 
 
@@ -349,7 +410,9 @@ private:
     quint16 m_nCrv = 0;
     quint16 m_nPt = 0;
     qint16 m_tmsSf = 0;
+    double m_tmsSfMultiplier = 1;
     qint16 m_hzSf = 0;
+    double m_hzSfMultiplier = 1;
     quint16 m_pad = 0;
 
 
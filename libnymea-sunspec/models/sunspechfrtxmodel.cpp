@@ -31,6 +31,95 @@
 #include "sunspechfrtxmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata repeatingBlockDataPointMetadata[] = {
+    // DataPointIndexActPt
+    { "ActPt", "ActPt", "Number of active points in array.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 0, 0, 1 },
+    // DataPointIndexTms1
+    { "Tms1", "Tms1", "Point 1 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 1, 0, 1 },
+    // DataPointIndexHz1
+    { "Hz1", "Hz1", "Point 1 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 2, 0, 1 },
+    // DataPointIndexTms2
+    { "Tms2", "Tms2", "Point 2 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 3, 1, 1 },
+    // DataPointIndexHz2
+    { "Hz2", "Hz2", "Point 2 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 4, 2, 1 },
+    // DataPointIndexTms3
+    { "Tms3", "Tms3", "Point 3 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 5, 3, 1 },
+    // DataPointIndexHz3
+    { "Hz3", "Hz3", "Point 3 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 6, 4, 1 },
+    // DataPointIndexTms4
+    { "Tms4", "Tms4", "Point 4 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 7, 5, 1 },
+    // DataPointIndexHz4
+    { "Hz4", "Hz4", "Point 4 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 8, 6, 1 },
+    // DataPointIndexTms5
+    { "Tms5", "Tms5", "Point 5 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 9, 7, 1 },
+    // DataPointIndexHz5
+    { "Hz5", "Hz5", "Point 5 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 10, 8, 1 },
+    // DataPointIndexTms6
+    { "Tms6", "Tms6", "Point 6 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 11, 9, 1 },
+    // DataPointIndexHz6
+    { "Hz6", "Hz6", "Point 6 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 12, 10, 1 },
+    // DataPointIndexTms7
+    { "Tms7", "Tms7", "Point 7 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 13, 11, 1 },
+    // DataPointIndexHz7
+    { "Hz7", "Hz7", "Point 7 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 14, 12, 1 },
+    // DataPointIndexTms8
+    { "Tms8", "Tms8", "Point 8 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 15, 13, 1 },
+    // DataPointIndexHz8
+    { "Hz8", "Hz8", "Point 8 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 16, 14, 1 },
+    // DataPointIndexTms9
+    { "Tms9", "Tms9", "Point 9 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 17, 15, 1 },
+    // DataPointIndexHz9
+    { "Hz9", "Hz9", "Point 9 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 18, 16, 1 },
+    // DataPointIndexTms10
+    { "Tms10", "Tms10", "Point 10 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 19, 17, 1 },
+    // DataPointIndexHz10
+    { "Hz10", "Hz10", "Point 10 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 20, 18, 1 },
+    // DataPointIndexTms11
+    { "Tms11", "Tms11", "Point 11 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 21, 19, 1 },
+    // DataPointIndexHz11
+    { "Hz11", "Hz11", "Point 11 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 22, 20, 1 },
+    // DataPointIndexTms12
+    { "Tms12", "Tms12", "Point 12 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 23, 21, 1 },
+    // DataPointIndexHz12
+    { "Hz12", "Hz12", "Point 12 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 24, 22, 1 },
+    // DataPointIndexTms13
+    { "Tms13", "Tms13", "Point 13 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 25, 23, 1 },
+    // DataPointIndexHz13
+    { "Hz13", "Hz13", "Point 13 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 26, 24, 1 },
+    // DataPointIndexTms14
+    { "Tms14", "Tms14", "Point 14 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 27, 25, 1 },
+    // DataPointIndexHz14
+    { "Hz14", "Hz14", "Point 14 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 28, 26, 1 },
+    // DataPointIndexTms15
+    { "Tms15", "Tms15", "Point 15 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 29, 27, 1 },
+    // DataPointIndexHz15
+    { "Hz15", "Hz15", "Point 15 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 30, 28, 1 },
+    // DataPointIndexTms16
+    { "Tms16", "Tms16", "Point 16 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 31, 29, 1 },
+    // DataPointIndexHz16
+    { "Hz16", "Hz16", "Point 16 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 32, 30, 1 },
+    // DataPointIndexTms17
+    { "Tms17", "Tms17", "Point 17 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 33, 31, 1 },
+    // DataPointIndexHz17
+    { "Hz17", "Hz17", "Point 17 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 34, 32, 1 },
+    // DataPointIndexTms18
+    { "Tms18", "Tms18", "Point 18 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 35, 33, 1 },
+    // DataPointIndexHz18
+    { "Hz18", "Hz18", "Point 18 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 36, 34, 1 },
+    // DataPointIndexTms19
+    { "Tms19", "Tms19", "Point 19 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 37, 35, 1 },
+    // DataPointIndexHz19
+    { "Hz19", "Hz19", "Point 19 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 38, 36, 1 },
+    // DataPointIndexTms20
+    { "Tms20", "Tms20", "Point 20 duration.", nullptr, "Secs", "uint16", "Tms_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 39, 37, 1 },
+    // DataPointIndexHz20
+    { "Hz20", "Hz20", "Point 20 frequency.", nullptr, "Hz", "uint16", "Hz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 40, 38, 1 },
+    // DataPointIndexCrvNam
+    { "CrvNam", "CrvNam", "Optional description for curve.", nullptr, nullptr, "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadWrite, false, 41, 39, 8 },
+    // DataPointIndexReadOnly
+    { "ReadOnly", "ReadOnly", "Enumerated value indicates if curve is read-only or can be modified.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, true, 49, 47, 1 }
+};
+
 SunSpecHfrtxModelRepeatingBlock::SunSpecHfrtxModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecHfrtxModel *parent) :
     SunSpecModelRepeatingBlock(blockIndex, blockSize, modbusStartRegister, parent)
 {
@@ -55,7 +144,7 @@ quint16 SunSpecHfrtxModelRepeatingBlock::actPt() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setActPt(quint16 actPt)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("ActPt");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexActPt]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(actPt);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -71,7 +160,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms1() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms1(float tms1)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms1");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms1]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms1, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -87,7 +176,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz1() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz1(float hz1)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz1");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz1]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz1, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -103,7 +192,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms2() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms2(float tms2)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms2");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms2]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms2, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -119,7 +208,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz2() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz2(float hz2)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz2");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz2]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz2, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -135,7 +224,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms3() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms3(float tms3)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms3");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms3]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms3, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -151,7 +240,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz3() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz3(float hz3)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz3");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz3]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz3, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -167,7 +256,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms4() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms4(float tms4)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms4");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms4]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms4, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -183,7 +272,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz4() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz4(float hz4)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz4");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz4]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz4, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -199,7 +288,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms5() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms5(float tms5)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms5");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms5]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms5, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -215,7 +304,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz5() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz5(float hz5)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz5");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz5]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz5, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -231,7 +320,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms6() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms6(float tms6)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms6");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms6]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms6, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -247,7 +336,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz6() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz6(float hz6)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz6");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz6]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz6, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -263,7 +352,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms7() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms7(float tms7)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms7");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms7]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms7, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -279,7 +368,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz7() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz7(float hz7)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz7");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz7]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz7, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -295,7 +384,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms8() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms8(float tms8)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms8");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms8]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms8, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -311,7 +400,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz8() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz8(float hz8)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz8");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz8]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz8, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -327,7 +416,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms9() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms9(float tms9)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms9");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms9]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms9, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -343,7 +432,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz9() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz9(float hz9)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz9");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz9]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz9, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -359,7 +448,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms10() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms10(float tms10)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms10");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms10]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms10, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -375,7 +464,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz10() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz10(float hz10)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz10");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz10]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz10, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -391,7 +480,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms11() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms11(float tms11)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms11");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms11]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms11, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -407,7 +496,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz11() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz11(float hz11)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz11");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz11]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz11, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -423,7 +512,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms12() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms12(float tms12)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms12");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms12]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms12, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -439,7 +528,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz12() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz12(float hz12)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz12");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz12]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz12, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -455,7 +544,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms13() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms13(float tms13)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms13");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms13]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms13, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -471,7 +560,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz13() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz13(float hz13)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz13");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz13]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz13, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -487,7 +576,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms14() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms14(float tms14)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms14");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms14]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms14, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -503,7 +592,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz14() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz14(float hz14)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz14");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz14]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz14, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -519,7 +608,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms15() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms15(float tms15)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms15");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms15]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms15, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -535,7 +624,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz15() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz15(float hz15)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz15");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz15]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz15, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -551,7 +640,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms16() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms16(float tms16)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms16");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms16]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms16, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -567,7 +656,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz16() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz16(float hz16)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz16");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz16]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz16, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -583,7 +672,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms17() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms17(float tms17)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms17");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms17]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms17, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -599,7 +688,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz17() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz17(float hz17)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz17");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz17]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz17, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -615,7 +704,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms18() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms18(float tms18)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms18");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms18]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms18, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -631,7 +720,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz18() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz18(float hz18)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz18");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz18]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz18, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -647,7 +736,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms19() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms19(float tms19)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms19");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms19]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms19, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -663,7 +752,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz19() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz19(float hz19)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz19");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz19]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz19, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -679,7 +768,7 @@ float SunSpecHfrtxModelRepeatingBlock::tms20() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setTms20(float tms20)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Tms20");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexTms20]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(tms20, m_parentModel->tmsSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -695,7 +784,7 @@ float SunSpecHfrtxModelRepeatingBlock::hz20() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setHz20(float hz20)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Hz20");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHz20]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hz20, m_parentModel->hzSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -711,7 +800,7 @@ QString SunSpecHfrtxModelRepeatingBlock::crvNam() const
 
 QModbusReply *SunSpecHfrtxModelRepeatingBlock::setCrvNam(const QString &crvNam)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("CrvNam");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexCrvNam]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromString(crvNam, dp.size());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -727,744 +816,179 @@ SunSpecHfrtxModelRepeatingBlock::Readonly SunSpecHfrtxModelRepeatingBlock::readO
 
 void SunSpecHfrtxModelRepeatingBlock::initDataPoints()
 {
-    SunSpecDataPoint actPtDataPoint;
-    actPtDataPoint.setName("ActPt");
-    actPtDataPoint.setLabel("ActPt");
-    actPtDataPoint.setDescription("Number of active points in array.");
-    actPtDataPoint.setMandatory(true);
-    actPtDataPoint.setSize(1);
-    actPtDataPoint.setAddressOffset(0);
-    actPtDataPoint.setSunSpecDataType("uint16");
-    actPtDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    actPtDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(actPtDataPoint.name(), actPtDataPoint);
-
-    SunSpecDataPoint tms1DataPoint;
-    tms1DataPoint.setName("Tms1");
-    tms1DataPoint.setLabel("Tms1");
-    tms1DataPoint.setDescription("Point 1 duration.");
-    tms1DataPoint.setUnits("Secs");
-    tms1DataPoint.setMandatory(true);
-    tms1DataPoint.setSize(1);
-    tms1DataPoint.setAddressOffset(1);
-    tms1DataPoint.setScaleFactorName("Tms_SF");
-    tms1DataPoint.setSunSpecDataType("uint16");
-    tms1DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms1DataPoint.name(), tms1DataPoint);
-
-    SunSpecDataPoint hz1DataPoint;
-    hz1DataPoint.setName("Hz1");
-    hz1DataPoint.setLabel("Hz1");
-    hz1DataPoint.setDescription("Point 1 frequency.");
-    hz1DataPoint.setUnits("Hz");
-    hz1DataPoint.setMandatory(true);
-    hz1DataPoint.setSize(1);
-    hz1DataPoint.setAddressOffset(2);
-    hz1DataPoint.setBlockOffset(0);
-    hz1DataPoint.setScaleFactorName("Hz_SF");
-    hz1DataPoint.setSunSpecDataType("uint16");
-    hz1DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz1DataPoint.name(), hz1DataPoint);
-
-    SunSpecDataPoint tms2DataPoint;
-    tms2DataPoint.setName("Tms2");
-    tms2DataPoint.setLabel("Tms2");
-    tms2DataPoint.setDescription("Point 2 duration.");
-    tms2DataPoint.setUnits("Secs");
-    tms2DataPoint.setSize(1);
-    tms2DataPoint.setAddressOffset(3);
-    tms2DataPoint.setBlockOffset(1);
-    tms2DataPoint.setScaleFactorName("Tms_SF");
-    tms2DataPoint.setSunSpecDataType("uint16");
-    tms2DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms2DataPoint.name(), tms2DataPoint);
-
-    SunSpecDataPoint hz2DataPoint;
-    hz2DataPoint.setName("Hz2");
-    hz2DataPoint.setLabel("Hz2");
-    hz2DataPoint.setDescription("Point 2 frequency.");
-    hz2DataPoint.setUnits("Hz");
-    hz2DataPoint.setSize(1);
-    hz2DataPoint.setAddressOffset(4);
-    hz2DataPoint.setBlockOffset(2);
-    hz2DataPoint.setScaleFactorName("Hz_SF");
-    hz2DataPoint.setSunSpecDataType("uint16");
-    hz2DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz2DataPoint.name(), hz2DataPoint);
-
-    SunSpecDataPoint tms3DataPoint;
-    tms3DataPoint.setName("Tms3");
-    tms3DataPoint.setLabel("Tms3");
-    tms3DataPoint.setDescription("Point 3 duration.");
-    tms3DataPoint.setUnits("Secs");
-    tms3DataPoint.setSize(1);
-    tms3DataPoint.setAddressOffset(5);
-    tms3DataPoint.setBlockOffset(3);
-    tms3DataPoint.setScaleFactorName("Tms_SF");
-    tms3DataPoint.setSunSpecDataType("uint16");
-    tms3DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms3DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms3DataPoint.name(), tms3DataPoint);
-
-    SunSpecDataPoint hz3DataPoint;
-    hz3DataPoint.setName("Hz3");
-    hz3DataPoint.setLabel("Hz3");
-    hz3DataPoint.setDescription("Point 3 frequency.");
-    hz3DataPoint.setUnits("Hz");
-    hz3DataPoint.setSize(1);
-    hz3DataPoint.setAddressOffset(6);
-    hz3DataPoint.setBlockOffset(4);
-    hz3DataPoint.setScaleFactorName("Hz_SF");
-    hz3DataPoint.setSunSpecDataType("uint16");
-    hz3DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz3DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz3DataPoint.name(), hz3DataPoint);
-
-    SunSpecDataPoint tms4DataPoint;
-    tms4DataPoint.setName("Tms4");
-    tms4DataPoint.setLabel("Tms4");
-    tms4DataPoint.setDescription("Point 4 duration.");
-    tms4DataPoint.setUnits("Secs");
-    tms4DataPoint.setSize(1);
-    tms4DataPoint.setAddressOffset(7);
-    tms4DataPoint.setBlockOffset(5);
-    tms4DataPoint.setScaleFactorName("Tms_SF");
-    tms4DataPoint.setSunSpecDataType("uint16");
-    tms4DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms4DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms4DataPoint.name(), tms4DataPoint);
-
-    SunSpecDataPoint hz4DataPoint;
-    hz4DataPoint.setName("Hz4");
-    hz4DataPoint.setLabel("Hz4");
-    hz4DataPoint.setDescription("Point 4 frequency.");
-    hz4DataPoint.setUnits("Hz");
-    hz4DataPoint.setSize(1);
-    hz4DataPoint.setAddressOffset(8);
-    hz4DataPoint.setBlockOffset(6);
-    hz4DataPoint.setScaleFactorName("Hz_SF");
-    hz4DataPoint.setSunSpecDataType("uint16");
-    hz4DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz4DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz4DataPoint.name(), hz4DataPoint);
-
-    SunSpecDataPoint tms5DataPoint;
-    tms5DataPoint.setName("Tms5");
-    tms5DataPoint.setLabel("Tms5");
-    tms5DataPoint.setDescription("Point 5 duration.");
-    tms5DataPoint.setUnits("Secs");
-    tms5DataPoint.setSize(1);
-    tms5DataPoint.setAddressOffset(9);
-    tms5DataPoint.setBlockOffset(7);
-    tms5DataPoint.setScaleFactorName("Tms_SF");
-    tms5DataPoint.setSunSpecDataType("uint16");
-    tms5DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms5DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms5DataPoint.name(), tms5DataPoint);
-
-    SunSpecDataPoint hz5DataPoint;
-    hz5DataPoint.setName("Hz5");
-    hz5DataPoint.setLabel("Hz5");
-    hz5DataPoint.setDescription("Point 5 frequency.");
-    hz5DataPoint.setUnits("Hz");
-    hz5DataPoint.setSize(1);
-    hz5DataPoint.setAddressOffset(10);
-    hz5DataPoint.setBlockOffset(8);
-    hz5DataPoint.setScaleFactorName("Hz_SF");
-    hz5DataPoint.setSunSpecDataType("uint16");
-    hz5DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz5DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz5DataPoint.name(), hz5DataPoint);
-
-    SunSpecDataPoint tms6DataPoint;
-    tms6DataPoint.setName("Tms6");
-    tms6DataPoint.setLabel("Tms6");
-    tms6DataPoint.setDescription("Point 6 duration.");
-    tms6DataPoint.setUnits("Secs");
-    tms6DataPoint.setSize(1);
-    tms6DataPoint.setAddressOffset(11);
-    tms6DataPoint.setBlockOffset(9);
-    tms6DataPoint.setScaleFactorName("Tms_SF");
-    tms6DataPoint.setSunSpecDataType("uint16");
-    tms6DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms6DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms6DataPoint.name(), tms6DataPoint);
-
-    SunSpecDataPoint hz6DataPoint;
-    hz6DataPoint.setName("Hz6");
-    hz6DataPoint.setLabel("Hz6");
-    hz6DataPoint.setDescription("Point 6 frequency.");
-    hz6DataPoint.setUnits("Hz");
-    hz6DataPoint.setSize(1);
-    hz6DataPoint.setAddressOffset(12);
-    hz6DataPoint.setBlockOffset(10);
-    hz6DataPoint.setScaleFactorName("Hz_SF");
-    hz6DataPoint.setSunSpecDataType("uint16");
-    hz6DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz6DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz6DataPoint.name(), hz6DataPoint);
-
-    SunSpecDataPoint tms7DataPoint;
-    tms7DataPoint.setName("Tms7");
-    tms7DataPoint.setLabel("Tms7");
-    tms7DataPoint.setDescription("Point 7 duration.");
-    tms7DataPoint.setUnits("Secs");
-    tms7DataPoint.setSize(1);
-    tms7DataPoint.setAddressOffset(13);
-    tms7DataPoint.setBlockOffset(11);
-    tms7DataPoint.setScaleFactorName("Tms_SF");
-    tms7DataPoint.setSunSpecDataType("uint16");
-    tms7DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms7DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms7DataPoint.name(), tms7DataPoint);
-
-    SunSpecDataPoint hz7DataPoint;
-    hz7DataPoint.setName("Hz7");
-    hz7DataPoint.setLabel("Hz7");
-    hz7DataPoint.setDescription("Point 7 frequency.");
-    hz7DataPoint.setUnits("Hz");
-    hz7DataPoint.setSize(1);
-    hz7DataPoint.setAddressOffset(14);
-    hz7DataPoint.setBlockOffset(12);
-    hz7DataPoint.setScaleFactorName("Hz_SF");
-    hz7DataPoint.setSunSpecDataType("uint16");
-    hz7DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz7DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz7DataPoint.name(), hz7DataPoint);
-
-    SunSpecDataPoint tms8DataPoint;
-    tms8DataPoint.setName("Tms8");
-    tms8DataPoint.setLabel("Tms8");
-    tms8DataPoint.setDescription("Point 8 duration.");
-    tms8DataPoint.setUnits("Secs");
-    tms8DataPoint.setSize(1);
-    tms8DataPoint.setAddressOffset(15);
-    tms8DataPoint.setBlockOffset(13);
-    tms8DataPoint.setScaleFactorName("Tms_SF");
-    tms8DataPoint.setSunSpecDataType("uint16");
-    tms8DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms8DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms8DataPoint.name(), tms8DataPoint);
-
-    SunSpecDataPoint hz8DataPoint;
-    hz8DataPoint.setName("Hz8");
-    hz8DataPoint.setLabel("Hz8");
-    hz8DataPoint.setDescription("Point 8 frequency.");
-    hz8DataPoint.setUnits("Hz");
-    hz8DataPoint.setSize(1);
-    hz8DataPoint.setAddressOffset(16);
-    hz8DataPoint.setBlockOffset(14);
-    hz8DataPoint.setScaleFactorName("Hz_SF");
-    hz8DataPoint.setSunSpecDataType("uint16");
-    hz8DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz8DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz8DataPoint.name(), hz8DataPoint);
-
-    SunSpecDataPoint tms9DataPoint;
-    tms9DataPoint.setName("Tms9");
-    tms9DataPoint.setLabel("Tms9");
-    tms9DataPoint.setDescription("Point 9 duration.");
-    tms9DataPoint.setUnits("Secs");
-    tms9DataPoint.setSize(1);
-    tms9DataPoint.setAddressOffset(17);
-    tms9DataPoint.setBlockOffset(15);
-    tms9DataPoint.setScaleFactorName("Tms_SF");
-    tms9DataPoint.setSunSpecDataType("uint16");
-    tms9DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms9DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms9DataPoint.name(), tms9DataPoint);
-
-    SunSpecDataPoint hz9DataPoint;
-    hz9DataPoint.setName("Hz9");
-    hz9DataPoint.setLabel("Hz9");
-    hz9DataPoint.setDescription("Point 9 frequency.");
-    hz9DataPoint.setUnits("Hz");
-    hz9DataPoint.setSize(1);
-    hz9DataPoint.setAddressOffset(18);
-    hz9DataPoint.setBlockOffset(16);
-    hz9DataPoint.setScaleFactorName("Hz_SF");
-    hz9DataPoint.setSunSpecDataType("uint16");
-    hz9DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz9DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz9DataPoint.name(), hz9DataPoint);
-
-    SunSpecDataPoint tms10DataPoint;
-    tms10DataPoint.setName("Tms10");
-    tms10DataPoint.setLabel("Tms10");
-    tms10DataPoint.setDescription("Point 10 duration.");
-    tms10DataPoint.setUnits("Secs");
-    tms10DataPoint.setSize(1);
-    tms10DataPoint.setAddressOffset(19);
-    tms10DataPoint.setBlockOffset(17);
-    tms10DataPoint.setScaleFactorName("Tms_SF");
-    tms10DataPoint.setSunSpecDataType("uint16");
-    tms10DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms10DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms10DataPoint.name(), tms10DataPoint);
-
-    SunSpecDataPoint hz10DataPoint;
-    hz10DataPoint.setName("Hz10");
-    hz10DataPoint.setLabel("Hz10");
-    hz10DataPoint.setDescription("Point 10 frequency.");
-    hz10DataPoint.setUnits("Hz");
-    hz10DataPoint.setSize(1);
-    hz10DataPoint.setAddressOffset(20);
-    hz10DataPoint.setBlockOffset(18);
-    hz10DataPoint.setScaleFactorName("Hz_SF");
-    hz10DataPoint.setSunSpecDataType("uint16");
-    hz10DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz10DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz10DataPoint.name(), hz10DataPoint);
-
-    SunSpecDataPoint tms11DataPoint;
-    tms11DataPoint.setName("Tms11");
-    tms11DataPoint.setLabel("Tms11");
-    tms11DataPoint.setDescription("Point 11 duration.");
-    tms11DataPoint.setUnits("Secs");
-    tms11DataPoint.setSize(1);
-    tms11DataPoint.setAddressOffset(21);
-    tms11DataPoint.setBlockOffset(19);
-    tms11DataPoint.setScaleFactorName("Tms_SF");
-    tms11DataPoint.setSunSpecDataType("uint16");
-    tms11DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms11DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms11DataPoint.name(), tms11DataPoint);
-
-    SunSpecDataPoint hz11DataPoint;
-    hz11DataPoint.setName("Hz11");
-    hz11DataPoint.setLabel("Hz11");
-    hz11DataPoint.setDescription("Point 11 frequency.");
-    hz11DataPoint.setUnits("Hz");
-    hz11DataPoint.setSize(1);
-    hz11DataPoint.setAddressOffset(22);
-    hz11DataPoint.setBlockOffset(20);
-    hz11DataPoint.setScaleFactorName("Hz_SF");
-    hz11DataPoint.setSunSpecDataType("uint16");
-    hz11DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz11DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz11DataPoint.name(), hz11DataPoint);
-
-    SunSpecDataPoint tms12DataPoint;
-    tms12DataPoint.setName("Tms12");
-    tms12DataPoint.setLabel("Tms12");
-    tms12DataPoint.setDescription("Point 12 duration.");
-    tms12DataPoint.setUnits("Secs");
-    tms12DataPoint.setSize(1);
-    tms12DataPoint.setAddressOffset(23);
-    tms12DataPoint.setBlockOffset(21);
-    tms12DataPoint.setScaleFactorName("Tms_SF");
-    tms12DataPoint.setSunSpecDataType("uint16");
-    tms12DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms12DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms12DataPoint.name(), tms12DataPoint);
-
-    SunSpecDataPoint hz12DataPoint;
-    hz12DataPoint.setName("Hz12");
-    hz12DataPoint.setLabel("Hz12");
-    hz12DataPoint.setDescription("Point 12 frequency.");
-    hz12DataPoint.setUnits("Hz");
-    hz12DataPoint.setSize(1);
-    hz12DataPoint.setAddressOffset(24);
-    hz12DataPoint.setBlockOffset(22);
-    hz12DataPoint.setScaleFactorName("Hz_SF");
-    hz12DataPoint.setSunSpecDataType("uint16");
-    hz12DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz12DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz12DataPoint.name(), hz12DataPoint);
-
-    SunSpecDataPoint tms13DataPoint;
-    tms13DataPoint.setName("Tms13");
-    tms13DataPoint.setLabel("Tms13");
-    tms13DataPoint.setDescription("Point 13 duration.");
-    tms13DataPoint.setUnits("Secs");
-    tms13DataPoint.setSize(1);
-    tms13DataPoint.setAddressOffset(25);
-    tms13DataPoint.setBlockOffset(23);
-    tms13DataPoint.setScaleFactorName("Tms_SF");
-    tms13DataPoint.setSunSpecDataType("uint16");
-    tms13DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms13DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms13DataPoint.name(), tms13DataPoint);
-
-    SunSpecDataPoint hz13DataPoint;
-    hz13DataPoint.setName("Hz13");
-    hz13DataPoint.setLabel("Hz13");
-    hz13DataPoint.setDescription("Point 13 frequency.");
-    hz13DataPoint.setUnits("Hz");
-    hz13DataPoint.setSize(1);
-    hz13DataPoint.setAddressOffset(26);
-    hz13DataPoint.setBlockOffset(24);
-    hz13DataPoint.setScaleFactorName("Hz_SF");
-    hz13DataPoint.setSunSpecDataType("uint16");
-    hz13DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz13DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz13DataPoint.name(), hz13DataPoint);
-
-    SunSpecDataPoint tms14DataPoint;
-    tms14DataPoint.setName("Tms14");
-    tms14DataPoint.setLabel("Tms14");
-    tms14DataPoint.setDescription("Point 14 duration.");
-    tms14DataPoint.setUnits("Secs");
-    tms14DataPoint.setSize(1);
-    tms14DataPoint.setAddressOffset(27);
-    tms14DataPoint.setBlockOffset(25);
-    tms14DataPoint.setScaleFactorName("Tms_SF");
-    tms14DataPoint.setSunSpecDataType("uint16");
-    tms14DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms14DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms14DataPoint.name(), tms14DataPoint);
-
-    SunSpecDataPoint hz14DataPoint;
-    hz14DataPoint.setName("Hz14");
-    hz14DataPoint.setLabel("Hz14");
-    hz14DataPoint.setDescription("Point 14 frequency.");
-    hz14DataPoint.setUnits("Hz");
-    hz14DataPoint.setSize(1);
-    hz14DataPoint.setAddressOffset(28);
-    hz14DataPoint.setBlockOffset(26);
-    hz14DataPoint.setScaleFactorName("Hz_SF");
-    hz14DataPoint.setSunSpecDataType("uint16");
-    hz14DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz14DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz14DataPoint.name(), hz14DataPoint);
-
-    SunSpecDataPoint tms15DataPoint;
-    tms15DataPoint.setName("Tms15");
-    tms15DataPoint.setLabel("Tms15");
-    tms15DataPoint.setDescription("Point 15 duration.");
-    tms15DataPoint.setUnits("Secs");
-    tms15DataPoint.setSize(1);
-    tms15DataPoint.setAddressOffset(29);
-    tms15DataPoint.setBlockOffset(27);
-    tms15DataPoint.setScaleFactorName("Tms_SF");
-    tms15DataPoint.setSunSpecDataType("uint16");
-    tms15DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms15DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms15DataPoint.name(), tms15DataPoint);
-
-    SunSpecDataPoint hz15DataPoint;
-    hz15DataPoint.setName("Hz15");
-    hz15DataPoint.setLabel("Hz15");
-    hz15DataPoint.setDescription("Point 15 frequency.");
-    hz15DataPoint.setUnits("Hz");
-    hz15DataPoint.setSize(1);
-    hz15DataPoint.setAddressOffset(30);
-    hz15DataPoint.setBlockOffset(28);
-    hz15DataPoint.setScaleFactorName("Hz_SF");
-    hz15DataPoint.setSunSpecDataType("uint16");
-    hz15DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz15DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz15DataPoint.name(), hz15DataPoint);
-
-    SunSpecDataPoint tms16DataPoint;
-    tms16DataPoint.setName("Tms16");
-    tms16DataPoint.setLabel("Tms16");
-    tms16DataPoint.setDescription("Point 16 duration.");
-    tms16DataPoint.setUnits("Secs");
-    tms16DataPoint.setSize(1);
-    tms16DataPoint.setAddressOffset(31);
-    tms16DataPoint.setBlockOffset(29);
-    tms16DataPoint.setScaleFactorName("Tms_SF");
-    tms16DataPoint.setSunSpecDataType("uint16");
-    tms16DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms16DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms16DataPoint.name(), tms16DataPoint);
-
-    SunSpecDataPoint hz16DataPoint;
-    hz16DataPoint.setName("Hz16");
-    hz16DataPoint.setLabel("Hz16");
-    hz16DataPoint.setDescription("Point 16 frequency.");
-    hz16DataPoint.setUnits("Hz");
-    hz16DataPoint.setSize(1);
-    hz16DataPoint.setAddressOffset(32);
-    hz16DataPoint.setBlockOffset(30);
-    hz16DataPoint.setScaleFactorName("Hz_SF");
-    hz16DataPoint.setSunSpecDataType("uint16");
-    hz16DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz16DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz16DataPoint.name(), hz16DataPoint);
-
-    SunSpecDataPoint tms17DataPoint;
-    tms17DataPoint.setName("Tms17");
-    tms17DataPoint.setLabel("Tms17");
-    tms17DataPoint.setDescription("Point 17 duration.");
-    tms17DataPoint.setUnits("Secs");
-    tms17DataPoint.setSize(1);
-    tms17DataPoint.setAddressOffset(33);
-    tms17DataPoint.setBlockOffset(31);
-    tms17DataPoint.setScaleFactorName("Tms_SF");
-    tms17DataPoint.setSunSpecDataType("uint16");
-    tms17DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms17DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms17DataPoint.name(), tms17DataPoint);
-
-    SunSpecDataPoint hz17DataPoint;
-    hz17DataPoint.setName("Hz17");
-    hz17DataPoint.setLabel("Hz17");
-    hz17DataPoint.setDescription("Point 17 frequency.");
-    hz17DataPoint.setUnits("Hz");
-    hz17DataPoint.setSize(1);
-    hz17DataPoint.setAddressOffset(34);
-    hz17DataPoint.setBlockOffset(32);
-    hz17DataPoint.setScaleFactorName("Hz_SF");
-    hz17DataPoint.setSunSpecDataType("uint16");
-    hz17DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz17DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz17DataPoint.name(), hz17DataPoint);
-
-    SunSpecDataPoint tms18DataPoint;
-    tms18DataPoint.setName("Tms18");
-    tms18DataPoint.setLabel("Tms18");
-    tms18DataPoint.setDescription("Point 18 duration.");
-    tms18DataPoint.setUnits("Secs");
-    tms18DataPoint.setSize(1);
-    tms18DataPoint.setAddressOffset(35);
-    tms18DataPoint.setBlockOffset(33);
-    tms18DataPoint.setScaleFactorName("Tms_SF");
-    tms18DataPoint.setSunSpecDataType("uint16");
-    tms18DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms18DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms18DataPoint.name(), tms18DataPoint);
-
-    SunSpecDataPoint hz18DataPoint;
-    hz18DataPoint.setName("Hz18");
-    hz18DataPoint.setLabel("Hz18");
-    hz18DataPoint.setDescription("Point 18 frequency.");
-    hz18DataPoint.setUnits("Hz");
-    hz18DataPoint.setSize(1);
-    hz18DataPoint.setAddressOffset(36);
-    hz18DataPoint.setBlockOffset(34);
-    hz18DataPoint.setScaleFactorName("Hz_SF");
-    hz18DataPoint.setSunSpecDataType("uint16");
-    hz18DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz18DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz18DataPoint.name(), hz18DataPoint);
-
-    SunSpecDataPoint tms19DataPoint;
-    tms19DataPoint.setName("Tms19");
-    tms19DataPoint.setLabel("Tms19");
-    tms19DataPoint.setDescription("Point 19 duration.");
-    tms19DataPoint.setUnits("Secs");
-    tms19DataPoint.setSize(1);
-    tms19DataPoint.setAddressOffset(37);
-    tms19DataPoint.setBlockOffset(35);
-    tms19DataPoint.setScaleFactorName("Tms_SF");
-    tms19DataPoint.setSunSpecDataType("uint16");
-    tms19DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms19DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms19DataPoint.name(), tms19DataPoint);
-
-    SunSpecDataPoint hz19DataPoint;
-    hz19DataPoint.setName("Hz19");
-    hz19DataPoint.setLabel("Hz19");
-    hz19DataPoint.setDescription("Point 19 frequency.");
-    hz19DataPoint.setUnits("Hz");
-    hz19DataPoint.setSize(1);
-    hz19DataPoint.setAddressOffset(38);
-    hz19DataPoint.setBlockOffset(36);
-    hz19DataPoint.setScaleFactorName("Hz_SF");
-    hz19DataPoint.setSunSpecDataType("uint16");
-    hz19DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz19DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz19DataPoint.name(), hz19DataPoint);
-
-    SunSpecDataPoint tms20DataPoint;
-    tms20DataPoint.setName("Tms20");
-    tms20DataPoint.setLabel("Tms20");
-    tms20DataPoint.setDescription("Point 20 duration.");
-    tms20DataPoint.setUnits("Secs");
-    tms20DataPoint.setSize(1);
-    tms20DataPoint.setAddressOffset(39);
-    tms20DataPoint.setBlockOffset(37);
-    tms20DataPoint.setScaleFactorName("Tms_SF");
-    tms20DataPoint.setSunSpecDataType("uint16");
-    tms20DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    tms20DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tms20DataPoint.name(), tms20DataPoint);
-
-    SunSpecDataPoint hz20DataPoint;
-    hz20DataPoint.setName("Hz20");
-    hz20DataPoint.setLabel("Hz20");
-    hz20DataPoint.setDescription("Point 20 frequency.");
-    hz20DataPoint.setUnits("Hz");
-    hz20DataPoint.setSize(1);
-    hz20DataPoint.setAddressOffset(40);
-    hz20DataPoint.setBlockOffset(38);
-    hz20DataPoint.setScaleFactorName("Hz_SF");
-    hz20DataPoint.setSunSpecDataType("uint16");
-    hz20DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hz20DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hz20DataPoint.name(), hz20DataPoint);
-
-    SunSpecDataPoint crvNamDataPoint;
-    crvNamDataPoint.setName("CrvNam");
-    crvNamDataPoint.setLabel("CrvNam");
-    crvNamDataPoint.setDescription("Optional description for curve.");
-    crvNamDataPoint.setSize(8);
-    crvNamDataPoint.setAddressOffset(41);
-    crvNamDataPoint.setBlockOffset(39);
-    crvNamDataPoint.setSunSpecDataType("string");
-    crvNamDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    crvNamDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(crvNamDataPoint.name(), crvNamDataPoint);
-
-    SunSpecDataPoint readOnlyDataPoint;
-    readOnlyDataPoint.setName("ReadOnly");
-    readOnlyDataPoint.setLabel("ReadOnly");
-    readOnlyDataPoint.setDescription("Enumerated value indicates if curve is read-only or can be modified.");
-    readOnlyDataPoint.setMandatory(true);
-    readOnlyDataPoint.setSize(1);
-    readOnlyDataPoint.setAddressOffset(49);
-    readOnlyDataPoint.setBlockOffset(47);
-    readOnlyDataPoint.setSunSpecDataType("enum16");
-    readOnlyDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(readOnlyDataPoint.name(), readOnlyDataPoint);
-
+    m_dataPointMetadata = repeatingBlockDataPointMetadata;
+    m_dataPointCount = 43;
 }
 
 void SunSpecHfrtxModelRepeatingBlock::processBlockData(const QVector<quint16> blockData)
 {
     m_blockData = blockData;
 
+    const quint16 *registers = m_blockData.constData();
+    const int registerCount = m_blockData.count();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("ActPt").isValid())
-        m_actPt = m_dataPoints.value("ActPt").toUInt16();
+    if (registerCount >= 1 && SunSpecDataPoint::isValid(registers + 0, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_actPt = SunSpecDataPoint::convertToUInt16(registers + 0, 1);
 
-    if (m_dataPoints.value("Tms1").isValid())
-        m_tms1 = m_dataPoints.value("Tms1").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 2 && SunSpecDataPoint::isValid(registers + 1, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms1 = SunSpecDataPoint::convertToUInt16(registers + 1, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz1").isValid())
-        m_hz1 = m_dataPoints.value("Hz1").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz1 = SunSpecDataPoint::convertToUInt16(registers + 2, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms2").isValid())
-        m_tms2 = m_dataPoints.value("Tms2").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms2 = SunSpecDataPoint::convertToUInt16(registers + 3, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz2").isValid())
-        m_hz2 = m_dataPoints.value("Hz2").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz2 = SunSpecDataPoint::convertToUInt16(registers + 4, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms3").isValid())
-        m_tms3 = m_dataPoints.value("Tms3").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms3 = SunSpecDataPoint::convertToUInt16(registers + 5, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz3").isValid())
-        m_hz3 = m_dataPoints.value("Hz3").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz3 = SunSpecDataPoint::convertToUInt16(registers + 6, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms4").isValid())
-        m_tms4 = m_dataPoints.value("Tms4").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms4 = SunSpecDataPoint::convertToUInt16(registers + 7, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz4").isValid())
-        m_hz4 = m_dataPoints.value("Hz4").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz4 = SunSpecDataPoint::convertToUInt16(registers + 8, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms5").isValid())
-        m_tms5 = m_dataPoints.value("Tms5").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms5 = SunSpecDataPoint::convertToUInt16(registers + 9, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz5").isValid())
-        m_hz5 = m_dataPoints.value("Hz5").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz5 = SunSpecDataPoint::convertToUInt16(registers + 10, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms6").isValid())
-        m_tms6 = m_dataPoints.value("Tms6").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms6 = SunSpecDataPoint::convertToUInt16(registers + 11, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz6").isValid())
-        m_hz6 = m_dataPoints.value("Hz6").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 12, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz6 = SunSpecDataPoint::convertToUInt16(registers + 12, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms7").isValid())
-        m_tms7 = m_dataPoints.value("Tms7").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 13, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms7 = SunSpecDataPoint::convertToUInt16(registers + 13, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz7").isValid())
-        m_hz7 = m_dataPoints.value("Hz7").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 15 && SunSpecDataPoint::isValid(registers + 14, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz7 = SunSpecDataPoint::convertToUInt16(registers + 14, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms8").isValid())
-        m_tms8 = m_dataPoints.value("Tms8").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 15, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms8 = SunSpecDataPoint::convertToUInt16(registers + 15, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz8").isValid())
-        m_hz8 = m_dataPoints.value("Hz8").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 17 && SunSpecDataPoint::isValid(registers + 16, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz8 = SunSpecDataPoint::convertToUInt16(registers + 16, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms9").isValid())
-        m_tms9 = m_dataPoints.value("Tms9").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 18 && SunSpecDataPoint::isValid(registers + 17, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms9 = SunSpecDataPoint::convertToUInt16(registers + 17, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz9").isValid())
-        m_hz9 = m_dataPoints.value("Hz9").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 19 && SunSpecDataPoint::isValid(registers + 18, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz9 = SunSpecDataPoint::convertToUInt16(registers + 18, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms10").isValid())
-        m_tms10 = m_dataPoints.value("Tms10").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 20 && SunSpecDataPoint::isValid(registers + 19, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms10 = SunSpecDataPoint::convertToUInt16(registers + 19, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz10").isValid())
-        m_hz10 = m_dataPoints.value("Hz10").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 21 && SunSpecDataPoint::isValid(registers + 20, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz10 = SunSpecDataPoint::convertToUInt16(registers + 20, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms11").isValid())
-        m_tms11 = m_dataPoints.value("Tms11").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 22 && SunSpecDataPoint::isValid(registers + 21, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms11 = SunSpecDataPoint::convertToUInt16(registers + 21, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz11").isValid())
-        m_hz11 = m_dataPoints.value("Hz11").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 23 && SunSpecDataPoint::isValid(registers + 22, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz11 = SunSpecDataPoint::convertToUInt16(registers + 22, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms12").isValid())
-        m_tms12 = m_dataPoints.value("Tms12").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 24 && SunSpecDataPoint::isValid(registers + 23, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms12 = SunSpecDataPoint::convertToUInt16(registers + 23, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz12").isValid())
-        m_hz12 = m_dataPoints.value("Hz12").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 25 && SunSpecDataPoint::isValid(registers + 24, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz12 = SunSpecDataPoint::convertToUInt16(registers + 24, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms13").isValid())
-        m_tms13 = m_dataPoints.value("Tms13").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 26 && SunSpecDataPoint::isValid(registers + 25, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms13 = SunSpecDataPoint::convertToUInt16(registers + 25, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz13").isValid())
-        m_hz13 = m_dataPoints.value("Hz13").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 27 && SunSpecDataPoint::isValid(registers + 26, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz13 = SunSpecDataPoint::convertToUInt16(registers + 26, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms14").isValid())
-        m_tms14 = m_dataPoints.value("Tms14").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 28 && SunSpecDataPoint::isValid(registers + 27, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms14 = SunSpecDataPoint::convertToUInt16(registers + 27, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz14").isValid())
-        m_hz14 = m_dataPoints.value("Hz14").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 29 && SunSpecDataPoint::isValid(registers + 28, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz14 = SunSpecDataPoint::convertToUInt16(registers + 28, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms15").isValid())
-        m_tms15 = m_dataPoints.value("Tms15").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 30 && SunSpecDataPoint::isValid(registers + 29, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms15 = SunSpecDataPoint::convertToUInt16(registers + 29, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz15").isValid())
-        m_hz15 = m_dataPoints.value("Hz15").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 31 && SunSpecDataPoint::isValid(registers + 30, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz15 = SunSpecDataPoint::convertToUInt16(registers + 30, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms16").isValid())
-        m_tms16 = m_dataPoints.value("Tms16").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 32 && SunSpecDataPoint::isValid(registers + 31, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms16 = SunSpecDataPoint::convertToUInt16(registers + 31, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz16").isValid())
-        m_hz16 = m_dataPoints.value("Hz16").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 33 && SunSpecDataPoint::isValid(registers + 32, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz16 = SunSpecDataPoint::convertToUInt16(registers + 32, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms17").isValid())
-        m_tms17 = m_dataPoints.value("Tms17").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 34 && SunSpecDataPoint::isValid(registers + 33, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms17 = SunSpecDataPoint::convertToUInt16(registers + 33, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz17").isValid())
-        m_hz17 = m_dataPoints.value("Hz17").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 35 && SunSpecDataPoint::isValid(registers + 34, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz17 = SunSpecDataPoint::convertToUInt16(registers + 34, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms18").isValid())
-        m_tms18 = m_dataPoints.value("Tms18").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 36 && SunSpecDataPoint::isValid(registers + 35, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms18 = SunSpecDataPoint::convertToUInt16(registers + 35, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz18").isValid())
-        m_hz18 = m_dataPoints.value("Hz18").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 37 && SunSpecDataPoint::isValid(registers + 36, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz18 = SunSpecDataPoint::convertToUInt16(registers + 36, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms19").isValid())
-        m_tms19 = m_dataPoints.value("Tms19").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 38 && SunSpecDataPoint::isValid(registers + 37, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms19 = SunSpecDataPoint::convertToUInt16(registers + 37, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz19").isValid())
-        m_hz19 = m_dataPoints.value("Hz19").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 39 && SunSpecDataPoint::isValid(registers + 38, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz19 = SunSpecDataPoint::convertToUInt16(registers + 38, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("Tms20").isValid())
-        m_tms20 = m_dataPoints.value("Tms20").toFloatWithSSF(m_parentModel->tmsSf());
+    if (registerCount >= 40 && SunSpecDataPoint::isValid(registers + 39, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_tms20 = SunSpecDataPoint::convertToUInt16(registers + 39, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->tmsSf());
 
-    if (m_dataPoints.value("Hz20").isValid())
-        m_hz20 = m_dataPoints.value("Hz20").toFloatWithSSF(m_parentModel->hzSf());
+    if (registerCount >= 41 && SunSpecDataPoint::isValid(registers + 40, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hz20 = SunSpecDataPoint::convertToUInt16(registers + 40, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->hzSf());
 
-    if (m_dataPoints.value("CrvNam").isValid())
-        m_crvNam = m_dataPoints.value("CrvNam").toString();
+    if (registerCount >= 49 && SunSpecDataPoint::isValid(registers + 41, 8, SunSpecDataPoint::String, m_byteOrder))
+        m_crvNam = SunSpecDataPoint::convertToString(registers + 41, 8);
 
-    if (m_dataPoints.value("ReadOnly").isValid())
-        m_readOnly = static_cast<Readonly>(m_dataPoints.value("ReadOnly").toUInt16());
+    if (registerCount >= 50 && SunSpecDataPoint::isValid(registers + 49, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_readOnly = static_cast<Readonly>(SunSpecDataPoint::convertToUInt16(registers + 49, 1));
 
 
     qCDebug(dcSunSpecModelData()) << this;
 }
 
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexActCrv
+    { "ActCrv", "ActCrv", "Index of active curve. 0=no active curve.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 2, 0, 1 },
+    // DataPointIndexModEna
+    { "ModEna", "ModEna", "LHzRT control mode. Enable active curve.  Bitfield value.", nullptr, nullptr, "bitfield16", nullptr, SunSpecDataPoint::BitField16, SunSpecDataPoint::AccessReadWrite, true, 3, 1, 1 },
+    // DataPointIndexWinTms
+    { "WinTms", "WinTms", "Time window for LFRT change.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 4, 2, 1 },
+    // DataPointIndexRvrtTms
+    { "RvrtTms", "RvrtTms", "Timeout period for LFRT curve selection.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 5, 3, 1 },
+    // DataPointIndexRmpTms
+    { "RmpTms", "RmpTms", "Ramp time for moving from current mode to new mode.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 6, 4, 1 },
+    // DataPointIndexNCrv
+    { "NCrv", "NCrv", "Number of curves supported (recommend 4).", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 7, 5, 1 },
+    // DataPointIndexNPt
+    { "NPt", "NPt", "Number of curve points supported (maximum of 20).", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 8, 6, 1 },
+    // DataPointIndexTmsSf
+    { "Tms_SF", "Tms_SF", "Scale factor for duration.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 9, 7, 1 },
+    // DataPointIndexHzSf
+    { "Hz_SF", "Hz_SF", "Scale factor for frequency.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 10, 8, 1 },
+    // DataPointIndexCrvType
+    { "CrvType", nullptr, nullptr, nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, true, 11, 9, 1 }
+};
+
 SunSpecHfrtxModel::SunSpecHfrtxModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 144, modelLength, byteOrder, parent)
 {
@@ -1503,7 +1027,7 @@ QModbusReply *SunSpecHfrtxModel::setActCrv(quint16 actCrv)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ActCrv");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexActCrv]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(actCrv);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -1521,7 +1045,7 @@ QModbusReply *SunSpecHfrtxModel::setModEna(ModenaFlags modEna)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ModEna");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexModEna]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(modEna));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -1539,7 +1063,7 @@ QModbusReply *SunSpecHfrtxModel::setWinTms(quint16 winTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("WinTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexWinTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(winTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -1557,7 +1081,7 @@ QModbusReply *SunSpecHfrtxModel::setRvrtTms(quint16 rvrtTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("RvrtTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexRvrtTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(rvrtTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -1575,7 +1099,7 @@ QModbusReply *SunSpecHfrtxModel::setRmpTms(quint16 rmpTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("RmpTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexRmpTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(rmpTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -1605,193 +1129,57 @@ SunSpecHfrtxModel::Crvtype SunSpecHfrtxModel::crvType() const
 }
 void SunSpecHfrtxModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint actCrvDataPoint;
-    actCrvDataPoint.setName("ActCrv");
-    actCrvDataPoint.setLabel("ActCrv");
-    actCrvDataPoint.setDescription("Index of active curve. 0=no active curve.");
-    actCrvDataPoint.setMandatory(true);
-    actCrvDataPoint.setSize(1);
-    actCrvDataPoint.setAddressOffset(2);
-    actCrvDataPoint.setBlockOffset(0);
-    actCrvDataPoint.setSunSpecDataType("uint16");
-    actCrvDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    actCrvDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(actCrvDataPoint.name(), actCrvDataPoint);
-
-    SunSpecDataPoint modEnaDataPoint;
-    modEnaDataPoint.setName("ModEna");
-    modEnaDataPoint.setLabel("ModEna");
-    modEnaDataPoint.setDescription("LHzRT control mode. Enable active curve.  Bitfield value.");
-    modEnaDataPoint.setMandatory(true);
-    modEnaDataPoint.setSize(1);
-    modEnaDataPoint.setAddressOffset(3);
-    modEnaDataPoint.setBlockOffset(1);
-    modEnaDataPoint.setSunSpecDataType("bitfield16");
-    modEnaDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    modEnaDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modEnaDataPoint.name(), modEnaDataPoint);
-
-    SunSpecDataPoint winTmsDataPoint;
-    winTmsDataPoint.setName("WinTms");
-    winTmsDataPoint.setLabel("WinTms");
-    winTmsDataPoint.setDescription("Time window for LFRT change.");
-    winTmsDataPoint.setUnits("Secs");
-    winTmsDataPoint.setSize(1);
-    winTmsDataPoint.setAddressOffset(4);
-    winTmsDataPoint.setBlockOffset(2);
-    winTmsDataPoint.setSunSpecDataType("uint16");
-    winTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    winTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(winTmsDataPoint.name(), winTmsDataPoint);
-
-    SunSpecDataPoint rvrtTmsDataPoint;
-    rvrtTmsDataPoint.setName("RvrtTms");
-    rvrtTmsDataPoint.setLabel("RvrtTms");
-    rvrtTmsDataPoint.setDescription("Timeout period for LFRT curve selection.");
-    rvrtTmsDataPoint.setUnits("Secs");
-    rvrtTmsDataPoint.setSize(1);
-    rvrtTmsDataPoint.setAddressOffset(5);
-    rvrtTmsDataPoint.setBlockOffset(3);
-    rvrtTmsDataPoint.setSunSpecDataType("uint16");
-    rvrtTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    rvrtTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rvrtTmsDataPoint.name(), rvrtTmsDataPoint);
-
-    SunSpecDataPoint rmpTmsDataPoint;
-    rmpTmsDataPoint.setName("RmpTms");
-    rmpTmsDataPoint.setLabel("RmpTms");
-    rmpTmsDataPoint.setDescription("Ramp time for moving from current mode to new mode.");
-    rmpTmsDataPoint.setUnits("Secs");
-    rmpTmsDataPoint.setSize(1);
-    rmpTmsDataPoint.setAddressOffset(6);
-    rmpTmsDataPoint.setBlockOffset(4);
-    rmpTmsDataPoint.setSunSpecDataType("uint16");
-    rmpTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    rmpTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rmpTmsDataPoint.name(), rmpTmsDataPoint);
-
-    SunSpecDataPoint nCrvDataPoint;
-    nCrvDataPoint.setName("NCrv");
-    nCrvDataPoint.setLabel("NCrv");
-    nCrvDataPoint.setDescription("Number of curves supported (recommend 4).");
-    nCrvDataPoint.setMandatory(true);
-    nCrvDataPoint.setSize(1);
-    nCrvDataPoint.setAddressOffset(7);
-    nCrvDataPoint.setBlockOffset(5);
-    nCrvDataPoint.setSunSpecDataType("uint16");
-    nCrvDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(nCrvDataPoint.name(), nCrvDataPoint);
-
-    SunSpecDataPoint nPtDataPoint;
-    nPtDataPoint.setName("NPt");
-    nPtDataPoint.setLabel("NPt");
-    nPtDataPoint.setDescription("Number of curve points supported (maximum of 20).");
-    nPtDataPoint.setMandatory(true);
-    nPtDataPoint.setSize(1);
-    nPtDataPoint.setAddressOffset(8);
-    nPtDataPoint.setBlockOffset(6);
-    nPtDataPoint.setSunSpecDataType("uint16");
-    nPtDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(nPtDataPoint.name(), nPtDataPoint);
-
-    SunSpecDataPoint tmsSfDataPoint;
-    tmsSfDataPoint.setName("Tms_SF");
-    tmsSfDataPoint.setLabel("Tms_SF");
-    tmsSfDataPoint.setDescription("Scale factor for duration.");
-    tmsSfDataPoint.setMandatory(true);
-    tmsSfDataPoint.setSize(1);
-    tmsSfDataPoint.setAddressOffset(9);
-    tmsSfDataPoint.setBlockOffset(7);
-    tmsSfDataPoint.setSunSpecDataType("sunssf");
-    tmsSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tmsSfDataPoint.name(), tmsSfDataPoint);
-
-    SunSpecDataPoint hzSfDataPoint;
-    hzSfDataPoint.setName("Hz_SF");
-    hzSfDataPoint.setLabel("Hz_SF");
-    hzSfDataPoint.setDescription("Scale factor for frequency.");
-    hzSfDataPoint.setMandatory(true);
-    hzSfDataPoint.setSize(1);
-    hzSfDataPoint.setAddressOffset(10);
-    hzSfDataPoint.setBlockOffset(8);
-    hzSfDataPoint.setSunSpecDataType("sunssf");
-    hzSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hzSfDataPoint.name(), hzSfDataPoint);
-
-    SunSpecDataPoint crvTypeDataPoint;
-    crvTypeDataPoint.setName("CrvType");
-    crvTypeDataPoint.setMandatory(true);
-    crvTypeDataPoint.setSize(1);
-    crvTypeDataPoint.setAddressOffset(11);
-    crvTypeDataPoint.setBlockOffset(9);
-    crvTypeDataPoint.setSunSpecDataType("enum16");
-    crvTypeDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(crvTypeDataPoint.name(), crvTypeDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 12;
 }
 
 void SunSpecHfrtxModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("Tms_SF").isValid())
-        m_tmsSf = m_dataPoints.value("Tms_SF").toInt16();
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 9, 1);
+        if (scaleFactor != m_tmsSf) {
+            m_tmsSf = scaleFactor;
+            m_tmsSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("Hz_SF").isValid())
-        m_hzSf = m_dataPoints.value("Hz_SF").toInt16();
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 10, 1);
+        if (scaleFactor != m_hzSf) {
+            m_hzSf = scaleFactor;
+            m_hzSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("ActCrv").isValid())
-        m_actCrv = m_dataPoints.value("ActCrv").toUInt16();
-
-    if (m_dataPoints.value("ModEna").isValid())
-        m_modEna = static_cast<ModenaFlags>(m_dataPoints.value("ModEna").toUInt16());
-
-    if (m_dataPoints.value("WinTms").isValid())
-        m_winTms = m_dataPoints.value("WinTms").toUInt16();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_actCrv = SunSpecDataPoint::convertToUInt16(registers + 2, 1);
 
-    if (m_dataPoints.value("RvrtTms").isValid())
-        m_rvrtTms = m_dataPoints.value("RvrtTms").toUInt16();
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::BitField16, m_byteOrder))
+        m_modEna = static_cast<ModenaFlags>(SunSpecDataPoint::convertToUInt16(registers + 3, 1));
 
-    if (m_dataPoints.value("RmpTms").isValid())
-        m_rmpTms = m_dataPoints.value("RmpTms").toUInt16();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_winTms = SunSpecDataPoint::convertToUInt16(registers + 4, 1);
 
-    if (m_dataPoints.value("NCrv").isValid())
-        m_nCrv = m_dataPoints.value("NCrv").toUInt16();
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_rvrtTms = SunSpecDataPoint::convertToUInt16(registers + 5, 1);
 
-    if (m_dataPoints.value("NPt").isValid())
-        m_nPt = m_dataPoints.value("NPt").toUInt16();
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_rmpTms = SunSpecDataPoint::convertToUInt16(registers + 6, 1);
 
-    if (m_dataPoints.value("Tms_SF").isValid())
-        m_tmsSf = m_dataPoints.value("Tms_SF").toInt16();
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_nCrv = SunSpecDataPoint::convertToUInt16(registers + 7, 1);
 
-    if (m_dataPoints.value("Hz_SF").isValid())
-        m_hzSf = m_dataPoints.value("Hz_SF").toInt16();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_nPt = SunSpecDataPoint::convertToUInt16(registers + 8, 1);
 
-    if (m_dataPoints.value("CrvType").isValid())
-        m_crvType = static_cast<Crvtype>(m_dataPoints.value("CrvType").toUInt16());
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_crvType = static_cast<Crvtype>(SunSpecDataPoint::convertToUInt16(registers + 11, 1));
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -1800,57 +1188,57 @@ void SunSpecHfrtxModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecHfrtxModel *model)
 {
     debug.nospace().noquote() << "SunSpecHfrtxModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ActCrv") << "-->";
-    if (model->dataPoints().value("ActCrv").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecHfrtxModel::DataPointIndexActCrv) << "-->";
+    if (model->dataPoint(SunSpecHfrtxModel::DataPointIndexActCrv).isValid()) {
         debug.nospace().noquote() << model->actCrv() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModEna") << "-->";
-    if (model->dataPoints().value("ModEna").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecHfrtxModel::DataPointIndexModEna) << "-->";
+    if (model->dataPoint(SunSpecHfrtxModel::DataPointIndexModEna).isValid()) {
         debug.nospace().noquote() << model->modEna() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WinTms") << "-->";
-    if (model->dataPoints().value("WinTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecHfrtxModel::DataPointIndexWinTms) << "-->";
+    if (model->dataPoint(SunSpecHfrtxModel::DataPointIndexWinTms).isValid()) {
         debug.nospace().noquote() << model->winTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("RvrtTms") << "-->";
-    if (model->dataPoints().value("RvrtTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecHfrtxModel::DataPointIndexRvrtTms) << "-->";
+    if (model->dataPoint(SunSpecHfrtxModel::DataPointIndexRvrtTms).isValid()) {
         debug.nospace().noquote() << model->rvrtTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("RmpTms") << "-->";
-    if (model->dataPoints().value("RmpTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecHfrtxModel::DataPointIndexRmpTms) << "-->";
+    if (model->dataPoint(SunSpecHfrtxModel::DataPointIndexRmpTms).isValid()) {
         debug.nospace().noquote() << model->rmpTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NCrv") << "-->";
-    if (model->dataPoints().value("NCrv").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecHfrtxModel::DataPointIndexNCrv) << "-->";
+    if (model->dataPoint(SunSpecHfrtxModel::DataPointIndexNCrv).isValid()) {
         debug.nospace().noquote() << model->nCrv() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NPt") << "-->";
-    if (model->dataPoints().value("NPt").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecHfrtxModel::DataPointIndexNPt) << "-->";
+    if (model->dataPoint(SunSpecHfrtxModel::DataPointIndexNPt).isValid()) {
         debug.nospace().noquote() << model->nPt() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CrvType") << "-->";
-    if (model->dataPoints().value("CrvType").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecHfrtxModel::DataPointIndexCrvType) << "-->";
+    if (model->dataPoint(SunSpecHfrtxModel::DataPointIndexCrvType).isValid()) {
         debug.nospace().noquote() << model->crvType() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
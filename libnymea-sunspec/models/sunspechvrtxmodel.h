@@ -50,6 +50,52 @@ public:
     };
     Q_ENUM(Readonly)
 
+    enum DataPointIndex {
+        DataPointIndexActPt = 0,
+        DataPointIndexTms1,
+        DataPointIndexV1,
+        DataPointIndexTms2,
+        DataPointIndexV2,
+        DataPointIndexTms3,
+        DataPointIndexV3,
+        DataPointIndexTms4,
+        DataPointIndexV4,
+        DataPointIndexTms5,
+        DataPointIndexV5,
+        DataPointIndexTms6,
+        DataPointIndexV6,
+        DataPointIndexTms7,
+        DataPointIndexV7,
+        DataPointIndexTms8,
+        DataPointIndexV8,
+        DataPointIndexTms9,
+        DataPointIndexV9,
+        DataPointIndexTms10,
+        DataPointIndexV10,
+        DataPointIndexTms11,
+        DataPointIndexV11,
+        DataPointIndexTms12,
+        DataPointIndexV12,
+        DataPointIndexTms13,
+        DataPointIndexV13,
+        DataPointIndexTms14,
+        DataPointIndexV14,
+        DataPointIndexTms15,
+        DataPointIndexV15,
+        DataPointIndexTms16,
+        DataPointIndexV16,
+        DataPointIndexTms17,
+        DataPointIndexV17,
+        DataPointIndexTms18,
+        DataPointIndexV18,
+        DataPointIndexTms19,
+        DataPointIndexV19,
+        DataPointIndexTms20,
+        DataPointIndexV20,
+        DataPointIndexCrvNam,
+        DataPointIndexReadOnly
+    };
+
     explicit SunSpecHvrtxModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecHvrtxModel *parent = nullptr);
     ~SunSpecHvrtxModelRepeatingBlock() override = default;
 
@@ -300,6 +346,21 @@ public:
     Q_DECLARE_FLAGS(ModenaFlags, Modena)
     Q_FLAG(Modena)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexActCrv,
+        DataPointIndexModEna,
+        DataPointIndexWinTms,
+        DataPointIndexRvrtTms,
+        DataPointIndexRmpTms,
+        DataPointIndexNCrv,
+        DataPointIndexNPt,
+        DataPointIndexTmsSf,
+        DataPointIndexVSf,
+        DataPointIndexCrvType
+    };
+
     explicit SunSpecHvrtxModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecHvrtxModel() override; 
 
@@ -354,7 +415,9 @@ private:
     quint16 m_nCrv = 0;
     quint16 m_nPt = 0;
     qint16 m_tmsSf = 0;
+    double m_tmsSfMultiplier = 1;
     qint16 m_vSf = 0;
+    double m_vSfMultiplier = 1;
     Crvtype m_crvType;
 
 
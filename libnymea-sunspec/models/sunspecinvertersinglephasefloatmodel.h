@@ -75,6 +75,42 @@ public:
     Q_DECLARE_FLAGS(Evt1Flags, Evt1)
     Q_FLAG(Evt1)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexAmps,
+        DataPointIndexAmpsPhaseA,
+        DataPointIndexAmpsPhaseB,
+        DataPointIndexAmpsPhaseC,
+        DataPointIndexPhaseVoltageAb,
+        DataPointIndexPhaseVoltageBc,
+        DataPointIndexPhaseVoltageCa,
+        DataPointIndexPhaseVoltageAn,
+        DataPointIndexPhaseVoltageBn,
+        DataPointIndexPhaseVoltageCn,
+        DataPointIndexWatts,
+        DataPointIndexHz,
+        DataPointIndexVa,
+        DataPointIndexVAr,
+        DataPointIndexPf,
+        DataPointIndexWattHours,
+        DataPointIndexDcAmps,
+        DataPointIndexDcVoltage,
+        DataPointIndexDcWatts,
+        DataPointIndexCabinetTemperature,
+        DataPointIndexHeatSinkTemperature,
+        DataPointIndexTransformerTemperature,
+        DataPointIndexOtherTemperature,
+        DataPointIndexOperatingState,
+        DataPointIndexVendorOperatingState,
+        DataPointIndexEvent1,
+        DataPointIndexEventBitfield2,
+        DataPointIndexVendorEventBitfield1,
+        DataPointIndexVendorEventBitfield2,
+        DataPointIndexVendorEventBitfield3,
+        DataPointIndexVendorEventBitfield4
+    };
+
     explicit SunSpecInverterSinglePhaseFloatModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecInverterSinglePhaseFloatModel() override; 
 
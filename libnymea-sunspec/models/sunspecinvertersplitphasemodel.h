@@ -75,6 +75,54 @@ public:
     Q_DECLARE_FLAGS(Evt1Flags, Evt1)
     Q_FLAG(Evt1)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexAmps,
+        DataPointIndexAmpsPhaseA,
+        DataPointIndexAmpsPhaseB,
+        DataPointIndexAmpsPhaseC,
+        DataPointIndexA_SF,
+        DataPointIndexPhaseVoltageAb,
+        DataPointIndexPhaseVoltageBc,
+        DataPointIndexPhaseVoltageCa,
+        DataPointIndexPhaseVoltageAn,
+        DataPointIndexPhaseVoltageBn,
+        DataPointIndexPhaseVoltageCn,
+        DataPointIndexV_SF,
+        DataPointIndexWatts,
+        DataPointIndexW_SF,
+        DataPointIndexHz,
+        DataPointIndexHz_SF,
+        DataPointIndexVa,
+        DataPointIndexVA_SF,
+        DataPointIndexVAr,
+        DataPointIndexVAr_SF,
+        DataPointIndexPf,
+        DataPointIndexPF_SF,
+        DataPointIndexWattHours,
+        DataPointIndexWH_SF,
+        DataPointIndexDcAmps,
+        DataPointIndexDCA_SF,
+        DataPointIndexDcVoltage,
+        DataPointIndexDCV_SF,
+        DataPointIndexDcWatts,
+        DataPointIndexDCW_SF,
+        DataPointIndexCabinetTemperature,
+        DataPointIndexHeatSinkTemperature,
+        DataPointIndexTransformerTemperature,
+        DataPointIndexOtherTemperature,
+        DataPointIndexTmp_SF,
+        DataPointIndexOperatingState,
+        DataPointIndexVendorOperatingState,
+        DataPointIndexEvent1,
+        DataPointIndexEventBitfield2,
+        DataPointIndexVendorEventBitfield1,
+        DataPointIndexVendorEventBitfield2,
+        DataPointIndexVendorEventBitfield3,
+        DataPointIndexVendorEventBitfield4
+    };
+
     explicit SunSpecInverterSplitPhaseModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecInverterSplitPhaseModel() override; 
 
@@ -169,6 +217,7 @@ private:
     float m_ampsPhaseB = 0;
     float m_ampsPhaseC = 0;
     qint16 m_a_SF = 0;
+    double m_a_SFMultiplier = 1;
     float m_phaseVoltageAb = 0;
     float m_phaseVoltageBc = 0;
     float m_phaseVoltageCa = 0;
@@ -176,29 +225,40 @@ private:
     float m_phaseVoltageBn = 0;
     float m_phaseVoltageCn = 0;
     qint16 m_v_SF = 0;
+    double m_v_SFMultiplier = 1;
     float m_watts = 0;
     qint16 m_w_SF = 0;
+    double m_w_SFMultiplier = 1;
     float m_hz = 0;
     qint16 m_hz_SF = 0;
+    double m_hz_SFMultiplier = 1;
     float m_va = 0;
     qint16 m_vA_SF = 0;
+    double m_vA_SFMultiplier = 1;
     float m_vAr = 0;
     qint16 m_vAr_SF = 0;
+    double m_vAr_SFMultiplier = 1;
     float m_pf = 0;
     qint16 m_pF_SF = 0;
+    double m_pF_SFMultiplier = 1;
     quint32 m_wattHours = 0;
     qint16 m_wH_SF = 0;
+    double m_wH_SFMultiplier = 1;
     float m_dcAmps = 0;
     qint16 m_dCA_SF = 0;
+    double m_dCA_SFMultiplier = 1;
     float m_dcVoltage = 0;
     qint16 m_dCV_SF = 0;
+    double m_dCV_SFMultiplier = 1;
     float m_dcWatts = 0;
     qint16 m_dCW_SF = 0;
+    double m_dCW_SFMultiplier = 1;
     float m_cabinetTemperature = 0;
     float m_heatSinkTemperature = 0;
     float m_transformerTemperature = 0;
     float m_otherTemperature = 0;
     qint16 m_tmp_SF = 0;
+    double m_tmp_SFMultiplier = 1;
     St m_operatingState;
     quint16 m_vendorOperatingState = 0;
     Evt1Flags m_event1;
@@ -31,6 +31,19 @@
 #include "sunspecirradiancemodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata repeatingBlockDataPointMetadata[] = {
+    // DataPointIndexGhi
+    { "GHI", "GHI", "Global Horizontal Irradiance", nullptr, "W/m2", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 0, 0, 1 },
+    // DataPointIndexPoai
+    { "POAI", "POAI", "Plane-of-Array Irradiance", nullptr, "W/m2", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 1, 0, 1 },
+    // DataPointIndexDfi
+    { "DFI", "DFI", "Diffuse Irradiance", nullptr, "W/m2", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 2, 0, 1 },
+    // DataPointIndexDni
+    { "DNI", "DNI", "Direct Normal Irradiance", nullptr, "W/m2", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 3, 1, 1 },
+    // DataPointIndexOti
+    { "OTI", "OTI", "Other Irradiance", nullptr, "W/m2", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 4, 2, 1 }
+};
+
 SunSpecIrradianceModelRepeatingBlock::SunSpecIrradianceModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecIrradianceModel *parent) :
     SunSpecModelRepeatingBlock(blockIndex, blockSize, modbusStartRegister, parent)
 {
@@ -71,91 +84,45 @@ quint16 SunSpecIrradianceModelRepeatingBlock::oti() const
 
 void SunSpecIrradianceModelRepeatingBlock::initDataPoints()
 {
-    SunSpecDataPoint ghiDataPoint;
-    ghiDataPoint.setName("GHI");
-    ghiDataPoint.setLabel("GHI");
-    ghiDataPoint.setDescription("Global Horizontal Irradiance");
-    ghiDataPoint.setUnits("W/m2");
-    ghiDataPoint.setSize(1);
-    ghiDataPoint.setAddressOffset(0);
-    ghiDataPoint.setSunSpecDataType("uint16");
-    ghiDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ghiDataPoint.name(), ghiDataPoint);
-
-    SunSpecDataPoint poaiDataPoint;
-    poaiDataPoint.setName("POAI");
-    poaiDataPoint.setLabel("POAI");
-    poaiDataPoint.setDescription("Plane-of-Array Irradiance");
-    poaiDataPoint.setUnits("W/m2");
-    poaiDataPoint.setSize(1);
-    poaiDataPoint.setAddressOffset(1);
-    poaiDataPoint.setSunSpecDataType("uint16");
-    poaiDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(poaiDataPoint.name(), poaiDataPoint);
-
-    SunSpecDataPoint dfiDataPoint;
-    dfiDataPoint.setName("DFI");
-    dfiDataPoint.setLabel("DFI");
-    dfiDataPoint.setDescription("Diffuse Irradiance");
-    dfiDataPoint.setUnits("W/m2");
-    dfiDataPoint.setSize(1);
-    dfiDataPoint.setAddressOffset(2);
-    dfiDataPoint.setBlockOffset(0);
-    dfiDataPoint.setSunSpecDataType("uint16");
-    dfiDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(dfiDataPoint.name(), dfiDataPoint);
-
-    SunSpecDataPoint dniDataPoint;
-    dniDataPoint.setName("DNI");
-    dniDataPoint.setLabel("DNI");
-    dniDataPoint.setDescription("Direct Normal Irradiance");
-    dniDataPoint.setUnits("W/m2");
-    dniDataPoint.setSize(1);
-    dniDataPoint.setAddressOffset(3);
-    dniDataPoint.setBlockOffset(1);
-    dniDataPoint.setSunSpecDataType("uint16");
-    dniDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(dniDataPoint.name(), dniDataPoint);
-
-    SunSpecDataPoint otiDataPoint;
-    otiDataPoint.setName("OTI");
-    otiDataPoint.setLabel("OTI");
-    otiDataPoint.setDescription("Other Irradiance");
-    otiDataPoint.setUnits("W/m2");
-    otiDataPoint.setSize(1);
-    otiDataPoint.setAddressOffset(4);
-    otiDataPoint.setBlockOffset(2);
-    otiDataPoint.setSunSpecDataType("uint16");
-    otiDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(otiDataPoint.name(), otiDataPoint);
-
+    m_dataPointMetadata = repeatingBlockDataPointMetadata;
+    m_dataPointCount = 5;
 }
 
 void SunSpecIrradianceModelRepeatingBlock::processBlockData(const QVector<quint16> blockData)
 {
     m_blockData = blockData;
 
+    const quint16 *registers = m_blockData.constData();
+    const int registerCount = m_blockData.count();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("GHI").isValid())
-        m_ghi = m_dataPoints.value("GHI").toUInt16();
+    if (registerCount >= 1 && SunSpecDataPoint::isValid(registers + 0, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_ghi = SunSpecDataPoint::convertToUInt16(registers + 0, 1);
 
-    if (m_dataPoints.value("POAI").isValid())
-        m_poai = m_dataPoints.value("POAI").toUInt16();
+    if (registerCount >= 2 && SunSpecDataPoint::isValid(registers + 1, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_poai = SunSpecDataPoint::convertToUInt16(registers + 1, 1);
 
-    if (m_dataPoints.value("DFI").isValid())
-        m_dfi = m_dataPoints.value("DFI").toUInt16();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_dfi = SunSpecDataPoint::convertToUInt16(registers + 2, 1);
 
-    if (m_dataPoints.value("DNI").isValid())
-        m_dni = m_dataPoints.value("DNI").toUInt16();
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_dni = SunSpecDataPoint::convertToUInt16(registers + 3, 1);
 
-    if (m_dataPoints.value("OTI").isValid())
-        m_oti = m_dataPoints.value("OTI").toUInt16();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_oti = SunSpecDataPoint::convertToUInt16(registers + 4, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
 }
 
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 }
+};
+
 SunSpecIrradianceModel::SunSpecIrradianceModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 302, modelLength, byteOrder, parent)
 {
@@ -186,32 +153,15 @@ QString SunSpecIrradianceModel::label() const
 
 void SunSpecIrradianceModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 2;
 }
 
 void SunSpecIrradianceModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Update properties according to the data point type
 
     qCDebug(dcSunSpecModelData()) << this;
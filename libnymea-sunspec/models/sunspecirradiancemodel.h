@@ -44,6 +44,14 @@ class SunSpecIrradianceModelRepeatingBlock : public SunSpecModelRepeatingBlock
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexGhi = 0,
+        DataPointIndexPoai,
+        DataPointIndexDfi,
+        DataPointIndexDni,
+        DataPointIndexOti
+    };
+
     explicit SunSpecIrradianceModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecIrradianceModel *parent = nullptr);
     ~SunSpecIrradianceModelRepeatingBlock() override = default;
 
@@ -84,6 +92,11 @@ class SunSpecIrradianceModel : public SunSpecModel
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength
+    };
+
     explicit SunSpecIrradianceModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecIrradianceModel() override; 
 
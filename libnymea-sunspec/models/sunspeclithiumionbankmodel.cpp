@@ -31,6 +31,61 @@
 #include "sunspeclithiumionbankmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata repeatingBlockDataPointMetadata[] = {
+    // DataPointIndexModuleCount
+    { "StrNMod", "Module Count", "Count of modules in the string.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexStringStatus
+    { "StrSt", "String Status", "Current status of the string.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 2 },
+    // DataPointIndexConnectionFailureReason
+    { "StrConFail", "Connection Failure Reason", nullptr, nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, false, 3, 1, 1 },
+    // DataPointIndexStringStateOfCharge
+    { "StrSoC", "String State of Charge", "Battery string state of charge, expressed as a percentage.", nullptr, "%", "uint16", "SoC_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 4, 2, 1 },
+    // DataPointIndexStringStateOfHealth
+    { "StrSoH", "String State of Health", "Battery string state of health, expressed as a percentage.", nullptr, "%", "uint16", "SoH_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 5, 3, 1 },
+    // DataPointIndexStringCurrent
+    { "StrA", "String Current", "String current measurement.", nullptr, "A", "int16", "A_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 6, 4, 1 },
+    // DataPointIndexMaxCellVoltage
+    { "StrCellVMax", "Max Cell Voltage", "Maximum voltage for all cells in the string.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 7, 5, 1 },
+    // DataPointIndexMaxCellVoltageModule
+    { "StrCellVMaxMod", "Max Cell Voltage Module", "Module containing the maximum cell voltage.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 8, 6, 1 },
+    // DataPointIndexMinCellVoltage
+    { "StrCellVMin", "Min Cell Voltage", "Minimum voltage for all cells in the string.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 9, 7, 1 },
+    // DataPointIndexMinCellVoltageModule
+    { "StrCellVMinMod", "Min Cell Voltage Module", "Module containing the minimum cell voltage.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 10, 8, 1 },
+    // DataPointIndexAverageCellVoltage
+    { "StrCellVAvg", "Average Cell Voltage", "Average voltage for all cells in the string.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 11, 9, 1 },
+    // DataPointIndexMaxModuleTemperature
+    { "StrModTmpMax", "Max Module Temperature", "Maximum temperature for all modules in the bank.", nullptr, "C", "int16", "ModTmp_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 12, 10, 1 },
+    // DataPointIndexMaxModuleTemperatureModule
+    { "StrModTmpMaxMod", "Max Module Temperature Module", "Module with the maximum temperature.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 13, 11, 1 },
+    // DataPointIndexMinModuleTemperature
+    { "StrModTmpMin", "Min Module Temperature", "Minimum temperature for all modules in the bank.", nullptr, "C", "int16", "ModTmp_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 14, 12, 1 },
+    // DataPointIndexMinModuleTemperatureModule
+    { "StrModTmpMinMod", "Min Module Temperature Module", "Module with the minimum temperature.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 15, 13, 1 },
+    // DataPointIndexAverageModuleTemperature
+    { "StrModTmpAvg", "Average Module Temperature", "Average temperature for all modules in the bank.", nullptr, "C", "int16", "ModTmp_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 16, 14, 1 },
+    // DataPointIndexDisabledReason
+    { "StrDisRsn", "Disabled Reason", "Reason why the string is currently disabled.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, false, 17, 15, 1 },
+    // DataPointIndexContactorStatus
+    { "StrConSt", "Contactor Status", "Status of the contactor(s) for the string.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 18, 16, 2 },
+    // DataPointIndexStringEvent1
+    { "StrEvt1", "String Event 1", "Alarms, warnings and status values.  Bit flags.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, true, 20, 18, 2 },
+    // DataPointIndexStringEvent2
+    { "StrEvt2", "String Event 2", "Alarms, warnings and status values.  Bit flags.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 22, 20, 2 },
+    // DataPointIndexVendorStringEventBitfield1
+    { "StrEvtVnd1", "Vendor String Event Bitfield 1", "Vendor defined events.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 24, 22, 2 },
+    // DataPointIndexVendorStringEventBitfield2
+    { "StrEvtVnd2", "Vendor String Event Bitfield 2", "Vendor defined events.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 26, 24, 2 },
+    // DataPointIndexEnableDisableString
+    { "StrSetEna", "Enable/Disable String", "Enables and disables the string.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, false, 28, 26, 1 },
+    // DataPointIndexConnectDisconnectString
+    { "StrSetCon", "Connect/Disconnect String", "Connects and disconnects the string.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, false, 29, 27, 1 },
+    // DataPointIndexPad1
+    { "Pad1", "Pad", "Pad register.", nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, true, 30, 28, 1 },
+    // DataPointIndexPad2
+    { "Pad2", "Pad", "Pad register.", nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, true, 31, 29, 1 }
+};
+
 SunSpecLithiumIonBankModelRepeatingBlock::SunSpecLithiumIonBankModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecLithiumIonBankModel *parent) :
     SunSpecModelRepeatingBlock(blockIndex, blockSize, modbusStartRegister, parent)
 {
@@ -143,7 +198,7 @@ SunSpecLithiumIonBankModelRepeatingBlock::Strsetena SunSpecLithiumIonBankModelRe
 
 QModbusReply *SunSpecLithiumIonBankModelRepeatingBlock::setEnableDisableString(Strsetena enableDisableString)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("StrSetEna");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexEnableDisableString]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(enableDisableString));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -159,7 +214,7 @@ SunSpecLithiumIonBankModelRepeatingBlock::Strsetcon SunSpecLithiumIonBankModelRe
 
 QModbusReply *SunSpecLithiumIonBankModelRepeatingBlock::setConnectDisconnectString(Strsetcon connectDisconnectString)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("StrSetCon");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexConnectDisconnectString]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(connectDisconnectString));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -179,412 +234,160 @@ quint16 SunSpecLithiumIonBankModelRepeatingBlock::pad2() const
 
 void SunSpecLithiumIonBankModelRepeatingBlock::initDataPoints()
 {
-    SunSpecDataPoint moduleCountDataPoint;
-    moduleCountDataPoint.setName("StrNMod");
-    moduleCountDataPoint.setLabel("Module Count");
-    moduleCountDataPoint.setDescription("Count of modules in the string.");
-    moduleCountDataPoint.setMandatory(true);
-    moduleCountDataPoint.setSize(1);
-    moduleCountDataPoint.setAddressOffset(0);
-    moduleCountDataPoint.setSunSpecDataType("uint16");
-    moduleCountDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(moduleCountDataPoint.name(), moduleCountDataPoint);
-
-    SunSpecDataPoint stringStatusDataPoint;
-    stringStatusDataPoint.setName("StrSt");
-    stringStatusDataPoint.setLabel("String Status");
-    stringStatusDataPoint.setDescription("Current status of the string.");
-    stringStatusDataPoint.setMandatory(true);
-    stringStatusDataPoint.setSize(2);
-    stringStatusDataPoint.setAddressOffset(1);
-    stringStatusDataPoint.setSunSpecDataType("bitfield32");
-    stringStatusDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringStatusDataPoint.name(), stringStatusDataPoint);
-
-    SunSpecDataPoint connectionFailureReasonDataPoint;
-    connectionFailureReasonDataPoint.setName("StrConFail");
-    connectionFailureReasonDataPoint.setLabel("Connection Failure Reason");
-    connectionFailureReasonDataPoint.setSize(1);
-    connectionFailureReasonDataPoint.setAddressOffset(3);
-    connectionFailureReasonDataPoint.setBlockOffset(1);
-    connectionFailureReasonDataPoint.setSunSpecDataType("enum16");
-    connectionFailureReasonDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(connectionFailureReasonDataPoint.name(), connectionFailureReasonDataPoint);
-
-    SunSpecDataPoint stringStateOfChargeDataPoint;
-    stringStateOfChargeDataPoint.setName("StrSoC");
-    stringStateOfChargeDataPoint.setLabel("String State of Charge");
-    stringStateOfChargeDataPoint.setDescription("Battery string state of charge, expressed as a percentage.");
-    stringStateOfChargeDataPoint.setUnits("%");
-    stringStateOfChargeDataPoint.setMandatory(true);
-    stringStateOfChargeDataPoint.setSize(1);
-    stringStateOfChargeDataPoint.setAddressOffset(4);
-    stringStateOfChargeDataPoint.setBlockOffset(2);
-    stringStateOfChargeDataPoint.setScaleFactorName("SoC_SF");
-    stringStateOfChargeDataPoint.setSunSpecDataType("uint16");
-    stringStateOfChargeDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringStateOfChargeDataPoint.name(), stringStateOfChargeDataPoint);
-
-    SunSpecDataPoint stringStateOfHealthDataPoint;
-    stringStateOfHealthDataPoint.setName("StrSoH");
-    stringStateOfHealthDataPoint.setLabel("String State of Health");
-    stringStateOfHealthDataPoint.setDescription("Battery string state of health, expressed as a percentage.");
-    stringStateOfHealthDataPoint.setUnits("%");
-    stringStateOfHealthDataPoint.setSize(1);
-    stringStateOfHealthDataPoint.setAddressOffset(5);
-    stringStateOfHealthDataPoint.setBlockOffset(3);
-    stringStateOfHealthDataPoint.setScaleFactorName("SoH_SF");
-    stringStateOfHealthDataPoint.setSunSpecDataType("uint16");
-    stringStateOfHealthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringStateOfHealthDataPoint.name(), stringStateOfHealthDataPoint);
-
-    SunSpecDataPoint stringCurrentDataPoint;
-    stringCurrentDataPoint.setName("StrA");
-    stringCurrentDataPoint.setLabel("String Current");
-    stringCurrentDataPoint.setDescription("String current measurement.");
-    stringCurrentDataPoint.setUnits("A");
-    stringCurrentDataPoint.setMandatory(true);
-    stringCurrentDataPoint.setSize(1);
-    stringCurrentDataPoint.setAddressOffset(6);
-    stringCurrentDataPoint.setBlockOffset(4);
-    stringCurrentDataPoint.setScaleFactorName("A_SF");
-    stringCurrentDataPoint.setSunSpecDataType("int16");
-    stringCurrentDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringCurrentDataPoint.name(), stringCurrentDataPoint);
-
-    SunSpecDataPoint maxCellVoltageDataPoint;
-    maxCellVoltageDataPoint.setName("StrCellVMax");
-    maxCellVoltageDataPoint.setLabel("Max Cell Voltage");
-    maxCellVoltageDataPoint.setDescription("Maximum voltage for all cells in the string.");
-    maxCellVoltageDataPoint.setUnits("V");
-    maxCellVoltageDataPoint.setMandatory(true);
-    maxCellVoltageDataPoint.setSize(1);
-    maxCellVoltageDataPoint.setAddressOffset(7);
-    maxCellVoltageDataPoint.setBlockOffset(5);
-    maxCellVoltageDataPoint.setScaleFactorName("CellV_SF");
-    maxCellVoltageDataPoint.setSunSpecDataType("uint16");
-    maxCellVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxCellVoltageDataPoint.name(), maxCellVoltageDataPoint);
-
-    SunSpecDataPoint maxCellVoltageModuleDataPoint;
-    maxCellVoltageModuleDataPoint.setName("StrCellVMaxMod");
-    maxCellVoltageModuleDataPoint.setLabel("Max Cell Voltage Module");
-    maxCellVoltageModuleDataPoint.setDescription("Module containing the maximum cell voltage.");
-    maxCellVoltageModuleDataPoint.setSize(1);
-    maxCellVoltageModuleDataPoint.setAddressOffset(8);
-    maxCellVoltageModuleDataPoint.setBlockOffset(6);
-    maxCellVoltageModuleDataPoint.setSunSpecDataType("uint16");
-    maxCellVoltageModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxCellVoltageModuleDataPoint.name(), maxCellVoltageModuleDataPoint);
-
-    SunSpecDataPoint minCellVoltageDataPoint;
-    minCellVoltageDataPoint.setName("StrCellVMin");
-    minCellVoltageDataPoint.setLabel("Min Cell Voltage");
-    minCellVoltageDataPoint.setDescription("Minimum voltage for all cells in the string.");
-    minCellVoltageDataPoint.setUnits("V");
-    minCellVoltageDataPoint.setMandatory(true);
-    minCellVoltageDataPoint.setSize(1);
-    minCellVoltageDataPoint.setAddressOffset(9);
-    minCellVoltageDataPoint.setBlockOffset(7);
-    minCellVoltageDataPoint.setScaleFactorName("CellV_SF");
-    minCellVoltageDataPoint.setSunSpecDataType("uint16");
-    minCellVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minCellVoltageDataPoint.name(), minCellVoltageDataPoint);
-
-    SunSpecDataPoint minCellVoltageModuleDataPoint;
-    minCellVoltageModuleDataPoint.setName("StrCellVMinMod");
-    minCellVoltageModuleDataPoint.setLabel("Min Cell Voltage Module");
-    minCellVoltageModuleDataPoint.setDescription("Module containing the minimum cell voltage.");
-    minCellVoltageModuleDataPoint.setSize(1);
-    minCellVoltageModuleDataPoint.setAddressOffset(10);
-    minCellVoltageModuleDataPoint.setBlockOffset(8);
-    minCellVoltageModuleDataPoint.setSunSpecDataType("uint16");
-    minCellVoltageModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minCellVoltageModuleDataPoint.name(), minCellVoltageModuleDataPoint);
-
-    SunSpecDataPoint averageCellVoltageDataPoint;
-    averageCellVoltageDataPoint.setName("StrCellVAvg");
-    averageCellVoltageDataPoint.setLabel("Average Cell Voltage");
-    averageCellVoltageDataPoint.setDescription("Average voltage for all cells in the string.");
-    averageCellVoltageDataPoint.setUnits("V");
-    averageCellVoltageDataPoint.setMandatory(true);
-    averageCellVoltageDataPoint.setSize(1);
-    averageCellVoltageDataPoint.setAddressOffset(11);
-    averageCellVoltageDataPoint.setBlockOffset(9);
-    averageCellVoltageDataPoint.setScaleFactorName("CellV_SF");
-    averageCellVoltageDataPoint.setSunSpecDataType("uint16");
-    averageCellVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(averageCellVoltageDataPoint.name(), averageCellVoltageDataPoint);
-
-    SunSpecDataPoint maxModuleTemperatureDataPoint;
-    maxModuleTemperatureDataPoint.setName("StrModTmpMax");
-    maxModuleTemperatureDataPoint.setLabel("Max Module Temperature");
-    maxModuleTemperatureDataPoint.setDescription("Maximum temperature for all modules in the bank.");
-    maxModuleTemperatureDataPoint.setUnits("C");
-    maxModuleTemperatureDataPoint.setMandatory(true);
-    maxModuleTemperatureDataPoint.setSize(1);
-    maxModuleTemperatureDataPoint.setAddressOffset(12);
-    maxModuleTemperatureDataPoint.setBlockOffset(10);
-    maxModuleTemperatureDataPoint.setScaleFactorName("ModTmp_SF");
-    maxModuleTemperatureDataPoint.setSunSpecDataType("int16");
-    maxModuleTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxModuleTemperatureDataPoint.name(), maxModuleTemperatureDataPoint);
-
-    SunSpecDataPoint maxModuleTemperatureModuleDataPoint;
-    maxModuleTemperatureModuleDataPoint.setName("StrModTmpMaxMod");
-    maxModuleTemperatureModuleDataPoint.setLabel("Max Module Temperature Module");
-    maxModuleTemperatureModuleDataPoint.setDescription("Module with the maximum temperature.");
-    maxModuleTemperatureModuleDataPoint.setSize(1);
-    maxModuleTemperatureModuleDataPoint.setAddressOffset(13);
-    maxModuleTemperatureModuleDataPoint.setBlockOffset(11);
-    maxModuleTemperatureModuleDataPoint.setSunSpecDataType("uint16");
-    maxModuleTemperatureModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxModuleTemperatureModuleDataPoint.name(), maxModuleTemperatureModuleDataPoint);
-
-    SunSpecDataPoint minModuleTemperatureDataPoint;
-    minModuleTemperatureDataPoint.setName("StrModTmpMin");
-    minModuleTemperatureDataPoint.setLabel("Min Module Temperature");
-    minModuleTemperatureDataPoint.setDescription("Minimum temperature for all modules in the bank.");
-    minModuleTemperatureDataPoint.setUnits("C");
-    minModuleTemperatureDataPoint.setMandatory(true);
-    minModuleTemperatureDataPoint.setSize(1);
-    minModuleTemperatureDataPoint.setAddressOffset(14);
-    minModuleTemperatureDataPoint.setBlockOffset(12);
-    minModuleTemperatureDataPoint.setScaleFactorName("ModTmp_SF");
-    minModuleTemperatureDataPoint.setSunSpecDataType("int16");
-    minModuleTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minModuleTemperatureDataPoint.name(), minModuleTemperatureDataPoint);
-
-    SunSpecDataPoint minModuleTemperatureModuleDataPoint;
-    minModuleTemperatureModuleDataPoint.setName("StrModTmpMinMod");
-    minModuleTemperatureModuleDataPoint.setLabel("Min Module Temperature Module");
-    minModuleTemperatureModuleDataPoint.setDescription("Module with the minimum temperature.");
-    minModuleTemperatureModuleDataPoint.setSize(1);
-    minModuleTemperatureModuleDataPoint.setAddressOffset(15);
-    minModuleTemperatureModuleDataPoint.setBlockOffset(13);
-    minModuleTemperatureModuleDataPoint.setSunSpecDataType("uint16");
-    minModuleTemperatureModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minModuleTemperatureModuleDataPoint.name(), minModuleTemperatureModuleDataPoint);
-
-    SunSpecDataPoint averageModuleTemperatureDataPoint;
-    averageModuleTemperatureDataPoint.setName("StrModTmpAvg");
-    averageModuleTemperatureDataPoint.setLabel("Average Module Temperature");
-    averageModuleTemperatureDataPoint.setDescription("Average temperature for all modules in the bank.");
-    averageModuleTemperatureDataPoint.setUnits("C");
-    averageModuleTemperatureDataPoint.setMandatory(true);
-    averageModuleTemperatureDataPoint.setSize(1);
-    averageModuleTemperatureDataPoint.setAddressOffset(16);
-    averageModuleTemperatureDataPoint.setBlockOffset(14);
-    averageModuleTemperatureDataPoint.setScaleFactorName("ModTmp_SF");
-    averageModuleTemperatureDataPoint.setSunSpecDataType("int16");
-    averageModuleTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(averageModuleTemperatureDataPoint.name(), averageModuleTemperatureDataPoint);
-
-    SunSpecDataPoint disabledReasonDataPoint;
-    disabledReasonDataPoint.setName("StrDisRsn");
-    disabledReasonDataPoint.setLabel("Disabled Reason");
-    disabledReasonDataPoint.setDescription("Reason why the string is currently disabled.");
-    disabledReasonDataPoint.setSize(1);
-    disabledReasonDataPoint.setAddressOffset(17);
-    disabledReasonDataPoint.setBlockOffset(15);
-    disabledReasonDataPoint.setSunSpecDataType("enum16");
-    disabledReasonDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(disabledReasonDataPoint.name(), disabledReasonDataPoint);
-
-    SunSpecDataPoint contactorStatusDataPoint;
-    contactorStatusDataPoint.setName("StrConSt");
-    contactorStatusDataPoint.setLabel("Contactor Status");
-    contactorStatusDataPoint.setDescription("Status of the contactor(s) for the string.");
-    contactorStatusDataPoint.setSize(2);
-    contactorStatusDataPoint.setAddressOffset(18);
-    contactorStatusDataPoint.setBlockOffset(16);
-    contactorStatusDataPoint.setSunSpecDataType("bitfield32");
-    contactorStatusDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(contactorStatusDataPoint.name(), contactorStatusDataPoint);
-
-    SunSpecDataPoint stringEvent1DataPoint;
-    stringEvent1DataPoint.setName("StrEvt1");
-    stringEvent1DataPoint.setLabel("String Event 1");
-    stringEvent1DataPoint.setDescription("Alarms, warnings and status values.  Bit flags.");
-    stringEvent1DataPoint.setMandatory(true);
-    stringEvent1DataPoint.setSize(2);
-    stringEvent1DataPoint.setAddressOffset(20);
-    stringEvent1DataPoint.setBlockOffset(18);
-    stringEvent1DataPoint.setSunSpecDataType("bitfield32");
-    stringEvent1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringEvent1DataPoint.name(), stringEvent1DataPoint);
-
-    SunSpecDataPoint stringEvent2DataPoint;
-    stringEvent2DataPoint.setName("StrEvt2");
-    stringEvent2DataPoint.setLabel("String Event 2");
-    stringEvent2DataPoint.setDescription("Alarms, warnings and status values.  Bit flags.");
-    stringEvent2DataPoint.setSize(2);
-    stringEvent2DataPoint.setAddressOffset(22);
-    stringEvent2DataPoint.setBlockOffset(20);
-    stringEvent2DataPoint.setSunSpecDataType("bitfield32");
-    stringEvent2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringEvent2DataPoint.name(), stringEvent2DataPoint);
-
-    SunSpecDataPoint vendorStringEventBitfield1DataPoint;
-    vendorStringEventBitfield1DataPoint.setName("StrEvtVnd1");
-    vendorStringEventBitfield1DataPoint.setLabel("Vendor String Event Bitfield 1");
-    vendorStringEventBitfield1DataPoint.setDescription("Vendor defined events.");
-    vendorStringEventBitfield1DataPoint.setSize(2);
-    vendorStringEventBitfield1DataPoint.setAddressOffset(24);
-    vendorStringEventBitfield1DataPoint.setBlockOffset(22);
-    vendorStringEventBitfield1DataPoint.setSunSpecDataType("bitfield32");
-    vendorStringEventBitfield1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vendorStringEventBitfield1DataPoint.name(), vendorStringEventBitfield1DataPoint);
-
-    SunSpecDataPoint vendorStringEventBitfield2DataPoint;
-    vendorStringEventBitfield2DataPoint.setName("StrEvtVnd2");
-    vendorStringEventBitfield2DataPoint.setLabel("Vendor String Event Bitfield 2");
-    vendorStringEventBitfield2DataPoint.setDescription("Vendor defined events.");
-    vendorStringEventBitfield2DataPoint.setSize(2);
-    vendorStringEventBitfield2DataPoint.setAddressOffset(26);
-    vendorStringEventBitfield2DataPoint.setBlockOffset(24);
-    vendorStringEventBitfield2DataPoint.setSunSpecDataType("bitfield32");
-    vendorStringEventBitfield2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vendorStringEventBitfield2DataPoint.name(), vendorStringEventBitfield2DataPoint);
-
-    SunSpecDataPoint enableDisableStringDataPoint;
-    enableDisableStringDataPoint.setName("StrSetEna");
-    enableDisableStringDataPoint.setLabel("Enable/Disable String");
-    enableDisableStringDataPoint.setDescription("Enables and disables the string.");
-    enableDisableStringDataPoint.setSize(1);
-    enableDisableStringDataPoint.setAddressOffset(28);
-    enableDisableStringDataPoint.setBlockOffset(26);
-    enableDisableStringDataPoint.setSunSpecDataType("enum16");
-    enableDisableStringDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    enableDisableStringDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(enableDisableStringDataPoint.name(), enableDisableStringDataPoint);
-
-    SunSpecDataPoint connectDisconnectStringDataPoint;
-    connectDisconnectStringDataPoint.setName("StrSetCon");
-    connectDisconnectStringDataPoint.setLabel("Connect/Disconnect String");
-    connectDisconnectStringDataPoint.setDescription("Connects and disconnects the string.");
-    connectDisconnectStringDataPoint.setSize(1);
-    connectDisconnectStringDataPoint.setAddressOffset(29);
-    connectDisconnectStringDataPoint.setBlockOffset(27);
-    connectDisconnectStringDataPoint.setSunSpecDataType("enum16");
-    connectDisconnectStringDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    connectDisconnectStringDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(connectDisconnectStringDataPoint.name(), connectDisconnectStringDataPoint);
-
-    SunSpecDataPoint pad1DataPoint;
-    pad1DataPoint.setName("Pad1");
-    pad1DataPoint.setLabel("Pad");
-    pad1DataPoint.setDescription("Pad register.");
-    pad1DataPoint.setMandatory(true);
-    pad1DataPoint.setSize(1);
-    pad1DataPoint.setAddressOffset(30);
-    pad1DataPoint.setBlockOffset(28);
-    pad1DataPoint.setSunSpecDataType("pad");
-    pad1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pad1DataPoint.name(), pad1DataPoint);
-
-    SunSpecDataPoint pad2DataPoint;
-    pad2DataPoint.setName("Pad2");
-    pad2DataPoint.setLabel("Pad");
-    pad2DataPoint.setDescription("Pad register.");
-    pad2DataPoint.setMandatory(true);
-    pad2DataPoint.setSize(1);
-    pad2DataPoint.setAddressOffset(31);
-    pad2DataPoint.setBlockOffset(29);
-    pad2DataPoint.setSunSpecDataType("pad");
-    pad2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pad2DataPoint.name(), pad2DataPoint);
-
+    m_dataPointMetadata = repeatingBlockDataPointMetadata;
+    m_dataPointCount = 26;
 }
 
 void SunSpecLithiumIonBankModelRepeatingBlock::processBlockData(const QVector<quint16> blockData)
 {
     m_blockData = blockData;
 
+    const quint16 *registers = m_blockData.constData();
+    const int registerCount = m_blockData.count();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("StrNMod").isValid())
-        m_moduleCount = m_dataPoints.value("StrNMod").toUInt16();
+    if (registerCount >= 1 && SunSpecDataPoint::isValid(registers + 0, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_moduleCount = SunSpecDataPoint::convertToUInt16(registers + 0, 1);
 
-    if (m_dataPoints.value("StrSt").isValid())
-        m_stringStatus = static_cast<StrstFlags>(m_dataPoints.value("StrSt").toUInt32());
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 1, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_stringStatus = static_cast<StrstFlags>(SunSpecDataPoint::convertToUInt32(registers + 1, 2, m_byteOrder));
 
-    if (m_dataPoints.value("StrConFail").isValid())
-        m_connectionFailureReason = static_cast<Strconfail>(m_dataPoints.value("StrConFail").toUInt16());
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_connectionFailureReason = static_cast<Strconfail>(SunSpecDataPoint::convertToUInt16(registers + 3, 1));
 
-    if (m_dataPoints.value("StrSoC").isValid())
-        m_stringStateOfCharge = m_dataPoints.value("StrSoC").toFloatWithSSF(m_parentModel->soC_SF());
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_stringStateOfCharge = SunSpecDataPoint::convertToUInt16(registers + 4, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->soC_SF());
 
-    if (m_dataPoints.value("StrSoH").isValid())
-        m_stringStateOfHealth = m_dataPoints.value("StrSoH").toFloatWithSSF(m_parentModel->soH_SF());
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_stringStateOfHealth = SunSpecDataPoint::convertToUInt16(registers + 5, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->soH_SF());
 
-    if (m_dataPoints.value("StrA").isValid())
-        m_stringCurrent = m_dataPoints.value("StrA").toFloatWithSSF(m_parentModel->a_SF());
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_stringCurrent = SunSpecDataPoint::convertToInt16(registers + 6, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->a_SF());
 
-    if (m_dataPoints.value("StrCellVMax").isValid())
-        m_maxCellVoltage = m_dataPoints.value("StrCellVMax").toFloatWithSSF(m_parentModel->cellV_SF());
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxCellVoltage = SunSpecDataPoint::convertToUInt16(registers + 7, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->cellV_SF());
 
-    if (m_dataPoints.value("StrCellVMaxMod").isValid())
-        m_maxCellVoltageModule = m_dataPoints.value("StrCellVMaxMod").toUInt16();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxCellVoltageModule = SunSpecDataPoint::convertToUInt16(registers + 8, 1);
 
-    if (m_dataPoints.value("StrCellVMin").isValid())
-        m_minCellVoltage = m_dataPoints.value("StrCellVMin").toFloatWithSSF(m_parentModel->cellV_SF());
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minCellVoltage = SunSpecDataPoint::convertToUInt16(registers + 9, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->cellV_SF());
 
-    if (m_dataPoints.value("StrCellVMinMod").isValid())
-        m_minCellVoltageModule = m_dataPoints.value("StrCellVMinMod").toUInt16();
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minCellVoltageModule = SunSpecDataPoint::convertToUInt16(registers + 10, 1);
 
-    if (m_dataPoints.value("StrCellVAvg").isValid())
-        m_averageCellVoltage = m_dataPoints.value("StrCellVAvg").toFloatWithSSF(m_parentModel->cellV_SF());
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_averageCellVoltage = SunSpecDataPoint::convertToUInt16(registers + 11, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->cellV_SF());
 
-    if (m_dataPoints.value("StrModTmpMax").isValid())
-        m_maxModuleTemperature = m_dataPoints.value("StrModTmpMax").toFloatWithSSF(m_parentModel->modTmp_SF());
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 12, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_maxModuleTemperature = SunSpecDataPoint::convertToInt16(registers + 12, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->modTmp_SF());
 
-    if (m_dataPoints.value("StrModTmpMaxMod").isValid())
-        m_maxModuleTemperatureModule = m_dataPoints.value("StrModTmpMaxMod").toUInt16();
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 13, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxModuleTemperatureModule = SunSpecDataPoint::convertToUInt16(registers + 13, 1);
 
-    if (m_dataPoints.value("StrModTmpMin").isValid())
-        m_minModuleTemperature = m_dataPoints.value("StrModTmpMin").toFloatWithSSF(m_parentModel->modTmp_SF());
+    if (registerCount >= 15 && SunSpecDataPoint::isValid(registers + 14, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_minModuleTemperature = SunSpecDataPoint::convertToInt16(registers + 14, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->modTmp_SF());
 
-    if (m_dataPoints.value("StrModTmpMinMod").isValid())
-        m_minModuleTemperatureModule = m_dataPoints.value("StrModTmpMinMod").toUInt16();
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 15, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minModuleTemperatureModule = SunSpecDataPoint::convertToUInt16(registers + 15, 1);
 
-    if (m_dataPoints.value("StrModTmpAvg").isValid())
-        m_averageModuleTemperature = m_dataPoints.value("StrModTmpAvg").toFloatWithSSF(m_parentModel->modTmp_SF());
+    if (registerCount >= 17 && SunSpecDataPoint::isValid(registers + 16, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_averageModuleTemperature = SunSpecDataPoint::convertToInt16(registers + 16, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->modTmp_SF());
 
-    if (m_dataPoints.value("StrDisRsn").isValid())
-        m_disabledReason = static_cast<Strdisrsn>(m_dataPoints.value("StrDisRsn").toUInt16());
+    if (registerCount >= 18 && SunSpecDataPoint::isValid(registers + 17, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_disabledReason = static_cast<Strdisrsn>(SunSpecDataPoint::convertToUInt16(registers + 17, 1));
 
-    if (m_dataPoints.value("StrConSt").isValid())
-        m_contactorStatus = static_cast<StrconstFlags>(m_dataPoints.value("StrConSt").toUInt32());
+    if (registerCount >= 20 && SunSpecDataPoint::isValid(registers + 18, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_contactorStatus = static_cast<StrconstFlags>(SunSpecDataPoint::convertToUInt32(registers + 18, 2, m_byteOrder));
 
-    if (m_dataPoints.value("StrEvt1").isValid())
-        m_stringEvent1 = static_cast<Strevt1Flags>(m_dataPoints.value("StrEvt1").toUInt32());
+    if (registerCount >= 22 && SunSpecDataPoint::isValid(registers + 20, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_stringEvent1 = static_cast<Strevt1Flags>(SunSpecDataPoint::convertToUInt32(registers + 20, 2, m_byteOrder));
 
-    if (m_dataPoints.value("StrEvt2").isValid())
-        m_stringEvent2 = m_dataPoints.value("StrEvt2").toUInt32();
+    if (registerCount >= 24 && SunSpecDataPoint::isValid(registers + 22, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_stringEvent2 = SunSpecDataPoint::convertToUInt32(registers + 22, 2, m_byteOrder);
 
-    if (m_dataPoints.value("StrEvtVnd1").isValid())
-        m_vendorStringEventBitfield1 = m_dataPoints.value("StrEvtVnd1").toUInt32();
+    if (registerCount >= 26 && SunSpecDataPoint::isValid(registers + 24, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_vendorStringEventBitfield1 = SunSpecDataPoint::convertToUInt32(registers + 24, 2, m_byteOrder);
 
-    if (m_dataPoints.value("StrEvtVnd2").isValid())
-        m_vendorStringEventBitfield2 = m_dataPoints.value("StrEvtVnd2").toUInt32();
+    if (registerCount >= 28 && SunSpecDataPoint::isValid(registers + 26, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_vendorStringEventBitfield2 = SunSpecDataPoint::convertToUInt32(registers + 26, 2, m_byteOrder);
 
-    if (m_dataPoints.value("StrSetEna").isValid())
-        m_enableDisableString = static_cast<Strsetena>(m_dataPoints.value("StrSetEna").toUInt16());
+    if (registerCount >= 29 && SunSpecDataPoint::isValid(registers + 28, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_enableDisableString = static_cast<Strsetena>(SunSpecDataPoint::convertToUInt16(registers + 28, 1));
 
-    if (m_dataPoints.value("StrSetCon").isValid())
-        m_connectDisconnectString = static_cast<Strsetcon>(m_dataPoints.value("StrSetCon").toUInt16());
+    if (registerCount >= 30 && SunSpecDataPoint::isValid(registers + 29, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_connectDisconnectString = static_cast<Strsetcon>(SunSpecDataPoint::convertToUInt16(registers + 29, 1));
 
-    if (m_dataPoints.value("Pad1").isValid())
-        m_pad1 = m_dataPoints.value("Pad1").toUInt16();
+    if (registerCount >= 31 && SunSpecDataPoint::isValid(registers + 30, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad1 = SunSpecDataPoint::convertToUInt16(registers + 30, 1);
 
-    if (m_dataPoints.value("Pad2").isValid())
-        m_pad2 = m_dataPoints.value("Pad2").toUInt16();
+    if (registerCount >= 32 && SunSpecDataPoint::isValid(registers + 31, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad2 = SunSpecDataPoint::convertToUInt16(registers + 31, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
 }
 
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexStringCount
+    { "NStr", "String Count", "Number of strings in the bank.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 2, 0, 1 },
+    // DataPointIndexConnectedStringCount
+    { "NStrCon", "Connected String Count", "Number of strings with contactor closed.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 3, 1, 1 },
+    // DataPointIndexMaxModuleTemperature
+    { "ModTmpMax", "Max Module Temperature", "Maximum temperature for all modules in the bank.", nullptr, nullptr, "int16", "ModTmp_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 4, 2, 1 },
+    // DataPointIndexMaxModuleTemperatureString
+    { "ModTmpMaxStr", "Max Module Temperature String", "String containing the module with maximum temperature.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 5, 3, 1 },
+    // DataPointIndexMaxModuleTemperatureModule
+    { "ModTmpMaxMod", "Max Module Temperature Module", "Module with maximum temperature.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 6, 4, 1 },
+    // DataPointIndexMinModuleTemperature
+    { "ModTmpMin", "Min Module Temperature", "Minimum temperature for all modules in the bank.", nullptr, "C", "int16", "ModTmp_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 7, 5, 1 },
+    // DataPointIndexMinModuleTemperatureString
+    { "ModTmpMinStr", "Min Module Temperature String", "String containing the module with minimum temperature.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 8, 6, 1 },
+    // DataPointIndexMinModuleTemperatureModule
+    { "ModTmpMinMod", "Min Module Temperature Module", "Module with minimum temperature.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 9, 7, 1 },
+    // DataPointIndexAverageModuleTemperature
+    { "ModTmpAvg", "Average Module Temperature", "Average temperature for all modules in the bank.", nullptr, nullptr, "int16", nullptr, SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 10, 8, 1 },
+    // DataPointIndexMaxStringVoltage
+    { "StrVMax", "Max String Voltage", "Maximum string voltage for all strings in the bank.", nullptr, "V", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 11, 9, 1 },
+    // DataPointIndexMaxStringVoltageString
+    { "StrVMaxStr", "Max String Voltage String", "String with maximum voltage.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 12, 10, 1 },
+    // DataPointIndexMinStringVoltage
+    { "StrVMin", "Min String Voltage", "Minimum string voltage for all strings in the bank.", nullptr, "V", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 13, 11, 1 },
+    // DataPointIndexMinStringVoltageString
+    { "StrVMinStr", "Min String Voltage String", "String with minimum voltage.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 14, 12, 1 },
+    // DataPointIndexAverageStringVoltage
+    { "StrVAvg", "Average String Voltage", "Average string voltage for all strings in the bank.", nullptr, "V", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 15, 13, 1 },
+    // DataPointIndexMaxStringCurrent
+    { "StrAMax", "Max String Current", "Maximum current of any string in the bank.", nullptr, "A", "int16", "A_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 16, 14, 1 },
+    // DataPointIndexMaxStringCurrentString
+    { "StrAMaxStr", "Max String Current String", "String with the maximum current.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 17, 15, 1 },
+    // DataPointIndexMinStringCurrent
+    { "StrAMin", "Min String Current", "Minimum current of any string in the bank.", nullptr, "A", "int16", "A_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 18, 16, 1 },
+    // DataPointIndexMinStringCurrentString
+    { "StrAMinStr", "Min String Current String", "String with the minimum current.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 19, 17, 1 },
+    // DataPointIndexAverageStringCurrent
+    { "StrAAvg", "Average String Current", "Average string current for all strings in the bank.", nullptr, "A", "int16", "A_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 20, 18, 1 },
+    // DataPointIndexBatteryCellBalancingCount
+    { "NCellBal", "Battery Cell Balancing Count", "Total number of cells that are currently being balanced.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 21, 19, 1 },
+    // DataPointIndexCellV_SF
+    { "CellV_SF", nullptr, "Scale factor for cell voltage.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 22, 20, 1 },
+    // DataPointIndexModTmp_SF
+    { "ModTmp_SF", nullptr, "Scale factor for module temperatures.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 23, 21, 1 },
+    // DataPointIndexA_SF
+    { "A_SF", nullptr, "Scale factor for string currents.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 24, 22, 1 },
+    // DataPointIndexSoH_SF
+    { "SoH_SF", nullptr, "Scale factor for string state of health.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 25, 23, 1 },
+    // DataPointIndexSoC_SF
+    { "SoC_SF", nullptr, "Scale factor for string state of charge.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 26, 24, 1 },
+    // DataPointIndexV_SF
+    { "V_SF", nullptr, "Scale factor for string voltage.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 27, 25, 1 }
+};
+
 SunSpecLithiumIonBankModel::SunSpecLithiumIonBankModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 803, modelLength, byteOrder, parent)
 {
@@ -719,433 +522,125 @@ qint16 SunSpecLithiumIonBankModel::v_SF() const
 }
 void SunSpecLithiumIonBankModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint stringCountDataPoint;
-    stringCountDataPoint.setName("NStr");
-    stringCountDataPoint.setLabel("String Count");
-    stringCountDataPoint.setDescription("Number of strings in the bank.");
-    stringCountDataPoint.setMandatory(true);
-    stringCountDataPoint.setSize(1);
-    stringCountDataPoint.setAddressOffset(2);
-    stringCountDataPoint.setBlockOffset(0);
-    stringCountDataPoint.setSunSpecDataType("uint16");
-    stringCountDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringCountDataPoint.name(), stringCountDataPoint);
-
-    SunSpecDataPoint connectedStringCountDataPoint;
-    connectedStringCountDataPoint.setName("NStrCon");
-    connectedStringCountDataPoint.setLabel("Connected String Count");
-    connectedStringCountDataPoint.setDescription("Number of strings with contactor closed.");
-    connectedStringCountDataPoint.setMandatory(true);
-    connectedStringCountDataPoint.setSize(1);
-    connectedStringCountDataPoint.setAddressOffset(3);
-    connectedStringCountDataPoint.setBlockOffset(1);
-    connectedStringCountDataPoint.setSunSpecDataType("uint16");
-    connectedStringCountDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(connectedStringCountDataPoint.name(), connectedStringCountDataPoint);
-
-    SunSpecDataPoint maxModuleTemperatureDataPoint;
-    maxModuleTemperatureDataPoint.setName("ModTmpMax");
-    maxModuleTemperatureDataPoint.setLabel("Max Module Temperature");
-    maxModuleTemperatureDataPoint.setDescription("Maximum temperature for all modules in the bank.");
-    maxModuleTemperatureDataPoint.setMandatory(true);
-    maxModuleTemperatureDataPoint.setSize(1);
-    maxModuleTemperatureDataPoint.setAddressOffset(4);
-    maxModuleTemperatureDataPoint.setBlockOffset(2);
-    maxModuleTemperatureDataPoint.setScaleFactorName("ModTmp_SF");
-    maxModuleTemperatureDataPoint.setSunSpecDataType("int16");
-    maxModuleTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxModuleTemperatureDataPoint.name(), maxModuleTemperatureDataPoint);
-
-    SunSpecDataPoint maxModuleTemperatureStringDataPoint;
-    maxModuleTemperatureStringDataPoint.setName("ModTmpMaxStr");
-    maxModuleTemperatureStringDataPoint.setLabel("Max Module Temperature String");
-    maxModuleTemperatureStringDataPoint.setDescription("String containing the module with maximum temperature.");
-    maxModuleTemperatureStringDataPoint.setSize(1);
-    maxModuleTemperatureStringDataPoint.setAddressOffset(5);
-    maxModuleTemperatureStringDataPoint.setBlockOffset(3);
-    maxModuleTemperatureStringDataPoint.setSunSpecDataType("uint16");
-    maxModuleTemperatureStringDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxModuleTemperatureStringDataPoint.name(), maxModuleTemperatureStringDataPoint);
-
-    SunSpecDataPoint maxModuleTemperatureModuleDataPoint;
-    maxModuleTemperatureModuleDataPoint.setName("ModTmpMaxMod");
-    maxModuleTemperatureModuleDataPoint.setLabel("Max Module Temperature Module");
-    maxModuleTemperatureModuleDataPoint.setDescription("Module with maximum temperature.");
-    maxModuleTemperatureModuleDataPoint.setSize(1);
-    maxModuleTemperatureModuleDataPoint.setAddressOffset(6);
-    maxModuleTemperatureModuleDataPoint.setBlockOffset(4);
-    maxModuleTemperatureModuleDataPoint.setSunSpecDataType("uint16");
-    maxModuleTemperatureModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxModuleTemperatureModuleDataPoint.name(), maxModuleTemperatureModuleDataPoint);
-
-    SunSpecDataPoint minModuleTemperatureDataPoint;
-    minModuleTemperatureDataPoint.setName("ModTmpMin");
-    minModuleTemperatureDataPoint.setLabel("Min Module Temperature");
-    minModuleTemperatureDataPoint.setDescription("Minimum temperature for all modules in the bank.");
-    minModuleTemperatureDataPoint.setUnits("C");
-    minModuleTemperatureDataPoint.setMandatory(true);
-    minModuleTemperatureDataPoint.setSize(1);
-    minModuleTemperatureDataPoint.setAddressOffset(7);
-    minModuleTemperatureDataPoint.setBlockOffset(5);
-    minModuleTemperatureDataPoint.setScaleFactorName("ModTmp_SF");
-    minModuleTemperatureDataPoint.setSunSpecDataType("int16");
-    minModuleTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minModuleTemperatureDataPoint.name(), minModuleTemperatureDataPoint);
-
-    SunSpecDataPoint minModuleTemperatureStringDataPoint;
-    minModuleTemperatureStringDataPoint.setName("ModTmpMinStr");
-    minModuleTemperatureStringDataPoint.setLabel("Min Module Temperature String");
-    minModuleTemperatureStringDataPoint.setDescription("String containing the module with minimum temperature.");
-    minModuleTemperatureStringDataPoint.setSize(1);
-    minModuleTemperatureStringDataPoint.setAddressOffset(8);
-    minModuleTemperatureStringDataPoint.setBlockOffset(6);
-    minModuleTemperatureStringDataPoint.setSunSpecDataType("uint16");
-    minModuleTemperatureStringDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minModuleTemperatureStringDataPoint.name(), minModuleTemperatureStringDataPoint);
-
-    SunSpecDataPoint minModuleTemperatureModuleDataPoint;
-    minModuleTemperatureModuleDataPoint.setName("ModTmpMinMod");
-    minModuleTemperatureModuleDataPoint.setLabel("Min Module Temperature Module");
-    minModuleTemperatureModuleDataPoint.setDescription("Module with minimum temperature.");
-    minModuleTemperatureModuleDataPoint.setSize(1);
-    minModuleTemperatureModuleDataPoint.setAddressOffset(9);
-    minModuleTemperatureModuleDataPoint.setBlockOffset(7);
-    minModuleTemperatureModuleDataPoint.setSunSpecDataType("uint16");
-    minModuleTemperatureModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minModuleTemperatureModuleDataPoint.name(), minModuleTemperatureModuleDataPoint);
-
-    SunSpecDataPoint averageModuleTemperatureDataPoint;
-    averageModuleTemperatureDataPoint.setName("ModTmpAvg");
-    averageModuleTemperatureDataPoint.setLabel("Average Module Temperature");
-    averageModuleTemperatureDataPoint.setDescription("Average temperature for all modules in the bank.");
-    averageModuleTemperatureDataPoint.setSize(1);
-    averageModuleTemperatureDataPoint.setAddressOffset(10);
-    averageModuleTemperatureDataPoint.setBlockOffset(8);
-    averageModuleTemperatureDataPoint.setSunSpecDataType("int16");
-    averageModuleTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(averageModuleTemperatureDataPoint.name(), averageModuleTemperatureDataPoint);
-
-    SunSpecDataPoint maxStringVoltageDataPoint;
-    maxStringVoltageDataPoint.setName("StrVMax");
-    maxStringVoltageDataPoint.setLabel("Max String Voltage");
-    maxStringVoltageDataPoint.setDescription("Maximum string voltage for all strings in the bank.");
-    maxStringVoltageDataPoint.setUnits("V");
-    maxStringVoltageDataPoint.setSize(1);
-    maxStringVoltageDataPoint.setAddressOffset(11);
-    maxStringVoltageDataPoint.setBlockOffset(9);
-    maxStringVoltageDataPoint.setScaleFactorName("V_SF");
-    maxStringVoltageDataPoint.setSunSpecDataType("uint16");
-    maxStringVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxStringVoltageDataPoint.name(), maxStringVoltageDataPoint);
-
-    SunSpecDataPoint maxStringVoltageStringDataPoint;
-    maxStringVoltageStringDataPoint.setName("StrVMaxStr");
-    maxStringVoltageStringDataPoint.setLabel("Max String Voltage String");
-    maxStringVoltageStringDataPoint.setDescription("String with maximum voltage.");
-    maxStringVoltageStringDataPoint.setSize(1);
-    maxStringVoltageStringDataPoint.setAddressOffset(12);
-    maxStringVoltageStringDataPoint.setBlockOffset(10);
-    maxStringVoltageStringDataPoint.setSunSpecDataType("uint16");
-    maxStringVoltageStringDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxStringVoltageStringDataPoint.name(), maxStringVoltageStringDataPoint);
-
-    SunSpecDataPoint minStringVoltageDataPoint;
-    minStringVoltageDataPoint.setName("StrVMin");
-    minStringVoltageDataPoint.setLabel("Min String Voltage");
-    minStringVoltageDataPoint.setDescription("Minimum string voltage for all strings in the bank.");
-    minStringVoltageDataPoint.setUnits("V");
-    minStringVoltageDataPoint.setSize(1);
-    minStringVoltageDataPoint.setAddressOffset(13);
-    minStringVoltageDataPoint.setBlockOffset(11);
-    minStringVoltageDataPoint.setScaleFactorName("V_SF");
-    minStringVoltageDataPoint.setSunSpecDataType("uint16");
-    minStringVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minStringVoltageDataPoint.name(), minStringVoltageDataPoint);
-
-    SunSpecDataPoint minStringVoltageStringDataPoint;
-    minStringVoltageStringDataPoint.setName("StrVMinStr");
-    minStringVoltageStringDataPoint.setLabel("Min String Voltage String");
-    minStringVoltageStringDataPoint.setDescription("String with minimum voltage.");
-    minStringVoltageStringDataPoint.setSize(1);
-    minStringVoltageStringDataPoint.setAddressOffset(14);
-    minStringVoltageStringDataPoint.setBlockOffset(12);
-    minStringVoltageStringDataPoint.setSunSpecDataType("uint16");
-    minStringVoltageStringDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minStringVoltageStringDataPoint.name(), minStringVoltageStringDataPoint);
-
-    SunSpecDataPoint averageStringVoltageDataPoint;
-    averageStringVoltageDataPoint.setName("StrVAvg");
-    averageStringVoltageDataPoint.setLabel("Average String Voltage");
-    averageStringVoltageDataPoint.setDescription("Average string voltage for all strings in the bank.");
-    averageStringVoltageDataPoint.setUnits("V");
-    averageStringVoltageDataPoint.setSize(1);
-    averageStringVoltageDataPoint.setAddressOffset(15);
-    averageStringVoltageDataPoint.setBlockOffset(13);
-    averageStringVoltageDataPoint.setScaleFactorName("V_SF");
-    averageStringVoltageDataPoint.setSunSpecDataType("uint16");
-    averageStringVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(averageStringVoltageDataPoint.name(), averageStringVoltageDataPoint);
-
-    SunSpecDataPoint maxStringCurrentDataPoint;
-    maxStringCurrentDataPoint.setName("StrAMax");
-    maxStringCurrentDataPoint.setLabel("Max String Current");
-    maxStringCurrentDataPoint.setDescription("Maximum current of any string in the bank.");
-    maxStringCurrentDataPoint.setUnits("A");
-    maxStringCurrentDataPoint.setSize(1);
-    maxStringCurrentDataPoint.setAddressOffset(16);
-    maxStringCurrentDataPoint.setBlockOffset(14);
-    maxStringCurrentDataPoint.setScaleFactorName("A_SF");
-    maxStringCurrentDataPoint.setSunSpecDataType("int16");
-    maxStringCurrentDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxStringCurrentDataPoint.name(), maxStringCurrentDataPoint);
-
-    SunSpecDataPoint maxStringCurrentStringDataPoint;
-    maxStringCurrentStringDataPoint.setName("StrAMaxStr");
-    maxStringCurrentStringDataPoint.setLabel("Max String Current String");
-    maxStringCurrentStringDataPoint.setDescription("String with the maximum current.");
-    maxStringCurrentStringDataPoint.setSize(1);
-    maxStringCurrentStringDataPoint.setAddressOffset(17);
-    maxStringCurrentStringDataPoint.setBlockOffset(15);
-    maxStringCurrentStringDataPoint.setSunSpecDataType("uint16");
-    maxStringCurrentStringDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxStringCurrentStringDataPoint.name(), maxStringCurrentStringDataPoint);
-
-    SunSpecDataPoint minStringCurrentDataPoint;
-    minStringCurrentDataPoint.setName("StrAMin");
-    minStringCurrentDataPoint.setLabel("Min String Current");
-    minStringCurrentDataPoint.setDescription("Minimum current of any string in the bank.");
-    minStringCurrentDataPoint.setUnits("A");
-    minStringCurrentDataPoint.setSize(1);
-    minStringCurrentDataPoint.setAddressOffset(18);
-    minStringCurrentDataPoint.setBlockOffset(16);
-    minStringCurrentDataPoint.setScaleFactorName("A_SF");
-    minStringCurrentDataPoint.setSunSpecDataType("int16");
-    minStringCurrentDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minStringCurrentDataPoint.name(), minStringCurrentDataPoint);
-
-    SunSpecDataPoint minStringCurrentStringDataPoint;
-    minStringCurrentStringDataPoint.setName("StrAMinStr");
-    minStringCurrentStringDataPoint.setLabel("Min String Current String");
-    minStringCurrentStringDataPoint.setDescription("String with the minimum current.");
-    minStringCurrentStringDataPoint.setSize(1);
-    minStringCurrentStringDataPoint.setAddressOffset(19);
-    minStringCurrentStringDataPoint.setBlockOffset(17);
-    minStringCurrentStringDataPoint.setSunSpecDataType("uint16");
-    minStringCurrentStringDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minStringCurrentStringDataPoint.name(), minStringCurrentStringDataPoint);
-
-    SunSpecDataPoint averageStringCurrentDataPoint;
-    averageStringCurrentDataPoint.setName("StrAAvg");
-    averageStringCurrentDataPoint.setLabel("Average String Current");
-    averageStringCurrentDataPoint.setDescription("Average string current for all strings in the bank.");
-    averageStringCurrentDataPoint.setUnits("A");
-    averageStringCurrentDataPoint.setSize(1);
-    averageStringCurrentDataPoint.setAddressOffset(20);
-    averageStringCurrentDataPoint.setBlockOffset(18);
-    averageStringCurrentDataPoint.setScaleFactorName("A_SF");
-    averageStringCurrentDataPoint.setSunSpecDataType("int16");
-    averageStringCurrentDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(averageStringCurrentDataPoint.name(), averageStringCurrentDataPoint);
-
-    SunSpecDataPoint batteryCellBalancingCountDataPoint;
-    batteryCellBalancingCountDataPoint.setName("NCellBal");
-    batteryCellBalancingCountDataPoint.setLabel("Battery Cell Balancing Count");
-    batteryCellBalancingCountDataPoint.setDescription("Total number of cells that are currently being balanced.");
-    batteryCellBalancingCountDataPoint.setSize(1);
-    batteryCellBalancingCountDataPoint.setAddressOffset(21);
-    batteryCellBalancingCountDataPoint.setBlockOffset(19);
-    batteryCellBalancingCountDataPoint.setSunSpecDataType("uint16");
-    batteryCellBalancingCountDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(batteryCellBalancingCountDataPoint.name(), batteryCellBalancingCountDataPoint);
-
-    SunSpecDataPoint cellV_SFDataPoint;
-    cellV_SFDataPoint.setName("CellV_SF");
-    cellV_SFDataPoint.setDescription("Scale factor for cell voltage.");
-    cellV_SFDataPoint.setMandatory(true);
-    cellV_SFDataPoint.setSize(1);
-    cellV_SFDataPoint.setAddressOffset(22);
-    cellV_SFDataPoint.setBlockOffset(20);
-    cellV_SFDataPoint.setSunSpecDataType("sunssf");
-    cellV_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(cellV_SFDataPoint.name(), cellV_SFDataPoint);
-
-    SunSpecDataPoint modTmp_SFDataPoint;
-    modTmp_SFDataPoint.setName("ModTmp_SF");
-    modTmp_SFDataPoint.setDescription("Scale factor for module temperatures.");
-    modTmp_SFDataPoint.setMandatory(true);
-    modTmp_SFDataPoint.setSize(1);
-    modTmp_SFDataPoint.setAddressOffset(23);
-    modTmp_SFDataPoint.setBlockOffset(21);
-    modTmp_SFDataPoint.setSunSpecDataType("sunssf");
-    modTmp_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modTmp_SFDataPoint.name(), modTmp_SFDataPoint);
-
-    SunSpecDataPoint a_SFDataPoint;
-    a_SFDataPoint.setName("A_SF");
-    a_SFDataPoint.setDescription("Scale factor for string currents.");
-    a_SFDataPoint.setMandatory(true);
-    a_SFDataPoint.setSize(1);
-    a_SFDataPoint.setAddressOffset(24);
-    a_SFDataPoint.setBlockOffset(22);
-    a_SFDataPoint.setSunSpecDataType("sunssf");
-    a_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(a_SFDataPoint.name(), a_SFDataPoint);
-
-    SunSpecDataPoint soH_SFDataPoint;
-    soH_SFDataPoint.setName("SoH_SF");
-    soH_SFDataPoint.setDescription("Scale factor for string state of health.");
-    soH_SFDataPoint.setSize(1);
-    soH_SFDataPoint.setAddressOffset(25);
-    soH_SFDataPoint.setBlockOffset(23);
-    soH_SFDataPoint.setSunSpecDataType("sunssf");
-    soH_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(soH_SFDataPoint.name(), soH_SFDataPoint);
-
-    SunSpecDataPoint soC_SFDataPoint;
-    soC_SFDataPoint.setName("SoC_SF");
-    soC_SFDataPoint.setDescription("Scale factor for string state of charge.");
-    soC_SFDataPoint.setMandatory(true);
-    soC_SFDataPoint.setSize(1);
-    soC_SFDataPoint.setAddressOffset(26);
-    soC_SFDataPoint.setBlockOffset(24);
-    soC_SFDataPoint.setSunSpecDataType("sunssf");
-    soC_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(soC_SFDataPoint.name(), soC_SFDataPoint);
-
-    SunSpecDataPoint v_SFDataPoint;
-    v_SFDataPoint.setName("V_SF");
-    v_SFDataPoint.setDescription("Scale factor for string voltage.");
-    v_SFDataPoint.setSize(1);
-    v_SFDataPoint.setAddressOffset(27);
-    v_SFDataPoint.setBlockOffset(25);
-    v_SFDataPoint.setSunSpecDataType("sunssf");
-    v_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v_SFDataPoint.name(), v_SFDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 28;
 }
 
 void SunSpecLithiumIonBankModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("CellV_SF").isValid())
-        m_cellV_SF = m_dataPoints.value("CellV_SF").toInt16();
+    if (registerCount >= 23 && SunSpecDataPoint::isValid(registers + 22, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 22, 1);
+        if (scaleFactor != m_cellV_SF) {
+            m_cellV_SF = scaleFactor;
+            m_cellV_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("ModTmp_SF").isValid())
-        m_modTmp_SF = m_dataPoints.value("ModTmp_SF").toInt16();
+    if (registerCount >= 24 && SunSpecDataPoint::isValid(registers + 23, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 23, 1);
+        if (scaleFactor != m_modTmp_SF) {
+            m_modTmp_SF = scaleFactor;
+            m_modTmp_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("A_SF").isValid())
-        m_a_SF = m_dataPoints.value("A_SF").toInt16();
+    if (registerCount >= 25 && SunSpecDataPoint::isValid(registers + 24, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 24, 1);
+        if (scaleFactor != m_a_SF) {
+            m_a_SF = scaleFactor;
+            m_a_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("SoH_SF").isValid())
-        m_soH_SF = m_dataPoints.value("SoH_SF").toInt16();
+    if (registerCount >= 26 && SunSpecDataPoint::isValid(registers + 25, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 25, 1);
+        if (scaleFactor != m_soH_SF) {
+            m_soH_SF = scaleFactor;
+            m_soH_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("SoC_SF").isValid())
-        m_soC_SF = m_dataPoints.value("SoC_SF").toInt16();
+    if (registerCount >= 27 && SunSpecDataPoint::isValid(registers + 26, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 26, 1);
+        if (scaleFactor != m_soC_SF) {
+            m_soC_SF = scaleFactor;
+            m_soC_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("V_SF").isValid())
-        m_v_SF = m_dataPoints.value("V_SF").toInt16();
+    if (registerCount >= 28 && SunSpecDataPoint::isValid(registers + 27, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 27, 1);
+        if (scaleFactor != m_v_SF) {
+            m_v_SF = scaleFactor;
+            m_v_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("NStr").isValid())
-        m_stringCount = m_dataPoints.value("NStr").toUInt16();
-
-    if (m_dataPoints.value("NStrCon").isValid())
-        m_connectedStringCount = m_dataPoints.value("NStrCon").toUInt16();
-
-    if (m_dataPoints.value("ModTmpMax").isValid())
-        m_maxModuleTemperature = m_dataPoints.value("ModTmpMax").toFloatWithSSF(m_modTmp_SF);
-
-    if (m_dataPoints.value("ModTmpMaxStr").isValid())
-        m_maxModuleTemperatureString = m_dataPoints.value("ModTmpMaxStr").toUInt16();
-
-    if (m_dataPoints.value("ModTmpMaxMod").isValid())
-        m_maxModuleTemperatureModule = m_dataPoints.value("ModTmpMaxMod").toUInt16();
-
-    if (m_dataPoints.value("ModTmpMin").isValid())
-        m_minModuleTemperature = m_dataPoints.value("ModTmpMin").toFloatWithSSF(m_modTmp_SF);
-
-    if (m_dataPoints.value("ModTmpMinStr").isValid())
-        m_minModuleTemperatureString = m_dataPoints.value("ModTmpMinStr").toUInt16();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_stringCount = SunSpecDataPoint::convertToUInt16(registers + 2, 1);
 
-    if (m_dataPoints.value("ModTmpMinMod").isValid())
-        m_minModuleTemperatureModule = m_dataPoints.value("ModTmpMinMod").toUInt16();
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_connectedStringCount = SunSpecDataPoint::convertToUInt16(registers + 3, 1);
 
-    if (m_dataPoints.value("ModTmpAvg").isValid())
-        m_averageModuleTemperature = m_dataPoints.value("ModTmpAvg").toInt16();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_maxModuleTemperature = SunSpecDataPoint::convertToInt16(registers + 4, 1) * m_modTmp_SFMultiplier;
 
-    if (m_dataPoints.value("StrVMax").isValid())
-        m_maxStringVoltage = m_dataPoints.value("StrVMax").toFloatWithSSF(m_v_SF);
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxModuleTemperatureString = SunSpecDataPoint::convertToUInt16(registers + 5, 1);
 
-    if (m_dataPoints.value("StrVMaxStr").isValid())
-        m_maxStringVoltageString = m_dataPoints.value("StrVMaxStr").toUInt16();
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxModuleTemperatureModule = SunSpecDataPoint::convertToUInt16(registers + 6, 1);
 
-    if (m_dataPoints.value("StrVMin").isValid())
-        m_minStringVoltage = m_dataPoints.value("StrVMin").toFloatWithSSF(m_v_SF);
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_minModuleTemperature = SunSpecDataPoint::convertToInt16(registers + 7, 1) * m_modTmp_SFMultiplier;
 
-    if (m_dataPoints.value("StrVMinStr").isValid())
-        m_minStringVoltageString = m_dataPoints.value("StrVMinStr").toUInt16();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minModuleTemperatureString = SunSpecDataPoint::convertToUInt16(registers + 8, 1);
 
-    if (m_dataPoints.value("StrVAvg").isValid())
-        m_averageStringVoltage = m_dataPoints.value("StrVAvg").toFloatWithSSF(m_v_SF);
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minModuleTemperatureModule = SunSpecDataPoint::convertToUInt16(registers + 9, 1);
 
-    if (m_dataPoints.value("StrAMax").isValid())
-        m_maxStringCurrent = m_dataPoints.value("StrAMax").toFloatWithSSF(m_a_SF);
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_averageModuleTemperature = SunSpecDataPoint::convertToInt16(registers + 10, 1);
 
-    if (m_dataPoints.value("StrAMaxStr").isValid())
-        m_maxStringCurrentString = m_dataPoints.value("StrAMaxStr").toUInt16();
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxStringVoltage = SunSpecDataPoint::convertToUInt16(registers + 11, 1) * m_v_SFMultiplier;
 
-    if (m_dataPoints.value("StrAMin").isValid())
-        m_minStringCurrent = m_dataPoints.value("StrAMin").toFloatWithSSF(m_a_SF);
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 12, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxStringVoltageString = SunSpecDataPoint::convertToUInt16(registers + 12, 1);
 
-    if (m_dataPoints.value("StrAMinStr").isValid())
-        m_minStringCurrentString = m_dataPoints.value("StrAMinStr").toUInt16();
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 13, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minStringVoltage = SunSpecDataPoint::convertToUInt16(registers + 13, 1) * m_v_SFMultiplier;
 
-    if (m_dataPoints.value("StrAAvg").isValid())
-        m_averageStringCurrent = m_dataPoints.value("StrAAvg").toFloatWithSSF(m_a_SF);
+    if (registerCount >= 15 && SunSpecDataPoint::isValid(registers + 14, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minStringVoltageString = SunSpecDataPoint::convertToUInt16(registers + 14, 1);
 
-    if (m_dataPoints.value("NCellBal").isValid())
-        m_batteryCellBalancingCount = m_dataPoints.value("NCellBal").toUInt16();
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 15, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_averageStringVoltage = SunSpecDataPoint::convertToUInt16(registers + 15, 1) * m_v_SFMultiplier;
 
-    if (m_dataPoints.value("CellV_SF").isValid())
-        m_cellV_SF = m_dataPoints.value("CellV_SF").toInt16();
+    if (registerCount >= 17 && SunSpecDataPoint::isValid(registers + 16, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_maxStringCurrent = SunSpecDataPoint::convertToInt16(registers + 16, 1) * m_a_SFMultiplier;
 
-    if (m_dataPoints.value("ModTmp_SF").isValid())
-        m_modTmp_SF = m_dataPoints.value("ModTmp_SF").toInt16();
+    if (registerCount >= 18 && SunSpecDataPoint::isValid(registers + 17, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxStringCurrentString = SunSpecDataPoint::convertToUInt16(registers + 17, 1);
 
-    if (m_dataPoints.value("A_SF").isValid())
-        m_a_SF = m_dataPoints.value("A_SF").toInt16();
+    if (registerCount >= 19 && SunSpecDataPoint::isValid(registers + 18, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_minStringCurrent = SunSpecDataPoint::convertToInt16(registers + 18, 1) * m_a_SFMultiplier;
 
-    if (m_dataPoints.value("SoH_SF").isValid())
-        m_soH_SF = m_dataPoints.value("SoH_SF").toInt16();
+    if (registerCount >= 20 && SunSpecDataPoint::isValid(registers + 19, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minStringCurrentString = SunSpecDataPoint::convertToUInt16(registers + 19, 1);
 
-    if (m_dataPoints.value("SoC_SF").isValid())
-        m_soC_SF = m_dataPoints.value("SoC_SF").toInt16();
+    if (registerCount >= 21 && SunSpecDataPoint::isValid(registers + 20, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_averageStringCurrent = SunSpecDataPoint::convertToInt16(registers + 20, 1) * m_a_SFMultiplier;
 
-    if (m_dataPoints.value("V_SF").isValid())
-        m_v_SF = m_dataPoints.value("V_SF").toInt16();
+    if (registerCount >= 22 && SunSpecDataPoint::isValid(registers + 21, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_batteryCellBalancingCount = SunSpecDataPoint::convertToUInt16(registers + 21, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -1154,141 +649,141 @@ void SunSpecLithiumIonBankModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecLithiumIonBankModel *model)
 {
     debug.nospace().noquote() << "SunSpecLithiumIonBankModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NStr") << "-->";
-    if (model->dataPoints().value("NStr").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexStringCount) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexStringCount).isValid()) {
         debug.nospace().noquote() << model->stringCount() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NStrCon") << "-->";
-    if (model->dataPoints().value("NStrCon").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexConnectedStringCount) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexConnectedStringCount).isValid()) {
         debug.nospace().noquote() << model->connectedStringCount() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModTmpMax") << "-->";
-    if (model->dataPoints().value("ModTmpMax").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMaxModuleTemperature) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMaxModuleTemperature).isValid()) {
         debug.nospace().noquote() << model->maxModuleTemperature() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModTmpMaxStr") << "-->";
-    if (model->dataPoints().value("ModTmpMaxStr").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMaxModuleTemperatureString) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMaxModuleTemperatureString).isValid()) {
         debug.nospace().noquote() << model->maxModuleTemperatureString() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModTmpMaxMod") << "-->";
-    if (model->dataPoints().value("ModTmpMaxMod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMaxModuleTemperatureModule) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMaxModuleTemperatureModule).isValid()) {
         debug.nospace().noquote() << model->maxModuleTemperatureModule() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModTmpMin") << "-->";
-    if (model->dataPoints().value("ModTmpMin").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMinModuleTemperature) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMinModuleTemperature).isValid()) {
         debug.nospace().noquote() << model->minModuleTemperature() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModTmpMinStr") << "-->";
-    if (model->dataPoints().value("ModTmpMinStr").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMinModuleTemperatureString) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMinModuleTemperatureString).isValid()) {
         debug.nospace().noquote() << model->minModuleTemperatureString() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModTmpMinMod") << "-->";
-    if (model->dataPoints().value("ModTmpMinMod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMinModuleTemperatureModule) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMinModuleTemperatureModule).isValid()) {
         debug.nospace().noquote() << model->minModuleTemperatureModule() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModTmpAvg") << "-->";
-    if (model->dataPoints().value("ModTmpAvg").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexAverageModuleTemperature) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexAverageModuleTemperature).isValid()) {
         debug.nospace().noquote() << model->averageModuleTemperature() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StrVMax") << "-->";
-    if (model->dataPoints().value("StrVMax").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMaxStringVoltage) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMaxStringVoltage).isValid()) {
         debug.nospace().noquote() << model->maxStringVoltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StrVMaxStr") << "-->";
-    if (model->dataPoints().value("StrVMaxStr").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMaxStringVoltageString) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMaxStringVoltageString).isValid()) {
         debug.nospace().noquote() << model->maxStringVoltageString() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StrVMin") << "-->";
-    if (model->dataPoints().value("StrVMin").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMinStringVoltage) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMinStringVoltage).isValid()) {
         debug.nospace().noquote() << model->minStringVoltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StrVMinStr") << "-->";
-    if (model->dataPoints().value("StrVMinStr").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMinStringVoltageString) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMinStringVoltageString).isValid()) {
         debug.nospace().noquote() << model->minStringVoltageString() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StrVAvg") << "-->";
-    if (model->dataPoints().value("StrVAvg").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexAverageStringVoltage) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexAverageStringVoltage).isValid()) {
         debug.nospace().noquote() << model->averageStringVoltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StrAMax") << "-->";
-    if (model->dataPoints().value("StrAMax").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMaxStringCurrent) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMaxStringCurrent).isValid()) {
         debug.nospace().noquote() << model->maxStringCurrent() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StrAMaxStr") << "-->";
-    if (model->dataPoints().value("StrAMaxStr").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMaxStringCurrentString) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMaxStringCurrentString).isValid()) {
         debug.nospace().noquote() << model->maxStringCurrentString() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StrAMin") << "-->";
-    if (model->dataPoints().value("StrAMin").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMinStringCurrent) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMinStringCurrent).isValid()) {
         debug.nospace().noquote() << model->minStringCurrent() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StrAMinStr") << "-->";
-    if (model->dataPoints().value("StrAMinStr").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMinStringCurrentString) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexMinStringCurrentString).isValid()) {
         debug.nospace().noquote() << model->minStringCurrentString() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StrAAvg") << "-->";
-    if (model->dataPoints().value("StrAAvg").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexAverageStringCurrent) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexAverageStringCurrent).isValid()) {
         debug.nospace().noquote() << model->averageStringCurrent() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NCellBal") << "-->";
-    if (model->dataPoints().value("NCellBal").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexBatteryCellBalancingCount) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonBankModel::DataPointIndexBatteryCellBalancingCount).isValid()) {
         debug.nospace().noquote() << model->batteryCellBalancingCount() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
@@ -156,6 +156,35 @@ public:
     Q_DECLARE_FLAGS(Strevt1Flags, Strevt1)
     Q_FLAG(Strevt1)
 
+    enum DataPointIndex {
+        DataPointIndexModuleCount = 0,
+        DataPointIndexStringStatus,
+        DataPointIndexConnectionFailureReason,
+        DataPointIndexStringStateOfCharge,
+        DataPointIndexStringStateOfHealth,
+        DataPointIndexStringCurrent,
+        DataPointIndexMaxCellVoltage,
+        DataPointIndexMaxCellVoltageModule,
+        DataPointIndexMinCellVoltage,
+        DataPointIndexMinCellVoltageModule,
+        DataPointIndexAverageCellVoltage,
+        DataPointIndexMaxModuleTemperature,
+        DataPointIndexMaxModuleTemperatureModule,
+        DataPointIndexMinModuleTemperature,
+        DataPointIndexMinModuleTemperatureModule,
+        DataPointIndexAverageModuleTemperature,
+        DataPointIndexDisabledReason,
+        DataPointIndexContactorStatus,
+        DataPointIndexStringEvent1,
+        DataPointIndexStringEvent2,
+        DataPointIndexVendorStringEventBitfield1,
+        DataPointIndexVendorStringEventBitfield2,
+        DataPointIndexEnableDisableString,
+        DataPointIndexConnectDisconnectString,
+        DataPointIndexPad1,
+        DataPointIndexPad2
+    };
+
     explicit SunSpecLithiumIonBankModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecLithiumIonBankModel *parent = nullptr);
     ~SunSpecLithiumIonBankModelRepeatingBlock() override = default;
 
@@ -264,6 +293,37 @@ class SunSpecLithiumIonBankModel : public SunSpecModel
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexStringCount,
+        DataPointIndexConnectedStringCount,
+        DataPointIndexMaxModuleTemperature,
+        DataPointIndexMaxModuleTemperatureString,
+        DataPointIndexMaxModuleTemperatureModule,
+        DataPointIndexMinModuleTemperature,
+        DataPointIndexMinModuleTemperatureString,
+        DataPointIndexMinModuleTemperatureModule,
+        DataPointIndexAverageModuleTemperature,
+        DataPointIndexMaxStringVoltage,
+        DataPointIndexMaxStringVoltageString,
+        DataPointIndexMinStringVoltage,
+        DataPointIndexMinStringVoltageString,
+        DataPointIndexAverageStringVoltage,
+        DataPointIndexMaxStringCurrent,
+        DataPointIndexMaxStringCurrentString,
+        DataPointIndexMinStringCurrent,
+        DataPointIndexMinStringCurrentString,
+        DataPointIndexAverageStringCurrent,
+        DataPointIndexBatteryCellBalancingCount,
+        DataPointIndexCellV_SF,
+        DataPointIndexModTmp_SF,
+        DataPointIndexA_SF,
+        DataPointIndexSoH_SF,
+        DataPointIndexSoC_SF,
+        DataPointIndexV_SF
+    };
+
     explicit SunSpecLithiumIonBankModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecLithiumIonBankModel() override; 
 
@@ -353,11 +413,17 @@ private:
     float m_averageStringCurrent = 0;
     quint16 m_batteryCellBalancingCount = 0;
     qint16 m_cellV_SF = 0;
+    double m_cellV_SFMultiplier = 1;
     qint16 m_modTmp_SF = 0;
+    double m_modTmp_SFMultiplier = 1;
     qint16 m_a_SF = 0;
+    double m_a_SFMultiplier = 1;
     qint16 m_soH_SF = 0;
+    double m_soH_SFMultiplier = 1;
     qint16 m_soC_SF = 0;
+    double m_soC_SFMultiplier = 1;
     qint16 m_v_SF = 0;
+    double m_v_SFMultiplier = 1;
 
 
 };
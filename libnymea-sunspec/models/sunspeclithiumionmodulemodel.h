@@ -50,6 +50,12 @@ public:
     Q_DECLARE_FLAGS(CellstFlags, Cellst)
     Q_FLAG(Cellst)
 
+    enum DataPointIndex {
+        DataPointIndexCellVoltage = 0,
+        DataPointIndexCellTemperature,
+        DataPointIndexCellStatus
+    };
+
     explicit SunSpecLithiumIonModuleModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecLithiumIonModuleModel *parent = nullptr);
     ~SunSpecLithiumIonModuleModelRepeatingBlock() override = default;
 
@@ -84,6 +90,37 @@ class SunSpecLithiumIonModuleModel : public SunSpecModel
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexStringIndex,
+        DataPointIndexModuleIndex,
+        DataPointIndexModuleCellCount,
+        DataPointIndexModuleSoC,
+        DataPointIndexDepthOfDischarge,
+        DataPointIndexModuleSoH,
+        DataPointIndexCycleCount,
+        DataPointIndexModuleVoltage,
+        DataPointIndexMaxCellVoltage,
+        DataPointIndexMaxCellVoltageCell,
+        DataPointIndexMinCellVoltage,
+        DataPointIndexMinCellVoltageCell,
+        DataPointIndexAverageCellVoltage,
+        DataPointIndexMaxCellTemperature,
+        DataPointIndexMaxCellTemperatureCell,
+        DataPointIndexMinCellTemperature,
+        DataPointIndexMinCellTemperatureCell,
+        DataPointIndexAverageCellTemperature,
+        DataPointIndexBalancedCellCount,
+        DataPointIndexSerialNumber,
+        DataPointIndexSoC_SF,
+        DataPointIndexSoH_SF,
+        DataPointIndexDoD_SF,
+        DataPointIndexV_SF,
+        DataPointIndexCellV_SF,
+        DataPointIndexTmp_SF
+    };
+
     explicit SunSpecLithiumIonModuleModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecLithiumIonModuleModel() override; 
 
@@ -173,11 +210,17 @@ private:
     quint16 m_balancedCellCount = 0;
     QString m_serialNumber;
     qint16 m_soC_SF = 0;
+    double m_soC_SFMultiplier = 1;
     qint16 m_soH_SF = 0;
+    double m_soH_SFMultiplier = 1;
     qint16 m_doD_SF = 0;
+    double m_doD_SFMultiplier = 1;
     qint16 m_v_SF = 0;
+    double m_v_SFMultiplier = 1;
     qint16 m_cellV_SF = 0;
+    double m_cellV_SFMultiplier = 1;
     qint16 m_tmp_SF = 0;
+    double m_tmp_SFMultiplier = 1;
 
 
 };
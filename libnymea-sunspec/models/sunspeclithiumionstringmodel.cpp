@@ -31,6 +31,41 @@
 #include "sunspeclithiumionstringmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata repeatingBlockDataPointMetadata[] = {
+    // DataPointIndexModuleCellCount
+    { "ModNCell", "Module Cell Count", "Count of all cells in the module.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModuleSoC
+    { "ModSoC", "Module SoC", "Module state of charge, expressed as a percentage.", nullptr, "%", "uint16", "SoC_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 1, 0, 1 },
+    // DataPointIndexModuleSoH
+    { "ModSoH", "Module SoH", "Module state of health, expressed as a percentage.", nullptr, "%", "uint16", "SoH_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 2, 0, 1 },
+    // DataPointIndexMaxCellVoltage
+    { "ModCellVMax", "Max Cell Voltage", "Maximum voltage for all cells in the module.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 3, 1, 1 },
+    // DataPointIndexMaxCellVoltageCell
+    { "ModCellVMaxCell", "Max Cell Voltage Cell", "Cell with maximum voltage.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 4, 2, 1 },
+    // DataPointIndexMinCellVoltage
+    { "ModCellVMin", "Min Cell Voltage", "Minimum voltage for all cells in the module.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 5, 3, 1 },
+    // DataPointIndexMinCellVoltageCell
+    { "ModCellVMinCell", "Min Cell Voltage Cell", "Cell with minimum voltage.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 6, 4, 1 },
+    // DataPointIndexAverageCellVoltage
+    { "ModCellVAvg", "Average Cell Voltage", "Average voltage for all cells in the module.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 7, 5, 1 },
+    // DataPointIndexMaxCellTemperature
+    { "ModCellTmpMax", "Max Cell Temperature", "Maximum temperature for all cells in the module.", nullptr, "C", "int16", "ModTmp_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 8, 6, 1 },
+    // DataPointIndexMaxCellTemperatureCell
+    { "ModCellTmpMaxCell", "Max Cell Temperature Cell", "Cell with maximum temperature.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 9, 7, 1 },
+    // DataPointIndexMinCellTemperature
+    { "ModCellTmpMin", "Min Cell Temperature", "Minimum temperature for all cells in the module.", nullptr, "C", "int16", "ModTmp_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 10, 8, 1 },
+    // DataPointIndexMinCellTemperatureCell
+    { "ModCellTmpMinCell", "Min Cell Temperature Cell", "Cell with minimum temperature.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 11, 9, 1 },
+    // DataPointIndexAverageCellTemperature
+    { "ModCellTmpAvg", "Average Cell Temperature", "Average temperature for all cells in the module.", nullptr, "C", "int16", "ModTmp_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 12, 10, 1 },
+    // DataPointIndexPad5
+    { "Pad5", "Pad", "Pad register.", nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, true, 13, 11, 1 },
+    // DataPointIndexPad6
+    { "Pad6", "Pad", "Pad register.", nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, true, 14, 12, 1 },
+    // DataPointIndexPad7
+    { "Pad7", "Pad", "Pad register.", nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, true, 15, 13, 1 }
+};
+
 SunSpecLithiumIonStringModelRepeatingBlock::SunSpecLithiumIonStringModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecLithiumIonStringModel *parent) :
     SunSpecModelRepeatingBlock(blockIndex, blockSize, modbusStartRegister, parent)
 {
@@ -115,268 +150,156 @@ quint16 SunSpecLithiumIonStringModelRepeatingBlock::pad7() const
 
 void SunSpecLithiumIonStringModelRepeatingBlock::initDataPoints()
 {
-    SunSpecDataPoint moduleCellCountDataPoint;
-    moduleCellCountDataPoint.setName("ModNCell");
-    moduleCellCountDataPoint.setLabel("Module Cell Count");
-    moduleCellCountDataPoint.setDescription("Count of all cells in the module.");
-    moduleCellCountDataPoint.setMandatory(true);
-    moduleCellCountDataPoint.setSize(1);
-    moduleCellCountDataPoint.setAddressOffset(0);
-    moduleCellCountDataPoint.setSunSpecDataType("uint16");
-    moduleCellCountDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(moduleCellCountDataPoint.name(), moduleCellCountDataPoint);
-
-    SunSpecDataPoint moduleSoCDataPoint;
-    moduleSoCDataPoint.setName("ModSoC");
-    moduleSoCDataPoint.setLabel("Module SoC");
-    moduleSoCDataPoint.setDescription("Module state of charge, expressed as a percentage.");
-    moduleSoCDataPoint.setUnits("%");
-    moduleSoCDataPoint.setSize(1);
-    moduleSoCDataPoint.setAddressOffset(1);
-    moduleSoCDataPoint.setScaleFactorName("SoC_SF");
-    moduleSoCDataPoint.setSunSpecDataType("uint16");
-    moduleSoCDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(moduleSoCDataPoint.name(), moduleSoCDataPoint);
-
-    SunSpecDataPoint moduleSoHDataPoint;
-    moduleSoHDataPoint.setName("ModSoH");
-    moduleSoHDataPoint.setLabel("Module SoH");
-    moduleSoHDataPoint.setDescription("Module state of health, expressed as a percentage.");
-    moduleSoHDataPoint.setUnits("%");
-    moduleSoHDataPoint.setSize(1);
-    moduleSoHDataPoint.setAddressOffset(2);
-    moduleSoHDataPoint.setBlockOffset(0);
-    moduleSoHDataPoint.setScaleFactorName("SoH_SF");
-    moduleSoHDataPoint.setSunSpecDataType("uint16");
-    moduleSoHDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(moduleSoHDataPoint.name(), moduleSoHDataPoint);
-
-    SunSpecDataPoint maxCellVoltageDataPoint;
-    maxCellVoltageDataPoint.setName("ModCellVMax");
-    maxCellVoltageDataPoint.setLabel("Max Cell Voltage");
-    maxCellVoltageDataPoint.setDescription("Maximum voltage for all cells in the module.");
-    maxCellVoltageDataPoint.setUnits("V");
-    maxCellVoltageDataPoint.setMandatory(true);
-    maxCellVoltageDataPoint.setSize(1);
-    maxCellVoltageDataPoint.setAddressOffset(3);
-    maxCellVoltageDataPoint.setBlockOffset(1);
-    maxCellVoltageDataPoint.setScaleFactorName("CellV_SF");
-    maxCellVoltageDataPoint.setSunSpecDataType("uint16");
-    maxCellVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxCellVoltageDataPoint.name(), maxCellVoltageDataPoint);
-
-    SunSpecDataPoint maxCellVoltageCellDataPoint;
-    maxCellVoltageCellDataPoint.setName("ModCellVMaxCell");
-    maxCellVoltageCellDataPoint.setLabel("Max Cell Voltage Cell");
-    maxCellVoltageCellDataPoint.setDescription("Cell with maximum voltage.");
-    maxCellVoltageCellDataPoint.setSize(1);
-    maxCellVoltageCellDataPoint.setAddressOffset(4);
-    maxCellVoltageCellDataPoint.setBlockOffset(2);
-    maxCellVoltageCellDataPoint.setSunSpecDataType("uint16");
-    maxCellVoltageCellDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxCellVoltageCellDataPoint.name(), maxCellVoltageCellDataPoint);
-
-    SunSpecDataPoint minCellVoltageDataPoint;
-    minCellVoltageDataPoint.setName("ModCellVMin");
-    minCellVoltageDataPoint.setLabel("Min Cell Voltage");
-    minCellVoltageDataPoint.setDescription("Minimum voltage for all cells in the module.");
-    minCellVoltageDataPoint.setUnits("V");
-    minCellVoltageDataPoint.setMandatory(true);
-    minCellVoltageDataPoint.setSize(1);
-    minCellVoltageDataPoint.setAddressOffset(5);
-    minCellVoltageDataPoint.setBlockOffset(3);
-    minCellVoltageDataPoint.setScaleFactorName("CellV_SF");
-    minCellVoltageDataPoint.setSunSpecDataType("uint16");
-    minCellVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minCellVoltageDataPoint.name(), minCellVoltageDataPoint);
-
-    SunSpecDataPoint minCellVoltageCellDataPoint;
-    minCellVoltageCellDataPoint.setName("ModCellVMinCell");
-    minCellVoltageCellDataPoint.setLabel("Min Cell Voltage Cell");
-    minCellVoltageCellDataPoint.setDescription("Cell with minimum voltage.");
-    minCellVoltageCellDataPoint.setUnits("V");
-    minCellVoltageCellDataPoint.setSize(1);
-    minCellVoltageCellDataPoint.setAddressOffset(6);
-    minCellVoltageCellDataPoint.setBlockOffset(4);
-    minCellVoltageCellDataPoint.setScaleFactorName("CellV_SF");
-    minCellVoltageCellDataPoint.setSunSpecDataType("uint16");
-    minCellVoltageCellDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minCellVoltageCellDataPoint.name(), minCellVoltageCellDataPoint);
-
-    SunSpecDataPoint averageCellVoltageDataPoint;
-    averageCellVoltageDataPoint.setName("ModCellVAvg");
-    averageCellVoltageDataPoint.setLabel("Average Cell Voltage");
-    averageCellVoltageDataPoint.setDescription("Average voltage for all cells in the module.");
-    averageCellVoltageDataPoint.setUnits("V");
-    averageCellVoltageDataPoint.setMandatory(true);
-    averageCellVoltageDataPoint.setSize(1);
-    averageCellVoltageDataPoint.setAddressOffset(7);
-    averageCellVoltageDataPoint.setBlockOffset(5);
-    averageCellVoltageDataPoint.setScaleFactorName("CellV_SF");
-    averageCellVoltageDataPoint.setSunSpecDataType("uint16");
-    averageCellVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(averageCellVoltageDataPoint.name(), averageCellVoltageDataPoint);
-
-    SunSpecDataPoint maxCellTemperatureDataPoint;
-    maxCellTemperatureDataPoint.setName("ModCellTmpMax");
-    maxCellTemperatureDataPoint.setLabel("Max Cell Temperature");
-    maxCellTemperatureDataPoint.setDescription("Maximum temperature for all cells in the module.");
-    maxCellTemperatureDataPoint.setUnits("C");
-    maxCellTemperatureDataPoint.setMandatory(true);
-    maxCellTemperatureDataPoint.setSize(1);
-    maxCellTemperatureDataPoint.setAddressOffset(8);
-    maxCellTemperatureDataPoint.setBlockOffset(6);
-    maxCellTemperatureDataPoint.setScaleFactorName("ModTmp_SF");
-    maxCellTemperatureDataPoint.setSunSpecDataType("int16");
-    maxCellTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxCellTemperatureDataPoint.name(), maxCellTemperatureDataPoint);
-
-    SunSpecDataPoint maxCellTemperatureCellDataPoint;
-    maxCellTemperatureCellDataPoint.setName("ModCellTmpMaxCell");
-    maxCellTemperatureCellDataPoint.setLabel("Max Cell Temperature Cell");
-    maxCellTemperatureCellDataPoint.setDescription("Cell with maximum temperature.");
-    maxCellTemperatureCellDataPoint.setSize(1);
-    maxCellTemperatureCellDataPoint.setAddressOffset(9);
-    maxCellTemperatureCellDataPoint.setBlockOffset(7);
-    maxCellTemperatureCellDataPoint.setSunSpecDataType("uint16");
-    maxCellTemperatureCellDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxCellTemperatureCellDataPoint.name(), maxCellTemperatureCellDataPoint);
-
-    SunSpecDataPoint minCellTemperatureDataPoint;
-    minCellTemperatureDataPoint.setName("ModCellTmpMin");
-    minCellTemperatureDataPoint.setLabel("Min Cell Temperature");
-    minCellTemperatureDataPoint.setDescription("Minimum temperature for all cells in the module.");
-    minCellTemperatureDataPoint.setUnits("C");
-    minCellTemperatureDataPoint.setMandatory(true);
-    minCellTemperatureDataPoint.setSize(1);
-    minCellTemperatureDataPoint.setAddressOffset(10);
-    minCellTemperatureDataPoint.setBlockOffset(8);
-    minCellTemperatureDataPoint.setScaleFactorName("ModTmp_SF");
-    minCellTemperatureDataPoint.setSunSpecDataType("int16");
-    minCellTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minCellTemperatureDataPoint.name(), minCellTemperatureDataPoint);
-
-    SunSpecDataPoint minCellTemperatureCellDataPoint;
-    minCellTemperatureCellDataPoint.setName("ModCellTmpMinCell");
-    minCellTemperatureCellDataPoint.setLabel("Min Cell Temperature Cell");
-    minCellTemperatureCellDataPoint.setDescription("Cell with minimum temperature.");
-    minCellTemperatureCellDataPoint.setSize(1);
-    minCellTemperatureCellDataPoint.setAddressOffset(11);
-    minCellTemperatureCellDataPoint.setBlockOffset(9);
-    minCellTemperatureCellDataPoint.setSunSpecDataType("uint16");
-    minCellTemperatureCellDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minCellTemperatureCellDataPoint.name(), minCellTemperatureCellDataPoint);
-
-    SunSpecDataPoint averageCellTemperatureDataPoint;
-    averageCellTemperatureDataPoint.setName("ModCellTmpAvg");
-    averageCellTemperatureDataPoint.setLabel("Average Cell Temperature");
-    averageCellTemperatureDataPoint.setDescription("Average temperature for all cells in the module.");
-    averageCellTemperatureDataPoint.setUnits("C");
-    averageCellTemperatureDataPoint.setMandatory(true);
-    averageCellTemperatureDataPoint.setSize(1);
-    averageCellTemperatureDataPoint.setAddressOffset(12);
-    averageCellTemperatureDataPoint.setBlockOffset(10);
-    averageCellTemperatureDataPoint.setScaleFactorName("ModTmp_SF");
-    averageCellTemperatureDataPoint.setSunSpecDataType("int16");
-    averageCellTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(averageCellTemperatureDataPoint.name(), averageCellTemperatureDataPoint);
-
-    SunSpecDataPoint pad5DataPoint;
-    pad5DataPoint.setName("Pad5");
-    pad5DataPoint.setLabel("Pad");
-    pad5DataPoint.setDescription("Pad register.");
-    pad5DataPoint.setMandatory(true);
-    pad5DataPoint.setSize(1);
-    pad5DataPoint.setAddressOffset(13);
-    pad5DataPoint.setBlockOffset(11);
-    pad5DataPoint.setSunSpecDataType("pad");
-    pad5DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pad5DataPoint.name(), pad5DataPoint);
-
-    SunSpecDataPoint pad6DataPoint;
-    pad6DataPoint.setName("Pad6");
-    pad6DataPoint.setLabel("Pad");
-    pad6DataPoint.setDescription("Pad register.");
-    pad6DataPoint.setMandatory(true);
-    pad6DataPoint.setSize(1);
-    pad6DataPoint.setAddressOffset(14);
-    pad6DataPoint.setBlockOffset(12);
-    pad6DataPoint.setSunSpecDataType("pad");
-    pad6DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pad6DataPoint.name(), pad6DataPoint);
-
-    SunSpecDataPoint pad7DataPoint;
-    pad7DataPoint.setName("Pad7");
-    pad7DataPoint.setLabel("Pad");
-    pad7DataPoint.setDescription("Pad register.");
-    pad7DataPoint.setMandatory(true);
-    pad7DataPoint.setSize(1);
-    pad7DataPoint.setAddressOffset(15);
-    pad7DataPoint.setBlockOffset(13);
-    pad7DataPoint.setSunSpecDataType("pad");
-    pad7DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pad7DataPoint.name(), pad7DataPoint);
-
+    m_dataPointMetadata = repeatingBlockDataPointMetadata;
+    m_dataPointCount = 16;
 }
 
 void SunSpecLithiumIonStringModelRepeatingBlock::processBlockData(const QVector<quint16> blockData)
 {
     m_blockData = blockData;
 
+    const quint16 *registers = m_blockData.constData();
+    const int registerCount = m_blockData.count();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("ModNCell").isValid())
-        m_moduleCellCount = m_dataPoints.value("ModNCell").toUInt16();
+    if (registerCount >= 1 && SunSpecDataPoint::isValid(registers + 0, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_moduleCellCount = SunSpecDataPoint::convertToUInt16(registers + 0, 1);
 
-    if (m_dataPoints.value("ModSoC").isValid())
-        m_moduleSoC = m_dataPoints.value("ModSoC").toFloatWithSSF(m_parentModel->soC_SF());
+    if (registerCount >= 2 && SunSpecDataPoint::isValid(registers + 1, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_moduleSoC = SunSpecDataPoint::convertToUInt16(registers + 1, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->soC_SF());
 
-    if (m_dataPoints.value("ModSoH").isValid())
-        m_moduleSoH = m_dataPoints.value("ModSoH").toFloatWithSSF(m_parentModel->soH_SF());
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_moduleSoH = SunSpecDataPoint::convertToUInt16(registers + 2, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->soH_SF());
 
-    if (m_dataPoints.value("ModCellVMax").isValid())
-        m_maxCellVoltage = m_dataPoints.value("ModCellVMax").toFloatWithSSF(m_parentModel->cellV_SF());
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxCellVoltage = SunSpecDataPoint::convertToUInt16(registers + 3, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->cellV_SF());
 
-    if (m_dataPoints.value("ModCellVMaxCell").isValid())
-        m_maxCellVoltageCell = m_dataPoints.value("ModCellVMaxCell").toUInt16();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxCellVoltageCell = SunSpecDataPoint::convertToUInt16(registers + 4, 1);
 
-    if (m_dataPoints.value("ModCellVMin").isValid())
-        m_minCellVoltage = m_dataPoints.value("ModCellVMin").toFloatWithSSF(m_parentModel->cellV_SF());
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minCellVoltage = SunSpecDataPoint::convertToUInt16(registers + 5, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->cellV_SF());
 
-    if (m_dataPoints.value("ModCellVMinCell").isValid())
-        m_minCellVoltageCell = m_dataPoints.value("ModCellVMinCell").toFloatWithSSF(m_parentModel->cellV_SF());
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minCellVoltageCell = SunSpecDataPoint::convertToUInt16(registers + 6, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->cellV_SF());
 
-    if (m_dataPoints.value("ModCellVAvg").isValid())
-        m_averageCellVoltage = m_dataPoints.value("ModCellVAvg").toFloatWithSSF(m_parentModel->cellV_SF());
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_averageCellVoltage = SunSpecDataPoint::convertToUInt16(registers + 7, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->cellV_SF());
 
-    if (m_dataPoints.value("ModCellTmpMax").isValid())
-        m_maxCellTemperature = m_dataPoints.value("ModCellTmpMax").toFloatWithSSF(m_parentModel->modTmp_SF());
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_maxCellTemperature = SunSpecDataPoint::convertToInt16(registers + 8, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->modTmp_SF());
 
-    if (m_dataPoints.value("ModCellTmpMaxCell").isValid())
-        m_maxCellTemperatureCell = m_dataPoints.value("ModCellTmpMaxCell").toUInt16();
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxCellTemperatureCell = SunSpecDataPoint::convertToUInt16(registers + 9, 1);
 
-    if (m_dataPoints.value("ModCellTmpMin").isValid())
-        m_minCellTemperature = m_dataPoints.value("ModCellTmpMin").toFloatWithSSF(m_parentModel->modTmp_SF());
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_minCellTemperature = SunSpecDataPoint::convertToInt16(registers + 10, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->modTmp_SF());
 
-    if (m_dataPoints.value("ModCellTmpMinCell").isValid())
-        m_minCellTemperatureCell = m_dataPoints.value("ModCellTmpMinCell").toUInt16();
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minCellTemperatureCell = SunSpecDataPoint::convertToUInt16(registers + 11, 1);
 
-    if (m_dataPoints.value("ModCellTmpAvg").isValid())
-        m_averageCellTemperature = m_dataPoints.value("ModCellTmpAvg").toFloatWithSSF(m_parentModel->modTmp_SF());
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 12, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_averageCellTemperature = SunSpecDataPoint::convertToInt16(registers + 12, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->modTmp_SF());
 
-    if (m_dataPoints.value("Pad5").isValid())
-        m_pad5 = m_dataPoints.value("Pad5").toUInt16();
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 13, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad5 = SunSpecDataPoint::convertToUInt16(registers + 13, 1);
 
-    if (m_dataPoints.value("Pad6").isValid())
-        m_pad6 = m_dataPoints.value("Pad6").toUInt16();
+    if (registerCount >= 15 && SunSpecDataPoint::isValid(registers + 14, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad6 = SunSpecDataPoint::convertToUInt16(registers + 14, 1);
 
-    if (m_dataPoints.value("Pad7").isValid())
-        m_pad7 = m_dataPoints.value("Pad7").toUInt16();
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 15, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad7 = SunSpecDataPoint::convertToUInt16(registers + 15, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
 }
 
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexStringIndex
+    { "Idx", "String Index", "Index of the string within the bank.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 2, 0, 1 },
+    // DataPointIndexModuleCount
+    { "NMod", "Module Count", "Count of modules in the string.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 3, 1, 1 },
+    // DataPointIndexStringStatus
+    { "St", "String Status", "Current status of the string.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, true, 4, 2, 2 },
+    // DataPointIndexConnectionFailureReason
+    { "ConFail", "Connection Failure Reason", nullptr, nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, false, 6, 4, 1 },
+    // DataPointIndexStringCellBalancingCount
+    { "NCellBal", "String Cell Balancing Count", "Number of cells currently being balanced in the string.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 7, 5, 1 },
+    // DataPointIndexStringStateOfCharge
+    { "SoC", "String State of Charge", "Battery string state of charge, expressed as a percentage.", nullptr, "%", "uint16", "SoC_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 8, 6, 1 },
+    // DataPointIndexStringDepthOfDischarge
+    { "DoD", "String Depth of Discharge", "Depth of discharge for the string, expressed as a percentage.", nullptr, "%", "uint16", "DoD_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 9, 7, 1 },
+    // DataPointIndexStringCycleCount
+    { "NCyc", "String Cycle Count", "Number of discharge cycles executed upon the string.", nullptr, nullptr, "uint32", nullptr, SunSpecDataPoint::UInt32, SunSpecDataPoint::AccessReadOnly, false, 10, 8, 2 },
+    // DataPointIndexStringStateOfHealth
+    { "SoH", "String State of Health", "Battery string state of health, expressed as a percentage.", nullptr, "%", "uint16", "SoH_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 12, 10, 1 },
+    // DataPointIndexStringCurrent
+    { "A", "String Current", "String current measurement.", nullptr, "A", "int16", "A_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 13, 11, 1 },
+    // DataPointIndexStringVoltage
+    { "V", "String Voltage", "String voltage measurement.", nullptr, "V", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 14, 12, 1 },
+    // DataPointIndexMaxCellVoltage
+    { "CellVMax", "Max Cell Voltage", "Maximum voltage for all cells in the string.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 15, 13, 1 },
+    // DataPointIndexMaxCellVoltageModule
+    { "CellVMaxMod", "Max Cell Voltage Module", "Module containing the cell with maximum cell voltage.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 16, 14, 1 },
+    // DataPointIndexMinCellVoltage
+    { "CellVMin", "Min Cell Voltage", "Minimum voltage for all cells in the string.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 17, 15, 1 },
+    // DataPointIndexMinCellVoltageModule
+    { "CellVMinMod", "Min Cell Voltage Module", "Module containing the cell with minimum cell voltage.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 18, 16, 1 },
+    // DataPointIndexAverageCellVoltage
+    { "CellVAvg", "Average Cell Voltage", "Average voltage for all cells in the string.", nullptr, "V", "uint16", "CellV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 19, 17, 1 },
+    // DataPointIndexMaxModuleTemperature
+    { "ModTmpMax", "Max Module Temperature", "Maximum temperature for all modules in the string.", nullptr, "C", "int16", "ModTmp_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 20, 18, 1 },
+    // DataPointIndexMaxModuleTemperatureModule
+    { "ModTmpMaxMod", "Max Module Temperature Module", "Module with the maximum temperature.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 21, 19, 1 },
+    // DataPointIndexMinModuleTemperature
+    { "ModTmpMin", "Min Module Temperature", "Minimum temperature for all modules in the string.", nullptr, "C", "int16", "ModTmp_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 22, 20, 1 },
+    // DataPointIndexMinModuleTemperatureModule
+    { "ModTmpMinMod", "Min Module Temperature Module", "Module with the minimum temperature.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 23, 21, 1 },
+    // DataPointIndexAverageModuleTemperature
+    { "ModTmpAvg", "Average Module Temperature", "Average temperature for all modules in the string.", nullptr, "C", "int16", "ModTmp_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 24, 22, 1 },
+    // DataPointIndexPad1
+    { "Pad1", "Pad", "Pad register.", nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, true, 25, 23, 1 },
+    // DataPointIndexContactorStatus
+    { "ConSt", "Contactor Status", "Status of the contactor(s) for the string.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 26, 24, 2 },
+    // DataPointIndexStringEvent1
+    { "Evt1", "String Event 1", "Alarms, warnings and status values.  Bit flags.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, true, 28, 26, 2 },
+    // DataPointIndexStringEvent2
+    { "Evt2", "String Event 2", "Alarms, warnings and status values.  Bit flags.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 30, 28, 2 },
+    // DataPointIndexVendorEventBitfield1
+    { "EvtVnd1", "Vendor Event Bitfield 1", "Vendor defined events.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 32, 30, 2 },
+    // DataPointIndexVendorEventBitfield2
+    { "EvtVnd2", "Vendor Event Bitfield 2", "Vendor defined events.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 34, 32, 2 },
+    // DataPointIndexEnableDisableString
+    { "SetEna", "Enable/Disable String", "Enables and disables the string.  Should reset to 0 upon completion.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, false, 36, 34, 1 },
+    // DataPointIndexConnectDisconnectString
+    { "SetCon", "Connect/Disconnect String", "Connects and disconnects the string.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, false, 37, 35, 1 },
+    // DataPointIndexSoC_SF
+    { "SoC_SF", nullptr, "Scale factor for string state of charge.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 38, 36, 1 },
+    // DataPointIndexSoH_SF
+    { "SoH_SF", nullptr, "Scale factor for string state of health.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 39, 37, 1 },
+    // DataPointIndexDoD_SF
+    { "DoD_SF", nullptr, "Scale factor for string depth of discharge.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 40, 38, 1 },
+    // DataPointIndexA_SF
+    { "A_SF", nullptr, "Scale factor for string current.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 41, 39, 1 },
+    // DataPointIndexV_SF
+    { "V_SF", nullptr, "Scale factor for string voltage.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 42, 40, 1 },
+    // DataPointIndexCellV_SF
+    { "CellV_SF", nullptr, "Scale factor for cell voltage.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 43, 41, 1 },
+    // DataPointIndexModTmp_SF
+    { "ModTmp_SF", nullptr, "Scale factor for module temperature.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 44, 42, 1 },
+    // DataPointIndexPad2
+    { "Pad2", "Pad2", "Pad register.", nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, true, 45, 43, 1 },
+    // DataPointIndexPad3
+    { "Pad3", "Pad3", "Pad register.", nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, true, 46, 44, 1 },
+    // DataPointIndexPad4
+    { "Pad4", "Pad4", "Pad register.", nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, true, 47, 45, 1 }
+};
+
 SunSpecLithiumIonStringModel::SunSpecLithiumIonStringModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 804, modelLength, byteOrder, parent)
 {
@@ -523,7 +446,7 @@ QModbusReply *SunSpecLithiumIonStringModel::setEnableDisableString(quint16 enabl
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("SetEna");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexEnableDisableString]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(enableDisableString));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -541,7 +464,7 @@ QModbusReply *SunSpecLithiumIonStringModel::setConnectDisconnectString(Setcon co
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("SetCon");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexConnectDisconnectString]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(connectDisconnectString));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -591,639 +514,169 @@ quint16 SunSpecLithiumIonStringModel::pad4() const
 }
 void SunSpecLithiumIonStringModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint stringIndexDataPoint;
-    stringIndexDataPoint.setName("Idx");
-    stringIndexDataPoint.setLabel("String Index");
-    stringIndexDataPoint.setDescription("Index of the string within the bank.");
-    stringIndexDataPoint.setMandatory(true);
-    stringIndexDataPoint.setSize(1);
-    stringIndexDataPoint.setAddressOffset(2);
-    stringIndexDataPoint.setBlockOffset(0);
-    stringIndexDataPoint.setSunSpecDataType("uint16");
-    stringIndexDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringIndexDataPoint.name(), stringIndexDataPoint);
-
-    SunSpecDataPoint moduleCountDataPoint;
-    moduleCountDataPoint.setName("NMod");
-    moduleCountDataPoint.setLabel("Module Count");
-    moduleCountDataPoint.setDescription("Count of modules in the string.");
-    moduleCountDataPoint.setMandatory(true);
-    moduleCountDataPoint.setSize(1);
-    moduleCountDataPoint.setAddressOffset(3);
-    moduleCountDataPoint.setBlockOffset(1);
-    moduleCountDataPoint.setSunSpecDataType("uint16");
-    moduleCountDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(moduleCountDataPoint.name(), moduleCountDataPoint);
-
-    SunSpecDataPoint stringStatusDataPoint;
-    stringStatusDataPoint.setName("St");
-    stringStatusDataPoint.setLabel("String Status");
-    stringStatusDataPoint.setDescription("Current status of the string.");
-    stringStatusDataPoint.setMandatory(true);
-    stringStatusDataPoint.setSize(2);
-    stringStatusDataPoint.setAddressOffset(4);
-    stringStatusDataPoint.setBlockOffset(2);
-    stringStatusDataPoint.setSunSpecDataType("bitfield32");
-    stringStatusDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringStatusDataPoint.name(), stringStatusDataPoint);
-
-    SunSpecDataPoint connectionFailureReasonDataPoint;
-    connectionFailureReasonDataPoint.setName("ConFail");
-    connectionFailureReasonDataPoint.setLabel("Connection Failure Reason");
-    connectionFailureReasonDataPoint.setSize(1);
-    connectionFailureReasonDataPoint.setAddressOffset(6);
-    connectionFailureReasonDataPoint.setBlockOffset(4);
-    connectionFailureReasonDataPoint.setSunSpecDataType("enum16");
-    connectionFailureReasonDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(connectionFailureReasonDataPoint.name(), connectionFailureReasonDataPoint);
-
-    SunSpecDataPoint stringCellBalancingCountDataPoint;
-    stringCellBalancingCountDataPoint.setName("NCellBal");
-    stringCellBalancingCountDataPoint.setLabel("String Cell Balancing Count");
-    stringCellBalancingCountDataPoint.setDescription("Number of cells currently being balanced in the string.");
-    stringCellBalancingCountDataPoint.setSize(1);
-    stringCellBalancingCountDataPoint.setAddressOffset(7);
-    stringCellBalancingCountDataPoint.setBlockOffset(5);
-    stringCellBalancingCountDataPoint.setSunSpecDataType("uint16");
-    stringCellBalancingCountDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringCellBalancingCountDataPoint.name(), stringCellBalancingCountDataPoint);
-
-    SunSpecDataPoint stringStateOfChargeDataPoint;
-    stringStateOfChargeDataPoint.setName("SoC");
-    stringStateOfChargeDataPoint.setLabel("String State of Charge");
-    stringStateOfChargeDataPoint.setDescription("Battery string state of charge, expressed as a percentage.");
-    stringStateOfChargeDataPoint.setUnits("%");
-    stringStateOfChargeDataPoint.setMandatory(true);
-    stringStateOfChargeDataPoint.setSize(1);
-    stringStateOfChargeDataPoint.setAddressOffset(8);
-    stringStateOfChargeDataPoint.setBlockOffset(6);
-    stringStateOfChargeDataPoint.setScaleFactorName("SoC_SF");
-    stringStateOfChargeDataPoint.setSunSpecDataType("uint16");
-    stringStateOfChargeDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringStateOfChargeDataPoint.name(), stringStateOfChargeDataPoint);
-
-    SunSpecDataPoint stringDepthOfDischargeDataPoint;
-    stringDepthOfDischargeDataPoint.setName("DoD");
-    stringDepthOfDischargeDataPoint.setLabel("String Depth of Discharge");
-    stringDepthOfDischargeDataPoint.setDescription("Depth of discharge for the string, expressed as a percentage.");
-    stringDepthOfDischargeDataPoint.setUnits("%");
-    stringDepthOfDischargeDataPoint.setSize(1);
-    stringDepthOfDischargeDataPoint.setAddressOffset(9);
-    stringDepthOfDischargeDataPoint.setBlockOffset(7);
-    stringDepthOfDischargeDataPoint.setScaleFactorName("DoD_SF");
-    stringDepthOfDischargeDataPoint.setSunSpecDataType("uint16");
-    stringDepthOfDischargeDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringDepthOfDischargeDataPoint.name(), stringDepthOfDischargeDataPoint);
-
-    SunSpecDataPoint stringCycleCountDataPoint;
-    stringCycleCountDataPoint.setName("NCyc");
-    stringCycleCountDataPoint.setLabel("String Cycle Count");
-    stringCycleCountDataPoint.setDescription("Number of discharge cycles executed upon the string.");
-    stringCycleCountDataPoint.setSize(2);
-    stringCycleCountDataPoint.setAddressOffset(10);
-    stringCycleCountDataPoint.setBlockOffset(8);
-    stringCycleCountDataPoint.setSunSpecDataType("uint32");
-    stringCycleCountDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringCycleCountDataPoint.name(), stringCycleCountDataPoint);
-
-    SunSpecDataPoint stringStateOfHealthDataPoint;
-    stringStateOfHealthDataPoint.setName("SoH");
-    stringStateOfHealthDataPoint.setLabel("String State of Health");
-    stringStateOfHealthDataPoint.setDescription("Battery string state of health, expressed as a percentage.");
-    stringStateOfHealthDataPoint.setUnits("%");
-    stringStateOfHealthDataPoint.setSize(1);
-    stringStateOfHealthDataPoint.setAddressOffset(12);
-    stringStateOfHealthDataPoint.setBlockOffset(10);
-    stringStateOfHealthDataPoint.setScaleFactorName("SoH_SF");
-    stringStateOfHealthDataPoint.setSunSpecDataType("uint16");
-    stringStateOfHealthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringStateOfHealthDataPoint.name(), stringStateOfHealthDataPoint);
-
-    SunSpecDataPoint stringCurrentDataPoint;
-    stringCurrentDataPoint.setName("A");
-    stringCurrentDataPoint.setLabel("String Current");
-    stringCurrentDataPoint.setDescription("String current measurement.");
-    stringCurrentDataPoint.setUnits("A");
-    stringCurrentDataPoint.setMandatory(true);
-    stringCurrentDataPoint.setSize(1);
-    stringCurrentDataPoint.setAddressOffset(13);
-    stringCurrentDataPoint.setBlockOffset(11);
-    stringCurrentDataPoint.setScaleFactorName("A_SF");
-    stringCurrentDataPoint.setSunSpecDataType("int16");
-    stringCurrentDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringCurrentDataPoint.name(), stringCurrentDataPoint);
-
-    SunSpecDataPoint stringVoltageDataPoint;
-    stringVoltageDataPoint.setName("V");
-    stringVoltageDataPoint.setLabel("String Voltage");
-    stringVoltageDataPoint.setDescription("String voltage measurement.");
-    stringVoltageDataPoint.setUnits("V");
-    stringVoltageDataPoint.setSize(1);
-    stringVoltageDataPoint.setAddressOffset(14);
-    stringVoltageDataPoint.setBlockOffset(12);
-    stringVoltageDataPoint.setScaleFactorName("V_SF");
-    stringVoltageDataPoint.setSunSpecDataType("uint16");
-    stringVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringVoltageDataPoint.name(), stringVoltageDataPoint);
-
-    SunSpecDataPoint maxCellVoltageDataPoint;
-    maxCellVoltageDataPoint.setName("CellVMax");
-    maxCellVoltageDataPoint.setLabel("Max Cell Voltage");
-    maxCellVoltageDataPoint.setDescription("Maximum voltage for all cells in the string.");
-    maxCellVoltageDataPoint.setUnits("V");
-    maxCellVoltageDataPoint.setMandatory(true);
-    maxCellVoltageDataPoint.setSize(1);
-    maxCellVoltageDataPoint.setAddressOffset(15);
-    maxCellVoltageDataPoint.setBlockOffset(13);
-    maxCellVoltageDataPoint.setScaleFactorName("CellV_SF");
-    maxCellVoltageDataPoint.setSunSpecDataType("uint16");
-    maxCellVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxCellVoltageDataPoint.name(), maxCellVoltageDataPoint);
-
-    SunSpecDataPoint maxCellVoltageModuleDataPoint;
-    maxCellVoltageModuleDataPoint.setName("CellVMaxMod");
-    maxCellVoltageModuleDataPoint.setLabel("Max Cell Voltage Module");
-    maxCellVoltageModuleDataPoint.setDescription("Module containing the cell with maximum cell voltage.");
-    maxCellVoltageModuleDataPoint.setSize(1);
-    maxCellVoltageModuleDataPoint.setAddressOffset(16);
-    maxCellVoltageModuleDataPoint.setBlockOffset(14);
-    maxCellVoltageModuleDataPoint.setSunSpecDataType("uint16");
-    maxCellVoltageModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxCellVoltageModuleDataPoint.name(), maxCellVoltageModuleDataPoint);
-
-    SunSpecDataPoint minCellVoltageDataPoint;
-    minCellVoltageDataPoint.setName("CellVMin");
-    minCellVoltageDataPoint.setLabel("Min Cell Voltage");
-    minCellVoltageDataPoint.setDescription("Minimum voltage for all cells in the string.");
-    minCellVoltageDataPoint.setUnits("V");
-    minCellVoltageDataPoint.setMandatory(true);
-    minCellVoltageDataPoint.setSize(1);
-    minCellVoltageDataPoint.setAddressOffset(17);
-    minCellVoltageDataPoint.setBlockOffset(15);
-    minCellVoltageDataPoint.setScaleFactorName("CellV_SF");
-    minCellVoltageDataPoint.setSunSpecDataType("uint16");
-    minCellVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minCellVoltageDataPoint.name(), minCellVoltageDataPoint);
-
-    SunSpecDataPoint minCellVoltageModuleDataPoint;
-    minCellVoltageModuleDataPoint.setName("CellVMinMod");
-    minCellVoltageModuleDataPoint.setLabel("Min Cell Voltage Module");
-    minCellVoltageModuleDataPoint.setDescription("Module containing the cell with minimum cell voltage.");
-    minCellVoltageModuleDataPoint.setSize(1);
-    minCellVoltageModuleDataPoint.setAddressOffset(18);
-    minCellVoltageModuleDataPoint.setBlockOffset(16);
-    minCellVoltageModuleDataPoint.setSunSpecDataType("uint16");
-    minCellVoltageModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minCellVoltageModuleDataPoint.name(), minCellVoltageModuleDataPoint);
-
-    SunSpecDataPoint averageCellVoltageDataPoint;
-    averageCellVoltageDataPoint.setName("CellVAvg");
-    averageCellVoltageDataPoint.setLabel("Average Cell Voltage");
-    averageCellVoltageDataPoint.setDescription("Average voltage for all cells in the string.");
-    averageCellVoltageDataPoint.setUnits("V");
-    averageCellVoltageDataPoint.setMandatory(true);
-    averageCellVoltageDataPoint.setSize(1);
-    averageCellVoltageDataPoint.setAddressOffset(19);
-    averageCellVoltageDataPoint.setBlockOffset(17);
-    averageCellVoltageDataPoint.setScaleFactorName("CellV_SF");
-    averageCellVoltageDataPoint.setSunSpecDataType("uint16");
-    averageCellVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(averageCellVoltageDataPoint.name(), averageCellVoltageDataPoint);
-
-    SunSpecDataPoint maxModuleTemperatureDataPoint;
-    maxModuleTemperatureDataPoint.setName("ModTmpMax");
-    maxModuleTemperatureDataPoint.setLabel("Max Module Temperature");
-    maxModuleTemperatureDataPoint.setDescription("Maximum temperature for all modules in the string.");
-    maxModuleTemperatureDataPoint.setUnits("C");
-    maxModuleTemperatureDataPoint.setMandatory(true);
-    maxModuleTemperatureDataPoint.setSize(1);
-    maxModuleTemperatureDataPoint.setAddressOffset(20);
-    maxModuleTemperatureDataPoint.setBlockOffset(18);
-    maxModuleTemperatureDataPoint.setScaleFactorName("ModTmp_SF");
-    maxModuleTemperatureDataPoint.setSunSpecDataType("int16");
-    maxModuleTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxModuleTemperatureDataPoint.name(), maxModuleTemperatureDataPoint);
-
-    SunSpecDataPoint maxModuleTemperatureModuleDataPoint;
-    maxModuleTemperatureModuleDataPoint.setName("ModTmpMaxMod");
-    maxModuleTemperatureModuleDataPoint.setLabel("Max Module Temperature Module");
-    maxModuleTemperatureModuleDataPoint.setDescription("Module with the maximum temperature.");
-    maxModuleTemperatureModuleDataPoint.setMandatory(true);
-    maxModuleTemperatureModuleDataPoint.setSize(1);
-    maxModuleTemperatureModuleDataPoint.setAddressOffset(21);
-    maxModuleTemperatureModuleDataPoint.setBlockOffset(19);
-    maxModuleTemperatureModuleDataPoint.setSunSpecDataType("uint16");
-    maxModuleTemperatureModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxModuleTemperatureModuleDataPoint.name(), maxModuleTemperatureModuleDataPoint);
-
-    SunSpecDataPoint minModuleTemperatureDataPoint;
-    minModuleTemperatureDataPoint.setName("ModTmpMin");
-    minModuleTemperatureDataPoint.setLabel("Min Module Temperature");
-    minModuleTemperatureDataPoint.setDescription("Minimum temperature for all modules in the string.");
-    minModuleTemperatureDataPoint.setUnits("C");
-    minModuleTemperatureDataPoint.setMandatory(true);
-    minModuleTemperatureDataPoint.setSize(1);
-    minModuleTemperatureDataPoint.setAddressOffset(22);
-    minModuleTemperatureDataPoint.setBlockOffset(20);
-    minModuleTemperatureDataPoint.setScaleFactorName("ModTmp_SF");
-    minModuleTemperatureDataPoint.setSunSpecDataType("int16");
-    minModuleTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minModuleTemperatureDataPoint.name(), minModuleTemperatureDataPoint);
-
-    SunSpecDataPoint minModuleTemperatureModuleDataPoint;
-    minModuleTemperatureModuleDataPoint.setName("ModTmpMinMod");
-    minModuleTemperatureModuleDataPoint.setLabel("Min Module Temperature Module");
-    minModuleTemperatureModuleDataPoint.setDescription("Module with the minimum temperature.");
-    minModuleTemperatureModuleDataPoint.setMandatory(true);
-    minModuleTemperatureModuleDataPoint.setSize(1);
-    minModuleTemperatureModuleDataPoint.setAddressOffset(23);
-    minModuleTemperatureModuleDataPoint.setBlockOffset(21);
-    minModuleTemperatureModuleDataPoint.setSunSpecDataType("uint16");
-    minModuleTemperatureModuleDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minModuleTemperatureModuleDataPoint.name(), minModuleTemperatureModuleDataPoint);
-
-    SunSpecDataPoint averageModuleTemperatureDataPoint;
-    averageModuleTemperatureDataPoint.setName("ModTmpAvg");
-    averageModuleTemperatureDataPoint.setLabel("Average Module Temperature");
-    averageModuleTemperatureDataPoint.setDescription("Average temperature for all modules in the string.");
-    averageModuleTemperatureDataPoint.setUnits("C");
-    averageModuleTemperatureDataPoint.setMandatory(true);
-    averageModuleTemperatureDataPoint.setSize(1);
-    averageModuleTemperatureDataPoint.setAddressOffset(24);
-    averageModuleTemperatureDataPoint.setBlockOffset(22);
-    averageModuleTemperatureDataPoint.setScaleFactorName("ModTmp_SF");
-    averageModuleTemperatureDataPoint.setSunSpecDataType("int16");
-    averageModuleTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(averageModuleTemperatureDataPoint.name(), averageModuleTemperatureDataPoint);
-
-    SunSpecDataPoint pad1DataPoint;
-    pad1DataPoint.setName("Pad1");
-    pad1DataPoint.setLabel("Pad");
-    pad1DataPoint.setDescription("Pad register.");
-    pad1DataPoint.setMandatory(true);
-    pad1DataPoint.setSize(1);
-    pad1DataPoint.setAddressOffset(25);
-    pad1DataPoint.setBlockOffset(23);
-    pad1DataPoint.setSunSpecDataType("pad");
-    pad1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pad1DataPoint.name(), pad1DataPoint);
-
-    SunSpecDataPoint contactorStatusDataPoint;
-    contactorStatusDataPoint.setName("ConSt");
-    contactorStatusDataPoint.setLabel("Contactor Status");
-    contactorStatusDataPoint.setDescription("Status of the contactor(s) for the string.");
-    contactorStatusDataPoint.setSize(2);
-    contactorStatusDataPoint.setAddressOffset(26);
-    contactorStatusDataPoint.setBlockOffset(24);
-    contactorStatusDataPoint.setSunSpecDataType("bitfield32");
-    contactorStatusDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(contactorStatusDataPoint.name(), contactorStatusDataPoint);
-
-    SunSpecDataPoint stringEvent1DataPoint;
-    stringEvent1DataPoint.setName("Evt1");
-    stringEvent1DataPoint.setLabel("String Event 1");
-    stringEvent1DataPoint.setDescription("Alarms, warnings and status values.  Bit flags.");
-    stringEvent1DataPoint.setMandatory(true);
-    stringEvent1DataPoint.setSize(2);
-    stringEvent1DataPoint.setAddressOffset(28);
-    stringEvent1DataPoint.setBlockOffset(26);
-    stringEvent1DataPoint.setSunSpecDataType("bitfield32");
-    stringEvent1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringEvent1DataPoint.name(), stringEvent1DataPoint);
-
-    SunSpecDataPoint stringEvent2DataPoint;
-    stringEvent2DataPoint.setName("Evt2");
-    stringEvent2DataPoint.setLabel("String Event 2");
-    stringEvent2DataPoint.setDescription("Alarms, warnings and status values.  Bit flags.");
-    stringEvent2DataPoint.setSize(2);
-    stringEvent2DataPoint.setAddressOffset(30);
-    stringEvent2DataPoint.setBlockOffset(28);
-    stringEvent2DataPoint.setSunSpecDataType("bitfield32");
-    stringEvent2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stringEvent2DataPoint.name(), stringEvent2DataPoint);
-
-    SunSpecDataPoint vendorEventBitfield1DataPoint;
-    vendorEventBitfield1DataPoint.setName("EvtVnd1");
-    vendorEventBitfield1DataPoint.setLabel("Vendor Event Bitfield 1");
-    vendorEventBitfield1DataPoint.setDescription("Vendor defined events.");
-    vendorEventBitfield1DataPoint.setSize(2);
-    vendorEventBitfield1DataPoint.setAddressOffset(32);
-    vendorEventBitfield1DataPoint.setBlockOffset(30);
-    vendorEventBitfield1DataPoint.setSunSpecDataType("bitfield32");
-    vendorEventBitfield1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vendorEventBitfield1DataPoint.name(), vendorEventBitfield1DataPoint);
-
-    SunSpecDataPoint vendorEventBitfield2DataPoint;
-    vendorEventBitfield2DataPoint.setName("EvtVnd2");
-    vendorEventBitfield2DataPoint.setLabel("Vendor Event Bitfield 2");
-    vendorEventBitfield2DataPoint.setDescription("Vendor defined events.");
-    vendorEventBitfield2DataPoint.setSize(2);
-    vendorEventBitfield2DataPoint.setAddressOffset(34);
-    vendorEventBitfield2DataPoint.setBlockOffset(32);
-    vendorEventBitfield2DataPoint.setSunSpecDataType("bitfield32");
-    vendorEventBitfield2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vendorEventBitfield2DataPoint.name(), vendorEventBitfield2DataPoint);
-
-    SunSpecDataPoint enableDisableStringDataPoint;
-    enableDisableStringDataPoint.setName("SetEna");
-    enableDisableStringDataPoint.setLabel("Enable/Disable String");
-    enableDisableStringDataPoint.setDescription("Enables and disables the string.  Should reset to 0 upon completion.");
-    enableDisableStringDataPoint.setSize(1);
-    enableDisableStringDataPoint.setAddressOffset(36);
-    enableDisableStringDataPoint.setBlockOffset(34);
-    enableDisableStringDataPoint.setSunSpecDataType("enum16");
-    enableDisableStringDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    enableDisableStringDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(enableDisableStringDataPoint.name(), enableDisableStringDataPoint);
-
-    SunSpecDataPoint connectDisconnectStringDataPoint;
-    connectDisconnectStringDataPoint.setName("SetCon");
-    connectDisconnectStringDataPoint.setLabel("Connect/Disconnect String");
-    connectDisconnectStringDataPoint.setDescription("Connects and disconnects the string.");
-    connectDisconnectStringDataPoint.setSize(1);
-    connectDisconnectStringDataPoint.setAddressOffset(37);
-    connectDisconnectStringDataPoint.setBlockOffset(35);
-    connectDisconnectStringDataPoint.setSunSpecDataType("enum16");
-    connectDisconnectStringDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    connectDisconnectStringDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(connectDisconnectStringDataPoint.name(), connectDisconnectStringDataPoint);
-
-    SunSpecDataPoint soC_SFDataPoint;
-    soC_SFDataPoint.setName("SoC_SF");
-    soC_SFDataPoint.setDescription("Scale factor for string state of charge.");
-    soC_SFDataPoint.setMandatory(true);
-    soC_SFDataPoint.setSize(1);
-    soC_SFDataPoint.setAddressOffset(38);
-    soC_SFDataPoint.setBlockOffset(36);
-    soC_SFDataPoint.setSunSpecDataType("sunssf");
-    soC_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(soC_SFDataPoint.name(), soC_SFDataPoint);
-
-    SunSpecDataPoint soH_SFDataPoint;
-    soH_SFDataPoint.setName("SoH_SF");
-    soH_SFDataPoint.setDescription("Scale factor for string state of health.");
-    soH_SFDataPoint.setSize(1);
-    soH_SFDataPoint.setAddressOffset(39);
-    soH_SFDataPoint.setBlockOffset(37);
-    soH_SFDataPoint.setSunSpecDataType("sunssf");
-    soH_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(soH_SFDataPoint.name(), soH_SFDataPoint);
-
-    SunSpecDataPoint doD_SFDataPoint;
-    doD_SFDataPoint.setName("DoD_SF");
-    doD_SFDataPoint.setDescription("Scale factor for string depth of discharge.");
-    doD_SFDataPoint.setSize(1);
-    doD_SFDataPoint.setAddressOffset(40);
-    doD_SFDataPoint.setBlockOffset(38);
-    doD_SFDataPoint.setSunSpecDataType("sunssf");
-    doD_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(doD_SFDataPoint.name(), doD_SFDataPoint);
-
-    SunSpecDataPoint a_SFDataPoint;
-    a_SFDataPoint.setName("A_SF");
-    a_SFDataPoint.setDescription("Scale factor for string current.");
-    a_SFDataPoint.setMandatory(true);
-    a_SFDataPoint.setSize(1);
-    a_SFDataPoint.setAddressOffset(41);
-    a_SFDataPoint.setBlockOffset(39);
-    a_SFDataPoint.setSunSpecDataType("sunssf");
-    a_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(a_SFDataPoint.name(), a_SFDataPoint);
-
-    SunSpecDataPoint v_SFDataPoint;
-    v_SFDataPoint.setName("V_SF");
-    v_SFDataPoint.setDescription("Scale factor for string voltage.");
-    v_SFDataPoint.setSize(1);
-    v_SFDataPoint.setAddressOffset(42);
-    v_SFDataPoint.setBlockOffset(40);
-    v_SFDataPoint.setSunSpecDataType("sunssf");
-    v_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v_SFDataPoint.name(), v_SFDataPoint);
-
-    SunSpecDataPoint cellV_SFDataPoint;
-    cellV_SFDataPoint.setName("CellV_SF");
-    cellV_SFDataPoint.setDescription("Scale factor for cell voltage.");
-    cellV_SFDataPoint.setMandatory(true);
-    cellV_SFDataPoint.setSize(1);
-    cellV_SFDataPoint.setAddressOffset(43);
-    cellV_SFDataPoint.setBlockOffset(41);
-    cellV_SFDataPoint.setSunSpecDataType("sunssf");
-    cellV_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(cellV_SFDataPoint.name(), cellV_SFDataPoint);
-
-    SunSpecDataPoint modTmp_SFDataPoint;
-    modTmp_SFDataPoint.setName("ModTmp_SF");
-    modTmp_SFDataPoint.setDescription("Scale factor for module temperature.");
-    modTmp_SFDataPoint.setMandatory(true);
-    modTmp_SFDataPoint.setSize(1);
-    modTmp_SFDataPoint.setAddressOffset(44);
-    modTmp_SFDataPoint.setBlockOffset(42);
-    modTmp_SFDataPoint.setSunSpecDataType("sunssf");
-    modTmp_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modTmp_SFDataPoint.name(), modTmp_SFDataPoint);
-
-    SunSpecDataPoint pad2DataPoint;
-    pad2DataPoint.setName("Pad2");
-    pad2DataPoint.setLabel("Pad2");
-    pad2DataPoint.setDescription("Pad register.");
-    pad2DataPoint.setMandatory(true);
-    pad2DataPoint.setSize(1);
-    pad2DataPoint.setAddressOffset(45);
-    pad2DataPoint.setBlockOffset(43);
-    pad2DataPoint.setSunSpecDataType("pad");
-    pad2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pad2DataPoint.name(), pad2DataPoint);
-
-    SunSpecDataPoint pad3DataPoint;
-    pad3DataPoint.setName("Pad3");
-    pad3DataPoint.setLabel("Pad3");
-    pad3DataPoint.setDescription("Pad register.");
-    pad3DataPoint.setMandatory(true);
-    pad3DataPoint.setSize(1);
-    pad3DataPoint.setAddressOffset(46);
-    pad3DataPoint.setBlockOffset(44);
-    pad3DataPoint.setSunSpecDataType("pad");
-    pad3DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pad3DataPoint.name(), pad3DataPoint);
-
-    SunSpecDataPoint pad4DataPoint;
-    pad4DataPoint.setName("Pad4");
-    pad4DataPoint.setLabel("Pad4");
-    pad4DataPoint.setDescription("Pad register.");
-    pad4DataPoint.setMandatory(true);
-    pad4DataPoint.setSize(1);
-    pad4DataPoint.setAddressOffset(47);
-    pad4DataPoint.setBlockOffset(45);
-    pad4DataPoint.setSunSpecDataType("pad");
-    pad4DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pad4DataPoint.name(), pad4DataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 41;
 }
 
 void SunSpecLithiumIonStringModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("SoC_SF").isValid())
-        m_soC_SF = m_dataPoints.value("SoC_SF").toInt16();
+    if (registerCount >= 39 && SunSpecDataPoint::isValid(registers + 38, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 38, 1);
+        if (scaleFactor != m_soC_SF) {
+            m_soC_SF = scaleFactor;
+            m_soC_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("SoH_SF").isValid())
-        m_soH_SF = m_dataPoints.value("SoH_SF").toInt16();
+    if (registerCount >= 40 && SunSpecDataPoint::isValid(registers + 39, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 39, 1);
+        if (scaleFactor != m_soH_SF) {
+            m_soH_SF = scaleFactor;
+            m_soH_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("DoD_SF").isValid())
-        m_doD_SF = m_dataPoints.value("DoD_SF").toInt16();
+    if (registerCount >= 41 && SunSpecDataPoint::isValid(registers + 40, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 40, 1);
+        if (scaleFactor != m_doD_SF) {
+            m_doD_SF = scaleFactor;
+            m_doD_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("A_SF").isValid())
-        m_a_SF = m_dataPoints.value("A_SF").toInt16();
+    if (registerCount >= 42 && SunSpecDataPoint::isValid(registers + 41, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 41, 1);
+        if (scaleFactor != m_a_SF) {
+            m_a_SF = scaleFactor;
+            m_a_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("V_SF").isValid())
-        m_v_SF = m_dataPoints.value("V_SF").toInt16();
+    if (registerCount >= 43 && SunSpecDataPoint::isValid(registers + 42, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 42, 1);
+        if (scaleFactor != m_v_SF) {
+            m_v_SF = scaleFactor;
+            m_v_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("CellV_SF").isValid())
-        m_cellV_SF = m_dataPoints.value("CellV_SF").toInt16();
+    if (registerCount >= 44 && SunSpecDataPoint::isValid(registers + 43, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 43, 1);
+        if (scaleFactor != m_cellV_SF) {
+            m_cellV_SF = scaleFactor;
+            m_cellV_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("ModTmp_SF").isValid())
-        m_modTmp_SF = m_dataPoints.value("ModTmp_SF").toInt16();
+    if (registerCount >= 45 && SunSpecDataPoint::isValid(registers + 44, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 44, 1);
+        if (scaleFactor != m_modTmp_SF) {
+            m_modTmp_SF = scaleFactor;
+            m_modTmp_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("Idx").isValid())
-        m_stringIndex = m_dataPoints.value("Idx").toUInt16();
-
-    if (m_dataPoints.value("NMod").isValid())
-        m_moduleCount = m_dataPoints.value("NMod").toUInt16();
-
-    if (m_dataPoints.value("St").isValid())
-        m_stringStatus = static_cast<StFlags>(m_dataPoints.value("St").toUInt32());
-
-    if (m_dataPoints.value("ConFail").isValid())
-        m_connectionFailureReason = static_cast<Confail>(m_dataPoints.value("ConFail").toUInt16());
-
-    if (m_dataPoints.value("NCellBal").isValid())
-        m_stringCellBalancingCount = m_dataPoints.value("NCellBal").toUInt16();
-
-    if (m_dataPoints.value("SoC").isValid())
-        m_stringStateOfCharge = m_dataPoints.value("SoC").toFloatWithSSF(m_soC_SF);
-
-    if (m_dataPoints.value("DoD").isValid())
-        m_stringDepthOfDischarge = m_dataPoints.value("DoD").toFloatWithSSF(m_doD_SF);
-
-    if (m_dataPoints.value("NCyc").isValid())
-        m_stringCycleCount = m_dataPoints.value("NCyc").toUInt32();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_stringIndex = SunSpecDataPoint::convertToUInt16(registers + 2, 1);
 
-    if (m_dataPoints.value("SoH").isValid())
-        m_stringStateOfHealth = m_dataPoints.value("SoH").toFloatWithSSF(m_soH_SF);
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_moduleCount = SunSpecDataPoint::convertToUInt16(registers + 3, 1);
 
-    if (m_dataPoints.value("A").isValid())
-        m_stringCurrent = m_dataPoints.value("A").toFloatWithSSF(m_a_SF);
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 4, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_stringStatus = static_cast<StFlags>(SunSpecDataPoint::convertToUInt32(registers + 4, 2, m_byteOrder));
 
-    if (m_dataPoints.value("V").isValid())
-        m_stringVoltage = m_dataPoints.value("V").toFloatWithSSF(m_v_SF);
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_connectionFailureReason = static_cast<Confail>(SunSpecDataPoint::convertToUInt16(registers + 6, 1));
 
-    if (m_dataPoints.value("CellVMax").isValid())
-        m_maxCellVoltage = m_dataPoints.value("CellVMax").toFloatWithSSF(m_cellV_SF);
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_stringCellBalancingCount = SunSpecDataPoint::convertToUInt16(registers + 7, 1);
 
-    if (m_dataPoints.value("CellVMaxMod").isValid())
-        m_maxCellVoltageModule = m_dataPoints.value("CellVMaxMod").toUInt16();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_stringStateOfCharge = SunSpecDataPoint::convertToUInt16(registers + 8, 1) * m_soC_SFMultiplier;
 
-    if (m_dataPoints.value("CellVMin").isValid())
-        m_minCellVoltage = m_dataPoints.value("CellVMin").toFloatWithSSF(m_cellV_SF);
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_stringDepthOfDischarge = SunSpecDataPoint::convertToUInt16(registers + 9, 1) * m_doD_SFMultiplier;
 
-    if (m_dataPoints.value("CellVMinMod").isValid())
-        m_minCellVoltageModule = m_dataPoints.value("CellVMinMod").toUInt16();
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 10, 2, SunSpecDataPoint::UInt32, m_byteOrder))
+        m_stringCycleCount = SunSpecDataPoint::convertToUInt32(registers + 10, 2, m_byteOrder);
 
-    if (m_dataPoints.value("CellVAvg").isValid())
-        m_averageCellVoltage = m_dataPoints.value("CellVAvg").toFloatWithSSF(m_cellV_SF);
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 12, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_stringStateOfHealth = SunSpecDataPoint::convertToUInt16(registers + 12, 1) * m_soH_SFMultiplier;
 
-    if (m_dataPoints.value("ModTmpMax").isValid())
-        m_maxModuleTemperature = m_dataPoints.value("ModTmpMax").toFloatWithSSF(m_modTmp_SF);
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 13, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_stringCurrent = SunSpecDataPoint::convertToInt16(registers + 13, 1) * m_a_SFMultiplier;
 
-    if (m_dataPoints.value("ModTmpMaxMod").isValid())
-        m_maxModuleTemperatureModule = m_dataPoints.value("ModTmpMaxMod").toUInt16();
+    if (registerCount >= 15 && SunSpecDataPoint::isValid(registers + 14, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_stringVoltage = SunSpecDataPoint::convertToUInt16(registers + 14, 1) * m_v_SFMultiplier;
 
-    if (m_dataPoints.value("ModTmpMin").isValid())
-        m_minModuleTemperature = m_dataPoints.value("ModTmpMin").toFloatWithSSF(m_modTmp_SF);
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 15, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxCellVoltage = SunSpecDataPoint::convertToUInt16(registers + 15, 1) * m_cellV_SFMultiplier;
 
-    if (m_dataPoints.value("ModTmpMinMod").isValid())
-        m_minModuleTemperatureModule = m_dataPoints.value("ModTmpMinMod").toUInt16();
+    if (registerCount >= 17 && SunSpecDataPoint::isValid(registers + 16, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxCellVoltageModule = SunSpecDataPoint::convertToUInt16(registers + 16, 1);
 
-    if (m_dataPoints.value("ModTmpAvg").isValid())
-        m_averageModuleTemperature = m_dataPoints.value("ModTmpAvg").toFloatWithSSF(m_modTmp_SF);
+    if (registerCount >= 18 && SunSpecDataPoint::isValid(registers + 17, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minCellVoltage = SunSpecDataPoint::convertToUInt16(registers + 17, 1) * m_cellV_SFMultiplier;
 
-    if (m_dataPoints.value("Pad1").isValid())
-        m_pad1 = m_dataPoints.value("Pad1").toUInt16();
+    if (registerCount >= 19 && SunSpecDataPoint::isValid(registers + 18, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minCellVoltageModule = SunSpecDataPoint::convertToUInt16(registers + 18, 1);
 
-    if (m_dataPoints.value("ConSt").isValid())
-        m_contactorStatus = static_cast<ConstFlags>(m_dataPoints.value("ConSt").toUInt32());
+    if (registerCount >= 20 && SunSpecDataPoint::isValid(registers + 19, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_averageCellVoltage = SunSpecDataPoint::convertToUInt16(registers + 19, 1) * m_cellV_SFMultiplier;
 
-    if (m_dataPoints.value("Evt1").isValid())
-        m_stringEvent1 = static_cast<Evt1Flags>(m_dataPoints.value("Evt1").toUInt32());
+    if (registerCount >= 21 && SunSpecDataPoint::isValid(registers + 20, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_maxModuleTemperature = SunSpecDataPoint::convertToInt16(registers + 20, 1) * m_modTmp_SFMultiplier;
 
-    if (m_dataPoints.value("Evt2").isValid())
-        m_stringEvent2 = m_dataPoints.value("Evt2").toUInt32();
+    if (registerCount >= 22 && SunSpecDataPoint::isValid(registers + 21, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxModuleTemperatureModule = SunSpecDataPoint::convertToUInt16(registers + 21, 1);
 
-    if (m_dataPoints.value("EvtVnd1").isValid())
-        m_vendorEventBitfield1 = m_dataPoints.value("EvtVnd1").toUInt32();
+    if (registerCount >= 23 && SunSpecDataPoint::isValid(registers + 22, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_minModuleTemperature = SunSpecDataPoint::convertToInt16(registers + 22, 1) * m_modTmp_SFMultiplier;
 
-    if (m_dataPoints.value("EvtVnd2").isValid())
-        m_vendorEventBitfield2 = m_dataPoints.value("EvtVnd2").toUInt32();
+    if (registerCount >= 24 && SunSpecDataPoint::isValid(registers + 23, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minModuleTemperatureModule = SunSpecDataPoint::convertToUInt16(registers + 23, 1);
 
-    if (m_dataPoints.value("SetEna").isValid())
-        m_enableDisableString = m_dataPoints.value("SetEna").toUInt16();
+    if (registerCount >= 25 && SunSpecDataPoint::isValid(registers + 24, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_averageModuleTemperature = SunSpecDataPoint::convertToInt16(registers + 24, 1) * m_modTmp_SFMultiplier;
 
-    if (m_dataPoints.value("SetCon").isValid())
-        m_connectDisconnectString = static_cast<Setcon>(m_dataPoints.value("SetCon").toUInt16());
+    if (registerCount >= 26 && SunSpecDataPoint::isValid(registers + 25, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad1 = SunSpecDataPoint::convertToUInt16(registers + 25, 1);
 
-    if (m_dataPoints.value("SoC_SF").isValid())
-        m_soC_SF = m_dataPoints.value("SoC_SF").toInt16();
+    if (registerCount >= 28 && SunSpecDataPoint::isValid(registers + 26, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_contactorStatus = static_cast<ConstFlags>(SunSpecDataPoint::convertToUInt32(registers + 26, 2, m_byteOrder));
 
-    if (m_dataPoints.value("SoH_SF").isValid())
-        m_soH_SF = m_dataPoints.value("SoH_SF").toInt16();
+    if (registerCount >= 30 && SunSpecDataPoint::isValid(registers + 28, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_stringEvent1 = static_cast<Evt1Flags>(SunSpecDataPoint::convertToUInt32(registers + 28, 2, m_byteOrder));
 
-    if (m_dataPoints.value("DoD_SF").isValid())
-        m_doD_SF = m_dataPoints.value("DoD_SF").toInt16();
+    if (registerCount >= 32 && SunSpecDataPoint::isValid(registers + 30, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_stringEvent2 = SunSpecDataPoint::convertToUInt32(registers + 30, 2, m_byteOrder);
 
-    if (m_dataPoints.value("A_SF").isValid())
-        m_a_SF = m_dataPoints.value("A_SF").toInt16();
+    if (registerCount >= 34 && SunSpecDataPoint::isValid(registers + 32, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_vendorEventBitfield1 = SunSpecDataPoint::convertToUInt32(registers + 32, 2, m_byteOrder);
 
-    if (m_dataPoints.value("V_SF").isValid())
-        m_v_SF = m_dataPoints.value("V_SF").toInt16();
+    if (registerCount >= 36 && SunSpecDataPoint::isValid(registers + 34, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_vendorEventBitfield2 = SunSpecDataPoint::convertToUInt32(registers + 34, 2, m_byteOrder);
 
-    if (m_dataPoints.value("CellV_SF").isValid())
-        m_cellV_SF = m_dataPoints.value("CellV_SF").toInt16();
+    if (registerCount >= 37 && SunSpecDataPoint::isValid(registers + 36, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_enableDisableString = SunSpecDataPoint::convertToUInt16(registers + 36, 1);
 
-    if (m_dataPoints.value("ModTmp_SF").isValid())
-        m_modTmp_SF = m_dataPoints.value("ModTmp_SF").toInt16();
+    if (registerCount >= 38 && SunSpecDataPoint::isValid(registers + 37, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_connectDisconnectString = static_cast<Setcon>(SunSpecDataPoint::convertToUInt16(registers + 37, 1));
 
-    if (m_dataPoints.value("Pad2").isValid())
-        m_pad2 = m_dataPoints.value("Pad2").toUInt16();
+    if (registerCount >= 46 && SunSpecDataPoint::isValid(registers + 45, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad2 = SunSpecDataPoint::convertToUInt16(registers + 45, 1);
 
-    if (m_dataPoints.value("Pad3").isValid())
-        m_pad3 = m_dataPoints.value("Pad3").toUInt16();
+    if (registerCount >= 47 && SunSpecDataPoint::isValid(registers + 46, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad3 = SunSpecDataPoint::convertToUInt16(registers + 46, 1);
 
-    if (m_dataPoints.value("Pad4").isValid())
-        m_pad4 = m_dataPoints.value("Pad4").toUInt16();
+    if (registerCount >= 48 && SunSpecDataPoint::isValid(registers + 47, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad4 = SunSpecDataPoint::convertToUInt16(registers + 47, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -1232,225 +685,225 @@ void SunSpecLithiumIonStringModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecLithiumIonStringModel *model)
 {
     debug.nospace().noquote() << "SunSpecLithiumIonStringModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Idx") << "-->";
-    if (model->dataPoints().value("Idx").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringIndex) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringIndex).isValid()) {
         debug.nospace().noquote() << model->stringIndex() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NMod") << "-->";
-    if (model->dataPoints().value("NMod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexModuleCount) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexModuleCount).isValid()) {
         debug.nospace().noquote() << model->moduleCount() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("St") << "-->";
-    if (model->dataPoints().value("St").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringStatus) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringStatus).isValid()) {
         debug.nospace().noquote() << model->stringStatus() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ConFail") << "-->";
-    if (model->dataPoints().value("ConFail").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexConnectionFailureReason) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexConnectionFailureReason).isValid()) {
         debug.nospace().noquote() << model->connectionFailureReason() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NCellBal") << "-->";
-    if (model->dataPoints().value("NCellBal").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringCellBalancingCount) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringCellBalancingCount).isValid()) {
         debug.nospace().noquote() << model->stringCellBalancingCount() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("SoC") << "-->";
-    if (model->dataPoints().value("SoC").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringStateOfCharge) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringStateOfCharge).isValid()) {
         debug.nospace().noquote() << model->stringStateOfCharge() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("DoD") << "-->";
-    if (model->dataPoints().value("DoD").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringDepthOfDischarge) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringDepthOfDischarge).isValid()) {
         debug.nospace().noquote() << model->stringDepthOfDischarge() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NCyc") << "-->";
-    if (model->dataPoints().value("NCyc").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringCycleCount) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringCycleCount).isValid()) {
         debug.nospace().noquote() << model->stringCycleCount() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("SoH") << "-->";
-    if (model->dataPoints().value("SoH").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringStateOfHealth) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringStateOfHealth).isValid()) {
         debug.nospace().noquote() << model->stringStateOfHealth() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("A") << "-->";
-    if (model->dataPoints().value("A").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringCurrent) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringCurrent).isValid()) {
         debug.nospace().noquote() << model->stringCurrent() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("V") << "-->";
-    if (model->dataPoints().value("V").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringVoltage) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringVoltage).isValid()) {
         debug.nospace().noquote() << model->stringVoltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CellVMax") << "-->";
-    if (model->dataPoints().value("CellVMax").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMaxCellVoltage) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMaxCellVoltage).isValid()) {
         debug.nospace().noquote() << model->maxCellVoltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CellVMaxMod") << "-->";
-    if (model->dataPoints().value("CellVMaxMod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMaxCellVoltageModule) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMaxCellVoltageModule).isValid()) {
         debug.nospace().noquote() << model->maxCellVoltageModule() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CellVMin") << "-->";
-    if (model->dataPoints().value("CellVMin").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMinCellVoltage) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMinCellVoltage).isValid()) {
         debug.nospace().noquote() << model->minCellVoltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CellVMinMod") << "-->";
-    if (model->dataPoints().value("CellVMinMod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMinCellVoltageModule) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMinCellVoltageModule).isValid()) {
         debug.nospace().noquote() << model->minCellVoltageModule() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CellVAvg") << "-->";
-    if (model->dataPoints().value("CellVAvg").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexAverageCellVoltage) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexAverageCellVoltage).isValid()) {
         debug.nospace().noquote() << model->averageCellVoltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModTmpMax") << "-->";
-    if (model->dataPoints().value("ModTmpMax").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMaxModuleTemperature) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMaxModuleTemperature).isValid()) {
         debug.nospace().noquote() << model->maxModuleTemperature() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModTmpMaxMod") << "-->";
-    if (model->dataPoints().value("ModTmpMaxMod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMaxModuleTemperatureModule) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMaxModuleTemperatureModule).isValid()) {
         debug.nospace().noquote() << model->maxModuleTemperatureModule() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModTmpMin") << "-->";
-    if (model->dataPoints().value("ModTmpMin").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMinModuleTemperature) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMinModuleTemperature).isValid()) {
         debug.nospace().noquote() << model->minModuleTemperature() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModTmpMinMod") << "-->";
-    if (model->dataPoints().value("ModTmpMinMod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMinModuleTemperatureModule) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexMinModuleTemperatureModule).isValid()) {
         debug.nospace().noquote() << model->minModuleTemperatureModule() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModTmpAvg") << "-->";
-    if (model->dataPoints().value("ModTmpAvg").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexAverageModuleTemperature) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexAverageModuleTemperature).isValid()) {
         debug.nospace().noquote() << model->averageModuleTemperature() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Pad1") << "-->";
-    if (model->dataPoints().value("Pad1").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexPad1) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexPad1).isValid()) {
         debug.nospace().noquote() << model->pad1() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ConSt") << "-->";
-    if (model->dataPoints().value("ConSt").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexContactorStatus) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexContactorStatus).isValid()) {
         debug.nospace().noquote() << model->contactorStatus() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Evt1") << "-->";
-    if (model->dataPoints().value("Evt1").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringEvent1) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringEvent1).isValid()) {
         debug.nospace().noquote() << model->stringEvent1() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Evt2") << "-->";
-    if (model->dataPoints().value("Evt2").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringEvent2) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexStringEvent2).isValid()) {
         debug.nospace().noquote() << model->stringEvent2() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("EvtVnd1") << "-->";
-    if (model->dataPoints().value("EvtVnd1").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexVendorEventBitfield1) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexVendorEventBitfield1).isValid()) {
         debug.nospace().noquote() << model->vendorEventBitfield1() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("EvtVnd2") << "-->";
-    if (model->dataPoints().value("EvtVnd2").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexVendorEventBitfield2) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexVendorEventBitfield2).isValid()) {
         debug.nospace().noquote() << model->vendorEventBitfield2() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("SetEna") << "-->";
-    if (model->dataPoints().value("SetEna").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexEnableDisableString) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexEnableDisableString).isValid()) {
         debug.nospace().noquote() << model->enableDisableString() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("SetCon") << "-->";
-    if (model->dataPoints().value("SetCon").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexConnectDisconnectString) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexConnectDisconnectString).isValid()) {
         debug.nospace().noquote() << model->connectDisconnectString() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Pad2") << "-->";
-    if (model->dataPoints().value("Pad2").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexPad2) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexPad2).isValid()) {
         debug.nospace().noquote() << model->pad2() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Pad3") << "-->";
-    if (model->dataPoints().value("Pad3").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexPad3) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexPad3).isValid()) {
         debug.nospace().noquote() << model->pad3() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Pad4") << "-->";
-    if (model->dataPoints().value("Pad4").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexPad4) << "-->";
+    if (model->dataPoint(SunSpecLithiumIonStringModel::DataPointIndexPad4).isValid()) {
         debug.nospace().noquote() << model->pad4() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
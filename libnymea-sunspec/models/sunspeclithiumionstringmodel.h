@@ -44,6 +44,25 @@ class SunSpecLithiumIonStringModelRepeatingBlock : public SunSpecModelRepeatingB
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexModuleCellCount = 0,
+        DataPointIndexModuleSoC,
+        DataPointIndexModuleSoH,
+        DataPointIndexMaxCellVoltage,
+        DataPointIndexMaxCellVoltageCell,
+        DataPointIndexMinCellVoltage,
+        DataPointIndexMinCellVoltageCell,
+        DataPointIndexAverageCellVoltage,
+        DataPointIndexMaxCellTemperature,
+        DataPointIndexMaxCellTemperatureCell,
+        DataPointIndexMinCellTemperature,
+        DataPointIndexMinCellTemperatureCell,
+        DataPointIndexAverageCellTemperature,
+        DataPointIndexPad5,
+        DataPointIndexPad6,
+        DataPointIndexPad7
+    };
+
     explicit SunSpecLithiumIonStringModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecLithiumIonStringModel *parent = nullptr);
     ~SunSpecLithiumIonStringModelRepeatingBlock() override = default;
 
@@ -214,6 +233,50 @@ public:
     Q_DECLARE_FLAGS(Evt1Flags, Evt1)
     Q_FLAG(Evt1)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexStringIndex,
+        DataPointIndexModuleCount,
+        DataPointIndexStringStatus,
+        DataPointIndexConnectionFailureReason,
+        DataPointIndexStringCellBalancingCount,
+        DataPointIndexStringStateOfCharge,
+        DataPointIndexStringDepthOfDischarge,
+        DataPointIndexStringCycleCount,
+        DataPointIndexStringStateOfHealth,
+        DataPointIndexStringCurrent,
+        DataPointIndexStringVoltage,
+        DataPointIndexMaxCellVoltage,
+        DataPointIndexMaxCellVoltageModule,
+        DataPointIndexMinCellVoltage,
+        DataPointIndexMinCellVoltageModule,
+        DataPointIndexAverageCellVoltage,
+        DataPointIndexMaxModuleTemperature,
+        DataPointIndexMaxModuleTemperatureModule,
+        DataPointIndexMinModuleTemperature,
+        DataPointIndexMinModuleTemperatureModule,
+        DataPointIndexAverageModuleTemperature,
+        DataPointIndexPad1,
+        DataPointIndexContactorStatus,
+        DataPointIndexStringEvent1,
+        DataPointIndexStringEvent2,
+        DataPointIndexVendorEventBitfield1,
+        DataPointIndexVendorEventBitfield2,
+        DataPointIndexEnableDisableString,
+        DataPointIndexConnectDisconnectString,
+        DataPointIndexSoC_SF,
+        DataPointIndexSoH_SF,
+        DataPointIndexDoD_SF,
+        DataPointIndexA_SF,
+        DataPointIndexV_SF,
+        DataPointIndexCellV_SF,
+        DataPointIndexModTmp_SF,
+        DataPointIndexPad2,
+        DataPointIndexPad3,
+        DataPointIndexPad4
+    };
+
     explicit SunSpecLithiumIonStringModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecLithiumIonStringModel() override; 
 
@@ -343,12 +406,19 @@ private:
     quint16 m_enableDisableString = 0;
     Setcon m_connectDisconnectString;
     qint16 m_soC_SF = 0;
+    double m_soC_SFMultiplier = 1;
     qint16 m_soH_SF = 0;
+    double m_soH_SFMultiplier = 1;
     qint16 m_doD_SF = 0;
+    double m_doD_SFMultiplier = 1;
     qint16 m_a_SF = 0;
+    double m_a_SFMultiplier = 1;
     qint16 m_v_SF = 0;
+    double m_v_SFMultiplier = 1;
     qint16 m_cellV_SF = 0;
+    double m_cellV_SFMultiplier = 1;
     qint16 m_modTmp_SF = 0;
+    double m_modTmp_SFMultiplier = 1;
     quint16 m_pad2 = 0;
     quint16 m_pad3 = 0;
     quint16 m_pad4 = 0;
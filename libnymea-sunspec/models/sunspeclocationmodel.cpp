@@ -31,6 +31,25 @@
 #include "sunspeclocationmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexTm
+    { "Tm", "Tm", "UTC 24 hour time stamp to millisecond hhmmss.sssZ format", nullptr, "hhmmss.sssZ", "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadOnly, false, 2, 0, 6 },
+    // DataPointIndexDate
+    { "Date", "Date", "UTC Date string YYYYMMDD format", nullptr, "YYYYMMDD", "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadOnly, false, 8, 6, 4 },
+    // DataPointIndexLocation
+    { "Loc", "Location", "Location string (40 chars max)", nullptr, "text", "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadOnly, false, 12, 10, 20 },
+    // DataPointIndexLat
+    { "Lat", "Lat", "Latitude with seven degrees of precision", nullptr, "Degrees", "int32", "-7", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadOnly, false, 32, 30, 2 },
+    // DataPointIndexLongitude
+    { "Long", "Long", "Longitude with seven degrees of precision", nullptr, "Degrees", "int32", "-7", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadOnly, false, 34, 32, 2 },
+    // DataPointIndexAltitude
+    { "Alt", "Altitude", "Altitude measurement in meters", nullptr, "meters", "int32", nullptr, SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadOnly, false, 36, 34, 2 }
+};
+
 SunSpecLocationModel::SunSpecLocationModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 305, modelLength, byteOrder, parent)
 {
@@ -85,124 +104,33 @@ qint32 SunSpecLocationModel::altitude() const
 }
 void SunSpecLocationModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint tmDataPoint;
-    tmDataPoint.setName("Tm");
-    tmDataPoint.setLabel("Tm");
-    tmDataPoint.setDescription("UTC 24 hour time stamp to millisecond hhmmss.sssZ format");
-    tmDataPoint.setUnits("hhmmss.sssZ");
-    tmDataPoint.setSize(6);
-    tmDataPoint.setAddressOffset(2);
-    tmDataPoint.setBlockOffset(0);
-    tmDataPoint.setSunSpecDataType("string");
-    tmDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tmDataPoint.name(), tmDataPoint);
-
-    SunSpecDataPoint dateDataPoint;
-    dateDataPoint.setName("Date");
-    dateDataPoint.setLabel("Date");
-    dateDataPoint.setDescription("UTC Date string YYYYMMDD format");
-    dateDataPoint.setUnits("YYYYMMDD");
-    dateDataPoint.setSize(4);
-    dateDataPoint.setAddressOffset(8);
-    dateDataPoint.setBlockOffset(6);
-    dateDataPoint.setSunSpecDataType("string");
-    dateDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(dateDataPoint.name(), dateDataPoint);
-
-    SunSpecDataPoint locationDataPoint;
-    locationDataPoint.setName("Loc");
-    locationDataPoint.setLabel("Location");
-    locationDataPoint.setDescription("Location string (40 chars max)");
-    locationDataPoint.setUnits("text");
-    locationDataPoint.setSize(20);
-    locationDataPoint.setAddressOffset(12);
-    locationDataPoint.setBlockOffset(10);
-    locationDataPoint.setSunSpecDataType("string");
-    locationDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(locationDataPoint.name(), locationDataPoint);
-
-    SunSpecDataPoint latDataPoint;
-    latDataPoint.setName("Lat");
-    latDataPoint.setLabel("Lat");
-    latDataPoint.setDescription("Latitude with seven degrees of precision");
-    latDataPoint.setUnits("Degrees");
-    latDataPoint.setSize(2);
-    latDataPoint.setAddressOffset(32);
-    latDataPoint.setBlockOffset(30);
-    latDataPoint.setScaleFactorName("-7");
-    latDataPoint.setSunSpecDataType("int32");
-    latDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(latDataPoint.name(), latDataPoint);
-
-    SunSpecDataPoint longitudeDataPoint;
-    longitudeDataPoint.setName("Long");
-    longitudeDataPoint.setLabel("Long");
-    longitudeDataPoint.setDescription("Longitude with seven degrees of precision");
-    longitudeDataPoint.setUnits("Degrees");
-    longitudeDataPoint.setSize(2);
-    longitudeDataPoint.setAddressOffset(34);
-    longitudeDataPoint.setBlockOffset(32);
-    longitudeDataPoint.setScaleFactorName("-7");
-    longitudeDataPoint.setSunSpecDataType("int32");
-    longitudeDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(longitudeDataPoint.name(), longitudeDataPoint);
-
-    SunSpecDataPoint altitudeDataPoint;
-    altitudeDataPoint.setName("Alt");
-    altitudeDataPoint.setLabel("Altitude");
-    altitudeDataPoint.setDescription("Altitude measurement in meters");
-    altitudeDataPoint.setUnits("meters");
-    altitudeDataPoint.setSize(2);
-    altitudeDataPoint.setAddressOffset(36);
-    altitudeDataPoint.setBlockOffset(34);
-    altitudeDataPoint.setSunSpecDataType("int32");
-    altitudeDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(altitudeDataPoint.name(), altitudeDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 8;
 }
 
 void SunSpecLocationModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("Tm").isValid())
-        m_tm = m_dataPoints.value("Tm").toString();
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 2, 6, SunSpecDataPoint::String, m_byteOrder))
+        m_tm = SunSpecDataPoint::convertToString(registers + 2, 6);
 
-    if (m_dataPoints.value("Date").isValid())
-        m_date = m_dataPoints.value("Date").toString();
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 8, 4, SunSpecDataPoint::String, m_byteOrder))
+        m_date = SunSpecDataPoint::convertToString(registers + 8, 4);
 
-    if (m_dataPoints.value("Loc").isValid())
-        m_location = m_dataPoints.value("Loc").toString();
+    if (registerCount >= 32 && SunSpecDataPoint::isValid(registers + 12, 20, SunSpecDataPoint::String, m_byteOrder))
+        m_location = SunSpecDataPoint::convertToString(registers + 12, 20);
 
-    if (m_dataPoints.value("Lat").isValid())
-        m_lat = m_dataPoints.value("Lat").toFloatWithSSF(-7);
+    if (registerCount >= 34 && SunSpecDataPoint::isValid(registers + 32, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_lat = SunSpecDataPoint::convertToInt32(registers + 32, 2, m_byteOrder) * SunSpecDataPoint::scaleFactorMultiplier(-7);
 
-    if (m_dataPoints.value("Long").isValid())
-        m_longitude = m_dataPoints.value("Long").toFloatWithSSF(-7);
+    if (registerCount >= 36 && SunSpecDataPoint::isValid(registers + 34, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_longitude = SunSpecDataPoint::convertToInt32(registers + 34, 2, m_byteOrder) * SunSpecDataPoint::scaleFactorMultiplier(-7);
 
-    if (m_dataPoints.value("Alt").isValid())
-        m_altitude = m_dataPoints.value("Alt").toInt32();
+    if (registerCount >= 38 && SunSpecDataPoint::isValid(registers + 36, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_altitude = SunSpecDataPoint::convertToInt32(registers + 36, 2, m_byteOrder);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -211,43 +139,43 @@ void SunSpecLocationModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecLocationModel *model)
 {
     debug.nospace().noquote() << "SunSpecLocationModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Tm") << "-->";
-    if (model->dataPoints().value("Tm").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLocationModel::DataPointIndexTm) << "-->";
+    if (model->dataPoint(SunSpecLocationModel::DataPointIndexTm).isValid()) {
         debug.nospace().noquote() << model->tm() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Date") << "-->";
-    if (model->dataPoints().value("Date").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLocationModel::DataPointIndexDate) << "-->";
+    if (model->dataPoint(SunSpecLocationModel::DataPointIndexDate).isValid()) {
         debug.nospace().noquote() << model->date() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Loc") << "-->";
-    if (model->dataPoints().value("Loc").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLocationModel::DataPointIndexLocation) << "-->";
+    if (model->dataPoint(SunSpecLocationModel::DataPointIndexLocation).isValid()) {
         debug.nospace().noquote() << model->location() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Lat") << "-->";
-    if (model->dataPoints().value("Lat").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLocationModel::DataPointIndexLat) << "-->";
+    if (model->dataPoint(SunSpecLocationModel::DataPointIndexLat).isValid()) {
         debug.nospace().noquote() << model->lat() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Long") << "-->";
-    if (model->dataPoints().value("Long").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLocationModel::DataPointIndexLongitude) << "-->";
+    if (model->dataPoint(SunSpecLocationModel::DataPointIndexLongitude).isValid()) {
         debug.nospace().noquote() << model->longitude() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Alt") << "-->";
-    if (model->dataPoints().value("Alt").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecLocationModel::DataPointIndexAltitude) << "-->";
+    if (model->dataPoint(SunSpecLocationModel::DataPointIndexAltitude).isValid()) {
         debug.nospace().noquote() << model->altitude() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
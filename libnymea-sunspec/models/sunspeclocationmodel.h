@@ -42,6 +42,17 @@ class SunSpecLocationModel : public SunSpecModel
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexTm,
+        DataPointIndexDate,
+        DataPointIndexLocation,
+        DataPointIndexLat,
+        DataPointIndexLongitude,
+        DataPointIndexAltitude
+    };
+
     explicit SunSpecLocationModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecLocationModel() override; 
 
@@ -76,6 +76,83 @@ public:
     Q_DECLARE_FLAGS(EvtFlags, Evt)
     Q_FLAG(Evt)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexAmps,
+        DataPointIndexAmpsPhaseA,
+        DataPointIndexAmpsPhaseB,
+        DataPointIndexAmpsPhaseC,
+        DataPointIndexA_SF,
+        DataPointIndexVoltageLn,
+        DataPointIndexPhaseVoltageAn,
+        DataPointIndexPhaseVoltageBn,
+        DataPointIndexPhaseVoltageCn,
+        DataPointIndexVoltageLl,
+        DataPointIndexPhaseVoltageAb,
+        DataPointIndexPhaseVoltageBc,
+        DataPointIndexPhaseVoltageCa,
+        DataPointIndexV_SF,
+        DataPointIndexHz,
+        DataPointIndexHz_SF,
+        DataPointIndexWatts,
+        DataPointIndexWattsPhaseA,
+        DataPointIndexWattsPhaseB,
+        DataPointIndexWattsPhaseC,
+        DataPointIndexW_SF,
+        DataPointIndexVa,
+        DataPointIndexVaPhaseA,
+        DataPointIndexVaPhaseB,
+        DataPointIndexVaPhaseC,
+        DataPointIndexVA_SF,
+        DataPointIndexVar,
+        DataPointIndexVarPhaseA,
+        DataPointIndexVarPhaseB,
+        DataPointIndexVarPhaseC,
+        DataPointIndexVAR_SF,
+        DataPointIndexPf,
+        DataPointIndexPfPhaseA,
+        DataPointIndexPfPhaseB,
+        DataPointIndexPfPhaseC,
+        DataPointIndexPF_SF,
+        DataPointIndexTotalWattHoursExported,
+        DataPointIndexTotalWattHoursExportedPhaseA,
+        DataPointIndexTotalWattHoursExportedPhaseB,
+        DataPointIndexTotalWattHoursExportedPhaseC,
+        DataPointIndexTotalWattHoursImported,
+        DataPointIndexTotalWattHoursImportedPhaseA,
+        DataPointIndexTotalWattHoursImportedPhaseB,
+        DataPointIndexTotalWattHoursImportedPhaseC,
+        DataPointIndexTotWh_SF,
+        DataPointIndexTotalVaHoursExported,
+        DataPointIndexTotalVaHoursExportedPhaseA,
+        DataPointIndexTotalVaHoursExportedPhaseB,
+        DataPointIndexTotalVaHoursExportedPhaseC,
+        DataPointIndexTotalVaHoursImported,
+        DataPointIndexTotalVaHoursImportedPhaseA,
+        DataPointIndexTotalVaHoursImportedPhaseB,
+        DataPointIndexTotalVaHoursImportedPhaseC,
+        DataPointIndexTotVAh_SF,
+        DataPointIndexTotalVarHoursImportedQ1,
+        DataPointIndexTotalVArHoursImportedQ1PhaseA,
+        DataPointIndexTotalVArHoursImportedQ1PhaseB,
+        DataPointIndexTotalVArHoursImportedQ1PhaseC,
+        DataPointIndexTotalVArHoursImportedQ2,
+        DataPointIndexTotalVArHoursImportedQ2PhaseA,
+        DataPointIndexTotalVArHoursImportedQ2PhaseB,
+        DataPointIndexTotalVArHoursImportedQ2PhaseC,
+        DataPointIndexTotalVArHoursExportedQ3,
+        DataPointIndexTotalVArHoursExportedQ3PhaseA,
+        DataPointIndexTotalVArHoursExportedQ3PhaseB,
+        DataPointIndexTotalVArHoursExportedQ3PhaseC,
+        DataPointIndexTotalVArHoursExportedQ4,
+        DataPointIndexTotalVArHoursExportedQ4ImportedPhaseA,
+        DataPointIndexTotalVArHoursExportedQ4ImportedPhaseB,
+        DataPointIndexTotalVArHoursExportedQ4ImportedPhaseC,
+        DataPointIndexTotVArh_SF,
+        DataPointIndexEvents
+    };
+
     explicit SunSpecMeterSplitSinglePhaseAbnModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecMeterSplitSinglePhaseAbnModel() override; 
 
@@ -240,6 +317,7 @@ private:
     float m_ampsPhaseB = 0;
     float m_ampsPhaseC = 0;
     qint16 m_a_SF = 0;
+    double m_a_SFMultiplier = 1;
     float m_voltageLn = 0;
     float m_phaseVoltageAn = 0;
     float m_phaseVoltageBn = 0;
@@ -249,28 +327,34 @@ private:
     float m_phaseVoltageBc = 0;
     float m_phaseVoltageCa = 0;
     qint16 m_v_SF = 0;
+    double m_v_SFMultiplier = 1;
     float m_hz = 0;
     qint16 m_hz_SF = 0;
+    double m_hz_SFMultiplier = 1;
     float m_watts = 0;
     float m_wattsPhaseA = 0;
     float m_wattsPhaseB = 0;
     float m_wattsPhaseC = 0;
     qint16 m_w_SF = 0;
+    double m_w_SFMultiplier = 1;
     float m_va = 0;
     float m_vaPhaseA = 0;
     float m_vaPhaseB = 0;
     float m_vaPhaseC = 0;
     qint16 m_vA_SF = 0;
+    double m_vA_SFMultiplier = 1;
     float m_var = 0;
     float m_varPhaseA = 0;
     float m_varPhaseB = 0;
     float m_varPhaseC = 0;
     qint16 m_vAR_SF = 0;
+    double m_vAR_SFMultiplier = 1;
     float m_pf = 0;
     float m_pfPhaseA = 0;
     float m_pfPhaseB = 0;
     float m_pfPhaseC = 0;
     qint16 m_pF_SF = 0;
+    double m_pF_SFMultiplier = 1;
     quint32 m_totalWattHoursExported = 0;
     quint32 m_totalWattHoursExportedPhaseA = 0;
     quint32 m_totalWattHoursExportedPhaseB = 0;
@@ -280,6 +364,7 @@ private:
     quint32 m_totalWattHoursImportedPhaseB = 0;
     quint32 m_totalWattHoursImportedPhaseC = 0;
     qint16 m_totWh_SF = 0;
+    double m_totWh_SFMultiplier = 1;
     quint32 m_totalVaHoursExported = 0;
     quint32 m_totalVaHoursExportedPhaseA = 0;
     quint32 m_totalVaHoursExportedPhaseB = 0;
@@ -289,6 +374,7 @@ private:
     quint32 m_totalVaHoursImportedPhaseB = 0;
     quint32 m_totalVaHoursImportedPhaseC = 0;
     qint16 m_totVAh_SF = 0;
+    double m_totVAh_SFMultiplier = 1;
     quint32 m_totalVarHoursImportedQ1 = 0;
     quint32 m_totalVArHoursImportedQ1PhaseA = 0;
     quint32 m_totalVArHoursImportedQ1PhaseB = 0;
@@ -306,6 +392,7 @@ private:
     quint32 m_totalVArHoursExportedQ4ImportedPhaseB = 0;
     quint32 m_totalVArHoursExportedQ4ImportedPhaseC = 0;
     qint16 m_totVArh_SF = 0;
+    double m_totVArh_SFMultiplier = 1;
     EvtFlags m_events;
 
 
@@ -31,6 +31,21 @@
 #include "sunspecminimetmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexGhi
+    { "GHI", "GHI", "Global Horizontal Irradiance", nullptr, "W/m2", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 2, 0, 1 },
+    // DataPointIndexTemp
+    { "TmpBOM", "Temp", "Back of module temperature measurement", nullptr, "C", "int16", "-1", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 3, 1, 1 },
+    // DataPointIndexAmbientTemperature
+    { "TmpAmb", "Ambient Temperature", nullptr, nullptr, "C", "int16", "-1", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 4, 2, 1 },
+    // DataPointIndexWindSpeed
+    { "WndSpd", "Wind Speed", nullptr, nullptr, "m/s", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 5, 3, 1 }
+};
+
 SunSpecMiniMetModel::SunSpecMiniMetModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 308, modelLength, byteOrder, parent)
 {
@@ -77,92 +92,27 @@ quint16 SunSpecMiniMetModel::windSpeed() const
 }
 void SunSpecMiniMetModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint ghiDataPoint;
-    ghiDataPoint.setName("GHI");
-    ghiDataPoint.setLabel("GHI");
-    ghiDataPoint.setDescription("Global Horizontal Irradiance");
-    ghiDataPoint.setUnits("W/m2");
-    ghiDataPoint.setSize(1);
-    ghiDataPoint.setAddressOffset(2);
-    ghiDataPoint.setBlockOffset(0);
-    ghiDataPoint.setSunSpecDataType("uint16");
-    ghiDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ghiDataPoint.name(), ghiDataPoint);
-
-    SunSpecDataPoint tempDataPoint;
-    tempDataPoint.setName("TmpBOM");
-    tempDataPoint.setLabel("Temp");
-    tempDataPoint.setDescription("Back of module temperature measurement");
-    tempDataPoint.setUnits("C");
-    tempDataPoint.setSize(1);
-    tempDataPoint.setAddressOffset(3);
-    tempDataPoint.setBlockOffset(1);
-    tempDataPoint.setScaleFactorName("-1");
-    tempDataPoint.setSunSpecDataType("int16");
-    tempDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tempDataPoint.name(), tempDataPoint);
-
-    SunSpecDataPoint ambientTemperatureDataPoint;
-    ambientTemperatureDataPoint.setName("TmpAmb");
-    ambientTemperatureDataPoint.setLabel("Ambient Temperature");
-    ambientTemperatureDataPoint.setUnits("C");
-    ambientTemperatureDataPoint.setSize(1);
-    ambientTemperatureDataPoint.setAddressOffset(4);
-    ambientTemperatureDataPoint.setBlockOffset(2);
-    ambientTemperatureDataPoint.setScaleFactorName("-1");
-    ambientTemperatureDataPoint.setSunSpecDataType("int16");
-    ambientTemperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ambientTemperatureDataPoint.name(), ambientTemperatureDataPoint);
-
-    SunSpecDataPoint windSpeedDataPoint;
-    windSpeedDataPoint.setName("WndSpd");
-    windSpeedDataPoint.setLabel("Wind Speed");
-    windSpeedDataPoint.setUnits("m/s");
-    windSpeedDataPoint.setSize(1);
-    windSpeedDataPoint.setAddressOffset(5);
-    windSpeedDataPoint.setBlockOffset(3);
-    windSpeedDataPoint.setSunSpecDataType("uint16");
-    windSpeedDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(windSpeedDataPoint.name(), windSpeedDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 6;
 }
 
 void SunSpecMiniMetModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("GHI").isValid())
-        m_ghi = m_dataPoints.value("GHI").toUInt16();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_ghi = SunSpecDataPoint::convertToUInt16(registers + 2, 1);
 
-    if (m_dataPoints.value("TmpBOM").isValid())
-        m_temp = m_dataPoints.value("TmpBOM").toFloatWithSSF(-1);
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_temp = SunSpecDataPoint::convertToInt16(registers + 3, 1) * SunSpecDataPoint::scaleFactorMultiplier(-1);
 
-    if (m_dataPoints.value("TmpAmb").isValid())
-        m_ambientTemperature = m_dataPoints.value("TmpAmb").toFloatWithSSF(-1);
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_ambientTemperature = SunSpecDataPoint::convertToInt16(registers + 4, 1) * SunSpecDataPoint::scaleFactorMultiplier(-1);
 
-    if (m_dataPoints.value("WndSpd").isValid())
-        m_windSpeed = m_dataPoints.value("WndSpd").toUInt16();
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_windSpeed = SunSpecDataPoint::convertToUInt16(registers + 5, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -171,29 +121,29 @@ void SunSpecMiniMetModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecMiniMetModel *model)
 {
     debug.nospace().noquote() << "SunSpecMiniMetModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("GHI") << "-->";
-    if (model->dataPoints().value("GHI").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecMiniMetModel::DataPointIndexGhi) << "-->";
+    if (model->dataPoint(SunSpecMiniMetModel::DataPointIndexGhi).isValid()) {
         debug.nospace().noquote() << model->ghi() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("TmpBOM") << "-->";
-    if (model->dataPoints().value("TmpBOM").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecMiniMetModel::DataPointIndexTemp) << "-->";
+    if (model->dataPoint(SunSpecMiniMetModel::DataPointIndexTemp).isValid()) {
         debug.nospace().noquote() << model->temp() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("TmpAmb") << "-->";
-    if (model->dataPoints().value("TmpAmb").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecMiniMetModel::DataPointIndexAmbientTemperature) << "-->";
+    if (model->dataPoint(SunSpecMiniMetModel::DataPointIndexAmbientTemperature).isValid()) {
         debug.nospace().noquote() << model->ambientTemperature() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WndSpd") << "-->";
-    if (model->dataPoints().value("WndSpd").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecMiniMetModel::DataPointIndexWindSpeed) << "-->";
+    if (model->dataPoint(SunSpecMiniMetModel::DataPointIndexWindSpeed).isValid()) {
         debug.nospace().noquote() << model->windSpeed() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
@@ -42,6 +42,15 @@ class SunSpecMiniMetModel : public SunSpecModel
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexGhi,
+        DataPointIndexTemp,
+        DataPointIndexAmbientTemperature,
+        DataPointIndexWindSpeed
+    };
+
     explicit SunSpecMiniMetModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecMiniMetModel() override; 
 
@@ -31,6 +31,29 @@
 #include "sunspecmpptmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata repeatingBlockDataPointMetadata[] = {
+    // DataPointIndexInputId
+    { "ID", "Input ID", nullptr, nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 0, 0, 1 },
+    // DataPointIndexInputIdSting
+    { "IDStr", "Input ID Sting", nullptr, nullptr, nullptr, "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadOnly, false, 1, 0, 8 },
+    // DataPointIndexDcCurrent
+    { "DCA", "DC Current", nullptr, nullptr, "A", "uint16", "DCA_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 9, 7, 1 },
+    // DataPointIndexDcVoltage
+    { "DCV", "DC Voltage", nullptr, nullptr, "V", "uint16", "DCV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 10, 8, 1 },
+    // DataPointIndexDcPower
+    { "DCW", "DC Power", nullptr, nullptr, "W", "uint16", "DCW_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 11, 9, 1 },
+    // DataPointIndexLifetimeEnergy
+    { "DCWH", "Lifetime Energy", nullptr, nullptr, "Wh", "acc32", "DCWH_SF", SunSpecDataPoint::Acc32, SunSpecDataPoint::AccessReadOnly, false, 12, 10, 2 },
+    // DataPointIndexTimestamp
+    { "Tms", "Timestamp", nullptr, nullptr, "Secs", "uint32", nullptr, SunSpecDataPoint::UInt32, SunSpecDataPoint::AccessReadOnly, false, 14, 12, 2 },
+    // DataPointIndexTemperature
+    { "Tmp", "Temperature", nullptr, nullptr, "C", "int16", nullptr, SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 16, 14, 1 },
+    // DataPointIndexOperatingState
+    { "DCSt", "Operating State", nullptr, nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, false, 17, 15, 1 },
+    // DataPointIndexModuleEvents
+    { "DCEvt", "Module Events", nullptr, nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 18, 16, 2 }
+};
+
 SunSpecMpptModelRepeatingBlock::SunSpecMpptModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecMpptModel *parent) :
     SunSpecModelRepeatingBlock(blockIndex, blockSize, modbusStartRegister, parent)
 {
@@ -91,156 +114,74 @@ SunSpecMpptModelRepeatingBlock::DcevtFlags SunSpecMpptModelRepeatingBlock::modul
 
 void SunSpecMpptModelRepeatingBlock::initDataPoints()
 {
-    SunSpecDataPoint inputIdDataPoint;
-    inputIdDataPoint.setName("ID");
-    inputIdDataPoint.setLabel("Input ID");
-    inputIdDataPoint.setSize(1);
-    inputIdDataPoint.setAddressOffset(0);
-    inputIdDataPoint.setSunSpecDataType("uint16");
-    inputIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inputIdDataPoint.name(), inputIdDataPoint);
-
-    SunSpecDataPoint inputIdStingDataPoint;
-    inputIdStingDataPoint.setName("IDStr");
-    inputIdStingDataPoint.setLabel("Input ID Sting");
-    inputIdStingDataPoint.setSize(8);
-    inputIdStingDataPoint.setAddressOffset(1);
-    inputIdStingDataPoint.setSunSpecDataType("string");
-    inputIdStingDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inputIdStingDataPoint.name(), inputIdStingDataPoint);
-
-    SunSpecDataPoint dcCurrentDataPoint;
-    dcCurrentDataPoint.setName("DCA");
-    dcCurrentDataPoint.setLabel("DC Current");
-    dcCurrentDataPoint.setUnits("A");
-    dcCurrentDataPoint.setSize(1);
-    dcCurrentDataPoint.setAddressOffset(9);
-    dcCurrentDataPoint.setBlockOffset(7);
-    dcCurrentDataPoint.setScaleFactorName("DCA_SF");
-    dcCurrentDataPoint.setSunSpecDataType("uint16");
-    dcCurrentDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(dcCurrentDataPoint.name(), dcCurrentDataPoint);
-
-    SunSpecDataPoint dcVoltageDataPoint;
-    dcVoltageDataPoint.setName("DCV");
-    dcVoltageDataPoint.setLabel("DC Voltage");
-    dcVoltageDataPoint.setUnits("V");
-    dcVoltageDataPoint.setSize(1);
-    dcVoltageDataPoint.setAddressOffset(10);
-    dcVoltageDataPoint.setBlockOffset(8);
-    dcVoltageDataPoint.setScaleFactorName("DCV_SF");
-    dcVoltageDataPoint.setSunSpecDataType("uint16");
-    dcVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(dcVoltageDataPoint.name(), dcVoltageDataPoint);
-
-    SunSpecDataPoint dcPowerDataPoint;
-    dcPowerDataPoint.setName("DCW");
-    dcPowerDataPoint.setLabel("DC Power");
-    dcPowerDataPoint.setUnits("W");
-    dcPowerDataPoint.setSize(1);
-    dcPowerDataPoint.setAddressOffset(11);
-    dcPowerDataPoint.setBlockOffset(9);
-    dcPowerDataPoint.setScaleFactorName("DCW_SF");
-    dcPowerDataPoint.setSunSpecDataType("uint16");
-    dcPowerDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(dcPowerDataPoint.name(), dcPowerDataPoint);
-
-    SunSpecDataPoint lifetimeEnergyDataPoint;
-    lifetimeEnergyDataPoint.setName("DCWH");
-    lifetimeEnergyDataPoint.setLabel("Lifetime Energy");
-    lifetimeEnergyDataPoint.setUnits("Wh");
-    lifetimeEnergyDataPoint.setSize(2);
-    lifetimeEnergyDataPoint.setAddressOffset(12);
-    lifetimeEnergyDataPoint.setBlockOffset(10);
-    lifetimeEnergyDataPoint.setScaleFactorName("DCWH_SF");
-    lifetimeEnergyDataPoint.setSunSpecDataType("acc32");
-    lifetimeEnergyDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(lifetimeEnergyDataPoint.name(), lifetimeEnergyDataPoint);
-
-    SunSpecDataPoint timestampDataPoint;
-    timestampDataPoint.setName("Tms");
-    timestampDataPoint.setLabel("Timestamp");
-    timestampDataPoint.setUnits("Secs");
-    timestampDataPoint.setSize(2);
-    timestampDataPoint.setAddressOffset(14);
-    timestampDataPoint.setBlockOffset(12);
-    timestampDataPoint.setSunSpecDataType("uint32");
-    timestampDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(timestampDataPoint.name(), timestampDataPoint);
-
-    SunSpecDataPoint temperatureDataPoint;
-    temperatureDataPoint.setName("Tmp");
-    temperatureDataPoint.setLabel("Temperature");
-    temperatureDataPoint.setUnits("C");
-    temperatureDataPoint.setSize(1);
-    temperatureDataPoint.setAddressOffset(16);
-    temperatureDataPoint.setBlockOffset(14);
-    temperatureDataPoint.setSunSpecDataType("int16");
-    temperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(temperatureDataPoint.name(), temperatureDataPoint);
-
-    SunSpecDataPoint operatingStateDataPoint;
-    operatingStateDataPoint.setName("DCSt");
-    operatingStateDataPoint.setLabel("Operating State");
-    operatingStateDataPoint.setSize(1);
-    operatingStateDataPoint.setAddressOffset(17);
-    operatingStateDataPoint.setBlockOffset(15);
-    operatingStateDataPoint.setSunSpecDataType("enum16");
-    operatingStateDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(operatingStateDataPoint.name(), operatingStateDataPoint);
-
-    SunSpecDataPoint moduleEventsDataPoint;
-    moduleEventsDataPoint.setName("DCEvt");
-    moduleEventsDataPoint.setLabel("Module Events");
-    moduleEventsDataPoint.setSize(2);
-    moduleEventsDataPoint.setAddressOffset(18);
-    moduleEventsDataPoint.setBlockOffset(16);
-    moduleEventsDataPoint.setSunSpecDataType("bitfield32");
-    moduleEventsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(moduleEventsDataPoint.name(), moduleEventsDataPoint);
-
+    m_dataPointMetadata = repeatingBlockDataPointMetadata;
+    m_dataPointCount = 10;
 }
 
 void SunSpecMpptModelRepeatingBlock::processBlockData(const QVector<quint16> blockData)
 {
     m_blockData = blockData;
 
+    const quint16 *registers = m_blockData.constData();
+    const int registerCount = m_blockData.count();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("ID").isValid())
-        m_inputId = m_dataPoints.value("ID").toUInt16();
+    if (registerCount >= 1 && SunSpecDataPoint::isValid(registers + 0, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_inputId = SunSpecDataPoint::convertToUInt16(registers + 0, 1);
 
-    if (m_dataPoints.value("IDStr").isValid())
-        m_inputIdSting = m_dataPoints.value("IDStr").toString();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 1, 8, SunSpecDataPoint::String, m_byteOrder))
+        m_inputIdSting = SunSpecDataPoint::convertToString(registers + 1, 8);
 
-    if (m_dataPoints.value("DCA").isValid())
-        m_dcCurrent = m_dataPoints.value("DCA").toFloatWithSSF(m_parentModel->currentScaleFactor());
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_dcCurrent = SunSpecDataPoint::convertToUInt16(registers + 9, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->currentScaleFactor());
 
-    if (m_dataPoints.value("DCV").isValid())
-        m_dcVoltage = m_dataPoints.value("DCV").toFloatWithSSF(m_parentModel->voltageScaleFactor());
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_dcVoltage = SunSpecDataPoint::convertToUInt16(registers + 10, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->voltageScaleFactor());
 
-    if (m_dataPoints.value("DCW").isValid())
-        m_dcPower = m_dataPoints.value("DCW").toFloatWithSSF(m_parentModel->powerScaleFactor());
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_dcPower = SunSpecDataPoint::convertToUInt16(registers + 11, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->powerScaleFactor());
 
-    if (m_dataPoints.value("DCWH").isValid())
-        m_lifetimeEnergy = m_dataPoints.value("DCWH").toFloatWithSSF(m_parentModel->energyScaleFactor());
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 12, 2, SunSpecDataPoint::Acc32, m_byteOrder))
+        m_lifetimeEnergy = SunSpecDataPoint::convertToUInt32(registers + 12, 2, m_byteOrder) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->energyScaleFactor());
 
-    if (m_dataPoints.value("Tms").isValid())
-        m_timestamp = m_dataPoints.value("Tms").toUInt32();
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 14, 2, SunSpecDataPoint::UInt32, m_byteOrder))
+        m_timestamp = SunSpecDataPoint::convertToUInt32(registers + 14, 2, m_byteOrder);
 
-    if (m_dataPoints.value("Tmp").isValid())
-        m_temperature = m_dataPoints.value("Tmp").toInt16();
+    if (registerCount >= 17 && SunSpecDataPoint::isValid(registers + 16, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_temperature = SunSpecDataPoint::convertToInt16(registers + 16, 1);
 
-    if (m_dataPoints.value("DCSt").isValid())
-        m_operatingState = static_cast<Dcst>(m_dataPoints.value("DCSt").toUInt16());
+    if (registerCount >= 18 && SunSpecDataPoint::isValid(registers + 17, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_operatingState = static_cast<Dcst>(SunSpecDataPoint::convertToUInt16(registers + 17, 1));
 
-    if (m_dataPoints.value("DCEvt").isValid())
-        m_moduleEvents = static_cast<DcevtFlags>(m_dataPoints.value("DCEvt").toUInt32());
+    if (registerCount >= 20 && SunSpecDataPoint::isValid(registers + 18, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_moduleEvents = static_cast<DcevtFlags>(SunSpecDataPoint::convertToUInt32(registers + 18, 2, m_byteOrder));
 
 
     qCDebug(dcSunSpecModelData()) << this;
 }
 
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexCurrentScaleFactor
+    { "DCA_SF", "Current Scale Factor", nullptr, nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 2, 0, 1 },
+    // DataPointIndexVoltageScaleFactor
+    { "DCV_SF", "Voltage Scale Factor", nullptr, nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 3, 1, 1 },
+    // DataPointIndexPowerScaleFactor
+    { "DCW_SF", "Power Scale Factor", nullptr, nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 4, 2, 1 },
+    // DataPointIndexEnergyScaleFactor
+    { "DCWH_SF", "Energy Scale Factor", nullptr, nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 5, 3, 1 },
+    // DataPointIndexGlobalEvents
+    { "Evt", "Global Events", nullptr, nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 6, 4, 2 },
+    // DataPointIndexNumberOfModules
+    { "N", "Number of Modules", nullptr, nullptr, nullptr, "count", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 8, 6, 1 },
+    // DataPointIndexTimestampPeriod
+    { "TmsPer", "Timestamp Period", nullptr, nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 9, 7, 1 }
+};
+
 SunSpecMpptModel::SunSpecMpptModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 160, modelLength, byteOrder, parent)
 {
@@ -299,137 +240,58 @@ quint16 SunSpecMpptModel::timestampPeriod() const
 }
 void SunSpecMpptModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint currentScaleFactorDataPoint;
-    currentScaleFactorDataPoint.setName("DCA_SF");
-    currentScaleFactorDataPoint.setLabel("Current Scale Factor");
-    currentScaleFactorDataPoint.setSize(1);
-    currentScaleFactorDataPoint.setAddressOffset(2);
-    currentScaleFactorDataPoint.setBlockOffset(0);
-    currentScaleFactorDataPoint.setSunSpecDataType("sunssf");
-    currentScaleFactorDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(currentScaleFactorDataPoint.name(), currentScaleFactorDataPoint);
-
-    SunSpecDataPoint voltageScaleFactorDataPoint;
-    voltageScaleFactorDataPoint.setName("DCV_SF");
-    voltageScaleFactorDataPoint.setLabel("Voltage Scale Factor");
-    voltageScaleFactorDataPoint.setSize(1);
-    voltageScaleFactorDataPoint.setAddressOffset(3);
-    voltageScaleFactorDataPoint.setBlockOffset(1);
-    voltageScaleFactorDataPoint.setSunSpecDataType("sunssf");
-    voltageScaleFactorDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(voltageScaleFactorDataPoint.name(), voltageScaleFactorDataPoint);
-
-    SunSpecDataPoint powerScaleFactorDataPoint;
-    powerScaleFactorDataPoint.setName("DCW_SF");
-    powerScaleFactorDataPoint.setLabel("Power Scale Factor");
-    powerScaleFactorDataPoint.setSize(1);
-    powerScaleFactorDataPoint.setAddressOffset(4);
-    powerScaleFactorDataPoint.setBlockOffset(2);
-    powerScaleFactorDataPoint.setSunSpecDataType("sunssf");
-    powerScaleFactorDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(powerScaleFactorDataPoint.name(), powerScaleFactorDataPoint);
-
-    SunSpecDataPoint energyScaleFactorDataPoint;
-    energyScaleFactorDataPoint.setName("DCWH_SF");
-    energyScaleFactorDataPoint.setLabel("Energy Scale Factor");
-    energyScaleFactorDataPoint.setSize(1);
-    energyScaleFactorDataPoint.setAddressOffset(5);
-    energyScaleFactorDataPoint.setBlockOffset(3);
-    energyScaleFactorDataPoint.setSunSpecDataType("sunssf");
-    energyScaleFactorDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(energyScaleFactorDataPoint.name(), energyScaleFactorDataPoint);
-
-    SunSpecDataPoint globalEventsDataPoint;
-    globalEventsDataPoint.setName("Evt");
-    globalEventsDataPoint.setLabel("Global Events");
-    globalEventsDataPoint.setSize(2);
-    globalEventsDataPoint.setAddressOffset(6);
-    globalEventsDataPoint.setBlockOffset(4);
-    globalEventsDataPoint.setSunSpecDataType("bitfield32");
-    globalEventsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(globalEventsDataPoint.name(), globalEventsDataPoint);
-
-    SunSpecDataPoint numberOfModulesDataPoint;
-    numberOfModulesDataPoint.setName("N");
-    numberOfModulesDataPoint.setLabel("Number of Modules");
-    numberOfModulesDataPoint.setSize(1);
-    numberOfModulesDataPoint.setAddressOffset(8);
-    numberOfModulesDataPoint.setBlockOffset(6);
-    numberOfModulesDataPoint.setSunSpecDataType("count");
-    numberOfModulesDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(numberOfModulesDataPoint.name(), numberOfModulesDataPoint);
-
-    SunSpecDataPoint timestampPeriodDataPoint;
-    timestampPeriodDataPoint.setName("TmsPer");
-    timestampPeriodDataPoint.setLabel("Timestamp Period");
-    timestampPeriodDataPoint.setSize(1);
-    timestampPeriodDataPoint.setAddressOffset(9);
-    timestampPeriodDataPoint.setBlockOffset(7);
-    timestampPeriodDataPoint.setSunSpecDataType("uint16");
-    timestampPeriodDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(timestampPeriodDataPoint.name(), timestampPeriodDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 9;
 }
 
 void SunSpecMpptModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("DCA_SF").isValid())
-        m_currentScaleFactor = m_dataPoints.value("DCA_SF").toInt16();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 2, 1);
+        if (scaleFactor != m_currentScaleFactor) {
+            m_currentScaleFactor = scaleFactor;
+            m_currentScaleFactorMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("DCV_SF").isValid())
-        m_voltageScaleFactor = m_dataPoints.value("DCV_SF").toInt16();
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 3, 1);
+        if (scaleFactor != m_voltageScaleFactor) {
+            m_voltageScaleFactor = scaleFactor;
+            m_voltageScaleFactorMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("DCW_SF").isValid())
-        m_powerScaleFactor = m_dataPoints.value("DCW_SF").toInt16();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 4, 1);
+        if (scaleFactor != m_powerScaleFactor) {
+            m_powerScaleFactor = scaleFactor;
+            m_powerScaleFactorMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("DCWH_SF").isValid())
-        m_energyScaleFactor = m_dataPoints.value("DCWH_SF").toInt16();
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 5, 1);
+        if (scaleFactor != m_energyScaleFactor) {
+            m_energyScaleFactor = scaleFactor;
+            m_energyScaleFactorMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("DCA_SF").isValid())
-        m_currentScaleFactor = m_dataPoints.value("DCA_SF").toInt16();
-
-    if (m_dataPoints.value("DCV_SF").isValid())
-        m_voltageScaleFactor = m_dataPoints.value("DCV_SF").toInt16();
-
-    if (m_dataPoints.value("DCW_SF").isValid())
-        m_powerScaleFactor = m_dataPoints.value("DCW_SF").toInt16();
-
-    if (m_dataPoints.value("DCWH_SF").isValid())
-        m_energyScaleFactor = m_dataPoints.value("DCWH_SF").toInt16();
-
-    if (m_dataPoints.value("Evt").isValid())
-        m_globalEvents = static_cast<EvtFlags>(m_dataPoints.value("Evt").toUInt32());
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 6, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_globalEvents = static_cast<EvtFlags>(SunSpecDataPoint::convertToUInt32(registers + 6, 2, m_byteOrder));
 
-    if (m_dataPoints.value("N").isValid())
-        m_numberOfModules = m_dataPoints.value("N").toUInt16();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_numberOfModules = SunSpecDataPoint::convertToUInt16(registers + 8, 1);
 
-    if (m_dataPoints.value("TmsPer").isValid())
-        m_timestampPeriod = m_dataPoints.value("TmsPer").toUInt16();
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_timestampPeriod = SunSpecDataPoint::convertToUInt16(registers + 9, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -438,22 +300,22 @@ void SunSpecMpptModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecMpptModel *model)
 {
     debug.nospace().noquote() << "SunSpecMpptModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Evt") << "-->";
-    if (model->dataPoints().value("Evt").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecMpptModel::DataPointIndexGlobalEvents) << "-->";
+    if (model->dataPoint(SunSpecMpptModel::DataPointIndexGlobalEvents).isValid()) {
         debug.nospace().noquote() << model->globalEvents() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("N") << "-->";
-    if (model->dataPoints().value("N").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecMpptModel::DataPointIndexNumberOfModules) << "-->";
+    if (model->dataPoint(SunSpecMpptModel::DataPointIndexNumberOfModules).isValid()) {
         debug.nospace().noquote() << model->numberOfModules() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("TmsPer") << "-->";
-    if (model->dataPoints().value("TmsPer").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecMpptModel::DataPointIndexTimestampPeriod) << "-->";
+    if (model->dataPoint(SunSpecMpptModel::DataPointIndexTimestampPeriod).isValid()) {
         debug.nospace().noquote() << model->timestampPeriod() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
@@ -86,6 +86,19 @@ public:
     Q_DECLARE_FLAGS(DcevtFlags, Dcevt)
     Q_FLAG(Dcevt)
 
+    enum DataPointIndex {
+        DataPointIndexInputId = 0,
+        DataPointIndexInputIdSting,
+        DataPointIndexDcCurrent,
+        DataPointIndexDcVoltage,
+        DataPointIndexDcPower,
+        DataPointIndexLifetimeEnergy,
+        DataPointIndexTimestamp,
+        DataPointIndexTemperature,
+        DataPointIndexOperatingState,
+        DataPointIndexModuleEvents
+    };
+
     explicit SunSpecMpptModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecMpptModel *parent = nullptr);
     ~SunSpecMpptModelRepeatingBlock() override = default;
 
@@ -169,6 +182,18 @@ public:
     Q_DECLARE_FLAGS(EvtFlags, Evt)
     Q_FLAG(Evt)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexCurrentScaleFactor,
+        DataPointIndexVoltageScaleFactor,
+        DataPointIndexPowerScaleFactor,
+        DataPointIndexEnergyScaleFactor,
+        DataPointIndexGlobalEvents,
+        DataPointIndexNumberOfModules,
+        DataPointIndexTimestampPeriod
+    };
+
     explicit SunSpecMpptModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecMpptModel() override; 
 
@@ -200,9 +225,13 @@ protected:
 
 private:
     qint16 m_currentScaleFactor = 0;
+    double m_currentScaleFactorMultiplier = 1;
     qint16 m_voltageScaleFactor = 0;
+    double m_voltageScaleFactorMultiplier = 1;
     qint16 m_powerScaleFactor = 0;
+    double m_powerScaleFactorMultiplier = 1;
     qint16 m_energyScaleFactor = 0;
+    double m_energyScaleFactorMultiplier = 1;
     EvtFlags m_globalEvents;
     int m_numberOfModules = 0;
     quint16 m_timestampPeriod = 0;
@@ -31,6 +31,65 @@
 #include "sunspecnameplatemodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexDerTyp
+    { "DERTyp", "DERTyp", "Type of DER device. Default value is 4 to indicate PV device.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, true, 2, 0, 1 },
+    // DataPointIndexWRtg
+    { "WRtg", "WRtg", "Continuous power output capability of the inverter.", nullptr, "W", "uint16", "WRtg_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 3, 1, 1 },
+    // DataPointIndexWRtgSf
+    { "WRtg_SF", "WRtg_SF", "Scale factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 4, 2, 1 },
+    // DataPointIndexVaRtg
+    { "VARtg", "VARtg", "Continuous Volt-Ampere capability of the inverter.", nullptr, "VA", "uint16", "VARtg_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 5, 3, 1 },
+    // DataPointIndexVaRtgSf
+    { "VARtg_SF", "VARtg_SF", "Scale factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 6, 4, 1 },
+    // DataPointIndexVArRtgQ1
+    { "VArRtgQ1", "VArRtgQ1", "Continuous VAR capability of the inverter in quadrant 1.", nullptr, "var", "int16", "VArRtg_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 7, 5, 1 },
+    // DataPointIndexVArRtgQ2
+    { "VArRtgQ2", "VArRtgQ2", "Continuous VAR capability of the inverter in quadrant 2.", nullptr, "var", "int16", "VArRtg_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 8, 6, 1 },
+    // DataPointIndexVArRtgQ3
+    { "VArRtgQ3", "VArRtgQ3", "Continuous VAR capability of the inverter in quadrant 3.", nullptr, "var", "int16", "VArRtg_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 9, 7, 1 },
+    // DataPointIndexVArRtgQ4
+    { "VArRtgQ4", "VArRtgQ4", "Continuous VAR capability of the inverter in quadrant 4.", nullptr, "var", "int16", "VArRtg_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 10, 8, 1 },
+    // DataPointIndexVArRtgSf
+    { "VArRtg_SF", "VArRtg_SF", "Scale factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 11, 9, 1 },
+    // DataPointIndexARtg
+    { "ARtg", "ARtg", "Maximum RMS AC current level capability of the inverter.", nullptr, "A", "uint16", "ARtg_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 12, 10, 1 },
+    // DataPointIndexARtgSf
+    { "ARtg_SF", "ARtg_SF", "Scale factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 13, 11, 1 },
+    // DataPointIndexPfRtgQ1
+    { "PFRtgQ1", "PFRtgQ1", "Minimum power factor capability of the inverter in quadrant 1.", nullptr, "cos()", "int16", "PFRtg_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 14, 12, 1 },
+    // DataPointIndexPfRtgQ2
+    { "PFRtgQ2", "PFRtgQ2", "Minimum power factor capability of the inverter in quadrant 2.", nullptr, "cos()", "int16", "PFRtg_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 15, 13, 1 },
+    // DataPointIndexPfRtgQ3
+    { "PFRtgQ3", "PFRtgQ3", "Minimum power factor capability of the inverter in quadrant 3.", nullptr, "cos()", "int16", "PFRtg_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 16, 14, 1 },
+    // DataPointIndexPfRtgQ4
+    { "PFRtgQ4", "PFRtgQ4", "Minimum power factor capability of the inverter in quadrant 4.", nullptr, "cos()", "int16", "PFRtg_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 17, 15, 1 },
+    // DataPointIndexPfRtgSf
+    { "PFRtg_SF", "PFRtg_SF", "Scale factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 18, 16, 1 },
+    // DataPointIndexWhRtg
+    { "WHRtg", "WHRtg", "Nominal energy rating of storage device.", nullptr, "Wh", "uint16", "WHRtg_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 19, 17, 1 },
+    // DataPointIndexWhRtgSf
+    { "WHRtg_SF", "WHRtg_SF", "Scale factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 20, 18, 1 },
+    // DataPointIndexAhrRtg
+    { "AhrRtg", "AhrRtg", "The usable capacity of the battery.  Maximum charge minus minimum charge from a technology capability perspective (Amp-hour capacity rating).", nullptr, "AH", "uint16", "AhrRtg_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 21, 19, 1 },
+    // DataPointIndexAhrRtgSf
+    { "AhrRtg_SF", "AhrRtg_SF", "Scale factor for amp-hour rating.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 22, 20, 1 },
+    // DataPointIndexMaxChaRte
+    { "MaxChaRte", "MaxChaRte", "Maximum rate of energy transfer into the storage device.", nullptr, "W", "uint16", "MaxChaRte_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 23, 21, 1 },
+    // DataPointIndexMaxChaRteSf
+    { "MaxChaRte_SF", "MaxChaRte_SF", "Scale factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 24, 22, 1 },
+    // DataPointIndexMaxDisChaRte
+    { "MaxDisChaRte", "MaxDisChaRte", "Maximum rate of energy transfer out of the storage device.", nullptr, "W", "uint16", "MaxDisChaRte_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 25, 23, 1 },
+    // DataPointIndexMaxDisChaRteSf
+    { "MaxDisChaRte_SF", "MaxDisChaRte_SF", "Scale factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 26, 24, 1 },
+    // DataPointIndexPad
+    { "Pad", "Pad", "Pad register.", nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, false, 27, 25, 1 }
+};
+
 SunSpecNameplateModel::SunSpecNameplateModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 120, modelLength, byteOrder, parent)
 {
@@ -165,472 +224,140 @@ quint16 SunSpecNameplateModel::pad() const
 }
 void SunSpecNameplateModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint derTypDataPoint;
-    derTypDataPoint.setName("DERTyp");
-    derTypDataPoint.setLabel("DERTyp");
-    derTypDataPoint.setDescription("Type of DER device. Default value is 4 to indicate PV device.");
-    derTypDataPoint.setMandatory(true);
-    derTypDataPoint.setSize(1);
-    derTypDataPoint.setAddressOffset(2);
-    derTypDataPoint.setBlockOffset(0);
-    derTypDataPoint.setSunSpecDataType("enum16");
-    derTypDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(derTypDataPoint.name(), derTypDataPoint);
-
-    SunSpecDataPoint wRtgDataPoint;
-    wRtgDataPoint.setName("WRtg");
-    wRtgDataPoint.setLabel("WRtg");
-    wRtgDataPoint.setDescription("Continuous power output capability of the inverter.");
-    wRtgDataPoint.setUnits("W");
-    wRtgDataPoint.setMandatory(true);
-    wRtgDataPoint.setSize(1);
-    wRtgDataPoint.setAddressOffset(3);
-    wRtgDataPoint.setBlockOffset(1);
-    wRtgDataPoint.setScaleFactorName("WRtg_SF");
-    wRtgDataPoint.setSunSpecDataType("uint16");
-    wRtgDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wRtgDataPoint.name(), wRtgDataPoint);
-
-    SunSpecDataPoint wRtgSfDataPoint;
-    wRtgSfDataPoint.setName("WRtg_SF");
-    wRtgSfDataPoint.setLabel("WRtg_SF");
-    wRtgSfDataPoint.setDescription("Scale factor");
-    wRtgSfDataPoint.setMandatory(true);
-    wRtgSfDataPoint.setSize(1);
-    wRtgSfDataPoint.setAddressOffset(4);
-    wRtgSfDataPoint.setBlockOffset(2);
-    wRtgSfDataPoint.setSunSpecDataType("sunssf");
-    wRtgSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wRtgSfDataPoint.name(), wRtgSfDataPoint);
-
-    SunSpecDataPoint vaRtgDataPoint;
-    vaRtgDataPoint.setName("VARtg");
-    vaRtgDataPoint.setLabel("VARtg");
-    vaRtgDataPoint.setDescription("Continuous Volt-Ampere capability of the inverter.");
-    vaRtgDataPoint.setUnits("VA");
-    vaRtgDataPoint.setMandatory(true);
-    vaRtgDataPoint.setSize(1);
-    vaRtgDataPoint.setAddressOffset(5);
-    vaRtgDataPoint.setBlockOffset(3);
-    vaRtgDataPoint.setScaleFactorName("VARtg_SF");
-    vaRtgDataPoint.setSunSpecDataType("uint16");
-    vaRtgDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vaRtgDataPoint.name(), vaRtgDataPoint);
-
-    SunSpecDataPoint vaRtgSfDataPoint;
-    vaRtgSfDataPoint.setName("VARtg_SF");
-    vaRtgSfDataPoint.setLabel("VARtg_SF");
-    vaRtgSfDataPoint.setDescription("Scale factor");
-    vaRtgSfDataPoint.setMandatory(true);
-    vaRtgSfDataPoint.setSize(1);
-    vaRtgSfDataPoint.setAddressOffset(6);
-    vaRtgSfDataPoint.setBlockOffset(4);
-    vaRtgSfDataPoint.setSunSpecDataType("sunssf");
-    vaRtgSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vaRtgSfDataPoint.name(), vaRtgSfDataPoint);
-
-    SunSpecDataPoint vArRtgQ1DataPoint;
-    vArRtgQ1DataPoint.setName("VArRtgQ1");
-    vArRtgQ1DataPoint.setLabel("VArRtgQ1");
-    vArRtgQ1DataPoint.setDescription("Continuous VAR capability of the inverter in quadrant 1.");
-    vArRtgQ1DataPoint.setUnits("var");
-    vArRtgQ1DataPoint.setMandatory(true);
-    vArRtgQ1DataPoint.setSize(1);
-    vArRtgQ1DataPoint.setAddressOffset(7);
-    vArRtgQ1DataPoint.setBlockOffset(5);
-    vArRtgQ1DataPoint.setScaleFactorName("VArRtg_SF");
-    vArRtgQ1DataPoint.setSunSpecDataType("int16");
-    vArRtgQ1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArRtgQ1DataPoint.name(), vArRtgQ1DataPoint);
-
-    SunSpecDataPoint vArRtgQ2DataPoint;
-    vArRtgQ2DataPoint.setName("VArRtgQ2");
-    vArRtgQ2DataPoint.setLabel("VArRtgQ2");
-    vArRtgQ2DataPoint.setDescription("Continuous VAR capability of the inverter in quadrant 2.");
-    vArRtgQ2DataPoint.setUnits("var");
-    vArRtgQ2DataPoint.setMandatory(true);
-    vArRtgQ2DataPoint.setSize(1);
-    vArRtgQ2DataPoint.setAddressOffset(8);
-    vArRtgQ2DataPoint.setBlockOffset(6);
-    vArRtgQ2DataPoint.setScaleFactorName("VArRtg_SF");
-    vArRtgQ2DataPoint.setSunSpecDataType("int16");
-    vArRtgQ2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArRtgQ2DataPoint.name(), vArRtgQ2DataPoint);
-
-    SunSpecDataPoint vArRtgQ3DataPoint;
-    vArRtgQ3DataPoint.setName("VArRtgQ3");
-    vArRtgQ3DataPoint.setLabel("VArRtgQ3");
-    vArRtgQ3DataPoint.setDescription("Continuous VAR capability of the inverter in quadrant 3.");
-    vArRtgQ3DataPoint.setUnits("var");
-    vArRtgQ3DataPoint.setMandatory(true);
-    vArRtgQ3DataPoint.setSize(1);
-    vArRtgQ3DataPoint.setAddressOffset(9);
-    vArRtgQ3DataPoint.setBlockOffset(7);
-    vArRtgQ3DataPoint.setScaleFactorName("VArRtg_SF");
-    vArRtgQ3DataPoint.setSunSpecDataType("int16");
-    vArRtgQ3DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArRtgQ3DataPoint.name(), vArRtgQ3DataPoint);
-
-    SunSpecDataPoint vArRtgQ4DataPoint;
-    vArRtgQ4DataPoint.setName("VArRtgQ4");
-    vArRtgQ4DataPoint.setLabel("VArRtgQ4");
-    vArRtgQ4DataPoint.setDescription("Continuous VAR capability of the inverter in quadrant 4.");
-    vArRtgQ4DataPoint.setUnits("var");
-    vArRtgQ4DataPoint.setMandatory(true);
-    vArRtgQ4DataPoint.setSize(1);
-    vArRtgQ4DataPoint.setAddressOffset(10);
-    vArRtgQ4DataPoint.setBlockOffset(8);
-    vArRtgQ4DataPoint.setScaleFactorName("VArRtg_SF");
-    vArRtgQ4DataPoint.setSunSpecDataType("int16");
-    vArRtgQ4DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArRtgQ4DataPoint.name(), vArRtgQ4DataPoint);
-
-    SunSpecDataPoint vArRtgSfDataPoint;
-    vArRtgSfDataPoint.setName("VArRtg_SF");
-    vArRtgSfDataPoint.setLabel("VArRtg_SF");
-    vArRtgSfDataPoint.setDescription("Scale factor");
-    vArRtgSfDataPoint.setMandatory(true);
-    vArRtgSfDataPoint.setSize(1);
-    vArRtgSfDataPoint.setAddressOffset(11);
-    vArRtgSfDataPoint.setBlockOffset(9);
-    vArRtgSfDataPoint.setSunSpecDataType("sunssf");
-    vArRtgSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArRtgSfDataPoint.name(), vArRtgSfDataPoint);
-
-    SunSpecDataPoint aRtgDataPoint;
-    aRtgDataPoint.setName("ARtg");
-    aRtgDataPoint.setLabel("ARtg");
-    aRtgDataPoint.setDescription("Maximum RMS AC current level capability of the inverter.");
-    aRtgDataPoint.setUnits("A");
-    aRtgDataPoint.setMandatory(true);
-    aRtgDataPoint.setSize(1);
-    aRtgDataPoint.setAddressOffset(12);
-    aRtgDataPoint.setBlockOffset(10);
-    aRtgDataPoint.setScaleFactorName("ARtg_SF");
-    aRtgDataPoint.setSunSpecDataType("uint16");
-    aRtgDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(aRtgDataPoint.name(), aRtgDataPoint);
-
-    SunSpecDataPoint aRtgSfDataPoint;
-    aRtgSfDataPoint.setName("ARtg_SF");
-    aRtgSfDataPoint.setLabel("ARtg_SF");
-    aRtgSfDataPoint.setDescription("Scale factor");
-    aRtgSfDataPoint.setMandatory(true);
-    aRtgSfDataPoint.setSize(1);
-    aRtgSfDataPoint.setAddressOffset(13);
-    aRtgSfDataPoint.setBlockOffset(11);
-    aRtgSfDataPoint.setSunSpecDataType("sunssf");
-    aRtgSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(aRtgSfDataPoint.name(), aRtgSfDataPoint);
-
-    SunSpecDataPoint pfRtgQ1DataPoint;
-    pfRtgQ1DataPoint.setName("PFRtgQ1");
-    pfRtgQ1DataPoint.setLabel("PFRtgQ1");
-    pfRtgQ1DataPoint.setDescription("Minimum power factor capability of the inverter in quadrant 1.");
-    pfRtgQ1DataPoint.setUnits("cos()");
-    pfRtgQ1DataPoint.setMandatory(true);
-    pfRtgQ1DataPoint.setSize(1);
-    pfRtgQ1DataPoint.setAddressOffset(14);
-    pfRtgQ1DataPoint.setBlockOffset(12);
-    pfRtgQ1DataPoint.setScaleFactorName("PFRtg_SF");
-    pfRtgQ1DataPoint.setSunSpecDataType("int16");
-    pfRtgQ1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pfRtgQ1DataPoint.name(), pfRtgQ1DataPoint);
-
-    SunSpecDataPoint pfRtgQ2DataPoint;
-    pfRtgQ2DataPoint.setName("PFRtgQ2");
-    pfRtgQ2DataPoint.setLabel("PFRtgQ2");
-    pfRtgQ2DataPoint.setDescription("Minimum power factor capability of the inverter in quadrant 2.");
-    pfRtgQ2DataPoint.setUnits("cos()");
-    pfRtgQ2DataPoint.setMandatory(true);
-    pfRtgQ2DataPoint.setSize(1);
-    pfRtgQ2DataPoint.setAddressOffset(15);
-    pfRtgQ2DataPoint.setBlockOffset(13);
-    pfRtgQ2DataPoint.setScaleFactorName("PFRtg_SF");
-    pfRtgQ2DataPoint.setSunSpecDataType("int16");
-    pfRtgQ2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pfRtgQ2DataPoint.name(), pfRtgQ2DataPoint);
-
-    SunSpecDataPoint pfRtgQ3DataPoint;
-    pfRtgQ3DataPoint.setName("PFRtgQ3");
-    pfRtgQ3DataPoint.setLabel("PFRtgQ3");
-    pfRtgQ3DataPoint.setDescription("Minimum power factor capability of the inverter in quadrant 3.");
-    pfRtgQ3DataPoint.setUnits("cos()");
-    pfRtgQ3DataPoint.setMandatory(true);
-    pfRtgQ3DataPoint.setSize(1);
-    pfRtgQ3DataPoint.setAddressOffset(16);
-    pfRtgQ3DataPoint.setBlockOffset(14);
-    pfRtgQ3DataPoint.setScaleFactorName("PFRtg_SF");
-    pfRtgQ3DataPoint.setSunSpecDataType("int16");
-    pfRtgQ3DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pfRtgQ3DataPoint.name(), pfRtgQ3DataPoint);
-
-    SunSpecDataPoint pfRtgQ4DataPoint;
-    pfRtgQ4DataPoint.setName("PFRtgQ4");
-    pfRtgQ4DataPoint.setLabel("PFRtgQ4");
-    pfRtgQ4DataPoint.setDescription("Minimum power factor capability of the inverter in quadrant 4.");
-    pfRtgQ4DataPoint.setUnits("cos()");
-    pfRtgQ4DataPoint.setMandatory(true);
-    pfRtgQ4DataPoint.setSize(1);
-    pfRtgQ4DataPoint.setAddressOffset(17);
-    pfRtgQ4DataPoint.setBlockOffset(15);
-    pfRtgQ4DataPoint.setScaleFactorName("PFRtg_SF");
-    pfRtgQ4DataPoint.setSunSpecDataType("int16");
-    pfRtgQ4DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pfRtgQ4DataPoint.name(), pfRtgQ4DataPoint);
-
-    SunSpecDataPoint pfRtgSfDataPoint;
-    pfRtgSfDataPoint.setName("PFRtg_SF");
-    pfRtgSfDataPoint.setLabel("PFRtg_SF");
-    pfRtgSfDataPoint.setDescription("Scale factor");
-    pfRtgSfDataPoint.setMandatory(true);
-    pfRtgSfDataPoint.setSize(1);
-    pfRtgSfDataPoint.setAddressOffset(18);
-    pfRtgSfDataPoint.setBlockOffset(16);
-    pfRtgSfDataPoint.setSunSpecDataType("sunssf");
-    pfRtgSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pfRtgSfDataPoint.name(), pfRtgSfDataPoint);
-
-    SunSpecDataPoint whRtgDataPoint;
-    whRtgDataPoint.setName("WHRtg");
-    whRtgDataPoint.setLabel("WHRtg");
-    whRtgDataPoint.setDescription("Nominal energy rating of storage device.");
-    whRtgDataPoint.setUnits("Wh");
-    whRtgDataPoint.setSize(1);
-    whRtgDataPoint.setAddressOffset(19);
-    whRtgDataPoint.setBlockOffset(17);
-    whRtgDataPoint.setScaleFactorName("WHRtg_SF");
-    whRtgDataPoint.setSunSpecDataType("uint16");
-    whRtgDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(whRtgDataPoint.name(), whRtgDataPoint);
-
-    SunSpecDataPoint whRtgSfDataPoint;
-    whRtgSfDataPoint.setName("WHRtg_SF");
-    whRtgSfDataPoint.setLabel("WHRtg_SF");
-    whRtgSfDataPoint.setDescription("Scale factor");
-    whRtgSfDataPoint.setSize(1);
-    whRtgSfDataPoint.setAddressOffset(20);
-    whRtgSfDataPoint.setBlockOffset(18);
-    whRtgSfDataPoint.setSunSpecDataType("sunssf");
-    whRtgSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(whRtgSfDataPoint.name(), whRtgSfDataPoint);
-
-    SunSpecDataPoint ahrRtgDataPoint;
-    ahrRtgDataPoint.setName("AhrRtg");
-    ahrRtgDataPoint.setLabel("AhrRtg");
-    ahrRtgDataPoint.setDescription("The usable capacity of the battery.  Maximum charge minus minimum charge from a technology capability perspective (Amp-hour capacity rating).");
-    ahrRtgDataPoint.setUnits("AH");
-    ahrRtgDataPoint.setSize(1);
-    ahrRtgDataPoint.setAddressOffset(21);
-    ahrRtgDataPoint.setBlockOffset(19);
-    ahrRtgDataPoint.setScaleFactorName("AhrRtg_SF");
-    ahrRtgDataPoint.setSunSpecDataType("uint16");
-    ahrRtgDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ahrRtgDataPoint.name(), ahrRtgDataPoint);
-
-    SunSpecDataPoint ahrRtgSfDataPoint;
-    ahrRtgSfDataPoint.setName("AhrRtg_SF");
-    ahrRtgSfDataPoint.setLabel("AhrRtg_SF");
-    ahrRtgSfDataPoint.setDescription("Scale factor for amp-hour rating.");
-    ahrRtgSfDataPoint.setSize(1);
-    ahrRtgSfDataPoint.setAddressOffset(22);
-    ahrRtgSfDataPoint.setBlockOffset(20);
-    ahrRtgSfDataPoint.setSunSpecDataType("sunssf");
-    ahrRtgSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ahrRtgSfDataPoint.name(), ahrRtgSfDataPoint);
-
-    SunSpecDataPoint maxChaRteDataPoint;
-    maxChaRteDataPoint.setName("MaxChaRte");
-    maxChaRteDataPoint.setLabel("MaxChaRte");
-    maxChaRteDataPoint.setDescription("Maximum rate of energy transfer into the storage device.");
-    maxChaRteDataPoint.setUnits("W");
-    maxChaRteDataPoint.setSize(1);
-    maxChaRteDataPoint.setAddressOffset(23);
-    maxChaRteDataPoint.setBlockOffset(21);
-    maxChaRteDataPoint.setScaleFactorName("MaxChaRte_SF");
-    maxChaRteDataPoint.setSunSpecDataType("uint16");
-    maxChaRteDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxChaRteDataPoint.name(), maxChaRteDataPoint);
-
-    SunSpecDataPoint maxChaRteSfDataPoint;
-    maxChaRteSfDataPoint.setName("MaxChaRte_SF");
-    maxChaRteSfDataPoint.setLabel("MaxChaRte_SF");
-    maxChaRteSfDataPoint.setDescription("Scale factor");
-    maxChaRteSfDataPoint.setSize(1);
-    maxChaRteSfDataPoint.setAddressOffset(24);
-    maxChaRteSfDataPoint.setBlockOffset(22);
-    maxChaRteSfDataPoint.setSunSpecDataType("sunssf");
-    maxChaRteSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxChaRteSfDataPoint.name(), maxChaRteSfDataPoint);
-
-    SunSpecDataPoint maxDisChaRteDataPoint;
-    maxDisChaRteDataPoint.setName("MaxDisChaRte");
-    maxDisChaRteDataPoint.setLabel("MaxDisChaRte");
-    maxDisChaRteDataPoint.setDescription("Maximum rate of energy transfer out of the storage device.");
-    maxDisChaRteDataPoint.setUnits("W");
-    maxDisChaRteDataPoint.setSize(1);
-    maxDisChaRteDataPoint.setAddressOffset(25);
-    maxDisChaRteDataPoint.setBlockOffset(23);
-    maxDisChaRteDataPoint.setScaleFactorName("MaxDisChaRte_SF");
-    maxDisChaRteDataPoint.setSunSpecDataType("uint16");
-    maxDisChaRteDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxDisChaRteDataPoint.name(), maxDisChaRteDataPoint);
-
-    SunSpecDataPoint maxDisChaRteSfDataPoint;
-    maxDisChaRteSfDataPoint.setName("MaxDisChaRte_SF");
-    maxDisChaRteSfDataPoint.setLabel("MaxDisChaRte_SF");
-    maxDisChaRteSfDataPoint.setDescription("Scale factor");
-    maxDisChaRteSfDataPoint.setSize(1);
-    maxDisChaRteSfDataPoint.setAddressOffset(26);
-    maxDisChaRteSfDataPoint.setBlockOffset(24);
-    maxDisChaRteSfDataPoint.setSunSpecDataType("sunssf");
-    maxDisChaRteSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxDisChaRteSfDataPoint.name(), maxDisChaRteSfDataPoint);
-
-    SunSpecDataPoint padDataPoint;
-    padDataPoint.setName("Pad");
-    padDataPoint.setLabel("Pad");
-    padDataPoint.setDescription("Pad register.");
-    padDataPoint.setSize(1);
-    padDataPoint.setAddressOffset(27);
-    padDataPoint.setBlockOffset(25);
-    padDataPoint.setSunSpecDataType("pad");
-    padDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(padDataPoint.name(), padDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 28;
 }
 
 void SunSpecNameplateModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("WRtg_SF").isValid())
-        m_wRtgSf = m_dataPoints.value("WRtg_SF").toInt16();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 4, 1);
+        if (scaleFactor != m_wRtgSf) {
+            m_wRtgSf = scaleFactor;
+            m_wRtgSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("VARtg_SF").isValid())
-        m_vaRtgSf = m_dataPoints.value("VARtg_SF").toInt16();
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 6, 1);
+        if (scaleFactor != m_vaRtgSf) {
+            m_vaRtgSf = scaleFactor;
+            m_vaRtgSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("VArRtg_SF").isValid())
-        m_vArRtgSf = m_dataPoints.value("VArRtg_SF").toInt16();
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 11, 1);
+        if (scaleFactor != m_vArRtgSf) {
+            m_vArRtgSf = scaleFactor;
+            m_vArRtgSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("ARtg_SF").isValid())
-        m_aRtgSf = m_dataPoints.value("ARtg_SF").toInt16();
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 13, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 13, 1);
+        if (scaleFactor != m_aRtgSf) {
+            m_aRtgSf = scaleFactor;
+            m_aRtgSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("PFRtg_SF").isValid())
-        m_pfRtgSf = m_dataPoints.value("PFRtg_SF").toInt16();
+    if (registerCount >= 19 && SunSpecDataPoint::isValid(registers + 18, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 18, 1);
+        if (scaleFactor != m_pfRtgSf) {
+            m_pfRtgSf = scaleFactor;
+            m_pfRtgSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("WHRtg_SF").isValid())
-        m_whRtgSf = m_dataPoints.value("WHRtg_SF").toInt16();
+    if (registerCount >= 21 && SunSpecDataPoint::isValid(registers + 20, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 20, 1);
+        if (scaleFactor != m_whRtgSf) {
+            m_whRtgSf = scaleFactor;
+            m_whRtgSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("AhrRtg_SF").isValid())
-        m_ahrRtgSf = m_dataPoints.value("AhrRtg_SF").toInt16();
+    if (registerCount >= 23 && SunSpecDataPoint::isValid(registers + 22, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 22, 1);
+        if (scaleFactor != m_ahrRtgSf) {
+            m_ahrRtgSf = scaleFactor;
+            m_ahrRtgSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("MaxChaRte_SF").isValid())
-        m_maxChaRteSf = m_dataPoints.value("MaxChaRte_SF").toInt16();
+    if (registerCount >= 25 && SunSpecDataPoint::isValid(registers + 24, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 24, 1);
+        if (scaleFactor != m_maxChaRteSf) {
+            m_maxChaRteSf = scaleFactor;
+            m_maxChaRteSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("MaxDisChaRte_SF").isValid())
-        m_maxDisChaRteSf = m_dataPoints.value("MaxDisChaRte_SF").toInt16();
+    if (registerCount >= 27 && SunSpecDataPoint::isValid(registers + 26, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 26, 1);
+        if (scaleFactor != m_maxDisChaRteSf) {
+            m_maxDisChaRteSf = scaleFactor;
+            m_maxDisChaRteSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("DERTyp").isValid())
-        m_derTyp = static_cast<Dertyp>(m_dataPoints.value("DERTyp").toUInt16());
-
-    if (m_dataPoints.value("WRtg").isValid())
-        m_wRtg = m_dataPoints.value("WRtg").toFloatWithSSF(m_wRtgSf);
-
-    if (m_dataPoints.value("WRtg_SF").isValid())
-        m_wRtgSf = m_dataPoints.value("WRtg_SF").toInt16();
-
-    if (m_dataPoints.value("VARtg").isValid())
-        m_vaRtg = m_dataPoints.value("VARtg").toFloatWithSSF(m_vaRtgSf);
-
-    if (m_dataPoints.value("VARtg_SF").isValid())
-        m_vaRtgSf = m_dataPoints.value("VARtg_SF").toInt16();
-
-    if (m_dataPoints.value("VArRtgQ1").isValid())
-        m_vArRtgQ1 = m_dataPoints.value("VArRtgQ1").toFloatWithSSF(m_vArRtgSf);
-
-    if (m_dataPoints.value("VArRtgQ2").isValid())
-        m_vArRtgQ2 = m_dataPoints.value("VArRtgQ2").toFloatWithSSF(m_vArRtgSf);
-
-    if (m_dataPoints.value("VArRtgQ3").isValid())
-        m_vArRtgQ3 = m_dataPoints.value("VArRtgQ3").toFloatWithSSF(m_vArRtgSf);
-
-    if (m_dataPoints.value("VArRtgQ4").isValid())
-        m_vArRtgQ4 = m_dataPoints.value("VArRtgQ4").toFloatWithSSF(m_vArRtgSf);
-
-    if (m_dataPoints.value("VArRtg_SF").isValid())
-        m_vArRtgSf = m_dataPoints.value("VArRtg_SF").toInt16();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_derTyp = static_cast<Dertyp>(SunSpecDataPoint::convertToUInt16(registers + 2, 1));
 
-    if (m_dataPoints.value("ARtg").isValid())
-        m_aRtg = m_dataPoints.value("ARtg").toFloatWithSSF(m_aRtgSf);
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_wRtg = SunSpecDataPoint::convertToUInt16(registers + 3, 1) * m_wRtgSfMultiplier;
 
-    if (m_dataPoints.value("ARtg_SF").isValid())
-        m_aRtgSf = m_dataPoints.value("ARtg_SF").toInt16();
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_vaRtg = SunSpecDataPoint::convertToUInt16(registers + 5, 1) * m_vaRtgSfMultiplier;
 
-    if (m_dataPoints.value("PFRtgQ1").isValid())
-        m_pfRtgQ1 = m_dataPoints.value("PFRtgQ1").toFloatWithSSF(m_pfRtgSf);
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_vArRtgQ1 = SunSpecDataPoint::convertToInt16(registers + 7, 1) * m_vArRtgSfMultiplier;
 
-    if (m_dataPoints.value("PFRtgQ2").isValid())
-        m_pfRtgQ2 = m_dataPoints.value("PFRtgQ2").toFloatWithSSF(m_pfRtgSf);
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_vArRtgQ2 = SunSpecDataPoint::convertToInt16(registers + 8, 1) * m_vArRtgSfMultiplier;
 
-    if (m_dataPoints.value("PFRtgQ3").isValid())
-        m_pfRtgQ3 = m_dataPoints.value("PFRtgQ3").toFloatWithSSF(m_pfRtgSf);
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_vArRtgQ3 = SunSpecDataPoint::convertToInt16(registers + 9, 1) * m_vArRtgSfMultiplier;
 
-    if (m_dataPoints.value("PFRtgQ4").isValid())
-        m_pfRtgQ4 = m_dataPoints.value("PFRtgQ4").toFloatWithSSF(m_pfRtgSf);
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_vArRtgQ4 = SunSpecDataPoint::convertToInt16(registers + 10, 1) * m_vArRtgSfMultiplier;
 
-    if (m_dataPoints.value("PFRtg_SF").isValid())
-        m_pfRtgSf = m_dataPoints.value("PFRtg_SF").toInt16();
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 12, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_aRtg = SunSpecDataPoint::convertToUInt16(registers + 12, 1) * m_aRtgSfMultiplier;
 
-    if (m_dataPoints.value("WHRtg").isValid())
-        m_whRtg = m_dataPoints.value("WHRtg").toFloatWithSSF(m_whRtgSf);
+    if (registerCount >= 15 && SunSpecDataPoint::isValid(registers + 14, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_pfRtgQ1 = SunSpecDataPoint::convertToInt16(registers + 14, 1) * m_pfRtgSfMultiplier;
 
-    if (m_dataPoints.value("WHRtg_SF").isValid())
-        m_whRtgSf = m_dataPoints.value("WHRtg_SF").toInt16();
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 15, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_pfRtgQ2 = SunSpecDataPoint::convertToInt16(registers + 15, 1) * m_pfRtgSfMultiplier;
 
-    if (m_dataPoints.value("AhrRtg").isValid())
-        m_ahrRtg = m_dataPoints.value("AhrRtg").toFloatWithSSF(m_ahrRtgSf);
+    if (registerCount >= 17 && SunSpecDataPoint::isValid(registers + 16, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_pfRtgQ3 = SunSpecDataPoint::convertToInt16(registers + 16, 1) * m_pfRtgSfMultiplier;
 
-    if (m_dataPoints.value("AhrRtg_SF").isValid())
-        m_ahrRtgSf = m_dataPoints.value("AhrRtg_SF").toInt16();
+    if (registerCount >= 18 && SunSpecDataPoint::isValid(registers + 17, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_pfRtgQ4 = SunSpecDataPoint::convertToInt16(registers + 17, 1) * m_pfRtgSfMultiplier;
 
-    if (m_dataPoints.value("MaxChaRte").isValid())
-        m_maxChaRte = m_dataPoints.value("MaxChaRte").toFloatWithSSF(m_maxChaRteSf);
+    if (registerCount >= 20 && SunSpecDataPoint::isValid(registers + 19, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_whRtg = SunSpecDataPoint::convertToUInt16(registers + 19, 1) * m_whRtgSfMultiplier;
 
-    if (m_dataPoints.value("MaxChaRte_SF").isValid())
-        m_maxChaRteSf = m_dataPoints.value("MaxChaRte_SF").toInt16();
+    if (registerCount >= 22 && SunSpecDataPoint::isValid(registers + 21, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_ahrRtg = SunSpecDataPoint::convertToUInt16(registers + 21, 1) * m_ahrRtgSfMultiplier;
 
-    if (m_dataPoints.value("MaxDisChaRte").isValid())
-        m_maxDisChaRte = m_dataPoints.value("MaxDisChaRte").toFloatWithSSF(m_maxDisChaRteSf);
+    if (registerCount >= 24 && SunSpecDataPoint::isValid(registers + 23, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxChaRte = SunSpecDataPoint::convertToUInt16(registers + 23, 1) * m_maxChaRteSfMultiplier;
 
-    if (m_dataPoints.value("MaxDisChaRte_SF").isValid())
-        m_maxDisChaRteSf = m_dataPoints.value("MaxDisChaRte_SF").toInt16();
+    if (registerCount >= 26 && SunSpecDataPoint::isValid(registers + 25, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxDisChaRte = SunSpecDataPoint::convertToUInt16(registers + 25, 1) * m_maxDisChaRteSfMultiplier;
 
-    if (m_dataPoints.value("Pad").isValid())
-        m_pad = m_dataPoints.value("Pad").toUInt16();
+    if (registerCount >= 28 && SunSpecDataPoint::isValid(registers + 27, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad = SunSpecDataPoint::convertToUInt16(registers + 27, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -639,120 +366,120 @@ void SunSpecNameplateModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecNameplateModel *model)
 {
     debug.nospace().noquote() << "SunSpecNameplateModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("DERTyp") << "-->";
-    if (model->dataPoints().value("DERTyp").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexDerTyp) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexDerTyp).isValid()) {
         debug.nospace().noquote() << model->derTyp() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WRtg") << "-->";
-    if (model->dataPoints().value("WRtg").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexWRtg) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexWRtg).isValid()) {
         debug.nospace().noquote() << model->wRtg() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VARtg") << "-->";
-    if (model->dataPoints().value("VARtg").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexVaRtg) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexVaRtg).isValid()) {
         debug.nospace().noquote() << model->vaRtg() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArRtgQ1") << "-->";
-    if (model->dataPoints().value("VArRtgQ1").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexVArRtgQ1) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexVArRtgQ1).isValid()) {
         debug.nospace().noquote() << model->vArRtgQ1() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArRtgQ2") << "-->";
-    if (model->dataPoints().value("VArRtgQ2").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexVArRtgQ2) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexVArRtgQ2).isValid()) {
         debug.nospace().noquote() << model->vArRtgQ2() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArRtgQ3") << "-->";
-    if (model->dataPoints().value("VArRtgQ3").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexVArRtgQ3) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexVArRtgQ3).isValid()) {
         debug.nospace().noquote() << model->vArRtgQ3() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArRtgQ4") << "-->";
-    if (model->dataPoints().value("VArRtgQ4").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexVArRtgQ4) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexVArRtgQ4).isValid()) {
         debug.nospace().noquote() << model->vArRtgQ4() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ARtg") << "-->";
-    if (model->dataPoints().value("ARtg").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexARtg) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexARtg).isValid()) {
         debug.nospace().noquote() << model->aRtg() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("PFRtgQ1") << "-->";
-    if (model->dataPoints().value("PFRtgQ1").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexPfRtgQ1) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexPfRtgQ1).isValid()) {
         debug.nospace().noquote() << model->pfRtgQ1() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("PFRtgQ2") << "-->";
-    if (model->dataPoints().value("PFRtgQ2").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexPfRtgQ2) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexPfRtgQ2).isValid()) {
         debug.nospace().noquote() << model->pfRtgQ2() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("PFRtgQ3") << "-->";
-    if (model->dataPoints().value("PFRtgQ3").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexPfRtgQ3) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexPfRtgQ3).isValid()) {
         debug.nospace().noquote() << model->pfRtgQ3() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("PFRtgQ4") << "-->";
-    if (model->dataPoints().value("PFRtgQ4").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexPfRtgQ4) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexPfRtgQ4).isValid()) {
         debug.nospace().noquote() << model->pfRtgQ4() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WHRtg") << "-->";
-    if (model->dataPoints().value("WHRtg").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexWhRtg) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexWhRtg).isValid()) {
         debug.nospace().noquote() << model->whRtg() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("AhrRtg") << "-->";
-    if (model->dataPoints().value("AhrRtg").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexAhrRtg) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexAhrRtg).isValid()) {
         debug.nospace().noquote() << model->ahrRtg() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("MaxChaRte") << "-->";
-    if (model->dataPoints().value("MaxChaRte").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexMaxChaRte) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexMaxChaRte).isValid()) {
         debug.nospace().noquote() << model->maxChaRte() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("MaxDisChaRte") << "-->";
-    if (model->dataPoints().value("MaxDisChaRte").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexMaxDisChaRte) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexMaxDisChaRte).isValid()) {
         debug.nospace().noquote() << model->maxDisChaRte() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Pad") << "-->";
-    if (model->dataPoints().value("Pad").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecNameplateModel::DataPointIndexPad) << "-->";
+    if (model->dataPoint(SunSpecNameplateModel::DataPointIndexPad).isValid()) {
         debug.nospace().noquote() << model->pad() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
@@ -48,6 +48,37 @@ public:
     };
     Q_ENUM(Dertyp)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexDerTyp,
+        DataPointIndexWRtg,
+        DataPointIndexWRtgSf,
+        DataPointIndexVaRtg,
+        DataPointIndexVaRtgSf,
+        DataPointIndexVArRtgQ1,
+        DataPointIndexVArRtgQ2,
+        DataPointIndexVArRtgQ3,
+        DataPointIndexVArRtgQ4,
+        DataPointIndexVArRtgSf,
+        DataPointIndexARtg,
+        DataPointIndexARtgSf,
+        DataPointIndexPfRtgQ1,
+        DataPointIndexPfRtgQ2,
+        DataPointIndexPfRtgQ3,
+        DataPointIndexPfRtgQ4,
+        DataPointIndexPfRtgSf,
+        DataPointIndexWhRtg,
+        DataPointIndexWhRtgSf,
+        DataPointIndexAhrRtg,
+        DataPointIndexAhrRtgSf,
+        DataPointIndexMaxChaRte,
+        DataPointIndexMaxChaRteSf,
+        DataPointIndexMaxDisChaRte,
+        DataPointIndexMaxDisChaRteSf,
+        DataPointIndexPad
+    };
+
     explicit SunSpecNameplateModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecNameplateModel() override; 
 
@@ -118,28 +149,37 @@ private:
     Dertyp m_derTyp;
     float m_wRtg = 0;
     qint16 m_wRtgSf = 0;
+    double m_wRtgSfMultiplier = 1;
     float m_vaRtg = 0;
     qint16 m_vaRtgSf = 0;
+    double m_vaRtgSfMultiplier = 1;
     float m_vArRtgQ1 = 0;
     float m_vArRtgQ2 = 0;
     float m_vArRtgQ3 = 0;
     float m_vArRtgQ4 = 0;
     qint16 m_vArRtgSf = 0;
+    double m_vArRtgSfMultiplier = 1;
     float m_aRtg = 0;
     qint16 m_aRtgSf = 0;
+    double m_aRtgSfMultiplier = 1;
     float m_pfRtgQ1 = 0;
     float m_pfRtgQ2 = 0;
     float m_pfRtgQ3 = 0;
     float m_pfRtgQ4 = 0;
     qint16 m_pfRtgSf = 0;
+    double m_pfRtgSfMultiplier = 1;
     float m_whRtg = 0;
     qint16 m_whRtgSf = 0;
+    double m_whRtgSfMultiplier = 1;
     float m_ahrRtg = 0;
     qint16 m_ahrRtgSf = 0;
+    double m_ahrRtgSfMultiplier = 1;
     float m_maxChaRte = 0;
     qint16 m_maxChaRteSf = 0;
+    double m_maxChaRteSfMultiplier = 1;
     float m_maxDisChaRte = 0;
     qint16 m_maxDisChaRteSf = 0;
+    double m_maxDisChaRteSfMultiplier = 1;
     quint16 m_pad = 0;
 
 
@@ -31,6 +31,29 @@
 #include "sunspecpricingmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexModEna
+    { "ModEna", "ModEna", "Is price-based charge/discharge mode active?", nullptr, nullptr, "bitfield16", nullptr, SunSpecDataPoint::BitField16, SunSpecDataPoint::AccessReadWrite, true, 2, 0, 1 },
+    // DataPointIndexSigType
+    { "SigType", "SigType", "Meaning of the pricing signal. When a Price schedule is used, type must match the schedule range variable description.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, false, 3, 1, 1 },
+    // DataPointIndexSig
+    { "Sig", "Sig", "Utility/ESP specific pricing signal. Content depends on pricing signal type. When H/M/L type is specified. Low=0; Med=1; High=2.", nullptr, nullptr, "int16", "Sig_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, true, 4, 2, 1 },
+    // DataPointIndexWinTms
+    { "WinTms", "WinTms", "Time window for charge/discharge pricing change.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 5, 3, 1 },
+    // DataPointIndexRvtTms
+    { "RvtTms", "RvtTms", "Timeout period for charge/discharge pricing change.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 6, 4, 1 },
+    // DataPointIndexRmpTms
+    { "RmpTms", "RmpTms", "Ramp time for moving from current charge or discharge level to new level.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 7, 5, 1 },
+    // DataPointIndexSigSf
+    { "Sig_SF", "Sig_SF", "Pricing signal scale factor.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 8, 6, 1 },
+    // DataPointIndexPad
+    { "Pad", nullptr, nullptr, nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, false, 9, 7, 1 }
+};
+
 SunSpecPricingModel::SunSpecPricingModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 125, modelLength, byteOrder, parent)
 {
@@ -69,7 +92,7 @@ QModbusReply *SunSpecPricingModel::setModEna(ModenaFlags modEna)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ModEna");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexModEna]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(modEna));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -87,7 +110,7 @@ QModbusReply *SunSpecPricingModel::setSigType(Sigtype sigType)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("SigType");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexSigType]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(sigType));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -105,7 +128,7 @@ QModbusReply *SunSpecPricingModel::setSig(float sig)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("Sig");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexSig]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(sig, m_sigSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -123,7 +146,7 @@ QModbusReply *SunSpecPricingModel::setWinTms(quint16 winTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("WinTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexWinTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(winTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -141,7 +164,7 @@ QModbusReply *SunSpecPricingModel::setRvtTms(quint16 rvtTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("RvtTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexRvtTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(rvtTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -159,7 +182,7 @@ QModbusReply *SunSpecPricingModel::setRmpTms(quint16 rmpTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("RmpTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexRmpTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(rmpTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -177,160 +200,46 @@ quint16 SunSpecPricingModel::pad() const
 }
 void SunSpecPricingModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint modEnaDataPoint;
-    modEnaDataPoint.setName("ModEna");
-    modEnaDataPoint.setLabel("ModEna");
-    modEnaDataPoint.setDescription("Is price-based charge/discharge mode active?");
-    modEnaDataPoint.setMandatory(true);
-    modEnaDataPoint.setSize(1);
-    modEnaDataPoint.setAddressOffset(2);
-    modEnaDataPoint.setBlockOffset(0);
-    modEnaDataPoint.setSunSpecDataType("bitfield16");
-    modEnaDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    modEnaDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modEnaDataPoint.name(), modEnaDataPoint);
-
-    SunSpecDataPoint sigTypeDataPoint;
-    sigTypeDataPoint.setName("SigType");
-    sigTypeDataPoint.setLabel("SigType");
-    sigTypeDataPoint.setDescription("Meaning of the pricing signal. When a Price schedule is used, type must match the schedule range variable description.");
-    sigTypeDataPoint.setSize(1);
-    sigTypeDataPoint.setAddressOffset(3);
-    sigTypeDataPoint.setBlockOffset(1);
-    sigTypeDataPoint.setSunSpecDataType("enum16");
-    sigTypeDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    sigTypeDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(sigTypeDataPoint.name(), sigTypeDataPoint);
-
-    SunSpecDataPoint sigDataPoint;
-    sigDataPoint.setName("Sig");
-    sigDataPoint.setLabel("Sig");
-    sigDataPoint.setDescription("Utility/ESP specific pricing signal. Content depends on pricing signal type. When H/M/L type is specified. Low=0; Med=1; High=2.");
-    sigDataPoint.setMandatory(true);
-    sigDataPoint.setSize(1);
-    sigDataPoint.setAddressOffset(4);
-    sigDataPoint.setBlockOffset(2);
-    sigDataPoint.setScaleFactorName("Sig_SF");
-    sigDataPoint.setSunSpecDataType("int16");
-    sigDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    sigDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(sigDataPoint.name(), sigDataPoint);
-
-    SunSpecDataPoint winTmsDataPoint;
-    winTmsDataPoint.setName("WinTms");
-    winTmsDataPoint.setLabel("WinTms");
-    winTmsDataPoint.setDescription("Time window for charge/discharge pricing change.");
-    winTmsDataPoint.setUnits("Secs");
-    winTmsDataPoint.setSize(1);
-    winTmsDataPoint.setAddressOffset(5);
-    winTmsDataPoint.setBlockOffset(3);
-    winTmsDataPoint.setSunSpecDataType("uint16");
-    winTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    winTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(winTmsDataPoint.name(), winTmsDataPoint);
-
-    SunSpecDataPoint rvtTmsDataPoint;
-    rvtTmsDataPoint.setName("RvtTms");
-    rvtTmsDataPoint.setLabel("RvtTms");
-    rvtTmsDataPoint.setDescription("Timeout period for charge/discharge pricing change.");
-    rvtTmsDataPoint.setUnits("Secs");
-    rvtTmsDataPoint.setSize(1);
-    rvtTmsDataPoint.setAddressOffset(6);
-    rvtTmsDataPoint.setBlockOffset(4);
-    rvtTmsDataPoint.setSunSpecDataType("uint16");
-    rvtTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    rvtTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rvtTmsDataPoint.name(), rvtTmsDataPoint);
-
-    SunSpecDataPoint rmpTmsDataPoint;
-    rmpTmsDataPoint.setName("RmpTms");
-    rmpTmsDataPoint.setLabel("RmpTms");
-    rmpTmsDataPoint.setDescription("Ramp time for moving from current charge or discharge level to new level.");
-    rmpTmsDataPoint.setUnits("Secs");
-    rmpTmsDataPoint.setSize(1);
-    rmpTmsDataPoint.setAddressOffset(7);
-    rmpTmsDataPoint.setBlockOffset(5);
-    rmpTmsDataPoint.setSunSpecDataType("uint16");
-    rmpTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    rmpTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rmpTmsDataPoint.name(), rmpTmsDataPoint);
-
-    SunSpecDataPoint sigSfDataPoint;
-    sigSfDataPoint.setName("Sig_SF");
-    sigSfDataPoint.setLabel("Sig_SF");
-    sigSfDataPoint.setDescription("Pricing signal scale factor.");
-    sigSfDataPoint.setMandatory(true);
-    sigSfDataPoint.setSize(1);
-    sigSfDataPoint.setAddressOffset(8);
-    sigSfDataPoint.setBlockOffset(6);
-    sigSfDataPoint.setSunSpecDataType("sunssf");
-    sigSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(sigSfDataPoint.name(), sigSfDataPoint);
-
-    SunSpecDataPoint padDataPoint;
-    padDataPoint.setName("Pad");
-    padDataPoint.setSize(1);
-    padDataPoint.setAddressOffset(9);
-    padDataPoint.setBlockOffset(7);
-    padDataPoint.setSunSpecDataType("pad");
-    padDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(padDataPoint.name(), padDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 10;
 }
 
 void SunSpecPricingModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("Sig_SF").isValid())
-        m_sigSf = m_dataPoints.value("Sig_SF").toInt16();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 8, 1);
+        if (scaleFactor != m_sigSf) {
+            m_sigSf = scaleFactor;
+            m_sigSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("ModEna").isValid())
-        m_modEna = static_cast<ModenaFlags>(m_dataPoints.value("ModEna").toUInt16());
-
-    if (m_dataPoints.value("SigType").isValid())
-        m_sigType = static_cast<Sigtype>(m_dataPoints.value("SigType").toUInt16());
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::BitField16, m_byteOrder))
+        m_modEna = static_cast<ModenaFlags>(SunSpecDataPoint::convertToUInt16(registers + 2, 1));
 
-    if (m_dataPoints.value("Sig").isValid())
-        m_sig = m_dataPoints.value("Sig").toFloatWithSSF(m_sigSf);
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_sigType = static_cast<Sigtype>(SunSpecDataPoint::convertToUInt16(registers + 3, 1));
 
-    if (m_dataPoints.value("WinTms").isValid())
-        m_winTms = m_dataPoints.value("WinTms").toUInt16();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_sig = SunSpecDataPoint::convertToInt16(registers + 4, 1) * m_sigSfMultiplier;
 
-    if (m_dataPoints.value("RvtTms").isValid())
-        m_rvtTms = m_dataPoints.value("RvtTms").toUInt16();
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_winTms = SunSpecDataPoint::convertToUInt16(registers + 5, 1);
 
-    if (m_dataPoints.value("RmpTms").isValid())
-        m_rmpTms = m_dataPoints.value("RmpTms").toUInt16();
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_rvtTms = SunSpecDataPoint::convertToUInt16(registers + 6, 1);
 
-    if (m_dataPoints.value("Sig_SF").isValid())
-        m_sigSf = m_dataPoints.value("Sig_SF").toInt16();
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_rmpTms = SunSpecDataPoint::convertToUInt16(registers + 7, 1);
 
-    if (m_dataPoints.value("Pad").isValid())
-        m_pad = m_dataPoints.value("Pad").toUInt16();
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad = SunSpecDataPoint::convertToUInt16(registers + 9, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -339,50 +248,50 @@ void SunSpecPricingModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecPricingModel *model)
 {
     debug.nospace().noquote() << "SunSpecPricingModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModEna") << "-->";
-    if (model->dataPoints().value("ModEna").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecPricingModel::DataPointIndexModEna) << "-->";
+    if (model->dataPoint(SunSpecPricingModel::DataPointIndexModEna).isValid()) {
         debug.nospace().noquote() << model->modEna() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("SigType") << "-->";
-    if (model->dataPoints().value("SigType").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecPricingModel::DataPointIndexSigType) << "-->";
+    if (model->dataPoint(SunSpecPricingModel::DataPointIndexSigType).isValid()) {
         debug.nospace().noquote() << model->sigType() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Sig") << "-->";
-    if (model->dataPoints().value("Sig").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecPricingModel::DataPointIndexSig) << "-->";
+    if (model->dataPoint(SunSpecPricingModel::DataPointIndexSig).isValid()) {
         debug.nospace().noquote() << model->sig() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WinTms") << "-->";
-    if (model->dataPoints().value("WinTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecPricingModel::DataPointIndexWinTms) << "-->";
+    if (model->dataPoint(SunSpecPricingModel::DataPointIndexWinTms).isValid()) {
         debug.nospace().noquote() << model->winTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("RvtTms") << "-->";
-    if (model->dataPoints().value("RvtTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecPricingModel::DataPointIndexRvtTms) << "-->";
+    if (model->dataPoint(SunSpecPricingModel::DataPointIndexRvtTms).isValid()) {
         debug.nospace().noquote() << model->rvtTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("RmpTms") << "-->";
-    if (model->dataPoints().value("RmpTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecPricingModel::DataPointIndexRmpTms) << "-->";
+    if (model->dataPoint(SunSpecPricingModel::DataPointIndexRmpTms).isValid()) {
         debug.nospace().noquote() << model->rmpTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Pad") << "-->";
-    if (model->dataPoints().value("Pad").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecPricingModel::DataPointIndexPad) << "-->";
+    if (model->dataPoint(SunSpecPricingModel::DataPointIndexPad).isValid()) {
         debug.nospace().noquote() << model->pad() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
@@ -57,6 +57,19 @@ public:
     Q_DECLARE_FLAGS(ModenaFlags, Modena)
     Q_FLAG(Modena)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexModEna,
+        DataPointIndexSigType,
+        DataPointIndexSig,
+        DataPointIndexWinTms,
+        DataPointIndexRvtTms,
+        DataPointIndexRmpTms,
+        DataPointIndexSigSf,
+        DataPointIndexPad
+    };
+
     explicit SunSpecPricingModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecPricingModel() override; 
 
@@ -107,6 +120,7 @@ private:
     quint16 m_rvtTms = 0;
     quint16 m_rmpTms = 0;
     qint16 m_sigSf = 0;
+    double m_sigSfMultiplier = 1;
     quint16 m_pad = 0;
 
 
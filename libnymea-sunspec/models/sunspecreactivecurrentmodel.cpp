@@ -31,6 +31,41 @@
 #include "sunspecreactivecurrentmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexArGraMod
+    { "ArGraMod", "ArGraMod", "Indicates if gradients trend toward zero at the edges of the deadband or trend toward zero at the center of the deadband.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, true, 2, 0, 1 },
+    // DataPointIndexArGraSag
+    { "ArGraSag", "ArGraSag", "The gradient used to increase capacitive dynamic current. A value of 0 indicates no additional reactive current support.", nullptr, "%ARtg/%dV", "uint16", "ArGra_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 3, 1, 1 },
+    // DataPointIndexArGraSwell
+    { "ArGraSwell", "ArGraSwell", "The gradient used to increase inductive dynamic current.  A value of 0 indicates no additional reactive current support.", nullptr, "%ARtg/%dV", "uint16", "ArGra_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 4, 2, 1 },
+    // DataPointIndexModEna
+    { "ModEna", "ModEna", "Activate dynamic reactive current model", nullptr, nullptr, "bitfield16", nullptr, SunSpecDataPoint::BitField16, SunSpecDataPoint::AccessReadWrite, true, 5, 3, 1 },
+    // DataPointIndexFilTms
+    { "FilTms", "FilTms", "The time window used to calculate the moving average voltage.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 6, 4, 1 },
+    // DataPointIndexDbVMin
+    { "DbVMin", "DbVMin", "The lower delta voltage limit for which negative voltage deviations less than this value no dynamic vars are produced.", nullptr, "% VRef", "uint16", "VRefPct_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 7, 5, 1 },
+    // DataPointIndexDbVMax
+    { "DbVMax", "DbVMax", "The upper delta voltage limit for which positive voltage deviations less than this value no dynamic current produced.", nullptr, "% VRef", "uint16", "VRefPct_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 8, 6, 1 },
+    // DataPointIndexBlkZnV
+    { "BlkZnV", "BlkZnV", "Block zone voltage which defines a lower voltage boundary below which no dynamic current is produced.", nullptr, "% VRef", "uint16", "VRefPct_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 9, 7, 1 },
+    // DataPointIndexHysBlkZnV
+    { "HysBlkZnV", "HysBlkZnV", "Hysteresis voltage used with BlkZnV.", nullptr, "% VRef", "uint16", "VRefPct_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 10, 8, 1 },
+    // DataPointIndexBlkZnTmms
+    { "BlkZnTmms", "BlkZnTmms", "Block zone time the time before which reactive current support remains active regardless of how low the voltage drops.", nullptr, "mSecs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 11, 9, 1 },
+    // DataPointIndexHoldTmms
+    { "HoldTmms", "HoldTmms", "Hold time during which reactive current support continues after the average voltage has entered the dead zone.", nullptr, "mSecs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 12, 10, 1 },
+    // DataPointIndexArGraSf
+    { "ArGra_SF", "ArGra_SF", "Scale factor for the gradients.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 13, 11, 1 },
+    // DataPointIndexVRefPctSf
+    { "VRefPct_SF", "VRefPct_SF", "Scale factor for the voltage zone and limit settings.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 14, 12, 1 },
+    // DataPointIndexPad
+    { "Pad", nullptr, nullptr, nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, false, 15, 13, 1 }
+};
+
 SunSpecReactiveCurrentModel::SunSpecReactiveCurrentModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 128, modelLength, byteOrder, parent)
 {
@@ -69,7 +104,7 @@ QModbusReply *SunSpecReactiveCurrentModel::setArGraMod(Argramod arGraMod)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ArGraMod");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexArGraMod]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(arGraMod));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -87,7 +122,7 @@ QModbusReply *SunSpecReactiveCurrentModel::setArGraSag(float arGraSag)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ArGraSag");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexArGraSag]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(arGraSag, m_arGraSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -105,7 +140,7 @@ QModbusReply *SunSpecReactiveCurrentModel::setArGraSwell(float arGraSwell)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ArGraSwell");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexArGraSwell]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(arGraSwell, m_arGraSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -123,7 +158,7 @@ QModbusReply *SunSpecReactiveCurrentModel::setModEna(ModenaFlags modEna)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ModEna");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexModEna]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(modEna));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -141,7 +176,7 @@ QModbusReply *SunSpecReactiveCurrentModel::setFilTms(quint16 filTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("FilTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexFilTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(filTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -159,7 +194,7 @@ QModbusReply *SunSpecReactiveCurrentModel::setDbVMin(float dbVMin)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("DbVMin");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexDbVMin]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(dbVMin, m_vRefPctSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -177,7 +212,7 @@ QModbusReply *SunSpecReactiveCurrentModel::setDbVMax(float dbVMax)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("DbVMax");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexDbVMax]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(dbVMax, m_vRefPctSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -195,7 +230,7 @@ QModbusReply *SunSpecReactiveCurrentModel::setBlkZnV(float blkZnV)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("BlkZnV");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexBlkZnV]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(blkZnV, m_vRefPctSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -213,7 +248,7 @@ QModbusReply *SunSpecReactiveCurrentModel::setHysBlkZnV(float hysBlkZnV)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("HysBlkZnV");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHysBlkZnV]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(hysBlkZnV, m_vRefPctSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -231,7 +266,7 @@ QModbusReply *SunSpecReactiveCurrentModel::setBlkZnTmms(quint16 blkZnTmms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("BlkZnTmms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexBlkZnTmms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(blkZnTmms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -249,7 +284,7 @@ QModbusReply *SunSpecReactiveCurrentModel::setHoldTmms(quint16 holdTmms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("HoldTmms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexHoldTmms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(holdTmms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -271,265 +306,69 @@ quint16 SunSpecReactiveCurrentModel::pad() const
 }
 void SunSpecReactiveCurrentModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint arGraModDataPoint;
-    arGraModDataPoint.setName("ArGraMod");
-    arGraModDataPoint.setLabel("ArGraMod");
-    arGraModDataPoint.setDescription("Indicates if gradients trend toward zero at the edges of the deadband or trend toward zero at the center of the deadband.");
-    arGraModDataPoint.setMandatory(true);
-    arGraModDataPoint.setSize(1);
-    arGraModDataPoint.setAddressOffset(2);
-    arGraModDataPoint.setBlockOffset(0);
-    arGraModDataPoint.setSunSpecDataType("enum16");
-    arGraModDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    arGraModDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(arGraModDataPoint.name(), arGraModDataPoint);
-
-    SunSpecDataPoint arGraSagDataPoint;
-    arGraSagDataPoint.setName("ArGraSag");
-    arGraSagDataPoint.setLabel("ArGraSag");
-    arGraSagDataPoint.setDescription("The gradient used to increase capacitive dynamic current. A value of 0 indicates no additional reactive current support.");
-    arGraSagDataPoint.setUnits("%ARtg/%dV");
-    arGraSagDataPoint.setMandatory(true);
-    arGraSagDataPoint.setSize(1);
-    arGraSagDataPoint.setAddressOffset(3);
-    arGraSagDataPoint.setBlockOffset(1);
-    arGraSagDataPoint.setScaleFactorName("ArGra_SF");
-    arGraSagDataPoint.setSunSpecDataType("uint16");
-    arGraSagDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    arGraSagDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(arGraSagDataPoint.name(), arGraSagDataPoint);
-
-    SunSpecDataPoint arGraSwellDataPoint;
-    arGraSwellDataPoint.setName("ArGraSwell");
-    arGraSwellDataPoint.setLabel("ArGraSwell");
-    arGraSwellDataPoint.setDescription("The gradient used to increase inductive dynamic current.  A value of 0 indicates no additional reactive current support.");
-    arGraSwellDataPoint.setUnits("%ARtg/%dV");
-    arGraSwellDataPoint.setMandatory(true);
-    arGraSwellDataPoint.setSize(1);
-    arGraSwellDataPoint.setAddressOffset(4);
-    arGraSwellDataPoint.setBlockOffset(2);
-    arGraSwellDataPoint.setScaleFactorName("ArGra_SF");
-    arGraSwellDataPoint.setSunSpecDataType("uint16");
-    arGraSwellDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    arGraSwellDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(arGraSwellDataPoint.name(), arGraSwellDataPoint);
-
-    SunSpecDataPoint modEnaDataPoint;
-    modEnaDataPoint.setName("ModEna");
-    modEnaDataPoint.setLabel("ModEna");
-    modEnaDataPoint.setDescription("Activate dynamic reactive current model");
-    modEnaDataPoint.setMandatory(true);
-    modEnaDataPoint.setSize(1);
-    modEnaDataPoint.setAddressOffset(5);
-    modEnaDataPoint.setBlockOffset(3);
-    modEnaDataPoint.setSunSpecDataType("bitfield16");
-    modEnaDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    modEnaDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modEnaDataPoint.name(), modEnaDataPoint);
-
-    SunSpecDataPoint filTmsDataPoint;
-    filTmsDataPoint.setName("FilTms");
-    filTmsDataPoint.setLabel("FilTms");
-    filTmsDataPoint.setDescription("The time window used to calculate the moving average voltage.");
-    filTmsDataPoint.setUnits("Secs");
-    filTmsDataPoint.setSize(1);
-    filTmsDataPoint.setAddressOffset(6);
-    filTmsDataPoint.setBlockOffset(4);
-    filTmsDataPoint.setSunSpecDataType("uint16");
-    filTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    filTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(filTmsDataPoint.name(), filTmsDataPoint);
-
-    SunSpecDataPoint dbVMinDataPoint;
-    dbVMinDataPoint.setName("DbVMin");
-    dbVMinDataPoint.setLabel("DbVMin");
-    dbVMinDataPoint.setDescription("The lower delta voltage limit for which negative voltage deviations less than this value no dynamic vars are produced.");
-    dbVMinDataPoint.setUnits("% VRef");
-    dbVMinDataPoint.setSize(1);
-    dbVMinDataPoint.setAddressOffset(7);
-    dbVMinDataPoint.setBlockOffset(5);
-    dbVMinDataPoint.setScaleFactorName("VRefPct_SF");
-    dbVMinDataPoint.setSunSpecDataType("uint16");
-    dbVMinDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    dbVMinDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(dbVMinDataPoint.name(), dbVMinDataPoint);
-
-    SunSpecDataPoint dbVMaxDataPoint;
-    dbVMaxDataPoint.setName("DbVMax");
-    dbVMaxDataPoint.setLabel("DbVMax");
-    dbVMaxDataPoint.setDescription("The upper delta voltage limit for which positive voltage deviations less than this value no dynamic current produced.");
-    dbVMaxDataPoint.setUnits("% VRef");
-    dbVMaxDataPoint.setSize(1);
-    dbVMaxDataPoint.setAddressOffset(8);
-    dbVMaxDataPoint.setBlockOffset(6);
-    dbVMaxDataPoint.setScaleFactorName("VRefPct_SF");
-    dbVMaxDataPoint.setSunSpecDataType("uint16");
-    dbVMaxDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    dbVMaxDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(dbVMaxDataPoint.name(), dbVMaxDataPoint);
-
-    SunSpecDataPoint blkZnVDataPoint;
-    blkZnVDataPoint.setName("BlkZnV");
-    blkZnVDataPoint.setLabel("BlkZnV");
-    blkZnVDataPoint.setDescription("Block zone voltage which defines a lower voltage boundary below which no dynamic current is produced.");
-    blkZnVDataPoint.setUnits("% VRef");
-    blkZnVDataPoint.setSize(1);
-    blkZnVDataPoint.setAddressOffset(9);
-    blkZnVDataPoint.setBlockOffset(7);
-    blkZnVDataPoint.setScaleFactorName("VRefPct_SF");
-    blkZnVDataPoint.setSunSpecDataType("uint16");
-    blkZnVDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    blkZnVDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(blkZnVDataPoint.name(), blkZnVDataPoint);
-
-    SunSpecDataPoint hysBlkZnVDataPoint;
-    hysBlkZnVDataPoint.setName("HysBlkZnV");
-    hysBlkZnVDataPoint.setLabel("HysBlkZnV");
-    hysBlkZnVDataPoint.setDescription("Hysteresis voltage used with BlkZnV.");
-    hysBlkZnVDataPoint.setUnits("% VRef");
-    hysBlkZnVDataPoint.setSize(1);
-    hysBlkZnVDataPoint.setAddressOffset(10);
-    hysBlkZnVDataPoint.setBlockOffset(8);
-    hysBlkZnVDataPoint.setScaleFactorName("VRefPct_SF");
-    hysBlkZnVDataPoint.setSunSpecDataType("uint16");
-    hysBlkZnVDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    hysBlkZnVDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(hysBlkZnVDataPoint.name(), hysBlkZnVDataPoint);
-
-    SunSpecDataPoint blkZnTmmsDataPoint;
-    blkZnTmmsDataPoint.setName("BlkZnTmms");
-    blkZnTmmsDataPoint.setLabel("BlkZnTmms");
-    blkZnTmmsDataPoint.setDescription("Block zone time the time before which reactive current support remains active regardless of how low the voltage drops.");
-    blkZnTmmsDataPoint.setUnits("mSecs");
-    blkZnTmmsDataPoint.setSize(1);
-    blkZnTmmsDataPoint.setAddressOffset(11);
-    blkZnTmmsDataPoint.setBlockOffset(9);
-    blkZnTmmsDataPoint.setSunSpecDataType("uint16");
-    blkZnTmmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    blkZnTmmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(blkZnTmmsDataPoint.name(), blkZnTmmsDataPoint);
-
-    SunSpecDataPoint holdTmmsDataPoint;
-    holdTmmsDataPoint.setName("HoldTmms");
-    holdTmmsDataPoint.setLabel("HoldTmms");
-    holdTmmsDataPoint.setDescription("Hold time during which reactive current support continues after the average voltage has entered the dead zone.");
-    holdTmmsDataPoint.setUnits("mSecs");
-    holdTmmsDataPoint.setSize(1);
-    holdTmmsDataPoint.setAddressOffset(12);
-    holdTmmsDataPoint.setBlockOffset(10);
-    holdTmmsDataPoint.setSunSpecDataType("uint16");
-    holdTmmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    holdTmmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(holdTmmsDataPoint.name(), holdTmmsDataPoint);
-
-    SunSpecDataPoint arGraSfDataPoint;
-    arGraSfDataPoint.setName("ArGra_SF");
-    arGraSfDataPoint.setLabel("ArGra_SF");
-    arGraSfDataPoint.setDescription("Scale factor for the gradients.");
-    arGraSfDataPoint.setMandatory(true);
-    arGraSfDataPoint.setSize(1);
-    arGraSfDataPoint.setAddressOffset(13);
-    arGraSfDataPoint.setBlockOffset(11);
-    arGraSfDataPoint.setSunSpecDataType("sunssf");
-    arGraSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(arGraSfDataPoint.name(), arGraSfDataPoint);
-
-    SunSpecDataPoint vRefPctSfDataPoint;
-    vRefPctSfDataPoint.setName("VRefPct_SF");
-    vRefPctSfDataPoint.setLabel("VRefPct_SF");
-    vRefPctSfDataPoint.setDescription("Scale factor for the voltage zone and limit settings.");
-    vRefPctSfDataPoint.setSize(1);
-    vRefPctSfDataPoint.setAddressOffset(14);
-    vRefPctSfDataPoint.setBlockOffset(12);
-    vRefPctSfDataPoint.setSunSpecDataType("sunssf");
-    vRefPctSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vRefPctSfDataPoint.name(), vRefPctSfDataPoint);
-
-    SunSpecDataPoint padDataPoint;
-    padDataPoint.setName("Pad");
-    padDataPoint.setSize(1);
-    padDataPoint.setAddressOffset(15);
-    padDataPoint.setBlockOffset(13);
-    padDataPoint.setSunSpecDataType("pad");
-    padDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(padDataPoint.name(), padDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 16;
 }
 
 void SunSpecReactiveCurrentModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("ArGra_SF").isValid())
-        m_arGraSf = m_dataPoints.value("ArGra_SF").toInt16();
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 13, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 13, 1);
+        if (scaleFactor != m_arGraSf) {
+            m_arGraSf = scaleFactor;
+            m_arGraSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("VRefPct_SF").isValid())
-        m_vRefPctSf = m_dataPoints.value("VRefPct_SF").toInt16();
+    if (registerCount >= 15 && SunSpecDataPoint::isValid(registers + 14, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 14, 1);
+        if (scaleFactor != m_vRefPctSf) {
+            m_vRefPctSf = scaleFactor;
+            m_vRefPctSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("ArGraMod").isValid())
-        m_arGraMod = static_cast<Argramod>(m_dataPoints.value("ArGraMod").toUInt16());
-
-    if (m_dataPoints.value("ArGraSag").isValid())
-        m_arGraSag = m_dataPoints.value("ArGraSag").toFloatWithSSF(m_arGraSf);
-
-    if (m_dataPoints.value("ArGraSwell").isValid())
-        m_arGraSwell = m_dataPoints.value("ArGraSwell").toFloatWithSSF(m_arGraSf);
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_arGraMod = static_cast<Argramod>(SunSpecDataPoint::convertToUInt16(registers + 2, 1));
 
-    if (m_dataPoints.value("ModEna").isValid())
-        m_modEna = static_cast<ModenaFlags>(m_dataPoints.value("ModEna").toUInt16());
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_arGraSag = SunSpecDataPoint::convertToUInt16(registers + 3, 1) * m_arGraSfMultiplier;
 
-    if (m_dataPoints.value("FilTms").isValid())
-        m_filTms = m_dataPoints.value("FilTms").toUInt16();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_arGraSwell = SunSpecDataPoint::convertToUInt16(registers + 4, 1) * m_arGraSfMultiplier;
 
-    if (m_dataPoints.value("DbVMin").isValid())
-        m_dbVMin = m_dataPoints.value("DbVMin").toFloatWithSSF(m_vRefPctSf);
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::BitField16, m_byteOrder))
+        m_modEna = static_cast<ModenaFlags>(SunSpecDataPoint::convertToUInt16(registers + 5, 1));
 
-    if (m_dataPoints.value("DbVMax").isValid())
-        m_dbVMax = m_dataPoints.value("DbVMax").toFloatWithSSF(m_vRefPctSf);
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_filTms = SunSpecDataPoint::convertToUInt16(registers + 6, 1);
 
-    if (m_dataPoints.value("BlkZnV").isValid())
-        m_blkZnV = m_dataPoints.value("BlkZnV").toFloatWithSSF(m_vRefPctSf);
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_dbVMin = SunSpecDataPoint::convertToUInt16(registers + 7, 1) * m_vRefPctSfMultiplier;
 
-    if (m_dataPoints.value("HysBlkZnV").isValid())
-        m_hysBlkZnV = m_dataPoints.value("HysBlkZnV").toFloatWithSSF(m_vRefPctSf);
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_dbVMax = SunSpecDataPoint::convertToUInt16(registers + 8, 1) * m_vRefPctSfMultiplier;
 
-    if (m_dataPoints.value("BlkZnTmms").isValid())
-        m_blkZnTmms = m_dataPoints.value("BlkZnTmms").toUInt16();
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_blkZnV = SunSpecDataPoint::convertToUInt16(registers + 9, 1) * m_vRefPctSfMultiplier;
 
-    if (m_dataPoints.value("HoldTmms").isValid())
-        m_holdTmms = m_dataPoints.value("HoldTmms").toUInt16();
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_hysBlkZnV = SunSpecDataPoint::convertToUInt16(registers + 10, 1) * m_vRefPctSfMultiplier;
 
-    if (m_dataPoints.value("ArGra_SF").isValid())
-        m_arGraSf = m_dataPoints.value("ArGra_SF").toInt16();
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_blkZnTmms = SunSpecDataPoint::convertToUInt16(registers + 11, 1);
 
-    if (m_dataPoints.value("VRefPct_SF").isValid())
-        m_vRefPctSf = m_dataPoints.value("VRefPct_SF").toInt16();
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 12, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_holdTmms = SunSpecDataPoint::convertToUInt16(registers + 12, 1);
 
-    if (m_dataPoints.value("Pad").isValid())
-        m_pad = m_dataPoints.value("Pad").toUInt16();
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 15, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad = SunSpecDataPoint::convertToUInt16(registers + 15, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -538,85 +377,85 @@ void SunSpecReactiveCurrentModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecReactiveCurrentModel *model)
 {
     debug.nospace().noquote() << "SunSpecReactiveCurrentModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ArGraMod") << "-->";
-    if (model->dataPoints().value("ArGraMod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexArGraMod) << "-->";
+    if (model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexArGraMod).isValid()) {
         debug.nospace().noquote() << model->arGraMod() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ArGraSag") << "-->";
-    if (model->dataPoints().value("ArGraSag").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexArGraSag) << "-->";
+    if (model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexArGraSag).isValid()) {
         debug.nospace().noquote() << model->arGraSag() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ArGraSwell") << "-->";
-    if (model->dataPoints().value("ArGraSwell").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexArGraSwell) << "-->";
+    if (model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexArGraSwell).isValid()) {
         debug.nospace().noquote() << model->arGraSwell() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModEna") << "-->";
-    if (model->dataPoints().value("ModEna").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexModEna) << "-->";
+    if (model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexModEna).isValid()) {
         debug.nospace().noquote() << model->modEna() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("FilTms") << "-->";
-    if (model->dataPoints().value("FilTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexFilTms) << "-->";
+    if (model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexFilTms).isValid()) {
         debug.nospace().noquote() << model->filTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("DbVMin") << "-->";
-    if (model->dataPoints().value("DbVMin").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexDbVMin) << "-->";
+    if (model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexDbVMin).isValid()) {
         debug.nospace().noquote() << model->dbVMin() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("DbVMax") << "-->";
-    if (model->dataPoints().value("DbVMax").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexDbVMax) << "-->";
+    if (model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexDbVMax).isValid()) {
         debug.nospace().noquote() << model->dbVMax() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("BlkZnV") << "-->";
-    if (model->dataPoints().value("BlkZnV").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexBlkZnV) << "-->";
+    if (model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexBlkZnV).isValid()) {
         debug.nospace().noquote() << model->blkZnV() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("HysBlkZnV") << "-->";
-    if (model->dataPoints().value("HysBlkZnV").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexHysBlkZnV) << "-->";
+    if (model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexHysBlkZnV).isValid()) {
         debug.nospace().noquote() << model->hysBlkZnV() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("BlkZnTmms") << "-->";
-    if (model->dataPoints().value("BlkZnTmms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexBlkZnTmms) << "-->";
+    if (model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexBlkZnTmms).isValid()) {
         debug.nospace().noquote() << model->blkZnTmms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("HoldTmms") << "-->";
-    if (model->dataPoints().value("HoldTmms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexHoldTmms) << "-->";
+    if (model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexHoldTmms).isValid()) {
         debug.nospace().noquote() << model->holdTmms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Pad") << "-->";
-    if (model->dataPoints().value("Pad").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexPad) << "-->";
+    if (model->dataPoint(SunSpecReactiveCurrentModel::DataPointIndexPad).isValid()) {
         debug.nospace().noquote() << model->pad() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
@@ -54,6 +54,25 @@ public:
     Q_DECLARE_FLAGS(ModenaFlags, Modena)
     Q_FLAG(Modena)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexArGraMod,
+        DataPointIndexArGraSag,
+        DataPointIndexArGraSwell,
+        DataPointIndexModEna,
+        DataPointIndexFilTms,
+        DataPointIndexDbVMin,
+        DataPointIndexDbVMax,
+        DataPointIndexBlkZnV,
+        DataPointIndexHysBlkZnV,
+        DataPointIndexBlkZnTmms,
+        DataPointIndexHoldTmms,
+        DataPointIndexArGraSf,
+        DataPointIndexVRefPctSf,
+        DataPointIndexPad
+    };
+
     explicit SunSpecReactiveCurrentModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecReactiveCurrentModel() override; 
 
@@ -131,7 +150,9 @@ private:
     quint16 m_blkZnTmms = 0;
     quint16 m_holdTmms = 0;
     qint16 m_arGraSf = 0;
+    double m_arGraSfMultiplier = 1;
     qint16 m_vRefPctSf = 0;
+    double m_vRefPctSfMultiplier = 1;
     quint16 m_pad = 0;
 
 
@@ -31,6 +31,21 @@
 #include "sunspecrefpointmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexGhi
+    { "GHI", "GHI", "Global Horizontal Irradiance", nullptr, "W/m2", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 2, 0, 1 },
+    // DataPointIndexAmps
+    { "A", "Amps", "Current measurement at reference point", nullptr, "W/m2", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 3, 1, 1 },
+    // DataPointIndexVoltage
+    { "V", "Voltage", "Voltage  measurement at reference point", nullptr, "W/m2", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 4, 2, 1 },
+    // DataPointIndexTemperature
+    { "Tmp", "Temperature", "Temperature measurement at reference point", nullptr, "W/m2", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 5, 3, 1 }
+};
+
 SunSpecRefPointModel::SunSpecRefPointModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 306, modelLength, byteOrder, parent)
 {
@@ -77,92 +92,27 @@ quint16 SunSpecRefPointModel::temperature() const
 }
 void SunSpecRefPointModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint ghiDataPoint;
-    ghiDataPoint.setName("GHI");
-    ghiDataPoint.setLabel("GHI");
-    ghiDataPoint.setDescription("Global Horizontal Irradiance");
-    ghiDataPoint.setUnits("W/m2");
-    ghiDataPoint.setSize(1);
-    ghiDataPoint.setAddressOffset(2);
-    ghiDataPoint.setBlockOffset(0);
-    ghiDataPoint.setSunSpecDataType("uint16");
-    ghiDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ghiDataPoint.name(), ghiDataPoint);
-
-    SunSpecDataPoint ampsDataPoint;
-    ampsDataPoint.setName("A");
-    ampsDataPoint.setLabel("Amps");
-    ampsDataPoint.setDescription("Current measurement at reference point");
-    ampsDataPoint.setUnits("W/m2");
-    ampsDataPoint.setSize(1);
-    ampsDataPoint.setAddressOffset(3);
-    ampsDataPoint.setBlockOffset(1);
-    ampsDataPoint.setSunSpecDataType("uint16");
-    ampsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ampsDataPoint.name(), ampsDataPoint);
-
-    SunSpecDataPoint voltageDataPoint;
-    voltageDataPoint.setName("V");
-    voltageDataPoint.setLabel("Voltage");
-    voltageDataPoint.setDescription("Voltage  measurement at reference point");
-    voltageDataPoint.setUnits("W/m2");
-    voltageDataPoint.setSize(1);
-    voltageDataPoint.setAddressOffset(4);
-    voltageDataPoint.setBlockOffset(2);
-    voltageDataPoint.setSunSpecDataType("uint16");
-    voltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(voltageDataPoint.name(), voltageDataPoint);
-
-    SunSpecDataPoint temperatureDataPoint;
-    temperatureDataPoint.setName("Tmp");
-    temperatureDataPoint.setLabel("Temperature");
-    temperatureDataPoint.setDescription("Temperature measurement at reference point");
-    temperatureDataPoint.setUnits("W/m2");
-    temperatureDataPoint.setSize(1);
-    temperatureDataPoint.setAddressOffset(5);
-    temperatureDataPoint.setBlockOffset(3);
-    temperatureDataPoint.setSunSpecDataType("uint16");
-    temperatureDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(temperatureDataPoint.name(), temperatureDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 6;
 }
 
 void SunSpecRefPointModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("GHI").isValid())
-        m_ghi = m_dataPoints.value("GHI").toUInt16();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_ghi = SunSpecDataPoint::convertToUInt16(registers + 2, 1);
 
-    if (m_dataPoints.value("A").isValid())
-        m_amps = m_dataPoints.value("A").toUInt16();
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_amps = SunSpecDataPoint::convertToUInt16(registers + 3, 1);
 
-    if (m_dataPoints.value("V").isValid())
-        m_voltage = m_dataPoints.value("V").toUInt16();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_voltage = SunSpecDataPoint::convertToUInt16(registers + 4, 1);
 
-    if (m_dataPoints.value("Tmp").isValid())
-        m_temperature = m_dataPoints.value("Tmp").toUInt16();
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_temperature = SunSpecDataPoint::convertToUInt16(registers + 5, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -171,29 +121,29 @@ void SunSpecRefPointModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecRefPointModel *model)
 {
     debug.nospace().noquote() << "SunSpecRefPointModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("GHI") << "-->";
-    if (model->dataPoints().value("GHI").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecRefPointModel::DataPointIndexGhi) << "-->";
+    if (model->dataPoint(SunSpecRefPointModel::DataPointIndexGhi).isValid()) {
         debug.nospace().noquote() << model->ghi() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("A") << "-->";
-    if (model->dataPoints().value("A").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecRefPointModel::DataPointIndexAmps) << "-->";
+    if (model->dataPoint(SunSpecRefPointModel::DataPointIndexAmps).isValid()) {
         debug.nospace().noquote() << model->amps() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("V") << "-->";
-    if (model->dataPoints().value("V").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecRefPointModel::DataPointIndexVoltage) << "-->";
+    if (model->dataPoint(SunSpecRefPointModel::DataPointIndexVoltage).isValid()) {
         debug.nospace().noquote() << model->voltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Tmp") << "-->";
-    if (model->dataPoints().value("Tmp").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecRefPointModel::DataPointIndexTemperature) << "-->";
+    if (model->dataPoint(SunSpecRefPointModel::DataPointIndexTemperature).isValid()) {
         debug.nospace().noquote() << model->temperature() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
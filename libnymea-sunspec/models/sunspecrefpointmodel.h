@@ -42,6 +42,15 @@ class SunSpecRefPointModel : public SunSpecModel
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexGhi,
+        DataPointIndexAmps,
+        DataPointIndexVoltage,
+        DataPointIndexTemperature
+    };
+
     explicit SunSpecRefPointModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecRefPointModel() override; 
 
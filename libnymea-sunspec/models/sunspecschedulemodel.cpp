@@ -31,6 +31,73 @@
 #include "sunspecschedulemodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata repeatingBlockDataPointMetadata[] = {
+    // DataPointIndexActPts
+    { "ActPts", "ActPts", "Number of active entries in schedule.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 0, 0, 1 },
+    // DataPointIndexStrTms
+    { "StrTms", "StrTms", "Schedule start in seconds since 2000 JAN 01 00:00:00 UTC.", nullptr, "Secs", "uint32", nullptr, SunSpecDataPoint::UInt32, SunSpecDataPoint::AccessReadWrite, true, 1, 0, 2 },
+    // DataPointIndexRepPer
+    { "RepPer", "RepPer", "The repetition count for time-based schedules (0=repeat forever)", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 3, 1, 1 },
+    // DataPointIndexSchdTyp
+    { "IntvTyp", "SchdTyp", "The repetition frequency for time-based schedules: no repeat=0", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, true, 4, 2, 1 },
+    // DataPointIndexXTyp
+    { "XTyp", "XTyp", "The meaning of the X-values in the array. ", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, true, 5, 3, 1 },
+    // DataPointIndexXSf
+    { "X_SF", "X_SF", "Scale factor for schedule range values.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadWrite, true, 6, 4, 1 },
+    // DataPointIndexYTyp
+    { "YTyp", "YTyp", "The meaning of the Y-values in the array.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, true, 7, 5, 1 },
+    // DataPointIndexYSf
+    { "Y_SF", "Y_SF", "Scale factor for schedule target values.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadWrite, true, 8, 6, 1 },
+    // DataPointIndexX1
+    { "X1", "X1", "Entry 1 range.", nullptr, nullptr, "int32", "X_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, true, 9, 7, 2 },
+    // DataPointIndexY1
+    { "Y1", "Y1", "Entry 1 target.", nullptr, nullptr, "int32", "Y_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, true, 11, 9, 2 },
+    // DataPointIndexX2
+    { "X2", "X2", "Entry 2 range.", nullptr, nullptr, "int32", "X_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 13, 11, 2 },
+    // DataPointIndexY2
+    { "Y2", "Y2", "Entry 2 target.", nullptr, nullptr, "int32", "Y_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 15, 13, 2 },
+    // DataPointIndexX3
+    { "X3", "X3", "Entry 3 range.", nullptr, nullptr, "int32", "X_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 17, 15, 2 },
+    // DataPointIndexY3
+    { "Y3", "Y3", "Entry 3 target.", nullptr, nullptr, "int32", "Y_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 19, 17, 2 },
+    // DataPointIndexX4
+    { "X4", "X4", "Entry 4 range.", nullptr, nullptr, "int32", "X_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 21, 19, 2 },
+    // DataPointIndexY4
+    { "Y4", "Y4", "Entry 4 target.", nullptr, nullptr, "int32", "Y_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 23, 21, 2 },
+    // DataPointIndexX5
+    { "X5", "X5", "Entry 15range.", nullptr, nullptr, "int32", "X_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 25, 23, 2 },
+    // DataPointIndexY5
+    { "Y5", "Y5", "Entry 5 target.", nullptr, nullptr, "int32", "Y_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 27, 25, 2 },
+    // DataPointIndexX6
+    { "X6", "X6", "Entry 6 range.", nullptr, nullptr, "int32", "X_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 29, 27, 2 },
+    // DataPointIndexY6
+    { "Y6", "Y6", "Entry 6 target.", nullptr, nullptr, "int32", "Y_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 31, 29, 2 },
+    // DataPointIndexX7
+    { "X7", "X7", "Entry 7 range.", nullptr, nullptr, "int32", "X_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 33, 31, 2 },
+    // DataPointIndexY7
+    { "Y7", "Y7", "Entry 7 target.", nullptr, nullptr, "int32", "Y_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 35, 33, 2 },
+    // DataPointIndexX8
+    { "X8", "X8", "Entry 8 range.", nullptr, nullptr, "int32", "X_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 37, 35, 2 },
+    // DataPointIndexY8
+    { "Y8", "Y8", "Entry 8 target.", nullptr, nullptr, "int32", "Y_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 39, 37, 2 },
+    // DataPointIndexX9
+    { "X9", "X9", "Entry 9 range.", nullptr, nullptr, "int32", "X_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 41, 39, 2 },
+    // DataPointIndexY9
+    { "Y9", "Y9", "Entry 9 target.", nullptr, nullptr, "int32", "Y_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 43, 41, 2 },
+    // DataPointIndexX10
+    { "X10", "X10", "Entry 10 range.", nullptr, nullptr, "int32", "X_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 45, 43, 2 },
+    // DataPointIndexY10
+    { "Y10", "Y10", "Entry 10 target.", nullptr, nullptr, "int32", "Y_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 47, 45, 2 },
+    // DataPointIndexNam
+    { "Nam", "Nam", "Optional description for schedule.", nullptr, nullptr, "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadWrite, false, 49, 47, 8 },
+    // DataPointIndexWinTms
+    { "WinTms", "WinTms", "Time window for schedule entry change.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 57, 55, 1 },
+    // DataPointIndexRmpTms
+    { "RmpTms", "RmpTms", "Ramp time for moving from current target to new target.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 58, 56, 1 },
+    // DataPointIndexActIndx
+    { "ActIndx", "ActIndx", "Index of active entry in the active schedule.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 59, 57, 1 }
+};
+
 SunSpecScheduleModelRepeatingBlock::SunSpecScheduleModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecScheduleModel *parent) :
     SunSpecModelRepeatingBlock(blockIndex, blockSize, modbusStartRegister, parent)
 {
@@ -55,7 +122,7 @@ quint16 SunSpecScheduleModelRepeatingBlock::actPts() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setActPts(quint16 actPts)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("ActPts");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexActPts]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(actPts);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -71,7 +138,7 @@ quint32 SunSpecScheduleModelRepeatingBlock::strTms() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setStrTms(quint32 strTms)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("StrTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexStrTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt32(strTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -87,7 +154,7 @@ quint16 SunSpecScheduleModelRepeatingBlock::repPer() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setRepPer(quint16 repPer)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("RepPer");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexRepPer]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(repPer);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -103,7 +170,7 @@ SunSpecScheduleModelRepeatingBlock::Intvtyp SunSpecScheduleModelRepeatingBlock::
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setSchdTyp(Intvtyp schdTyp)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("IntvTyp");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexSchdTyp]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(schdTyp));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -119,7 +186,7 @@ SunSpecScheduleModelRepeatingBlock::Xtyp SunSpecScheduleModelRepeatingBlock::xTy
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setXTyp(Xtyp xTyp)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("XTyp");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexXTyp]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(xTyp));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -135,7 +202,7 @@ SunSpecScheduleModelRepeatingBlock::Ytyp SunSpecScheduleModelRepeatingBlock::yTy
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setYTyp(Ytyp yTyp)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("YTyp");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexYTyp]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(yTyp));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -151,7 +218,7 @@ float SunSpecScheduleModelRepeatingBlock::x1() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setX1(float x1)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("X1");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexX1]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(x1);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -167,7 +234,7 @@ float SunSpecScheduleModelRepeatingBlock::y1() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setY1(float y1)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Y1");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexY1]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(y1);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -183,7 +250,7 @@ float SunSpecScheduleModelRepeatingBlock::x2() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setX2(float x2)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("X2");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexX2]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(x2);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -199,7 +266,7 @@ float SunSpecScheduleModelRepeatingBlock::y2() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setY2(float y2)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Y2");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexY2]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(y2);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -215,7 +282,7 @@ float SunSpecScheduleModelRepeatingBlock::x3() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setX3(float x3)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("X3");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexX3]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(x3);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -231,7 +298,7 @@ float SunSpecScheduleModelRepeatingBlock::y3() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setY3(float y3)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Y3");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexY3]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(y3);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -247,7 +314,7 @@ float SunSpecScheduleModelRepeatingBlock::x4() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setX4(float x4)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("X4");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexX4]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(x4);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -263,7 +330,7 @@ float SunSpecScheduleModelRepeatingBlock::y4() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setY4(float y4)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Y4");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexY4]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(y4);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -279,7 +346,7 @@ float SunSpecScheduleModelRepeatingBlock::x5() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setX5(float x5)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("X5");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexX5]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(x5);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -295,7 +362,7 @@ float SunSpecScheduleModelRepeatingBlock::y5() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setY5(float y5)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Y5");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexY5]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(y5);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -311,7 +378,7 @@ float SunSpecScheduleModelRepeatingBlock::x6() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setX6(float x6)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("X6");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexX6]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(x6);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -327,7 +394,7 @@ float SunSpecScheduleModelRepeatingBlock::y6() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setY6(float y6)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Y6");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexY6]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(y6);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -343,7 +410,7 @@ float SunSpecScheduleModelRepeatingBlock::x7() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setX7(float x7)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("X7");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexX7]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(x7);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -359,7 +426,7 @@ float SunSpecScheduleModelRepeatingBlock::y7() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setY7(float y7)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Y7");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexY7]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(y7);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -375,7 +442,7 @@ float SunSpecScheduleModelRepeatingBlock::x8() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setX8(float x8)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("X8");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexX8]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(x8);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -391,7 +458,7 @@ float SunSpecScheduleModelRepeatingBlock::y8() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setY8(float y8)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Y8");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexY8]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(y8);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -407,7 +474,7 @@ float SunSpecScheduleModelRepeatingBlock::x9() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setX9(float x9)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("X9");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexX9]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(x9);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -423,7 +490,7 @@ float SunSpecScheduleModelRepeatingBlock::y9() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setY9(float y9)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Y9");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexY9]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(y9);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -439,7 +506,7 @@ float SunSpecScheduleModelRepeatingBlock::x10() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setX10(float x10)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("X10");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexX10]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(x10);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -455,7 +522,7 @@ float SunSpecScheduleModelRepeatingBlock::y10() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setY10(float y10)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Y10");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexY10]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(y10);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -471,7 +538,7 @@ QString SunSpecScheduleModelRepeatingBlock::nam() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setNam(const QString &nam)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Nam");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexNam]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromString(nam, dp.size());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -487,7 +554,7 @@ quint16 SunSpecScheduleModelRepeatingBlock::winTms() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setWinTms(quint16 winTms)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("WinTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexWinTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(winTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -503,7 +570,7 @@ quint16 SunSpecScheduleModelRepeatingBlock::rmpTms() const
 
 QModbusReply *SunSpecScheduleModelRepeatingBlock::setRmpTms(quint16 rmpTms)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("RmpTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexRmpTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(rmpTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -519,537 +586,148 @@ quint16 SunSpecScheduleModelRepeatingBlock::actIndx() const
 
 void SunSpecScheduleModelRepeatingBlock::initDataPoints()
 {
-    SunSpecDataPoint actPtsDataPoint;
-    actPtsDataPoint.setName("ActPts");
-    actPtsDataPoint.setLabel("ActPts");
-    actPtsDataPoint.setDescription("Number of active entries in schedule.");
-    actPtsDataPoint.setMandatory(true);
-    actPtsDataPoint.setSize(1);
-    actPtsDataPoint.setAddressOffset(0);
-    actPtsDataPoint.setSunSpecDataType("uint16");
-    actPtsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    actPtsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(actPtsDataPoint.name(), actPtsDataPoint);
-
-    SunSpecDataPoint strTmsDataPoint;
-    strTmsDataPoint.setName("StrTms");
-    strTmsDataPoint.setLabel("StrTms");
-    strTmsDataPoint.setDescription("Schedule start in seconds since 2000 JAN 01 00:00:00 UTC.");
-    strTmsDataPoint.setUnits("Secs");
-    strTmsDataPoint.setMandatory(true);
-    strTmsDataPoint.setSize(2);
-    strTmsDataPoint.setAddressOffset(1);
-    strTmsDataPoint.setSunSpecDataType("uint32");
-    strTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    strTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(strTmsDataPoint.name(), strTmsDataPoint);
-
-    SunSpecDataPoint repPerDataPoint;
-    repPerDataPoint.setName("RepPer");
-    repPerDataPoint.setLabel("RepPer");
-    repPerDataPoint.setDescription("The repetition count for time-based schedules (0=repeat forever)");
-    repPerDataPoint.setMandatory(true);
-    repPerDataPoint.setSize(1);
-    repPerDataPoint.setAddressOffset(3);
-    repPerDataPoint.setBlockOffset(1);
-    repPerDataPoint.setSunSpecDataType("uint16");
-    repPerDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    repPerDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(repPerDataPoint.name(), repPerDataPoint);
-
-    SunSpecDataPoint schdTypDataPoint;
-    schdTypDataPoint.setName("IntvTyp");
-    schdTypDataPoint.setLabel("SchdTyp");
-    schdTypDataPoint.setDescription("The repetition frequency for time-based schedules: no repeat=0");
-    schdTypDataPoint.setMandatory(true);
-    schdTypDataPoint.setSize(1);
-    schdTypDataPoint.setAddressOffset(4);
-    schdTypDataPoint.setBlockOffset(2);
-    schdTypDataPoint.setSunSpecDataType("enum16");
-    schdTypDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    schdTypDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(schdTypDataPoint.name(), schdTypDataPoint);
-
-    SunSpecDataPoint xTypDataPoint;
-    xTypDataPoint.setName("XTyp");
-    xTypDataPoint.setLabel("XTyp");
-    xTypDataPoint.setDescription("The meaning of the X-values in the array. ");
-    xTypDataPoint.setMandatory(true);
-    xTypDataPoint.setSize(1);
-    xTypDataPoint.setAddressOffset(5);
-    xTypDataPoint.setBlockOffset(3);
-    xTypDataPoint.setSunSpecDataType("enum16");
-    xTypDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    xTypDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(xTypDataPoint.name(), xTypDataPoint);
-
-    SunSpecDataPoint xSfDataPoint;
-    xSfDataPoint.setName("X_SF");
-    xSfDataPoint.setLabel("X_SF");
-    xSfDataPoint.setDescription("Scale factor for schedule range values.");
-    xSfDataPoint.setMandatory(true);
-    xSfDataPoint.setSize(1);
-    xSfDataPoint.setAddressOffset(6);
-    xSfDataPoint.setBlockOffset(4);
-    xSfDataPoint.setSunSpecDataType("sunssf");
-    xSfDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    xSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(xSfDataPoint.name(), xSfDataPoint);
-
-    SunSpecDataPoint yTypDataPoint;
-    yTypDataPoint.setName("YTyp");
-    yTypDataPoint.setLabel("YTyp");
-    yTypDataPoint.setDescription("The meaning of the Y-values in the array.");
-    yTypDataPoint.setMandatory(true);
-    yTypDataPoint.setSize(1);
-    yTypDataPoint.setAddressOffset(7);
-    yTypDataPoint.setBlockOffset(5);
-    yTypDataPoint.setSunSpecDataType("enum16");
-    yTypDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    yTypDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(yTypDataPoint.name(), yTypDataPoint);
-
-    SunSpecDataPoint ySfDataPoint;
-    ySfDataPoint.setName("Y_SF");
-    ySfDataPoint.setLabel("Y_SF");
-    ySfDataPoint.setDescription("Scale factor for schedule target values.");
-    ySfDataPoint.setMandatory(true);
-    ySfDataPoint.setSize(1);
-    ySfDataPoint.setAddressOffset(8);
-    ySfDataPoint.setBlockOffset(6);
-    ySfDataPoint.setSunSpecDataType("sunssf");
-    ySfDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    ySfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ySfDataPoint.name(), ySfDataPoint);
-
-    SunSpecDataPoint x1DataPoint;
-    x1DataPoint.setName("X1");
-    x1DataPoint.setLabel("X1");
-    x1DataPoint.setDescription("Entry 1 range.");
-    x1DataPoint.setMandatory(true);
-    x1DataPoint.setSize(2);
-    x1DataPoint.setAddressOffset(9);
-    x1DataPoint.setBlockOffset(7);
-    x1DataPoint.setScaleFactorName("X_SF");
-    x1DataPoint.setSunSpecDataType("int32");
-    x1DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    x1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(x1DataPoint.name(), x1DataPoint);
-
-    SunSpecDataPoint y1DataPoint;
-    y1DataPoint.setName("Y1");
-    y1DataPoint.setLabel("Y1");
-    y1DataPoint.setDescription("Entry 1 target.");
-    y1DataPoint.setMandatory(true);
-    y1DataPoint.setSize(2);
-    y1DataPoint.setAddressOffset(11);
-    y1DataPoint.setBlockOffset(9);
-    y1DataPoint.setScaleFactorName("Y_SF");
-    y1DataPoint.setSunSpecDataType("int32");
-    y1DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    y1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(y1DataPoint.name(), y1DataPoint);
-
-    SunSpecDataPoint x2DataPoint;
-    x2DataPoint.setName("X2");
-    x2DataPoint.setLabel("X2");
-    x2DataPoint.setDescription("Entry 2 range.");
-    x2DataPoint.setSize(2);
-    x2DataPoint.setAddressOffset(13);
-    x2DataPoint.setBlockOffset(11);
-    x2DataPoint.setScaleFactorName("X_SF");
-    x2DataPoint.setSunSpecDataType("int32");
-    x2DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    x2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(x2DataPoint.name(), x2DataPoint);
-
-    SunSpecDataPoint y2DataPoint;
-    y2DataPoint.setName("Y2");
-    y2DataPoint.setLabel("Y2");
-    y2DataPoint.setDescription("Entry 2 target.");
-    y2DataPoint.setSize(2);
-    y2DataPoint.setAddressOffset(15);
-    y2DataPoint.setBlockOffset(13);
-    y2DataPoint.setScaleFactorName("Y_SF");
-    y2DataPoint.setSunSpecDataType("int32");
-    y2DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    y2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(y2DataPoint.name(), y2DataPoint);
-
-    SunSpecDataPoint x3DataPoint;
-    x3DataPoint.setName("X3");
-    x3DataPoint.setLabel("X3");
-    x3DataPoint.setDescription("Entry 3 range.");
-    x3DataPoint.setSize(2);
-    x3DataPoint.setAddressOffset(17);
-    x3DataPoint.setBlockOffset(15);
-    x3DataPoint.setScaleFactorName("X_SF");
-    x3DataPoint.setSunSpecDataType("int32");
-    x3DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    x3DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(x3DataPoint.name(), x3DataPoint);
-
-    SunSpecDataPoint y3DataPoint;
-    y3DataPoint.setName("Y3");
-    y3DataPoint.setLabel("Y3");
-    y3DataPoint.setDescription("Entry 3 target.");
-    y3DataPoint.setSize(2);
-    y3DataPoint.setAddressOffset(19);
-    y3DataPoint.setBlockOffset(17);
-    y3DataPoint.setScaleFactorName("Y_SF");
-    y3DataPoint.setSunSpecDataType("int32");
-    y3DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    y3DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(y3DataPoint.name(), y3DataPoint);
-
-    SunSpecDataPoint x4DataPoint;
-    x4DataPoint.setName("X4");
-    x4DataPoint.setLabel("X4");
-    x4DataPoint.setDescription("Entry 4 range.");
-    x4DataPoint.setSize(2);
-    x4DataPoint.setAddressOffset(21);
-    x4DataPoint.setBlockOffset(19);
-    x4DataPoint.setScaleFactorName("X_SF");
-    x4DataPoint.setSunSpecDataType("int32");
-    x4DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    x4DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(x4DataPoint.name(), x4DataPoint);
-
-    SunSpecDataPoint y4DataPoint;
-    y4DataPoint.setName("Y4");
-    y4DataPoint.setLabel("Y4");
-    y4DataPoint.setDescription("Entry 4 target.");
-    y4DataPoint.setSize(2);
-    y4DataPoint.setAddressOffset(23);
-    y4DataPoint.setBlockOffset(21);
-    y4DataPoint.setScaleFactorName("Y_SF");
-    y4DataPoint.setSunSpecDataType("int32");
-    y4DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    y4DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(y4DataPoint.name(), y4DataPoint);
-
-    SunSpecDataPoint x5DataPoint;
-    x5DataPoint.setName("X5");
-    x5DataPoint.setLabel("X5");
-    x5DataPoint.setDescription("Entry 15range.");
-    x5DataPoint.setSize(2);
-    x5DataPoint.setAddressOffset(25);
-    x5DataPoint.setBlockOffset(23);
-    x5DataPoint.setScaleFactorName("X_SF");
-    x5DataPoint.setSunSpecDataType("int32");
-    x5DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    x5DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(x5DataPoint.name(), x5DataPoint);
-
-    SunSpecDataPoint y5DataPoint;
-    y5DataPoint.setName("Y5");
-    y5DataPoint.setLabel("Y5");
-    y5DataPoint.setDescription("Entry 5 target.");
-    y5DataPoint.setSize(2);
-    y5DataPoint.setAddressOffset(27);
-    y5DataPoint.setBlockOffset(25);
-    y5DataPoint.setScaleFactorName("Y_SF");
-    y5DataPoint.setSunSpecDataType("int32");
-    y5DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    y5DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(y5DataPoint.name(), y5DataPoint);
-
-    SunSpecDataPoint x6DataPoint;
-    x6DataPoint.setName("X6");
-    x6DataPoint.setLabel("X6");
-    x6DataPoint.setDescription("Entry 6 range.");
-    x6DataPoint.setSize(2);
-    x6DataPoint.setAddressOffset(29);
-    x6DataPoint.setBlockOffset(27);
-    x6DataPoint.setScaleFactorName("X_SF");
-    x6DataPoint.setSunSpecDataType("int32");
-    x6DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    x6DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(x6DataPoint.name(), x6DataPoint);
-
-    SunSpecDataPoint y6DataPoint;
-    y6DataPoint.setName("Y6");
-    y6DataPoint.setLabel("Y6");
-    y6DataPoint.setDescription("Entry 6 target.");
-    y6DataPoint.setSize(2);
-    y6DataPoint.setAddressOffset(31);
-    y6DataPoint.setBlockOffset(29);
-    y6DataPoint.setScaleFactorName("Y_SF");
-    y6DataPoint.setSunSpecDataType("int32");
-    y6DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    y6DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(y6DataPoint.name(), y6DataPoint);
-
-    SunSpecDataPoint x7DataPoint;
-    x7DataPoint.setName("X7");
-    x7DataPoint.setLabel("X7");
-    x7DataPoint.setDescription("Entry 7 range.");
-    x7DataPoint.setSize(2);
-    x7DataPoint.setAddressOffset(33);
-    x7DataPoint.setBlockOffset(31);
-    x7DataPoint.setScaleFactorName("X_SF");
-    x7DataPoint.setSunSpecDataType("int32");
-    x7DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    x7DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(x7DataPoint.name(), x7DataPoint);
-
-    SunSpecDataPoint y7DataPoint;
-    y7DataPoint.setName("Y7");
-    y7DataPoint.setLabel("Y7");
-    y7DataPoint.setDescription("Entry 7 target.");
-    y7DataPoint.setSize(2);
-    y7DataPoint.setAddressOffset(35);
-    y7DataPoint.setBlockOffset(33);
-    y7DataPoint.setScaleFactorName("Y_SF");
-    y7DataPoint.setSunSpecDataType("int32");
-    y7DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    y7DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(y7DataPoint.name(), y7DataPoint);
-
-    SunSpecDataPoint x8DataPoint;
-    x8DataPoint.setName("X8");
-    x8DataPoint.setLabel("X8");
-    x8DataPoint.setDescription("Entry 8 range.");
-    x8DataPoint.setSize(2);
-    x8DataPoint.setAddressOffset(37);
-    x8DataPoint.setBlockOffset(35);
-    x8DataPoint.setScaleFactorName("X_SF");
-    x8DataPoint.setSunSpecDataType("int32");
-    x8DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    x8DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(x8DataPoint.name(), x8DataPoint);
-
-    SunSpecDataPoint y8DataPoint;
-    y8DataPoint.setName("Y8");
-    y8DataPoint.setLabel("Y8");
-    y8DataPoint.setDescription("Entry 8 target.");
-    y8DataPoint.setSize(2);
-    y8DataPoint.setAddressOffset(39);
-    y8DataPoint.setBlockOffset(37);
-    y8DataPoint.setScaleFactorName("Y_SF");
-    y8DataPoint.setSunSpecDataType("int32");
-    y8DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    y8DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(y8DataPoint.name(), y8DataPoint);
-
-    SunSpecDataPoint x9DataPoint;
-    x9DataPoint.setName("X9");
-    x9DataPoint.setLabel("X9");
-    x9DataPoint.setDescription("Entry 9 range.");
-    x9DataPoint.setSize(2);
-    x9DataPoint.setAddressOffset(41);
-    x9DataPoint.setBlockOffset(39);
-    x9DataPoint.setScaleFactorName("X_SF");
-    x9DataPoint.setSunSpecDataType("int32");
-    x9DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    x9DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(x9DataPoint.name(), x9DataPoint);
-
-    SunSpecDataPoint y9DataPoint;
-    y9DataPoint.setName("Y9");
-    y9DataPoint.setLabel("Y9");
-    y9DataPoint.setDescription("Entry 9 target.");
-    y9DataPoint.setSize(2);
-    y9DataPoint.setAddressOffset(43);
-    y9DataPoint.setBlockOffset(41);
-    y9DataPoint.setScaleFactorName("Y_SF");
-    y9DataPoint.setSunSpecDataType("int32");
-    y9DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    y9DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(y9DataPoint.name(), y9DataPoint);
-
-    SunSpecDataPoint x10DataPoint;
-    x10DataPoint.setName("X10");
-    x10DataPoint.setLabel("X10");
-    x10DataPoint.setDescription("Entry 10 range.");
-    x10DataPoint.setSize(2);
-    x10DataPoint.setAddressOffset(45);
-    x10DataPoint.setBlockOffset(43);
-    x10DataPoint.setScaleFactorName("X_SF");
-    x10DataPoint.setSunSpecDataType("int32");
-    x10DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    x10DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(x10DataPoint.name(), x10DataPoint);
-
-    SunSpecDataPoint y10DataPoint;
-    y10DataPoint.setName("Y10");
-    y10DataPoint.setLabel("Y10");
-    y10DataPoint.setDescription("Entry 10 target.");
-    y10DataPoint.setSize(2);
-    y10DataPoint.setAddressOffset(47);
-    y10DataPoint.setBlockOffset(45);
-    y10DataPoint.setScaleFactorName("Y_SF");
-    y10DataPoint.setSunSpecDataType("int32");
-    y10DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    y10DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(y10DataPoint.name(), y10DataPoint);
-
-    SunSpecDataPoint namDataPoint;
-    namDataPoint.setName("Nam");
-    namDataPoint.setLabel("Nam");
-    namDataPoint.setDescription("Optional description for schedule.");
-    namDataPoint.setSize(8);
-    namDataPoint.setAddressOffset(49);
-    namDataPoint.setBlockOffset(47);
-    namDataPoint.setSunSpecDataType("string");
-    namDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    namDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(namDataPoint.name(), namDataPoint);
-
-    SunSpecDataPoint winTmsDataPoint;
-    winTmsDataPoint.setName("WinTms");
-    winTmsDataPoint.setLabel("WinTms");
-    winTmsDataPoint.setDescription("Time window for schedule entry change.");
-    winTmsDataPoint.setUnits("Secs");
-    winTmsDataPoint.setSize(1);
-    winTmsDataPoint.setAddressOffset(57);
-    winTmsDataPoint.setBlockOffset(55);
-    winTmsDataPoint.setSunSpecDataType("uint16");
-    winTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    winTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(winTmsDataPoint.name(), winTmsDataPoint);
-
-    SunSpecDataPoint rmpTmsDataPoint;
-    rmpTmsDataPoint.setName("RmpTms");
-    rmpTmsDataPoint.setLabel("RmpTms");
-    rmpTmsDataPoint.setDescription("Ramp time for moving from current target to new target.");
-    rmpTmsDataPoint.setUnits("Secs");
-    rmpTmsDataPoint.setSize(1);
-    rmpTmsDataPoint.setAddressOffset(58);
-    rmpTmsDataPoint.setBlockOffset(56);
-    rmpTmsDataPoint.setSunSpecDataType("uint16");
-    rmpTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    rmpTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rmpTmsDataPoint.name(), rmpTmsDataPoint);
-
-    SunSpecDataPoint actIndxDataPoint;
-    actIndxDataPoint.setName("ActIndx");
-    actIndxDataPoint.setLabel("ActIndx");
-    actIndxDataPoint.setDescription("Index of active entry in the active schedule.");
-    actIndxDataPoint.setMandatory(true);
-    actIndxDataPoint.setSize(1);
-    actIndxDataPoint.setAddressOffset(59);
-    actIndxDataPoint.setBlockOffset(57);
-    actIndxDataPoint.setSunSpecDataType("uint16");
-    actIndxDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(actIndxDataPoint.name(), actIndxDataPoint);
-
+    m_dataPointMetadata = repeatingBlockDataPointMetadata;
+    m_dataPointCount = 32;
 }
 
 void SunSpecScheduleModelRepeatingBlock::processBlockData(const QVector<quint16> blockData)
 {
     m_blockData = blockData;
 
+    const quint16 *registers = m_blockData.constData();
+    const int registerCount = m_blockData.count();
+
     // Scale factors
-    if (m_dataPoints.value("X_SF").isValid())
-        m_xSf = m_dataPoints.value("X_SF").toInt16();
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 6, 1);
+        if (scaleFactor != m_xSf) {
+            m_xSf = scaleFactor;
+            m_xSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("Y_SF").isValid())
-        m_ySf = m_dataPoints.value("Y_SF").toInt16();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 8, 1);
+        if (scaleFactor != m_ySf) {
+            m_ySf = scaleFactor;
+            m_ySfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("ActPts").isValid())
-        m_actPts = m_dataPoints.value("ActPts").toUInt16();
+    if (registerCount >= 1 && SunSpecDataPoint::isValid(registers + 0, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_actPts = SunSpecDataPoint::convertToUInt16(registers + 0, 1);
 
-    if (m_dataPoints.value("StrTms").isValid())
-        m_strTms = m_dataPoints.value("StrTms").toUInt32();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 1, 2, SunSpecDataPoint::UInt32, m_byteOrder))
+        m_strTms = SunSpecDataPoint::convertToUInt32(registers + 1, 2, m_byteOrder);
 
-    if (m_dataPoints.value("RepPer").isValid())
-        m_repPer = m_dataPoints.value("RepPer").toUInt16();
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_repPer = SunSpecDataPoint::convertToUInt16(registers + 3, 1);
 
-    if (m_dataPoints.value("IntvTyp").isValid())
-        m_schdTyp = static_cast<Intvtyp>(m_dataPoints.value("IntvTyp").toUInt16());
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_schdTyp = static_cast<Intvtyp>(SunSpecDataPoint::convertToUInt16(registers + 4, 1));
 
-    if (m_dataPoints.value("XTyp").isValid())
-        m_xTyp = static_cast<Xtyp>(m_dataPoints.value("XTyp").toUInt16());
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_xTyp = static_cast<Xtyp>(SunSpecDataPoint::convertToUInt16(registers + 5, 1));
 
-    if (m_dataPoints.value("X_SF").isValid())
-        m_xSf = m_dataPoints.value("X_SF").toInt16();
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_yTyp = static_cast<Ytyp>(SunSpecDataPoint::convertToUInt16(registers + 7, 1));
 
-    if (m_dataPoints.value("YTyp").isValid())
-        m_yTyp = static_cast<Ytyp>(m_dataPoints.value("YTyp").toUInt16());
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 9, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_x1 = SunSpecDataPoint::convertToInt32(registers + 9, 2, m_byteOrder) * m_xSfMultiplier;
 
-    if (m_dataPoints.value("Y_SF").isValid())
-        m_ySf = m_dataPoints.value("Y_SF").toInt16();
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 11, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_y1 = SunSpecDataPoint::convertToInt32(registers + 11, 2, m_byteOrder) * m_ySfMultiplier;
 
-    if (m_dataPoints.value("X1").isValid())
-        m_x1 = m_dataPoints.value("X1").toFloatWithSSF(m_xSf);
+    if (registerCount >= 15 && SunSpecDataPoint::isValid(registers + 13, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_x2 = SunSpecDataPoint::convertToInt32(registers + 13, 2, m_byteOrder) * m_xSfMultiplier;
 
-    if (m_dataPoints.value("Y1").isValid())
-        m_y1 = m_dataPoints.value("Y1").toFloatWithSSF(m_ySf);
+    if (registerCount >= 17 && SunSpecDataPoint::isValid(registers + 15, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_y2 = SunSpecDataPoint::convertToInt32(registers + 15, 2, m_byteOrder) * m_ySfMultiplier;
 
-    if (m_dataPoints.value("X2").isValid())
-        m_x2 = m_dataPoints.value("X2").toFloatWithSSF(m_xSf);
+    if (registerCount >= 19 && SunSpecDataPoint::isValid(registers + 17, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_x3 = SunSpecDataPoint::convertToInt32(registers + 17, 2, m_byteOrder) * m_xSfMultiplier;
 
-    if (m_dataPoints.value("Y2").isValid())
-        m_y2 = m_dataPoints.value("Y2").toFloatWithSSF(m_ySf);
+    if (registerCount >= 21 && SunSpecDataPoint::isValid(registers + 19, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_y3 = SunSpecDataPoint::convertToInt32(registers + 19, 2, m_byteOrder) * m_ySfMultiplier;
 
-    if (m_dataPoints.value("X3").isValid())
-        m_x3 = m_dataPoints.value("X3").toFloatWithSSF(m_xSf);
+    if (registerCount >= 23 && SunSpecDataPoint::isValid(registers + 21, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_x4 = SunSpecDataPoint::convertToInt32(registers + 21, 2, m_byteOrder) * m_xSfMultiplier;
 
-    if (m_dataPoints.value("Y3").isValid())
-        m_y3 = m_dataPoints.value("Y3").toFloatWithSSF(m_ySf);
+    if (registerCount >= 25 && SunSpecDataPoint::isValid(registers + 23, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_y4 = SunSpecDataPoint::convertToInt32(registers + 23, 2, m_byteOrder) * m_ySfMultiplier;
 
-    if (m_dataPoints.value("X4").isValid())
-        m_x4 = m_dataPoints.value("X4").toFloatWithSSF(m_xSf);
+    if (registerCount >= 27 && SunSpecDataPoint::isValid(registers + 25, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_x5 = SunSpecDataPoint::convertToInt32(registers + 25, 2, m_byteOrder) * m_xSfMultiplier;
 
-    if (m_dataPoints.value("Y4").isValid())
-        m_y4 = m_dataPoints.value("Y4").toFloatWithSSF(m_ySf);
+    if (registerCount >= 29 && SunSpecDataPoint::isValid(registers + 27, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_y5 = SunSpecDataPoint::convertToInt32(registers + 27, 2, m_byteOrder) * m_ySfMultiplier;
 
-    if (m_dataPoints.value("X5").isValid())
-        m_x5 = m_dataPoints.value("X5").toFloatWithSSF(m_xSf);
+    if (registerCount >= 31 && SunSpecDataPoint::isValid(registers + 29, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_x6 = SunSpecDataPoint::convertToInt32(registers + 29, 2, m_byteOrder) * m_xSfMultiplier;
 
-    if (m_dataPoints.value("Y5").isValid())
-        m_y5 = m_dataPoints.value("Y5").toFloatWithSSF(m_ySf);
+    if (registerCount >= 33 && SunSpecDataPoint::isValid(registers + 31, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_y6 = SunSpecDataPoint::convertToInt32(registers + 31, 2, m_byteOrder) * m_ySfMultiplier;
 
-    if (m_dataPoints.value("X6").isValid())
-        m_x6 = m_dataPoints.value("X6").toFloatWithSSF(m_xSf);
+    if (registerCount >= 35 && SunSpecDataPoint::isValid(registers + 33, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_x7 = SunSpecDataPoint::convertToInt32(registers + 33, 2, m_byteOrder) * m_xSfMultiplier;
 
-    if (m_dataPoints.value("Y6").isValid())
-        m_y6 = m_dataPoints.value("Y6").toFloatWithSSF(m_ySf);
+    if (registerCount >= 37 && SunSpecDataPoint::isValid(registers + 35, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_y7 = SunSpecDataPoint::convertToInt32(registers + 35, 2, m_byteOrder) * m_ySfMultiplier;
 
-    if (m_dataPoints.value("X7").isValid())
-        m_x7 = m_dataPoints.value("X7").toFloatWithSSF(m_xSf);
+    if (registerCount >= 39 && SunSpecDataPoint::isValid(registers + 37, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_x8 = SunSpecDataPoint::convertToInt32(registers + 37, 2, m_byteOrder) * m_xSfMultiplier;
 
-    if (m_dataPoints.value("Y7").isValid())
-        m_y7 = m_dataPoints.value("Y7").toFloatWithSSF(m_ySf);
+    if (registerCount >= 41 && SunSpecDataPoint::isValid(registers + 39, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_y8 = SunSpecDataPoint::convertToInt32(registers + 39, 2, m_byteOrder) * m_ySfMultiplier;
 
-    if (m_dataPoints.value("X8").isValid())
-        m_x8 = m_dataPoints.value("X8").toFloatWithSSF(m_xSf);
+    if (registerCount >= 43 && SunSpecDataPoint::isValid(registers + 41, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_x9 = SunSpecDataPoint::convertToInt32(registers + 41, 2, m_byteOrder) * m_xSfMultiplier;
 
-    if (m_dataPoints.value("Y8").isValid())
-        m_y8 = m_dataPoints.value("Y8").toFloatWithSSF(m_ySf);
+    if (registerCount >= 45 && SunSpecDataPoint::isValid(registers + 43, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_y9 = SunSpecDataPoint::convertToInt32(registers + 43, 2, m_byteOrder) * m_ySfMultiplier;
 
-    if (m_dataPoints.value("X9").isValid())
-        m_x9 = m_dataPoints.value("X9").toFloatWithSSF(m_xSf);
+    if (registerCount >= 47 && SunSpecDataPoint::isValid(registers + 45, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_x10 = SunSpecDataPoint::convertToInt32(registers + 45, 2, m_byteOrder) * m_xSfMultiplier;
 
-    if (m_dataPoints.value("Y9").isValid())
-        m_y9 = m_dataPoints.value("Y9").toFloatWithSSF(m_ySf);
+    if (registerCount >= 49 && SunSpecDataPoint::isValid(registers + 47, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_y10 = SunSpecDataPoint::convertToInt32(registers + 47, 2, m_byteOrder) * m_ySfMultiplier;
 
-    if (m_dataPoints.value("X10").isValid())
-        m_x10 = m_dataPoints.value("X10").toFloatWithSSF(m_xSf);
+    if (registerCount >= 57 && SunSpecDataPoint::isValid(registers + 49, 8, SunSpecDataPoint::String, m_byteOrder))
+        m_nam = SunSpecDataPoint::convertToString(registers + 49, 8);
 
-    if (m_dataPoints.value("Y10").isValid())
-        m_y10 = m_dataPoints.value("Y10").toFloatWithSSF(m_ySf);
+    if (registerCount >= 58 && SunSpecDataPoint::isValid(registers + 57, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_winTms = SunSpecDataPoint::convertToUInt16(registers + 57, 1);
 
-    if (m_dataPoints.value("Nam").isValid())
-        m_nam = m_dataPoints.value("Nam").toString();
+    if (registerCount >= 59 && SunSpecDataPoint::isValid(registers + 58, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_rmpTms = SunSpecDataPoint::convertToUInt16(registers + 58, 1);
 
-    if (m_dataPoints.value("WinTms").isValid())
-        m_winTms = m_dataPoints.value("WinTms").toUInt16();
-
-    if (m_dataPoints.value("RmpTms").isValid())
-        m_rmpTms = m_dataPoints.value("RmpTms").toUInt16();
-
-    if (m_dataPoints.value("ActIndx").isValid())
-        m_actIndx = m_dataPoints.value("ActIndx").toUInt16();
+    if (registerCount >= 60 && SunSpecDataPoint::isValid(registers + 59, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_actIndx = SunSpecDataPoint::convertToUInt16(registers + 59, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
 }
 
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexActSchd
+    { "ActSchd", "ActSchd", "Bitfield of active schedules", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadWrite, true, 2, 0, 2 },
+    // DataPointIndexModEna
+    { "ModEna", "ModEna", "Is basic scheduling active.", nullptr, nullptr, "bitfield16", nullptr, SunSpecDataPoint::BitField16, SunSpecDataPoint::AccessReadWrite, true, 4, 2, 1 },
+    // DataPointIndexNSchd
+    { "NSchd", "NSchd", "Number of schedules supported (recommend min. 4, max 32)", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 5, 3, 1 },
+    // DataPointIndexNPts
+    { "NPts", "NPts", "Number of schedule entries supported (maximum of 10).", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 6, 4, 1 },
+    // DataPointIndexPad
+    { "Pad", "Pad", "Pad register.", nullptr, nullptr, "pad", nullptr, SunSpecDataPoint::Pad, SunSpecDataPoint::AccessReadOnly, false, 7, 5, 1 }
+};
+
 SunSpecScheduleModel::SunSpecScheduleModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 133, modelLength, byteOrder, parent)
 {
@@ -1088,7 +766,7 @@ QModbusReply *SunSpecScheduleModel::setActSchd(ActschdFlags actSchd)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ActSchd");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexActSchd]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt32(static_cast<quint32>(actSchd));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -1106,7 +784,7 @@ QModbusReply *SunSpecScheduleModel::setModEna(ModenaFlags modEna)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ModEna");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexModEna]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(modEna));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -1128,108 +806,30 @@ quint16 SunSpecScheduleModel::pad() const
 }
 void SunSpecScheduleModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint actSchdDataPoint;
-    actSchdDataPoint.setName("ActSchd");
-    actSchdDataPoint.setLabel("ActSchd");
-    actSchdDataPoint.setDescription("Bitfield of active schedules");
-    actSchdDataPoint.setMandatory(true);
-    actSchdDataPoint.setSize(2);
-    actSchdDataPoint.setAddressOffset(2);
-    actSchdDataPoint.setBlockOffset(0);
-    actSchdDataPoint.setSunSpecDataType("bitfield32");
-    actSchdDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    actSchdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(actSchdDataPoint.name(), actSchdDataPoint);
-
-    SunSpecDataPoint modEnaDataPoint;
-    modEnaDataPoint.setName("ModEna");
-    modEnaDataPoint.setLabel("ModEna");
-    modEnaDataPoint.setDescription("Is basic scheduling active.");
-    modEnaDataPoint.setMandatory(true);
-    modEnaDataPoint.setSize(1);
-    modEnaDataPoint.setAddressOffset(4);
-    modEnaDataPoint.setBlockOffset(2);
-    modEnaDataPoint.setSunSpecDataType("bitfield16");
-    modEnaDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    modEnaDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modEnaDataPoint.name(), modEnaDataPoint);
-
-    SunSpecDataPoint nSchdDataPoint;
-    nSchdDataPoint.setName("NSchd");
-    nSchdDataPoint.setLabel("NSchd");
-    nSchdDataPoint.setDescription("Number of schedules supported (recommend min. 4, max 32)");
-    nSchdDataPoint.setMandatory(true);
-    nSchdDataPoint.setSize(1);
-    nSchdDataPoint.setAddressOffset(5);
-    nSchdDataPoint.setBlockOffset(3);
-    nSchdDataPoint.setSunSpecDataType("uint16");
-    nSchdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(nSchdDataPoint.name(), nSchdDataPoint);
-
-    SunSpecDataPoint nPtsDataPoint;
-    nPtsDataPoint.setName("NPts");
-    nPtsDataPoint.setLabel("NPts");
-    nPtsDataPoint.setDescription("Number of schedule entries supported (maximum of 10).");
-    nPtsDataPoint.setMandatory(true);
-    nPtsDataPoint.setSize(1);
-    nPtsDataPoint.setAddressOffset(6);
-    nPtsDataPoint.setBlockOffset(4);
-    nPtsDataPoint.setSunSpecDataType("uint16");
-    nPtsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(nPtsDataPoint.name(), nPtsDataPoint);
-
-    SunSpecDataPoint padDataPoint;
-    padDataPoint.setName("Pad");
-    padDataPoint.setLabel("Pad");
-    padDataPoint.setDescription("Pad register.");
-    padDataPoint.setSize(1);
-    padDataPoint.setAddressOffset(7);
-    padDataPoint.setBlockOffset(5);
-    padDataPoint.setSunSpecDataType("pad");
-    padDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(padDataPoint.name(), padDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 7;
 }
 
 void SunSpecScheduleModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("ActSchd").isValid())
-        m_actSchd = static_cast<ActschdFlags>(m_dataPoints.value("ActSchd").toUInt32());
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 2, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_actSchd = static_cast<ActschdFlags>(SunSpecDataPoint::convertToUInt32(registers + 2, 2, m_byteOrder));
 
-    if (m_dataPoints.value("ModEna").isValid())
-        m_modEna = static_cast<ModenaFlags>(m_dataPoints.value("ModEna").toUInt16());
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::BitField16, m_byteOrder))
+        m_modEna = static_cast<ModenaFlags>(SunSpecDataPoint::convertToUInt16(registers + 4, 1));
 
-    if (m_dataPoints.value("NSchd").isValid())
-        m_nSchd = m_dataPoints.value("NSchd").toUInt16();
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_nSchd = SunSpecDataPoint::convertToUInt16(registers + 5, 1);
 
-    if (m_dataPoints.value("NPts").isValid())
-        m_nPts = m_dataPoints.value("NPts").toUInt16();
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_nPts = SunSpecDataPoint::convertToUInt16(registers + 6, 1);
 
-    if (m_dataPoints.value("Pad").isValid())
-        m_pad = m_dataPoints.value("Pad").toUInt16();
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::Pad, m_byteOrder))
+        m_pad = SunSpecDataPoint::convertToUInt16(registers + 7, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -1238,36 +838,36 @@ void SunSpecScheduleModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecScheduleModel *model)
 {
     debug.nospace().noquote() << "SunSpecScheduleModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ActSchd") << "-->";
-    if (model->dataPoints().value("ActSchd").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecScheduleModel::DataPointIndexActSchd) << "-->";
+    if (model->dataPoint(SunSpecScheduleModel::DataPointIndexActSchd).isValid()) {
         debug.nospace().noquote() << model->actSchd() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModEna") << "-->";
-    if (model->dataPoints().value("ModEna").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecScheduleModel::DataPointIndexModEna) << "-->";
+    if (model->dataPoint(SunSpecScheduleModel::DataPointIndexModEna).isValid()) {
         debug.nospace().noquote() << model->modEna() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NSchd") << "-->";
-    if (model->dataPoints().value("NSchd").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecScheduleModel::DataPointIndexNSchd) << "-->";
+    if (model->dataPoint(SunSpecScheduleModel::DataPointIndexNSchd).isValid()) {
         debug.nospace().noquote() << model->nSchd() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NPts") << "-->";
-    if (model->dataPoints().value("NPts").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecScheduleModel::DataPointIndexNPts) << "-->";
+    if (model->dataPoint(SunSpecScheduleModel::DataPointIndexNPts).isValid()) {
         debug.nospace().noquote() << model->nPts() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Pad") << "-->";
-    if (model->dataPoints().value("Pad").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecScheduleModel::DataPointIndexPad) << "-->";
+    if (model->dataPoint(SunSpecScheduleModel::DataPointIndexPad).isValid()) {
         debug.nospace().noquote() << model->pad() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
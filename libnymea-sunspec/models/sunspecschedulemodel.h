@@ -83,6 +83,41 @@ public:
     };
     Q_ENUM(Ytyp)
 
+    enum DataPointIndex {
+        DataPointIndexActPts = 0,
+        DataPointIndexStrTms,
+        DataPointIndexRepPer,
+        DataPointIndexSchdTyp,
+        DataPointIndexXTyp,
+        DataPointIndexXSf,
+        DataPointIndexYTyp,
+        DataPointIndexYSf,
+        DataPointIndexX1,
+        DataPointIndexY1,
+        DataPointIndexX2,
+        DataPointIndexY2,
+        DataPointIndexX3,
+        DataPointIndexY3,
+        DataPointIndexX4,
+        DataPointIndexY4,
+        DataPointIndexX5,
+        DataPointIndexY5,
+        DataPointIndexX6,
+        DataPointIndexY6,
+        DataPointIndexX7,
+        DataPointIndexY7,
+        DataPointIndexX8,
+        DataPointIndexY8,
+        DataPointIndexX9,
+        DataPointIndexY9,
+        DataPointIndexX10,
+        DataPointIndexY10,
+        DataPointIndexNam,
+        DataPointIndexWinTms,
+        DataPointIndexRmpTms,
+        DataPointIndexActIndx
+    };
+
     explicit SunSpecScheduleModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecScheduleModel *parent = nullptr);
     ~SunSpecScheduleModelRepeatingBlock() override = default;
 
@@ -231,8 +266,10 @@ private:
     Intvtyp m_schdTyp;
     Xtyp m_xTyp;
     qint16 m_xSf = 0;
+    double m_xSfMultiplier = 1;
     Ytyp m_yTyp;
     qint16 m_ySf = 0;
+    double m_ySfMultiplier = 1;
     float m_x1 = 0;
     float m_y1 = 0;
     float m_x2 = 0;
@@ -309,6 +346,16 @@ public:
     Q_DECLARE_FLAGS(ModenaFlags, Modena)
     Q_FLAG(Modena)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexActSchd,
+        DataPointIndexModEna,
+        DataPointIndexNSchd,
+        DataPointIndexNPts,
+        DataPointIndexPad
+    };
+
     explicit SunSpecScheduleModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecScheduleModel() override; 
 
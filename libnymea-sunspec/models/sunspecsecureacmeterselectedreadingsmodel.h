@@ -44,6 +44,10 @@ class SunSpecSecureAcMeterSelectedReadingsModelRepeatingBlock : public SunSpecMo
     Q_OBJECT
 public:
 
+    enum DataPointIndex {
+        DataPointIndexDS = 0
+    };
+
     explicit SunSpecSecureAcMeterSelectedReadingsModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecSecureAcMeterSelectedReadingsModel *parent = nullptr);
     ~SunSpecSecureAcMeterSelectedReadingsModelRepeatingBlock() override = default;
 
@@ -104,6 +108,43 @@ public:
     Q_DECLARE_FLAGS(EvtFlags, Evt)
     Q_FLAG(Evt)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexAmps,
+        DataPointIndexA_SF,
+        DataPointIndexVoltage,
+        DataPointIndexV_SF,
+        DataPointIndexHz,
+        DataPointIndexHz_SF,
+        DataPointIndexWatts,
+        DataPointIndexW_SF,
+        DataPointIndexVa,
+        DataPointIndexVA_SF,
+        DataPointIndexVar,
+        DataPointIndexVAR_SF,
+        DataPointIndexPf,
+        DataPointIndexPF_SF,
+        DataPointIndexTotalWattHoursExported,
+        DataPointIndexTotalWattHoursImported,
+        DataPointIndexTotWh_SF,
+        DataPointIndexTotalVaHoursExported,
+        DataPointIndexTotalVaHoursImported,
+        DataPointIndexTotVAh_SF,
+        DataPointIndexTotalVarHoursImportedQ1,
+        DataPointIndexTotalVArHoursImportedQ2,
+        DataPointIndexTotalVArHoursExportedQ3,
+        DataPointIndexTotalVArHoursExportedQ4,
+        DataPointIndexTotVArh_SF,
+        DataPointIndexEvents,
+        DataPointIndexRsrvd,
+        DataPointIndexTimestamp,
+        DataPointIndexMilliseconds,
+        DataPointIndexSequence,
+        DataPointIndexAlgorithm,
+        DataPointIndexN
+    };
+
     explicit SunSpecSecureAcMeterSelectedReadingsModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecSecureAcMeterSelectedReadingsModel() override; 
 
@@ -185,29 +226,39 @@ protected:
 private:
     float m_amps = 0;
     qint16 m_a_SF = 0;
+    double m_a_SFMultiplier = 1;
     float m_voltage = 0;
     qint16 m_v_SF = 0;
+    double m_v_SFMultiplier = 1;
     float m_hz = 0;
     qint16 m_hz_SF = 0;
+    double m_hz_SFMultiplier = 1;
     float m_watts = 0;
     qint16 m_w_SF = 0;
+    double m_w_SFMultiplier = 1;
     float m_va = 0;
     qint16 m_vA_SF = 0;
+    double m_vA_SFMultiplier = 1;
     float m_var = 0;
     qint16 m_vAR_SF = 0;
+    double m_vAR_SFMultiplier = 1;
     float m_pf = 0;
     qint16 m_pF_SF = 0;
+    double m_pF_SFMultiplier = 1;
     quint32 m_totalWattHoursExported = 0;
     quint32 m_totalWattHoursImported = 0;
     qint16 m_totWh_SF = 0;
+    double m_totWh_SFMultiplier = 1;
     quint32 m_totalVaHoursExported = 0;
     quint32 m_totalVaHoursImported = 0;
     qint16 m_totVAh_SF = 0;
+    double m_totVAh_SFMultiplier = 1;
     quint32 m_totalVarHoursImportedQ1 = 0;
     quint32 m_totalVArHoursImportedQ2 = 0;
     quint32 m_totalVArHoursExportedQ3 = 0;
     quint32 m_totalVArHoursExportedQ4 = 0;
     qint16 m_totVArh_SF = 0;
+    double m_totVArh_SFMultiplier = 1;
     EvtFlags m_events;
     quint16 m_rsrvd = 0;
     quint32 m_timestamp = 0;
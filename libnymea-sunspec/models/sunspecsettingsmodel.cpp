@@ -31,6 +31,73 @@
 #include "sunspecsettingsmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexWMax
+    { "WMax", "WMax", "Setting for maximum power output. Default to WRtg.", nullptr, "W", "uint16", "WMax_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 2, 0, 1 },
+    // DataPointIndexVRef
+    { "VRef", "VRef", "Voltage at the PCC.", nullptr, "V", "uint16", "VRef_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 3, 1, 1 },
+    // DataPointIndexVRefOfs
+    { "VRefOfs", "VRefOfs", "Offset  from PCC to inverter.", nullptr, "V", "int16", "VRefOfs_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, true, 4, 2, 1 },
+    // DataPointIndexVMax
+    { "VMax", "VMax", "Setpoint for maximum voltage.", nullptr, "V", "uint16", "VMinMax_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 5, 3, 1 },
+    // DataPointIndexVMin
+    { "VMin", "VMin", "Setpoint for minimum voltage.", nullptr, "V", "uint16", "VMinMax_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 6, 4, 1 },
+    // DataPointIndexVaMax
+    { "VAMax", "VAMax", "Setpoint for maximum apparent power. Default to VARtg.", nullptr, "VA", "uint16", "VAMax_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 7, 5, 1 },
+    // DataPointIndexVArMaxQ1
+    { "VArMaxQ1", "VArMaxQ1", "Setting for maximum reactive power in quadrant 1. Default to VArRtgQ1.", nullptr, "var", "int16", "VArMax_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 8, 6, 1 },
+    // DataPointIndexVArMaxQ2
+    { "VArMaxQ2", "VArMaxQ2", "Setting for maximum reactive power in quadrant 2. Default to VArRtgQ2.", nullptr, "var", "int16", "VArMax_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 9, 7, 1 },
+    // DataPointIndexVArMaxQ3
+    { "VArMaxQ3", "VArMaxQ3", "Setting for maximum reactive power in quadrant 3. Default to VArRtgQ3.", nullptr, "var", "int16", "VArMax_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 10, 8, 1 },
+    // DataPointIndexVArMaxQ4
+    { "VArMaxQ4", "VArMaxQ4", "Setting for maximum reactive power in quadrant 4. Default to VArRtgQ4.", nullptr, "var", "int16", "VArMax_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 11, 9, 1 },
+    // DataPointIndexWGra
+    { "WGra", "WGra", "Default ramp rate of change of active power due to command or internal action.", nullptr, "% WMax/sec", "uint16", "WGra_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 12, 10, 1 },
+    // DataPointIndexPfMinQ1
+    { "PFMinQ1", "PFMinQ1", "Setpoint for minimum power factor value in quadrant 1. Default to PFRtgQ1.", nullptr, "cos()", "int16", "PFMin_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 13, 11, 1 },
+    // DataPointIndexPfMinQ2
+    { "PFMinQ2", "PFMinQ2", "Setpoint for minimum power factor value in quadrant 2. Default to PFRtgQ2.", nullptr, "cos()", "int16", "PFMin_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 14, 12, 1 },
+    // DataPointIndexPfMinQ3
+    { "PFMinQ3", "PFMinQ3", "Setpoint for minimum power factor value in quadrant 3. Default to PFRtgQ3.", nullptr, "cos()", "int16", "PFMin_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 15, 13, 1 },
+    // DataPointIndexPfMinQ4
+    { "PFMinQ4", "PFMinQ4", "Setpoint for minimum power factor value in quadrant 4. Default to PFRtgQ4.", nullptr, "cos()", "int16", "PFMin_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 16, 14, 1 },
+    // DataPointIndexVArAct
+    { "VArAct", "VArAct", "VAR action on change between charging and discharging: 1=switch 2=maintain VAR characterization.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, false, 17, 15, 1 },
+    // DataPointIndexClcTotVa
+    { "ClcTotVA", "ClcTotVA", "Calculation method for total apparent power. 1=vector 2=arithmetic.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, false, 18, 16, 1 },
+    // DataPointIndexMaxRmpRte
+    { "MaxRmpRte", "MaxRmpRte", "Setpoint for maximum ramp rate as percentage of nominal maximum ramp rate. This setting will limit the rate that watts delivery to the grid can increase or decrease in response to intermittent PV generation.", nullptr, "% WGra", "uint16", "MaxRmpRte_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 19, 17, 1 },
+    // DataPointIndexEcpNomHz
+    { "ECPNomHz", "ECPNomHz", "Setpoint for nominal frequency at the ECP.", nullptr, "Hz", "uint16", "ECPNomHz_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 20, 18, 1 },
+    // DataPointIndexConnPh
+    { "ConnPh", "ConnPh", "Identity of connected phase for single phase inverters. A=1 B=2 C=3.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, false, 21, 19, 1 },
+    // DataPointIndexWMaxSf
+    { "WMax_SF", "WMax_SF", "Scale factor for real power.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 22, 20, 1 },
+    // DataPointIndexVRefSf
+    { "VRef_SF", "VRef_SF", "Scale factor for voltage at the PCC.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 23, 21, 1 },
+    // DataPointIndexVRefOfsSf
+    { "VRefOfs_SF", "VRefOfs_SF", "Scale factor for offset voltage.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 24, 22, 1 },
+    // DataPointIndexVMinMaxSf
+    { "VMinMax_SF", "VMinMax_SF", "Scale factor for min/max voltages.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 25, 23, 1 },
+    // DataPointIndexVaMaxSf
+    { "VAMax_SF", "VAMax_SF", "Scale factor for apparent power.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 26, 24, 1 },
+    // DataPointIndexVArMaxSf
+    { "VArMax_SF", "VArMax_SF", "Scale factor for reactive power.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 27, 25, 1 },
+    // DataPointIndexWGraSf
+    { "WGra_SF", "WGra_SF", "Scale factor for default ramp rate.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 28, 26, 1 },
+    // DataPointIndexPfMinSf
+    { "PFMin_SF", "PFMin_SF", "Scale factor for minimum power factor.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 29, 27, 1 },
+    // DataPointIndexMaxRmpRteSf
+    { "MaxRmpRte_SF", "MaxRmpRte_SF", "Scale factor for maximum ramp percentage.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 30, 28, 1 },
+    // DataPointIndexEcpNomHzSf
+    { "ECPNomHz_SF", "ECPNomHz_SF", "Scale factor for nominal frequency.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 31, 29, 1 }
+};
+
 SunSpecSettingsModel::SunSpecSettingsModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 121, modelLength, byteOrder, parent)
 {
@@ -69,7 +136,7 @@ QModbusReply *SunSpecSettingsModel::setWMax(float wMax)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("WMax");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexWMax]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(wMax, m_wMaxSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -87,7 +154,7 @@ QModbusReply *SunSpecSettingsModel::setVRef(float vRef)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VRef");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVRef]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(vRef, m_vRefSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -105,7 +172,7 @@ QModbusReply *SunSpecSettingsModel::setVRefOfs(float vRefOfs)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VRefOfs");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVRefOfs]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(vRefOfs, m_vRefOfsSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -123,7 +190,7 @@ QModbusReply *SunSpecSettingsModel::setVMax(float vMax)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VMax");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVMax]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(vMax, m_vMinMaxSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -141,7 +208,7 @@ QModbusReply *SunSpecSettingsModel::setVMin(float vMin)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VMin");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVMin]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(vMin, m_vMinMaxSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -159,7 +226,7 @@ QModbusReply *SunSpecSettingsModel::setVaMax(float vaMax)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VAMax");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVaMax]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(vaMax, m_vaMaxSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -177,7 +244,7 @@ QModbusReply *SunSpecSettingsModel::setVArMaxQ1(float vArMaxQ1)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VArMaxQ1");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVArMaxQ1]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(vArMaxQ1, m_vArMaxSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -195,7 +262,7 @@ QModbusReply *SunSpecSettingsModel::setVArMaxQ2(float vArMaxQ2)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VArMaxQ2");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVArMaxQ2]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(vArMaxQ2, m_vArMaxSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -213,7 +280,7 @@ QModbusReply *SunSpecSettingsModel::setVArMaxQ3(float vArMaxQ3)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VArMaxQ3");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVArMaxQ3]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(vArMaxQ3, m_vArMaxSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -231,7 +298,7 @@ QModbusReply *SunSpecSettingsModel::setVArMaxQ4(float vArMaxQ4)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VArMaxQ4");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVArMaxQ4]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(vArMaxQ4, m_vArMaxSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -249,7 +316,7 @@ QModbusReply *SunSpecSettingsModel::setWGra(float wGra)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("WGra");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexWGra]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(wGra, m_wGraSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -267,7 +334,7 @@ QModbusReply *SunSpecSettingsModel::setPfMinQ1(float pfMinQ1)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("PFMinQ1");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexPfMinQ1]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(pfMinQ1, m_pfMinSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -285,7 +352,7 @@ QModbusReply *SunSpecSettingsModel::setPfMinQ2(float pfMinQ2)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("PFMinQ2");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexPfMinQ2]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(pfMinQ2, m_pfMinSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -303,7 +370,7 @@ QModbusReply *SunSpecSettingsModel::setPfMinQ3(float pfMinQ3)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("PFMinQ3");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexPfMinQ3]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(pfMinQ3, m_pfMinSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -321,7 +388,7 @@ QModbusReply *SunSpecSettingsModel::setPfMinQ4(float pfMinQ4)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("PFMinQ4");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexPfMinQ4]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(pfMinQ4, m_pfMinSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -339,7 +406,7 @@ QModbusReply *SunSpecSettingsModel::setVArAct(Varact vArAct)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VArAct");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVArAct]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(vArAct));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -357,7 +424,7 @@ QModbusReply *SunSpecSettingsModel::setClcTotVa(Clctotva clcTotVa)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ClcTotVA");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexClcTotVa]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(clcTotVa));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -375,7 +442,7 @@ QModbusReply *SunSpecSettingsModel::setMaxRmpRte(float maxRmpRte)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("MaxRmpRte");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexMaxRmpRte]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(maxRmpRte, m_maxRmpRteSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -393,7 +460,7 @@ QModbusReply *SunSpecSettingsModel::setEcpNomHz(float ecpNomHz)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ECPNomHz");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexEcpNomHz]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(ecpNomHz, m_ecpNomHzSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -411,7 +478,7 @@ QModbusReply *SunSpecSettingsModel::setConnPh(Connph connPh)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ConnPh");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexConnPh]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(connPh));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -461,544 +528,157 @@ qint16 SunSpecSettingsModel::ecpNomHzSf() const
 }
 void SunSpecSettingsModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint wMaxDataPoint;
-    wMaxDataPoint.setName("WMax");
-    wMaxDataPoint.setLabel("WMax");
-    wMaxDataPoint.setDescription("Setting for maximum power output. Default to WRtg.");
-    wMaxDataPoint.setUnits("W");
-    wMaxDataPoint.setMandatory(true);
-    wMaxDataPoint.setSize(1);
-    wMaxDataPoint.setAddressOffset(2);
-    wMaxDataPoint.setBlockOffset(0);
-    wMaxDataPoint.setScaleFactorName("WMax_SF");
-    wMaxDataPoint.setSunSpecDataType("uint16");
-    wMaxDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    wMaxDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wMaxDataPoint.name(), wMaxDataPoint);
-
-    SunSpecDataPoint vRefDataPoint;
-    vRefDataPoint.setName("VRef");
-    vRefDataPoint.setLabel("VRef");
-    vRefDataPoint.setDescription("Voltage at the PCC.");
-    vRefDataPoint.setUnits("V");
-    vRefDataPoint.setMandatory(true);
-    vRefDataPoint.setSize(1);
-    vRefDataPoint.setAddressOffset(3);
-    vRefDataPoint.setBlockOffset(1);
-    vRefDataPoint.setScaleFactorName("VRef_SF");
-    vRefDataPoint.setSunSpecDataType("uint16");
-    vRefDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vRefDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vRefDataPoint.name(), vRefDataPoint);
-
-    SunSpecDataPoint vRefOfsDataPoint;
-    vRefOfsDataPoint.setName("VRefOfs");
-    vRefOfsDataPoint.setLabel("VRefOfs");
-    vRefOfsDataPoint.setDescription("Offset  from PCC to inverter.");
-    vRefOfsDataPoint.setUnits("V");
-    vRefOfsDataPoint.setMandatory(true);
-    vRefOfsDataPoint.setSize(1);
-    vRefOfsDataPoint.setAddressOffset(4);
-    vRefOfsDataPoint.setBlockOffset(2);
-    vRefOfsDataPoint.setScaleFactorName("VRefOfs_SF");
-    vRefOfsDataPoint.setSunSpecDataType("int16");
-    vRefOfsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vRefOfsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vRefOfsDataPoint.name(), vRefOfsDataPoint);
-
-    SunSpecDataPoint vMaxDataPoint;
-    vMaxDataPoint.setName("VMax");
-    vMaxDataPoint.setLabel("VMax");
-    vMaxDataPoint.setDescription("Setpoint for maximum voltage.");
-    vMaxDataPoint.setUnits("V");
-    vMaxDataPoint.setSize(1);
-    vMaxDataPoint.setAddressOffset(5);
-    vMaxDataPoint.setBlockOffset(3);
-    vMaxDataPoint.setScaleFactorName("VMinMax_SF");
-    vMaxDataPoint.setSunSpecDataType("uint16");
-    vMaxDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vMaxDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vMaxDataPoint.name(), vMaxDataPoint);
-
-    SunSpecDataPoint vMinDataPoint;
-    vMinDataPoint.setName("VMin");
-    vMinDataPoint.setLabel("VMin");
-    vMinDataPoint.setDescription("Setpoint for minimum voltage.");
-    vMinDataPoint.setUnits("V");
-    vMinDataPoint.setSize(1);
-    vMinDataPoint.setAddressOffset(6);
-    vMinDataPoint.setBlockOffset(4);
-    vMinDataPoint.setScaleFactorName("VMinMax_SF");
-    vMinDataPoint.setSunSpecDataType("uint16");
-    vMinDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vMinDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vMinDataPoint.name(), vMinDataPoint);
-
-    SunSpecDataPoint vaMaxDataPoint;
-    vaMaxDataPoint.setName("VAMax");
-    vaMaxDataPoint.setLabel("VAMax");
-    vaMaxDataPoint.setDescription("Setpoint for maximum apparent power. Default to VARtg.");
-    vaMaxDataPoint.setUnits("VA");
-    vaMaxDataPoint.setSize(1);
-    vaMaxDataPoint.setAddressOffset(7);
-    vaMaxDataPoint.setBlockOffset(5);
-    vaMaxDataPoint.setScaleFactorName("VAMax_SF");
-    vaMaxDataPoint.setSunSpecDataType("uint16");
-    vaMaxDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vaMaxDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vaMaxDataPoint.name(), vaMaxDataPoint);
-
-    SunSpecDataPoint vArMaxQ1DataPoint;
-    vArMaxQ1DataPoint.setName("VArMaxQ1");
-    vArMaxQ1DataPoint.setLabel("VArMaxQ1");
-    vArMaxQ1DataPoint.setDescription("Setting for maximum reactive power in quadrant 1. Default to VArRtgQ1.");
-    vArMaxQ1DataPoint.setUnits("var");
-    vArMaxQ1DataPoint.setSize(1);
-    vArMaxQ1DataPoint.setAddressOffset(8);
-    vArMaxQ1DataPoint.setBlockOffset(6);
-    vArMaxQ1DataPoint.setScaleFactorName("VArMax_SF");
-    vArMaxQ1DataPoint.setSunSpecDataType("int16");
-    vArMaxQ1DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vArMaxQ1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArMaxQ1DataPoint.name(), vArMaxQ1DataPoint);
-
-    SunSpecDataPoint vArMaxQ2DataPoint;
-    vArMaxQ2DataPoint.setName("VArMaxQ2");
-    vArMaxQ2DataPoint.setLabel("VArMaxQ2");
-    vArMaxQ2DataPoint.setDescription("Setting for maximum reactive power in quadrant 2. Default to VArRtgQ2.");
-    vArMaxQ2DataPoint.setUnits("var");
-    vArMaxQ2DataPoint.setSize(1);
-    vArMaxQ2DataPoint.setAddressOffset(9);
-    vArMaxQ2DataPoint.setBlockOffset(7);
-    vArMaxQ2DataPoint.setScaleFactorName("VArMax_SF");
-    vArMaxQ2DataPoint.setSunSpecDataType("int16");
-    vArMaxQ2DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vArMaxQ2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArMaxQ2DataPoint.name(), vArMaxQ2DataPoint);
-
-    SunSpecDataPoint vArMaxQ3DataPoint;
-    vArMaxQ3DataPoint.setName("VArMaxQ3");
-    vArMaxQ3DataPoint.setLabel("VArMaxQ3");
-    vArMaxQ3DataPoint.setDescription("Setting for maximum reactive power in quadrant 3. Default to VArRtgQ3.");
-    vArMaxQ3DataPoint.setUnits("var");
-    vArMaxQ3DataPoint.setSize(1);
-    vArMaxQ3DataPoint.setAddressOffset(10);
-    vArMaxQ3DataPoint.setBlockOffset(8);
-    vArMaxQ3DataPoint.setScaleFactorName("VArMax_SF");
-    vArMaxQ3DataPoint.setSunSpecDataType("int16");
-    vArMaxQ3DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vArMaxQ3DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArMaxQ3DataPoint.name(), vArMaxQ3DataPoint);
-
-    SunSpecDataPoint vArMaxQ4DataPoint;
-    vArMaxQ4DataPoint.setName("VArMaxQ4");
-    vArMaxQ4DataPoint.setLabel("VArMaxQ4");
-    vArMaxQ4DataPoint.setDescription("Setting for maximum reactive power in quadrant 4. Default to VArRtgQ4.");
-    vArMaxQ4DataPoint.setUnits("var");
-    vArMaxQ4DataPoint.setSize(1);
-    vArMaxQ4DataPoint.setAddressOffset(11);
-    vArMaxQ4DataPoint.setBlockOffset(9);
-    vArMaxQ4DataPoint.setScaleFactorName("VArMax_SF");
-    vArMaxQ4DataPoint.setSunSpecDataType("int16");
-    vArMaxQ4DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vArMaxQ4DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArMaxQ4DataPoint.name(), vArMaxQ4DataPoint);
-
-    SunSpecDataPoint wGraDataPoint;
-    wGraDataPoint.setName("WGra");
-    wGraDataPoint.setLabel("WGra");
-    wGraDataPoint.setDescription("Default ramp rate of change of active power due to command or internal action.");
-    wGraDataPoint.setUnits("% WMax/sec");
-    wGraDataPoint.setSize(1);
-    wGraDataPoint.setAddressOffset(12);
-    wGraDataPoint.setBlockOffset(10);
-    wGraDataPoint.setScaleFactorName("WGra_SF");
-    wGraDataPoint.setSunSpecDataType("uint16");
-    wGraDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    wGraDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wGraDataPoint.name(), wGraDataPoint);
-
-    SunSpecDataPoint pfMinQ1DataPoint;
-    pfMinQ1DataPoint.setName("PFMinQ1");
-    pfMinQ1DataPoint.setLabel("PFMinQ1");
-    pfMinQ1DataPoint.setDescription("Setpoint for minimum power factor value in quadrant 1. Default to PFRtgQ1.");
-    pfMinQ1DataPoint.setUnits("cos()");
-    pfMinQ1DataPoint.setSize(1);
-    pfMinQ1DataPoint.setAddressOffset(13);
-    pfMinQ1DataPoint.setBlockOffset(11);
-    pfMinQ1DataPoint.setScaleFactorName("PFMin_SF");
-    pfMinQ1DataPoint.setSunSpecDataType("int16");
-    pfMinQ1DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    pfMinQ1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pfMinQ1DataPoint.name(), pfMinQ1DataPoint);
-
-    SunSpecDataPoint pfMinQ2DataPoint;
-    pfMinQ2DataPoint.setName("PFMinQ2");
-    pfMinQ2DataPoint.setLabel("PFMinQ2");
-    pfMinQ2DataPoint.setDescription("Setpoint for minimum power factor value in quadrant 2. Default to PFRtgQ2.");
-    pfMinQ2DataPoint.setUnits("cos()");
-    pfMinQ2DataPoint.setSize(1);
-    pfMinQ2DataPoint.setAddressOffset(14);
-    pfMinQ2DataPoint.setBlockOffset(12);
-    pfMinQ2DataPoint.setScaleFactorName("PFMin_SF");
-    pfMinQ2DataPoint.setSunSpecDataType("int16");
-    pfMinQ2DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    pfMinQ2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pfMinQ2DataPoint.name(), pfMinQ2DataPoint);
-
-    SunSpecDataPoint pfMinQ3DataPoint;
-    pfMinQ3DataPoint.setName("PFMinQ3");
-    pfMinQ3DataPoint.setLabel("PFMinQ3");
-    pfMinQ3DataPoint.setDescription("Setpoint for minimum power factor value in quadrant 3. Default to PFRtgQ3.");
-    pfMinQ3DataPoint.setUnits("cos()");
-    pfMinQ3DataPoint.setSize(1);
-    pfMinQ3DataPoint.setAddressOffset(15);
-    pfMinQ3DataPoint.setBlockOffset(13);
-    pfMinQ3DataPoint.setScaleFactorName("PFMin_SF");
-    pfMinQ3DataPoint.setSunSpecDataType("int16");
-    pfMinQ3DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    pfMinQ3DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pfMinQ3DataPoint.name(), pfMinQ3DataPoint);
-
-    SunSpecDataPoint pfMinQ4DataPoint;
-    pfMinQ4DataPoint.setName("PFMinQ4");
-    pfMinQ4DataPoint.setLabel("PFMinQ4");
-    pfMinQ4DataPoint.setDescription("Setpoint for minimum power factor value in quadrant 4. Default to PFRtgQ4.");
-    pfMinQ4DataPoint.setUnits("cos()");
-    pfMinQ4DataPoint.setSize(1);
-    pfMinQ4DataPoint.setAddressOffset(16);
-    pfMinQ4DataPoint.setBlockOffset(14);
-    pfMinQ4DataPoint.setScaleFactorName("PFMin_SF");
-    pfMinQ4DataPoint.setSunSpecDataType("int16");
-    pfMinQ4DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    pfMinQ4DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pfMinQ4DataPoint.name(), pfMinQ4DataPoint);
-
-    SunSpecDataPoint vArActDataPoint;
-    vArActDataPoint.setName("VArAct");
-    vArActDataPoint.setLabel("VArAct");
-    vArActDataPoint.setDescription("VAR action on change between charging and discharging: 1=switch 2=maintain VAR characterization.");
-    vArActDataPoint.setSize(1);
-    vArActDataPoint.setAddressOffset(17);
-    vArActDataPoint.setBlockOffset(15);
-    vArActDataPoint.setSunSpecDataType("enum16");
-    vArActDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vArActDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArActDataPoint.name(), vArActDataPoint);
-
-    SunSpecDataPoint clcTotVaDataPoint;
-    clcTotVaDataPoint.setName("ClcTotVA");
-    clcTotVaDataPoint.setLabel("ClcTotVA");
-    clcTotVaDataPoint.setDescription("Calculation method for total apparent power. 1=vector 2=arithmetic.");
-    clcTotVaDataPoint.setSize(1);
-    clcTotVaDataPoint.setAddressOffset(18);
-    clcTotVaDataPoint.setBlockOffset(16);
-    clcTotVaDataPoint.setSunSpecDataType("enum16");
-    clcTotVaDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    clcTotVaDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(clcTotVaDataPoint.name(), clcTotVaDataPoint);
-
-    SunSpecDataPoint maxRmpRteDataPoint;
-    maxRmpRteDataPoint.setName("MaxRmpRte");
-    maxRmpRteDataPoint.setLabel("MaxRmpRte");
-    maxRmpRteDataPoint.setDescription("Setpoint for maximum ramp rate as percentage of nominal maximum ramp rate. This setting will limit the rate that watts delivery to the grid can increase or decrease in response to intermittent PV generation.");
-    maxRmpRteDataPoint.setUnits("% WGra");
-    maxRmpRteDataPoint.setSize(1);
-    maxRmpRteDataPoint.setAddressOffset(19);
-    maxRmpRteDataPoint.setBlockOffset(17);
-    maxRmpRteDataPoint.setScaleFactorName("MaxRmpRte_SF");
-    maxRmpRteDataPoint.setSunSpecDataType("uint16");
-    maxRmpRteDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    maxRmpRteDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxRmpRteDataPoint.name(), maxRmpRteDataPoint);
-
-    SunSpecDataPoint ecpNomHzDataPoint;
-    ecpNomHzDataPoint.setName("ECPNomHz");
-    ecpNomHzDataPoint.setLabel("ECPNomHz");
-    ecpNomHzDataPoint.setDescription("Setpoint for nominal frequency at the ECP.");
-    ecpNomHzDataPoint.setUnits("Hz");
-    ecpNomHzDataPoint.setSize(1);
-    ecpNomHzDataPoint.setAddressOffset(20);
-    ecpNomHzDataPoint.setBlockOffset(18);
-    ecpNomHzDataPoint.setScaleFactorName("ECPNomHz_SF");
-    ecpNomHzDataPoint.setSunSpecDataType("uint16");
-    ecpNomHzDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    ecpNomHzDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ecpNomHzDataPoint.name(), ecpNomHzDataPoint);
-
-    SunSpecDataPoint connPhDataPoint;
-    connPhDataPoint.setName("ConnPh");
-    connPhDataPoint.setLabel("ConnPh");
-    connPhDataPoint.setDescription("Identity of connected phase for single phase inverters. A=1 B=2 C=3.");
-    connPhDataPoint.setSize(1);
-    connPhDataPoint.setAddressOffset(21);
-    connPhDataPoint.setBlockOffset(19);
-    connPhDataPoint.setSunSpecDataType("enum16");
-    connPhDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    connPhDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(connPhDataPoint.name(), connPhDataPoint);
-
-    SunSpecDataPoint wMaxSfDataPoint;
-    wMaxSfDataPoint.setName("WMax_SF");
-    wMaxSfDataPoint.setLabel("WMax_SF");
-    wMaxSfDataPoint.setDescription("Scale factor for real power.");
-    wMaxSfDataPoint.setMandatory(true);
-    wMaxSfDataPoint.setSize(1);
-    wMaxSfDataPoint.setAddressOffset(22);
-    wMaxSfDataPoint.setBlockOffset(20);
-    wMaxSfDataPoint.setSunSpecDataType("sunssf");
-    wMaxSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wMaxSfDataPoint.name(), wMaxSfDataPoint);
-
-    SunSpecDataPoint vRefSfDataPoint;
-    vRefSfDataPoint.setName("VRef_SF");
-    vRefSfDataPoint.setLabel("VRef_SF");
-    vRefSfDataPoint.setDescription("Scale factor for voltage at the PCC.");
-    vRefSfDataPoint.setMandatory(true);
-    vRefSfDataPoint.setSize(1);
-    vRefSfDataPoint.setAddressOffset(23);
-    vRefSfDataPoint.setBlockOffset(21);
-    vRefSfDataPoint.setSunSpecDataType("sunssf");
-    vRefSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vRefSfDataPoint.name(), vRefSfDataPoint);
-
-    SunSpecDataPoint vRefOfsSfDataPoint;
-    vRefOfsSfDataPoint.setName("VRefOfs_SF");
-    vRefOfsSfDataPoint.setLabel("VRefOfs_SF");
-    vRefOfsSfDataPoint.setDescription("Scale factor for offset voltage.");
-    vRefOfsSfDataPoint.setMandatory(true);
-    vRefOfsSfDataPoint.setSize(1);
-    vRefOfsSfDataPoint.setAddressOffset(24);
-    vRefOfsSfDataPoint.setBlockOffset(22);
-    vRefOfsSfDataPoint.setSunSpecDataType("sunssf");
-    vRefOfsSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vRefOfsSfDataPoint.name(), vRefOfsSfDataPoint);
-
-    SunSpecDataPoint vMinMaxSfDataPoint;
-    vMinMaxSfDataPoint.setName("VMinMax_SF");
-    vMinMaxSfDataPoint.setLabel("VMinMax_SF");
-    vMinMaxSfDataPoint.setDescription("Scale factor for min/max voltages.");
-    vMinMaxSfDataPoint.setSize(1);
-    vMinMaxSfDataPoint.setAddressOffset(25);
-    vMinMaxSfDataPoint.setBlockOffset(23);
-    vMinMaxSfDataPoint.setSunSpecDataType("sunssf");
-    vMinMaxSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vMinMaxSfDataPoint.name(), vMinMaxSfDataPoint);
-
-    SunSpecDataPoint vaMaxSfDataPoint;
-    vaMaxSfDataPoint.setName("VAMax_SF");
-    vaMaxSfDataPoint.setLabel("VAMax_SF");
-    vaMaxSfDataPoint.setDescription("Scale factor for apparent power.");
-    vaMaxSfDataPoint.setSize(1);
-    vaMaxSfDataPoint.setAddressOffset(26);
-    vaMaxSfDataPoint.setBlockOffset(24);
-    vaMaxSfDataPoint.setSunSpecDataType("sunssf");
-    vaMaxSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vaMaxSfDataPoint.name(), vaMaxSfDataPoint);
-
-    SunSpecDataPoint vArMaxSfDataPoint;
-    vArMaxSfDataPoint.setName("VArMax_SF");
-    vArMaxSfDataPoint.setLabel("VArMax_SF");
-    vArMaxSfDataPoint.setDescription("Scale factor for reactive power.");
-    vArMaxSfDataPoint.setSize(1);
-    vArMaxSfDataPoint.setAddressOffset(27);
-    vArMaxSfDataPoint.setBlockOffset(25);
-    vArMaxSfDataPoint.setSunSpecDataType("sunssf");
-    vArMaxSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArMaxSfDataPoint.name(), vArMaxSfDataPoint);
-
-    SunSpecDataPoint wGraSfDataPoint;
-    wGraSfDataPoint.setName("WGra_SF");
-    wGraSfDataPoint.setLabel("WGra_SF");
-    wGraSfDataPoint.setDescription("Scale factor for default ramp rate.");
-    wGraSfDataPoint.setSize(1);
-    wGraSfDataPoint.setAddressOffset(28);
-    wGraSfDataPoint.setBlockOffset(26);
-    wGraSfDataPoint.setSunSpecDataType("sunssf");
-    wGraSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wGraSfDataPoint.name(), wGraSfDataPoint);
-
-    SunSpecDataPoint pfMinSfDataPoint;
-    pfMinSfDataPoint.setName("PFMin_SF");
-    pfMinSfDataPoint.setLabel("PFMin_SF");
-    pfMinSfDataPoint.setDescription("Scale factor for minimum power factor.");
-    pfMinSfDataPoint.setSize(1);
-    pfMinSfDataPoint.setAddressOffset(29);
-    pfMinSfDataPoint.setBlockOffset(27);
-    pfMinSfDataPoint.setSunSpecDataType("sunssf");
-    pfMinSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pfMinSfDataPoint.name(), pfMinSfDataPoint);
-
-    SunSpecDataPoint maxRmpRteSfDataPoint;
-    maxRmpRteSfDataPoint.setName("MaxRmpRte_SF");
-    maxRmpRteSfDataPoint.setLabel("MaxRmpRte_SF");
-    maxRmpRteSfDataPoint.setDescription("Scale factor for maximum ramp percentage.");
-    maxRmpRteSfDataPoint.setSize(1);
-    maxRmpRteSfDataPoint.setAddressOffset(30);
-    maxRmpRteSfDataPoint.setBlockOffset(28);
-    maxRmpRteSfDataPoint.setSunSpecDataType("sunssf");
-    maxRmpRteSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(maxRmpRteSfDataPoint.name(), maxRmpRteSfDataPoint);
-
-    SunSpecDataPoint ecpNomHzSfDataPoint;
-    ecpNomHzSfDataPoint.setName("ECPNomHz_SF");
-    ecpNomHzSfDataPoint.setLabel("ECPNomHz_SF");
-    ecpNomHzSfDataPoint.setDescription("Scale factor for nominal frequency.");
-    ecpNomHzSfDataPoint.setSize(1);
-    ecpNomHzSfDataPoint.setAddressOffset(31);
-    ecpNomHzSfDataPoint.setBlockOffset(29);
-    ecpNomHzSfDataPoint.setSunSpecDataType("sunssf");
-    ecpNomHzSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ecpNomHzSfDataPoint.name(), ecpNomHzSfDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 32;
 }
 
 void SunSpecSettingsModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("WMax_SF").isValid())
-        m_wMaxSf = m_dataPoints.value("WMax_SF").toInt16();
+    if (registerCount >= 23 && SunSpecDataPoint::isValid(registers + 22, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 22, 1);
+        if (scaleFactor != m_wMaxSf) {
+            m_wMaxSf = scaleFactor;
+            m_wMaxSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("VRef_SF").isValid())
-        m_vRefSf = m_dataPoints.value("VRef_SF").toInt16();
+    if (registerCount >= 24 && SunSpecDataPoint::isValid(registers + 23, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 23, 1);
+        if (scaleFactor != m_vRefSf) {
+            m_vRefSf = scaleFactor;
+            m_vRefSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("VRefOfs_SF").isValid())
-        m_vRefOfsSf = m_dataPoints.value("VRefOfs_SF").toInt16();
+    if (registerCount >= 25 && SunSpecDataPoint::isValid(registers + 24, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 24, 1);
+        if (scaleFactor != m_vRefOfsSf) {
+            m_vRefOfsSf = scaleFactor;
+            m_vRefOfsSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("VMinMax_SF").isValid())
-        m_vMinMaxSf = m_dataPoints.value("VMinMax_SF").toInt16();
+    if (registerCount >= 26 && SunSpecDataPoint::isValid(registers + 25, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 25, 1);
+        if (scaleFactor != m_vMinMaxSf) {
+            m_vMinMaxSf = scaleFactor;
+            m_vMinMaxSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("VAMax_SF").isValid())
-        m_vaMaxSf = m_dataPoints.value("VAMax_SF").toInt16();
+    if (registerCount >= 27 && SunSpecDataPoint::isValid(registers + 26, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 26, 1);
+        if (scaleFactor != m_vaMaxSf) {
+            m_vaMaxSf = scaleFactor;
+            m_vaMaxSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("VArMax_SF").isValid())
-        m_vArMaxSf = m_dataPoints.value("VArMax_SF").toInt16();
+    if (registerCount >= 28 && SunSpecDataPoint::isValid(registers + 27, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 27, 1);
+        if (scaleFactor != m_vArMaxSf) {
+            m_vArMaxSf = scaleFactor;
+            m_vArMaxSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("WGra_SF").isValid())
-        m_wGraSf = m_dataPoints.value("WGra_SF").toInt16();
+    if (registerCount >= 29 && SunSpecDataPoint::isValid(registers + 28, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 28, 1);
+        if (scaleFactor != m_wGraSf) {
+            m_wGraSf = scaleFactor;
+            m_wGraSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("PFMin_SF").isValid())
-        m_pfMinSf = m_dataPoints.value("PFMin_SF").toInt16();
+    if (registerCount >= 30 && SunSpecDataPoint::isValid(registers + 29, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 29, 1);
+        if (scaleFactor != m_pfMinSf) {
+            m_pfMinSf = scaleFactor;
+            m_pfMinSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("MaxRmpRte_SF").isValid())
-        m_maxRmpRteSf = m_dataPoints.value("MaxRmpRte_SF").toInt16();
+    if (registerCount >= 31 && SunSpecDataPoint::isValid(registers + 30, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 30, 1);
+        if (scaleFactor != m_maxRmpRteSf) {
+            m_maxRmpRteSf = scaleFactor;
+            m_maxRmpRteSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("ECPNomHz_SF").isValid())
-        m_ecpNomHzSf = m_dataPoints.value("ECPNomHz_SF").toInt16();
+    if (registerCount >= 32 && SunSpecDataPoint::isValid(registers + 31, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 31, 1);
+        if (scaleFactor != m_ecpNomHzSf) {
+            m_ecpNomHzSf = scaleFactor;
+            m_ecpNomHzSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("WMax").isValid())
-        m_wMax = m_dataPoints.value("WMax").toFloatWithSSF(m_wMaxSf);
-
-    if (m_dataPoints.value("VRef").isValid())
-        m_vRef = m_dataPoints.value("VRef").toFloatWithSSF(m_vRefSf);
-
-    if (m_dataPoints.value("VRefOfs").isValid())
-        m_vRefOfs = m_dataPoints.value("VRefOfs").toFloatWithSSF(m_vRefOfsSf);
-
-    if (m_dataPoints.value("VMax").isValid())
-        m_vMax = m_dataPoints.value("VMax").toFloatWithSSF(m_vMinMaxSf);
-
-    if (m_dataPoints.value("VMin").isValid())
-        m_vMin = m_dataPoints.value("VMin").toFloatWithSSF(m_vMinMaxSf);
-
-    if (m_dataPoints.value("VAMax").isValid())
-        m_vaMax = m_dataPoints.value("VAMax").toFloatWithSSF(m_vaMaxSf);
-
-    if (m_dataPoints.value("VArMaxQ1").isValid())
-        m_vArMaxQ1 = m_dataPoints.value("VArMaxQ1").toFloatWithSSF(m_vArMaxSf);
-
-    if (m_dataPoints.value("VArMaxQ2").isValid())
-        m_vArMaxQ2 = m_dataPoints.value("VArMaxQ2").toFloatWithSSF(m_vArMaxSf);
-
-    if (m_dataPoints.value("VArMaxQ3").isValid())
-        m_vArMaxQ3 = m_dataPoints.value("VArMaxQ3").toFloatWithSSF(m_vArMaxSf);
-
-    if (m_dataPoints.value("VArMaxQ4").isValid())
-        m_vArMaxQ4 = m_dataPoints.value("VArMaxQ4").toFloatWithSSF(m_vArMaxSf);
-
-    if (m_dataPoints.value("WGra").isValid())
-        m_wGra = m_dataPoints.value("WGra").toFloatWithSSF(m_wGraSf);
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_wMax = SunSpecDataPoint::convertToUInt16(registers + 2, 1) * m_wMaxSfMultiplier;
 
-    if (m_dataPoints.value("PFMinQ1").isValid())
-        m_pfMinQ1 = m_dataPoints.value("PFMinQ1").toFloatWithSSF(m_pfMinSf);
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_vRef = SunSpecDataPoint::convertToUInt16(registers + 3, 1) * m_vRefSfMultiplier;
 
-    if (m_dataPoints.value("PFMinQ2").isValid())
-        m_pfMinQ2 = m_dataPoints.value("PFMinQ2").toFloatWithSSF(m_pfMinSf);
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_vRefOfs = SunSpecDataPoint::convertToInt16(registers + 4, 1) * m_vRefOfsSfMultiplier;
 
-    if (m_dataPoints.value("PFMinQ3").isValid())
-        m_pfMinQ3 = m_dataPoints.value("PFMinQ3").toFloatWithSSF(m_pfMinSf);
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_vMax = SunSpecDataPoint::convertToUInt16(registers + 5, 1) * m_vMinMaxSfMultiplier;
 
-    if (m_dataPoints.value("PFMinQ4").isValid())
-        m_pfMinQ4 = m_dataPoints.value("PFMinQ4").toFloatWithSSF(m_pfMinSf);
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_vMin = SunSpecDataPoint::convertToUInt16(registers + 6, 1) * m_vMinMaxSfMultiplier;
 
-    if (m_dataPoints.value("VArAct").isValid())
-        m_vArAct = static_cast<Varact>(m_dataPoints.value("VArAct").toUInt16());
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_vaMax = SunSpecDataPoint::convertToUInt16(registers + 7, 1) * m_vaMaxSfMultiplier;
 
-    if (m_dataPoints.value("ClcTotVA").isValid())
-        m_clcTotVa = static_cast<Clctotva>(m_dataPoints.value("ClcTotVA").toUInt16());
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_vArMaxQ1 = SunSpecDataPoint::convertToInt16(registers + 8, 1) * m_vArMaxSfMultiplier;
 
-    if (m_dataPoints.value("MaxRmpRte").isValid())
-        m_maxRmpRte = m_dataPoints.value("MaxRmpRte").toFloatWithSSF(m_maxRmpRteSf);
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_vArMaxQ2 = SunSpecDataPoint::convertToInt16(registers + 9, 1) * m_vArMaxSfMultiplier;
 
-    if (m_dataPoints.value("ECPNomHz").isValid())
-        m_ecpNomHz = m_dataPoints.value("ECPNomHz").toFloatWithSSF(m_ecpNomHzSf);
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_vArMaxQ3 = SunSpecDataPoint::convertToInt16(registers + 10, 1) * m_vArMaxSfMultiplier;
 
-    if (m_dataPoints.value("ConnPh").isValid())
-        m_connPh = static_cast<Connph>(m_dataPoints.value("ConnPh").toUInt16());
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_vArMaxQ4 = SunSpecDataPoint::convertToInt16(registers + 11, 1) * m_vArMaxSfMultiplier;
 
-    if (m_dataPoints.value("WMax_SF").isValid())
-        m_wMaxSf = m_dataPoints.value("WMax_SF").toInt16();
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 12, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_wGra = SunSpecDataPoint::convertToUInt16(registers + 12, 1) * m_wGraSfMultiplier;
 
-    if (m_dataPoints.value("VRef_SF").isValid())
-        m_vRefSf = m_dataPoints.value("VRef_SF").toInt16();
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 13, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_pfMinQ1 = SunSpecDataPoint::convertToInt16(registers + 13, 1) * m_pfMinSfMultiplier;
 
-    if (m_dataPoints.value("VRefOfs_SF").isValid())
-        m_vRefOfsSf = m_dataPoints.value("VRefOfs_SF").toInt16();
+    if (registerCount >= 15 && SunSpecDataPoint::isValid(registers + 14, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_pfMinQ2 = SunSpecDataPoint::convertToInt16(registers + 14, 1) * m_pfMinSfMultiplier;
 
-    if (m_dataPoints.value("VMinMax_SF").isValid())
-        m_vMinMaxSf = m_dataPoints.value("VMinMax_SF").toInt16();
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 15, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_pfMinQ3 = SunSpecDataPoint::convertToInt16(registers + 15, 1) * m_pfMinSfMultiplier;
 
-    if (m_dataPoints.value("VAMax_SF").isValid())
-        m_vaMaxSf = m_dataPoints.value("VAMax_SF").toInt16();
+    if (registerCount >= 17 && SunSpecDataPoint::isValid(registers + 16, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_pfMinQ4 = SunSpecDataPoint::convertToInt16(registers + 16, 1) * m_pfMinSfMultiplier;
 
-    if (m_dataPoints.value("VArMax_SF").isValid())
-        m_vArMaxSf = m_dataPoints.value("VArMax_SF").toInt16();
+    if (registerCount >= 18 && SunSpecDataPoint::isValid(registers + 17, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_vArAct = static_cast<Varact>(SunSpecDataPoint::convertToUInt16(registers + 17, 1));
 
-    if (m_dataPoints.value("WGra_SF").isValid())
-        m_wGraSf = m_dataPoints.value("WGra_SF").toInt16();
+    if (registerCount >= 19 && SunSpecDataPoint::isValid(registers + 18, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_clcTotVa = static_cast<Clctotva>(SunSpecDataPoint::convertToUInt16(registers + 18, 1));
 
-    if (m_dataPoints.value("PFMin_SF").isValid())
-        m_pfMinSf = m_dataPoints.value("PFMin_SF").toInt16();
+    if (registerCount >= 20 && SunSpecDataPoint::isValid(registers + 19, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_maxRmpRte = SunSpecDataPoint::convertToUInt16(registers + 19, 1) * m_maxRmpRteSfMultiplier;
 
-    if (m_dataPoints.value("MaxRmpRte_SF").isValid())
-        m_maxRmpRteSf = m_dataPoints.value("MaxRmpRte_SF").toInt16();
+    if (registerCount >= 21 && SunSpecDataPoint::isValid(registers + 20, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_ecpNomHz = SunSpecDataPoint::convertToUInt16(registers + 20, 1) * m_ecpNomHzSfMultiplier;
 
-    if (m_dataPoints.value("ECPNomHz_SF").isValid())
-        m_ecpNomHzSf = m_dataPoints.value("ECPNomHz_SF").toInt16();
+    if (registerCount >= 22 && SunSpecDataPoint::isValid(registers + 21, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_connPh = static_cast<Connph>(SunSpecDataPoint::convertToUInt16(registers + 21, 1));
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -1007,141 +687,141 @@ void SunSpecSettingsModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecSettingsModel *model)
 {
     debug.nospace().noquote() << "SunSpecSettingsModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WMax") << "-->";
-    if (model->dataPoints().value("WMax").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexWMax) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexWMax).isValid()) {
         debug.nospace().noquote() << model->wMax() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VRef") << "-->";
-    if (model->dataPoints().value("VRef").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexVRef) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexVRef).isValid()) {
         debug.nospace().noquote() << model->vRef() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VRefOfs") << "-->";
-    if (model->dataPoints().value("VRefOfs").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexVRefOfs) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexVRefOfs).isValid()) {
         debug.nospace().noquote() << model->vRefOfs() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VMax") << "-->";
-    if (model->dataPoints().value("VMax").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexVMax) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexVMax).isValid()) {
         debug.nospace().noquote() << model->vMax() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VMin") << "-->";
-    if (model->dataPoints().value("VMin").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexVMin) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexVMin).isValid()) {
         debug.nospace().noquote() << model->vMin() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VAMax") << "-->";
-    if (model->dataPoints().value("VAMax").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexVaMax) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexVaMax).isValid()) {
         debug.nospace().noquote() << model->vaMax() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArMaxQ1") << "-->";
-    if (model->dataPoints().value("VArMaxQ1").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexVArMaxQ1) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexVArMaxQ1).isValid()) {
         debug.nospace().noquote() << model->vArMaxQ1() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArMaxQ2") << "-->";
-    if (model->dataPoints().value("VArMaxQ2").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexVArMaxQ2) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexVArMaxQ2).isValid()) {
         debug.nospace().noquote() << model->vArMaxQ2() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArMaxQ3") << "-->";
-    if (model->dataPoints().value("VArMaxQ3").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexVArMaxQ3) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexVArMaxQ3).isValid()) {
         debug.nospace().noquote() << model->vArMaxQ3() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArMaxQ4") << "-->";
-    if (model->dataPoints().value("VArMaxQ4").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexVArMaxQ4) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexVArMaxQ4).isValid()) {
         debug.nospace().noquote() << model->vArMaxQ4() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WGra") << "-->";
-    if (model->dataPoints().value("WGra").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexWGra) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexWGra).isValid()) {
         debug.nospace().noquote() << model->wGra() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("PFMinQ1") << "-->";
-    if (model->dataPoints().value("PFMinQ1").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexPfMinQ1) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexPfMinQ1).isValid()) {
         debug.nospace().noquote() << model->pfMinQ1() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("PFMinQ2") << "-->";
-    if (model->dataPoints().value("PFMinQ2").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexPfMinQ2) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexPfMinQ2).isValid()) {
         debug.nospace().noquote() << model->pfMinQ2() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("PFMinQ3") << "-->";
-    if (model->dataPoints().value("PFMinQ3").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexPfMinQ3) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexPfMinQ3).isValid()) {
         debug.nospace().noquote() << model->pfMinQ3() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("PFMinQ4") << "-->";
-    if (model->dataPoints().value("PFMinQ4").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexPfMinQ4) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexPfMinQ4).isValid()) {
         debug.nospace().noquote() << model->pfMinQ4() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArAct") << "-->";
-    if (model->dataPoints().value("VArAct").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexVArAct) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexVArAct).isValid()) {
         debug.nospace().noquote() << model->vArAct() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ClcTotVA") << "-->";
-    if (model->dataPoints().value("ClcTotVA").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexClcTotVa) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexClcTotVa).isValid()) {
         debug.nospace().noquote() << model->clcTotVa() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("MaxRmpRte") << "-->";
-    if (model->dataPoints().value("MaxRmpRte").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexMaxRmpRte) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexMaxRmpRte).isValid()) {
         debug.nospace().noquote() << model->maxRmpRte() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ECPNomHz") << "-->";
-    if (model->dataPoints().value("ECPNomHz").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexEcpNomHz) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexEcpNomHz).isValid()) {
         debug.nospace().noquote() << model->ecpNomHz() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ConnPh") << "-->";
-    if (model->dataPoints().value("ConnPh").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSettingsModel::DataPointIndexConnPh) << "-->";
+    if (model->dataPoint(SunSpecSettingsModel::DataPointIndexConnPh).isValid()) {
         debug.nospace().noquote() << model->connPh() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
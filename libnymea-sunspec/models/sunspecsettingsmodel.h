@@ -61,6 +61,41 @@ public:
     };
     Q_ENUM(Connph)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexWMax,
+        DataPointIndexVRef,
+        DataPointIndexVRefOfs,
+        DataPointIndexVMax,
+        DataPointIndexVMin,
+        DataPointIndexVaMax,
+        DataPointIndexVArMaxQ1,
+        DataPointIndexVArMaxQ2,
+        DataPointIndexVArMaxQ3,
+        DataPointIndexVArMaxQ4,
+        DataPointIndexWGra,
+        DataPointIndexPfMinQ1,
+        DataPointIndexPfMinQ2,
+        DataPointIndexPfMinQ3,
+        DataPointIndexPfMinQ4,
+        DataPointIndexVArAct,
+        DataPointIndexClcTotVa,
+        DataPointIndexMaxRmpRte,
+        DataPointIndexEcpNomHz,
+        DataPointIndexConnPh,
+        DataPointIndexWMaxSf,
+        DataPointIndexVRefSf,
+        DataPointIndexVRefOfsSf,
+        DataPointIndexVMinMaxSf,
+        DataPointIndexVaMaxSf,
+        DataPointIndexVArMaxSf,
+        DataPointIndexWGraSf,
+        DataPointIndexPfMinSf,
+        DataPointIndexMaxRmpRteSf,
+        DataPointIndexEcpNomHzSf
+    };
+
     explicit SunSpecSettingsModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecSettingsModel() override; 
 
@@ -198,15 +233,25 @@ private:
     float m_ecpNomHz = 0;
     Connph m_connPh;
     qint16 m_wMaxSf = 0;
+    double m_wMaxSfMultiplier = 1;
     qint16 m_vRefSf = 0;
+    double m_vRefSfMultiplier = 1;
     qint16 m_vRefOfsSf = 0;
+    double m_vRefOfsSfMultiplier = 1;
     qint16 m_vMinMaxSf = 0;
+    double m_vMinMaxSfMultiplier = 1;
     qint16 m_vaMaxSf = 0;
+    double m_vaMaxSfMultiplier = 1;
     qint16 m_vArMaxSf = 0;
+    double m_vArMaxSfMultiplier = 1;
     qint16 m_wGraSf = 0;
+    double m_wGraSfMultiplier = 1;
     qint16 m_pfMinSf = 0;
+    double m_pfMinSfMultiplier = 1;
     qint16 m_maxRmpRteSf = 0;
+    double m_maxRmpRteSfMultiplier = 1;
     qint16 m_ecpNomHzSf = 0;
+    double m_ecpNomHzSfMultiplier = 1;
 
 
 };
@@ -31,6 +31,55 @@
 #include "sunspecsolarmodulemodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexA_SF
+    { "A_SF", nullptr, "Current scale factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 2, 0, 1 },
+    // DataPointIndexV_SF
+    { "V_SF", nullptr, "Voltage scale factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 3, 1, 1 },
+    // DataPointIndexW_SF
+    { "W_SF", nullptr, "Power scale factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 4, 2, 1 },
+    // DataPointIndexWh_SF
+    { "Wh_SF", nullptr, "Energy scale factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 5, 3, 1 },
+    // DataPointIndexStatus
+    { "Stat", "Status", "Enumerated value.  Module Status Code", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, true, 6, 4, 1 },
+    // DataPointIndexVendorStatus
+    { "StatVend", "Vendor Status", "Module Vendor Status Code", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, false, 7, 5, 1 },
+    // DataPointIndexEvents
+    { "Evt", "Events", "Bitmask value.  Module Event Flags", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, true, 8, 6, 2 },
+    // DataPointIndexVendorModuleEventFlags
+    { "EvtVend", "Vendor Module Event Flags", "Vendor specific flags", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 10, 8, 2 },
+    // DataPointIndexControl
+    { "Ctl", "Control", "Module Control", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, false, 12, 10, 1 },
+    // DataPointIndexVendorControl
+    { "CtlVend", "Vendor Control", "Vendor Module Control", nullptr, nullptr, "enum32", nullptr, SunSpecDataPoint::Enum32, SunSpecDataPoint::AccessReadWrite, false, 13, 11, 2 },
+    // DataPointIndexControlValue
+    { "CtlVal", "Control Value", "Module Control Value", nullptr, nullptr, "int32", nullptr, SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 15, 13, 2 },
+    // DataPointIndexTimestamp
+    { "Tms", "Timestamp", "Time in seconds since 2000 epoch", nullptr, "Secs", "uint32", nullptr, SunSpecDataPoint::UInt32, SunSpecDataPoint::AccessReadOnly, false, 17, 15, 2 },
+    // DataPointIndexOutputCurrent
+    { "OutA", "Output Current", "Output Current", nullptr, "A", "int16", "A_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 19, 17, 1 },
+    // DataPointIndexOutputVoltage
+    { "OutV", "Output Voltage", "Output Voltage", nullptr, "V", "int16", "V_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 20, 18, 1 },
+    // DataPointIndexOutputEnergy
+    { "OutWh", "Output Energy", "Output Energy", nullptr, "Wh", "acc32", "Wh_SF", SunSpecDataPoint::Acc32, SunSpecDataPoint::AccessReadOnly, false, 21, 19, 2 },
+    // DataPointIndexOutputPower
+    { "OutPw", "Output Power", "Output Power", nullptr, "W", "int16", "W_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 23, 21, 1 },
+    // DataPointIndexTemp
+    { "Tmp", "Temp", "Module Temperature", nullptr, "C", "int16", nullptr, SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 24, 22, 1 },
+    // DataPointIndexInputCurrent
+    { "InA", "Input Current", "Input Current", nullptr, "A", "int16", "A_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 25, 23, 1 },
+    // DataPointIndexInputVoltage
+    { "InV", "Input Voltage", "Input Voltage", nullptr, "V", "int16", "V_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 26, 24, 1 },
+    // DataPointIndexInputEnergy
+    { "InWh", "Input Energy", "Input Energy", nullptr, "Wh", "acc32", "Wh_SF", SunSpecDataPoint::Acc32, SunSpecDataPoint::AccessReadOnly, false, 27, 25, 2 },
+    // DataPointIndexInputPower
+    { "InW", "Input Power", "Input Power", nullptr, "W", "int16", "W_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 29, 27, 1 }
+};
+
 SunSpecSolarModuleModel::SunSpecSolarModuleModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 502, modelLength, byteOrder, parent)
 {
@@ -101,7 +150,7 @@ QModbusReply *SunSpecSolarModuleModel::setControl(quint16 control)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("Ctl");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexControl]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(control));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -119,7 +168,7 @@ QModbusReply *SunSpecSolarModuleModel::setVendorControl(quint32 vendorControl)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("CtlVend");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVendorControl]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt32(static_cast<quint32>(vendorControl));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -137,7 +186,7 @@ QModbusReply *SunSpecSolarModuleModel::setControlValue(qint32 controlValue)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("CtlVal");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexControlValue]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(controlValue);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -187,359 +236,100 @@ float SunSpecSolarModuleModel::inputPower() const
 }
 void SunSpecSolarModuleModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint a_SFDataPoint;
-    a_SFDataPoint.setName("A_SF");
-    a_SFDataPoint.setDescription("Current scale factor");
-    a_SFDataPoint.setSize(1);
-    a_SFDataPoint.setAddressOffset(2);
-    a_SFDataPoint.setBlockOffset(0);
-    a_SFDataPoint.setSunSpecDataType("sunssf");
-    a_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(a_SFDataPoint.name(), a_SFDataPoint);
-
-    SunSpecDataPoint v_SFDataPoint;
-    v_SFDataPoint.setName("V_SF");
-    v_SFDataPoint.setDescription("Voltage scale factor");
-    v_SFDataPoint.setSize(1);
-    v_SFDataPoint.setAddressOffset(3);
-    v_SFDataPoint.setBlockOffset(1);
-    v_SFDataPoint.setSunSpecDataType("sunssf");
-    v_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v_SFDataPoint.name(), v_SFDataPoint);
-
-    SunSpecDataPoint w_SFDataPoint;
-    w_SFDataPoint.setName("W_SF");
-    w_SFDataPoint.setDescription("Power scale factor");
-    w_SFDataPoint.setSize(1);
-    w_SFDataPoint.setAddressOffset(4);
-    w_SFDataPoint.setBlockOffset(2);
-    w_SFDataPoint.setSunSpecDataType("sunssf");
-    w_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w_SFDataPoint.name(), w_SFDataPoint);
-
-    SunSpecDataPoint wh_SFDataPoint;
-    wh_SFDataPoint.setName("Wh_SF");
-    wh_SFDataPoint.setDescription("Energy scale factor");
-    wh_SFDataPoint.setSize(1);
-    wh_SFDataPoint.setAddressOffset(5);
-    wh_SFDataPoint.setBlockOffset(3);
-    wh_SFDataPoint.setSunSpecDataType("sunssf");
-    wh_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wh_SFDataPoint.name(), wh_SFDataPoint);
-
-    SunSpecDataPoint statusDataPoint;
-    statusDataPoint.setName("Stat");
-    statusDataPoint.setLabel("Status");
-    statusDataPoint.setDescription("Enumerated value.  Module Status Code");
-    statusDataPoint.setMandatory(true);
-    statusDataPoint.setSize(1);
-    statusDataPoint.setAddressOffset(6);
-    statusDataPoint.setBlockOffset(4);
-    statusDataPoint.setSunSpecDataType("enum16");
-    statusDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(statusDataPoint.name(), statusDataPoint);
-
-    SunSpecDataPoint vendorStatusDataPoint;
-    vendorStatusDataPoint.setName("StatVend");
-    vendorStatusDataPoint.setLabel("Vendor Status");
-    vendorStatusDataPoint.setDescription("Module Vendor Status Code");
-    vendorStatusDataPoint.setSize(1);
-    vendorStatusDataPoint.setAddressOffset(7);
-    vendorStatusDataPoint.setBlockOffset(5);
-    vendorStatusDataPoint.setSunSpecDataType("enum16");
-    vendorStatusDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vendorStatusDataPoint.name(), vendorStatusDataPoint);
-
-    SunSpecDataPoint eventsDataPoint;
-    eventsDataPoint.setName("Evt");
-    eventsDataPoint.setLabel("Events");
-    eventsDataPoint.setDescription("Bitmask value.  Module Event Flags");
-    eventsDataPoint.setMandatory(true);
-    eventsDataPoint.setSize(2);
-    eventsDataPoint.setAddressOffset(8);
-    eventsDataPoint.setBlockOffset(6);
-    eventsDataPoint.setSunSpecDataType("bitfield32");
-    eventsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(eventsDataPoint.name(), eventsDataPoint);
-
-    SunSpecDataPoint vendorModuleEventFlagsDataPoint;
-    vendorModuleEventFlagsDataPoint.setName("EvtVend");
-    vendorModuleEventFlagsDataPoint.setLabel("Vendor Module Event Flags");
-    vendorModuleEventFlagsDataPoint.setDescription("Vendor specific flags");
-    vendorModuleEventFlagsDataPoint.setSize(2);
-    vendorModuleEventFlagsDataPoint.setAddressOffset(10);
-    vendorModuleEventFlagsDataPoint.setBlockOffset(8);
-    vendorModuleEventFlagsDataPoint.setSunSpecDataType("bitfield32");
-    vendorModuleEventFlagsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vendorModuleEventFlagsDataPoint.name(), vendorModuleEventFlagsDataPoint);
-
-    SunSpecDataPoint controlDataPoint;
-    controlDataPoint.setName("Ctl");
-    controlDataPoint.setLabel("Control");
-    controlDataPoint.setDescription("Module Control");
-    controlDataPoint.setSize(1);
-    controlDataPoint.setAddressOffset(12);
-    controlDataPoint.setBlockOffset(10);
-    controlDataPoint.setSunSpecDataType("enum16");
-    controlDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    controlDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(controlDataPoint.name(), controlDataPoint);
-
-    SunSpecDataPoint vendorControlDataPoint;
-    vendorControlDataPoint.setName("CtlVend");
-    vendorControlDataPoint.setLabel("Vendor Control");
-    vendorControlDataPoint.setDescription("Vendor Module Control");
-    vendorControlDataPoint.setSize(2);
-    vendorControlDataPoint.setAddressOffset(13);
-    vendorControlDataPoint.setBlockOffset(11);
-    vendorControlDataPoint.setSunSpecDataType("enum32");
-    vendorControlDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vendorControlDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vendorControlDataPoint.name(), vendorControlDataPoint);
-
-    SunSpecDataPoint controlValueDataPoint;
-    controlValueDataPoint.setName("CtlVal");
-    controlValueDataPoint.setLabel("Control Value");
-    controlValueDataPoint.setDescription("Module Control Value");
-    controlValueDataPoint.setSize(2);
-    controlValueDataPoint.setAddressOffset(15);
-    controlValueDataPoint.setBlockOffset(13);
-    controlValueDataPoint.setSunSpecDataType("int32");
-    controlValueDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    controlValueDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(controlValueDataPoint.name(), controlValueDataPoint);
-
-    SunSpecDataPoint timestampDataPoint;
-    timestampDataPoint.setName("Tms");
-    timestampDataPoint.setLabel("Timestamp");
-    timestampDataPoint.setDescription("Time in seconds since 2000 epoch");
-    timestampDataPoint.setUnits("Secs");
-    timestampDataPoint.setSize(2);
-    timestampDataPoint.setAddressOffset(17);
-    timestampDataPoint.setBlockOffset(15);
-    timestampDataPoint.setSunSpecDataType("uint32");
-    timestampDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(timestampDataPoint.name(), timestampDataPoint);
-
-    SunSpecDataPoint outputCurrentDataPoint;
-    outputCurrentDataPoint.setName("OutA");
-    outputCurrentDataPoint.setLabel("Output Current");
-    outputCurrentDataPoint.setDescription("Output Current");
-    outputCurrentDataPoint.setUnits("A");
-    outputCurrentDataPoint.setSize(1);
-    outputCurrentDataPoint.setAddressOffset(19);
-    outputCurrentDataPoint.setBlockOffset(17);
-    outputCurrentDataPoint.setScaleFactorName("A_SF");
-    outputCurrentDataPoint.setSunSpecDataType("int16");
-    outputCurrentDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(outputCurrentDataPoint.name(), outputCurrentDataPoint);
-
-    SunSpecDataPoint outputVoltageDataPoint;
-    outputVoltageDataPoint.setName("OutV");
-    outputVoltageDataPoint.setLabel("Output Voltage");
-    outputVoltageDataPoint.setDescription("Output Voltage");
-    outputVoltageDataPoint.setUnits("V");
-    outputVoltageDataPoint.setSize(1);
-    outputVoltageDataPoint.setAddressOffset(20);
-    outputVoltageDataPoint.setBlockOffset(18);
-    outputVoltageDataPoint.setScaleFactorName("V_SF");
-    outputVoltageDataPoint.setSunSpecDataType("int16");
-    outputVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(outputVoltageDataPoint.name(), outputVoltageDataPoint);
-
-    SunSpecDataPoint outputEnergyDataPoint;
-    outputEnergyDataPoint.setName("OutWh");
-    outputEnergyDataPoint.setLabel("Output Energy");
-    outputEnergyDataPoint.setDescription("Output Energy");
-    outputEnergyDataPoint.setUnits("Wh");
-    outputEnergyDataPoint.setSize(2);
-    outputEnergyDataPoint.setAddressOffset(21);
-    outputEnergyDataPoint.setBlockOffset(19);
-    outputEnergyDataPoint.setScaleFactorName("Wh_SF");
-    outputEnergyDataPoint.setSunSpecDataType("acc32");
-    outputEnergyDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(outputEnergyDataPoint.name(), outputEnergyDataPoint);
-
-    SunSpecDataPoint outputPowerDataPoint;
-    outputPowerDataPoint.setName("OutPw");
-    outputPowerDataPoint.setLabel("Output Power");
-    outputPowerDataPoint.setDescription("Output Power");
-    outputPowerDataPoint.setUnits("W");
-    outputPowerDataPoint.setSize(1);
-    outputPowerDataPoint.setAddressOffset(23);
-    outputPowerDataPoint.setBlockOffset(21);
-    outputPowerDataPoint.setScaleFactorName("W_SF");
-    outputPowerDataPoint.setSunSpecDataType("int16");
-    outputPowerDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(outputPowerDataPoint.name(), outputPowerDataPoint);
-
-    SunSpecDataPoint tempDataPoint;
-    tempDataPoint.setName("Tmp");
-    tempDataPoint.setLabel("Temp");
-    tempDataPoint.setDescription("Module Temperature");
-    tempDataPoint.setUnits("C");
-    tempDataPoint.setSize(1);
-    tempDataPoint.setAddressOffset(24);
-    tempDataPoint.setBlockOffset(22);
-    tempDataPoint.setSunSpecDataType("int16");
-    tempDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tempDataPoint.name(), tempDataPoint);
-
-    SunSpecDataPoint inputCurrentDataPoint;
-    inputCurrentDataPoint.setName("InA");
-    inputCurrentDataPoint.setLabel("Input Current");
-    inputCurrentDataPoint.setDescription("Input Current");
-    inputCurrentDataPoint.setUnits("A");
-    inputCurrentDataPoint.setSize(1);
-    inputCurrentDataPoint.setAddressOffset(25);
-    inputCurrentDataPoint.setBlockOffset(23);
-    inputCurrentDataPoint.setScaleFactorName("A_SF");
-    inputCurrentDataPoint.setSunSpecDataType("int16");
-    inputCurrentDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inputCurrentDataPoint.name(), inputCurrentDataPoint);
-
-    SunSpecDataPoint inputVoltageDataPoint;
-    inputVoltageDataPoint.setName("InV");
-    inputVoltageDataPoint.setLabel("Input Voltage");
-    inputVoltageDataPoint.setDescription("Input Voltage");
-    inputVoltageDataPoint.setUnits("V");
-    inputVoltageDataPoint.setSize(1);
-    inputVoltageDataPoint.setAddressOffset(26);
-    inputVoltageDataPoint.setBlockOffset(24);
-    inputVoltageDataPoint.setScaleFactorName("V_SF");
-    inputVoltageDataPoint.setSunSpecDataType("int16");
-    inputVoltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inputVoltageDataPoint.name(), inputVoltageDataPoint);
-
-    SunSpecDataPoint inputEnergyDataPoint;
-    inputEnergyDataPoint.setName("InWh");
-    inputEnergyDataPoint.setLabel("Input Energy");
-    inputEnergyDataPoint.setDescription("Input Energy");
-    inputEnergyDataPoint.setUnits("Wh");
-    inputEnergyDataPoint.setSize(2);
-    inputEnergyDataPoint.setAddressOffset(27);
-    inputEnergyDataPoint.setBlockOffset(25);
-    inputEnergyDataPoint.setScaleFactorName("Wh_SF");
-    inputEnergyDataPoint.setSunSpecDataType("acc32");
-    inputEnergyDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inputEnergyDataPoint.name(), inputEnergyDataPoint);
-
-    SunSpecDataPoint inputPowerDataPoint;
-    inputPowerDataPoint.setName("InW");
-    inputPowerDataPoint.setLabel("Input Power");
-    inputPowerDataPoint.setDescription("Input Power");
-    inputPowerDataPoint.setUnits("W");
-    inputPowerDataPoint.setSize(1);
-    inputPowerDataPoint.setAddressOffset(29);
-    inputPowerDataPoint.setBlockOffset(27);
-    inputPowerDataPoint.setScaleFactorName("W_SF");
-    inputPowerDataPoint.setSunSpecDataType("int16");
-    inputPowerDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inputPowerDataPoint.name(), inputPowerDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 23;
 }
 
 void SunSpecSolarModuleModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("A_SF").isValid())
-        m_a_SF = m_dataPoints.value("A_SF").toInt16();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 2, 1);
+        if (scaleFactor != m_a_SF) {
+            m_a_SF = scaleFactor;
+            m_a_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("V_SF").isValid())
-        m_v_SF = m_dataPoints.value("V_SF").toInt16();
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 3, 1);
+        if (scaleFactor != m_v_SF) {
+            m_v_SF = scaleFactor;
+            m_v_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("W_SF").isValid())
-        m_w_SF = m_dataPoints.value("W_SF").toInt16();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 4, 1);
+        if (scaleFactor != m_w_SF) {
+            m_w_SF = scaleFactor;
+            m_w_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("Wh_SF").isValid())
-        m_wh_SF = m_dataPoints.value("Wh_SF").toInt16();
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 5, 1);
+        if (scaleFactor != m_wh_SF) {
+            m_wh_SF = scaleFactor;
+            m_wh_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("A_SF").isValid())
-        m_a_SF = m_dataPoints.value("A_SF").toInt16();
-
-    if (m_dataPoints.value("V_SF").isValid())
-        m_v_SF = m_dataPoints.value("V_SF").toInt16();
-
-    if (m_dataPoints.value("W_SF").isValid())
-        m_w_SF = m_dataPoints.value("W_SF").toInt16();
-
-    if (m_dataPoints.value("Wh_SF").isValid())
-        m_wh_SF = m_dataPoints.value("Wh_SF").toInt16();
-
-    if (m_dataPoints.value("Stat").isValid())
-        m_status = static_cast<Stat>(m_dataPoints.value("Stat").toUInt16());
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_status = static_cast<Stat>(SunSpecDataPoint::convertToUInt16(registers + 6, 1));
 
-    if (m_dataPoints.value("StatVend").isValid())
-        m_vendorStatus = m_dataPoints.value("StatVend").toUInt16();
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_vendorStatus = SunSpecDataPoint::convertToUInt16(registers + 7, 1);
 
-    if (m_dataPoints.value("Evt").isValid())
-        m_events = static_cast<EvtFlags>(m_dataPoints.value("Evt").toUInt32());
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 8, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_events = static_cast<EvtFlags>(SunSpecDataPoint::convertToUInt32(registers + 8, 2, m_byteOrder));
 
-    if (m_dataPoints.value("EvtVend").isValid())
-        m_vendorModuleEventFlags = m_dataPoints.value("EvtVend").toUInt32();
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 10, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_vendorModuleEventFlags = SunSpecDataPoint::convertToUInt32(registers + 10, 2, m_byteOrder);
 
-    if (m_dataPoints.value("Ctl").isValid())
-        m_control = m_dataPoints.value("Ctl").toUInt16();
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 12, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_control = SunSpecDataPoint::convertToUInt16(registers + 12, 1);
 
-    if (m_dataPoints.value("CtlVend").isValid())
-        m_vendorControl = m_dataPoints.value("CtlVend").toUInt32();
+    if (registerCount >= 15 && SunSpecDataPoint::isValid(registers + 13, 2, SunSpecDataPoint::Enum32, m_byteOrder))
+        m_vendorControl = SunSpecDataPoint::convertToUInt32(registers + 13, 2, m_byteOrder);
 
-    if (m_dataPoints.value("CtlVal").isValid())
-        m_controlValue = m_dataPoints.value("CtlVal").toInt32();
+    if (registerCount >= 17 && SunSpecDataPoint::isValid(registers + 15, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_controlValue = SunSpecDataPoint::convertToInt32(registers + 15, 2, m_byteOrder);
 
-    if (m_dataPoints.value("Tms").isValid())
-        m_timestamp = m_dataPoints.value("Tms").toUInt32();
+    if (registerCount >= 19 && SunSpecDataPoint::isValid(registers + 17, 2, SunSpecDataPoint::UInt32, m_byteOrder))
+        m_timestamp = SunSpecDataPoint::convertToUInt32(registers + 17, 2, m_byteOrder);
 
-    if (m_dataPoints.value("OutA").isValid())
-        m_outputCurrent = m_dataPoints.value("OutA").toFloatWithSSF(m_a_SF);
+    if (registerCount >= 20 && SunSpecDataPoint::isValid(registers + 19, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_outputCurrent = SunSpecDataPoint::convertToInt16(registers + 19, 1) * m_a_SFMultiplier;
 
-    if (m_dataPoints.value("OutV").isValid())
-        m_outputVoltage = m_dataPoints.value("OutV").toFloatWithSSF(m_v_SF);
+    if (registerCount >= 21 && SunSpecDataPoint::isValid(registers + 20, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_outputVoltage = SunSpecDataPoint::convertToInt16(registers + 20, 1) * m_v_SFMultiplier;
 
-    if (m_dataPoints.value("OutWh").isValid())
-        m_outputEnergy = m_dataPoints.value("OutWh").toFloatWithSSF(m_wh_SF);
+    if (registerCount >= 23 && SunSpecDataPoint::isValid(registers + 21, 2, SunSpecDataPoint::Acc32, m_byteOrder))
+        m_outputEnergy = SunSpecDataPoint::convertToUInt32(registers + 21, 2, m_byteOrder) * m_wh_SFMultiplier;
 
-    if (m_dataPoints.value("OutPw").isValid())
-        m_outputPower = m_dataPoints.value("OutPw").toFloatWithSSF(m_w_SF);
+    if (registerCount >= 24 && SunSpecDataPoint::isValid(registers + 23, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_outputPower = SunSpecDataPoint::convertToInt16(registers + 23, 1) * m_w_SFMultiplier;
 
-    if (m_dataPoints.value("Tmp").isValid())
-        m_temp = m_dataPoints.value("Tmp").toInt16();
+    if (registerCount >= 25 && SunSpecDataPoint::isValid(registers + 24, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_temp = SunSpecDataPoint::convertToInt16(registers + 24, 1);
 
-    if (m_dataPoints.value("InA").isValid())
-        m_inputCurrent = m_dataPoints.value("InA").toFloatWithSSF(m_a_SF);
+    if (registerCount >= 26 && SunSpecDataPoint::isValid(registers + 25, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_inputCurrent = SunSpecDataPoint::convertToInt16(registers + 25, 1) * m_a_SFMultiplier;
 
-    if (m_dataPoints.value("InV").isValid())
-        m_inputVoltage = m_dataPoints.value("InV").toFloatWithSSF(m_v_SF);
+    if (registerCount >= 27 && SunSpecDataPoint::isValid(registers + 26, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_inputVoltage = SunSpecDataPoint::convertToInt16(registers + 26, 1) * m_v_SFMultiplier;
 
-    if (m_dataPoints.value("InWh").isValid())
-        m_inputEnergy = m_dataPoints.value("InWh").toFloatWithSSF(m_wh_SF);
+    if (registerCount >= 29 && SunSpecDataPoint::isValid(registers + 27, 2, SunSpecDataPoint::Acc32, m_byteOrder))
+        m_inputEnergy = SunSpecDataPoint::convertToUInt32(registers + 27, 2, m_byteOrder) * m_wh_SFMultiplier;
 
-    if (m_dataPoints.value("InW").isValid())
-        m_inputPower = m_dataPoints.value("InW").toFloatWithSSF(m_w_SF);
+    if (registerCount >= 30 && SunSpecDataPoint::isValid(registers + 29, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_inputPower = SunSpecDataPoint::convertToInt16(registers + 29, 1) * m_w_SFMultiplier;
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -548,120 +338,120 @@ void SunSpecSolarModuleModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecSolarModuleModel *model)
 {
     debug.nospace().noquote() << "SunSpecSolarModuleModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Stat") << "-->";
-    if (model->dataPoints().value("Stat").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexStatus) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexStatus).isValid()) {
         debug.nospace().noquote() << model->status() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StatVend") << "-->";
-    if (model->dataPoints().value("StatVend").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexVendorStatus) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexVendorStatus).isValid()) {
         debug.nospace().noquote() << model->vendorStatus() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Evt") << "-->";
-    if (model->dataPoints().value("Evt").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexEvents) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexEvents).isValid()) {
         debug.nospace().noquote() << model->events() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("EvtVend") << "-->";
-    if (model->dataPoints().value("EvtVend").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexVendorModuleEventFlags) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexVendorModuleEventFlags).isValid()) {
         debug.nospace().noquote() << model->vendorModuleEventFlags() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Ctl") << "-->";
-    if (model->dataPoints().value("Ctl").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexControl) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexControl).isValid()) {
         debug.nospace().noquote() << model->control() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CtlVend") << "-->";
-    if (model->dataPoints().value("CtlVend").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexVendorControl) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexVendorControl).isValid()) {
         debug.nospace().noquote() << model->vendorControl() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("CtlVal") << "-->";
-    if (model->dataPoints().value("CtlVal").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexControlValue) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexControlValue).isValid()) {
         debug.nospace().noquote() << model->controlValue() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Tms") << "-->";
-    if (model->dataPoints().value("Tms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexTimestamp) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexTimestamp).isValid()) {
         debug.nospace().noquote() << model->timestamp() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("OutA") << "-->";
-    if (model->dataPoints().value("OutA").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexOutputCurrent) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexOutputCurrent).isValid()) {
         debug.nospace().noquote() << model->outputCurrent() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("OutV") << "-->";
-    if (model->dataPoints().value("OutV").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexOutputVoltage) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexOutputVoltage).isValid()) {
         debug.nospace().noquote() << model->outputVoltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("OutWh") << "-->";
-    if (model->dataPoints().value("OutWh").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexOutputEnergy) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexOutputEnergy).isValid()) {
         debug.nospace().noquote() << model->outputEnergy() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("OutPw") << "-->";
-    if (model->dataPoints().value("OutPw").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexOutputPower) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexOutputPower).isValid()) {
         debug.nospace().noquote() << model->outputPower() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Tmp") << "-->";
-    if (model->dataPoints().value("Tmp").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexTemp) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexTemp).isValid()) {
         debug.nospace().noquote() << model->temp() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("InA") << "-->";
-    if (model->dataPoints().value("InA").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexInputCurrent) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexInputCurrent).isValid()) {
         debug.nospace().noquote() << model->inputCurrent() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("InV") << "-->";
-    if (model->dataPoints().value("InV").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexInputVoltage) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexInputVoltage).isValid()) {
         debug.nospace().noquote() << model->inputVoltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("InWh") << "-->";
-    if (model->dataPoints().value("InWh").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexInputEnergy) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexInputEnergy).isValid()) {
         debug.nospace().noquote() << model->inputEnergy() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("InW") << "-->";
-    if (model->dataPoints().value("InW").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecSolarModuleModel::DataPointIndexInputPower) << "-->";
+    if (model->dataPoint(SunSpecSolarModuleModel::DataPointIndexInputPower).isValid()) {
         debug.nospace().noquote() << model->inputPower() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
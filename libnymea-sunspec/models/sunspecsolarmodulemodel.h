@@ -82,6 +82,32 @@ public:
     Q_DECLARE_FLAGS(EvtFlags, Evt)
     Q_FLAG(Evt)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexA_SF,
+        DataPointIndexV_SF,
+        DataPointIndexW_SF,
+        DataPointIndexWh_SF,
+        DataPointIndexStatus,
+        DataPointIndexVendorStatus,
+        DataPointIndexEvents,
+        DataPointIndexVendorModuleEventFlags,
+        DataPointIndexControl,
+        DataPointIndexVendorControl,
+        DataPointIndexControlValue,
+        DataPointIndexTimestamp,
+        DataPointIndexOutputCurrent,
+        DataPointIndexOutputVoltage,
+        DataPointIndexOutputEnergy,
+        DataPointIndexOutputPower,
+        DataPointIndexTemp,
+        DataPointIndexInputCurrent,
+        DataPointIndexInputVoltage,
+        DataPointIndexInputEnergy,
+        DataPointIndexInputPower
+    };
+
     explicit SunSpecSolarModuleModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecSolarModuleModel() override; 
 
@@ -147,9 +173,13 @@ protected:
 
 private:
     qint16 m_a_SF = 0;
+    double m_a_SFMultiplier = 1;
     qint16 m_v_SF = 0;
+    double m_v_SFMultiplier = 1;
     qint16 m_w_SF = 0;
+    double m_w_SFMultiplier = 1;
     qint16 m_wh_SF = 0;
+    double m_wh_SFMultiplier = 1;
     Stat m_status;
     quint16 m_vendorStatus = 0;
     EvtFlags m_events;
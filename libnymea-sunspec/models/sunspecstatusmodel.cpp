@@ -31,6 +31,53 @@
 #include "sunspecstatusmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexPvConn
+    { "PVConn", "PVConn", "PV inverter present/available status. Enumerated value.", nullptr, nullptr, "bitfield16", nullptr, SunSpecDataPoint::BitField16, SunSpecDataPoint::AccessReadOnly, true, 2, 0, 1 },
+    // DataPointIndexStorConn
+    { "StorConn", "StorConn", "Storage inverter present/available status. Enumerated value.", nullptr, nullptr, "bitfield16", nullptr, SunSpecDataPoint::BitField16, SunSpecDataPoint::AccessReadOnly, true, 3, 1, 1 },
+    // DataPointIndexEcpConn
+    { "ECPConn", "ECPConn", "ECP connection status: disconnected=0  connected=1.", nullptr, nullptr, "bitfield16", nullptr, SunSpecDataPoint::BitField16, SunSpecDataPoint::AccessReadOnly, true, 4, 2, 1 },
+    // DataPointIndexActWh
+    { "ActWh", "ActWh", "AC lifetime active (real) energy output.", nullptr, "Wh", "acc64", nullptr, SunSpecDataPoint::Acc64, SunSpecDataPoint::AccessReadOnly, false, 5, 3, 4 },
+    // DataPointIndexActVAh
+    { "ActVAh", "ActVAh", "AC lifetime apparent energy output.", nullptr, "VAh", "acc64", nullptr, SunSpecDataPoint::Acc64, SunSpecDataPoint::AccessReadOnly, false, 9, 7, 4 },
+    // DataPointIndexActVArhQ1
+    { "ActVArhQ1", "ActVArhQ1", "AC lifetime reactive energy output in quadrant 1.", nullptr, "varh", "acc64", nullptr, SunSpecDataPoint::Acc64, SunSpecDataPoint::AccessReadOnly, false, 13, 11, 4 },
+    // DataPointIndexActVArhQ2
+    { "ActVArhQ2", "ActVArhQ2", "AC lifetime reactive energy output in quadrant 2.", nullptr, "varh", "acc64", nullptr, SunSpecDataPoint::Acc64, SunSpecDataPoint::AccessReadOnly, false, 17, 15, 4 },
+    // DataPointIndexActVArhQ3
+    { "ActVArhQ3", "ActVArhQ3", "AC lifetime negative energy output  in quadrant 3.", nullptr, "varh", "acc64", nullptr, SunSpecDataPoint::Acc64, SunSpecDataPoint::AccessReadOnly, false, 21, 19, 4 },
+    // DataPointIndexActVArhQ4
+    { "ActVArhQ4", "ActVArhQ4", "AC lifetime reactive energy output  in quadrant 4.", nullptr, "varh", "acc64", nullptr, SunSpecDataPoint::Acc64, SunSpecDataPoint::AccessReadOnly, false, 25, 23, 4 },
+    // DataPointIndexVArAval
+    { "VArAval", "VArAval", "Amount of VARs available without impacting watts output.", nullptr, "var", "int16", "VArAval_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 29, 27, 1 },
+    // DataPointIndexVArAvalSf
+    { "VArAval_SF", "VArAval_SF", "Scale factor for available VARs.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 30, 28, 1 },
+    // DataPointIndexWAval
+    { "WAval", "WAval", "Amount of Watts available.", nullptr, "var", "uint16", "WAval_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 31, 29, 1 },
+    // DataPointIndexWAvalSf
+    { "WAval_SF", "WAval_SF", "Scale factor for available Watts.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 32, 30, 1 },
+    // DataPointIndexStSetLimMsk
+    { "StSetLimMsk", "StSetLimMsk", "Bit Mask indicating setpoint limit(s) reached.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 33, 31, 2 },
+    // DataPointIndexStActCtl
+    { "StActCtl", "StActCtl", "Bit Mask indicating which inverter controls are currently active.", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 35, 33, 2 },
+    // DataPointIndexTmSrc
+    { "TmSrc", "TmSrc", "Source of time synchronization.", nullptr, nullptr, "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadOnly, false, 37, 35, 4 },
+    // DataPointIndexTms
+    { "Tms", "Tms", "Seconds since 01-01-2000 00:00 UTC", nullptr, "Secs", "uint32", nullptr, SunSpecDataPoint::UInt32, SunSpecDataPoint::AccessReadOnly, false, 41, 39, 2 },
+    // DataPointIndexRtSt
+    { "RtSt", "RtSt", "Bit Mask indicating active ride-through status.", nullptr, nullptr, "bitfield16", nullptr, SunSpecDataPoint::BitField16, SunSpecDataPoint::AccessReadOnly, false, 43, 41, 1 },
+    // DataPointIndexRis
+    { "Ris", "Ris", "Isolation resistance.", nullptr, "ohms", "uint16", "Ris_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 44, 42, 1 },
+    // DataPointIndexRisSf
+    { "Ris_SF", "Ris_SF", "Scale factor for isolation resistance.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 45, 43, 1 }
+};
+
 SunSpecStatusModel::SunSpecStatusModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 122, modelLength, byteOrder, parent)
 {
@@ -141,339 +188,92 @@ qint16 SunSpecStatusModel::risSf() const
 }
 void SunSpecStatusModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint pvConnDataPoint;
-    pvConnDataPoint.setName("PVConn");
-    pvConnDataPoint.setLabel("PVConn");
-    pvConnDataPoint.setDescription("PV inverter present/available status. Enumerated value.");
-    pvConnDataPoint.setMandatory(true);
-    pvConnDataPoint.setSize(1);
-    pvConnDataPoint.setAddressOffset(2);
-    pvConnDataPoint.setBlockOffset(0);
-    pvConnDataPoint.setSunSpecDataType("bitfield16");
-    pvConnDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(pvConnDataPoint.name(), pvConnDataPoint);
-
-    SunSpecDataPoint storConnDataPoint;
-    storConnDataPoint.setName("StorConn");
-    storConnDataPoint.setLabel("StorConn");
-    storConnDataPoint.setDescription("Storage inverter present/available status. Enumerated value.");
-    storConnDataPoint.setMandatory(true);
-    storConnDataPoint.setSize(1);
-    storConnDataPoint.setAddressOffset(3);
-    storConnDataPoint.setBlockOffset(1);
-    storConnDataPoint.setSunSpecDataType("bitfield16");
-    storConnDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(storConnDataPoint.name(), storConnDataPoint);
-
-    SunSpecDataPoint ecpConnDataPoint;
-    ecpConnDataPoint.setName("ECPConn");
-    ecpConnDataPoint.setLabel("ECPConn");
-    ecpConnDataPoint.setDescription("ECP connection status: disconnected=0  connected=1.");
-    ecpConnDataPoint.setMandatory(true);
-    ecpConnDataPoint.setSize(1);
-    ecpConnDataPoint.setAddressOffset(4);
-    ecpConnDataPoint.setBlockOffset(2);
-    ecpConnDataPoint.setSunSpecDataType("bitfield16");
-    ecpConnDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ecpConnDataPoint.name(), ecpConnDataPoint);
-
-    SunSpecDataPoint actWhDataPoint;
-    actWhDataPoint.setName("ActWh");
-    actWhDataPoint.setLabel("ActWh");
-    actWhDataPoint.setDescription("AC lifetime active (real) energy output.");
-    actWhDataPoint.setUnits("Wh");
-    actWhDataPoint.setSize(4);
-    actWhDataPoint.setAddressOffset(5);
-    actWhDataPoint.setBlockOffset(3);
-    actWhDataPoint.setSunSpecDataType("acc64");
-    actWhDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(actWhDataPoint.name(), actWhDataPoint);
-
-    SunSpecDataPoint actVAhDataPoint;
-    actVAhDataPoint.setName("ActVAh");
-    actVAhDataPoint.setLabel("ActVAh");
-    actVAhDataPoint.setDescription("AC lifetime apparent energy output.");
-    actVAhDataPoint.setUnits("VAh");
-    actVAhDataPoint.setSize(4);
-    actVAhDataPoint.setAddressOffset(9);
-    actVAhDataPoint.setBlockOffset(7);
-    actVAhDataPoint.setSunSpecDataType("acc64");
-    actVAhDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(actVAhDataPoint.name(), actVAhDataPoint);
-
-    SunSpecDataPoint actVArhQ1DataPoint;
-    actVArhQ1DataPoint.setName("ActVArhQ1");
-    actVArhQ1DataPoint.setLabel("ActVArhQ1");
-    actVArhQ1DataPoint.setDescription("AC lifetime reactive energy output in quadrant 1.");
-    actVArhQ1DataPoint.setUnits("varh");
-    actVArhQ1DataPoint.setSize(4);
-    actVArhQ1DataPoint.setAddressOffset(13);
-    actVArhQ1DataPoint.setBlockOffset(11);
-    actVArhQ1DataPoint.setSunSpecDataType("acc64");
-    actVArhQ1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(actVArhQ1DataPoint.name(), actVArhQ1DataPoint);
-
-    SunSpecDataPoint actVArhQ2DataPoint;
-    actVArhQ2DataPoint.setName("ActVArhQ2");
-    actVArhQ2DataPoint.setLabel("ActVArhQ2");
-    actVArhQ2DataPoint.setDescription("AC lifetime reactive energy output in quadrant 2.");
-    actVArhQ2DataPoint.setUnits("varh");
-    actVArhQ2DataPoint.setSize(4);
-    actVArhQ2DataPoint.setAddressOffset(17);
-    actVArhQ2DataPoint.setBlockOffset(15);
-    actVArhQ2DataPoint.setSunSpecDataType("acc64");
-    actVArhQ2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(actVArhQ2DataPoint.name(), actVArhQ2DataPoint);
-
-    SunSpecDataPoint actVArhQ3DataPoint;
-    actVArhQ3DataPoint.setName("ActVArhQ3");
-    actVArhQ3DataPoint.setLabel("ActVArhQ3");
-    actVArhQ3DataPoint.setDescription("AC lifetime negative energy output  in quadrant 3.");
-    actVArhQ3DataPoint.setUnits("varh");
-    actVArhQ3DataPoint.setSize(4);
-    actVArhQ3DataPoint.setAddressOffset(21);
-    actVArhQ3DataPoint.setBlockOffset(19);
-    actVArhQ3DataPoint.setSunSpecDataType("acc64");
-    actVArhQ3DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(actVArhQ3DataPoint.name(), actVArhQ3DataPoint);
-
-    SunSpecDataPoint actVArhQ4DataPoint;
-    actVArhQ4DataPoint.setName("ActVArhQ4");
-    actVArhQ4DataPoint.setLabel("ActVArhQ4");
-    actVArhQ4DataPoint.setDescription("AC lifetime reactive energy output  in quadrant 4.");
-    actVArhQ4DataPoint.setUnits("varh");
-    actVArhQ4DataPoint.setSize(4);
-    actVArhQ4DataPoint.setAddressOffset(25);
-    actVArhQ4DataPoint.setBlockOffset(23);
-    actVArhQ4DataPoint.setSunSpecDataType("acc64");
-    actVArhQ4DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(actVArhQ4DataPoint.name(), actVArhQ4DataPoint);
-
-    SunSpecDataPoint vArAvalDataPoint;
-    vArAvalDataPoint.setName("VArAval");
-    vArAvalDataPoint.setLabel("VArAval");
-    vArAvalDataPoint.setDescription("Amount of VARs available without impacting watts output.");
-    vArAvalDataPoint.setUnits("var");
-    vArAvalDataPoint.setSize(1);
-    vArAvalDataPoint.setAddressOffset(29);
-    vArAvalDataPoint.setBlockOffset(27);
-    vArAvalDataPoint.setScaleFactorName("VArAval_SF");
-    vArAvalDataPoint.setSunSpecDataType("int16");
-    vArAvalDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArAvalDataPoint.name(), vArAvalDataPoint);
-
-    SunSpecDataPoint vArAvalSfDataPoint;
-    vArAvalSfDataPoint.setName("VArAval_SF");
-    vArAvalSfDataPoint.setLabel("VArAval_SF");
-    vArAvalSfDataPoint.setDescription("Scale factor for available VARs.");
-    vArAvalSfDataPoint.setSize(1);
-    vArAvalSfDataPoint.setAddressOffset(30);
-    vArAvalSfDataPoint.setBlockOffset(28);
-    vArAvalSfDataPoint.setSunSpecDataType("sunssf");
-    vArAvalSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vArAvalSfDataPoint.name(), vArAvalSfDataPoint);
-
-    SunSpecDataPoint wAvalDataPoint;
-    wAvalDataPoint.setName("WAval");
-    wAvalDataPoint.setLabel("WAval");
-    wAvalDataPoint.setDescription("Amount of Watts available.");
-    wAvalDataPoint.setUnits("var");
-    wAvalDataPoint.setSize(1);
-    wAvalDataPoint.setAddressOffset(31);
-    wAvalDataPoint.setBlockOffset(29);
-    wAvalDataPoint.setScaleFactorName("WAval_SF");
-    wAvalDataPoint.setSunSpecDataType("uint16");
-    wAvalDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wAvalDataPoint.name(), wAvalDataPoint);
-
-    SunSpecDataPoint wAvalSfDataPoint;
-    wAvalSfDataPoint.setName("WAval_SF");
-    wAvalSfDataPoint.setLabel("WAval_SF");
-    wAvalSfDataPoint.setDescription("Scale factor for available Watts.");
-    wAvalSfDataPoint.setSize(1);
-    wAvalSfDataPoint.setAddressOffset(32);
-    wAvalSfDataPoint.setBlockOffset(30);
-    wAvalSfDataPoint.setSunSpecDataType("sunssf");
-    wAvalSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wAvalSfDataPoint.name(), wAvalSfDataPoint);
-
-    SunSpecDataPoint stSetLimMskDataPoint;
-    stSetLimMskDataPoint.setName("StSetLimMsk");
-    stSetLimMskDataPoint.setLabel("StSetLimMsk");
-    stSetLimMskDataPoint.setDescription("Bit Mask indicating setpoint limit(s) reached.");
-    stSetLimMskDataPoint.setSize(2);
-    stSetLimMskDataPoint.setAddressOffset(33);
-    stSetLimMskDataPoint.setBlockOffset(31);
-    stSetLimMskDataPoint.setSunSpecDataType("bitfield32");
-    stSetLimMskDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stSetLimMskDataPoint.name(), stSetLimMskDataPoint);
-
-    SunSpecDataPoint stActCtlDataPoint;
-    stActCtlDataPoint.setName("StActCtl");
-    stActCtlDataPoint.setLabel("StActCtl");
-    stActCtlDataPoint.setDescription("Bit Mask indicating which inverter controls are currently active.");
-    stActCtlDataPoint.setSize(2);
-    stActCtlDataPoint.setAddressOffset(35);
-    stActCtlDataPoint.setBlockOffset(33);
-    stActCtlDataPoint.setSunSpecDataType("bitfield32");
-    stActCtlDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(stActCtlDataPoint.name(), stActCtlDataPoint);
-
-    SunSpecDataPoint tmSrcDataPoint;
-    tmSrcDataPoint.setName("TmSrc");
-    tmSrcDataPoint.setLabel("TmSrc");
-    tmSrcDataPoint.setDescription("Source of time synchronization.");
-    tmSrcDataPoint.setSize(4);
-    tmSrcDataPoint.setAddressOffset(37);
-    tmSrcDataPoint.setBlockOffset(35);
-    tmSrcDataPoint.setSunSpecDataType("string");
-    tmSrcDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tmSrcDataPoint.name(), tmSrcDataPoint);
-
-    SunSpecDataPoint tmsDataPoint;
-    tmsDataPoint.setName("Tms");
-    tmsDataPoint.setLabel("Tms");
-    tmsDataPoint.setDescription("Seconds since 01-01-2000 00:00 UTC");
-    tmsDataPoint.setUnits("Secs");
-    tmsDataPoint.setSize(2);
-    tmsDataPoint.setAddressOffset(41);
-    tmsDataPoint.setBlockOffset(39);
-    tmsDataPoint.setSunSpecDataType("uint32");
-    tmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tmsDataPoint.name(), tmsDataPoint);
-
-    SunSpecDataPoint rtStDataPoint;
-    rtStDataPoint.setName("RtSt");
-    rtStDataPoint.setLabel("RtSt");
-    rtStDataPoint.setDescription("Bit Mask indicating active ride-through status.");
-    rtStDataPoint.setSize(1);
-    rtStDataPoint.setAddressOffset(43);
-    rtStDataPoint.setBlockOffset(41);
-    rtStDataPoint.setSunSpecDataType("bitfield16");
-    rtStDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rtStDataPoint.name(), rtStDataPoint);
-
-    SunSpecDataPoint risDataPoint;
-    risDataPoint.setName("Ris");
-    risDataPoint.setLabel("Ris");
-    risDataPoint.setDescription("Isolation resistance.");
-    risDataPoint.setUnits("ohms");
-    risDataPoint.setSize(1);
-    risDataPoint.setAddressOffset(44);
-    risDataPoint.setBlockOffset(42);
-    risDataPoint.setScaleFactorName("Ris_SF");
-    risDataPoint.setSunSpecDataType("uint16");
-    risDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(risDataPoint.name(), risDataPoint);
-
-    SunSpecDataPoint risSfDataPoint;
-    risSfDataPoint.setName("Ris_SF");
-    risSfDataPoint.setLabel("Ris_SF");
-    risSfDataPoint.setDescription("Scale factor for isolation resistance.");
-    risSfDataPoint.setSize(1);
-    risSfDataPoint.setAddressOffset(45);
-    risSfDataPoint.setBlockOffset(43);
-    risSfDataPoint.setSunSpecDataType("sunssf");
-    risSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(risSfDataPoint.name(), risSfDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 22;
 }
 
 void SunSpecStatusModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("VArAval_SF").isValid())
-        m_vArAvalSf = m_dataPoints.value("VArAval_SF").toInt16();
+    if (registerCount >= 31 && SunSpecDataPoint::isValid(registers + 30, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 30, 1);
+        if (scaleFactor != m_vArAvalSf) {
+            m_vArAvalSf = scaleFactor;
+            m_vArAvalSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("WAval_SF").isValid())
-        m_wAvalSf = m_dataPoints.value("WAval_SF").toInt16();
+    if (registerCount >= 33 && SunSpecDataPoint::isValid(registers + 32, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 32, 1);
+        if (scaleFactor != m_wAvalSf) {
+            m_wAvalSf = scaleFactor;
+            m_wAvalSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("Ris_SF").isValid())
-        m_risSf = m_dataPoints.value("Ris_SF").toInt16();
+    if (registerCount >= 46 && SunSpecDataPoint::isValid(registers + 45, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 45, 1);
+        if (scaleFactor != m_risSf) {
+            m_risSf = scaleFactor;
+            m_risSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("PVConn").isValid())
-        m_pvConn = static_cast<PvconnFlags>(m_dataPoints.value("PVConn").toUInt16());
-
-    if (m_dataPoints.value("StorConn").isValid())
-        m_storConn = static_cast<StorconnFlags>(m_dataPoints.value("StorConn").toUInt16());
-
-    if (m_dataPoints.value("ECPConn").isValid())
-        m_ecpConn = static_cast<EcpconnFlags>(m_dataPoints.value("ECPConn").toUInt16());
-
-    if (m_dataPoints.value("ActWh").isValid())
-        m_actWh = m_dataPoints.value("ActWh").toInt64();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::BitField16, m_byteOrder))
+        m_pvConn = static_cast<PvconnFlags>(SunSpecDataPoint::convertToUInt16(registers + 2, 1));
 
-    if (m_dataPoints.value("ActVAh").isValid())
-        m_actVAh = m_dataPoints.value("ActVAh").toInt64();
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::BitField16, m_byteOrder))
+        m_storConn = static_cast<StorconnFlags>(SunSpecDataPoint::convertToUInt16(registers + 3, 1));
 
-    if (m_dataPoints.value("ActVArhQ1").isValid())
-        m_actVArhQ1 = m_dataPoints.value("ActVArhQ1").toInt64();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::BitField16, m_byteOrder))
+        m_ecpConn = static_cast<EcpconnFlags>(SunSpecDataPoint::convertToUInt16(registers + 4, 1));
 
-    if (m_dataPoints.value("ActVArhQ2").isValid())
-        m_actVArhQ2 = m_dataPoints.value("ActVArhQ2").toInt64();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 5, 4, SunSpecDataPoint::Acc64, m_byteOrder))
+        m_actWh = SunSpecDataPoint::convertToInt64(registers + 5, 4, m_byteOrder);
 
-    if (m_dataPoints.value("ActVArhQ3").isValid())
-        m_actVArhQ3 = m_dataPoints.value("ActVArhQ3").toInt64();
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 9, 4, SunSpecDataPoint::Acc64, m_byteOrder))
+        m_actVAh = SunSpecDataPoint::convertToInt64(registers + 9, 4, m_byteOrder);
 
-    if (m_dataPoints.value("ActVArhQ4").isValid())
-        m_actVArhQ4 = m_dataPoints.value("ActVArhQ4").toInt64();
+    if (registerCount >= 17 && SunSpecDataPoint::isValid(registers + 13, 4, SunSpecDataPoint::Acc64, m_byteOrder))
+        m_actVArhQ1 = SunSpecDataPoint::convertToInt64(registers + 13, 4, m_byteOrder);
 
-    if (m_dataPoints.value("VArAval").isValid())
-        m_vArAval = m_dataPoints.value("VArAval").toFloatWithSSF(m_vArAvalSf);
+    if (registerCount >= 21 && SunSpecDataPoint::isValid(registers + 17, 4, SunSpecDataPoint::Acc64, m_byteOrder))
+        m_actVArhQ2 = SunSpecDataPoint::convertToInt64(registers + 17, 4, m_byteOrder);
 
-    if (m_dataPoints.value("VArAval_SF").isValid())
-        m_vArAvalSf = m_dataPoints.value("VArAval_SF").toInt16();
+    if (registerCount >= 25 && SunSpecDataPoint::isValid(registers + 21, 4, SunSpecDataPoint::Acc64, m_byteOrder))
+        m_actVArhQ3 = SunSpecDataPoint::convertToInt64(registers + 21, 4, m_byteOrder);
 
-    if (m_dataPoints.value("WAval").isValid())
-        m_wAval = m_dataPoints.value("WAval").toFloatWithSSF(m_wAvalSf);
+    if (registerCount >= 29 && SunSpecDataPoint::isValid(registers + 25, 4, SunSpecDataPoint::Acc64, m_byteOrder))
+        m_actVArhQ4 = SunSpecDataPoint::convertToInt64(registers + 25, 4, m_byteOrder);
 
-    if (m_dataPoints.value("WAval_SF").isValid())
-        m_wAvalSf = m_dataPoints.value("WAval_SF").toInt16();
+    if (registerCount >= 30 && SunSpecDataPoint::isValid(registers + 29, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_vArAval = SunSpecDataPoint::convertToInt16(registers + 29, 1) * m_vArAvalSfMultiplier;
 
-    if (m_dataPoints.value("StSetLimMsk").isValid())
-        m_stSetLimMsk = static_cast<StsetlimmskFlags>(m_dataPoints.value("StSetLimMsk").toUInt32());
+    if (registerCount >= 32 && SunSpecDataPoint::isValid(registers + 31, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_wAval = SunSpecDataPoint::convertToUInt16(registers + 31, 1) * m_wAvalSfMultiplier;
 
-    if (m_dataPoints.value("StActCtl").isValid())
-        m_stActCtl = static_cast<StactctlFlags>(m_dataPoints.value("StActCtl").toUInt32());
+    if (registerCount >= 35 && SunSpecDataPoint::isValid(registers + 33, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_stSetLimMsk = static_cast<StsetlimmskFlags>(SunSpecDataPoint::convertToUInt32(registers + 33, 2, m_byteOrder));
 
-    if (m_dataPoints.value("TmSrc").isValid())
-        m_tmSrc = m_dataPoints.value("TmSrc").toString();
+    if (registerCount >= 37 && SunSpecDataPoint::isValid(registers + 35, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_stActCtl = static_cast<StactctlFlags>(SunSpecDataPoint::convertToUInt32(registers + 35, 2, m_byteOrder));
 
-    if (m_dataPoints.value("Tms").isValid())
-        m_tms = m_dataPoints.value("Tms").toUInt32();
+    if (registerCount >= 41 && SunSpecDataPoint::isValid(registers + 37, 4, SunSpecDataPoint::String, m_byteOrder))
+        m_tmSrc = SunSpecDataPoint::convertToString(registers + 37, 4);
 
-    if (m_dataPoints.value("RtSt").isValid())
-        m_rtSt = static_cast<RtstFlags>(m_dataPoints.value("RtSt").toUInt16());
+    if (registerCount >= 43 && SunSpecDataPoint::isValid(registers + 41, 2, SunSpecDataPoint::UInt32, m_byteOrder))
+        m_tms = SunSpecDataPoint::convertToUInt32(registers + 41, 2, m_byteOrder);
 
-    if (m_dataPoints.value("Ris").isValid())
-        m_ris = m_dataPoints.value("Ris").toFloatWithSSF(m_risSf);
+    if (registerCount >= 44 && SunSpecDataPoint::isValid(registers + 43, 1, SunSpecDataPoint::BitField16, m_byteOrder))
+        m_rtSt = static_cast<RtstFlags>(SunSpecDataPoint::convertToUInt16(registers + 43, 1));
 
-    if (m_dataPoints.value("Ris_SF").isValid())
-        m_risSf = m_dataPoints.value("Ris_SF").toInt16();
+    if (registerCount >= 45 && SunSpecDataPoint::isValid(registers + 44, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_ris = SunSpecDataPoint::convertToUInt16(registers + 44, 1) * m_risSfMultiplier;
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -482,120 +282,120 @@ void SunSpecStatusModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecStatusModel *model)
 {
     debug.nospace().noquote() << "SunSpecStatusModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("PVConn") << "-->";
-    if (model->dataPoints().value("PVConn").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexPvConn) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexPvConn).isValid()) {
         debug.nospace().noquote() << model->pvConn() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StorConn") << "-->";
-    if (model->dataPoints().value("StorConn").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexStorConn) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexStorConn).isValid()) {
         debug.nospace().noquote() << model->storConn() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ECPConn") << "-->";
-    if (model->dataPoints().value("ECPConn").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexEcpConn) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexEcpConn).isValid()) {
         debug.nospace().noquote() << model->ecpConn() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ActWh") << "-->";
-    if (model->dataPoints().value("ActWh").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexActWh) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexActWh).isValid()) {
         debug.nospace().noquote() << model->actWh() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ActVAh") << "-->";
-    if (model->dataPoints().value("ActVAh").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexActVAh) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexActVAh).isValid()) {
         debug.nospace().noquote() << model->actVAh() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ActVArhQ1") << "-->";
-    if (model->dataPoints().value("ActVArhQ1").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexActVArhQ1) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexActVArhQ1).isValid()) {
         debug.nospace().noquote() << model->actVArhQ1() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ActVArhQ2") << "-->";
-    if (model->dataPoints().value("ActVArhQ2").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexActVArhQ2) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexActVArhQ2).isValid()) {
         debug.nospace().noquote() << model->actVArhQ2() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ActVArhQ3") << "-->";
-    if (model->dataPoints().value("ActVArhQ3").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexActVArhQ3) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexActVArhQ3).isValid()) {
         debug.nospace().noquote() << model->actVArhQ3() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ActVArhQ4") << "-->";
-    if (model->dataPoints().value("ActVArhQ4").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexActVArhQ4) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexActVArhQ4).isValid()) {
         debug.nospace().noquote() << model->actVArhQ4() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VArAval") << "-->";
-    if (model->dataPoints().value("VArAval").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexVArAval) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexVArAval).isValid()) {
         debug.nospace().noquote() << model->vArAval() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WAval") << "-->";
-    if (model->dataPoints().value("WAval").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexWAval) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexWAval).isValid()) {
         debug.nospace().noquote() << model->wAval() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StSetLimMsk") << "-->";
-    if (model->dataPoints().value("StSetLimMsk").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexStSetLimMsk) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexStSetLimMsk).isValid()) {
         debug.nospace().noquote() << model->stSetLimMsk() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StActCtl") << "-->";
-    if (model->dataPoints().value("StActCtl").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexStActCtl) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexStActCtl).isValid()) {
         debug.nospace().noquote() << model->stActCtl() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("TmSrc") << "-->";
-    if (model->dataPoints().value("TmSrc").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexTmSrc) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexTmSrc).isValid()) {
         debug.nospace().noquote() << model->tmSrc() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Tms") << "-->";
-    if (model->dataPoints().value("Tms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexTms) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexTms).isValid()) {
         debug.nospace().noquote() << model->tms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("RtSt") << "-->";
-    if (model->dataPoints().value("RtSt").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexRtSt) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexRtSt).isValid()) {
         debug.nospace().noquote() << model->rtSt() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Ris") << "-->";
-    if (model->dataPoints().value("Ris").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStatusModel::DataPointIndexRis) << "-->";
+    if (model->dataPoint(SunSpecStatusModel::DataPointIndexRis).isValid()) {
         debug.nospace().noquote() << model->ris() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
@@ -110,6 +110,31 @@ public:
     Q_DECLARE_FLAGS(RtstFlags, Rtst)
     Q_FLAG(Rtst)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexPvConn,
+        DataPointIndexStorConn,
+        DataPointIndexEcpConn,
+        DataPointIndexActWh,
+        DataPointIndexActVAh,
+        DataPointIndexActVArhQ1,
+        DataPointIndexActVArhQ2,
+        DataPointIndexActVArhQ3,
+        DataPointIndexActVArhQ4,
+        DataPointIndexVArAval,
+        DataPointIndexVArAvalSf,
+        DataPointIndexWAval,
+        DataPointIndexWAvalSf,
+        DataPointIndexStSetLimMsk,
+        DataPointIndexStActCtl,
+        DataPointIndexTmSrc,
+        DataPointIndexTms,
+        DataPointIndexRtSt,
+        DataPointIndexRis,
+        DataPointIndexRisSf
+    };
+
     explicit SunSpecStatusModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecStatusModel() override; 
 
@@ -176,8 +201,10 @@ private:
     quint64 m_actVArhQ4 = 0;
     float m_vArAval = 0;
     qint16 m_vArAvalSf = 0;
+    double m_vArAvalSfMultiplier = 1;
     float m_wAval = 0;
     qint16 m_wAvalSf = 0;
+    double m_wAvalSfMultiplier = 1;
     StsetlimmskFlags m_stSetLimMsk;
     StactctlFlags m_stActCtl;
     QString m_tmSrc;
@@ -185,6 +212,7 @@ private:
     RtstFlags m_rtSt;
     float m_ris = 0;
     qint16 m_risSf = 0;
+    double m_risSfMultiplier = 1;
 
 
 };
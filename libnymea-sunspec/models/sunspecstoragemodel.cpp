@@ -31,6 +31,61 @@
 #include "sunspecstoragemodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexWChaMax
+    { "WChaMax", "WChaMax", "Setpoint for maximum charge.", nullptr, "W", "uint16", "WChaMax_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 2, 0, 1 },
+    // DataPointIndexWChaGra
+    { "WChaGra", "WChaGra", "Setpoint for maximum charging rate. Default is MaxChaRte.", nullptr, "% WChaMax/sec", "uint16", "WChaDisChaGra_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 3, 1, 1 },
+    // DataPointIndexWDisChaGra
+    { "WDisChaGra", "WDisChaGra", "Setpoint for maximum discharge rate. Default is MaxDisChaRte.", nullptr, "% WChaMax/sec", "uint16", "WChaDisChaGra_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 4, 2, 1 },
+    // DataPointIndexStorCtlMod
+    { "StorCtl_Mod", "StorCtl_Mod", "Activate hold/discharge/charge storage control mode. Bitfield value.", nullptr, nullptr, "bitfield16", nullptr, SunSpecDataPoint::BitField16, SunSpecDataPoint::AccessReadWrite, true, 5, 3, 1 },
+    // DataPointIndexVaChaMax
+    { "VAChaMax", "VAChaMax", "Setpoint for maximum charging VA.", nullptr, "VA", "uint16", "VAChaMax_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 6, 4, 1 },
+    // DataPointIndexMinRsvPct
+    { "MinRsvPct", "MinRsvPct", "Setpoint for minimum reserve for storage as a percentage of the nominal maximum storage.", nullptr, "% WChaMax", "uint16", "MinRsvPct_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 7, 5, 1 },
+    // DataPointIndexChaState
+    { "ChaState", "ChaState", "Currently available energy as a percent of the capacity rating.", nullptr, "% AhrRtg", "uint16", "ChaState_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 8, 6, 1 },
+    // DataPointIndexStorAval
+    { "StorAval", "StorAval", "State of charge (ChaState) minus storage reserve (MinRsvPct) times capacity rating (AhrRtg).", nullptr, "AH", "uint16", "StorAval_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 9, 7, 1 },
+    // DataPointIndexInBatV
+    { "InBatV", "InBatV", "Internal battery voltage.", nullptr, "V", "uint16", "InBatV_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 10, 8, 1 },
+    // DataPointIndexChaSt
+    { "ChaSt", "ChaSt", "Charge status of storage device. Enumerated value.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, false, 11, 9, 1 },
+    // DataPointIndexOutWRte
+    { "OutWRte", "OutWRte", "Percent of max discharge rate.", nullptr, "% WDisChaMax", "int16", "InOutWRte_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 12, 10, 1 },
+    // DataPointIndexInWRte
+    { "InWRte", "InWRte", "Percent of max charging rate.", nullptr, " % WChaMax", "int16", "InOutWRte_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 13, 11, 1 },
+    // DataPointIndexInOutWRteWinTms
+    { "InOutWRte_WinTms", "InOutWRte_WinTms", "Time window for charge/discharge rate change.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 14, 12, 1 },
+    // DataPointIndexInOutWRteRvrtTms
+    { "InOutWRte_RvrtTms", "InOutWRte_RvrtTms", "Timeout period for charge/discharge rate.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 15, 13, 1 },
+    // DataPointIndexInOutWRteRmpTms
+    { "InOutWRte_RmpTms", "InOutWRte_RmpTms", "Ramp time for moving from current setpoint to new setpoint.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 16, 14, 1 },
+    // DataPointIndexChaGriSet
+    { "ChaGriSet", nullptr, nullptr, nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, false, 17, 15, 1 },
+    // DataPointIndexWChaMaxSf
+    { "WChaMax_SF", "WChaMax_SF", "Scale factor for maximum charge.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 18, 16, 1 },
+    // DataPointIndexWChaDisChaGraSf
+    { "WChaDisChaGra_SF", "WChaDisChaGra_SF", "Scale factor for maximum charge and discharge rate.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 19, 17, 1 },
+    // DataPointIndexVaChaMaxSf
+    { "VAChaMax_SF", "VAChaMax_SF", "Scale factor for maximum charging VA.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 20, 18, 1 },
+    // DataPointIndexMinRsvPctSf
+    { "MinRsvPct_SF", "MinRsvPct_SF", "Scale factor for minimum reserve percentage.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 21, 19, 1 },
+    // DataPointIndexChaStateSf
+    { "ChaState_SF", "ChaState_SF", "Scale factor for available energy percent.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 22, 20, 1 },
+    // DataPointIndexStorAvalSf
+    { "StorAval_SF", "StorAval_SF", "Scale factor for state of charge.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 23, 21, 1 },
+    // DataPointIndexInBatVSf
+    { "InBatV_SF", "InBatV_SF", "Scale factor for battery voltage.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 24, 22, 1 },
+    // DataPointIndexInOutWRteSf
+    { "InOutWRte_SF", "InOutWRte_SF", "Scale factor for percent charge/discharge rate.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 25, 23, 1 }
+};
+
 SunSpecStorageModel::SunSpecStorageModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 124, modelLength, byteOrder, parent)
 {
@@ -69,7 +124,7 @@ QModbusReply *SunSpecStorageModel::setWChaMax(float wChaMax)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("WChaMax");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexWChaMax]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(wChaMax, m_wChaMaxSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -87,7 +142,7 @@ QModbusReply *SunSpecStorageModel::setWChaGra(float wChaGra)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("WChaGra");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexWChaGra]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(wChaGra, m_wChaDisChaGraSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -105,7 +160,7 @@ QModbusReply *SunSpecStorageModel::setWDisChaGra(float wDisChaGra)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("WDisChaGra");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexWDisChaGra]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(wDisChaGra, m_wChaDisChaGraSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -123,7 +178,7 @@ QModbusReply *SunSpecStorageModel::setStorCtlMod(Storctl_modFlags storCtlMod)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("StorCtl_Mod");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexStorCtlMod]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(storCtlMod));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -141,7 +196,7 @@ QModbusReply *SunSpecStorageModel::setVaChaMax(float vaChaMax)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("VAChaMax");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexVaChaMax]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(vaChaMax, m_vaChaMaxSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -159,7 +214,7 @@ QModbusReply *SunSpecStorageModel::setMinRsvPct(float minRsvPct)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("MinRsvPct");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexMinRsvPct]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(minRsvPct, m_minRsvPctSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -193,7 +248,7 @@ QModbusReply *SunSpecStorageModel::setOutWRte(float outWRte)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("OutWRte");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexOutWRte]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(outWRte, m_inOutWRteSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -211,7 +266,7 @@ QModbusReply *SunSpecStorageModel::setInWRte(float inWRte)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("InWRte");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexInWRte]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(inWRte, m_inOutWRteSf, dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -229,7 +284,7 @@ QModbusReply *SunSpecStorageModel::setInOutWRteWinTms(quint16 inOutWRteWinTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("InOutWRte_WinTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexInOutWRteWinTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(inOutWRteWinTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -247,7 +302,7 @@ QModbusReply *SunSpecStorageModel::setInOutWRteRvrtTms(quint16 inOutWRteRvrtTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("InOutWRte_RvrtTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexInOutWRteRvrtTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(inOutWRteRvrtTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -265,7 +320,7 @@ QModbusReply *SunSpecStorageModel::setInOutWRteRmpTms(quint16 inOutWRteRmpTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("InOutWRte_RmpTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexInOutWRteRmpTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(inOutWRteRmpTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -283,7 +338,7 @@ QModbusReply *SunSpecStorageModel::setChaGriSet(Chagriset chaGriSet)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ChaGriSet");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexChaGriSet]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(chaGriSet));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -325,433 +380,129 @@ qint16 SunSpecStorageModel::inOutWRteSf() const
 }
 void SunSpecStorageModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint wChaMaxDataPoint;
-    wChaMaxDataPoint.setName("WChaMax");
-    wChaMaxDataPoint.setLabel("WChaMax");
-    wChaMaxDataPoint.setDescription("Setpoint for maximum charge.");
-    wChaMaxDataPoint.setUnits("W");
-    wChaMaxDataPoint.setMandatory(true);
-    wChaMaxDataPoint.setSize(1);
-    wChaMaxDataPoint.setAddressOffset(2);
-    wChaMaxDataPoint.setBlockOffset(0);
-    wChaMaxDataPoint.setScaleFactorName("WChaMax_SF");
-    wChaMaxDataPoint.setSunSpecDataType("uint16");
-    wChaMaxDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    wChaMaxDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wChaMaxDataPoint.name(), wChaMaxDataPoint);
-
-    SunSpecDataPoint wChaGraDataPoint;
-    wChaGraDataPoint.setName("WChaGra");
-    wChaGraDataPoint.setLabel("WChaGra");
-    wChaGraDataPoint.setDescription("Setpoint for maximum charging rate. Default is MaxChaRte.");
-    wChaGraDataPoint.setUnits("% WChaMax/sec");
-    wChaGraDataPoint.setMandatory(true);
-    wChaGraDataPoint.setSize(1);
-    wChaGraDataPoint.setAddressOffset(3);
-    wChaGraDataPoint.setBlockOffset(1);
-    wChaGraDataPoint.setScaleFactorName("WChaDisChaGra_SF");
-    wChaGraDataPoint.setSunSpecDataType("uint16");
-    wChaGraDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    wChaGraDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wChaGraDataPoint.name(), wChaGraDataPoint);
-
-    SunSpecDataPoint wDisChaGraDataPoint;
-    wDisChaGraDataPoint.setName("WDisChaGra");
-    wDisChaGraDataPoint.setLabel("WDisChaGra");
-    wDisChaGraDataPoint.setDescription("Setpoint for maximum discharge rate. Default is MaxDisChaRte.");
-    wDisChaGraDataPoint.setUnits("% WChaMax/sec");
-    wDisChaGraDataPoint.setMandatory(true);
-    wDisChaGraDataPoint.setSize(1);
-    wDisChaGraDataPoint.setAddressOffset(4);
-    wDisChaGraDataPoint.setBlockOffset(2);
-    wDisChaGraDataPoint.setScaleFactorName("WChaDisChaGra_SF");
-    wDisChaGraDataPoint.setSunSpecDataType("uint16");
-    wDisChaGraDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    wDisChaGraDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wDisChaGraDataPoint.name(), wDisChaGraDataPoint);
-
-    SunSpecDataPoint storCtlModDataPoint;
-    storCtlModDataPoint.setName("StorCtl_Mod");
-    storCtlModDataPoint.setLabel("StorCtl_Mod");
-    storCtlModDataPoint.setDescription("Activate hold/discharge/charge storage control mode. Bitfield value.");
-    storCtlModDataPoint.setMandatory(true);
-    storCtlModDataPoint.setSize(1);
-    storCtlModDataPoint.setAddressOffset(5);
-    storCtlModDataPoint.setBlockOffset(3);
-    storCtlModDataPoint.setSunSpecDataType("bitfield16");
-    storCtlModDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    storCtlModDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(storCtlModDataPoint.name(), storCtlModDataPoint);
-
-    SunSpecDataPoint vaChaMaxDataPoint;
-    vaChaMaxDataPoint.setName("VAChaMax");
-    vaChaMaxDataPoint.setLabel("VAChaMax");
-    vaChaMaxDataPoint.setDescription("Setpoint for maximum charging VA.");
-    vaChaMaxDataPoint.setUnits("VA");
-    vaChaMaxDataPoint.setSize(1);
-    vaChaMaxDataPoint.setAddressOffset(6);
-    vaChaMaxDataPoint.setBlockOffset(4);
-    vaChaMaxDataPoint.setScaleFactorName("VAChaMax_SF");
-    vaChaMaxDataPoint.setSunSpecDataType("uint16");
-    vaChaMaxDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    vaChaMaxDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vaChaMaxDataPoint.name(), vaChaMaxDataPoint);
-
-    SunSpecDataPoint minRsvPctDataPoint;
-    minRsvPctDataPoint.setName("MinRsvPct");
-    minRsvPctDataPoint.setLabel("MinRsvPct");
-    minRsvPctDataPoint.setDescription("Setpoint for minimum reserve for storage as a percentage of the nominal maximum storage.");
-    minRsvPctDataPoint.setUnits("% WChaMax");
-    minRsvPctDataPoint.setSize(1);
-    minRsvPctDataPoint.setAddressOffset(7);
-    minRsvPctDataPoint.setBlockOffset(5);
-    minRsvPctDataPoint.setScaleFactorName("MinRsvPct_SF");
-    minRsvPctDataPoint.setSunSpecDataType("uint16");
-    minRsvPctDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    minRsvPctDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minRsvPctDataPoint.name(), minRsvPctDataPoint);
-
-    SunSpecDataPoint chaStateDataPoint;
-    chaStateDataPoint.setName("ChaState");
-    chaStateDataPoint.setLabel("ChaState");
-    chaStateDataPoint.setDescription("Currently available energy as a percent of the capacity rating.");
-    chaStateDataPoint.setUnits("% AhrRtg");
-    chaStateDataPoint.setSize(1);
-    chaStateDataPoint.setAddressOffset(8);
-    chaStateDataPoint.setBlockOffset(6);
-    chaStateDataPoint.setScaleFactorName("ChaState_SF");
-    chaStateDataPoint.setSunSpecDataType("uint16");
-    chaStateDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(chaStateDataPoint.name(), chaStateDataPoint);
-
-    SunSpecDataPoint storAvalDataPoint;
-    storAvalDataPoint.setName("StorAval");
-    storAvalDataPoint.setLabel("StorAval");
-    storAvalDataPoint.setDescription("State of charge (ChaState) minus storage reserve (MinRsvPct) times capacity rating (AhrRtg).");
-    storAvalDataPoint.setUnits("AH");
-    storAvalDataPoint.setSize(1);
-    storAvalDataPoint.setAddressOffset(9);
-    storAvalDataPoint.setBlockOffset(7);
-    storAvalDataPoint.setScaleFactorName("StorAval_SF");
-    storAvalDataPoint.setSunSpecDataType("uint16");
-    storAvalDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(storAvalDataPoint.name(), storAvalDataPoint);
-
-    SunSpecDataPoint inBatVDataPoint;
-    inBatVDataPoint.setName("InBatV");
-    inBatVDataPoint.setLabel("InBatV");
-    inBatVDataPoint.setDescription("Internal battery voltage.");
-    inBatVDataPoint.setUnits("V");
-    inBatVDataPoint.setSize(1);
-    inBatVDataPoint.setAddressOffset(10);
-    inBatVDataPoint.setBlockOffset(8);
-    inBatVDataPoint.setScaleFactorName("InBatV_SF");
-    inBatVDataPoint.setSunSpecDataType("uint16");
-    inBatVDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inBatVDataPoint.name(), inBatVDataPoint);
-
-    SunSpecDataPoint chaStDataPoint;
-    chaStDataPoint.setName("ChaSt");
-    chaStDataPoint.setLabel("ChaSt");
-    chaStDataPoint.setDescription("Charge status of storage device. Enumerated value.");
-    chaStDataPoint.setSize(1);
-    chaStDataPoint.setAddressOffset(11);
-    chaStDataPoint.setBlockOffset(9);
-    chaStDataPoint.setSunSpecDataType("enum16");
-    chaStDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(chaStDataPoint.name(), chaStDataPoint);
-
-    SunSpecDataPoint outWRteDataPoint;
-    outWRteDataPoint.setName("OutWRte");
-    outWRteDataPoint.setLabel("OutWRte");
-    outWRteDataPoint.setDescription("Percent of max discharge rate.");
-    outWRteDataPoint.setUnits("% WDisChaMax");
-    outWRteDataPoint.setSize(1);
-    outWRteDataPoint.setAddressOffset(12);
-    outWRteDataPoint.setBlockOffset(10);
-    outWRteDataPoint.setScaleFactorName("InOutWRte_SF");
-    outWRteDataPoint.setSunSpecDataType("int16");
-    outWRteDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    outWRteDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(outWRteDataPoint.name(), outWRteDataPoint);
-
-    SunSpecDataPoint inWRteDataPoint;
-    inWRteDataPoint.setName("InWRte");
-    inWRteDataPoint.setLabel("InWRte");
-    inWRteDataPoint.setDescription("Percent of max charging rate.");
-    inWRteDataPoint.setUnits(" % WChaMax");
-    inWRteDataPoint.setSize(1);
-    inWRteDataPoint.setAddressOffset(13);
-    inWRteDataPoint.setBlockOffset(11);
-    inWRteDataPoint.setScaleFactorName("InOutWRte_SF");
-    inWRteDataPoint.setSunSpecDataType("int16");
-    inWRteDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    inWRteDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inWRteDataPoint.name(), inWRteDataPoint);
-
-    SunSpecDataPoint inOutWRteWinTmsDataPoint;
-    inOutWRteWinTmsDataPoint.setName("InOutWRte_WinTms");
-    inOutWRteWinTmsDataPoint.setLabel("InOutWRte_WinTms");
-    inOutWRteWinTmsDataPoint.setDescription("Time window for charge/discharge rate change.");
-    inOutWRteWinTmsDataPoint.setUnits("Secs");
-    inOutWRteWinTmsDataPoint.setSize(1);
-    inOutWRteWinTmsDataPoint.setAddressOffset(14);
-    inOutWRteWinTmsDataPoint.setBlockOffset(12);
-    inOutWRteWinTmsDataPoint.setSunSpecDataType("uint16");
-    inOutWRteWinTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    inOutWRteWinTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inOutWRteWinTmsDataPoint.name(), inOutWRteWinTmsDataPoint);
-
-    SunSpecDataPoint inOutWRteRvrtTmsDataPoint;
-    inOutWRteRvrtTmsDataPoint.setName("InOutWRte_RvrtTms");
-    inOutWRteRvrtTmsDataPoint.setLabel("InOutWRte_RvrtTms");
-    inOutWRteRvrtTmsDataPoint.setDescription("Timeout period for charge/discharge rate.");
-    inOutWRteRvrtTmsDataPoint.setUnits("Secs");
-    inOutWRteRvrtTmsDataPoint.setSize(1);
-    inOutWRteRvrtTmsDataPoint.setAddressOffset(15);
-    inOutWRteRvrtTmsDataPoint.setBlockOffset(13);
-    inOutWRteRvrtTmsDataPoint.setSunSpecDataType("uint16");
-    inOutWRteRvrtTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    inOutWRteRvrtTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inOutWRteRvrtTmsDataPoint.name(), inOutWRteRvrtTmsDataPoint);
-
-    SunSpecDataPoint inOutWRteRmpTmsDataPoint;
-    inOutWRteRmpTmsDataPoint.setName("InOutWRte_RmpTms");
-    inOutWRteRmpTmsDataPoint.setLabel("InOutWRte_RmpTms");
-    inOutWRteRmpTmsDataPoint.setDescription("Ramp time for moving from current setpoint to new setpoint.");
-    inOutWRteRmpTmsDataPoint.setUnits("Secs");
-    inOutWRteRmpTmsDataPoint.setSize(1);
-    inOutWRteRmpTmsDataPoint.setAddressOffset(16);
-    inOutWRteRmpTmsDataPoint.setBlockOffset(14);
-    inOutWRteRmpTmsDataPoint.setSunSpecDataType("uint16");
-    inOutWRteRmpTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    inOutWRteRmpTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inOutWRteRmpTmsDataPoint.name(), inOutWRteRmpTmsDataPoint);
-
-    SunSpecDataPoint chaGriSetDataPoint;
-    chaGriSetDataPoint.setName("ChaGriSet");
-    chaGriSetDataPoint.setSize(1);
-    chaGriSetDataPoint.setAddressOffset(17);
-    chaGriSetDataPoint.setBlockOffset(15);
-    chaGriSetDataPoint.setSunSpecDataType("enum16");
-    chaGriSetDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    chaGriSetDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(chaGriSetDataPoint.name(), chaGriSetDataPoint);
-
-    SunSpecDataPoint wChaMaxSfDataPoint;
-    wChaMaxSfDataPoint.setName("WChaMax_SF");
-    wChaMaxSfDataPoint.setLabel("WChaMax_SF");
-    wChaMaxSfDataPoint.setDescription("Scale factor for maximum charge.");
-    wChaMaxSfDataPoint.setMandatory(true);
-    wChaMaxSfDataPoint.setSize(1);
-    wChaMaxSfDataPoint.setAddressOffset(18);
-    wChaMaxSfDataPoint.setBlockOffset(16);
-    wChaMaxSfDataPoint.setSunSpecDataType("sunssf");
-    wChaMaxSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wChaMaxSfDataPoint.name(), wChaMaxSfDataPoint);
-
-    SunSpecDataPoint wChaDisChaGraSfDataPoint;
-    wChaDisChaGraSfDataPoint.setName("WChaDisChaGra_SF");
-    wChaDisChaGraSfDataPoint.setLabel("WChaDisChaGra_SF");
-    wChaDisChaGraSfDataPoint.setDescription("Scale factor for maximum charge and discharge rate.");
-    wChaDisChaGraSfDataPoint.setMandatory(true);
-    wChaDisChaGraSfDataPoint.setSize(1);
-    wChaDisChaGraSfDataPoint.setAddressOffset(19);
-    wChaDisChaGraSfDataPoint.setBlockOffset(17);
-    wChaDisChaGraSfDataPoint.setSunSpecDataType("sunssf");
-    wChaDisChaGraSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(wChaDisChaGraSfDataPoint.name(), wChaDisChaGraSfDataPoint);
-
-    SunSpecDataPoint vaChaMaxSfDataPoint;
-    vaChaMaxSfDataPoint.setName("VAChaMax_SF");
-    vaChaMaxSfDataPoint.setLabel("VAChaMax_SF");
-    vaChaMaxSfDataPoint.setDescription("Scale factor for maximum charging VA.");
-    vaChaMaxSfDataPoint.setSize(1);
-    vaChaMaxSfDataPoint.setAddressOffset(20);
-    vaChaMaxSfDataPoint.setBlockOffset(18);
-    vaChaMaxSfDataPoint.setSunSpecDataType("sunssf");
-    vaChaMaxSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vaChaMaxSfDataPoint.name(), vaChaMaxSfDataPoint);
-
-    SunSpecDataPoint minRsvPctSfDataPoint;
-    minRsvPctSfDataPoint.setName("MinRsvPct_SF");
-    minRsvPctSfDataPoint.setLabel("MinRsvPct_SF");
-    minRsvPctSfDataPoint.setDescription("Scale factor for minimum reserve percentage.");
-    minRsvPctSfDataPoint.setSize(1);
-    minRsvPctSfDataPoint.setAddressOffset(21);
-    minRsvPctSfDataPoint.setBlockOffset(19);
-    minRsvPctSfDataPoint.setSunSpecDataType("sunssf");
-    minRsvPctSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(minRsvPctSfDataPoint.name(), minRsvPctSfDataPoint);
-
-    SunSpecDataPoint chaStateSfDataPoint;
-    chaStateSfDataPoint.setName("ChaState_SF");
-    chaStateSfDataPoint.setLabel("ChaState_SF");
-    chaStateSfDataPoint.setDescription("Scale factor for available energy percent.");
-    chaStateSfDataPoint.setSize(1);
-    chaStateSfDataPoint.setAddressOffset(22);
-    chaStateSfDataPoint.setBlockOffset(20);
-    chaStateSfDataPoint.setSunSpecDataType("sunssf");
-    chaStateSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(chaStateSfDataPoint.name(), chaStateSfDataPoint);
-
-    SunSpecDataPoint storAvalSfDataPoint;
-    storAvalSfDataPoint.setName("StorAval_SF");
-    storAvalSfDataPoint.setLabel("StorAval_SF");
-    storAvalSfDataPoint.setDescription("Scale factor for state of charge.");
-    storAvalSfDataPoint.setSize(1);
-    storAvalSfDataPoint.setAddressOffset(23);
-    storAvalSfDataPoint.setBlockOffset(21);
-    storAvalSfDataPoint.setSunSpecDataType("sunssf");
-    storAvalSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(storAvalSfDataPoint.name(), storAvalSfDataPoint);
-
-    SunSpecDataPoint inBatVSfDataPoint;
-    inBatVSfDataPoint.setName("InBatV_SF");
-    inBatVSfDataPoint.setLabel("InBatV_SF");
-    inBatVSfDataPoint.setDescription("Scale factor for battery voltage.");
-    inBatVSfDataPoint.setSize(1);
-    inBatVSfDataPoint.setAddressOffset(24);
-    inBatVSfDataPoint.setBlockOffset(22);
-    inBatVSfDataPoint.setSunSpecDataType("sunssf");
-    inBatVSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inBatVSfDataPoint.name(), inBatVSfDataPoint);
-
-    SunSpecDataPoint inOutWRteSfDataPoint;
-    inOutWRteSfDataPoint.setName("InOutWRte_SF");
-    inOutWRteSfDataPoint.setLabel("InOutWRte_SF");
-    inOutWRteSfDataPoint.setDescription("Scale factor for percent charge/discharge rate.");
-    inOutWRteSfDataPoint.setSize(1);
-    inOutWRteSfDataPoint.setAddressOffset(25);
-    inOutWRteSfDataPoint.setBlockOffset(23);
-    inOutWRteSfDataPoint.setSunSpecDataType("sunssf");
-    inOutWRteSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inOutWRteSfDataPoint.name(), inOutWRteSfDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 26;
 }
 
 void SunSpecStorageModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("WChaMax_SF").isValid())
-        m_wChaMaxSf = m_dataPoints.value("WChaMax_SF").toInt16();
+    if (registerCount >= 19 && SunSpecDataPoint::isValid(registers + 18, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 18, 1);
+        if (scaleFactor != m_wChaMaxSf) {
+            m_wChaMaxSf = scaleFactor;
+            m_wChaMaxSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("WChaDisChaGra_SF").isValid())
-        m_wChaDisChaGraSf = m_dataPoints.value("WChaDisChaGra_SF").toInt16();
+    if (registerCount >= 20 && SunSpecDataPoint::isValid(registers + 19, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 19, 1);
+        if (scaleFactor != m_wChaDisChaGraSf) {
+            m_wChaDisChaGraSf = scaleFactor;
+            m_wChaDisChaGraSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("VAChaMax_SF").isValid())
-        m_vaChaMaxSf = m_dataPoints.value("VAChaMax_SF").toInt16();
+    if (registerCount >= 21 && SunSpecDataPoint::isValid(registers + 20, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 20, 1);
+        if (scaleFactor != m_vaChaMaxSf) {
+            m_vaChaMaxSf = scaleFactor;
+            m_vaChaMaxSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("MinRsvPct_SF").isValid())
-        m_minRsvPctSf = m_dataPoints.value("MinRsvPct_SF").toInt16();
+    if (registerCount >= 22 && SunSpecDataPoint::isValid(registers + 21, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 21, 1);
+        if (scaleFactor != m_minRsvPctSf) {
+            m_minRsvPctSf = scaleFactor;
+            m_minRsvPctSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("ChaState_SF").isValid())
-        m_chaStateSf = m_dataPoints.value("ChaState_SF").toInt16();
+    if (registerCount >= 23 && SunSpecDataPoint::isValid(registers + 22, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 22, 1);
+        if (scaleFactor != m_chaStateSf) {
+            m_chaStateSf = scaleFactor;
+            m_chaStateSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("StorAval_SF").isValid())
-        m_storAvalSf = m_dataPoints.value("StorAval_SF").toInt16();
+    if (registerCount >= 24 && SunSpecDataPoint::isValid(registers + 23, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 23, 1);
+        if (scaleFactor != m_storAvalSf) {
+            m_storAvalSf = scaleFactor;
+            m_storAvalSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("InBatV_SF").isValid())
-        m_inBatVSf = m_dataPoints.value("InBatV_SF").toInt16();
+    if (registerCount >= 25 && SunSpecDataPoint::isValid(registers + 24, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 24, 1);
+        if (scaleFactor != m_inBatVSf) {
+            m_inBatVSf = scaleFactor;
+            m_inBatVSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("InOutWRte_SF").isValid())
-        m_inOutWRteSf = m_dataPoints.value("InOutWRte_SF").toInt16();
+    if (registerCount >= 26 && SunSpecDataPoint::isValid(registers + 25, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 25, 1);
+        if (scaleFactor != m_inOutWRteSf) {
+            m_inOutWRteSf = scaleFactor;
+            m_inOutWRteSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("WChaMax").isValid())
-        m_wChaMax = m_dataPoints.value("WChaMax").toFloatWithSSF(m_wChaMaxSf);
-
-    if (m_dataPoints.value("WChaGra").isValid())
-        m_wChaGra = m_dataPoints.value("WChaGra").toFloatWithSSF(m_wChaDisChaGraSf);
-
-    if (m_dataPoints.value("WDisChaGra").isValid())
-        m_wDisChaGra = m_dataPoints.value("WDisChaGra").toFloatWithSSF(m_wChaDisChaGraSf);
-
-    if (m_dataPoints.value("StorCtl_Mod").isValid())
-        m_storCtlMod = static_cast<Storctl_modFlags>(m_dataPoints.value("StorCtl_Mod").toUInt16());
-
-    if (m_dataPoints.value("VAChaMax").isValid())
-        m_vaChaMax = m_dataPoints.value("VAChaMax").toFloatWithSSF(m_vaChaMaxSf);
-
-    if (m_dataPoints.value("MinRsvPct").isValid())
-        m_minRsvPct = m_dataPoints.value("MinRsvPct").toFloatWithSSF(m_minRsvPctSf);
-
-    if (m_dataPoints.value("ChaState").isValid())
-        m_chaState = m_dataPoints.value("ChaState").toFloatWithSSF(m_chaStateSf);
-
-    if (m_dataPoints.value("StorAval").isValid())
-        m_storAval = m_dataPoints.value("StorAval").toFloatWithSSF(m_storAvalSf);
-
-    if (m_dataPoints.value("InBatV").isValid())
-        m_inBatV = m_dataPoints.value("InBatV").toFloatWithSSF(m_inBatVSf);
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_wChaMax = SunSpecDataPoint::convertToUInt16(registers + 2, 1) * m_wChaMaxSfMultiplier;
 
-    if (m_dataPoints.value("ChaSt").isValid())
-        m_chaSt = static_cast<Chast>(m_dataPoints.value("ChaSt").toUInt16());
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_wChaGra = SunSpecDataPoint::convertToUInt16(registers + 3, 1) * m_wChaDisChaGraSfMultiplier;
 
-    if (m_dataPoints.value("OutWRte").isValid())
-        m_outWRte = m_dataPoints.value("OutWRte").toFloatWithSSF(m_inOutWRteSf);
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_wDisChaGra = SunSpecDataPoint::convertToUInt16(registers + 4, 1) * m_wChaDisChaGraSfMultiplier;
 
-    if (m_dataPoints.value("InWRte").isValid())
-        m_inWRte = m_dataPoints.value("InWRte").toFloatWithSSF(m_inOutWRteSf);
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::BitField16, m_byteOrder))
+        m_storCtlMod = static_cast<Storctl_modFlags>(SunSpecDataPoint::convertToUInt16(registers + 5, 1));
 
-    if (m_dataPoints.value("InOutWRte_WinTms").isValid())
-        m_inOutWRteWinTms = m_dataPoints.value("InOutWRte_WinTms").toUInt16();
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_vaChaMax = SunSpecDataPoint::convertToUInt16(registers + 6, 1) * m_vaChaMaxSfMultiplier;
 
-    if (m_dataPoints.value("InOutWRte_RvrtTms").isValid())
-        m_inOutWRteRvrtTms = m_dataPoints.value("InOutWRte_RvrtTms").toUInt16();
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_minRsvPct = SunSpecDataPoint::convertToUInt16(registers + 7, 1) * m_minRsvPctSfMultiplier;
 
-    if (m_dataPoints.value("InOutWRte_RmpTms").isValid())
-        m_inOutWRteRmpTms = m_dataPoints.value("InOutWRte_RmpTms").toUInt16();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_chaState = SunSpecDataPoint::convertToUInt16(registers + 8, 1) * m_chaStateSfMultiplier;
 
-    if (m_dataPoints.value("ChaGriSet").isValid())
-        m_chaGriSet = static_cast<Chagriset>(m_dataPoints.value("ChaGriSet").toUInt16());
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_storAval = SunSpecDataPoint::convertToUInt16(registers + 9, 1) * m_storAvalSfMultiplier;
 
-    if (m_dataPoints.value("WChaMax_SF").isValid())
-        m_wChaMaxSf = m_dataPoints.value("WChaMax_SF").toInt16();
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_inBatV = SunSpecDataPoint::convertToUInt16(registers + 10, 1) * m_inBatVSfMultiplier;
 
-    if (m_dataPoints.value("WChaDisChaGra_SF").isValid())
-        m_wChaDisChaGraSf = m_dataPoints.value("WChaDisChaGra_SF").toInt16();
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_chaSt = static_cast<Chast>(SunSpecDataPoint::convertToUInt16(registers + 11, 1));
 
-    if (m_dataPoints.value("VAChaMax_SF").isValid())
-        m_vaChaMaxSf = m_dataPoints.value("VAChaMax_SF").toInt16();
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 12, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_outWRte = SunSpecDataPoint::convertToInt16(registers + 12, 1) * m_inOutWRteSfMultiplier;
 
-    if (m_dataPoints.value("MinRsvPct_SF").isValid())
-        m_minRsvPctSf = m_dataPoints.value("MinRsvPct_SF").toInt16();
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 13, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_inWRte = SunSpecDataPoint::convertToInt16(registers + 13, 1) * m_inOutWRteSfMultiplier;
 
-    if (m_dataPoints.value("ChaState_SF").isValid())
-        m_chaStateSf = m_dataPoints.value("ChaState_SF").toInt16();
+    if (registerCount >= 15 && SunSpecDataPoint::isValid(registers + 14, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_inOutWRteWinTms = SunSpecDataPoint::convertToUInt16(registers + 14, 1);
 
-    if (m_dataPoints.value("StorAval_SF").isValid())
-        m_storAvalSf = m_dataPoints.value("StorAval_SF").toInt16();
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 15, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_inOutWRteRvrtTms = SunSpecDataPoint::convertToUInt16(registers + 15, 1);
 
-    if (m_dataPoints.value("InBatV_SF").isValid())
-        m_inBatVSf = m_dataPoints.value("InBatV_SF").toInt16();
+    if (registerCount >= 17 && SunSpecDataPoint::isValid(registers + 16, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_inOutWRteRmpTms = SunSpecDataPoint::convertToUInt16(registers + 16, 1);
 
-    if (m_dataPoints.value("InOutWRte_SF").isValid())
-        m_inOutWRteSf = m_dataPoints.value("InOutWRte_SF").toInt16();
+    if (registerCount >= 18 && SunSpecDataPoint::isValid(registers + 17, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_chaGriSet = static_cast<Chagriset>(SunSpecDataPoint::convertToUInt16(registers + 17, 1));
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -760,113 +511,113 @@ void SunSpecStorageModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecStorageModel *model)
 {
     debug.nospace().noquote() << "SunSpecStorageModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WChaMax") << "-->";
-    if (model->dataPoints().value("WChaMax").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexWChaMax) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexWChaMax).isValid()) {
         debug.nospace().noquote() << model->wChaMax() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WChaGra") << "-->";
-    if (model->dataPoints().value("WChaGra").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexWChaGra) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexWChaGra).isValid()) {
         debug.nospace().noquote() << model->wChaGra() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WDisChaGra") << "-->";
-    if (model->dataPoints().value("WDisChaGra").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexWDisChaGra) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexWDisChaGra).isValid()) {
         debug.nospace().noquote() << model->wDisChaGra() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StorCtl_Mod") << "-->";
-    if (model->dataPoints().value("StorCtl_Mod").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexStorCtlMod) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexStorCtlMod).isValid()) {
         debug.nospace().noquote() << model->storCtlMod() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("VAChaMax") << "-->";
-    if (model->dataPoints().value("VAChaMax").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexVaChaMax) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexVaChaMax).isValid()) {
         debug.nospace().noquote() << model->vaChaMax() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("MinRsvPct") << "-->";
-    if (model->dataPoints().value("MinRsvPct").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexMinRsvPct) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexMinRsvPct).isValid()) {
         debug.nospace().noquote() << model->minRsvPct() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ChaState") << "-->";
-    if (model->dataPoints().value("ChaState").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexChaState) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexChaState).isValid()) {
         debug.nospace().noquote() << model->chaState() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("StorAval") << "-->";
-    if (model->dataPoints().value("StorAval").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexStorAval) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexStorAval).isValid()) {
         debug.nospace().noquote() << model->storAval() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("InBatV") << "-->";
-    if (model->dataPoints().value("InBatV").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexInBatV) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexInBatV).isValid()) {
         debug.nospace().noquote() << model->inBatV() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ChaSt") << "-->";
-    if (model->dataPoints().value("ChaSt").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexChaSt) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexChaSt).isValid()) {
         debug.nospace().noquote() << model->chaSt() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("OutWRte") << "-->";
-    if (model->dataPoints().value("OutWRte").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexOutWRte) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexOutWRte).isValid()) {
         debug.nospace().noquote() << model->outWRte() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("InWRte") << "-->";
-    if (model->dataPoints().value("InWRte").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexInWRte) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexInWRte).isValid()) {
         debug.nospace().noquote() << model->inWRte() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("InOutWRte_WinTms") << "-->";
-    if (model->dataPoints().value("InOutWRte_WinTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexInOutWRteWinTms) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexInOutWRteWinTms).isValid()) {
         debug.nospace().noquote() << model->inOutWRteWinTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("InOutWRte_RvrtTms") << "-->";
-    if (model->dataPoints().value("InOutWRte_RvrtTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexInOutWRteRvrtTms) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexInOutWRteRvrtTms).isValid()) {
         debug.nospace().noquote() << model->inOutWRteRvrtTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("InOutWRte_RmpTms") << "-->";
-    if (model->dataPoints().value("InOutWRte_RmpTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexInOutWRteRmpTms) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexInOutWRteRmpTms).isValid()) {
         debug.nospace().noquote() << model->inOutWRteRmpTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ChaGriSet") << "-->";
-    if (model->dataPoints().value("ChaGriSet").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStorageModel::DataPointIndexChaGriSet) << "-->";
+    if (model->dataPoint(SunSpecStorageModel::DataPointIndexChaGriSet).isValid()) {
         debug.nospace().noquote() << model->chaGriSet() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
@@ -66,6 +66,35 @@ public:
     Q_DECLARE_FLAGS(Storctl_modFlags, Storctl_mod)
     Q_FLAG(Storctl_mod)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexWChaMax,
+        DataPointIndexWChaGra,
+        DataPointIndexWDisChaGra,
+        DataPointIndexStorCtlMod,
+        DataPointIndexVaChaMax,
+        DataPointIndexMinRsvPct,
+        DataPointIndexChaState,
+        DataPointIndexStorAval,
+        DataPointIndexInBatV,
+        DataPointIndexChaSt,
+        DataPointIndexOutWRte,
+        DataPointIndexInWRte,
+        DataPointIndexInOutWRteWinTms,
+        DataPointIndexInOutWRteRvrtTms,
+        DataPointIndexInOutWRteRmpTms,
+        DataPointIndexChaGriSet,
+        DataPointIndexWChaMaxSf,
+        DataPointIndexWChaDisChaGraSf,
+        DataPointIndexVaChaMaxSf,
+        DataPointIndexMinRsvPctSf,
+        DataPointIndexChaStateSf,
+        DataPointIndexStorAvalSf,
+        DataPointIndexInBatVSf,
+        DataPointIndexInOutWRteSf
+    };
+
     explicit SunSpecStorageModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecStorageModel() override; 
 
@@ -170,13 +199,21 @@ private:
     quint16 m_inOutWRteRmpTms = 0;
     Chagriset m_chaGriSet;
     qint16 m_wChaMaxSf = 0;
+    double m_wChaMaxSfMultiplier = 1;
     qint16 m_wChaDisChaGraSf = 0;
+    double m_wChaDisChaGraSfMultiplier = 1;
     qint16 m_vaChaMaxSf = 0;
+    double m_vaChaMaxSfMultiplier = 1;
     qint16 m_minRsvPctSf = 0;
+    double m_minRsvPctSfMultiplier = 1;
     qint16 m_chaStateSf = 0;
+    double m_chaStateSfMultiplier = 1;
     qint16 m_storAvalSf = 0;
+    double m_storAvalSfMultiplier = 1;
     qint16 m_inBatVSf = 0;
+    double m_inBatVSfMultiplier = 1;
     qint16 m_inOutWRteSf = 0;
+    double m_inOutWRteSfMultiplier = 1;
 
 
 };
@@ -68,6 +68,19 @@ public:
     Q_DECLARE_FLAGS(InevtFlags, Inevt)
     Q_FLAG(Inevt)
 
+    enum DataPointIndex {
+        DataPointIndexId = 0,
+        DataPointIndexInputEvent,
+        DataPointIndexInputEventVendor,
+        DataPointIndexAmps,
+        DataPointIndexAmpHours,
+        DataPointIndexVoltage,
+        DataPointIndexWatts,
+        DataPointIndexWattHours,
+        DataPointIndexPr,
+        DataPointIndexN
+    };
+
     explicit SunSpecStringCombinerAdvancedModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecStringCombinerAdvancedModel *parent = nullptr);
     ~SunSpecStringCombinerAdvancedModelRepeatingBlock() override = default;
 
@@ -147,6 +160,32 @@ public:
     Q_DECLARE_FLAGS(EvtFlags, Evt)
     Q_FLAG(Evt)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexDCA_SF,
+        DataPointIndexDCAhr_SF,
+        DataPointIndexDCV_SF,
+        DataPointIndexDCW_SF,
+        DataPointIndexDCWh_SF,
+        DataPointIndexRating,
+        DataPointIndexN,
+        DataPointIndexEventFlags,
+        DataPointIndexVendorEvent,
+        DataPointIndexAmps,
+        DataPointIndexAmpHours,
+        DataPointIndexVoltage,
+        DataPointIndexTemp,
+        DataPointIndexWatts,
+        DataPointIndexPr,
+        DataPointIndexWattHours,
+        DataPointIndexInDCA_SF,
+        DataPointIndexInDCAhr_SF,
+        DataPointIndexInDCV_SF,
+        DataPointIndexInDCW_SF,
+        DataPointIndexInDCWh_SF
+    };
+
     explicit SunSpecStringCombinerAdvancedModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecStringCombinerAdvancedModel() override; 
 
@@ -206,10 +245,15 @@ protected:
 
 private:
     qint16 m_dCA_SF = 0;
+    double m_dCA_SFMultiplier = 1;
     qint16 m_dCAhr_SF = 0;
+    double m_dCAhr_SFMultiplier = 1;
     qint16 m_dCV_SF = 0;
+    double m_dCV_SFMultiplier = 1;
     qint16 m_dCW_SF = 0;
+    double m_dCW_SFMultiplier = 1;
     qint16 m_dCWh_SF = 0;
+    double m_dCWh_SFMultiplier = 1;
     float m_rating = 0;
     int m_n = 0;
     EvtFlags m_eventFlags;
@@ -222,10 +266,15 @@ private:
     qint16 m_pr = 0;
     quint32 m_wattHours = 0;
     qint16 m_inDCA_SF = 0;
+    double m_inDCA_SFMultiplier = 1;
     qint16 m_inDCAhr_SF = 0;
+    double m_inDCAhr_SFMultiplier = 1;
     qint16 m_inDCV_SF = 0;
+    double m_inDCV_SFMultiplier = 1;
     qint16 m_inDCW_SF = 0;
+    double m_inDCW_SFMultiplier = 1;
     qint16 m_inDCWh_SF = 0;
+    double m_inDCWh_SFMultiplier = 1;
 
 
 };
@@ -31,6 +31,19 @@
 #include "sunspecstringcombinercurrentmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata repeatingBlockDataPointMetadata[] = {
+    // DataPointIndexId
+    { "InID", "ID", "Uniquely identifies this input set", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexInputEvent
+    { "InEvt", "Input Event", "String Input Event Flags", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 2 },
+    // DataPointIndexInputEventVendor
+    { "InEvtVnd", "Input Event Vendor", "String Input Vendor Event Flags", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 3, 1, 2 },
+    // DataPointIndexAmps
+    { "InDCA", "Amps", "String Input Current", nullptr, "A", "int16", "InDCA_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 5, 3, 1 },
+    // DataPointIndexAmpHours
+    { "InDCAhr", "Amp-hours", "String Input Amp-Hours", nullptr, "Ah", "acc32", "InDCAhr_SF", SunSpecDataPoint::Acc32, SunSpecDataPoint::AccessReadOnly, false, 6, 4, 2 }
+};
+
 SunSpecStringCombinerCurrentModelRepeatingBlock::SunSpecStringCombinerCurrentModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecStringCombinerCurrentModel *parent) :
     SunSpecModelRepeatingBlock(blockIndex, blockSize, modbusStartRegister, parent)
 {
@@ -71,93 +84,71 @@ quint32 SunSpecStringCombinerCurrentModelRepeatingBlock::ampHours() const
 
 void SunSpecStringCombinerCurrentModelRepeatingBlock::initDataPoints()
 {
-    SunSpecDataPoint idDataPoint;
-    idDataPoint.setName("InID");
-    idDataPoint.setLabel("ID");
-    idDataPoint.setDescription("Uniquely identifies this input set");
-    idDataPoint.setMandatory(true);
-    idDataPoint.setSize(1);
-    idDataPoint.setAddressOffset(0);
-    idDataPoint.setSunSpecDataType("uint16");
-    idDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(idDataPoint.name(), idDataPoint);
-
-    SunSpecDataPoint inputEventDataPoint;
-    inputEventDataPoint.setName("InEvt");
-    inputEventDataPoint.setLabel("Input Event");
-    inputEventDataPoint.setDescription("String Input Event Flags");
-    inputEventDataPoint.setMandatory(true);
-    inputEventDataPoint.setSize(2);
-    inputEventDataPoint.setAddressOffset(1);
-    inputEventDataPoint.setSunSpecDataType("bitfield32");
-    inputEventDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inputEventDataPoint.name(), inputEventDataPoint);
-
-    SunSpecDataPoint inputEventVendorDataPoint;
-    inputEventVendorDataPoint.setName("InEvtVnd");
-    inputEventVendorDataPoint.setLabel("Input Event Vendor");
-    inputEventVendorDataPoint.setDescription("String Input Vendor Event Flags");
-    inputEventVendorDataPoint.setSize(2);
-    inputEventVendorDataPoint.setAddressOffset(3);
-    inputEventVendorDataPoint.setBlockOffset(1);
-    inputEventVendorDataPoint.setSunSpecDataType("bitfield32");
-    inputEventVendorDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inputEventVendorDataPoint.name(), inputEventVendorDataPoint);
-
-    SunSpecDataPoint ampsDataPoint;
-    ampsDataPoint.setName("InDCA");
-    ampsDataPoint.setLabel("Amps");
-    ampsDataPoint.setDescription("String Input Current");
-    ampsDataPoint.setUnits("A");
-    ampsDataPoint.setMandatory(true);
-    ampsDataPoint.setSize(1);
-    ampsDataPoint.setAddressOffset(5);
-    ampsDataPoint.setBlockOffset(3);
-    ampsDataPoint.setScaleFactorName("InDCA_SF");
-    ampsDataPoint.setSunSpecDataType("int16");
-    ampsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ampsDataPoint.name(), ampsDataPoint);
-
-    SunSpecDataPoint ampHoursDataPoint;
-    ampHoursDataPoint.setName("InDCAhr");
-    ampHoursDataPoint.setLabel("Amp-hours");
-    ampHoursDataPoint.setDescription("String Input Amp-Hours");
-    ampHoursDataPoint.setUnits("Ah");
-    ampHoursDataPoint.setSize(2);
-    ampHoursDataPoint.setAddressOffset(6);
-    ampHoursDataPoint.setBlockOffset(4);
-    ampHoursDataPoint.setScaleFactorName("InDCAhr_SF");
-    ampHoursDataPoint.setSunSpecDataType("acc32");
-    ampHoursDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ampHoursDataPoint.name(), ampHoursDataPoint);
-
+    m_dataPointMetadata = repeatingBlockDataPointMetadata;
+    m_dataPointCount = 5;
 }
 
 void SunSpecStringCombinerCurrentModelRepeatingBlock::processBlockData(const QVector<quint16> blockData)
 {
     m_blockData = blockData;
 
+    const quint16 *registers = m_blockData.constData();
+    const int registerCount = m_blockData.count();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("InID").isValid())
-        m_id = m_dataPoints.value("InID").toUInt16();
+    if (registerCount >= 1 && SunSpecDataPoint::isValid(registers + 0, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_id = SunSpecDataPoint::convertToUInt16(registers + 0, 1);
 
-    if (m_dataPoints.value("InEvt").isValid())
-        m_inputEvent = static_cast<InevtFlags>(m_dataPoints.value("InEvt").toUInt32());
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 1, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_inputEvent = static_cast<InevtFlags>(SunSpecDataPoint::convertToUInt32(registers + 1, 2, m_byteOrder));
 
-    if (m_dataPoints.value("InEvtVnd").isValid())
-        m_inputEventVendor = m_dataPoints.value("InEvtVnd").toUInt32();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 3, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_inputEventVendor = SunSpecDataPoint::convertToUInt32(registers + 3, 2, m_byteOrder);
 
-    if (m_dataPoints.value("InDCA").isValid())
-        m_amps = m_dataPoints.value("InDCA").toFloatWithSSF(m_parentModel->inDCA_SF());
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_amps = SunSpecDataPoint::convertToInt16(registers + 5, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->inDCA_SF());
 
-    if (m_dataPoints.value("InDCAhr").isValid())
-        m_ampHours = m_dataPoints.value("InDCAhr").toFloatWithSSF(m_parentModel->inDCAhr_SF());
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 6, 2, SunSpecDataPoint::Acc32, m_byteOrder))
+        m_ampHours = SunSpecDataPoint::convertToUInt32(registers + 6, 2, m_byteOrder) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->inDCAhr_SF());
 
 
     qCDebug(dcSunSpecModelData()) << this;
 }
 
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexDCA_SF
+    { "DCA_SF", nullptr, "Current scale factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 2, 0, 1 },
+    // DataPointIndexDCAhr_SF
+    { "DCAhr_SF", nullptr, "Amp-hour scale factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 3, 1, 1 },
+    // DataPointIndexDCV_SF
+    { "DCV_SF", nullptr, "Voltage scale factor", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 4, 2, 1 },
+    // DataPointIndexRating
+    { "DCAMax", "Rating", "Maximum DC Current Rating", nullptr, "A", "uint16", "DCA_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 5, 3, 1 },
+    // DataPointIndexN
+    { "N", "N", "Number of Inputs", nullptr, nullptr, "count", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 6, 4, 1 },
+    // DataPointIndexEventFlags
+    { "Evt", "Event", "Bitmask value.  Events", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, true, 7, 5, 2 },
+    // DataPointIndexVendorEvent
+    { "EvtVnd", "Vendor Event", "Bitmask value.  Vendor defined events", nullptr, nullptr, "bitfield32", nullptr, SunSpecDataPoint::BitField32, SunSpecDataPoint::AccessReadOnly, false, 9, 7, 2 },
+    // DataPointIndexAmps
+    { "DCA", "Amps", "Total measured current", nullptr, "A", "int16", "DCA_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, true, 11, 9, 1 },
+    // DataPointIndexAmpHours
+    { "DCAhr", "Amp-hours", "Total metered Amp-hours", nullptr, "Ah", "acc32", "DCAhr_SF", SunSpecDataPoint::Acc32, SunSpecDataPoint::AccessReadOnly, false, 12, 10, 2 },
+    // DataPointIndexVoltage
+    { "DCV", "Voltage", "Output Voltage", nullptr, "V", "int16", "DCV_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 14, 12, 1 },
+    // DataPointIndexTemp
+    { "Tmp", "Temp", "Internal operating temperature", nullptr, "C", "int16", nullptr, SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadOnly, false, 15, 13, 1 },
+    // DataPointIndexInDCA_SF
+    { "InDCA_SF", nullptr, "Current scale factor for inputs", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 16, 14, 1 },
+    // DataPointIndexInDCAhr_SF
+    { "InDCAhr_SF", nullptr, "Amp-hour scale factor for inputs", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 17, 15, 1 }
+};
+
 SunSpecStringCombinerCurrentModel::SunSpecStringCombinerCurrentModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 403, modelLength, byteOrder, parent)
 {
@@ -240,240 +231,81 @@ qint16 SunSpecStringCombinerCurrentModel::inDCAhr_SF() const
 }
 void SunSpecStringCombinerCurrentModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint dCA_SFDataPoint;
-    dCA_SFDataPoint.setName("DCA_SF");
-    dCA_SFDataPoint.setDescription("Current scale factor");
-    dCA_SFDataPoint.setMandatory(true);
-    dCA_SFDataPoint.setSize(1);
-    dCA_SFDataPoint.setAddressOffset(2);
-    dCA_SFDataPoint.setBlockOffset(0);
-    dCA_SFDataPoint.setSunSpecDataType("sunssf");
-    dCA_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(dCA_SFDataPoint.name(), dCA_SFDataPoint);
-
-    SunSpecDataPoint dCAhr_SFDataPoint;
-    dCAhr_SFDataPoint.setName("DCAhr_SF");
-    dCAhr_SFDataPoint.setDescription("Amp-hour scale factor");
-    dCAhr_SFDataPoint.setSize(1);
-    dCAhr_SFDataPoint.setAddressOffset(3);
-    dCAhr_SFDataPoint.setBlockOffset(1);
-    dCAhr_SFDataPoint.setSunSpecDataType("sunssf");
-    dCAhr_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(dCAhr_SFDataPoint.name(), dCAhr_SFDataPoint);
-
-    SunSpecDataPoint dCV_SFDataPoint;
-    dCV_SFDataPoint.setName("DCV_SF");
-    dCV_SFDataPoint.setDescription("Voltage scale factor");
-    dCV_SFDataPoint.setSize(1);
-    dCV_SFDataPoint.setAddressOffset(4);
-    dCV_SFDataPoint.setBlockOffset(2);
-    dCV_SFDataPoint.setSunSpecDataType("sunssf");
-    dCV_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(dCV_SFDataPoint.name(), dCV_SFDataPoint);
-
-    SunSpecDataPoint ratingDataPoint;
-    ratingDataPoint.setName("DCAMax");
-    ratingDataPoint.setLabel("Rating");
-    ratingDataPoint.setDescription("Maximum DC Current Rating");
-    ratingDataPoint.setUnits("A");
-    ratingDataPoint.setMandatory(true);
-    ratingDataPoint.setSize(1);
-    ratingDataPoint.setAddressOffset(5);
-    ratingDataPoint.setBlockOffset(3);
-    ratingDataPoint.setScaleFactorName("DCA_SF");
-    ratingDataPoint.setSunSpecDataType("uint16");
-    ratingDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ratingDataPoint.name(), ratingDataPoint);
-
-    SunSpecDataPoint nDataPoint;
-    nDataPoint.setName("N");
-    nDataPoint.setLabel("N");
-    nDataPoint.setDescription("Number of Inputs");
-    nDataPoint.setMandatory(true);
-    nDataPoint.setSize(1);
-    nDataPoint.setAddressOffset(6);
-    nDataPoint.setBlockOffset(4);
-    nDataPoint.setSunSpecDataType("count");
-    nDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(nDataPoint.name(), nDataPoint);
-
-    SunSpecDataPoint eventFlagsDataPoint;
-    eventFlagsDataPoint.setName("Evt");
-    eventFlagsDataPoint.setLabel("Event");
-    eventFlagsDataPoint.setDescription("Bitmask value.  Events");
-    eventFlagsDataPoint.setMandatory(true);
-    eventFlagsDataPoint.setSize(2);
-    eventFlagsDataPoint.setAddressOffset(7);
-    eventFlagsDataPoint.setBlockOffset(5);
-    eventFlagsDataPoint.setSunSpecDataType("bitfield32");
-    eventFlagsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(eventFlagsDataPoint.name(), eventFlagsDataPoint);
-
-    SunSpecDataPoint vendorEventDataPoint;
-    vendorEventDataPoint.setName("EvtVnd");
-    vendorEventDataPoint.setLabel("Vendor Event");
-    vendorEventDataPoint.setDescription("Bitmask value.  Vendor defined events");
-    vendorEventDataPoint.setSize(2);
-    vendorEventDataPoint.setAddressOffset(9);
-    vendorEventDataPoint.setBlockOffset(7);
-    vendorEventDataPoint.setSunSpecDataType("bitfield32");
-    vendorEventDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vendorEventDataPoint.name(), vendorEventDataPoint);
-
-    SunSpecDataPoint ampsDataPoint;
-    ampsDataPoint.setName("DCA");
-    ampsDataPoint.setLabel("Amps");
-    ampsDataPoint.setDescription("Total measured current");
-    ampsDataPoint.setUnits("A");
-    ampsDataPoint.setMandatory(true);
-    ampsDataPoint.setSize(1);
-    ampsDataPoint.setAddressOffset(11);
-    ampsDataPoint.setBlockOffset(9);
-    ampsDataPoint.setScaleFactorName("DCA_SF");
-    ampsDataPoint.setSunSpecDataType("int16");
-    ampsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ampsDataPoint.name(), ampsDataPoint);
-
-    SunSpecDataPoint ampHoursDataPoint;
-    ampHoursDataPoint.setName("DCAhr");
-    ampHoursDataPoint.setLabel("Amp-hours");
-    ampHoursDataPoint.setDescription("Total metered Amp-hours");
-    ampHoursDataPoint.setUnits("Ah");
-    ampHoursDataPoint.setSize(2);
-    ampHoursDataPoint.setAddressOffset(12);
-    ampHoursDataPoint.setBlockOffset(10);
-    ampHoursDataPoint.setScaleFactorName("DCAhr_SF");
-    ampHoursDataPoint.setSunSpecDataType("acc32");
-    ampHoursDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(ampHoursDataPoint.name(), ampHoursDataPoint);
-
-    SunSpecDataPoint voltageDataPoint;
-    voltageDataPoint.setName("DCV");
-    voltageDataPoint.setLabel("Voltage");
-    voltageDataPoint.setDescription("Output Voltage");
-    voltageDataPoint.setUnits("V");
-    voltageDataPoint.setSize(1);
-    voltageDataPoint.setAddressOffset(14);
-    voltageDataPoint.setBlockOffset(12);
-    voltageDataPoint.setScaleFactorName("DCV_SF");
-    voltageDataPoint.setSunSpecDataType("int16");
-    voltageDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(voltageDataPoint.name(), voltageDataPoint);
-
-    SunSpecDataPoint tempDataPoint;
-    tempDataPoint.setName("Tmp");
-    tempDataPoint.setLabel("Temp");
-    tempDataPoint.setDescription("Internal operating temperature");
-    tempDataPoint.setUnits("C");
-    tempDataPoint.setSize(1);
-    tempDataPoint.setAddressOffset(15);
-    tempDataPoint.setBlockOffset(13);
-    tempDataPoint.setSunSpecDataType("int16");
-    tempDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(tempDataPoint.name(), tempDataPoint);
-
-    SunSpecDataPoint inDCA_SFDataPoint;
-    inDCA_SFDataPoint.setName("InDCA_SF");
-    inDCA_SFDataPoint.setDescription("Current scale factor for inputs");
-    inDCA_SFDataPoint.setSize(1);
-    inDCA_SFDataPoint.setAddressOffset(16);
-    inDCA_SFDataPoint.setBlockOffset(14);
-    inDCA_SFDataPoint.setSunSpecDataType("sunssf");
-    inDCA_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inDCA_SFDataPoint.name(), inDCA_SFDataPoint);
-
-    SunSpecDataPoint inDCAhr_SFDataPoint;
-    inDCAhr_SFDataPoint.setName("InDCAhr_SF");
-    inDCAhr_SFDataPoint.setDescription("Amp-hour scale factor for inputs");
-    inDCAhr_SFDataPoint.setSize(1);
-    inDCAhr_SFDataPoint.setAddressOffset(17);
-    inDCAhr_SFDataPoint.setBlockOffset(15);
-    inDCAhr_SFDataPoint.setSunSpecDataType("sunssf");
-    inDCAhr_SFDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(inDCAhr_SFDataPoint.name(), inDCAhr_SFDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 15;
 }
 
 void SunSpecStringCombinerCurrentModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("DCA_SF").isValid())
-        m_dCA_SF = m_dataPoints.value("DCA_SF").toInt16();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 2, 1);
+        if (scaleFactor != m_dCA_SF) {
+            m_dCA_SF = scaleFactor;
+            m_dCA_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("DCAhr_SF").isValid())
-        m_dCAhr_SF = m_dataPoints.value("DCAhr_SF").toInt16();
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 3, 1);
+        if (scaleFactor != m_dCAhr_SF) {
+            m_dCAhr_SF = scaleFactor;
+            m_dCAhr_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("DCV_SF").isValid())
-        m_dCV_SF = m_dataPoints.value("DCV_SF").toInt16();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 4, 1);
+        if (scaleFactor != m_dCV_SF) {
+            m_dCV_SF = scaleFactor;
+            m_dCV_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("InDCA_SF").isValid())
-        m_inDCA_SF = m_dataPoints.value("InDCA_SF").toInt16();
+    if (registerCount >= 17 && SunSpecDataPoint::isValid(registers + 16, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 16, 1);
+        if (scaleFactor != m_inDCA_SF) {
+            m_inDCA_SF = scaleFactor;
+            m_inDCA_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("InDCAhr_SF").isValid())
-        m_inDCAhr_SF = m_dataPoints.value("InDCAhr_SF").toInt16();
+    if (registerCount >= 18 && SunSpecDataPoint::isValid(registers + 17, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 17, 1);
+        if (scaleFactor != m_inDCAhr_SF) {
+            m_inDCAhr_SF = scaleFactor;
+            m_inDCAhr_SFMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("DCA_SF").isValid())
-        m_dCA_SF = m_dataPoints.value("DCA_SF").toInt16();
-
-    if (m_dataPoints.value("DCAhr_SF").isValid())
-        m_dCAhr_SF = m_dataPoints.value("DCAhr_SF").toInt16();
-
-    if (m_dataPoints.value("DCV_SF").isValid())
-        m_dCV_SF = m_dataPoints.value("DCV_SF").toInt16();
-
-    if (m_dataPoints.value("DCAMax").isValid())
-        m_rating = m_dataPoints.value("DCAMax").toFloatWithSSF(m_dCA_SF);
-
-    if (m_dataPoints.value("N").isValid())
-        m_n = m_dataPoints.value("N").toUInt16();
-
-    if (m_dataPoints.value("Evt").isValid())
-        m_eventFlags = static_cast<EvtFlags>(m_dataPoints.value("Evt").toUInt32());
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_rating = SunSpecDataPoint::convertToUInt16(registers + 5, 1) * m_dCA_SFMultiplier;
 
-    if (m_dataPoints.value("EvtVnd").isValid())
-        m_vendorEvent = m_dataPoints.value("EvtVnd").toUInt32();
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_n = SunSpecDataPoint::convertToUInt16(registers + 6, 1);
 
-    if (m_dataPoints.value("DCA").isValid())
-        m_amps = m_dataPoints.value("DCA").toFloatWithSSF(m_dCA_SF);
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 7, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_eventFlags = static_cast<EvtFlags>(SunSpecDataPoint::convertToUInt32(registers + 7, 2, m_byteOrder));
 
-    if (m_dataPoints.value("DCAhr").isValid())
-        m_ampHours = m_dataPoints.value("DCAhr").toFloatWithSSF(m_dCAhr_SF);
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 9, 2, SunSpecDataPoint::BitField32, m_byteOrder))
+        m_vendorEvent = SunSpecDataPoint::convertToUInt32(registers + 9, 2, m_byteOrder);
 
-    if (m_dataPoints.value("DCV").isValid())
-        m_voltage = m_dataPoints.value("DCV").toFloatWithSSF(m_dCV_SF);
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_amps = SunSpecDataPoint::convertToInt16(registers + 11, 1) * m_dCA_SFMultiplier;
 
-    if (m_dataPoints.value("Tmp").isValid())
-        m_temp = m_dataPoints.value("Tmp").toInt16();
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 12, 2, SunSpecDataPoint::Acc32, m_byteOrder))
+        m_ampHours = SunSpecDataPoint::convertToUInt32(registers + 12, 2, m_byteOrder) * m_dCAhr_SFMultiplier;
 
-    if (m_dataPoints.value("InDCA_SF").isValid())
-        m_inDCA_SF = m_dataPoints.value("InDCA_SF").toInt16();
+    if (registerCount >= 15 && SunSpecDataPoint::isValid(registers + 14, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_voltage = SunSpecDataPoint::convertToInt16(registers + 14, 1) * m_dCV_SFMultiplier;
 
-    if (m_dataPoints.value("InDCAhr_SF").isValid())
-        m_inDCAhr_SF = m_dataPoints.value("InDCAhr_SF").toInt16();
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 15, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_temp = SunSpecDataPoint::convertToInt16(registers + 15, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -482,57 +314,57 @@ void SunSpecStringCombinerCurrentModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecStringCombinerCurrentModel *model)
 {
     debug.nospace().noquote() << "SunSpecStringCombinerCurrentModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("DCAMax") << "-->";
-    if (model->dataPoints().value("DCAMax").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexRating) << "-->";
+    if (model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexRating).isValid()) {
         debug.nospace().noquote() << model->rating() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("N") << "-->";
-    if (model->dataPoints().value("N").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexN) << "-->";
+    if (model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexN).isValid()) {
         debug.nospace().noquote() << model->n() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Evt") << "-->";
-    if (model->dataPoints().value("Evt").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexEventFlags) << "-->";
+    if (model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexEventFlags).isValid()) {
         debug.nospace().noquote() << model->eventFlags() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("EvtVnd") << "-->";
-    if (model->dataPoints().value("EvtVnd").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexVendorEvent) << "-->";
+    if (model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexVendorEvent).isValid()) {
         debug.nospace().noquote() << model->vendorEvent() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("DCA") << "-->";
-    if (model->dataPoints().value("DCA").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexAmps) << "-->";
+    if (model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexAmps).isValid()) {
         debug.nospace().noquote() << model->amps() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("DCAhr") << "-->";
-    if (model->dataPoints().value("DCAhr").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexAmpHours) << "-->";
+    if (model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexAmpHours).isValid()) {
         debug.nospace().noquote() << model->ampHours() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("DCV") << "-->";
-    if (model->dataPoints().value("DCV").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexVoltage) << "-->";
+    if (model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexVoltage).isValid()) {
         debug.nospace().noquote() << model->voltage() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Tmp") << "-->";
-    if (model->dataPoints().value("Tmp").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexTemp) << "-->";
+    if (model->dataPoint(SunSpecStringCombinerCurrentModel::DataPointIndexTemp).isValid()) {
         debug.nospace().noquote() << model->temp() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
@@ -68,6 +68,14 @@ public:
     Q_DECLARE_FLAGS(InevtFlags, Inevt)
     Q_FLAG(Inevt)
 
+    enum DataPointIndex {
+        DataPointIndexId = 0,
+        DataPointIndexInputEvent,
+        DataPointIndexInputEventVendor,
+        DataPointIndexAmps,
+        DataPointIndexAmpHours
+    };
+
     explicit SunSpecStringCombinerCurrentModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecStringCombinerCurrentModel *parent = nullptr);
     ~SunSpecStringCombinerCurrentModelRepeatingBlock() override = default;
 
@@ -132,6 +140,24 @@ public:
     Q_DECLARE_FLAGS(EvtFlags, Evt)
     Q_FLAG(Evt)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexDCA_SF,
+        DataPointIndexDCAhr_SF,
+        DataPointIndexDCV_SF,
+        DataPointIndexRating,
+        DataPointIndexN,
+        DataPointIndexEventFlags,
+        DataPointIndexVendorEvent,
+        DataPointIndexAmps,
+        DataPointIndexAmpHours,
+        DataPointIndexVoltage,
+        DataPointIndexTemp,
+        DataPointIndexInDCA_SF,
+        DataPointIndexInDCAhr_SF
+    };
+
     explicit SunSpecStringCombinerCurrentModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecStringCombinerCurrentModel() override; 
 
@@ -175,8 +201,11 @@ protected:
 
 private:
     qint16 m_dCA_SF = 0;
+    double m_dCA_SFMultiplier = 1;
     qint16 m_dCAhr_SF = 0;
+    double m_dCAhr_SFMultiplier = 1;
     qint16 m_dCV_SF = 0;
+    double m_dCV_SFMultiplier = 1;
     float m_rating = 0;
     int m_n = 0;
     EvtFlags m_eventFlags;
@@ -186,7 +215,9 @@ private:
     float m_voltage = 0;
     qint16 m_temp = 0;
     qint16 m_inDCA_SF = 0;
+    double m_inDCA_SFMultiplier = 1;
     qint16 m_inDCAhr_SF = 0;
+    double m_inDCAhr_SFMultiplier = 1;
 
 
 };
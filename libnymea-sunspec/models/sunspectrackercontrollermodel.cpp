@@ -31,6 +31,27 @@
 #include "sunspectrackercontrollermodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata repeatingBlockDataPointMetadata[] = {
+    // DataPointIndexTracker
+    { "Id", "Tracker", "Descriptive name for this tracker unit", nullptr, nullptr, "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadOnly, false, 0, 0, 8 },
+    // DataPointIndexTargetElevation
+    { "ElTrgt", "Target Elevation", "Auto target elevation in degrees from horizontal.  Unimplemented for single axis azimuth tracker type", nullptr, "Degrees", "int32", "Dgr_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadOnly, false, 8, 6, 2 },
+    // DataPointIndexTargetAzimuth
+    { "AzTrgt", "Target Azimuth", "Auto target azimuth  in degrees from true north towards east.  Unimplemented for single axis horizontal tracker type", nullptr, "Degrees", "int32", "Dgr_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadOnly, false, 10, 8, 2 },
+    // DataPointIndexElevation
+    { "ElPos", "Elevation", "Actual elevation position  in degrees from horizontal.  Unimplemented for single axis azimuth tracker type", nullptr, "Degrees", "int32", "Dgr_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadOnly, false, 12, 10, 2 },
+    // DataPointIndexAzimuth
+    { "AzPos", "Azimuth", "Actual azimuth position  in degrees from true north towards east.  Unimplemented for single axis horizontal tracker type", nullptr, "Degrees", "int32", "Dgr_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadOnly, false, 14, 12, 2 },
+    // DataPointIndexManualElevation
+    { "ElCtl", "Manual Elevation", "Manual override target position of elevation in degrees from horizontal.  Unimplemented for single axis azimuth tracker type", nullptr, "Degrees", "int32", "Dgr_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 16, 14, 2 },
+    // DataPointIndexManualAzimuth
+    { "AzCtl", "Manual Azimuth", "Manual override target position of azimuth in degrees from true north towards east.  Unimplemented for single axis azimuth tracker type", nullptr, "Degrees", "int32", "Dgr_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 18, 16, 2 },
+    // DataPointIndexMode
+    { "Ctl", "Mode", "Control register. Normal operation is automatic.  Operator can override the position by setting the ElCtl, AzCtl and enabling Manual operation. Entering calibration mode will revert to automatic operation after calibration is complete.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, false, 20, 18, 1 },
+    // DataPointIndexAlarm
+    { "Alm", "Alarm", "Tracker alarm conditions", nullptr, nullptr, "bitfield16", nullptr, SunSpecDataPoint::BitField16, SunSpecDataPoint::AccessReadOnly, false, 21, 19, 1 }
+};
+
 SunSpecTrackerControllerModelRepeatingBlock::SunSpecTrackerControllerModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecTrackerControllerModel *parent) :
     SunSpecModelRepeatingBlock(blockIndex, blockSize, modbusStartRegister, parent)
 {
@@ -75,7 +96,7 @@ float SunSpecTrackerControllerModelRepeatingBlock::manualElevation() const
 
 QModbusReply *SunSpecTrackerControllerModelRepeatingBlock::setManualElevation(float manualElevation)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("ElCtl");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexManualElevation]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(manualElevation);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -91,7 +112,7 @@ float SunSpecTrackerControllerModelRepeatingBlock::manualAzimuth() const
 
 QModbusReply *SunSpecTrackerControllerModelRepeatingBlock::setManualAzimuth(float manualAzimuth)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("AzCtl");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexManualAzimuth]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(manualAzimuth);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -107,7 +128,7 @@ SunSpecTrackerControllerModelRepeatingBlock::Ctl SunSpecTrackerControllerModelRe
 
 QModbusReply *SunSpecTrackerControllerModelRepeatingBlock::setMode(Ctl mode)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("Ctl");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexMode]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(mode));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -123,158 +144,79 @@ SunSpecTrackerControllerModelRepeatingBlock::AlmFlags SunSpecTrackerControllerMo
 
 void SunSpecTrackerControllerModelRepeatingBlock::initDataPoints()
 {
-    SunSpecDataPoint trackerDataPoint;
-    trackerDataPoint.setName("Id");
-    trackerDataPoint.setLabel("Tracker");
-    trackerDataPoint.setDescription("Descriptive name for this tracker unit");
-    trackerDataPoint.setSize(8);
-    trackerDataPoint.setAddressOffset(0);
-    trackerDataPoint.setSunSpecDataType("string");
-    trackerDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(trackerDataPoint.name(), trackerDataPoint);
-
-    SunSpecDataPoint targetElevationDataPoint;
-    targetElevationDataPoint.setName("ElTrgt");
-    targetElevationDataPoint.setLabel("Target Elevation");
-    targetElevationDataPoint.setDescription("Auto target elevation in degrees from horizontal.  Unimplemented for single axis azimuth tracker type");
-    targetElevationDataPoint.setUnits("Degrees");
-    targetElevationDataPoint.setSize(2);
-    targetElevationDataPoint.setAddressOffset(8);
-    targetElevationDataPoint.setBlockOffset(6);
-    targetElevationDataPoint.setScaleFactorName("Dgr_SF");
-    targetElevationDataPoint.setSunSpecDataType("int32");
-    targetElevationDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(targetElevationDataPoint.name(), targetElevationDataPoint);
-
-    SunSpecDataPoint targetAzimuthDataPoint;
-    targetAzimuthDataPoint.setName("AzTrgt");
-    targetAzimuthDataPoint.setLabel("Target Azimuth");
-    targetAzimuthDataPoint.setDescription("Auto target azimuth  in degrees from true north towards east.  Unimplemented for single axis horizontal tracker type");
-    targetAzimuthDataPoint.setUnits("Degrees");
-    targetAzimuthDataPoint.setSize(2);
-    targetAzimuthDataPoint.setAddressOffset(10);
-    targetAzimuthDataPoint.setBlockOffset(8);
-    targetAzimuthDataPoint.setScaleFactorName("Dgr_SF");
-    targetAzimuthDataPoint.setSunSpecDataType("int32");
-    targetAzimuthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(targetAzimuthDataPoint.name(), targetAzimuthDataPoint);
-
-    SunSpecDataPoint elevationDataPoint;
-    elevationDataPoint.setName("ElPos");
-    elevationDataPoint.setLabel("Elevation");
-    elevationDataPoint.setDescription("Actual elevation position  in degrees from horizontal.  Unimplemented for single axis azimuth tracker type");
-    elevationDataPoint.setUnits("Degrees");
-    elevationDataPoint.setSize(2);
-    elevationDataPoint.setAddressOffset(12);
-    elevationDataPoint.setBlockOffset(10);
-    elevationDataPoint.setScaleFactorName("Dgr_SF");
-    elevationDataPoint.setSunSpecDataType("int32");
-    elevationDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(elevationDataPoint.name(), elevationDataPoint);
-
-    SunSpecDataPoint azimuthDataPoint;
-    azimuthDataPoint.setName("AzPos");
-    azimuthDataPoint.setLabel("Azimuth");
-    azimuthDataPoint.setDescription("Actual azimuth position  in degrees from true north towards east.  Unimplemented for single axis horizontal tracker type");
-    azimuthDataPoint.setUnits("Degrees");
-    azimuthDataPoint.setSize(2);
-    azimuthDataPoint.setAddressOffset(14);
-    azimuthDataPoint.setBlockOffset(12);
-    azimuthDataPoint.setScaleFactorName("Dgr_SF");
-    azimuthDataPoint.setSunSpecDataType("int32");
-    azimuthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(azimuthDataPoint.name(), azimuthDataPoint);
-
-    SunSpecDataPoint manualElevationDataPoint;
-    manualElevationDataPoint.setName("ElCtl");
-    manualElevationDataPoint.setLabel("Manual Elevation");
-    manualElevationDataPoint.setDescription("Manual override target position of elevation in degrees from horizontal.  Unimplemented for single axis azimuth tracker type");
-    manualElevationDataPoint.setUnits("Degrees");
-    manualElevationDataPoint.setSize(2);
-    manualElevationDataPoint.setAddressOffset(16);
-    manualElevationDataPoint.setBlockOffset(14);
-    manualElevationDataPoint.setScaleFactorName("Dgr_SF");
-    manualElevationDataPoint.setSunSpecDataType("int32");
-    manualElevationDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    manualElevationDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(manualElevationDataPoint.name(), manualElevationDataPoint);
-
-    SunSpecDataPoint manualAzimuthDataPoint;
-    manualAzimuthDataPoint.setName("AzCtl");
-    manualAzimuthDataPoint.setLabel("Manual Azimuth");
-    manualAzimuthDataPoint.setDescription("Manual override target position of azimuth in degrees from true north towards east.  Unimplemented for single axis azimuth tracker type");
-    manualAzimuthDataPoint.setUnits("Degrees");
-    manualAzimuthDataPoint.setSize(2);
-    manualAzimuthDataPoint.setAddressOffset(18);
-    manualAzimuthDataPoint.setBlockOffset(16);
-    manualAzimuthDataPoint.setScaleFactorName("Dgr_SF");
-    manualAzimuthDataPoint.setSunSpecDataType("int32");
-    manualAzimuthDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    manualAzimuthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(manualAzimuthDataPoint.name(), manualAzimuthDataPoint);
-
-    SunSpecDataPoint modeDataPoint;
-    modeDataPoint.setName("Ctl");
-    modeDataPoint.setLabel("Mode");
-    modeDataPoint.setDescription("Control register. Normal operation is automatic.  Operator can override the position by setting the ElCtl, AzCtl and enabling Manual operation. Entering calibration mode will revert to automatic operation after calibration is complete.");
-    modeDataPoint.setSize(1);
-    modeDataPoint.setAddressOffset(20);
-    modeDataPoint.setBlockOffset(18);
-    modeDataPoint.setSunSpecDataType("enum16");
-    modeDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    modeDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modeDataPoint.name(), modeDataPoint);
-
-    SunSpecDataPoint alarmDataPoint;
-    alarmDataPoint.setName("Alm");
-    alarmDataPoint.setLabel("Alarm");
-    alarmDataPoint.setDescription("Tracker alarm conditions");
-    alarmDataPoint.setSize(1);
-    alarmDataPoint.setAddressOffset(21);
-    alarmDataPoint.setBlockOffset(19);
-    alarmDataPoint.setSunSpecDataType("bitfield16");
-    alarmDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(alarmDataPoint.name(), alarmDataPoint);
-
+    m_dataPointMetadata = repeatingBlockDataPointMetadata;
+    m_dataPointCount = 9;
 }
 
 void SunSpecTrackerControllerModelRepeatingBlock::processBlockData(const QVector<quint16> blockData)
 {
     m_blockData = blockData;
 
+    const quint16 *registers = m_blockData.constData();
+    const int registerCount = m_blockData.count();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("Id").isValid())
-        m_tracker = m_dataPoints.value("Id").toString();
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 0, 8, SunSpecDataPoint::String, m_byteOrder))
+        m_tracker = SunSpecDataPoint::convertToString(registers + 0, 8);
 
-    if (m_dataPoints.value("ElTrgt").isValid())
-        m_targetElevation = m_dataPoints.value("ElTrgt").toFloatWithSSF(m_parentModel->sf());
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 8, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_targetElevation = SunSpecDataPoint::convertToInt32(registers + 8, 2, m_byteOrder) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->sf());
 
-    if (m_dataPoints.value("AzTrgt").isValid())
-        m_targetAzimuth = m_dataPoints.value("AzTrgt").toFloatWithSSF(m_parentModel->sf());
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 10, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_targetAzimuth = SunSpecDataPoint::convertToInt32(registers + 10, 2, m_byteOrder) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->sf());
 
-    if (m_dataPoints.value("ElPos").isValid())
-        m_elevation = m_dataPoints.value("ElPos").toFloatWithSSF(m_parentModel->sf());
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 12, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_elevation = SunSpecDataPoint::convertToInt32(registers + 12, 2, m_byteOrder) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->sf());
 
-    if (m_dataPoints.value("AzPos").isValid())
-        m_azimuth = m_dataPoints.value("AzPos").toFloatWithSSF(m_parentModel->sf());
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 14, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_azimuth = SunSpecDataPoint::convertToInt32(registers + 14, 2, m_byteOrder) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->sf());
 
-    if (m_dataPoints.value("ElCtl").isValid())
-        m_manualElevation = m_dataPoints.value("ElCtl").toFloatWithSSF(m_parentModel->sf());
+    if (registerCount >= 18 && SunSpecDataPoint::isValid(registers + 16, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_manualElevation = SunSpecDataPoint::convertToInt32(registers + 16, 2, m_byteOrder) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->sf());
 
-    if (m_dataPoints.value("AzCtl").isValid())
-        m_manualAzimuth = m_dataPoints.value("AzCtl").toFloatWithSSF(m_parentModel->sf());
+    if (registerCount >= 20 && SunSpecDataPoint::isValid(registers + 18, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_manualAzimuth = SunSpecDataPoint::convertToInt32(registers + 18, 2, m_byteOrder) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->sf());
 
-    if (m_dataPoints.value("Ctl").isValid())
-        m_mode = static_cast<Ctl>(m_dataPoints.value("Ctl").toUInt16());
+    if (registerCount >= 21 && SunSpecDataPoint::isValid(registers + 20, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_mode = static_cast<Ctl>(SunSpecDataPoint::convertToUInt16(registers + 20, 1));
 
-    if (m_dataPoints.value("Alm").isValid())
-        m_alarm = static_cast<AlmFlags>(m_dataPoints.value("Alm").toUInt16());
+    if (registerCount >= 22 && SunSpecDataPoint::isValid(registers + 21, 1, SunSpecDataPoint::BitField16, m_byteOrder))
+        m_alarm = static_cast<AlmFlags>(SunSpecDataPoint::convertToUInt16(registers + 21, 1));
 
 
     qCDebug(dcSunSpecModelData()) << this;
 }
 
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexController
+    { "Nam", "Controller", "Descriptive name for this control unit", nullptr, nullptr, "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadOnly, false, 2, 0, 8 },
+    // DataPointIndexType
+    { "Typ", "Type", "Type of tracker", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, true, 10, 8, 1 },
+    // DataPointIndexDate
+    { "DtLoc", "Date", "Local date in YYYYMMDD format", nullptr, "YYYYMMDD", "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadOnly, false, 11, 9, 5 },
+    // DataPointIndexTime
+    { "TmLoc", "Time", "24 hour local time stamp to second", nullptr, "hhmmss", "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadOnly, false, 16, 14, 3 },
+    // DataPointIndexDay
+    { "Day", "Day", "Number of the day in the year (1-366)", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 19, 17, 1 },
+    // DataPointIndexManualElevation
+    { "GlblElCtl", "Manual Elevation", "Global manual override target position of elevation in degrees from horizontal.  Unimplemented for single axis azimuth tracker type", nullptr, "Degrees", "int32", "Dgr_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 20, 18, 2 },
+    // DataPointIndexManualAzimuth
+    { "GlblAzCtl", "Manual Azimuth", "Global manual override target position of azimuth in degrees from true north towards east.  Unimplemented for single axis azimuth tracker type", nullptr, "Degrees", "int32", "Dgr_SF", SunSpecDataPoint::Int32, SunSpecDataPoint::AccessReadWrite, false, 22, 20, 2 },
+    // DataPointIndexGlobalMode
+    { "GlblCtl", "Global Mode", "Global Control register operates on all trackers. Normal operation is automatic.  Operator can override the position by setting the ElCtl, AzCtl and enabling Manual operation. Entering calibration mode will revert to automatic operation after calibration is complete.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, false, 24, 22, 1 },
+    // DataPointIndexGlobalAlarm
+    { "GlblAlm", "Global Alarm", "Global tracker alarm conditions", nullptr, nullptr, "bitfield16", nullptr, SunSpecDataPoint::BitField16, SunSpecDataPoint::AccessReadOnly, false, 25, 23, 1 },
+    // DataPointIndexSf
+    { "Dgr_SF", "SF", "Scale Factor for targets and position measurements in degrees", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 26, 24, 1 },
+    // DataPointIndexTrackers
+    { "N", "Trackers", "Number of trackers being controlled.  Size of repeating block.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 27, 25, 1 }
+};
+
 SunSpecTrackerControllerModel::SunSpecTrackerControllerModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 601, modelLength, byteOrder, parent)
 {
@@ -333,7 +275,7 @@ QModbusReply *SunSpecTrackerControllerModel::setManualElevation(float manualElev
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("GlblElCtl");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexManualElevation]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(manualElevation);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -351,7 +293,7 @@ QModbusReply *SunSpecTrackerControllerModel::setManualAzimuth(float manualAzimut
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("GlblAzCtl");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexManualAzimuth]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromInt32(manualAzimuth);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -369,7 +311,7 @@ QModbusReply *SunSpecTrackerControllerModel::setGlobalMode(Glblctl globalMode)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("GlblCtl");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexGlobalMode]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(globalMode));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -391,203 +333,55 @@ quint16 SunSpecTrackerControllerModel::trackers() const
 }
 void SunSpecTrackerControllerModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint controllerDataPoint;
-    controllerDataPoint.setName("Nam");
-    controllerDataPoint.setLabel("Controller");
-    controllerDataPoint.setDescription("Descriptive name for this control unit");
-    controllerDataPoint.setSize(8);
-    controllerDataPoint.setAddressOffset(2);
-    controllerDataPoint.setBlockOffset(0);
-    controllerDataPoint.setSunSpecDataType("string");
-    controllerDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(controllerDataPoint.name(), controllerDataPoint);
-
-    SunSpecDataPoint typeDataPoint;
-    typeDataPoint.setName("Typ");
-    typeDataPoint.setLabel("Type");
-    typeDataPoint.setDescription("Type of tracker");
-    typeDataPoint.setMandatory(true);
-    typeDataPoint.setSize(1);
-    typeDataPoint.setAddressOffset(10);
-    typeDataPoint.setBlockOffset(8);
-    typeDataPoint.setSunSpecDataType("enum16");
-    typeDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(typeDataPoint.name(), typeDataPoint);
-
-    SunSpecDataPoint dateDataPoint;
-    dateDataPoint.setName("DtLoc");
-    dateDataPoint.setLabel("Date");
-    dateDataPoint.setDescription("Local date in YYYYMMDD format");
-    dateDataPoint.setUnits("YYYYMMDD");
-    dateDataPoint.setSize(5);
-    dateDataPoint.setAddressOffset(11);
-    dateDataPoint.setBlockOffset(9);
-    dateDataPoint.setSunSpecDataType("string");
-    dateDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(dateDataPoint.name(), dateDataPoint);
-
-    SunSpecDataPoint timeDataPoint;
-    timeDataPoint.setName("TmLoc");
-    timeDataPoint.setLabel("Time");
-    timeDataPoint.setDescription("24 hour local time stamp to second");
-    timeDataPoint.setUnits("hhmmss");
-    timeDataPoint.setSize(3);
-    timeDataPoint.setAddressOffset(16);
-    timeDataPoint.setBlockOffset(14);
-    timeDataPoint.setSunSpecDataType("string");
-    timeDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(timeDataPoint.name(), timeDataPoint);
-
-    SunSpecDataPoint dayDataPoint;
-    dayDataPoint.setName("Day");
-    dayDataPoint.setLabel("Day");
-    dayDataPoint.setDescription("Number of the day in the year (1-366)");
-    dayDataPoint.setSize(1);
-    dayDataPoint.setAddressOffset(19);
-    dayDataPoint.setBlockOffset(17);
-    dayDataPoint.setSunSpecDataType("uint16");
-    dayDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(dayDataPoint.name(), dayDataPoint);
-
-    SunSpecDataPoint manualElevationDataPoint;
-    manualElevationDataPoint.setName("GlblElCtl");
-    manualElevationDataPoint.setLabel("Manual Elevation");
-    manualElevationDataPoint.setDescription("Global manual override target position of elevation in degrees from horizontal.  Unimplemented for single axis azimuth tracker type");
-    manualElevationDataPoint.setUnits("Degrees");
-    manualElevationDataPoint.setSize(2);
-    manualElevationDataPoint.setAddressOffset(20);
-    manualElevationDataPoint.setBlockOffset(18);
-    manualElevationDataPoint.setScaleFactorName("Dgr_SF");
-    manualElevationDataPoint.setSunSpecDataType("int32");
-    manualElevationDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    manualElevationDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(manualElevationDataPoint.name(), manualElevationDataPoint);
-
-    SunSpecDataPoint manualAzimuthDataPoint;
-    manualAzimuthDataPoint.setName("GlblAzCtl");
-    manualAzimuthDataPoint.setLabel("Manual Azimuth");
-    manualAzimuthDataPoint.setDescription("Global manual override target position of azimuth in degrees from true north towards east.  Unimplemented for single axis azimuth tracker type");
-    manualAzimuthDataPoint.setUnits("Degrees");
-    manualAzimuthDataPoint.setSize(2);
-    manualAzimuthDataPoint.setAddressOffset(22);
-    manualAzimuthDataPoint.setBlockOffset(20);
-    manualAzimuthDataPoint.setScaleFactorName("Dgr_SF");
-    manualAzimuthDataPoint.setSunSpecDataType("int32");
-    manualAzimuthDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    manualAzimuthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(manualAzimuthDataPoint.name(), manualAzimuthDataPoint);
-
-    SunSpecDataPoint globalModeDataPoint;
-    globalModeDataPoint.setName("GlblCtl");
-    globalModeDataPoint.setLabel("Global Mode");
-    globalModeDataPoint.setDescription("Global Control register operates on all trackers. Normal operation is automatic.  Operator can override the position by setting the ElCtl, AzCtl and enabling Manual operation. Entering calibration mode will revert to automatic operation after calibration is complete.");
-    globalModeDataPoint.setSize(1);
-    globalModeDataPoint.setAddressOffset(24);
-    globalModeDataPoint.setBlockOffset(22);
-    globalModeDataPoint.setSunSpecDataType("enum16");
-    globalModeDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    globalModeDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(globalModeDataPoint.name(), globalModeDataPoint);
-
-    SunSpecDataPoint globalAlarmDataPoint;
-    globalAlarmDataPoint.setName("GlblAlm");
-    globalAlarmDataPoint.setLabel("Global Alarm");
-    globalAlarmDataPoint.setDescription("Global tracker alarm conditions");
-    globalAlarmDataPoint.setSize(1);
-    globalAlarmDataPoint.setAddressOffset(25);
-    globalAlarmDataPoint.setBlockOffset(23);
-    globalAlarmDataPoint.setSunSpecDataType("bitfield16");
-    globalAlarmDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(globalAlarmDataPoint.name(), globalAlarmDataPoint);
-
-    SunSpecDataPoint sfDataPoint;
-    sfDataPoint.setName("Dgr_SF");
-    sfDataPoint.setLabel("SF");
-    sfDataPoint.setDescription("Scale Factor for targets and position measurements in degrees");
-    sfDataPoint.setMandatory(true);
-    sfDataPoint.setSize(1);
-    sfDataPoint.setAddressOffset(26);
-    sfDataPoint.setBlockOffset(24);
-    sfDataPoint.setSunSpecDataType("sunssf");
-    sfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(sfDataPoint.name(), sfDataPoint);
-
-    SunSpecDataPoint trackersDataPoint;
-    trackersDataPoint.setName("N");
-    trackersDataPoint.setLabel("Trackers");
-    trackersDataPoint.setDescription("Number of trackers being controlled.  Size of repeating block.");
-    trackersDataPoint.setMandatory(true);
-    trackersDataPoint.setSize(1);
-    trackersDataPoint.setAddressOffset(27);
-    trackersDataPoint.setBlockOffset(25);
-    trackersDataPoint.setSunSpecDataType("uint16");
-    trackersDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(trackersDataPoint.name(), trackersDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 13;
 }
 
 void SunSpecTrackerControllerModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("Dgr_SF").isValid())
-        m_sf = m_dataPoints.value("Dgr_SF").toInt16();
+    if (registerCount >= 27 && SunSpecDataPoint::isValid(registers + 26, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 26, 1);
+        if (scaleFactor != m_sf) {
+            m_sf = scaleFactor;
+            m_sfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("Nam").isValid())
-        m_controller = m_dataPoints.value("Nam").toString();
-
-    if (m_dataPoints.value("Typ").isValid())
-        m_type = static_cast<Typ>(m_dataPoints.value("Typ").toUInt16());
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 2, 8, SunSpecDataPoint::String, m_byteOrder))
+        m_controller = SunSpecDataPoint::convertToString(registers + 2, 8);
 
-    if (m_dataPoints.value("DtLoc").isValid())
-        m_date = m_dataPoints.value("DtLoc").toString();
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_type = static_cast<Typ>(SunSpecDataPoint::convertToUInt16(registers + 10, 1));
 
-    if (m_dataPoints.value("TmLoc").isValid())
-        m_time = m_dataPoints.value("TmLoc").toString();
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 11, 5, SunSpecDataPoint::String, m_byteOrder))
+        m_date = SunSpecDataPoint::convertToString(registers + 11, 5);
 
-    if (m_dataPoints.value("Day").isValid())
-        m_day = m_dataPoints.value("Day").toUInt16();
+    if (registerCount >= 19 && SunSpecDataPoint::isValid(registers + 16, 3, SunSpecDataPoint::String, m_byteOrder))
+        m_time = SunSpecDataPoint::convertToString(registers + 16, 3);
 
-    if (m_dataPoints.value("GlblElCtl").isValid())
-        m_manualElevation = m_dataPoints.value("GlblElCtl").toFloatWithSSF(m_sf);
+    if (registerCount >= 20 && SunSpecDataPoint::isValid(registers + 19, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_day = SunSpecDataPoint::convertToUInt16(registers + 19, 1);
 
-    if (m_dataPoints.value("GlblAzCtl").isValid())
-        m_manualAzimuth = m_dataPoints.value("GlblAzCtl").toFloatWithSSF(m_sf);
+    if (registerCount >= 22 && SunSpecDataPoint::isValid(registers + 20, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_manualElevation = SunSpecDataPoint::convertToInt32(registers + 20, 2, m_byteOrder) * m_sfMultiplier;
 
-    if (m_dataPoints.value("GlblCtl").isValid())
-        m_globalMode = static_cast<Glblctl>(m_dataPoints.value("GlblCtl").toUInt16());
+    if (registerCount >= 24 && SunSpecDataPoint::isValid(registers + 22, 2, SunSpecDataPoint::Int32, m_byteOrder))
+        m_manualAzimuth = SunSpecDataPoint::convertToInt32(registers + 22, 2, m_byteOrder) * m_sfMultiplier;
 
-    if (m_dataPoints.value("GlblAlm").isValid())
-        m_globalAlarm = static_cast<GlblalmFlags>(m_dataPoints.value("GlblAlm").toUInt16());
+    if (registerCount >= 25 && SunSpecDataPoint::isValid(registers + 24, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_globalMode = static_cast<Glblctl>(SunSpecDataPoint::convertToUInt16(registers + 24, 1));
 
-    if (m_dataPoints.value("Dgr_SF").isValid())
-        m_sf = m_dataPoints.value("Dgr_SF").toInt16();
+    if (registerCount >= 26 && SunSpecDataPoint::isValid(registers + 25, 1, SunSpecDataPoint::BitField16, m_byteOrder))
+        m_globalAlarm = static_cast<GlblalmFlags>(SunSpecDataPoint::convertToUInt16(registers + 25, 1));
 
-    if (m_dataPoints.value("N").isValid())
-        m_trackers = m_dataPoints.value("N").toUInt16();
+    if (registerCount >= 28 && SunSpecDataPoint::isValid(registers + 27, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_trackers = SunSpecDataPoint::convertToUInt16(registers + 27, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -596,71 +390,71 @@ void SunSpecTrackerControllerModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecTrackerControllerModel *model)
 {
     debug.nospace().noquote() << "SunSpecTrackerControllerModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Nam") << "-->";
-    if (model->dataPoints().value("Nam").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexController) << "-->";
+    if (model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexController).isValid()) {
         debug.nospace().noquote() << model->controller() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Typ") << "-->";
-    if (model->dataPoints().value("Typ").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexType) << "-->";
+    if (model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexType).isValid()) {
         debug.nospace().noquote() << model->type() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("DtLoc") << "-->";
-    if (model->dataPoints().value("DtLoc").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexDate) << "-->";
+    if (model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexDate).isValid()) {
         debug.nospace().noquote() << model->date() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("TmLoc") << "-->";
-    if (model->dataPoints().value("TmLoc").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexTime) << "-->";
+    if (model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexTime).isValid()) {
         debug.nospace().noquote() << model->time() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("Day") << "-->";
-    if (model->dataPoints().value("Day").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexDay) << "-->";
+    if (model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexDay).isValid()) {
         debug.nospace().noquote() << model->day() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("GlblElCtl") << "-->";
-    if (model->dataPoints().value("GlblElCtl").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexManualElevation) << "-->";
+    if (model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexManualElevation).isValid()) {
         debug.nospace().noquote() << model->manualElevation() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("GlblAzCtl") << "-->";
-    if (model->dataPoints().value("GlblAzCtl").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexManualAzimuth) << "-->";
+    if (model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexManualAzimuth).isValid()) {
         debug.nospace().noquote() << model->manualAzimuth() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("GlblCtl") << "-->";
-    if (model->dataPoints().value("GlblCtl").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexGlobalMode) << "-->";
+    if (model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexGlobalMode).isValid()) {
         debug.nospace().noquote() << model->globalMode() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("GlblAlm") << "-->";
-    if (model->dataPoints().value("GlblAlm").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexGlobalAlarm) << "-->";
+    if (model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexGlobalAlarm).isValid()) {
         debug.nospace().noquote() << model->globalAlarm() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("N") << "-->";
-    if (model->dataPoints().value("N").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexTrackers) << "-->";
+    if (model->dataPoint(SunSpecTrackerControllerModel::DataPointIndexTrackers).isValid()) {
         debug.nospace().noquote() << model->trackers() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
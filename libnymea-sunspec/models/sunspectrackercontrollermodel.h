@@ -59,6 +59,18 @@ public:
     Q_DECLARE_FLAGS(AlmFlags, Alm)
     Q_FLAG(Alm)
 
+    enum DataPointIndex {
+        DataPointIndexTracker = 0,
+        DataPointIndexTargetElevation,
+        DataPointIndexTargetAzimuth,
+        DataPointIndexElevation,
+        DataPointIndexAzimuth,
+        DataPointIndexManualElevation,
+        DataPointIndexManualAzimuth,
+        DataPointIndexMode,
+        DataPointIndexAlarm
+    };
+
     explicit SunSpecTrackerControllerModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecTrackerControllerModel *parent = nullptr);
     ~SunSpecTrackerControllerModelRepeatingBlock() override = default;
 
@@ -144,6 +156,22 @@ public:
     Q_DECLARE_FLAGS(GlblalmFlags, Glblalm)
     Q_FLAG(Glblalm)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexController,
+        DataPointIndexType,
+        DataPointIndexDate,
+        DataPointIndexTime,
+        DataPointIndexDay,
+        DataPointIndexManualElevation,
+        DataPointIndexManualAzimuth,
+        DataPointIndexGlobalMode,
+        DataPointIndexGlobalAlarm,
+        DataPointIndexSf,
+        DataPointIndexTrackers
+    };
+
     explicit SunSpecTrackerControllerModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecTrackerControllerModel() override; 
 
@@ -199,6 +227,7 @@ private:
     Glblctl m_globalMode;
     GlblalmFlags m_globalAlarm;
     qint16 m_sf = 0;
+    double m_sfMultiplier = 1;
     quint16 m_trackers = 0;
 
 
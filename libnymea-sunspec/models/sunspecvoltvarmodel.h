@@ -57,6 +57,56 @@ public:
     };
     Q_ENUM(Readonly)
 
+    enum DataPointIndex {
+        DataPointIndexActPt = 0,
+        DataPointIndexDeptRef,
+        DataPointIndexV1,
+        DataPointIndexVAr1,
+        DataPointIndexV2,
+        DataPointIndexVAr2,
+        DataPointIndexV3,
+        DataPointIndexVAr3,
+        DataPointIndexV4,
+        DataPointIndexVAr4,
+        DataPointIndexV5,
+        DataPointIndexVAr5,
+        DataPointIndexV6,
+        DataPointIndexVAr6,
+        DataPointIndexV7,
+        DataPointIndexVAr7,
+        DataPointIndexV8,
+        DataPointIndexVAr8,
+        DataPointIndexV9,
+        DataPointIndexVAr9,
+        DataPointIndexV10,
+        DataPointIndexVAr10,
+        DataPointIndexV11,
+        DataPointIndexVAr11,
+        DataPointIndexV12,
+        DataPointIndexVAr12,
+        DataPointIndexV13,
+        DataPointIndexVAr13,
+        DataPointIndexV14,
+        DataPointIndexVAr14,
+        DataPointIndexV15,
+        DataPointIndexVAr15,
+        DataPointIndexV16,
+        DataPointIndexVAr16,
+        DataPointIndexV17,
+        DataPointIndexVAr17,
+        DataPointIndexV18,
+        DataPointIndexVAr18,
+        DataPointIndexV19,
+        DataPointIndexVAr19,
+        DataPointIndexV20,
+        DataPointIndexVAr20,
+        DataPointIndexCrvNam,
+        DataPointIndexRmpTms,
+        DataPointIndexRmpDecTmm,
+        DataPointIndexRmpIncTmm,
+        DataPointIndexReadOnly
+    };
+
     explicit SunSpecVoltVarModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecVoltVarModel *parent = nullptr);
     ~SunSpecVoltVarModelRepeatingBlock() override = default;
 
@@ -322,6 +372,21 @@ public:
     Q_DECLARE_FLAGS(ModenaFlags, Modena)
     Q_FLAG(Modena)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexActCrv,
+        DataPointIndexModEna,
+        DataPointIndexWinTms,
+        DataPointIndexRvrtTms,
+        DataPointIndexRmpTms,
+        DataPointIndexNCrv,
+        DataPointIndexNPt,
+        DataPointIndexVSf,
+        DataPointIndexDeptRefSf,
+        DataPointIndexRmpIncDec_SF
+    };
+
     explicit SunSpecVoltVarModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecVoltVarModel() override; 
 
@@ -376,8 +441,11 @@ private:
     quint16 m_nCrv = 0;
     quint16 m_nPt = 0;
     qint16 m_vSf = 0;
+    double m_vSfMultiplier = 1;
     qint16 m_deptRefSf = 0;
+    double m_deptRefSfMultiplier = 1;
     qint16 m_rmpIncDec_SF = 0;
+    double m_rmpIncDec_SFMultiplier = 1;
 
 
 };
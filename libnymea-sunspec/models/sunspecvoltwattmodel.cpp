@@ -31,6 +31,103 @@
 #include "sunspecvoltwattmodel.h"
 #include "sunspecconnection.h"
 
+static const SunSpecDataPoint::Metadata repeatingBlockDataPointMetadata[] = {
+    // DataPointIndexActPt
+    { "ActPt", "ActPt", "Number of active points in array.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 0, 0, 1 },
+    // DataPointIndexDeptRef
+    { "DeptRef", "DeptRef", "Defines the meaning of the Watts DeptRef.  1=% WMax 2=% WAvail", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadWrite, true, 1, 0, 1 },
+    // DataPointIndexV1
+    { "V1", "V1", "Point 1 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 2, 0, 1 },
+    // DataPointIndexW1
+    { "W1", "W1", "Point 1 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, true, 3, 1, 1 },
+    // DataPointIndexV2
+    { "V2", "V2", "Point 2 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 4, 2, 1 },
+    // DataPointIndexW2
+    { "W2", "W2", "Point 2 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 5, 3, 1 },
+    // DataPointIndexV3
+    { "V3", "V3", "Point 3 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 6, 4, 1 },
+    // DataPointIndexW3
+    { "W3", "W3", "Point 3 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 7, 5, 1 },
+    // DataPointIndexV4
+    { "V4", "V4", "Point 4 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 8, 6, 1 },
+    // DataPointIndexW4
+    { "W4", "W4", "Point 4 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 9, 7, 1 },
+    // DataPointIndexV5
+    { "V5", "V5", "Point 5 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 10, 8, 1 },
+    // DataPointIndexW5
+    { "W5", "W5", "Point 5 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 11, 9, 1 },
+    // DataPointIndexV6
+    { "V6", "V6", "Point 6 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 12, 10, 1 },
+    // DataPointIndexW6
+    { "W6", "W6", "Point 6 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 13, 11, 1 },
+    // DataPointIndexV7
+    { "V7", "V7", "Point 7 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 14, 12, 1 },
+    // DataPointIndexW7
+    { "W7", "W7", "Point 7 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 15, 13, 1 },
+    // DataPointIndexV8
+    { "V8", "V8", "Point 8 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 16, 14, 1 },
+    // DataPointIndexW8
+    { "W8", "W8", "Point 8 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 17, 15, 1 },
+    // DataPointIndexV9
+    { "V9", "V9", "Point 9 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 18, 16, 1 },
+    // DataPointIndexW9
+    { "W9", "W9", "Point 9 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 19, 17, 1 },
+    // DataPointIndexV10
+    { "V10", "V10", "Point 10 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 20, 18, 1 },
+    // DataPointIndexW10
+    { "W10", "W10", "Point 10 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 21, 19, 1 },
+    // DataPointIndexV11
+    { "V11", "V11", "Point 11 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 22, 20, 1 },
+    // DataPointIndexW11
+    { "W11", "W11", "Point 11 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 23, 21, 1 },
+    // DataPointIndexV12
+    { "V12", "V12", "Point 12 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 24, 22, 1 },
+    // DataPointIndexW12
+    { "W12", "W12", "Point 12 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 25, 23, 1 },
+    // DataPointIndexV13
+    { "V13", "V13", "Point 13 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 26, 24, 1 },
+    // DataPointIndexW13
+    { "W13", "W13", "Point 13 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 27, 25, 1 },
+    // DataPointIndexV14
+    { "V14", "V14", "Point 14 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 28, 26, 1 },
+    // DataPointIndexW14
+    { "W14", "W14", "Point 14 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 29, 27, 1 },
+    // DataPointIndexV15
+    { "V15", "V15", "Point 15 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 30, 28, 1 },
+    // DataPointIndexW15
+    { "W15", "W15", "Point 15 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 31, 29, 1 },
+    // DataPointIndexV16
+    { "V16", "V16", "Point 16 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 32, 30, 1 },
+    // DataPointIndexW16
+    { "W16", "W16", "Point 16 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 33, 31, 1 },
+    // DataPointIndexV17
+    { "V17", "V17", "Point 17 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 34, 32, 1 },
+    // DataPointIndexW17
+    { "W17", "W17", "Point 17 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 35, 33, 1 },
+    // DataPointIndexV18
+    { "V18", "V18", "Point 18 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 36, 34, 1 },
+    // DataPointIndexW18
+    { "W18", "W18", "Point 18 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 37, 35, 1 },
+    // DataPointIndexV19
+    { "V19", "V19", "Point 19 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 38, 36, 1 },
+    // DataPointIndexW19
+    { "W19", "W19", "Point 19 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 39, 37, 1 },
+    // DataPointIndexV20
+    { "V20", "V20", "Point 20 Volts.", nullptr, "% VRef", "uint16", "V_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 40, 38, 1 },
+    // DataPointIndexW20
+    { "W20", "W20", "Point 20 Watts.", nullptr, "% VRef", "int16", "DeptRef_SF", SunSpecDataPoint::Int16, SunSpecDataPoint::AccessReadWrite, false, 41, 39, 1 },
+    // DataPointIndexCrvNam
+    { "CrvNam", "CrvNam", "Optional description for curve.", nullptr, nullptr, "string", nullptr, SunSpecDataPoint::String, SunSpecDataPoint::AccessReadWrite, false, 42, 40, 8 },
+    // DataPointIndexRmpPt1Tms
+    { "RmpPt1Tms", "RmpPt1Tms", "The time of the PT1 in seconds (time to accomplish a change of 95%).", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 50, 48, 1 },
+    // DataPointIndexRmpDecTmm
+    { "RmpDecTmm", "RmpDecTmm", "The maximum rate at which the watt value may be reduced in response to changes in the voltage value.", nullptr, "% WMax/min", "uint16", "RmpIncDec_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 51, 49, 1 },
+    // DataPointIndexRmpIncTmm
+    { "RmpIncTmm", "RmpIncTmm", "The maximum rate at which the watt value may be increased in response to changes in the voltage value.", nullptr, "% WMax/min", "uint16", "RmpIncDec_SF", SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 52, 50, 1 },
+    // DataPointIndexReadOnly
+    { "ReadOnly", "ReadOnly", "Enumerated value indicates if curve is read-only or can be modified.", nullptr, nullptr, "enum16", nullptr, SunSpecDataPoint::Enum16, SunSpecDataPoint::AccessReadOnly, true, 53, 51, 1 }
+};
+
 SunSpecVoltWattModelRepeatingBlock::SunSpecVoltWattModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecVoltWattModel *parent) :
     SunSpecModelRepeatingBlock(blockIndex, blockSize, modbusStartRegister, parent)
 {
@@ -55,7 +152,7 @@ quint16 SunSpecVoltWattModelRepeatingBlock::actPt() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setActPt(quint16 actPt)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("ActPt");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexActPt]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(actPt);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -71,7 +168,7 @@ SunSpecVoltWattModelRepeatingBlock::Deptref SunSpecVoltWattModelRepeatingBlock::
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setDeptRef(Deptref deptRef)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("DeptRef");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexDeptRef]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(deptRef));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -87,7 +184,7 @@ float SunSpecVoltWattModelRepeatingBlock::v1() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV1(float v1)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V1");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV1]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v1, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -103,7 +200,7 @@ float SunSpecVoltWattModelRepeatingBlock::w1() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW1(float w1)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W1");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW1]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w1, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -119,7 +216,7 @@ float SunSpecVoltWattModelRepeatingBlock::v2() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV2(float v2)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V2");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV2]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v2, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -135,7 +232,7 @@ float SunSpecVoltWattModelRepeatingBlock::w2() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW2(float w2)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W2");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW2]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w2, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -151,7 +248,7 @@ float SunSpecVoltWattModelRepeatingBlock::v3() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV3(float v3)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V3");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV3]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v3, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -167,7 +264,7 @@ float SunSpecVoltWattModelRepeatingBlock::w3() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW3(float w3)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W3");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW3]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w3, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -183,7 +280,7 @@ float SunSpecVoltWattModelRepeatingBlock::v4() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV4(float v4)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V4");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV4]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v4, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -199,7 +296,7 @@ float SunSpecVoltWattModelRepeatingBlock::w4() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW4(float w4)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W4");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW4]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w4, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -215,7 +312,7 @@ float SunSpecVoltWattModelRepeatingBlock::v5() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV5(float v5)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V5");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV5]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v5, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -231,7 +328,7 @@ float SunSpecVoltWattModelRepeatingBlock::w5() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW5(float w5)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W5");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW5]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w5, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -247,7 +344,7 @@ float SunSpecVoltWattModelRepeatingBlock::v6() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV6(float v6)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V6");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV6]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v6, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -263,7 +360,7 @@ float SunSpecVoltWattModelRepeatingBlock::w6() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW6(float w6)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W6");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW6]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w6, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -279,7 +376,7 @@ float SunSpecVoltWattModelRepeatingBlock::v7() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV7(float v7)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V7");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV7]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v7, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -295,7 +392,7 @@ float SunSpecVoltWattModelRepeatingBlock::w7() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW7(float w7)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W7");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW7]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w7, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -311,7 +408,7 @@ float SunSpecVoltWattModelRepeatingBlock::v8() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV8(float v8)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V8");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV8]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v8, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -327,7 +424,7 @@ float SunSpecVoltWattModelRepeatingBlock::w8() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW8(float w8)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W8");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW8]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w8, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -343,7 +440,7 @@ float SunSpecVoltWattModelRepeatingBlock::v9() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV9(float v9)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V9");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV9]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v9, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -359,7 +456,7 @@ float SunSpecVoltWattModelRepeatingBlock::w9() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW9(float w9)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W9");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW9]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w9, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -375,7 +472,7 @@ float SunSpecVoltWattModelRepeatingBlock::v10() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV10(float v10)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V10");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV10]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v10, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -391,7 +488,7 @@ float SunSpecVoltWattModelRepeatingBlock::w10() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW10(float w10)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W10");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW10]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w10, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -407,7 +504,7 @@ float SunSpecVoltWattModelRepeatingBlock::v11() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV11(float v11)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V11");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV11]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v11, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -423,7 +520,7 @@ float SunSpecVoltWattModelRepeatingBlock::w11() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW11(float w11)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W11");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW11]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w11, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -439,7 +536,7 @@ float SunSpecVoltWattModelRepeatingBlock::v12() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV12(float v12)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V12");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV12]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v12, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -455,7 +552,7 @@ float SunSpecVoltWattModelRepeatingBlock::w12() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW12(float w12)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W12");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW12]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w12, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -471,7 +568,7 @@ float SunSpecVoltWattModelRepeatingBlock::v13() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV13(float v13)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V13");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV13]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v13, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -487,7 +584,7 @@ float SunSpecVoltWattModelRepeatingBlock::w13() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW13(float w13)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W13");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW13]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w13, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -503,7 +600,7 @@ float SunSpecVoltWattModelRepeatingBlock::v14() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV14(float v14)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V14");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV14]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v14, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -519,7 +616,7 @@ float SunSpecVoltWattModelRepeatingBlock::w14() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW14(float w14)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W14");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW14]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w14, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -535,7 +632,7 @@ float SunSpecVoltWattModelRepeatingBlock::v15() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV15(float v15)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V15");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV15]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v15, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -551,7 +648,7 @@ float SunSpecVoltWattModelRepeatingBlock::w15() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW15(float w15)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W15");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW15]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w15, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -567,7 +664,7 @@ float SunSpecVoltWattModelRepeatingBlock::v16() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV16(float v16)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V16");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV16]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v16, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -583,7 +680,7 @@ float SunSpecVoltWattModelRepeatingBlock::w16() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW16(float w16)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W16");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW16]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w16, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -599,7 +696,7 @@ float SunSpecVoltWattModelRepeatingBlock::v17() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV17(float v17)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V17");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV17]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v17, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -615,7 +712,7 @@ float SunSpecVoltWattModelRepeatingBlock::w17() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW17(float w17)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W17");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW17]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w17, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -631,7 +728,7 @@ float SunSpecVoltWattModelRepeatingBlock::v18() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV18(float v18)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V18");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV18]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v18, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -647,7 +744,7 @@ float SunSpecVoltWattModelRepeatingBlock::w18() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW18(float w18)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W18");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW18]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w18, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -663,7 +760,7 @@ float SunSpecVoltWattModelRepeatingBlock::v19() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV19(float v19)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V19");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV19]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v19, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -679,7 +776,7 @@ float SunSpecVoltWattModelRepeatingBlock::w19() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW19(float w19)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W19");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW19]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w19, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -695,7 +792,7 @@ float SunSpecVoltWattModelRepeatingBlock::v20() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setV20(float v20)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("V20");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexV20]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(v20, m_parentModel->vSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -711,7 +808,7 @@ float SunSpecVoltWattModelRepeatingBlock::w20() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setW20(float w20)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("W20");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexW20]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(w20, m_parentModel->deptRefSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -727,7 +824,7 @@ QString SunSpecVoltWattModelRepeatingBlock::crvNam() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setCrvNam(const QString &crvNam)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("CrvNam");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexCrvNam]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromString(crvNam, dp.size());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -743,7 +840,7 @@ quint16 SunSpecVoltWattModelRepeatingBlock::rmpPt1Tms() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setRmpPt1Tms(quint16 rmpPt1Tms)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("RmpPt1Tms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexRmpPt1Tms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(rmpPt1Tms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -759,7 +856,7 @@ float SunSpecVoltWattModelRepeatingBlock::rmpDecTmm() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setRmpDecTmm(float rmpDecTmm)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("RmpDecTmm");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexRmpDecTmm]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(rmpDecTmm, m_parentModel->rmpIncDecSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -775,7 +872,7 @@ float SunSpecVoltWattModelRepeatingBlock::rmpIncTmm() const
 
 QModbusReply *SunSpecVoltWattModelRepeatingBlock::setRmpIncTmm(float rmpIncTmm)
 {
-    SunSpecDataPoint dp = m_dataPoints.value("RmpIncTmm");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexRmpIncTmm]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromFloatWithSSF(rmpIncTmm, m_parentModel->rmpIncDecSf(), dp.dataType());
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -791,810 +888,191 @@ SunSpecVoltWattModelRepeatingBlock::Readonly SunSpecVoltWattModelRepeatingBlock:
 
 void SunSpecVoltWattModelRepeatingBlock::initDataPoints()
 {
-    SunSpecDataPoint actPtDataPoint;
-    actPtDataPoint.setName("ActPt");
-    actPtDataPoint.setLabel("ActPt");
-    actPtDataPoint.setDescription("Number of active points in array.");
-    actPtDataPoint.setMandatory(true);
-    actPtDataPoint.setSize(1);
-    actPtDataPoint.setAddressOffset(0);
-    actPtDataPoint.setSunSpecDataType("uint16");
-    actPtDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    actPtDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(actPtDataPoint.name(), actPtDataPoint);
-
-    SunSpecDataPoint deptRefDataPoint;
-    deptRefDataPoint.setName("DeptRef");
-    deptRefDataPoint.setLabel("DeptRef");
-    deptRefDataPoint.setDescription("Defines the meaning of the Watts DeptRef.  1=% WMax 2=% WAvail");
-    deptRefDataPoint.setMandatory(true);
-    deptRefDataPoint.setSize(1);
-    deptRefDataPoint.setAddressOffset(1);
-    deptRefDataPoint.setSunSpecDataType("enum16");
-    deptRefDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    deptRefDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(deptRefDataPoint.name(), deptRefDataPoint);
-
-    SunSpecDataPoint v1DataPoint;
-    v1DataPoint.setName("V1");
-    v1DataPoint.setLabel("V1");
-    v1DataPoint.setDescription("Point 1 Volts.");
-    v1DataPoint.setUnits("% VRef");
-    v1DataPoint.setMandatory(true);
-    v1DataPoint.setSize(1);
-    v1DataPoint.setAddressOffset(2);
-    v1DataPoint.setBlockOffset(0);
-    v1DataPoint.setScaleFactorName("V_SF");
-    v1DataPoint.setSunSpecDataType("uint16");
-    v1DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v1DataPoint.name(), v1DataPoint);
-
-    SunSpecDataPoint w1DataPoint;
-    w1DataPoint.setName("W1");
-    w1DataPoint.setLabel("W1");
-    w1DataPoint.setDescription("Point 1 Watts.");
-    w1DataPoint.setUnits("% VRef");
-    w1DataPoint.setMandatory(true);
-    w1DataPoint.setSize(1);
-    w1DataPoint.setAddressOffset(3);
-    w1DataPoint.setBlockOffset(1);
-    w1DataPoint.setScaleFactorName("DeptRef_SF");
-    w1DataPoint.setSunSpecDataType("int16");
-    w1DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w1DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w1DataPoint.name(), w1DataPoint);
-
-    SunSpecDataPoint v2DataPoint;
-    v2DataPoint.setName("V2");
-    v2DataPoint.setLabel("V2");
-    v2DataPoint.setDescription("Point 2 Volts.");
-    v2DataPoint.setUnits("% VRef");
-    v2DataPoint.setSize(1);
-    v2DataPoint.setAddressOffset(4);
-    v2DataPoint.setBlockOffset(2);
-    v2DataPoint.setScaleFactorName("V_SF");
-    v2DataPoint.setSunSpecDataType("uint16");
-    v2DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v2DataPoint.name(), v2DataPoint);
-
-    SunSpecDataPoint w2DataPoint;
-    w2DataPoint.setName("W2");
-    w2DataPoint.setLabel("W2");
-    w2DataPoint.setDescription("Point 2 Watts.");
-    w2DataPoint.setUnits("% VRef");
-    w2DataPoint.setSize(1);
-    w2DataPoint.setAddressOffset(5);
-    w2DataPoint.setBlockOffset(3);
-    w2DataPoint.setScaleFactorName("DeptRef_SF");
-    w2DataPoint.setSunSpecDataType("int16");
-    w2DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w2DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w2DataPoint.name(), w2DataPoint);
-
-    SunSpecDataPoint v3DataPoint;
-    v3DataPoint.setName("V3");
-    v3DataPoint.setLabel("V3");
-    v3DataPoint.setDescription("Point 3 Volts.");
-    v3DataPoint.setUnits("% VRef");
-    v3DataPoint.setSize(1);
-    v3DataPoint.setAddressOffset(6);
-    v3DataPoint.setBlockOffset(4);
-    v3DataPoint.setScaleFactorName("V_SF");
-    v3DataPoint.setSunSpecDataType("uint16");
-    v3DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v3DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v3DataPoint.name(), v3DataPoint);
-
-    SunSpecDataPoint w3DataPoint;
-    w3DataPoint.setName("W3");
-    w3DataPoint.setLabel("W3");
-    w3DataPoint.setDescription("Point 3 Watts.");
-    w3DataPoint.setUnits("% VRef");
-    w3DataPoint.setSize(1);
-    w3DataPoint.setAddressOffset(7);
-    w3DataPoint.setBlockOffset(5);
-    w3DataPoint.setScaleFactorName("DeptRef_SF");
-    w3DataPoint.setSunSpecDataType("int16");
-    w3DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w3DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w3DataPoint.name(), w3DataPoint);
-
-    SunSpecDataPoint v4DataPoint;
-    v4DataPoint.setName("V4");
-    v4DataPoint.setLabel("V4");
-    v4DataPoint.setDescription("Point 4 Volts.");
-    v4DataPoint.setUnits("% VRef");
-    v4DataPoint.setSize(1);
-    v4DataPoint.setAddressOffset(8);
-    v4DataPoint.setBlockOffset(6);
-    v4DataPoint.setScaleFactorName("V_SF");
-    v4DataPoint.setSunSpecDataType("uint16");
-    v4DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v4DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v4DataPoint.name(), v4DataPoint);
-
-    SunSpecDataPoint w4DataPoint;
-    w4DataPoint.setName("W4");
-    w4DataPoint.setLabel("W4");
-    w4DataPoint.setDescription("Point 4 Watts.");
-    w4DataPoint.setUnits("% VRef");
-    w4DataPoint.setSize(1);
-    w4DataPoint.setAddressOffset(9);
-    w4DataPoint.setBlockOffset(7);
-    w4DataPoint.setScaleFactorName("DeptRef_SF");
-    w4DataPoint.setSunSpecDataType("int16");
-    w4DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w4DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w4DataPoint.name(), w4DataPoint);
-
-    SunSpecDataPoint v5DataPoint;
-    v5DataPoint.setName("V5");
-    v5DataPoint.setLabel("V5");
-    v5DataPoint.setDescription("Point 5 Volts.");
-    v5DataPoint.setUnits("% VRef");
-    v5DataPoint.setSize(1);
-    v5DataPoint.setAddressOffset(10);
-    v5DataPoint.setBlockOffset(8);
-    v5DataPoint.setScaleFactorName("V_SF");
-    v5DataPoint.setSunSpecDataType("uint16");
-    v5DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v5DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v5DataPoint.name(), v5DataPoint);
-
-    SunSpecDataPoint w5DataPoint;
-    w5DataPoint.setName("W5");
-    w5DataPoint.setLabel("W5");
-    w5DataPoint.setDescription("Point 5 Watts.");
-    w5DataPoint.setUnits("% VRef");
-    w5DataPoint.setSize(1);
-    w5DataPoint.setAddressOffset(11);
-    w5DataPoint.setBlockOffset(9);
-    w5DataPoint.setScaleFactorName("DeptRef_SF");
-    w5DataPoint.setSunSpecDataType("int16");
-    w5DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w5DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w5DataPoint.name(), w5DataPoint);
-
-    SunSpecDataPoint v6DataPoint;
-    v6DataPoint.setName("V6");
-    v6DataPoint.setLabel("V6");
-    v6DataPoint.setDescription("Point 6 Volts.");
-    v6DataPoint.setUnits("% VRef");
-    v6DataPoint.setSize(1);
-    v6DataPoint.setAddressOffset(12);
-    v6DataPoint.setBlockOffset(10);
-    v6DataPoint.setScaleFactorName("V_SF");
-    v6DataPoint.setSunSpecDataType("uint16");
-    v6DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v6DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v6DataPoint.name(), v6DataPoint);
-
-    SunSpecDataPoint w6DataPoint;
-    w6DataPoint.setName("W6");
-    w6DataPoint.setLabel("W6");
-    w6DataPoint.setDescription("Point 6 Watts.");
-    w6DataPoint.setUnits("% VRef");
-    w6DataPoint.setSize(1);
-    w6DataPoint.setAddressOffset(13);
-    w6DataPoint.setBlockOffset(11);
-    w6DataPoint.setScaleFactorName("DeptRef_SF");
-    w6DataPoint.setSunSpecDataType("int16");
-    w6DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w6DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w6DataPoint.name(), w6DataPoint);
-
-    SunSpecDataPoint v7DataPoint;
-    v7DataPoint.setName("V7");
-    v7DataPoint.setLabel("V7");
-    v7DataPoint.setDescription("Point 7 Volts.");
-    v7DataPoint.setUnits("% VRef");
-    v7DataPoint.setSize(1);
-    v7DataPoint.setAddressOffset(14);
-    v7DataPoint.setBlockOffset(12);
-    v7DataPoint.setScaleFactorName("V_SF");
-    v7DataPoint.setSunSpecDataType("uint16");
-    v7DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v7DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v7DataPoint.name(), v7DataPoint);
-
-    SunSpecDataPoint w7DataPoint;
-    w7DataPoint.setName("W7");
-    w7DataPoint.setLabel("W7");
-    w7DataPoint.setDescription("Point 7 Watts.");
-    w7DataPoint.setUnits("% VRef");
-    w7DataPoint.setSize(1);
-    w7DataPoint.setAddressOffset(15);
-    w7DataPoint.setBlockOffset(13);
-    w7DataPoint.setScaleFactorName("DeptRef_SF");
-    w7DataPoint.setSunSpecDataType("int16");
-    w7DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w7DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w7DataPoint.name(), w7DataPoint);
-
-    SunSpecDataPoint v8DataPoint;
-    v8DataPoint.setName("V8");
-    v8DataPoint.setLabel("V8");
-    v8DataPoint.setDescription("Point 8 Volts.");
-    v8DataPoint.setUnits("% VRef");
-    v8DataPoint.setSize(1);
-    v8DataPoint.setAddressOffset(16);
-    v8DataPoint.setBlockOffset(14);
-    v8DataPoint.setScaleFactorName("V_SF");
-    v8DataPoint.setSunSpecDataType("uint16");
-    v8DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v8DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v8DataPoint.name(), v8DataPoint);
-
-    SunSpecDataPoint w8DataPoint;
-    w8DataPoint.setName("W8");
-    w8DataPoint.setLabel("W8");
-    w8DataPoint.setDescription("Point 8 Watts.");
-    w8DataPoint.setUnits("% VRef");
-    w8DataPoint.setSize(1);
-    w8DataPoint.setAddressOffset(17);
-    w8DataPoint.setBlockOffset(15);
-    w8DataPoint.setScaleFactorName("DeptRef_SF");
-    w8DataPoint.setSunSpecDataType("int16");
-    w8DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w8DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w8DataPoint.name(), w8DataPoint);
-
-    SunSpecDataPoint v9DataPoint;
-    v9DataPoint.setName("V9");
-    v9DataPoint.setLabel("V9");
-    v9DataPoint.setDescription("Point 9 Volts.");
-    v9DataPoint.setUnits("% VRef");
-    v9DataPoint.setSize(1);
-    v9DataPoint.setAddressOffset(18);
-    v9DataPoint.setBlockOffset(16);
-    v9DataPoint.setScaleFactorName("V_SF");
-    v9DataPoint.setSunSpecDataType("uint16");
-    v9DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v9DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v9DataPoint.name(), v9DataPoint);
-
-    SunSpecDataPoint w9DataPoint;
-    w9DataPoint.setName("W9");
-    w9DataPoint.setLabel("W9");
-    w9DataPoint.setDescription("Point 9 Watts.");
-    w9DataPoint.setUnits("% VRef");
-    w9DataPoint.setSize(1);
-    w9DataPoint.setAddressOffset(19);
-    w9DataPoint.setBlockOffset(17);
-    w9DataPoint.setScaleFactorName("DeptRef_SF");
-    w9DataPoint.setSunSpecDataType("int16");
-    w9DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w9DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w9DataPoint.name(), w9DataPoint);
-
-    SunSpecDataPoint v10DataPoint;
-    v10DataPoint.setName("V10");
-    v10DataPoint.setLabel("V10");
-    v10DataPoint.setDescription("Point 10 Volts.");
-    v10DataPoint.setUnits("% VRef");
-    v10DataPoint.setSize(1);
-    v10DataPoint.setAddressOffset(20);
-    v10DataPoint.setBlockOffset(18);
-    v10DataPoint.setScaleFactorName("V_SF");
-    v10DataPoint.setSunSpecDataType("uint16");
-    v10DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v10DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v10DataPoint.name(), v10DataPoint);
-
-    SunSpecDataPoint w10DataPoint;
-    w10DataPoint.setName("W10");
-    w10DataPoint.setLabel("W10");
-    w10DataPoint.setDescription("Point 10 Watts.");
-    w10DataPoint.setUnits("% VRef");
-    w10DataPoint.setSize(1);
-    w10DataPoint.setAddressOffset(21);
-    w10DataPoint.setBlockOffset(19);
-    w10DataPoint.setScaleFactorName("DeptRef_SF");
-    w10DataPoint.setSunSpecDataType("int16");
-    w10DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w10DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w10DataPoint.name(), w10DataPoint);
-
-    SunSpecDataPoint v11DataPoint;
-    v11DataPoint.setName("V11");
-    v11DataPoint.setLabel("V11");
-    v11DataPoint.setDescription("Point 11 Volts.");
-    v11DataPoint.setUnits("% VRef");
-    v11DataPoint.setSize(1);
-    v11DataPoint.setAddressOffset(22);
-    v11DataPoint.setBlockOffset(20);
-    v11DataPoint.setScaleFactorName("V_SF");
-    v11DataPoint.setSunSpecDataType("uint16");
-    v11DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v11DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v11DataPoint.name(), v11DataPoint);
-
-    SunSpecDataPoint w11DataPoint;
-    w11DataPoint.setName("W11");
-    w11DataPoint.setLabel("W11");
-    w11DataPoint.setDescription("Point 11 Watts.");
-    w11DataPoint.setUnits("% VRef");
-    w11DataPoint.setSize(1);
-    w11DataPoint.setAddressOffset(23);
-    w11DataPoint.setBlockOffset(21);
-    w11DataPoint.setScaleFactorName("DeptRef_SF");
-    w11DataPoint.setSunSpecDataType("int16");
-    w11DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w11DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w11DataPoint.name(), w11DataPoint);
-
-    SunSpecDataPoint v12DataPoint;
-    v12DataPoint.setName("V12");
-    v12DataPoint.setLabel("V12");
-    v12DataPoint.setDescription("Point 12 Volts.");
-    v12DataPoint.setUnits("% VRef");
-    v12DataPoint.setSize(1);
-    v12DataPoint.setAddressOffset(24);
-    v12DataPoint.setBlockOffset(22);
-    v12DataPoint.setScaleFactorName("V_SF");
-    v12DataPoint.setSunSpecDataType("uint16");
-    v12DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v12DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v12DataPoint.name(), v12DataPoint);
-
-    SunSpecDataPoint w12DataPoint;
-    w12DataPoint.setName("W12");
-    w12DataPoint.setLabel("W12");
-    w12DataPoint.setDescription("Point 12 Watts.");
-    w12DataPoint.setUnits("% VRef");
-    w12DataPoint.setSize(1);
-    w12DataPoint.setAddressOffset(25);
-    w12DataPoint.setBlockOffset(23);
-    w12DataPoint.setScaleFactorName("DeptRef_SF");
-    w12DataPoint.setSunSpecDataType("int16");
-    w12DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w12DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w12DataPoint.name(), w12DataPoint);
-
-    SunSpecDataPoint v13DataPoint;
-    v13DataPoint.setName("V13");
-    v13DataPoint.setLabel("V13");
-    v13DataPoint.setDescription("Point 13 Volts.");
-    v13DataPoint.setUnits("% VRef");
-    v13DataPoint.setSize(1);
-    v13DataPoint.setAddressOffset(26);
-    v13DataPoint.setBlockOffset(24);
-    v13DataPoint.setScaleFactorName("V_SF");
-    v13DataPoint.setSunSpecDataType("uint16");
-    v13DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v13DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v13DataPoint.name(), v13DataPoint);
-
-    SunSpecDataPoint w13DataPoint;
-    w13DataPoint.setName("W13");
-    w13DataPoint.setLabel("W13");
-    w13DataPoint.setDescription("Point 13 Watts.");
-    w13DataPoint.setUnits("% VRef");
-    w13DataPoint.setSize(1);
-    w13DataPoint.setAddressOffset(27);
-    w13DataPoint.setBlockOffset(25);
-    w13DataPoint.setScaleFactorName("DeptRef_SF");
-    w13DataPoint.setSunSpecDataType("int16");
-    w13DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w13DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w13DataPoint.name(), w13DataPoint);
-
-    SunSpecDataPoint v14DataPoint;
-    v14DataPoint.setName("V14");
-    v14DataPoint.setLabel("V14");
-    v14DataPoint.setDescription("Point 14 Volts.");
-    v14DataPoint.setUnits("% VRef");
-    v14DataPoint.setSize(1);
-    v14DataPoint.setAddressOffset(28);
-    v14DataPoint.setBlockOffset(26);
-    v14DataPoint.setScaleFactorName("V_SF");
-    v14DataPoint.setSunSpecDataType("uint16");
-    v14DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v14DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v14DataPoint.name(), v14DataPoint);
-
-    SunSpecDataPoint w14DataPoint;
-    w14DataPoint.setName("W14");
-    w14DataPoint.setLabel("W14");
-    w14DataPoint.setDescription("Point 14 Watts.");
-    w14DataPoint.setUnits("% VRef");
-    w14DataPoint.setSize(1);
-    w14DataPoint.setAddressOffset(29);
-    w14DataPoint.setBlockOffset(27);
-    w14DataPoint.setScaleFactorName("DeptRef_SF");
-    w14DataPoint.setSunSpecDataType("int16");
-    w14DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w14DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w14DataPoint.name(), w14DataPoint);
-
-    SunSpecDataPoint v15DataPoint;
-    v15DataPoint.setName("V15");
-    v15DataPoint.setLabel("V15");
-    v15DataPoint.setDescription("Point 15 Volts.");
-    v15DataPoint.setUnits("% VRef");
-    v15DataPoint.setSize(1);
-    v15DataPoint.setAddressOffset(30);
-    v15DataPoint.setBlockOffset(28);
-    v15DataPoint.setScaleFactorName("V_SF");
-    v15DataPoint.setSunSpecDataType("uint16");
-    v15DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v15DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v15DataPoint.name(), v15DataPoint);
-
-    SunSpecDataPoint w15DataPoint;
-    w15DataPoint.setName("W15");
-    w15DataPoint.setLabel("W15");
-    w15DataPoint.setDescription("Point 15 Watts.");
-    w15DataPoint.setUnits("% VRef");
-    w15DataPoint.setSize(1);
-    w15DataPoint.setAddressOffset(31);
-    w15DataPoint.setBlockOffset(29);
-    w15DataPoint.setScaleFactorName("DeptRef_SF");
-    w15DataPoint.setSunSpecDataType("int16");
-    w15DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w15DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w15DataPoint.name(), w15DataPoint);
-
-    SunSpecDataPoint v16DataPoint;
-    v16DataPoint.setName("V16");
-    v16DataPoint.setLabel("V16");
-    v16DataPoint.setDescription("Point 16 Volts.");
-    v16DataPoint.setUnits("% VRef");
-    v16DataPoint.setSize(1);
-    v16DataPoint.setAddressOffset(32);
-    v16DataPoint.setBlockOffset(30);
-    v16DataPoint.setScaleFactorName("V_SF");
-    v16DataPoint.setSunSpecDataType("uint16");
-    v16DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v16DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v16DataPoint.name(), v16DataPoint);
-
-    SunSpecDataPoint w16DataPoint;
-    w16DataPoint.setName("W16");
-    w16DataPoint.setLabel("W16");
-    w16DataPoint.setDescription("Point 16 Watts.");
-    w16DataPoint.setUnits("% VRef");
-    w16DataPoint.setSize(1);
-    w16DataPoint.setAddressOffset(33);
-    w16DataPoint.setBlockOffset(31);
-    w16DataPoint.setScaleFactorName("DeptRef_SF");
-    w16DataPoint.setSunSpecDataType("int16");
-    w16DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w16DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w16DataPoint.name(), w16DataPoint);
-
-    SunSpecDataPoint v17DataPoint;
-    v17DataPoint.setName("V17");
-    v17DataPoint.setLabel("V17");
-    v17DataPoint.setDescription("Point 17 Volts.");
-    v17DataPoint.setUnits("% VRef");
-    v17DataPoint.setSize(1);
-    v17DataPoint.setAddressOffset(34);
-    v17DataPoint.setBlockOffset(32);
-    v17DataPoint.setScaleFactorName("V_SF");
-    v17DataPoint.setSunSpecDataType("uint16");
-    v17DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v17DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v17DataPoint.name(), v17DataPoint);
-
-    SunSpecDataPoint w17DataPoint;
-    w17DataPoint.setName("W17");
-    w17DataPoint.setLabel("W17");
-    w17DataPoint.setDescription("Point 17 Watts.");
-    w17DataPoint.setUnits("% VRef");
-    w17DataPoint.setSize(1);
-    w17DataPoint.setAddressOffset(35);
-    w17DataPoint.setBlockOffset(33);
-    w17DataPoint.setScaleFactorName("DeptRef_SF");
-    w17DataPoint.setSunSpecDataType("int16");
-    w17DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w17DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w17DataPoint.name(), w17DataPoint);
-
-    SunSpecDataPoint v18DataPoint;
-    v18DataPoint.setName("V18");
-    v18DataPoint.setLabel("V18");
-    v18DataPoint.setDescription("Point 18 Volts.");
-    v18DataPoint.setUnits("% VRef");
-    v18DataPoint.setSize(1);
-    v18DataPoint.setAddressOffset(36);
-    v18DataPoint.setBlockOffset(34);
-    v18DataPoint.setScaleFactorName("V_SF");
-    v18DataPoint.setSunSpecDataType("uint16");
-    v18DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v18DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v18DataPoint.name(), v18DataPoint);
-
-    SunSpecDataPoint w18DataPoint;
-    w18DataPoint.setName("W18");
-    w18DataPoint.setLabel("W18");
-    w18DataPoint.setDescription("Point 18 Watts.");
-    w18DataPoint.setUnits("% VRef");
-    w18DataPoint.setSize(1);
-    w18DataPoint.setAddressOffset(37);
-    w18DataPoint.setBlockOffset(35);
-    w18DataPoint.setScaleFactorName("DeptRef_SF");
-    w18DataPoint.setSunSpecDataType("int16");
-    w18DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w18DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w18DataPoint.name(), w18DataPoint);
-
-    SunSpecDataPoint v19DataPoint;
-    v19DataPoint.setName("V19");
-    v19DataPoint.setLabel("V19");
-    v19DataPoint.setDescription("Point 19 Volts.");
-    v19DataPoint.setUnits("% VRef");
-    v19DataPoint.setSize(1);
-    v19DataPoint.setAddressOffset(38);
-    v19DataPoint.setBlockOffset(36);
-    v19DataPoint.setScaleFactorName("V_SF");
-    v19DataPoint.setSunSpecDataType("uint16");
-    v19DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v19DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v19DataPoint.name(), v19DataPoint);
-
-    SunSpecDataPoint w19DataPoint;
-    w19DataPoint.setName("W19");
-    w19DataPoint.setLabel("W19");
-    w19DataPoint.setDescription("Point 19 Watts.");
-    w19DataPoint.setUnits("% VRef");
-    w19DataPoint.setSize(1);
-    w19DataPoint.setAddressOffset(39);
-    w19DataPoint.setBlockOffset(37);
-    w19DataPoint.setScaleFactorName("DeptRef_SF");
-    w19DataPoint.setSunSpecDataType("int16");
-    w19DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w19DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w19DataPoint.name(), w19DataPoint);
-
-    SunSpecDataPoint v20DataPoint;
-    v20DataPoint.setName("V20");
-    v20DataPoint.setLabel("V20");
-    v20DataPoint.setDescription("Point 20 Volts.");
-    v20DataPoint.setUnits("% VRef");
-    v20DataPoint.setSize(1);
-    v20DataPoint.setAddressOffset(40);
-    v20DataPoint.setBlockOffset(38);
-    v20DataPoint.setScaleFactorName("V_SF");
-    v20DataPoint.setSunSpecDataType("uint16");
-    v20DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    v20DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(v20DataPoint.name(), v20DataPoint);
-
-    SunSpecDataPoint w20DataPoint;
-    w20DataPoint.setName("W20");
-    w20DataPoint.setLabel("W20");
-    w20DataPoint.setDescription("Point 20 Watts.");
-    w20DataPoint.setUnits("% VRef");
-    w20DataPoint.setSize(1);
-    w20DataPoint.setAddressOffset(41);
-    w20DataPoint.setBlockOffset(39);
-    w20DataPoint.setScaleFactorName("DeptRef_SF");
-    w20DataPoint.setSunSpecDataType("int16");
-    w20DataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    w20DataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(w20DataPoint.name(), w20DataPoint);
-
-    SunSpecDataPoint crvNamDataPoint;
-    crvNamDataPoint.setName("CrvNam");
-    crvNamDataPoint.setLabel("CrvNam");
-    crvNamDataPoint.setDescription("Optional description for curve.");
-    crvNamDataPoint.setSize(8);
-    crvNamDataPoint.setAddressOffset(42);
-    crvNamDataPoint.setBlockOffset(40);
-    crvNamDataPoint.setSunSpecDataType("string");
-    crvNamDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    crvNamDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(crvNamDataPoint.name(), crvNamDataPoint);
-
-    SunSpecDataPoint rmpPt1TmsDataPoint;
-    rmpPt1TmsDataPoint.setName("RmpPt1Tms");
-    rmpPt1TmsDataPoint.setLabel("RmpPt1Tms");
-    rmpPt1TmsDataPoint.setDescription("The time of the PT1 in seconds (time to accomplish a change of 95%).");
-    rmpPt1TmsDataPoint.setUnits("Secs");
-    rmpPt1TmsDataPoint.setSize(1);
-    rmpPt1TmsDataPoint.setAddressOffset(50);
-    rmpPt1TmsDataPoint.setBlockOffset(48);
-    rmpPt1TmsDataPoint.setSunSpecDataType("uint16");
-    rmpPt1TmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    rmpPt1TmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rmpPt1TmsDataPoint.name(), rmpPt1TmsDataPoint);
-
-    SunSpecDataPoint rmpDecTmmDataPoint;
-    rmpDecTmmDataPoint.setName("RmpDecTmm");
-    rmpDecTmmDataPoint.setLabel("RmpDecTmm");
-    rmpDecTmmDataPoint.setDescription("The maximum rate at which the watt value may be reduced in response to changes in the voltage value.");
-    rmpDecTmmDataPoint.setUnits("% WMax/min");
-    rmpDecTmmDataPoint.setSize(1);
-    rmpDecTmmDataPoint.setAddressOffset(51);
-    rmpDecTmmDataPoint.setBlockOffset(49);
-    rmpDecTmmDataPoint.setScaleFactorName("RmpIncDec_SF");
-    rmpDecTmmDataPoint.setSunSpecDataType("uint16");
-    rmpDecTmmDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    rmpDecTmmDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rmpDecTmmDataPoint.name(), rmpDecTmmDataPoint);
-
-    SunSpecDataPoint rmpIncTmmDataPoint;
-    rmpIncTmmDataPoint.setName("RmpIncTmm");
-    rmpIncTmmDataPoint.setLabel("RmpIncTmm");
-    rmpIncTmmDataPoint.setDescription("The maximum rate at which the watt value may be increased in response to changes in the voltage value.");
-    rmpIncTmmDataPoint.setUnits("% WMax/min");
-    rmpIncTmmDataPoint.setSize(1);
-    rmpIncTmmDataPoint.setAddressOffset(52);
-    rmpIncTmmDataPoint.setBlockOffset(50);
-    rmpIncTmmDataPoint.setScaleFactorName("RmpIncDec_SF");
-    rmpIncTmmDataPoint.setSunSpecDataType("uint16");
-    rmpIncTmmDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    rmpIncTmmDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rmpIncTmmDataPoint.name(), rmpIncTmmDataPoint);
-
-    SunSpecDataPoint readOnlyDataPoint;
-    readOnlyDataPoint.setName("ReadOnly");
-    readOnlyDataPoint.setLabel("ReadOnly");
-    readOnlyDataPoint.setDescription("Enumerated value indicates if curve is read-only or can be modified.");
-    readOnlyDataPoint.setMandatory(true);
-    readOnlyDataPoint.setSize(1);
-    readOnlyDataPoint.setAddressOffset(53);
-    readOnlyDataPoint.setBlockOffset(51);
-    readOnlyDataPoint.setSunSpecDataType("enum16");
-    readOnlyDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(readOnlyDataPoint.name(), readOnlyDataPoint);
-
+    m_dataPointMetadata = repeatingBlockDataPointMetadata;
+    m_dataPointCount = 47;
 }
 
 void SunSpecVoltWattModelRepeatingBlock::processBlockData(const QVector<quint16> blockData)
 {
     m_blockData = blockData;
 
+    const quint16 *registers = m_blockData.constData();
+    const int registerCount = m_blockData.count();
+
     // Update properties according to the data point type
-    if (m_dataPoints.value("ActPt").isValid())
-        m_actPt = m_dataPoints.value("ActPt").toUInt16();
+    if (registerCount >= 1 && SunSpecDataPoint::isValid(registers + 0, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_actPt = SunSpecDataPoint::convertToUInt16(registers + 0, 1);
 
-    if (m_dataPoints.value("DeptRef").isValid())
-        m_deptRef = static_cast<Deptref>(m_dataPoints.value("DeptRef").toUInt16());
+    if (registerCount >= 2 && SunSpecDataPoint::isValid(registers + 1, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_deptRef = static_cast<Deptref>(SunSpecDataPoint::convertToUInt16(registers + 1, 1));
 
-    if (m_dataPoints.value("V1").isValid())
-        m_v1 = m_dataPoints.value("V1").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v1 = SunSpecDataPoint::convertToUInt16(registers + 2, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W1").isValid())
-        m_w1 = m_dataPoints.value("W1").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w1 = SunSpecDataPoint::convertToInt16(registers + 3, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V2").isValid())
-        m_v2 = m_dataPoints.value("V2").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v2 = SunSpecDataPoint::convertToUInt16(registers + 4, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W2").isValid())
-        m_w2 = m_dataPoints.value("W2").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w2 = SunSpecDataPoint::convertToInt16(registers + 5, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V3").isValid())
-        m_v3 = m_dataPoints.value("V3").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v3 = SunSpecDataPoint::convertToUInt16(registers + 6, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W3").isValid())
-        m_w3 = m_dataPoints.value("W3").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w3 = SunSpecDataPoint::convertToInt16(registers + 7, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V4").isValid())
-        m_v4 = m_dataPoints.value("V4").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v4 = SunSpecDataPoint::convertToUInt16(registers + 8, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W4").isValid())
-        m_w4 = m_dataPoints.value("W4").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w4 = SunSpecDataPoint::convertToInt16(registers + 9, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V5").isValid())
-        m_v5 = m_dataPoints.value("V5").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v5 = SunSpecDataPoint::convertToUInt16(registers + 10, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W5").isValid())
-        m_w5 = m_dataPoints.value("W5").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w5 = SunSpecDataPoint::convertToInt16(registers + 11, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V6").isValid())
-        m_v6 = m_dataPoints.value("V6").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 13 && SunSpecDataPoint::isValid(registers + 12, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v6 = SunSpecDataPoint::convertToUInt16(registers + 12, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W6").isValid())
-        m_w6 = m_dataPoints.value("W6").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 14 && SunSpecDataPoint::isValid(registers + 13, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w6 = SunSpecDataPoint::convertToInt16(registers + 13, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V7").isValid())
-        m_v7 = m_dataPoints.value("V7").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 15 && SunSpecDataPoint::isValid(registers + 14, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v7 = SunSpecDataPoint::convertToUInt16(registers + 14, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W7").isValid())
-        m_w7 = m_dataPoints.value("W7").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 16 && SunSpecDataPoint::isValid(registers + 15, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w7 = SunSpecDataPoint::convertToInt16(registers + 15, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V8").isValid())
-        m_v8 = m_dataPoints.value("V8").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 17 && SunSpecDataPoint::isValid(registers + 16, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v8 = SunSpecDataPoint::convertToUInt16(registers + 16, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W8").isValid())
-        m_w8 = m_dataPoints.value("W8").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 18 && SunSpecDataPoint::isValid(registers + 17, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w8 = SunSpecDataPoint::convertToInt16(registers + 17, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V9").isValid())
-        m_v9 = m_dataPoints.value("V9").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 19 && SunSpecDataPoint::isValid(registers + 18, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v9 = SunSpecDataPoint::convertToUInt16(registers + 18, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W9").isValid())
-        m_w9 = m_dataPoints.value("W9").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 20 && SunSpecDataPoint::isValid(registers + 19, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w9 = SunSpecDataPoint::convertToInt16(registers + 19, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V10").isValid())
-        m_v10 = m_dataPoints.value("V10").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 21 && SunSpecDataPoint::isValid(registers + 20, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v10 = SunSpecDataPoint::convertToUInt16(registers + 20, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W10").isValid())
-        m_w10 = m_dataPoints.value("W10").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 22 && SunSpecDataPoint::isValid(registers + 21, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w10 = SunSpecDataPoint::convertToInt16(registers + 21, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V11").isValid())
-        m_v11 = m_dataPoints.value("V11").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 23 && SunSpecDataPoint::isValid(registers + 22, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v11 = SunSpecDataPoint::convertToUInt16(registers + 22, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W11").isValid())
-        m_w11 = m_dataPoints.value("W11").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 24 && SunSpecDataPoint::isValid(registers + 23, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w11 = SunSpecDataPoint::convertToInt16(registers + 23, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V12").isValid())
-        m_v12 = m_dataPoints.value("V12").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 25 && SunSpecDataPoint::isValid(registers + 24, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v12 = SunSpecDataPoint::convertToUInt16(registers + 24, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W12").isValid())
-        m_w12 = m_dataPoints.value("W12").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 26 && SunSpecDataPoint::isValid(registers + 25, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w12 = SunSpecDataPoint::convertToInt16(registers + 25, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V13").isValid())
-        m_v13 = m_dataPoints.value("V13").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 27 && SunSpecDataPoint::isValid(registers + 26, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v13 = SunSpecDataPoint::convertToUInt16(registers + 26, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W13").isValid())
-        m_w13 = m_dataPoints.value("W13").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 28 && SunSpecDataPoint::isValid(registers + 27, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w13 = SunSpecDataPoint::convertToInt16(registers + 27, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V14").isValid())
-        m_v14 = m_dataPoints.value("V14").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 29 && SunSpecDataPoint::isValid(registers + 28, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v14 = SunSpecDataPoint::convertToUInt16(registers + 28, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W14").isValid())
-        m_w14 = m_dataPoints.value("W14").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 30 && SunSpecDataPoint::isValid(registers + 29, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w14 = SunSpecDataPoint::convertToInt16(registers + 29, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V15").isValid())
-        m_v15 = m_dataPoints.value("V15").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 31 && SunSpecDataPoint::isValid(registers + 30, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v15 = SunSpecDataPoint::convertToUInt16(registers + 30, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W15").isValid())
-        m_w15 = m_dataPoints.value("W15").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 32 && SunSpecDataPoint::isValid(registers + 31, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w15 = SunSpecDataPoint::convertToInt16(registers + 31, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V16").isValid())
-        m_v16 = m_dataPoints.value("V16").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 33 && SunSpecDataPoint::isValid(registers + 32, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v16 = SunSpecDataPoint::convertToUInt16(registers + 32, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W16").isValid())
-        m_w16 = m_dataPoints.value("W16").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 34 && SunSpecDataPoint::isValid(registers + 33, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w16 = SunSpecDataPoint::convertToInt16(registers + 33, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V17").isValid())
-        m_v17 = m_dataPoints.value("V17").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 35 && SunSpecDataPoint::isValid(registers + 34, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v17 = SunSpecDataPoint::convertToUInt16(registers + 34, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W17").isValid())
-        m_w17 = m_dataPoints.value("W17").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 36 && SunSpecDataPoint::isValid(registers + 35, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w17 = SunSpecDataPoint::convertToInt16(registers + 35, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V18").isValid())
-        m_v18 = m_dataPoints.value("V18").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 37 && SunSpecDataPoint::isValid(registers + 36, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v18 = SunSpecDataPoint::convertToUInt16(registers + 36, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W18").isValid())
-        m_w18 = m_dataPoints.value("W18").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 38 && SunSpecDataPoint::isValid(registers + 37, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w18 = SunSpecDataPoint::convertToInt16(registers + 37, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V19").isValid())
-        m_v19 = m_dataPoints.value("V19").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 39 && SunSpecDataPoint::isValid(registers + 38, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v19 = SunSpecDataPoint::convertToUInt16(registers + 38, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W19").isValid())
-        m_w19 = m_dataPoints.value("W19").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 40 && SunSpecDataPoint::isValid(registers + 39, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w19 = SunSpecDataPoint::convertToInt16(registers + 39, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("V20").isValid())
-        m_v20 = m_dataPoints.value("V20").toFloatWithSSF(m_parentModel->vSf());
+    if (registerCount >= 41 && SunSpecDataPoint::isValid(registers + 40, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_v20 = SunSpecDataPoint::convertToUInt16(registers + 40, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->vSf());
 
-    if (m_dataPoints.value("W20").isValid())
-        m_w20 = m_dataPoints.value("W20").toFloatWithSSF(m_parentModel->deptRefSf());
+    if (registerCount >= 42 && SunSpecDataPoint::isValid(registers + 41, 1, SunSpecDataPoint::Int16, m_byteOrder))
+        m_w20 = SunSpecDataPoint::convertToInt16(registers + 41, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->deptRefSf());
 
-    if (m_dataPoints.value("CrvNam").isValid())
-        m_crvNam = m_dataPoints.value("CrvNam").toString();
+    if (registerCount >= 50 && SunSpecDataPoint::isValid(registers + 42, 8, SunSpecDataPoint::String, m_byteOrder))
+        m_crvNam = SunSpecDataPoint::convertToString(registers + 42, 8);
 
-    if (m_dataPoints.value("RmpPt1Tms").isValid())
-        m_rmpPt1Tms = m_dataPoints.value("RmpPt1Tms").toUInt16();
+    if (registerCount >= 51 && SunSpecDataPoint::isValid(registers + 50, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_rmpPt1Tms = SunSpecDataPoint::convertToUInt16(registers + 50, 1);
 
-    if (m_dataPoints.value("RmpDecTmm").isValid())
-        m_rmpDecTmm = m_dataPoints.value("RmpDecTmm").toFloatWithSSF(m_parentModel->rmpIncDecSf());
+    if (registerCount >= 52 && SunSpecDataPoint::isValid(registers + 51, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_rmpDecTmm = SunSpecDataPoint::convertToUInt16(registers + 51, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->rmpIncDecSf());
 
-    if (m_dataPoints.value("RmpIncTmm").isValid())
-        m_rmpIncTmm = m_dataPoints.value("RmpIncTmm").toFloatWithSSF(m_parentModel->rmpIncDecSf());
+    if (registerCount >= 53 && SunSpecDataPoint::isValid(registers + 52, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_rmpIncTmm = SunSpecDataPoint::convertToUInt16(registers + 52, 1) * SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->rmpIncDecSf());
 
-    if (m_dataPoints.value("ReadOnly").isValid())
-        m_readOnly = static_cast<Readonly>(m_dataPoints.value("ReadOnly").toUInt16());
+    if (registerCount >= 54 && SunSpecDataPoint::isValid(registers + 53, 1, SunSpecDataPoint::Enum16, m_byteOrder))
+        m_readOnly = static_cast<Readonly>(SunSpecDataPoint::convertToUInt16(registers + 53, 1));
 
 
     qCDebug(dcSunSpecModelData()) << this;
 }
 
 
+static const SunSpecDataPoint::Metadata dataPointMetadata[] = {
+    // DataPointIndexModelId
+    { "ID", "Model ID", "Model identifier", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 0, 0, 1 },
+    // DataPointIndexModelLength
+    { "L", "Model Length", "Model length", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 1, 0, 1 },
+    // DataPointIndexActCrv
+    { "ActCrv", "ActCrv", "Index of active curve. 0=no active curve.", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, true, 2, 0, 1 },
+    // DataPointIndexModEna
+    { "ModEna", "ModEna", "Is Volt-Watt control active.", nullptr, nullptr, "bitfield16", nullptr, SunSpecDataPoint::BitField16, SunSpecDataPoint::AccessReadWrite, true, 3, 1, 1 },
+    // DataPointIndexWinTms
+    { "WinTms", "WinTms", "Time window for volt-watt change.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 4, 2, 1 },
+    // DataPointIndexRvrtTms
+    { "RvrtTms", "RvrtTms", "Timeout period for volt-watt curve selection.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 5, 3, 1 },
+    // DataPointIndexRmpTms
+    { "RmpTms", "RmpTms", "Ramp time for moving from current mode to new mode.", nullptr, "Secs", "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadWrite, false, 6, 4, 1 },
+    // DataPointIndexNCrv
+    { "NCrv", "NCrv", "Number of curves supported (recommend min. 4).", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 7, 5, 1 },
+    // DataPointIndexNPt
+    { "NPt", "NPt", "Number of points in array (maximum 20).", nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, true, 8, 6, 1 },
+    // DataPointIndexVSf
+    { "V_SF", "V_SF", "Scale factor for percent VRef.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 9, 7, 1 },
+    // DataPointIndexDeptRefSf
+    { "DeptRef_SF", "DeptRef_SF", "Scale Factor for % DeptRef", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, true, 10, 8, 1 },
+    // DataPointIndexRmpIncDecSf
+    { "RmpIncDec_SF", "RmpIncDec_SF", "Scale factor for increment and decrement ramps.", nullptr, nullptr, "sunssf", nullptr, SunSpecDataPoint::ScaleFactor, SunSpecDataPoint::AccessReadOnly, false, 11, 9, 1 }
+};
+
 SunSpecVoltWattModel::SunSpecVoltWattModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
     SunSpecModel(connection, modbusStartRegister, 132, modelLength, byteOrder, parent)
 {
@@ -1633,7 +1111,7 @@ QModbusReply *SunSpecVoltWattModel::setActCrv(quint16 actCrv)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ActCrv");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexActCrv]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(actCrv);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -1651,7 +1129,7 @@ QModbusReply *SunSpecVoltWattModel::setModEna(ModenaFlags modEna)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("ModEna");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexModEna]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(static_cast<quint16>(modEna));
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -1669,7 +1147,7 @@ QModbusReply *SunSpecVoltWattModel::setWinTms(quint16 winTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("WinTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexWinTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(winTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -1687,7 +1165,7 @@ QModbusReply *SunSpecVoltWattModel::setRvrtTms(quint16 rvrtTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("RvrtTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexRvrtTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(rvrtTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -1705,7 +1183,7 @@ QModbusReply *SunSpecVoltWattModel::setRmpTms(quint16 rmpTms)
     if (!m_initialized)
         return nullptr;
 
-    SunSpecDataPoint dp = m_dataPoints.value("RmpTms");
+    const SunSpecDataPoint dp(&m_dataPointMetadata[DataPointIndexRmpTms]);
     QVector<quint16> registers = SunSpecDataPoint::convertFromUInt16(rmpTms);
 
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + dp.addressOffset(), registers.length());
@@ -1735,197 +1213,62 @@ qint16 SunSpecVoltWattModel::rmpIncDecSf() const
 }
 void SunSpecVoltWattModel::initDataPoints()
 {
-    SunSpecDataPoint modelIdDataPoint;
-    modelIdDataPoint.setName("ID");
-    modelIdDataPoint.setLabel("Model ID");
-    modelIdDataPoint.setDescription("Model identifier");
-    modelIdDataPoint.setMandatory(true);
-    modelIdDataPoint.setSize(1);
-    modelIdDataPoint.setAddressOffset(0);
-    modelIdDataPoint.setSunSpecDataType("uint16");
-    modelIdDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelIdDataPoint.name(), modelIdDataPoint);
-
-    SunSpecDataPoint modelLengthDataPoint;
-    modelLengthDataPoint.setName("L");
-    modelLengthDataPoint.setLabel("Model Length");
-    modelLengthDataPoint.setDescription("Model length");
-    modelLengthDataPoint.setMandatory(true);
-    modelLengthDataPoint.setSize(1);
-    modelLengthDataPoint.setAddressOffset(1);
-    modelLengthDataPoint.setSunSpecDataType("uint16");
-    modelLengthDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modelLengthDataPoint.name(), modelLengthDataPoint);
-
-    SunSpecDataPoint actCrvDataPoint;
-    actCrvDataPoint.setName("ActCrv");
-    actCrvDataPoint.setLabel("ActCrv");
-    actCrvDataPoint.setDescription("Index of active curve. 0=no active curve.");
-    actCrvDataPoint.setMandatory(true);
-    actCrvDataPoint.setSize(1);
-    actCrvDataPoint.setAddressOffset(2);
-    actCrvDataPoint.setBlockOffset(0);
-    actCrvDataPoint.setSunSpecDataType("uint16");
-    actCrvDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    actCrvDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(actCrvDataPoint.name(), actCrvDataPoint);
-
-    SunSpecDataPoint modEnaDataPoint;
-    modEnaDataPoint.setName("ModEna");
-    modEnaDataPoint.setLabel("ModEna");
-    modEnaDataPoint.setDescription("Is Volt-Watt control active.");
-    modEnaDataPoint.setMandatory(true);
-    modEnaDataPoint.setSize(1);
-    modEnaDataPoint.setAddressOffset(3);
-    modEnaDataPoint.setBlockOffset(1);
-    modEnaDataPoint.setSunSpecDataType("bitfield16");
-    modEnaDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    modEnaDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(modEnaDataPoint.name(), modEnaDataPoint);
-
-    SunSpecDataPoint winTmsDataPoint;
-    winTmsDataPoint.setName("WinTms");
-    winTmsDataPoint.setLabel("WinTms");
-    winTmsDataPoint.setDescription("Time window for volt-watt change.");
-    winTmsDataPoint.setUnits("Secs");
-    winTmsDataPoint.setSize(1);
-    winTmsDataPoint.setAddressOffset(4);
-    winTmsDataPoint.setBlockOffset(2);
-    winTmsDataPoint.setSunSpecDataType("uint16");
-    winTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    winTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(winTmsDataPoint.name(), winTmsDataPoint);
-
-    SunSpecDataPoint rvrtTmsDataPoint;
-    rvrtTmsDataPoint.setName("RvrtTms");
-    rvrtTmsDataPoint.setLabel("RvrtTms");
-    rvrtTmsDataPoint.setDescription("Timeout period for volt-watt curve selection.");
-    rvrtTmsDataPoint.setUnits("Secs");
-    rvrtTmsDataPoint.setSize(1);
-    rvrtTmsDataPoint.setAddressOffset(5);
-    rvrtTmsDataPoint.setBlockOffset(3);
-    rvrtTmsDataPoint.setSunSpecDataType("uint16");
-    rvrtTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    rvrtTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rvrtTmsDataPoint.name(), rvrtTmsDataPoint);
-
-    SunSpecDataPoint rmpTmsDataPoint;
-    rmpTmsDataPoint.setName("RmpTms");
-    rmpTmsDataPoint.setLabel("RmpTms");
-    rmpTmsDataPoint.setDescription("Ramp time for moving from current mode to new mode.");
-    rmpTmsDataPoint.setUnits("Secs");
-    rmpTmsDataPoint.setSize(1);
-    rmpTmsDataPoint.setAddressOffset(6);
-    rmpTmsDataPoint.setBlockOffset(4);
-    rmpTmsDataPoint.setSunSpecDataType("uint16");
-    rmpTmsDataPoint.setAccess(SunSpecDataPoint::AccessReadWrite);
-    rmpTmsDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rmpTmsDataPoint.name(), rmpTmsDataPoint);
-
-    SunSpecDataPoint nCrvDataPoint;
-    nCrvDataPoint.setName("NCrv");
-    nCrvDataPoint.setLabel("NCrv");
-    nCrvDataPoint.setDescription("Number of curves supported (recommend min. 4).");
-    nCrvDataPoint.setMandatory(true);
-    nCrvDataPoint.setSize(1);
-    nCrvDataPoint.setAddressOffset(7);
-    nCrvDataPoint.setBlockOffset(5);
-    nCrvDataPoint.setSunSpecDataType("uint16");
-    nCrvDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(nCrvDataPoint.name(), nCrvDataPoint);
-
-    SunSpecDataPoint nPtDataPoint;
-    nPtDataPoint.setName("NPt");
-    nPtDataPoint.setLabel("NPt");
-    nPtDataPoint.setDescription("Number of points in array (maximum 20).");
-    nPtDataPoint.setMandatory(true);
-    nPtDataPoint.setSize(1);
-    nPtDataPoint.setAddressOffset(8);
-    nPtDataPoint.setBlockOffset(6);
-    nPtDataPoint.setSunSpecDataType("uint16");
-    nPtDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(nPtDataPoint.name(), nPtDataPoint);
-
-    SunSpecDataPoint vSfDataPoint;
-    vSfDataPoint.setName("V_SF");
-    vSfDataPoint.setLabel("V_SF");
-    vSfDataPoint.setDescription("Scale factor for percent VRef.");
-    vSfDataPoint.setMandatory(true);
-    vSfDataPoint.setSize(1);
-    vSfDataPoint.setAddressOffset(9);
-    vSfDataPoint.setBlockOffset(7);
-    vSfDataPoint.setSunSpecDataType("sunssf");
-    vSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(vSfDataPoint.name(), vSfDataPoint);
-
-    SunSpecDataPoint deptRefSfDataPoint;
-    deptRefSfDataPoint.setName("DeptRef_SF");
-    deptRefSfDataPoint.setLabel("DeptRef_SF");
-    deptRefSfDataPoint.setDescription("Scale Factor for % DeptRef");
-    deptRefSfDataPoint.setMandatory(true);
-    deptRefSfDataPoint.setSize(1);
-    deptRefSfDataPoint.setAddressOffset(10);
-    deptRefSfDataPoint.setBlockOffset(8);
-    deptRefSfDataPoint.setSunSpecDataType("sunssf");
-    deptRefSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(deptRefSfDataPoint.name(), deptRefSfDataPoint);
-
-    SunSpecDataPoint rmpIncDecSfDataPoint;
-    rmpIncDecSfDataPoint.setName("RmpIncDec_SF");
-    rmpIncDecSfDataPoint.setLabel("RmpIncDec_SF");
-    rmpIncDecSfDataPoint.setDescription("Scale factor for increment and decrement ramps.");
-    rmpIncDecSfDataPoint.setSize(1);
-    rmpIncDecSfDataPoint.setAddressOffset(11);
-    rmpIncDecSfDataPoint.setBlockOffset(9);
-    rmpIncDecSfDataPoint.setSunSpecDataType("sunssf");
-    rmpIncDecSfDataPoint.setByteOrder(m_byteOrder);
-    m_dataPoints.insert(rmpIncDecSfDataPoint.name(), rmpIncDecSfDataPoint);
-
+    m_dataPointMetadata = dataPointMetadata;
+    m_dataPointCount = 12;
 }
 
 void SunSpecVoltWattModel::processBlockData()
 {
+    const quint16 *registers = blockRegisters();
+    const int registerCount = blockRegisterCount();
+
     // Scale factors
-    if (m_dataPoints.value("V_SF").isValid())
-        m_vSf = m_dataPoints.value("V_SF").toInt16();
+    if (registerCount >= 10 && SunSpecDataPoint::isValid(registers + 9, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 9, 1);
+        if (scaleFactor != m_vSf) {
+            m_vSf = scaleFactor;
+            m_vSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("DeptRef_SF").isValid())
-        m_deptRefSf = m_dataPoints.value("DeptRef_SF").toInt16();
+    if (registerCount >= 11 && SunSpecDataPoint::isValid(registers + 10, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 10, 1);
+        if (scaleFactor != m_deptRefSf) {
+            m_deptRefSf = scaleFactor;
+            m_deptRefSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
-    if (m_dataPoints.value("RmpIncDec_SF").isValid())
-        m_rmpIncDecSf = m_dataPoints.value("RmpIncDec_SF").toInt16();
+    if (registerCount >= 12 && SunSpecDataPoint::isValid(registers + 11, 1, SunSpecDataPoint::ScaleFactor, m_byteOrder)) {
+        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + 11, 1);
+        if (scaleFactor != m_rmpIncDecSf) {
+            m_rmpIncDecSf = scaleFactor;
+            m_rmpIncDecSfMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        }
+    }
 
 
     // Update properties according to the data point type
-    if (m_dataPoints.value("ActCrv").isValid())
-        m_actCrv = m_dataPoints.value("ActCrv").toUInt16();
-
-    if (m_dataPoints.value("ModEna").isValid())
-        m_modEna = static_cast<ModenaFlags>(m_dataPoints.value("ModEna").toUInt16());
-
-    if (m_dataPoints.value("WinTms").isValid())
-        m_winTms = m_dataPoints.value("WinTms").toUInt16();
-
-    if (m_dataPoints.value("RvrtTms").isValid())
-        m_rvrtTms = m_dataPoints.value("RvrtTms").toUInt16();
+    if (registerCount >= 3 && SunSpecDataPoint::isValid(registers + 2, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_actCrv = SunSpecDataPoint::convertToUInt16(registers + 2, 1);
 
-    if (m_dataPoints.value("RmpTms").isValid())
-        m_rmpTms = m_dataPoints.value("RmpTms").toUInt16();
+    if (registerCount >= 4 && SunSpecDataPoint::isValid(registers + 3, 1, SunSpecDataPoint::BitField16, m_byteOrder))
+        m_modEna = static_cast<ModenaFlags>(SunSpecDataPoint::convertToUInt16(registers + 3, 1));
 
-    if (m_dataPoints.value("NCrv").isValid())
-        m_nCrv = m_dataPoints.value("NCrv").toUInt16();
+    if (registerCount >= 5 && SunSpecDataPoint::isValid(registers + 4, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_winTms = SunSpecDataPoint::convertToUInt16(registers + 4, 1);
 
-    if (m_dataPoints.value("NPt").isValid())
-        m_nPt = m_dataPoints.value("NPt").toUInt16();
+    if (registerCount >= 6 && SunSpecDataPoint::isValid(registers + 5, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_rvrtTms = SunSpecDataPoint::convertToUInt16(registers + 5, 1);
 
-    if (m_dataPoints.value("V_SF").isValid())
-        m_vSf = m_dataPoints.value("V_SF").toInt16();
+    if (registerCount >= 7 && SunSpecDataPoint::isValid(registers + 6, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_rmpTms = SunSpecDataPoint::convertToUInt16(registers + 6, 1);
 
-    if (m_dataPoints.value("DeptRef_SF").isValid())
-        m_deptRefSf = m_dataPoints.value("DeptRef_SF").toInt16();
+    if (registerCount >= 8 && SunSpecDataPoint::isValid(registers + 7, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_nCrv = SunSpecDataPoint::convertToUInt16(registers + 7, 1);
 
-    if (m_dataPoints.value("RmpIncDec_SF").isValid())
-        m_rmpIncDecSf = m_dataPoints.value("RmpIncDec_SF").toInt16();
+    if (registerCount >= 9 && SunSpecDataPoint::isValid(registers + 8, 1, SunSpecDataPoint::UInt16, m_byteOrder))
+        m_nPt = SunSpecDataPoint::convertToUInt16(registers + 8, 1);
 
 
     qCDebug(dcSunSpecModelData()) << this;
@@ -1934,50 +1277,50 @@ void SunSpecVoltWattModel::processBlockData()
 QDebug operator<<(QDebug debug, SunSpecVoltWattModel *model)
 {
     debug.nospace().noquote() << "SunSpecVoltWattModel(Model: " << model->modelId() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")\n";
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ActCrv") << "-->";
-    if (model->dataPoints().value("ActCrv").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecVoltWattModel::DataPointIndexActCrv) << "-->";
+    if (model->dataPoint(SunSpecVoltWattModel::DataPointIndexActCrv).isValid()) {
         debug.nospace().noquote() << model->actCrv() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("ModEna") << "-->";
-    if (model->dataPoints().value("ModEna").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecVoltWattModel::DataPointIndexModEna) << "-->";
+    if (model->dataPoint(SunSpecVoltWattModel::DataPointIndexModEna).isValid()) {
         debug.nospace().noquote() << model->modEna() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("WinTms") << "-->";
-    if (model->dataPoints().value("WinTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecVoltWattModel::DataPointIndexWinTms) << "-->";
+    if (model->dataPoint(SunSpecVoltWattModel::DataPointIndexWinTms).isValid()) {
         debug.nospace().noquote() << model->winTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("RvrtTms") << "-->";
-    if (model->dataPoints().value("RvrtTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecVoltWattModel::DataPointIndexRvrtTms) << "-->";
+    if (model->dataPoint(SunSpecVoltWattModel::DataPointIndexRvrtTms).isValid()) {
         debug.nospace().noquote() << model->rvrtTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("RmpTms") << "-->";
-    if (model->dataPoints().value("RmpTms").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecVoltWattModel::DataPointIndexRmpTms) << "-->";
+    if (model->dataPoint(SunSpecVoltWattModel::DataPointIndexRmpTms).isValid()) {
         debug.nospace().noquote() << model->rmpTms() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NCrv") << "-->";
-    if (model->dataPoints().value("NCrv").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecVoltWattModel::DataPointIndexNCrv) << "-->";
+    if (model->dataPoint(SunSpecVoltWattModel::DataPointIndexNCrv).isValid()) {
         debug.nospace().noquote() << model->nCrv() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
     }
 
-    debug.nospace().noquote() << "    - " << model->dataPoints().value("NPt") << "-->";
-    if (model->dataPoints().value("NPt").isValid()) {
+    debug.nospace().noquote() << "    - " << model->dataPoint(SunSpecVoltWattModel::DataPointIndexNPt) << "-->";
+    if (model->dataPoint(SunSpecVoltWattModel::DataPointIndexNPt).isValid()) {
         debug.nospace().noquote() << model->nPt() << "\n";
     } else {
         debug.nospace().noquote() << "NaN\n";
@@ -56,6 +56,56 @@ public:
     };
     Q_ENUM(Readonly)
 
+    enum DataPointIndex {
+        DataPointIndexActPt = 0,
+        DataPointIndexDeptRef,
+        DataPointIndexV1,
+        DataPointIndexW1,
+        DataPointIndexV2,
+        DataPointIndexW2,
+        DataPointIndexV3,
+        DataPointIndexW3,
+        DataPointIndexV4,
+        DataPointIndexW4,
+        DataPointIndexV5,
+        DataPointIndexW5,
+        DataPointIndexV6,
+        DataPointIndexW6,
+        DataPointIndexV7,
+        DataPointIndexW7,
+        DataPointIndexV8,
+        DataPointIndexW8,
+        DataPointIndexV9,
+        DataPointIndexW9,
+        DataPointIndexV10,
+        DataPointIndexW10,
+        DataPointIndexV11,
+        DataPointIndexW11,
+        DataPointIndexV12,
+        DataPointIndexW12,
+        DataPointIndexV13,
+        DataPointIndexW13,
+        DataPointIndexV14,
+        DataPointIndexW14,
+        DataPointIndexV15,
+        DataPointIndexW15,
+        DataPointIndexV16,
+        DataPointIndexW16,
+        DataPointIndexV17,
+        DataPointIndexW17,
+        DataPointIndexV18,
+        DataPointIndexW18,
+        DataPointIndexV19,
+        DataPointIndexW19,
+        DataPointIndexV20,
+        DataPointIndexW20,
+        DataPointIndexCrvNam,
+        DataPointIndexRmpPt1Tms,
+        DataPointIndexRmpDecTmm,
+        DataPointIndexRmpIncTmm,
+        DataPointIndexReadOnly
+    };
+
     explicit SunSpecVoltWattModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecVoltWattModel *parent = nullptr);
     ~SunSpecVoltWattModelRepeatingBlock() override = default;
 
@@ -321,6 +371,21 @@ public:
     Q_DECLARE_FLAGS(ModenaFlags, Modena)
     Q_FLAG(Modena)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexActCrv,
+        DataPointIndexModEna,
+        DataPointIndexWinTms,
+        DataPointIndexRvrtTms,
+        DataPointIndexRmpTms,
+        DataPointIndexNCrv,
+        DataPointIndexNPt,
+        DataPointIndexVSf,
+        DataPointIndexDeptRefSf,
+        DataPointIndexRmpIncDecSf
+    };
+
     explicit SunSpecVoltWattModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecVoltWattModel() override; 
 
@@ -376,8 +441,11 @@ private:
     quint16 m_nCrv = 0;
     quint16 m_nPt = 0;
     qint16 m_vSf = 0;
+    double m_vSfMultiplier = 1;
     qint16 m_deptRefSf = 0;
+    double m_deptRefSfMultiplier = 1;
     qint16 m_rmpIncDecSf = 0;
+    double m_rmpIncDecSfMultiplier = 1;
 
 
 };
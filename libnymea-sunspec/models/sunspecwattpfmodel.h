@@ -50,6 +50,56 @@ public:
     };
     Q_ENUM(Readonly)
 
+    enum DataPointIndex {
+        DataPointIndexActPt = 0,
+        DataPointIndexW1,
+        DataPointIndexPf1,
+        DataPointIndexW2,
+        DataPointIndexPf2,
+        DataPointIndexW3,
+        DataPointIndexPf3,
+        DataPointIndexW4,
+        DataPointIndexPf4,
+        DataPointIndexW5,
+        DataPointIndexPf5,
+        DataPointIndexW6,
+        DataPointIndexPf6,
+        DataPointIndexW7,
+        DataPointIndexPf7,
+        DataPointIndexW8,
+        DataPointIndexPf8,
+        DataPointIndexW9,
+        DataPointIndexPf9,
+        DataPointIndexW10,
+        DataPointIndexPf10,
+        DataPointIndexW11,
+        DataPointIndexPf11,
+        DataPointIndexW12,
+        DataPointIndexPf12,
+        DataPointIndexW13,
+        DataPointIndexPf13,
+        DataPointIndexW14,
+        DataPointIndexPf14,
+        DataPointIndexW15,
+        DataPointIndexPf15,
+        DataPointIndexW16,
+        DataPointIndexPf16,
+        DataPointIndexW17,
+        DataPointIndexPf17,
+        DataPointIndexW18,
+        DataPointIndexPf18,
+        DataPointIndexW19,
+        DataPointIndexPf19,
+        DataPointIndexW20,
+        DataPointIndexPf20,
+        DataPointIndexCrvNam,
+        DataPointIndexRmpPt1Tms,
+        DataPointIndexRmpDecTmm,
+        DataPointIndexRmpIncTmm,
+        DataPointIndexReadOnly,
+        DataPointIndexPad
+    };
+
     explicit SunSpecWattPfModelRepeatingBlock(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, SunSpecWattPfModel *parent = nullptr);
     ~SunSpecWattPfModelRepeatingBlock() override = default;
 
@@ -312,6 +362,21 @@ public:
     Q_DECLARE_FLAGS(ModenaFlags, Modena)
     Q_FLAG(Modena)
 
+    enum DataPointIndex {
+        DataPointIndexModelId = 0,
+        DataPointIndexModelLength,
+        DataPointIndexActCrv,
+        DataPointIndexModEna,
+        DataPointIndexWinTms,
+        DataPointIndexRvrtTms,
+        DataPointIndexRmpTms,
+        DataPointIndexNCrv,
+        DataPointIndexNPt,
+        DataPointIndexWSf,
+        DataPointIndexPfSf,
+        DataPointIndexRmpIncDecSf
+    };
+
     explicit SunSpecWattPfModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);
     ~SunSpecWattPfModel() override; 
 
@@ -367,8 +432,11 @@ private:
     quint16 m_nCrv = 0;
     quint16 m_nPt = 0;
     qint16 m_wSf = 0;
+    double m_wSfMultiplier = 1;
     qint16 m_pfSf = 0;
+    double m_pfSfMultiplier = 1;
     qint16 m_rmpIncDecSf = 0;
+    double m_rmpIncDecSfMultiplier = 1;
 
 
 };
@@ -161,6 +161,145 @@ QList<SunSpecModel *> SunSpecConnection::models() const
     return m_models;
 }
 
+QVariantMap SunSpecConnection::modelMap() const
+{
+    QVariantMap modelMap;
+
+    // The map can only be validated later on if the common model is known
+    SunSpecCommonModel *commonModel = nullptr;
+    foreach (SunSpecModel *model, m_models) {
+        if (model->modelId() == SunSpecModelFactory::ModelIdCommon && model->modbusStartRegister() == m_baseRegister + 2) {
+            commonModel = qobject_cast<SunSpecCommonModel *>(model);
+            break;
+        }
+    }
+
+    if (!commonModel || m_modelDiscoveryResult.isEmpty())
+        return modelMap;
+
+    QVariantList models;
+    foreach (const ModuleDiscoveryResult &result, m_modelDiscoveryResult) {
+        QVariantMap model;
+        model.insert("modbusStartRegister", result.modbusStartRegister);
+        model.insert("modelId", result.modelId);
+        model.insert("modelLength", result.modelLength);
+        models.append(model);
+    }
+
+    modelMap.insert("baseRegister", m_baseRegister);
+    modelMap.insert("serialNumber", commonModel->serialNumber());
+    modelMap.insert("version", commonModel->version());
+    modelMap.insert("models", models);
+    return modelMap;
+}
+
+void SunSpecConnection::setCachedModelMap(const QVariantMap &modelMap)
+{
+    m_cachedModelMap = modelMap;
+}
+
+bool SunSpecConnection::sweepEnabled() const
+{
+    return m_sweepEnabled;
+}
+
+void SunSpecConnection::setSweepEnabled(bool sweepEnabled)
+{
+    m_sweepEnabled = sweepEnabled;
+    m_sweepTimeoutCounter = 0;
+}
+
+bool SunSpecConnection::sweepModels(const QList<SunSpecModel *> &models)
+{
+    if (!connected()) {
+        qCWarning(dcSunSpec()) << "Could not sweep models." << "The" << this << "is not connected.";
+        return false;
+    }
+
+    if (models.isEmpty())
+        return false;
+
+    // Modbus allows to read max. 125 registers within one request
+    const int maxChunkSize = 125;
+
+    // Start a new sweep cycle, replies of a previous sweep still pending will be ignored
+    const quint32 sweepCycle = ++m_sweepCycle;
+    m_sweepSlices.clear();
+    m_pendingSweepChunkCount = 0;
+
+    QList<SunSpecModel *> sortedModels = models;
+    std::sort(sortedModels.begin(), sortedModels.end(), [](const SunSpecModel* a, const SunSpecModel* b) -> bool {
+        return a->modbusStartRegister() < b->modbusStartRegister();
+    });
+
+    // The SunSpec map is contiguous from the base register. Pack as many whole models as fit into
+    // one request, reading the registers of models in between which have not been requested.
+    // Models longer than one request get a range on their own which will be read in chunks.
+    QList<QPair<int, int>> ranges; // start register, length
+    int bufferSize = 0;
+    foreach (SunSpecModel *model, sortedModels) {
+        const int startRegister = model->modbusStartRegister();
+        const int length = model->modelLength() + 2;
+        if (ranges.isEmpty() || length > maxChunkSize || ranges.last().second > maxChunkSize || startRegister + length - ranges.last().first > maxChunkSize) {
+            ranges.append(qMakePair(startRegister, 0));
+        }
+
+        const int rangeEnd = ranges.last().first + ranges.last().second;
+        if (startRegister + length > rangeEnd) {
+            ranges.last().second += startRegister + length - rangeEnd;
+            bufferSize += startRegister + length - rangeEnd;
+        }
+
+        SweepSlice slice;
+        slice.model = model;
+        slice.bufferOffset = bufferSize - ranges.last().second + startRegister - ranges.last().first;
+        slice.count = length;
+        m_sweepSlices.append(slice);
+    }
+
+    // Each sweep gets a new buffer, the models keep sharing the buffer of the last sweep without copying it
+    m_sweepData = QVector<quint16>(bufferSize);
+
+    qCDebug(dcSunSpec()) << "Sweep" << sortedModels.count() << "models on" << this << "using" << ranges.count() << "register ranges with" << bufferSize << "registers";
+    int bufferOffset = 0;
+    for (int i = 0; i < ranges.count(); i++) {
+        for (int offset = 0; offset < ranges.at(i).second; offset += maxChunkSize) {
+            const int count = qMin(maxChunkSize, ranges.at(i).second - offset);
+            const int chunkBufferOffset = bufferOffset + offset;
+            QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, ranges.at(i).first + offset, count);
+            QModbusReply *reply = sendReadRequest(request, m_slaveId);
+            if (!reply) {
+                qCWarning(dcSunSpec()) << "Failed to send sweep request on" << this << m_modbusTcpClient->errorString();
+                m_sweepCycle++;
+                return false;
+            }
+
+            if (reply->isFinished()) {
+                reply->deleteLater(); // broadcast replies return immediately
+                m_sweepCycle++;
+                return false;
+            }
+
+            m_pendingSweepChunkCount++;
+            m_pendingSweepReplyCount++;
+            connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);
+            connect(reply, &QModbusReply::finished, this, [=]() {
+                m_pendingSweepReplyCount--;
+                processSweepChunkReply(reply, sweepCycle, chunkBufferOffset, count);
+            });
+        }
+
+        bufferOffset += ranges.at(i).second;
+    }
+
+    return true;
+}
+
+bool SunSpecConnection::sweepPending() const
+{
+    return m_pendingSweepReplyCount > 0;
+}
+
 QModbusReply *SunSpecConnection::sendReadRequest(const QModbusDataUnit &read, int serverAddress)
 {
     QModbusReply *reply = m_modbusTcpClient->sendReadRequest(read, serverAddress);
@@ -196,16 +335,15 @@ bool SunSpecConnection::startDiscovery()
         return true;
     }
 
-    // Create base register queue
-    m_baseRegisterQueue.clear();
-    m_baseRegisterQueue.enqueue(40000);
-    m_baseRegisterQueue.enqueue(50000);
-    m_baseRegisterQueue.enqueue(0);
-
     qCDebug(dcSunSpec()) << "Starting SunSpec discovery on" << this;
     m_modelDiscoveryResult.clear();
     setDiscoveryRunning(true);
-    if (!scanSunspecBaseRegister(m_baseRegisterQueue.dequeue())) {
+
+    // Skip the model header scan if the cached model map still matches the device
+    if (restoreCachedModelMap())
+        return true;
+
+    if (!scanSunspecBaseRegisters()) {
         setDiscoveryRunning(false);
         return false;
     }
@@ -287,6 +425,7 @@ void SunSpecConnection::processDiscoveryResult()
     // If no models found to initialize, we are done
     if (m_uninitializedModels.isEmpty()) {
         qCDebug(dcSunSpec()) << "No models to initialize. Discovery finished successfully.";
+        m_cachedModelMap = modelMap();
         setDiscoveryRunning(false);
         emit discoveryFinished(true);
         return;
@@ -334,6 +473,7 @@ void SunSpecConnection::processDiscoveryResult()
                 }
 
                 qCDebug(dcSunSpec()) << "All models initialized. Discovery finished successfully.";
+                m_cachedModelMap = modelMap();
                 setDiscoveryRunning(false);
                 emit discoveryFinished(true);
             }
@@ -363,6 +503,81 @@ bool SunSpecConnection::modelAlreadyAdded(SunSpecModel *model) const
     return false;
 }
 
+bool SunSpecConnection::restoreCachedModelMap()
+{
+    if (m_cachedModelMap.isEmpty())
+        return false;
+
+    QList<ModuleDiscoveryResult> cachedResults;
+    foreach (const QVariant &modelVariant, m_cachedModelMap.value("models").toList()) {
+        QVariantMap modelMap = modelVariant.toMap();
+        ModuleDiscoveryResult result;
+        result.modbusStartRegister = modelMap.value("modbusStartRegister").toUInt();
+        result.modelId = modelMap.value("modelId").toUInt();
+        result.modelLength = modelMap.value("modelLength").toUInt();
+        cachedResults.append(result);
+    }
+
+    quint16 baseRegister = m_cachedModelMap.value("baseRegister").toUInt();
+    if (cachedResults.isEmpty() || cachedResults.first().modelId != SunSpecModelFactory::ModelIdCommon || cachedResults.first().modbusStartRegister != baseRegister + 2) {
+        qCWarning(dcSunSpec()) << "The cached model map of" << this << "does not start with the common model. Discarding the cache.";
+        m_cachedModelMap.clear();
+        return false;
+    }
+
+    // Read the common model in order to verify the cache belongs to this device and firmware version
+    SunSpecCommonModel *commonModel = new SunSpecCommonModel(this, cachedResults.first().modbusStartRegister, cachedResults.first().modelLength, m_byteOrder, this);
+    connect(commonModel, &SunSpecModel::initFinished, this, [this, commonModel, baseRegister, cachedResults](bool success){
+        commonModel->deleteLater();
+
+        if (success && commonModel->serialNumber() == m_cachedModelMap.value("serialNumber").toString() && commonModel->version() == m_cachedModelMap.value("version").toString()) {
+            qCDebug(dcSunSpec()) << "The cached model map of" << this << "is valid. Skipping the model header scan.";
+            m_baseRegister = baseRegister;
+            emit sunspecBaseRegisterFound(m_baseRegister);
+            m_modelDiscoveryResult = cachedResults;
+            processDiscoveryResult();
+            return;
+        }
+
+        if (success) {
+            qCDebug(dcSunSpec()) << "The serial number or version of" << this << "changed. Discarding the cached model map.";
+            m_cachedModelMap.clear();
+        } else {
+            qCWarning(dcSunSpec()) << "Could not verify the cached model map of" << this << "Starting a full discovery.";
+        }
+
+        if (!scanSunspecBaseRegisters()) {
+            setDiscoveryRunning(false);
+            emit discoveryFinished(false);
+        }
+    });
+
+    qCDebug(dcSunSpec()) << "Verifying the cached model map of" << this << "using the common model" << commonModel;
+    commonModel->init();
+    return true;
+}
+
+bool SunSpecConnection::scanSunspecBaseRegisters()
+{
+    // Probe all candidates at once, the first candidate in this list containing 'SunS' will be used
+    m_baseRegisterCandidates = QList<quint16>() << 40000 << 50000 << 0;
+    m_baseRegisterResults.clear();
+
+    bool requestSent = false;
+    foreach (quint16 baseRegister, m_baseRegisterCandidates) {
+        if (scanSunspecBaseRegister(baseRegister)) {
+            requestSent = true;
+        } else {
+            m_baseRegisterResults.insert(baseRegister, false);
+        }
+    }
+
+    if (!requestSent)
+        m_baseRegisterCandidates.clear();
+
+    return requestSent;
+}
+
 bool SunSpecConnection::scanSunspecBaseRegister(quint16 baseRegister)
 {
     qCDebug(dcSunSpec()) << "--> Scan for 'SunS' on" << this << baseRegister;
@@ -382,50 +597,63 @@ bool SunSpecConnection::scanSunspecBaseRegister(quint16 baseRegister)
 
     connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);
     connect(reply, &QModbusReply::finished, this, [reply, baseRegister, this] {
+        // Ignore late replies once a base register has been selected
+        if (!m_baseRegisterCandidates.contains(baseRegister))
+            return;
+
         if (reply->error() == QModbusDevice::NoError) {
             const QModbusDataUnit unit = reply->result();
             quint32 registerContent = (unit.value(0) << 16 | unit.value(1));
             if (registerContent == 0x53756e53) {
                 //Well-known value. Uniquely identifies this as a SunSpec Modbus model
                 qCDebug(dcSunSpec()) << "Found 'SunS' identifier register" << baseRegister << "on" << this;
-                m_baseRegisterQueue.clear();
-
-                m_baseRegister = baseRegister;
-                emit sunspecBaseRegisterFound(m_baseRegister);
-
-                // Found successfull "SunS", do not continue with the alternative registers
-                qCDebug(dcSunSpec()) << "Start scanning for SunSpec models on" << this << "using SunSpec base register" << m_baseRegister;
-                scanModelsOnBaseRegister();
+                m_baseRegisterResults.insert(baseRegister, true);
             } else {
                 qCWarning(dcSunSpec()) << "Got reply on base register" << baseRegister << ", but value did not match the sunspec code 'SunS' 0x53756e53";
-                scanNextSunspecBaseRegister();
+                m_baseRegisterResults.insert(baseRegister, false);
             }
         } else {
             qCDebug(dcSunSpec()) << "Base register" << baseRegister << "not found on" << this;
-            scanNextSunspecBaseRegister();
+            m_baseRegisterResults.insert(baseRegister, false);
         }
+
+        evaluateSunspecBaseRegisterResults();
     });
 
     return true;
 }
 
-void SunSpecConnection::scanNextSunspecBaseRegister()
+void SunSpecConnection::evaluateSunspecBaseRegisterResults()
 {
-    if (m_baseRegisterQueue.isEmpty()) {
-        qCDebug(dcSunSpec()) << "Finished with SunSpec discovery. No SunSpec register has been found on" << this;
-        setDiscoveryRunning(false);
-        emit discoveryFinished(false);
-        return;
+    foreach (quint16 baseRegister, m_baseRegisterCandidates) {
+        // Wait for the candidates with a higher priority
+        if (!m_baseRegisterResults.contains(baseRegister))
+            return;
+
+        if (m_baseRegisterResults.value(baseRegister)) {
+            // Found successfull "SunS", do not continue with the alternative registers
+            m_baseRegisterCandidates.clear();
+            m_baseRegister = baseRegister;
+            emit sunspecBaseRegisterFound(m_baseRegister);
+
+            qCDebug(dcSunSpec()) << "Start scanning for SunSpec models on" << this << "using SunSpec base register" << m_baseRegister;
+            scanModelsOnBaseRegister();
+            return;
+        }
     }
 
-    scanSunspecBaseRegister(m_baseRegisterQueue.dequeue());
+    qCDebug(dcSunSpec()) << "Finished with SunSpec discovery. No SunSpec register has been found on" << this;
+    m_baseRegisterCandidates.clear();
+    setDiscoveryRunning(false);
+    emit discoveryFinished(false);
 }
 
-void SunSpecConnection::scanModelsOnBaseRegister(quint16 offset)
+void SunSpecConnection::scanModelsOnBaseRegister(quint16 offset, quint16 windowSize)
 {
+    // Read a whole window of registers and parse all model headers within it instead of reading each header on its own
     quint16 startRegisterAddress = m_baseRegister + offset;
-    qCDebug(dcSunSpec()) << "Reading SunSpec model header" << this << "using SunSpec base register" << m_baseRegister << "offset:" << offset << "=" << startRegisterAddress;
-    QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, startRegisterAddress, 2);
+    qCDebug(dcSunSpec()) << "Reading SunSpec model headers" << this << "using SunSpec base register" << m_baseRegister << "offset:" << offset << "=" << startRegisterAddress << "window size:" << windowSize;
+    QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, startRegisterAddress, windowSize);
     QModbusReply *reply = m_modbusTcpClient->sendReadRequest(request, m_slaveId);
 
     if (!reply) {
@@ -440,30 +668,47 @@ void SunSpecConnection::scanModelsOnBaseRegister(quint16 offset)
     }
 
     connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);
-    connect(reply, &QModbusReply::finished, this, [this, reply, offset, startRegisterAddress] {
+    connect(reply, &QModbusReply::finished, this, [this, reply, offset, windowSize, startRegisterAddress] {
         if (reply->error() == QModbusDevice::NoError) {
 
             const QModbusDataUnit unit = reply->result();
-            quint16 modbusStartRegister = unit.startAddress();
-            quint16 modelId  = unit.value(0);
-            int modelLength = unit.value(1);
+            const QVector<quint16> values = unit.values();
+            int position = 0;
+            while (position < values.count()) {
+                quint16 modelId = values.at(position);
+
+                // Check if we reached the end of models
+                if (modelId == 0xFFFF) {
+                    qCDebug(dcSunSpec()) << "Scan for SunSpec models on" << this << m_baseRegister << "finished successfully";
+                    processDiscoveryResult();
+                    return;
+                }
 
-            // Check if we reached the end of models
-            if (modelId == 0xFFFF) {
-                qCDebug(dcSunSpec()) << "Scan for SunSpec models on" << this << m_baseRegister << "finished successfully";
-                processDiscoveryResult();
-                return;
-            }
+                // The length of this model is in the next window
+                if (position + 1 >= values.count())
+                    break;
+
+                quint16 modbusStartRegister = startRegisterAddress + position;
+                int modelLength = values.at(position + 1);
 
-            qCDebug(dcSunSpec()) << "Discovered SunSpec model on" << this << "[" << startRegisterAddress + 2 << "-" << startRegisterAddress + 2 + modelLength << "]" << "(base: " << m_baseRegister << "offset:" << offset << "length:" << modelLength << ") | Model ID:" << modelId << static_cast<SunSpecModelFactory::ModelId>(modelId);
-            ModuleDiscoveryResult result;
-            result.modbusStartRegister = modbusStartRegister;
-            result.modelId = modelId;
-            result.modelLength = modelLength;
-            m_modelDiscoveryResult.append(result);
+                qCDebug(dcSunSpec()) << "Discovered SunSpec model on" << this << "[" << modbusStartRegister + 2 << "-" << modbusStartRegister + 2 + modelLength << "]" << "(base: " << m_baseRegister << "offset:" << offset + position << "length:" << modelLength << ") | Model ID:" << modelId << static_cast<SunSpecModelFactory::ModelId>(modelId);
+                ModuleDiscoveryResult result;
+                result.modbusStartRegister = modbusStartRegister;
+                result.modelId = modelId;
+                result.modelLength = modelLength;
+                m_modelDiscoveryResult.append(result);
 
-            // Scan next model block, current offset + 2 header bytes + model length
-            scanModelsOnBaseRegister(offset + 2 + modelLength);
+                // Next model header, current position + 2 header bytes + model length
+                position += 2 + modelLength;
+            }
+
+            // Continue with the first header not covered by this window. A rejected window
+            // only falls back to the plain header once, the next read uses the full window again.
+            scanModelsOnBaseRegister(offset + position);
+        } else if (windowSize > 2) {
+            // Some devices reject reads beyond the end of the map, fall back to reading the plain header
+            qCDebug(dcSunSpec()) << "Could not read model header window from" << this << "using offset" << offset << m_modbusTcpClient->errorString() << "Retry reading the plain header.";
+            scanModelsOnBaseRegister(offset, 2);
         } else {
             qCWarning(dcSunSpec()) << "Error occurred while reading model header from" << this << "using offset" << offset << m_modbusTcpClient->errorString();
             if (!m_modelDiscoveryResult.isEmpty()) {
@@ -508,6 +753,59 @@ void SunSpecConnection::monitorTimoutErrors(QModbusReply *reply)
     });
 }
 
+void SunSpecConnection::processSweepChunkReply(QModbusReply *reply, quint32 sweepCycle, int bufferOffset, int count)
+{
+    // Ignore chunks from an outdated or already failed sweep
+    if (sweepCycle != m_sweepCycle)
+        return;
+
+    if (reply->error() != QModbusDevice::NoError) {
+        qCWarning(dcSunSpec()) << "Sweep request finished with error on" << this << reply->error() << reply->errorString();
+        m_sweepCycle++;
+        if (reply->error() == QModbusDevice::ProtocolError) {
+            // Some devices reject reads across model boundaries, fall back to reading each model on its own
+            qCWarning(dcSunSpec()) << "The device rejected the sweep request. Disable sweep mode for" << this;
+            m_sweepEnabled = false;
+        } else if (reply->error() == QModbusDevice::TimeoutError) {
+            // Other devices silently drop them, or simply can not answer big requests in time
+            m_sweepTimeoutCounter++;
+            if (m_sweepTimeoutCounter >= m_sweepTimeoutCounterLimit) {
+                qCWarning(dcSunSpec()) << "The sweep requests timed out" << m_sweepTimeoutCounter << "times in a row. Disable sweep mode for" << this;
+                m_sweepTimeoutCounter = 0;
+                m_sweepEnabled = false;
+            }
+        }
+
+        return;
+    }
+
+    const QModbusDataUnit unit = reply->result();
+    if (static_cast<int>(unit.valueCount()) != count) {
+        qCWarning(dcSunSpec()) << "Received invalid register count from sweep request on" << this << "Requested:" << count << "Received:" << unit.valueCount();
+        m_sweepCycle++;
+        return;
+    }
+
+    m_sweepTimeoutCounter = 0;
+
+    const QVector<quint16> values = unit.values();
+    std::copy(values.constBegin(), values.constEnd(), m_sweepData.begin() + bufferOffset);
+
+    m_pendingSweepChunkCount--;
+    if (m_pendingSweepChunkCount > 0)
+        return;
+
+    // All chunks arrived, hand each model its slice of the shared buffer
+    foreach (const SweepSlice &slice, m_sweepSlices) {
+        if (slice.model.isNull())
+            continue;
+
+        slice.model->processSweepData(m_sweepData, slice.bufferOffset, slice.count);
+    }
+
+    m_sweepSlices.clear();
+}
+
 QDebug operator<<(QDebug debug, SunSpecConnection *connection)
 {
     debug.nospace().noquote() << "SunSpecConnection(" << connection->hostAddress().toString() << ":" << connection->port() << ", Slave ID: " << connection->slaveId() << ")";
@@ -32,6 +32,7 @@
 #define SUNSPECCONNECTION_H
 
 #include <QObject>
+#include <QPointer>
 #include <QtSerialBus>
 #include <QHostAddress>
 #include <QModbusTcpClient>
@@ -77,6 +78,21 @@ public:
 
     QList<SunSpecModel *> models() const;
 
+    // Model map of the last successful discovery, keyed by the serial number and version of the common model.
+    // A model map restored using setCachedModelMap() skips the model header scan if the layout still validates.
+    QVariantMap modelMap() const;
+    void setCachedModelMap(const QVariantMap &modelMap);
+
+    // Sweep mode: read the address ranges of several models using as few requests as possible.
+    // Gets disabled if the device rejects the requests or they time out repeatedly.
+    bool sweepEnabled() const;
+    void setSweepEnabled(bool sweepEnabled);
+
+    bool sweepModels(const QList<SunSpecModel *> &models);
+
+    // True as long as replies of a sweep are outstanding, even from an aborted sweep
+    bool sweepPending() const;
+
     // Helper methods for internal queue handling if enabled
     QModbusReply *sendReadRequest(const QModbusDataUnit &read, int serverAddress);
     QModbusReply *sendWriteRequest(const QModbusDataUnit &write, int serverAddress);
@@ -103,7 +119,8 @@ private:
     bool m_connected = false;
 
     quint16 m_baseRegister = 40000;
-    QQueue<quint16> m_baseRegisterQueue;
+    QList<quint16> m_baseRegisterCandidates;
+    QHash<quint16, bool> m_baseRegisterResults;
 
     // SunSpec discovery
     typedef struct ModuleDiscoveryResult {
@@ -116,11 +133,28 @@ private:
     QList<ModuleDiscoveryResult> m_modelDiscoveryResult;
     QList<SunSpecModel *> m_models;
     QList<SunSpecModel *> m_uninitializedModels;
+    QVariantMap m_cachedModelMap;
     SunSpecDataPoint::ByteOrder m_byteOrder = SunSpecDataPoint::ByteOrderLittleEndian;
 
     int m_timoutReplyCounter = 0;
     int m_timoutReplyCounterLimit = 16;
 
+    // Sweep
+    typedef struct SweepSlice {
+        QPointer<SunSpecModel> model;
+        int bufferOffset;
+        int count;
+    } SweepSlice;
+
+    bool m_sweepEnabled = false;
+    QVector<quint16> m_sweepData;
+    QVector<SweepSlice> m_sweepSlices;
+    quint32 m_sweepCycle = 0;
+    int m_pendingSweepChunkCount = 0;
+    int m_pendingSweepReplyCount = 0;
+    int m_sweepTimeoutCounter = 0;
+    int m_sweepTimeoutCounterLimit = 3;
+
     void createConnection();
 
     void processDiscoveryResult();
@@ -128,12 +162,17 @@ private:
     void setDiscoveryRunning(bool discoveryRunning);
     bool modelAlreadyAdded(SunSpecModel *model) const;
 
+    bool restoreCachedModelMap();
+
+    bool scanSunspecBaseRegisters();
     bool scanSunspecBaseRegister(quint16 baseRegister);
-    void scanNextSunspecBaseRegister();
+    void evaluateSunspecBaseRegisterResults();
 
-    void scanModelsOnBaseRegister(quint16 offset = 2);
+    void scanModelsOnBaseRegister(quint16 offset = 2, quint16 windowSize = 125);
 
     void monitorTimoutErrors(QModbusReply *reply);
+
+    void processSweepChunkReply(QModbusReply *reply, quint32 sweepCycle, int bufferOffset, int count);
 };
 
 QDebug operator<<(QDebug debug, SunSpecConnection *connection);
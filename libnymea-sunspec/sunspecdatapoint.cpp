@@ -33,120 +33,80 @@
 #include <math.h>
 #include <QDataStream>
 
-SunSpecDataPoint::SunSpecDataPoint()
+// Used by default constructed data points
+static const SunSpecDataPoint::Metadata defaultMetadata = { nullptr, nullptr, nullptr, nullptr, nullptr, "uint16", nullptr, SunSpecDataPoint::UInt16, SunSpecDataPoint::AccessReadOnly, false, 0, 0, 1 };
+
+SunSpecDataPoint::SunSpecDataPoint() :
+    m_metadata(&defaultMetadata)
 {
 
 }
 
-QString SunSpecDataPoint::name() const
+SunSpecDataPoint::SunSpecDataPoint(const Metadata *metadata, ByteOrder byteOrder) :
+    m_metadata(metadata ? metadata : &defaultMetadata),
+    m_byteOrder(byteOrder)
 {
-    return m_name;
-}
 
-void SunSpecDataPoint::setName(const QString &name)
-{
-    m_name = name;
 }
 
-QString SunSpecDataPoint::label() const
+const SunSpecDataPoint::Metadata *SunSpecDataPoint::metadata() const
 {
-    return m_label;
+    return m_metadata;
 }
 
-void SunSpecDataPoint::setLabel(const QString &label)
+QString SunSpecDataPoint::name() const
 {
-    m_label = label;
+    return QString::fromUtf8(m_metadata->name);
 }
 
-QString SunSpecDataPoint::description() const
+QString SunSpecDataPoint::label() const
 {
-    return m_description;
+    return QString::fromUtf8(m_metadata->label);
 }
 
-void SunSpecDataPoint::setDescription(const QString &description)
+QString SunSpecDataPoint::description() const
 {
-    m_description = description;
+    return QString::fromUtf8(m_metadata->description);
 }
 
 QString SunSpecDataPoint::detail() const
 {
-    return m_detail;
-}
-
-void SunSpecDataPoint::setDetail(const QString &detail)
-{
-    m_detail = detail;
+    return QString::fromUtf8(m_metadata->detail);
 }
 
 QString SunSpecDataPoint::units() const
 {
-    return m_units;
-}
-
-void SunSpecDataPoint::setUnits(const QString &units)
-{
-    m_units = units;
+    return QString::fromUtf8(m_metadata->units);
 }
 
 bool SunSpecDataPoint::mandatory() const
 {
-    return m_mandatory;
-}
-
-void SunSpecDataPoint::setMandatory(bool mandatory)
-{
-    m_mandatory = mandatory;
+    return m_metadata->mandatory;
 }
 
 SunSpecDataPoint::Access SunSpecDataPoint::access() const
 {
-    return m_access;
-}
-
-void SunSpecDataPoint::setAccess(Access access)
-{
-    m_access = access;
+    return m_metadata->access;
 }
 
 quint16 SunSpecDataPoint::addressOffset() const
 {
-    return m_addressOffset;
-}
-
-void SunSpecDataPoint::setAddressOffset(quint16 addressOffset)
-{
-    m_addressOffset = addressOffset;
+    return m_metadata->addressOffset;
 }
 
 quint16 SunSpecDataPoint::blockOffset() const
 {
-    return m_blockOffset;
-}
-
-void SunSpecDataPoint::setBlockOffset(quint16 blockOffset)
-{
-    m_blockOffset = blockOffset;
+    return m_metadata->blockOffset;
 }
 
 QString SunSpecDataPoint::sunSpecDataType() const
 {
-    return m_sunSpecDataType;
-}
-
-void SunSpecDataPoint::setSunSpecDataType(const QString &sunSpecDataType)
-{
-    m_sunSpecDataType = sunSpecDataType;
-    setDataType(SunSpecDataPoint::stringToDataType(m_sunSpecDataType));
+    return QString::fromUtf8(m_metadata->sunSpecDataType);
 }
 
 SunSpecDataPoint::DataType SunSpecDataPoint::dataType() const
 {
-    return m_dataType;
-}
-
-void SunSpecDataPoint::setDataType(DataType dataType)
-{
-    m_dataType = dataType;
+    return m_metadata->dataType;
 }
 
 SunSpecDataPoint::ByteOrder SunSpecDataPoint::byteOrder() const
@@ -161,22 +121,12 @@ void SunSpecDataPoint::setByteOrder(ByteOrder byteOrder)
 
 int SunSpecDataPoint::size() const
 {
-    return m_size;
-}
-
-void SunSpecDataPoint::setSize(int size)
-{
-    m_size = size;
+    return m_metadata->size;
 }
 
 QString SunSpecDataPoint::scaleFactorName() const
 {
-    return m_scaleFactorName;
-}
-
-void SunSpecDataPoint::setScaleFactorName(const QString &scaleFactorName)
-{
-    m_scaleFactorName = scaleFactorName;
+    return QString::fromUtf8(m_metadata->scaleFactorName);
 }
 
 QVector<quint16> SunSpecDataPoint::rawData() const
@@ -189,98 +139,16 @@ void SunSpecDataPoint::setRawData(const QVector<quint16> &rawData)
     m_rawData = rawData;
 }
 
-bool SunSpecDataPoint::isValid() const
+void SunSpecDataPoint::setRawData(const quint16 *rawData, int count)
 {
-    // TODO: verify if value is not invalid code
-    if (m_rawData.isEmpty())
-        return false;
-
-    bool valid = true;
-    switch (m_dataType) {
-    case DataType::Pad:
-    case DataType::Int16:
-    case DataType::ScaleFactor:
-        if (toUInt16() == 0x8000)
-            valid = false;
-
-        break;
-    case DataType::Int32:
-        if (toUInt32() == 0x80000000)
-            valid = false;
-
-        break;
-    case DataType::Int64:
-        if (toUInt64() == 0x8000000000000000)
-            valid = false;
-
-        break;
-    case DataType::Raw16:
-        if (toUInt16() == 0x0000)
-            valid = false;
-        break;
-    case DataType::Acc16:
-        if (toUInt16() == 0x0000)
-            valid = false;
-
-        break;
-    case DataType::IpV4Address:
-    case DataType::Acc32:
-        if (toUInt32() == 0x00000000)
-            valid = false;
-
-        break;
-    case DataType::BitField16:
-    case DataType::Enum16:
-    case DataType::UInt16:
-        if (toUInt16() == 0xFFFF)
-            valid = false;
-        break;
-    case DataType::BitField32:
-    case DataType::Enum32:
-    case DataType::UInt32:
-        if (toUInt32() == 0xFFFFFFFF)
-            valid = false;
-        break;
-    case DataType::IpV6Address:
-    case DataType::Acc64:
-        if (toUInt64() == 0x0000000000000000)
-            valid = false;
-
-        break;
-        break;
-    case DataType::BitField64:
-
-        break;
-    case DataType::Float32:
-        if (toUInt32() == 0x7FC00000)
-            valid = false;
-        break;
-    case DataType::Float64:
-        if (toUInt64() == 0x7FC0000000000000)
-            valid = false;
-        break;
-    case DataType::String: {
-        bool isNull = true;
-        for (int i = 0; i < m_rawData.count(); i++) {
-            if (m_rawData.at(i) != 0x0000) {
-                isNull = false;
-                valid = true;
-                break;
-            }
-        }
-
-        if (isNull)
-            valid = false;
-
-        break;
-    }
-    case DataType::EUI48:
-    case DataType::Group:
-    case DataType::Sync:
-        break;
-    }
+    // Reuse the existing storage, the size of a data point does not change between block reads
+    m_rawData.resize(count);
+    memcpy(m_rawData.data(), rawData, count * sizeof(quint16));
+}
 
-    return valid;
+bool SunSpecDataPoint::isValid() const
+{
+    return SunSpecDataPoint::isValid(m_rawData.constData(), m_rawData.count(), m_metadata->dataType, m_byteOrder);
 }
 
 SunSpecDataPoint::DataType SunSpecDataPoint::stringToDataType(const QString &typString)
@@ -342,75 +210,54 @@ SunSpecDataPoint::DataType SunSpecDataPoint::stringToDataType(const QString &typ
 
 quint16 SunSpecDataPoint::toUInt16() const
 {
-    return SunSpecDataPoint::convertToUInt16(m_rawData);
+    return SunSpecDataPoint::convertToUInt16(m_rawData.constData(), m_rawData.count());
 }
 
 qint16 SunSpecDataPoint::toInt16() const
 {
-    return SunSpecDataPoint::convertToInt16(m_rawData);
+    return SunSpecDataPoint::convertToInt16(m_rawData.constData(), m_rawData.count());
 }
 
 quint32 SunSpecDataPoint::toUInt32() const
 {
-    return SunSpecDataPoint::convertToUInt32(m_rawData, m_byteOrder);
+    return SunSpecDataPoint::convertToUInt32(m_rawData.constData(), m_rawData.count(), m_byteOrder);
 }
 
 qint32 SunSpecDataPoint::toInt32() const
 {
-    return SunSpecDataPoint::convertToInt32(m_rawData, m_byteOrder);
+    return SunSpecDataPoint::convertToInt32(m_rawData.constData(), m_rawData.count(), m_byteOrder);
 }
 
 quint64 SunSpecDataPoint::toUInt64() const
 {
-    return SunSpecDataPoint::convertToUInt64(m_rawData, m_byteOrder);
+    return SunSpecDataPoint::convertToUInt64(m_rawData.constData(), m_rawData.count(), m_byteOrder);
 }
 
 qint64 SunSpecDataPoint::toInt64() const
 {
-    return SunSpecDataPoint::convertToInt64(m_rawData, m_byteOrder);
+    return SunSpecDataPoint::convertToInt64(m_rawData.constData(), m_rawData.count(), m_byteOrder);
 }
 
 QString SunSpecDataPoint::toString() const
 {
-    return SunSpecDataPoint::convertToString(m_rawData);
+    return SunSpecDataPoint::convertToString(m_rawData.constData(), m_rawData.count());
 }
 
 float SunSpecDataPoint::toFloat() const
 {
-    Q_ASSERT_X(m_dataType == Float32,  "SunSpecDataPoint", "invalid raw data size for converting value to float");
-    return SunSpecDataPoint::convertToFloat32(m_rawData, m_byteOrder);
+    Q_ASSERT_X(m_metadata->dataType == Float32,  "SunSpecDataPoint", "invalid raw data size for converting value to float");
+    return SunSpecDataPoint::convertToFloat32(m_rawData.constData(), m_rawData.count(), m_byteOrder);
 }
 
 float SunSpecDataPoint::toFloatWithSSF(qint16 scaleFactor) const
 {
-    float value = 0;
-    switch (m_dataType) {
-    case Acc16:
-    case UInt16:
-        value = toUInt16() * pow(10, scaleFactor);
-        break;
-    case Int16:
-        value = toInt16() * pow(10, scaleFactor);
-        break;
-    case Acc32:
-    case UInt32:
-        value = toUInt32() * pow(10, scaleFactor);
-        break;
-    case Int32:
-        value = toInt32() * pow(10, scaleFactor);
-        break;
-    default:
-        Q_ASSERT_X(false,  "SunSpecDataPoint", QString("unhandled data type for converting float with scale factor %1").arg(dataType()).toLatin1());
-        break;
-    }
-
-    return value;
+    return SunSpecDataPoint::convertToFloatWithSSF(m_rawData.constData(), m_rawData.count(), scaleFactor, m_metadata->dataType, m_byteOrder);
 }
 
 double SunSpecDataPoint::toDouble() const
 {
-    Q_ASSERT_X(m_dataType == Float64,  "SunSpecDataPoint", "invalid raw data size for converting value to double");
-    return SunSpecDataPoint::convertToFloat64(m_rawData, m_byteOrder);
+    Q_ASSERT_X(m_metadata->dataType == Float64,  "SunSpecDataPoint", "invalid raw data size for converting value to double");
+    return SunSpecDataPoint::convertToFloat64(m_rawData.constData(), m_rawData.count(), m_byteOrder);
 }
 
 QString SunSpecDataPoint::registersToString(const QVector<quint16> &registers)
@@ -427,129 +274,255 @@ QString SunSpecDataPoint::registersToString(const QVector<quint16> &registers)
 
 quint16 SunSpecDataPoint::convertToUInt16(const QVector<quint16> &registers)
 {
-    Q_ASSERT_X(registers.count() == 1,  "SunSpecDataPoint", "invalid raw data size for converting value to quint16");
-    return registers.at(0);
+    return SunSpecDataPoint::convertToUInt16(registers.constData(), registers.count());
 }
 
 qint16 SunSpecDataPoint::convertToInt16(const QVector<quint16> &registers)
 {
-    Q_ASSERT_X(registers.count() == 1,  "SunSpecDataPoint", "invalid raw data size for converting value to qint16");
-    return static_cast<qint16>(registers.at(0));
+    return SunSpecDataPoint::convertToInt16(registers.constData(), registers.count());
 }
 
 quint32 SunSpecDataPoint::convertToUInt32(const QVector<quint16> &registers, ByteOrder byteOrder)
 {
-    Q_ASSERT_X(registers.count() == 2,  "SunSpecDataPoint", "invalid raw data size for converting value to quint32");
-    QByteArray data;
-    QDataStream inputStream(&data, QIODevice::WriteOnly);
-    if (byteOrder == ByteOrderBigEndian) {
-        inputStream << registers.at(0);
-        inputStream << registers.at(1);
-    } else {
-        inputStream << registers.at(1);
-        inputStream << registers.at(0);
-    }
-
-    QDataStream outputStream(&data, QIODevice::ReadOnly);
-    quint32 result = 0;
-    outputStream >> result;
-    return result;
+    return SunSpecDataPoint::convertToUInt32(registers.constData(), registers.count(), byteOrder);
 }
 
 qint32 SunSpecDataPoint::convertToInt32(const QVector<quint16> &registers, ByteOrder byteOrder)
 {
-    Q_ASSERT_X(registers.count() == 2,  "SunSpecDataPoint", "invalid raw data size for converting value to quint32");
-    QByteArray data;
-    QDataStream inputStream(&data, QIODevice::WriteOnly);
-    if (byteOrder == ByteOrderBigEndian) {
-        inputStream << registers.at(0);
-        inputStream << registers.at(1);
-    } else {
-        inputStream << registers.at(1);
-        inputStream << registers.at(0);
-    }
-
-    QDataStream outputStream(&data, QIODevice::ReadOnly);
-    qint32 result = 0;
-    outputStream >> result;
-    return result;
+    return SunSpecDataPoint::convertToInt32(registers.constData(), registers.count(), byteOrder);
 }
 
 quint64 SunSpecDataPoint::convertToUInt64(const QVector<quint16> &registers, ByteOrder byteOrder)
 {
-    Q_ASSERT_X(registers.count() == 4,  "SunSpecDataPoint", "invalid raw data size for converting value to quint64");
-    QByteArray data;
-    QDataStream inputStream(&data, QIODevice::WriteOnly);
-    if (byteOrder == ByteOrderBigEndian) {
-        inputStream << registers.at(0);
-        inputStream << registers.at(1);
-        inputStream << registers.at(2);
-        inputStream << registers.at(3);
-    } else {
-        inputStream << registers.at(3);
-        inputStream << registers.at(2);
-        inputStream << registers.at(1);
-        inputStream << registers.at(0);
-    }
-
-    QDataStream outputStream(&data, QIODevice::ReadOnly);
-    quint64 result = 0;
-    outputStream >> result;
-    return result;
+    return SunSpecDataPoint::convertToUInt64(registers.constData(), registers.count(), byteOrder);
 }
 
 qint64 SunSpecDataPoint::convertToInt64(const QVector<quint16> &registers, ByteOrder byteOrder)
 {
-    Q_ASSERT_X(registers.count() == 4,  "SunSpecDataPoint", "invalid raw data size for converting value to qint64");
-    QByteArray data;
-    QDataStream inputStream(&data, QIODevice::WriteOnly);
-    if (byteOrder == ByteOrderBigEndian) {
-        inputStream << registers.at(0);
-        inputStream << registers.at(1);
-        inputStream << registers.at(2);
-        inputStream << registers.at(3);
-    } else {
-        inputStream << registers.at(3);
-        inputStream << registers.at(2);
-        inputStream << registers.at(1);
-        inputStream << registers.at(0);
-    }
+    return SunSpecDataPoint::convertToInt64(registers.constData(), registers.count(), byteOrder);
+}
 
-    QDataStream outputStream(&data, QIODevice::ReadOnly);
-    qint64 result = 0;
-    outputStream >> result;
+QString SunSpecDataPoint::convertToString(const QVector<quint16> &registers)
+{
+    return SunSpecDataPoint::convertToString(registers.constData(), registers.count());
+}
+
+float SunSpecDataPoint::convertToFloat32(const QVector<quint16> &registers, ByteOrder byteOrder)
+{
+    return SunSpecDataPoint::convertToFloat32(registers.constData(), registers.count(), byteOrder);
+}
+
+double SunSpecDataPoint::convertToFloat64(const QVector<quint16> &registers, ByteOrder byteOrder)
+{
+    return SunSpecDataPoint::convertToFloat64(registers.constData(), registers.count(), byteOrder);
+}
+
+quint16 SunSpecDataPoint::convertToUInt16(const quint16 *registers, int count)
+{
+    Q_ASSERT_X(count == 1,  "SunSpecDataPoint", "invalid raw data size for converting value to quint16");
+    return registers[0];
+}
+
+qint16 SunSpecDataPoint::convertToInt16(const quint16 *registers, int count)
+{
+    Q_ASSERT_X(count == 1,  "SunSpecDataPoint", "invalid raw data size for converting value to qint16");
+    return static_cast<qint16>(registers[0]);
+}
+
+quint32 SunSpecDataPoint::convertToUInt32(const quint16 *registers, int count, ByteOrder byteOrder)
+{
+    Q_ASSERT_X(count == 2,  "SunSpecDataPoint", "invalid raw data size for converting value to quint32");
+    if (byteOrder == ByteOrderBigEndian)
+        return static_cast<quint32>(registers[0]) << 16 | registers[1];
+
+    return static_cast<quint32>(registers[1]) << 16 | registers[0];
+}
+
+qint32 SunSpecDataPoint::convertToInt32(const quint16 *registers, int count, ByteOrder byteOrder)
+{
+    return static_cast<qint32>(SunSpecDataPoint::convertToUInt32(registers, count, byteOrder));
+}
+
+quint64 SunSpecDataPoint::convertToUInt64(const quint16 *registers, int count, ByteOrder byteOrder)
+{
+    Q_ASSERT_X(count == 4,  "SunSpecDataPoint", "invalid raw data size for converting value to quint64");
+    quint64 result = 0;
+    for (int i = 0; i < 4; i++) {
+        result <<= 16;
+        result |= registers[byteOrder == ByteOrderBigEndian ? i : 3 - i];
+    }
     return result;
 }
 
-QString SunSpecDataPoint::convertToString(const QVector<quint16> &registers)
+qint64 SunSpecDataPoint::convertToInt64(const quint16 *registers, int count, ByteOrder byteOrder)
 {
-    QByteArray bytes;
-    QDataStream stream(&bytes, QIODevice::WriteOnly);
-    for (int i = 0; i < registers.count(); i++) {
-        stream << registers.at(i);
+    return static_cast<qint64>(SunSpecDataPoint::convertToUInt64(registers, count, byteOrder));
+}
+
+QString SunSpecDataPoint::convertToString(const quint16 *registers, int count)
+{
+    QByteArray bytes(count * 2, Qt::Uninitialized);
+    char *data = bytes.data();
+    for (int i = 0; i < count; i++) {
+        data[i * 2] = static_cast<char>(registers[i] >> 8);
+        data[i * 2 + 1] = static_cast<char>(registers[i] & 0xff);
     }
 
     return QString::fromUtf8(bytes).trimmed();
 }
 
-float SunSpecDataPoint::convertToFloat32(const QVector<quint16> &registers, ByteOrder byteOrder)
+float SunSpecDataPoint::convertToFloat32(const quint16 *registers, int count, ByteOrder byteOrder)
 {
-    Q_ASSERT_X(registers.count() == 2,  "SunSpecDataPoint", "invalid raw data size for converting value to float32");
-    quint32 rawValue = SunSpecDataPoint::convertToUInt32(registers, byteOrder);
+    Q_ASSERT_X(count == 2,  "SunSpecDataPoint", "invalid raw data size for converting value to float32");
+    quint32 rawValue = SunSpecDataPoint::convertToUInt32(registers, count, byteOrder);
     float value = 0;
     memcpy(&value, &rawValue, sizeof(quint32));
     return value;
 }
 
-double SunSpecDataPoint::convertToFloat64(const QVector<quint16> &registers, ByteOrder byteOrder)
+double SunSpecDataPoint::convertToFloat64(const quint16 *registers, int count, ByteOrder byteOrder)
 {
-    Q_ASSERT_X(registers.count() == 4,  "SunSpecDataPoint", "invalid raw data size for converting value to float64");
-    quint64 rawValue = SunSpecDataPoint::convertToUInt64(registers, byteOrder);
+    Q_ASSERT_X(count == 4,  "SunSpecDataPoint", "invalid raw data size for converting value to float64");
+    quint64 rawValue = SunSpecDataPoint::convertToUInt64(registers, count, byteOrder);
     double value = 0;
     memcpy(&value, &rawValue, sizeof(quint64));
     return value;
 }
 
+float SunSpecDataPoint::convertToFloatWithSSF(const quint16 *registers, int count, qint16 scaleFactor, DataType dataType, ByteOrder byteOrder)
+{
+    float value = 0;
+    switch (dataType) {
+    case Acc16:
+    case UInt16:
+        value = SunSpecDataPoint::convertToUInt16(registers, count) * SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        break;
+    case Int16:
+        value = SunSpecDataPoint::convertToInt16(registers, count) * SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        break;
+    case Acc32:
+    case UInt32:
+        value = SunSpecDataPoint::convertToUInt32(registers, count, byteOrder) * SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        break;
+    case Int32:
+        value = SunSpecDataPoint::convertToInt32(registers, count, byteOrder) * SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);
+        break;
+    default:
+        Q_ASSERT_X(false,  "SunSpecDataPoint", QString("unhandled data type for converting float with scale factor %1").arg(dataType).toLatin1());
+        break;
+    }
+
+    return value;
+}
+
+double SunSpecDataPoint::scaleFactorMultiplier(qint16 scaleFactor)
+{
+    static const double multipliers[] = {
+        1e-10, 1e-9, 1e-8, 1e-7, 1e-6, 1e-5, 1e-4, 1e-3, 1e-2, 1e-1,
+        1e0,
+        1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10
+    };
+
+    if (scaleFactor >= -10 && scaleFactor <= 10)
+        return multipliers[scaleFactor + 10];
+
+    return pow(10, scaleFactor);
+}
+
+bool SunSpecDataPoint::isValid(const quint16 *registers, int count, DataType dataType, ByteOrder byteOrder)
+{
+    // TODO: verify if value is not invalid code
+    if (!registers || count <= 0)
+        return false;
+
+    bool valid = true;
+    switch (dataType) {
+    case DataType::Pad:
+    case DataType::Int16:
+    case DataType::ScaleFactor:
+        if (SunSpecDataPoint::convertToUInt16(registers, count) == 0x8000)
+            valid = false;
+
+        break;
+    case DataType::Int32:
+        if (SunSpecDataPoint::convertToUInt32(registers, count, byteOrder) == 0x80000000)
+            valid = false;
+
+        break;
+    case DataType::Int64:
+        if (SunSpecDataPoint::convertToUInt64(registers, count, byteOrder) == 0x8000000000000000)
+            valid = false;
+
+        break;
+    case DataType::Raw16:
+        if (SunSpecDataPoint::convertToUInt16(registers, count) == 0x0000)
+            valid = false;
+        break;
+    case DataType::Acc16:
+        if (SunSpecDataPoint::convertToUInt16(registers, count) == 0x0000)
+            valid = false;
+
+        break;
+    case DataType::IpV4Address:
+    case DataType::Acc32:
+        if (SunSpecDataPoint::convertToUInt32(registers, count, byteOrder) == 0x00000000)
+            valid = false;
+
+        break;
+    case DataType::BitField16:
+    case DataType::Enum16:
+    case DataType::UInt16:
+        if (SunSpecDataPoint::convertToUInt16(registers, count) == 0xFFFF)
+            valid = false;
+        break;
+    case DataType::BitField32:
+    case DataType::Enum32:
+    case DataType::UInt32:
+        if (SunSpecDataPoint::convertToUInt32(registers, count, byteOrder) == 0xFFFFFFFF)
+            valid = false;
+        break;
+    case DataType::IpV6Address:
+    case DataType::Acc64:
+        if (SunSpecDataPoint::convertToUInt64(registers, count, byteOrder) == 0x0000000000000000)
+            valid = false;
+
+        break;
+        break;
+    case DataType::BitField64:
+
+        break;
+    case DataType::Float32:
+        if (SunSpecDataPoint::convertToUInt32(registers, count, byteOrder) == 0x7FC00000)
+            valid = false;
+        break;
+    case DataType::Float64:
+        if (SunSpecDataPoint::convertToUInt64(registers, count, byteOrder) == 0x7FC0000000000000)
+            valid = false;
+        break;
+    case DataType::String: {
+        bool isNull = true;
+        for (int i = 0; i < count; i++) {
+            if (registers[i] != 0x0000) {
+                isNull = false;
+                valid = true;
+                break;
+            }
+        }
+
+        if (isNull)
+            valid = false;
+
+        break;
+    }
+    case DataType::EUI48:
+    case DataType::Group:
+    case DataType::Sync:
+        break;
+    }
+
+    return valid;
+}
+
 QVector<quint16> SunSpecDataPoint::convertFromUInt16(quint16 value)
 {
     return QVector<quint16>() << value;
@@ -562,21 +535,9 @@ QVector<quint16> SunSpecDataPoint::convertFromInt16(qint16 value)
 
 QVector<quint16> SunSpecDataPoint::convertFromUInt32(quint32 value, ByteOrder byteOrder)
 {
-    QByteArray data;
-    QDataStream inputStream(&data, QIODevice::WriteOnly);
-    inputStream << value;
-
-    QDataStream outputStream(&data, QIODevice::ReadOnly);
-    QVector<quint16> values;
-    for (int i = 0; i < 2; i++) {
-         quint16 registerValue = 0;
-         outputStream >> registerValue;
-         if (byteOrder == ByteOrderBigEndian) {
-             values.append(registerValue);
-         } else {
-             values.prepend(registerValue);
-         }
-     }
+    QVector<quint16> values(2);
+    values[byteOrder == ByteOrderBigEndian ? 0 : 1] = static_cast<quint16>(value >> 16);
+    values[byteOrder == ByteOrderBigEndian ? 1 : 0] = static_cast<quint16>(value);
     return values;
 }
 
@@ -587,42 +548,17 @@ QVector<quint16> SunSpecDataPoint::convertFromInt32(qint32 value, ByteOrder byte
 
 QVector<quint16> SunSpecDataPoint::convertFromUInt64(quint64 value, ByteOrder byteOrder)
 {
-    QByteArray data;
-    QDataStream inputStream(&data, QIODevice::WriteOnly);
-    inputStream << value;
-
-    QDataStream outputStream(&data, QIODevice::ReadOnly);
-    QVector<quint16> values;
-    for (int i = 0; i < 4; i++) {
-        quint16 registerValue = 0;
-        outputStream >> registerValue;
-        if (byteOrder == ByteOrderBigEndian) {
-            values.append(registerValue);
-        } else {
-            values.prepend(registerValue);
-        }
+    QVector<quint16> values(4);
+    for (int i = 3; i >= 0; i--) {
+        values[byteOrder == ByteOrderBigEndian ? i : 3 - i] = static_cast<quint16>(value);
+        value >>= 16;
     }
     return values;
 }
 
 QVector<quint16> SunSpecDataPoint::convertFromInt64(qint64 value, ByteOrder byteOrder)
 {
-    QByteArray data;
-    QDataStream inputStream(&data, QIODevice::WriteOnly);
-    inputStream << value;
-
-    QDataStream outputStream(&data, QIODevice::ReadOnly);
-    QVector<quint16> values;
-    for (int i = 0; i < 4; i++) {
-        quint16 registerValue = 0;
-        outputStream >> registerValue;
-        if (byteOrder == ByteOrderBigEndian) {
-            values.append(registerValue);
-        } else {
-            values.prepend(registerValue);
-        }
-    }
-    return values;
+    return SunSpecDataPoint::convertFromUInt64(static_cast<quint64>(value), byteOrder);
 }
 
 QVector<quint16> SunSpecDataPoint::convertFromString(const QString &value, quint16 stringLength)
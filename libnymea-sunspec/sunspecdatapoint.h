@@ -79,52 +79,49 @@ public:
     };
     Q_ENUM(DataType)
 
+    // Read-only description of a data point. The generated models provide one static table
+    // per model class, all data points of all model instances refer to the rows of this table.
+    typedef struct Metadata {
+        const char *name;
+        const char *label;
+        const char *description;
+        const char *detail;
+        const char *units;
+        const char *sunSpecDataType;
+        const char *scaleFactorName;
+        DataType dataType;
+        Access access;
+        bool mandatory;
+        quint16 addressOffset;
+        quint16 blockOffset;
+        int size;
+    } Metadata;
+
     explicit SunSpecDataPoint();
+    explicit SunSpecDataPoint(const Metadata *metadata, ByteOrder byteOrder = ByteOrderLittleEndian);
 
-    QString name() const;
-    void setName(const QString &name);
+    const Metadata *metadata() const;
 
+    QString name() const;
     QString label() const;
-    void setLabel(const QString &label);
-
     QString description() const;
-    void setDescription(const QString &description);
-
     QString detail() const;
-    void setDetail(const QString &detail);
-
     QString units() const;
-    void setUnits(const QString &units);
-
     bool mandatory() const;
-    void setMandatory(bool mandatory);
-
     Access access() const;
-    void setAccess(Access access);
-
     quint16 addressOffset() const;
-    void setAddressOffset(quint16 addressOffset);
-
     quint16 blockOffset() const;
-    void setBlockOffset(quint16 blockOffset);
-
     QString sunSpecDataType() const;
-    void setSunSpecDataType(const QString &sunSpecDataType);
-
     DataType dataType() const;
-    void setDataType(DataType dataType);
+    int size() const;
+    QString scaleFactorName() const;
 
     ByteOrder byteOrder() const;
     void setByteOrder(ByteOrder byteOrder);
 
-    int size() const;
-    void setSize(int size);
-
-    QString scaleFactorName() const;
-    void setScaleFactorName(const QString &scaleFactorName);
-
     QVector<quint16> rawData() const;
     void setRawData(const QVector<quint16> &rawData);
+    void setRawData(const quint16 *rawData, int count);
 
     bool isValid() const;
 
@@ -155,6 +152,24 @@ public:
     static float convertToFloat32(const QVector<quint16> &registers, ByteOrder byteOrder = ByteOrderLittleEndian);
     static double convertToFloat64(const QVector<quint16> &registers, ByteOrder byteOrder = ByteOrderLittleEndian);
 
+    // Convert to, working directly on a register span without any heap allocation
+    static quint16 convertToUInt16(const quint16 *registers, int count);
+    static qint16 convertToInt16(const quint16 *registers, int count);
+    static quint32 convertToUInt32(const quint16 *registers, int count, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static qint32 convertToInt32(const quint16 *registers, int count, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static quint64 convertToUInt64(const quint16 *registers, int count, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static qint64 convertToInt64(const quint16 *registers, int count, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static QString convertToString(const quint16 *registers, int count);
+    static float convertToFloat32(const quint16 *registers, int count, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static double convertToFloat64(const quint16 *registers, int count, ByteOrder byteOrder = ByteOrderLittleEndian);
+    static float convertToFloatWithSSF(const quint16 *registers, int count, qint16 scaleFactor, DataType dataType, ByteOrder byteOrder = ByteOrderLittleEndian);
+
+    // Returns 10^scaleFactor, the valid SunSpec range -10 ... 10 gets looked up from a table
+    static double scaleFactorMultiplier(qint16 scaleFactor);
+
+    // Validate a register span for the given type without creating a data point
+    static bool isValid(const quint16 *registers, int count, DataType dataType, ByteOrder byteOrder = ByteOrderLittleEndian);
+
     // Convert from
     static QVector<quint16> convertFromUInt16(quint16 value);
     static QVector<quint16> convertFromInt16(qint16 value);
@@ -168,20 +183,8 @@ public:
     static QVector<quint16> convertFromFloat64(double value, ByteOrder byteOrder = ByteOrderLittleEndian);
 
 private:
-    QString m_name;
-    QString m_label;
-    QString m_description;
-    QString m_detail;
-    QString m_units;
-    bool m_mandatory = false;
-    Access m_access = AccessReadOnly;
-    quint16 m_addressOffset = 0;
-    quint16 m_blockOffset = 0;
-    QString m_sunSpecDataType = "uint16";
-    DataType m_dataType = DataType::UInt16;
+    const Metadata *m_metadata = nullptr;
     ByteOrder m_byteOrder = ByteOrder::ByteOrderLittleEndian; // Default is little endian: 0xAABB 0xCCDD -> 0xCCDDAABB
-    int m_size = 1;
-    QString m_scaleFactorName;
 
     QVector<quint16> m_rawData;
 };
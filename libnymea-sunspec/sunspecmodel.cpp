@@ -31,6 +31,8 @@
 #include "sunspecmodel.h"
 #include "sunspecconnection.h"
 
+#include <QMetaMethod>
+
 Q_LOGGING_CATEGORY(dcSunSpecModelData, "SunSpecModelData")
 
 SunSpecModel::SunSpecModel(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelId, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :
@@ -82,12 +84,38 @@ SunSpecDataPoint::ByteOrder SunSpecModel::byteOrder() const
 
 QHash<QString, SunSpecDataPoint> SunSpecModel::dataPoints() const
 {
-    return m_dataPoints;
+    QHash<QString, SunSpecDataPoint> dataPoints;
+    for (int i = 0; i < m_dataPointCount; i++) {
+        SunSpecDataPoint dataPoint = this->dataPoint(i);
+        dataPoints.insert(dataPoint.name(), dataPoint);
+    }
+
+    return dataPoints;
+}
+
+SunSpecDataPoint SunSpecModel::dataPoint(int index) const
+{
+    if (index < 0 || index >= m_dataPointCount)
+        return SunSpecDataPoint();
+
+    SunSpecDataPoint dataPoint(&m_dataPointMetadata[index], m_byteOrder);
+    if (dataPoint.addressOffset() + dataPoint.size() <= m_blockDataCount)
+        dataPoint.setRawData(blockRegisters() + dataPoint.addressOffset(), dataPoint.size());
+
+    return dataPoint;
+}
+
+int SunSpecModel::dataPointCount() const
+{
+    return m_dataPointCount;
 }
 
 QVector<quint16> SunSpecModel::blockData() const
 {
-    return m_blockData;
+    if (m_blockDataOffset == 0 && m_blockDataCount == m_blockData.count())
+        return m_blockData;
+
+    return m_blockData.mid(m_blockDataOffset, m_blockDataCount);
 }
 
 SunSpecModel::CommonModelInfo SunSpecModel::commonModelInfo() const
@@ -104,57 +132,51 @@ void SunSpecModel::init()
 
 void SunSpecModel::readBlockData()
 {
-    // Read the block data, start register + 2 header reisters (id, length)
-    QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister, m_modelLength + 2);
-    QModbusReply *reply = m_connection->sendReadRequest(request, m_connection->slaveId());
-    if (!reply) {
-        qCDebug(dcSunSpecModelData()) << "Read block data error: " << m_connection->modbusTcpClient()->errorString();
-        return;
-    }
+    // Modbus allows to read max. 125 registers within one request
+    const int maxChunkSize = 125;
 
-    if (reply->isFinished()) {
-        qCWarning(dcSunSpecModelData()) << "Read block data error: " << m_connection->modbusTcpClient()->errorString();
-        reply->deleteLater(); // broadcast replies return immediately
-        return;
-    }
+    // Read the block data, start register + 2 header reisters (id, length). Replies of a previous
+    // read cycle still pending will be ignored, the block data must be complete from one cycle.
+    const int blockLength = m_modelLength + 2;
+    const quint32 readCycle = ++m_readCycle;
+    m_pendingBlockData.resize(blockLength);
+    m_pendingChunkCount = 0;
 
-    connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);
-    connect(reply, &QModbusReply::finished, this, [=]() {
-        if (reply->error() != QModbusDevice::NoError) {
-            qCWarning(dcSunSpec()) << name() << description() << "Read block data response error:" << reply->error();
+    // Send all chunks back to back, the modbus TCP client pipelines them using the transaction id
+    for (int offset = 0; offset < blockLength; offset += maxChunkSize) {
+        const int count = qMin(maxChunkSize, blockLength - offset);
+        QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + offset, count);
+        QModbusReply *reply = m_connection->sendReadRequest(request, m_connection->slaveId());
+        if (!reply) {
+            qCDebug(dcSunSpecModelData()) << "Read block data error: " << m_connection->modbusTcpClient()->errorString();
+            m_readCycle++;
             return;
         }
 
-        const QModbusDataUnit unit = reply->result();
-        qCDebug(dcSunSpecModelData()) << "-->" << "Received block data" << this << unit.values().count() << SunSpecDataPoint::registersToString(unit.values());
-        m_blockData = unit.values();
-        emit blockDataChanged(m_blockData);
-
-        if (m_blockData.count() != m_modelLength + 2) {
-            qCWarning(dcSunSpecModelData()) << "Received invalid block data count from read block data request. Model lenght:" << m_modelLength << "Response block count:" << m_blockData.count();
+        if (reply->isFinished()) {
+            qCWarning(dcSunSpecModelData()) << "Read block data error: " << m_connection->modbusTcpClient()->errorString();
+            reply->deleteLater(); // broadcast replies return immediately
+            m_readCycle++;
             return;
         }
 
-        // Fill the data points
-        foreach (const QString &dataPointName, m_dataPoints.keys()) {
-            QVector<quint16> rawData = m_blockData.mid(m_dataPoints[dataPointName].addressOffset(), m_dataPoints[dataPointName].size());
-            m_dataPoints[dataPointName].setRawData(rawData);
-            qCDebug(dcSunSpecModelData()) << "Set raw data:" << m_dataPoints[dataPointName] << SunSpecDataPoint::registersToString(rawData) << (m_dataPoints[dataPointName].isValid() ? "Valid" : "Invalid");
-        }
-
-        // Fill the private member data using the data points
-        processBlockData();
-
-        // Make sure initialized gets called
-        setInitializedFinished();
+        m_pendingChunkCount++;
+        m_pendingReplyCount++;
+        connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);
+        connect(reply, &QModbusReply::finished, this, [=]() {
+            m_pendingReplyCount--;
+            processChunkReply(reply, readCycle, offset, count);
+        });
 
-        // Inform about the new block data
-        emit blockUpdated();
-    });
+        connect(reply, &QModbusReply::errorOccurred, this, [this, reply] (QModbusDevice::Error error) {
+            qCWarning(dcSunSpecModelData())  << name() << description() << "Modbus reply while reading block data. Error:" << error << reply->errorString();
+        });
+    }
+}
 
-    connect(reply, &QModbusReply::errorOccurred, this, [this, reply] (QModbusDevice::Error error) {
-        qCWarning(dcSunSpecModelData())  << name() << description() << "Modbus reply while reading block data. Error:" << error << reply->errorString();
-    });
+bool SunSpecModel::readPending() const
+{
+    return m_pendingReplyCount > 0;
 }
 
 bool SunSpecModel::operator ==(const SunSpecModel &other) const
@@ -174,6 +196,93 @@ void SunSpecModel::setInitializedFinished()
     }
 }
 
+void SunSpecModel::processChunkReply(QModbusReply *reply, quint32 readCycle, int offset, int count)
+{
+    // Ignore chunks from an outdated or already failed read cycle
+    if (readCycle != m_readCycle)
+        return;
+
+    if (reply->error() != QModbusDevice::NoError) {
+        qCWarning(dcSunSpec()) << name() << description() << "Read block data response error:" << reply->error();
+        m_readCycle++;
+        return;
+    }
+
+    const QModbusDataUnit unit = reply->result();
+    if (static_cast<int>(unit.valueCount()) != count) {
+        qCWarning(dcSunSpecModelData()) << "Received invalid block data count from read block data request. Model lenght:" << m_modelLength << "Offset:" << offset << "Requested:" << count << "Response block count:" << unit.valueCount();
+        m_readCycle++;
+        return;
+    }
+
+    const QVector<quint16> values = unit.values();
+    if (offset == 0 && values.at(0) != m_modelId) {
+        // The model map changed since it has been discovered (or restored from a cache)
+        qCWarning(dcSunSpecModelData()) << "Block data of" << this << "does not start with the model id" << m_modelId << "but with" << values.at(0);
+        m_readCycle++;
+        if (!m_initialized) {
+            m_initTimer.stop();
+            emit initFinished(false);
+        }
+        return;
+    }
+
+    std::copy(values.constBegin(), values.constEnd(), m_pendingBlockData.begin() + offset);
+
+    m_pendingChunkCount--;
+    if (m_pendingChunkCount > 0)
+        return;
+
+    // All chunks of this cycle arrived, take over the assembled block and keep the old storage for the next cycle
+    m_blockData.swap(m_pendingBlockData);
+    m_blockDataOffset = 0;
+    m_blockDataCount = m_blockData.count();
+    finishBlockUpdate();
+}
+
+void SunSpecModel::processSweepData(const QVector<quint16> &sweepData, int offset, int count)
+{
+    // Make sure the map did not change since the discovery
+    if (offset + count > sweepData.count() || sweepData.at(offset) != m_modelId) {
+        qCWarning(dcSunSpecModelData()) << "Sweep data for" << this << "does not start with the model id. Skipping the update.";
+        return;
+    }
+
+    // Share the sweep buffer instead of copying the slice of this model
+    m_blockData = sweepData;
+    m_blockDataOffset = offset;
+    m_blockDataCount = count;
+    finishBlockUpdate();
+}
+
+void SunSpecModel::finishBlockUpdate()
+{
+    qCDebug(dcSunSpecModelData()) << "-->" << "Received block data" << this << m_blockDataCount << SunSpecDataPoint::registersToString(blockData());
+
+    // Copying the block data for the signal only makes sense if somebody is listening
+    if (isSignalConnected(QMetaMethod::fromSignal(&SunSpecModel::blockDataChanged)))
+        emit blockDataChanged(blockData());
+
+    // Fill the private member data, the generated models decode directly from the block data
+    processBlockData();
+
+    // Make sure initialized gets called
+    setInitializedFinished();
+
+    // Inform about the new block data
+    emit blockUpdated();
+}
+
+const quint16 *SunSpecModel::blockRegisters() const
+{
+    return m_blockData.constData() + m_blockDataOffset;
+}
+
+int SunSpecModel::blockRegisterCount() const
+{
+    return m_blockDataCount;
+}
+
 QDebug operator<<(QDebug debug, SunSpecModel *model)
 {
     debug.nospace().noquote() << "SunSpecModel(Model: " << model->modelId() << ", " << model->name() << ", " << model->label() << ", Register: " << model->modbusStartRegister() << ", Length: " << model->modelLength() << ")";
@@ -80,8 +80,14 @@ public:
     quint16 modbusStartRegister() const;
 
     SunSpecDataPoint::ByteOrder byteOrder() const;
+
+    // Data points by name, built on demand from the index based storage for compatibility
     QHash<QString, SunSpecDataPoint> dataPoints() const;
 
+    // Data point by the DataPointIndex of the model, including the raw data of the current block
+    SunSpecDataPoint dataPoint(int index) const;
+    int dataPointCount() const;
+
     QVector<quint16> blockData() const;
 
     CommonModelInfo commonModelInfo() const;
@@ -89,6 +95,9 @@ public:
     virtual void init();
     virtual void readBlockData();
 
+    // True as long as replies of a block data read are outstanding, even from an aborted read cycle
+    bool readPending() const;
+
     bool operator==(const SunSpecModel &other) const;
 
 protected:
@@ -104,12 +113,31 @@ protected:
 
     bool m_initialized = false;
 
+    // The block data is either owned by the model or shared with the sweep buffer of the connection,
+    // the registers of this model start at m_blockDataOffset.
     QVector<quint16> m_blockData;
-    QHash<QString, SunSpecDataPoint> m_dataPoints;
+    int m_blockDataOffset = 0;
+    int m_blockDataCount = 0;
+
+    // Static data point table of the model class, indexed by the DataPointIndex of the model
+    const SunSpecDataPoint::Metadata *m_dataPointMetadata = nullptr;
+    int m_dataPointCount = 0;
 
     CommonModelInfo m_commonModelInfo;
 
+    // Block read cycle, long models get read in chunks which will be assembled here
+    QVector<quint16> m_pendingBlockData;
+    quint32 m_readCycle = 0;
+    int m_pendingChunkCount = 0;
+    int m_pendingReplyCount = 0;
+
     void setInitializedFinished();
+    void processChunkReply(QModbusReply *reply, quint32 readCycle, int offset, int count);
+    void processSweepData(const QVector<quint16> &sweepData, int offset, int count);
+    void finishBlockUpdate();
+
+    const quint16 *blockRegisters() const;
+    int blockRegisterCount() const;
 
     virtual void processBlockData() = 0;
 
@@ -50,6 +50,29 @@ quint16 SunSpecModelRepeatingBlock::blockSize() const
     return m_blockSize;
 }
 
+QHash<QString, SunSpecDataPoint> SunSpecModelRepeatingBlock::dataPoints() const
+{
+    QHash<QString, SunSpecDataPoint> dataPoints;
+    for (int i = 0; i < m_dataPointCount; i++) {
+        SunSpecDataPoint dataPoint = this->dataPoint(i);
+        dataPoints.insert(dataPoint.name(), dataPoint);
+    }
+
+    return dataPoints;
+}
+
+SunSpecDataPoint SunSpecModelRepeatingBlock::dataPoint(int index) const
+{
+    if (index < 0 || index >= m_dataPointCount)
+        return SunSpecDataPoint();
+
+    SunSpecDataPoint dataPoint(&m_dataPointMetadata[index], m_byteOrder);
+    if (dataPoint.addressOffset() + dataPoint.size() <= m_blockData.count())
+        dataPoint.setRawData(m_blockData.constData() + dataPoint.addressOffset(), dataPoint.size());
+
+    return dataPoint;
+}
+
 QDebug operator<<(QDebug debug, SunSpecModelRepeatingBlock *repeatingBlock)
 {
     debug.nospace().noquote() << "SunSpecModelRepeatingBlock(Name: " << repeatingBlock->name();
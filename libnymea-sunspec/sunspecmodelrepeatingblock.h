@@ -49,6 +49,9 @@ public:
     quint16 blockIndex() const;
     quint16 blockSize() const;
 
+    QHash<QString, SunSpecDataPoint> dataPoints() const;
+    SunSpecDataPoint dataPoint(int index) const;
+
     virtual void processBlockData(const QVector<quint16> blockData) = 0;
 
 protected:
@@ -58,7 +61,8 @@ protected:
 
     SunSpecDataPoint::ByteOrder m_byteOrder = SunSpecDataPoint::ByteOrderLittleEndian;
     QVector<quint16> m_blockData;
-    QHash<QString, SunSpecDataPoint> m_dataPoints;
+    const SunSpecDataPoint::Metadata *m_dataPointMetadata = nullptr;
+    int m_dataPointCount = 0;
 
     virtual void initDataPoints() = 0;
 
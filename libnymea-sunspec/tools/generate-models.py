@@ -246,55 +246,51 @@ def writeClassFlags(fileDescriptor, className, points):
         writeLine(fileDescriptor)
 
 
-def addDataPointInitialization(fileDescriptor, dataPoint, addressOffset, indentation = 1):
-    linePrepend = ''
-    for i in range(indentation):
-        linePrepend += '    '
+def getCStringLiteral(dataPoint, key):
+    if key in dataPoint:
+        return '"%s"' % dataPoint[key]
 
-    # Get property name
-    propertyName = getPropertyName(dataPoint) + 'DataPoint'
-
-    writeLine(fileDescriptor, linePrepend + 'SunSpecDataPoint %s;' % propertyName)
-    writeLine(fileDescriptor, linePrepend + '%s.setName("%s");' % (propertyName, dataPoint['name']))
-    
-    if 'label' in dataPoint:
-        writeLine(fileDescriptor, linePrepend + '%s.setLabel("%s");' % (propertyName, dataPoint['label']))
+    return 'nullptr'
 
-    if 'desc' in dataPoint:
-        writeLine(fileDescriptor, linePrepend + '%s.setDescription("%s");' % (propertyName, dataPoint['desc']))
 
-    if 'detail' in dataPoint:
-        writeLine(fileDescriptor, linePrepend + '%s.setDetail("%s");' % (propertyName, dataPoint['detail']))
+def writeDataPointMetadataTable(fileDescriptor, tableName, dataPoints):
+    # One static, read-only row per data point, in the order of the DataPointIndex enum
+    writeLine(fileDescriptor, 'static const SunSpecDataPoint::Metadata %s[] = {' % tableName)
+    addressOffset = 0
+    for i in range(len(dataPoints)):
+        dataPoint = dataPoints[i]
+        size = 1
+        if 'size' in dataPoint:
+            size = int(dataPoint['size'])
 
-    if 'units' in dataPoint:
-        writeLine(fileDescriptor, linePrepend + '%s.setUnits("%s");' % (propertyName, dataPoint['units']))
+        blockOffset = max(addressOffset - 2, 0)
 
-    if 'mandatory' in dataPoint and dataPoint['mandatory'] == 'M':
-        writeLine(fileDescriptor, linePrepend + '%s.setMandatory(true);' % (propertyName))
+        sunSpecDataType = '"uint16"'
+        if 'type' in dataPoint:
+            sunSpecDataType = '"%s"' % dataPoint['type']
 
-    size = 0
-    if 'size' in dataPoint:
-        size = int(dataPoint['size'])
-        writeLine(fileDescriptor, linePrepend + '%s.setSize(%s);' % (propertyName, size))
+        access = 'SunSpecDataPoint::AccessReadOnly'
+        if 'access' in dataPoint and dataPoint['access'] == 'RW':
+            access = 'SunSpecDataPoint::AccessReadWrite'
 
-    writeLine(fileDescriptor, linePrepend + '%s.setAddressOffset(%s);' % (propertyName, addressOffset))
-    blockOffset = addressOffset - 2
-    if blockOffset >= 0:
-        writeLine(fileDescriptor, linePrepend + '%s.setBlockOffset(%s);' % (propertyName, blockOffset))
+        mandatory = 'false'
+        if 'mandatory' in dataPoint and dataPoint['mandatory'] == 'M':
+            mandatory = 'true'
 
-    if 'sf' in dataPoint:
-        writeLine(fileDescriptor, linePrepend + '%s.setScaleFactorName("%s");' % (propertyName, dataPoint['sf']))
+        row = '    { %s, %s, %s, %s, %s, %s, %s, %s, %s, %s, %s, %s, %s }' % (getCStringLiteral(dataPoint, 'name'), getCStringLiteral(dataPoint, 'label'), 
+            getCStringLiteral(dataPoint, 'desc'), getCStringLiteral(dataPoint, 'detail'), getCStringLiteral(dataPoint, 'units'), sunSpecDataType, 
+            getCStringLiteral(dataPoint, 'sf'), getDataTypeName(dataPoint), access, mandatory, addressOffset, blockOffset, size)
 
-    if 'type' in dataPoint:
-        writeLine(fileDescriptor, linePrepend + '%s.setSunSpecDataType("%s");' % (propertyName, dataPoint['type']))
+        if i < (len(dataPoints) - 1):
+            row += ','
 
-    if 'access' in dataPoint and dataPoint['access'] == 'RW':
-        writeLine(fileDescriptor, linePrepend + '%s.setAccess(SunSpecDataPoint::AccessReadWrite);' % (propertyName))
+        writeLine(fileDescriptor, '    // %s' % getDataPointIndexName(dataPoint))
+        writeLine(fileDescriptor, row)
+        if 'size' in dataPoint:
+            addressOffset += int(dataPoint['size'])
 
-    writeLine(fileDescriptor, linePrepend + '%s.setByteOrder(m_byteOrder);' % (propertyName))
-    writeLine(fileDescriptor, linePrepend + 'm_dataPoints.insert(%s.name(), %s);' % (propertyName, propertyName))
+    writeLine(fileDescriptor, '};')
     writeLine(fileDescriptor)
-    return size
 
 
 def getEnumName(dataPoint):
@@ -324,6 +320,81 @@ def getPropertyName(dataPoint):
     return propertyName[0].lower() + propertyName[1:] 
 
 
+def getDataPointIndexName(dataPoint):
+    propertyName = getPropertyName(dataPoint)
+    return 'DataPointIndex' + propertyName[0].upper() + propertyName[1:]
+
+
+def getDataTypeName(dataPoint):
+    # Same mapping as SunSpecDataPoint::stringToDataType(), evaluated at generation time
+    dataTypes = {
+        'int16': 'Int16',
+        'int32': 'Int32',
+        'int64': 'Int64',
+        'uint16': 'UInt16',
+        'raw16': 'Raw16',
+        'uint32': 'UInt32',
+        'acc16': 'Acc16',
+        'acc32': 'Acc32',
+        'acc64': 'Acc64',
+        'bitfield16': 'BitField16',
+        'bitfield32': 'BitField32',
+        'bitfield64': 'BitField64',
+        'enum16': 'Enum16',
+        'enum32': 'Enum32',
+        'float32': 'Float32',
+        'float64': 'Float64',
+        'string': 'String',
+        'sunssf': 'ScaleFactor',
+        'pad': 'Pad',
+        'ipaddr': 'IpV4Address',
+        'ipv6addr': 'IpV6Address',
+        'eui48': 'EUI48',
+        'group': 'Group',
+        'sync': 'Sync'
+    }
+
+    dataType = 'UInt16'
+    if dataPoint['type'] in dataTypes:
+        dataType = dataTypes[dataPoint['type']]
+
+    return 'SunSpecDataPoint::' + dataType
+
+
+def getDataPointAddressOffsets(dataPoints):
+    addressOffsets = {}
+    addressOffset = 0
+    for dataPoint in dataPoints:
+        addressOffsets[dataPoint['name']] = addressOffset
+        if 'size' in dataPoint:
+            addressOffset += int(dataPoint['size'])
+
+    return addressOffsets
+
+
+def writeDataPointIndexEnum(fileDescriptor, dataPoints):
+    writeLine(fileDescriptor, '    enum DataPointIndex {')
+    indexNames = []
+    for i in range(len(dataPoints)):
+        indexName = getDataPointIndexName(dataPoints[i])
+        if indexName in indexNames:
+            print('Error: duplicated data point index', indexName)
+            exit(1)
+
+        indexNames.append(indexName)
+        line = '        %s' % indexName
+        if i == 0:
+            line += ' = 0'
+
+        if i < (len(dataPoints) - 1):
+            line += ','
+
+        writeLine(fileDescriptor, line)
+
+    writeLine(fileDescriptor, '    };')
+    writeLine(fileDescriptor)
+
+
 def getModelLength(modelData):
     dataPoints = modelData['group']['points']
     modelLength = 0
@@ -404,118 +475,133 @@ def getCppType(dataPoint):
         return dataPoint['type']
 
 
-def getConvertionMethodFromSunspecType(dataPoint, scaleFactorProperty):
+def getStaticConvertion(dataPoint, registers, convertion, scaleFactor = ''):
+    # Decode directly from the register span of the block data, the size is known from the model definition
+    size = int(dataPoint['size'])
+    if convertion == 'FloatWithSSF':
+        return ('SunSpecDataPoint::convertToFloatWithSSF(%s, %s, %s, %s, m_byteOrder)' % (registers, size, scaleFactor, getDataTypeName(dataPoint)))
+    elif convertion == 'Float':
+        return ('SunSpecDataPoint::convertToFloat32(%s, %s, m_byteOrder)' % (registers, size))
+    elif convertion == 'Double':
+        return ('SunSpecDataPoint::convertToFloat64(%s, %s, m_byteOrder)' % (registers, size))
+    elif convertion == 'UInt16' or convertion == 'Int16' or convertion == 'String':
+        return ('SunSpecDataPoint::convertTo%s(%s, %s)' % (convertion, registers, size))
+    else:
+        return ('SunSpecDataPoint::convertTo%s(%s, %s, m_byteOrder)' % (convertion, registers, size))
+
+
+def getConvertionMethodFromSunspecType(dataPoint, scaleFactorProperty, registers):
     typeString = dataPoint['type']
     if typeString == 'uint16' or typeString == 'acc16' or typeString == 'pad' or typeString == 'raw16':
         # If we have a scale factor set, this is gonna be a float value
         if 'sf' in dataPoint:
             # This is a float value with scale factor
             if scaleFactorProperty == '':
-                return ('m_dataPoints.value("%s").toFloatWithSSF(%s)' % (dataPoint['name'], dataPoint['sf']))
+                return getStaticConvertion(dataPoint, registers, 'FloatWithSSF', dataPoint['sf'])
             else:
-                return ('m_dataPoints.value("%s").toFloatWithSSF(%s)' % (dataPoint['name'], scaleFactorProperty))
+                return getStaticConvertion(dataPoint, registers, 'FloatWithSSF', scaleFactorProperty)
         else:
-            return ('m_dataPoints.value("%s").toUInt16()' % dataPoint['name'])
+            return getStaticConvertion(dataPoint, registers, 'UInt16')
 
     elif typeString == 'int16':
         # If we have a scale factor set, this is gonna be a float value
         if 'sf' in dataPoint:
             # This is a float value with scale factor
             if scaleFactorProperty == '':
-                return ('m_dataPoints.value("%s").toFloatWithSSF(%s)' % (dataPoint['name'], dataPoint['sf']))
+                return getStaticConvertion(dataPoint, registers, 'FloatWithSSF', dataPoint['sf'])
             else:
-                return ('m_dataPoints.value("%s").toFloatWithSSF(%s)' % (dataPoint['name'], scaleFactorProperty))
+                return getStaticConvertion(dataPoint, registers, 'FloatWithSSF', scaleFactorProperty)
         else:
-            return ('m_dataPoints.value("%s").toInt16()' % dataPoint['name'])
+            return getStaticConvertion(dataPoint, registers, 'Int16')
     
     elif typeString == 'uint32' or typeString == 'acc32' or typeString == 'pad32':
         # If we have a scale factor set, this is gonna be a float value
         if 'sf' in dataPoint:
             # This is a float value with scale factor
             if scaleFactorProperty == '':
-                return ('m_dataPoints.value("%s").toFloatWithSSF(%s)' % (dataPoint['name'], dataPoint['sf']))
+                return getStaticConvertion(dataPoint, registers, 'FloatWithSSF', dataPoint['sf'])
             else:
-                return ('m_dataPoints.value("%s").toFloatWithSSF(%s)' % (dataPoint['name'], scaleFactorProperty))
+                return getStaticConvertion(dataPoint, registers, 'FloatWithSSF', scaleFactorProperty)
         else:
-            return ('m_dataPoints.value("%s").toUInt32()' % dataPoint['name'])
+            return getStaticConvertion(dataPoint, registers, 'UInt32')
 
     elif typeString == 'int32':
         # If we have a scale factor set, this is gonna be a float value
         if 'sf' in dataPoint:
             # This is a float value with scale factor
             if scaleFactorProperty == '':
-                return ('m_dataPoints.value("%s").toFloatWithSSF(%s)' % (dataPoint['name'], dataPoint['sf']))
+                return getStaticConvertion(dataPoint, registers, 'FloatWithSSF', dataPoint['sf'])
             else:
-                return ('m_dataPoints.value("%s").toFloatWithSSF(%s)' % (dataPoint['name'], scaleFactorProperty))
+                return getStaticConvertion(dataPoint, registers, 'FloatWithSSF', scaleFactorProperty)
         else:
-            return ('m_dataPoints.value("%s").toInt32()' % dataPoint['name'])
+            return getStaticConvertion(dataPoint, registers, 'Int32')
 
     elif typeString == 'uint64':
         # If we have a scale factor set, this is gonna be a float value
         if 'sf' in dataPoint:
             # This is a float value with scale factor
             if scaleFactorProperty == '':
-                return ('m_dataPoints.value("%s").toFloatWithSSF(%s)' % (dataPoint['name'], dataPoint['sf']))
+                return getStaticConvertion(dataPoint, registers, 'FloatWithSSF', dataPoint['sf'])
             else:
-                return ('m_dataPoints.value("%s").toFloatWithSSF(%s)' % (dataPoint['name'], scaleFactorProperty))
+                return getStaticConvertion(dataPoint, registers, 'FloatWithSSF', scaleFactorProperty)
         else:
-            return ('m_dataPoints.value("%s").toUInt64()' % dataPoint['name'])
+            return getStaticConvertion(dataPoint, registers, 'UInt64')
 
     elif typeString == 'int64' or typeString == 'acc64':
         # If we have a scale factor set, this is gonna be a float value
         if 'sf' in dataPoint:
             # This is a float value with scale factor
             if scaleFactorProperty == '':
-                return ('m_dataPoints.value("%s").toFloatWithSSF(%s)' % (dataPoint['name'], dataPoint['sf']))
+                return getStaticConvertion(dataPoint, registers, 'FloatWithSSF', dataPoint['sf'])
             else:
-                return ('m_dataPoints.value("%s").toFloatWithSSF(%s)' % (dataPoint['name'], scaleFactorProperty))
+                return getStaticConvertion(dataPoint, registers, 'FloatWithSSF', scaleFactorProperty)
         else:
-            return ('m_dataPoints.value("%s").toInt64()' % dataPoint['name'])
+            return getStaticConvertion(dataPoint, registers, 'Int64')
 
     elif typeString == 'sunssf':
-        return ('m_dataPoints.value("%s").toInt16()' % dataPoint['name'])
+        return getStaticConvertion(dataPoint, registers, 'Int16')
 
     elif typeString == 'count':
-        return ('m_dataPoints.value("%s").toUInt16()' % dataPoint['name'])
+        return getStaticConvertion(dataPoint, registers, 'UInt16')
 
     elif typeString == 'string':
-        return ('m_dataPoints.value("%s").toString()' % dataPoint['name'])
+        return getStaticConvertion(dataPoint, registers, 'String')
 
     elif typeString == 'float32':
-        return ('m_dataPoints.value("%s").toFloat()' % dataPoint['name'])
+        return getStaticConvertion(dataPoint, registers, 'Float')
 
     elif typeString == 'float64':
-        return ('m_dataPoints.value("%s").toDouble()' % dataPoint['name'])
+        return getStaticConvertion(dataPoint, registers, 'Double')
 
     elif typeString == 'enum16':
         if 'symbols' in dataPoint:
-            return ('static_cast<%s>(m_dataPoints.value("%s").toUInt16())' % (getEnumName(dataPoint), dataPoint['name']))
+            return ('static_cast<%s>(%s)' % (getEnumName(dataPoint), getStaticConvertion(dataPoint, registers, 'UInt16')))
         else:
-            return ('m_dataPoints.value("%s").toUInt16()' % dataPoint['name'])
+            return getStaticConvertion(dataPoint, registers, 'UInt16')
 
     elif typeString == 'enum32':
         if 'symbols' in dataPoint:
-            return ('static_cast<%s>(m_dataPoints.value("%s").toUInt32())' % (getEnumName(dataPoint), dataPoint['name']))
+            return ('static_cast<%s>(%s)' % (getEnumName(dataPoint), getStaticConvertion(dataPoint, registers, 'UInt32')))
         else:
-            return ('m_dataPoints.value("%s").toUInt32()' % dataPoint['name'])
+            return getStaticConvertion(dataPoint, registers, 'UInt32')
 
     elif typeString == 'bitfield16':
         if 'symbols' in dataPoint:
-            return ('static_cast<%sFlags>(m_dataPoints.value("%s").toUInt16())' % (getEnumName(dataPoint), dataPoint['name']))
+            return ('static_cast<%sFlags>(%s)' % (getEnumName(dataPoint), getStaticConvertion(dataPoint, registers, 'UInt16')))
         else:
-            return ('m_dataPoints.value("%s").toUInt16()' % dataPoint['name'])
+            return getStaticConvertion(dataPoint, registers, 'UInt16')
 
     elif typeString == 'bitfield32':
         if 'symbols' in dataPoint:
-            return ('static_cast<%sFlags>(m_dataPoints.value("%s").toUInt32())' % (getEnumName(dataPoint), dataPoint['name']))
+            return ('static_cast<%sFlags>(%s)' % (getEnumName(dataPoint), getStaticConvertion(dataPoint, registers, 'UInt32')))
         else:
-            return ('m_dataPoints.value("%s").toUInt32()' % dataPoint['name'])
+            return getStaticConvertion(dataPoint, registers, 'UInt32')
 
     elif typeString == 'bitfield64':
         if 'symbols' in dataPoint:
-            return ('static_cast<%sFlags>(m_dataPoints.value("%s").toUInt64())' % (getEnumName(dataPoint), dataPoint['name']))
+            return ('static_cast<%sFlags>(%s)' % (getEnumName(dataPoint), getStaticConvertion(dataPoint, registers, 'UInt64')))
         else:
-            return ('m_dataPoints.value("%s").toUInt64()' % dataPoint['name'])
+            return getStaticConvertion(dataPoint, registers, 'UInt64')
 
 
 def getConvertionMethodToSunspecType(dataPoint, scaleFactorProperty):
@@ -656,7 +742,7 @@ def addPropertiesMethodImplementation(fileDescriptor, className, dataPoints):
             writeLine(fileDescriptor, '    if (!m_initialized)')
             writeLine(fileDescriptor, '        return nullptr;')
             writeLine(fileDescriptor)
-            writeLine(fileDescriptor, '    SunSpecDataPoint dp = m_dataPoints.value("%s");' % dataPoint['name'])
+            writeLine(fileDescriptor, '    const SunSpecDataPoint dp(&m_dataPointMetadata[%s]);' % getDataPointIndexName(dataPoint))
             scaleFactorProperty = ''
             if 'sf' in dataPoint:
                 # Get the scale factor propery
@@ -707,7 +793,7 @@ def addPropertiesMethodImplementationRepeatingBlock(fileDescriptor, className, d
                 writeLine(fileDescriptor, 'QModbusReply *%s::set%s(%s %s)' % (className,convertToCamelCase(propertyName, True), getCppType(dataPoint), propertyName))
 
             writeLine(fileDescriptor, '{')
-            writeLine(fileDescriptor, '    SunSpecDataPoint dp = m_dataPoints.value("%s");' % dataPoint['name'])
+            writeLine(fileDescriptor, '    const SunSpecDataPoint dp(&m_dataPointMetadata[%s]);' % getDataPointIndexName(dataPoint))
             scaleFactorProperty = ''
             if 'sf' in dataPoint:
                 # First check if we have the scale factor in the block
@@ -752,10 +838,35 @@ def addPropertiesDeclaration(fileDescriptor, dataPoints):
              initValue = ' = 0'
 
         writeLine(fileDescriptor, '    %s m_%s%s;' %(cppType, propertyName, initValue))
+        if dataPoint['type'] == 'sunssf':
+            # Matches the initial scale factor 0
+            writeLine(fileDescriptor, '    double m_%sMultiplier = 1;' % propertyName)
 
 
 def writeProcessDataImplementation(fileDescriptor, className, dataPoints, parentDataPoints = None):
     print('Write processData() implementation')
+    addressOffsets = getDataPointAddressOffsets(dataPoints)
+
+    # Types decoded as integer times the scale factor multiplier, the same types convertToFloatWithSSF() handles
+    scaledTypes = {
+        'uint16': 'UInt16',
+        'acc16': 'UInt16',
+        'int16': 'Int16',
+        'uint32': 'UInt32',
+        'acc32': 'UInt32',
+        'int32': 'Int32'
+    }
+
+    # Decode directly from the block data using the offsets of the model definition, data points
+    # not covered by the received block (i.e. shorter model length from the device) stay untouched.
+    if parentDataPoints == None:
+        # The model block data might be a slice of the shared sweep buffer
+        writeLine(fileDescriptor, '    const quint16 *registers = blockRegisters();')
+        writeLine(fileDescriptor, '    const int registerCount = blockRegisterCount();')
+    else:
+        writeLine(fileDescriptor, '    const quint16 *registers = m_blockData.constData();')
+        writeLine(fileDescriptor, '    const int registerCount = m_blockData.count();')
+    writeLine(fileDescriptor)
 
     # Parse first the scale factors:
     hasScaleFactors = False
@@ -768,11 +879,18 @@ def writeProcessDataImplementation(fileDescriptor, className, dataPoints, parent
         writeLine(fileDescriptor, '    // Scale factors')
         for dataPoint in dataPoints:
             if dataPoint['type'] == 'sunssf':
-                convertionMethod = getConvertionMethodFromSunspecType(dataPoint, '')
-                writeLine(fileDescriptor, '    if (m_dataPoints.value("%s").isValid())' % (dataPoint['name']))
-                writeLine(fileDescriptor, '        m_%s = %s;' % (getPropertyName(dataPoint), convertionMethod))
+                # The scale factors hardly ever change, recompute the multiplier only if they do
+                propertyName = getPropertyName(dataPoint)
+                writeDataPointValidCheck(fileDescriptor, dataPoint, addressOffsets[dataPoint['name']], True)
+                convertionMethod = getConvertionMethodFromSunspecType(dataPoint, '', 'registers + %s' % addressOffsets[dataPoint['name']])
+                writeLine(fileDescriptor, '        const qint16 scaleFactor = %s;' % convertionMethod)
+                writeLine(fileDescriptor, '        if (scaleFactor != m_%s) {' % propertyName)
+                writeLine(fileDescriptor, '            m_%s = scaleFactor;' % propertyName)
+                writeLine(fileDescriptor, '            m_%sMultiplier = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);' % propertyName)
+                writeLine(fileDescriptor, '        }')
+                writeLine(fileDescriptor, '    }')
                 writeLine(fileDescriptor)
-                
+
         writeLine(fileDescriptor)
     
     writeLine(fileDescriptor, '    // Update properties according to the data point type')
@@ -782,9 +900,28 @@ def writeProcessDataImplementation(fileDescriptor, className, dataPoints, parent
         if propertyName == 'modelId' or propertyName == 'modelLength':
             continue
 
-        writeLine(fileDescriptor, '    if (m_dataPoints.value("%s").isValid())' % (dataPoint['name']))
+        # Already decoded with the scale factors
+        if dataPoint['type'] == 'sunssf':
+            continue
 
-        if 'sf' in dataPoint:
+        registers = 'registers + %s' % addressOffsets[dataPoint['name']]
+        writeDataPointValidCheck(fileDescriptor, dataPoint, addressOffsets[dataPoint['name']])
+
+        if 'sf' in dataPoint and dataPoint['type'] in scaledTypes:
+            # Integer value times the cached multiplier of the scale factor
+            multiplier = 'SunSpecDataPoint::scaleFactorMultiplier(%s)' % dataPoint['sf']
+            for dp in dataPoints:
+                if dp['name'] == dataPoint['sf']:
+                    multiplier = 'm_%sMultiplier' % getPropertyName(dp)
+
+            if multiplier.startswith('SunSpecDataPoint') and parentDataPoints != None:
+                for dp in parentDataPoints:
+                    if dp['name'] == dataPoint['sf']:
+                        multiplier = 'SunSpecDataPoint::scaleFactorMultiplier(m_parentModel->%s())' % getPropertyName(dp)
+
+            convertionMethod = '%s * %s' % (getStaticConvertion(dataPoint, registers, scaledTypes[dataPoint['type']]), multiplier)
+            writeLine(fileDescriptor, '        m_%s = %s;' % (getPropertyName(dataPoint), convertionMethod))
+        elif 'sf' in dataPoint:
             # Get the scale factor propery
             scaleFactorProperty = ''
             for dp in dataPoints:
@@ -799,10 +936,10 @@ def writeProcessDataImplementation(fileDescriptor, className, dataPoints, parent
 
 
 
-            convertionMethod = getConvertionMethodFromSunspecType(dataPoint, scaleFactorProperty)
+            convertionMethod = getConvertionMethodFromSunspecType(dataPoint, scaleFactorProperty, registers)
             writeLine(fileDescriptor, '        m_%s = %s;' % (getPropertyName(dataPoint), convertionMethod))
         else:
-            convertionMethod = getConvertionMethodFromSunspecType(dataPoint, '')
+            convertionMethod = getConvertionMethodFromSunspecType(dataPoint, '', registers)
             writeLine(fileDescriptor, '        m_%s = %s;' % (getPropertyName(dataPoint), convertionMethod))
         
         writeLine(fileDescriptor)
@@ -810,6 +947,15 @@ def writeProcessDataImplementation(fileDescriptor, className, dataPoints, parent
     writeLine(fileDescriptor, '    qCDebug(dcSunSpecModelData()) << this;')
 
 
+def writeDataPointValidCheck(fileDescriptor, dataPoint, addressOffset, openScope = False):
+    size = int(dataPoint['size'])
+    line = '    if (registerCount >= %s && SunSpecDataPoint::isValid(registers + %s, %s, %s, m_byteOrder))' % (addressOffset + size, addressOffset, size, getDataTypeName(dataPoint))
+    if openScope:
+        line += ' {'
+
+    writeLine(fileDescriptor, line)
+
+
 def writePropertyDebugLine(fileDescriptor, className, modelId):
     print('Write class debug properties')
     modelData = models[modelId]
@@ -825,7 +971,7 @@ def writePropertyDebugLine(fileDescriptor, className, modelId):
             continue
 
         propertyName = getPropertyName(dataPoint)
-        dataPointString = ('model->dataPoints().value("%s")' % dataPoint['name'])
+        dataPointString = ('model->dataPoint(%s::%s)' % (className, getDataPointIndexName(dataPoint)))
         writeLine(fileDescriptor, '    debug.nospace().noquote() << "    - " << %s << "-->";' % dataPointString)
         writeLine(fileDescriptor, '    if (%s.isValid()) {' % (dataPointString))
         writeLine(fileDescriptor, '        debug.nospace().noquote() << model->%s() << "\\n";' % (propertyName))
@@ -866,6 +1012,7 @@ def writeRepeatingBlockClassDefinition(fileDescriptor, className, modelId):
     writeLine(fileDescriptor)
     writeClassEnums(fileDescriptor, className, dataPoints)
     writeClassFlags(fileDescriptor, className, dataPoints)
+    writeDataPointIndexEnum(fileDescriptor, dataPoints)
 
    # Constructor
     writeLine(fileDescriptor, '    explicit %s(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, %s *parent = nullptr);' % (blockClassName, className))
@@ -921,6 +1068,8 @@ def writeRepeatingBlockClassImplementation(fileDescriptor, className, modelId):
     blockClassName = ("%sRepeatingBlock" % className)
     dataPoints = blockData['points']
 
+    writeDataPointMetadataTable(fileDescriptor, 'repeatingBlockDataPointMetadata', dataPoints)
+
     # Constructor
     writeLine(fileDescriptor, '%s::%s(quint16 blockIndex, quint16 blockSize, quint16 modbusStartRegister, %s *parent) :' % (blockClassName, blockClassName, className))
     writeLine(fileDescriptor, '    SunSpecModelRepeatingBlock(blockIndex, blockSize, modbusStartRegister, parent)')
@@ -955,11 +1104,8 @@ def writeRepeatingBlockClassImplementation(fileDescriptor, className, modelId):
     # Init data points
     writeLine(fileDescriptor, 'void %s::initDataPoints()' % blockClassName)
     writeLine(fileDescriptor, '{')
-    addressOffset = 0
-    for dataPoint in dataPoints:
-        dataSize = addDataPointInitialization(fileDescriptor, dataPoint, addressOffset)
-        addressOffset += dataSize
-
+    writeLine(fileDescriptor, '    m_dataPointMetadata = repeatingBlockDataPointMetadata;')
+    writeLine(fileDescriptor, '    m_dataPointCount = %s;' % len(dataPoints))
     writeLine(fileDescriptor, '}')
     writeLine(fileDescriptor)
 
@@ -1025,6 +1171,7 @@ def writeHeaderFile(headerFileName, className, modelId):
     writeLine(fileDescriptor)
     writeClassEnums(fileDescriptor, className, dataPoints)
     writeClassFlags(fileDescriptor, className, dataPoints)
+    writeDataPointIndexEnum(fileDescriptor, dataPoints)
 
     # Constructor
     writeLine(fileDescriptor, '    explicit %s(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent = nullptr);' % className)
@@ -1091,6 +1238,8 @@ def writeSourceFile(sourceFileName, className, modelId):
     if containingRepeatingBlock:
         writeRepeatingBlockClassImplementation(fileDescriptor, className, modelId)
 
+    writeDataPointMetadataTable(fileDescriptor, 'dataPointMetadata', modelData['group']['points'])
+
     # Constructor
     writeLine(fileDescriptor, '%s::%s(SunSpecConnection *connection, quint16 modbusStartRegister, quint16 modelLength, SunSpecDataPoint::ByteOrder byteOrder, QObject *parent) :' % (className, className))
     writeLine(fileDescriptor, '    SunSpecModel(connection, modbusStartRegister, %s, modelLength, byteOrder, parent)' % modelId)
@@ -1164,11 +1313,8 @@ def writeSourceFile(sourceFileName, className, modelId):
     # Init data points
     writeLine(fileDescriptor, 'void %s::initDataPoints()' % className)
     writeLine(fileDescriptor, '{')
-    addressOffset = 0
-    for dataPoint in dataPoints:
-        dataSize = addDataPointInitialization(fileDescriptor, dataPoint, addressOffset)
-        addressOffset += dataSize
-
+    writeLine(fileDescriptor, '    m_dataPointMetadata = dataPointMetadata;')
+    writeLine(fileDescriptor, '    m_dataPointCount = %s;' % len(dataPoints))
     writeLine(fileDescriptor, '}')
     writeLine(fileDescriptor)
 
@@ -1315,12 +1461,173 @@ def writeModelFactorySource(fileDescriptor):
     writeLine(fileDescriptor, '}')
     writeLine(fileDescriptor)
 
+def getBenchmarkDecoding(modelData):
+    # The scale factors and scaled data points decoded by processBlockData() of the fixed block
+    # and of the first repeating block instance, with the register offset within the model block
+    scaledTypes = ['uint16', 'acc16', 'int16', 'uint32', 'acc32', 'int32']
+    blocks = [(modelData['group']['points'], 0)]
+    if 'groups' in modelData['group']:
+        blocks.append((modelData['group']['groups'][0]['points'], getGroupBlockLength(modelData['group']['points'])))
+
+    scaleFactors = []
+    scaledDataPoints = []
+    parentScaleFactorIndices = {}
+    for dataPoints, blockOffset in blocks:
+        addressOffsets = getDataPointAddressOffsets(dataPoints)
+        scaleFactorIndices = {}
+        for dataPoint in dataPoints:
+            if dataPoint['type'] == 'sunssf':
+                scaleFactorIndices[dataPoint['name']] = len(scaleFactors)
+                scaleFactors.append(blockOffset + addressOffsets[dataPoint['name']])
+
+        for dataPoint in dataPoints:
+            if not 'sf' in dataPoint or not dataPoint['type'] in scaledTypes:
+                continue
+
+            # Literal scale factors and the ones of the parent model are looked up for each value,
+            # the scale factors of the own block use the cached multiplier.
+            if isinstance(dataPoint['sf'], int):
+                scaleFactor = ('literal', dataPoint['sf'])
+            elif dataPoint['sf'] in scaleFactorIndices:
+                scaleFactor = ('cached', scaleFactorIndices[dataPoint['sf']])
+            elif dataPoint['sf'] in parentScaleFactorIndices:
+                scaleFactor = ('lookup', parentScaleFactorIndices[dataPoint['sf']])
+            else:
+                continue
+
+            scaledDataPoints.append((blockOffset + addressOffsets[dataPoint['name']], int(dataPoint['size']), dataPoint, scaleFactor))
+
+        parentScaleFactorIndices = scaleFactorIndices
+
+    return scaleFactors, scaledDataPoints
+
+
+def getBenchmarkBatches(scaledDataPoints):
+    # Adjacent data points of the same type sharing one scale factor
+    batches = []
+    for scaledDataPoint in scaledDataPoints:
+        if len(batches) > 0:
+            addressOffset, size, dataPoint, scaleFactor = batches[-1][-1]
+            if dataPoint['type'] == scaledDataPoint[2]['type'] and scaleFactor == scaledDataPoint[3] and addressOffset + size == scaledDataPoint[0]:
+                batches[-1].append(scaledDataPoint)
+                continue
+
+        batches.append([scaledDataPoint])
+
+    return batches
+
+
+def getBenchmarkMultiplier(scaleFactor):
+    if scaleFactor[0] == 'literal':
+        return 'SunSpecDataPoint::scaleFactorMultiplier(%s)' % scaleFactor[1]
+    elif scaleFactor[0] == 'lookup':
+        return 'SunSpecDataPoint::scaleFactorMultiplier(decoded.scaleFactors[%s])' % scaleFactor[1]
+
+    return 'decoded.multipliers[%s]' % scaleFactor[1]
+
+
+def writeBenchmarkDecodeFunction(fileDescriptor, className, variant, scaleFactors, scaledDataPoints):
+    scaledTypes = { 'uint16': 'UInt16', 'acc16': 'UInt16', 'int16': 'Int16', 'uint32': 'UInt32', 'acc32': 'UInt32', 'int32': 'Int32' }
+
+    writeLine(fileDescriptor, 'static void decode%s%s(const quint16 *registers, int registerCount, SunSpecDataPoint::ByteOrder byteOrder, SunSpecDecodedValues &decoded)' % (className, variant))
+    writeLine(fileDescriptor, '{')
+    for index in range(len(scaleFactors)):
+        addressOffset = scaleFactors[index]
+        line = '    if (registerCount >= %s && SunSpecDataPoint::isValid(registers + %s, 1, SunSpecDataPoint::ScaleFactor, byteOrder))' % (addressOffset + 1, addressOffset)
+        if variant == 'Pow':
+            writeLine(fileDescriptor, line)
+            writeLine(fileDescriptor, '        decoded.scaleFactors[%s] = SunSpecDataPoint::convertToInt16(registers + %s, 1);' % (index, addressOffset))
+        else:
+            writeLine(fileDescriptor, line + ' {')
+            writeLine(fileDescriptor, '        const qint16 scaleFactor = SunSpecDataPoint::convertToInt16(registers + %s, 1);' % addressOffset)
+            writeLine(fileDescriptor, '        if (scaleFactor != decoded.scaleFactors[%s]) {' % index)
+            writeLine(fileDescriptor, '            decoded.scaleFactors[%s] = scaleFactor;' % index)
+            writeLine(fileDescriptor, '            decoded.multipliers[%s] = SunSpecDataPoint::scaleFactorMultiplier(scaleFactor);' % index)
+            writeLine(fileDescriptor, '        }')
+            writeLine(fileDescriptor, '    }')
+
+        writeLine(fileDescriptor)
+
+    if variant == 'Batched':
+        valueIndex = 0
+        for batch in getBenchmarkBatches(scaledDataPoints):
+            addressOffset, size, dataPoint, scaleFactor = batch[0]
+            dataType = getDataTypeName(dataPoint)
+            writeLine(fileDescriptor, '    convertToFloatBatch(registers, registerCount, %s, %s, %s, byteOrder, %s, decoded.values + %s);' % (addressOffset, len(batch), dataType, getBenchmarkMultiplier(scaleFactor), valueIndex))
+            valueIndex += len(batch)
+    else:
+        for valueIndex in range(len(scaledDataPoints)):
+            addressOffset, size, dataPoint, scaleFactor = scaledDataPoints[valueIndex]
+            dataType = getDataTypeName(dataPoint)
+            byteOrder = '' if size == 1 else ', byteOrder'
+            if valueIndex > 0:
+                writeLine(fileDescriptor)
+
+            writeLine(fileDescriptor, '    if (registerCount >= %s && SunSpecDataPoint::isValid(registers + %s, %s, %s, byteOrder))' % (addressOffset + size, addressOffset, size, dataType))
+            if variant == 'Pow':
+                scaleFactorValue = scaleFactor[1] if scaleFactor[0] == 'literal' else 'decoded.scaleFactors[%s]' % scaleFactor[1]
+                writeLine(fileDescriptor, '        decoded.values[%s] = SunSpecDataPoint::convertTo%s(registers + %s, %s%s) * pow(10, %s);' % (valueIndex, scaledTypes[dataPoint['type']], addressOffset, size, byteOrder, scaleFactorValue))
+            else:
+                writeLine(fileDescriptor, '        decoded.values[%s] = SunSpecDataPoint::convertTo%s(registers + %s, %s%s) * %s;' % (valueIndex, scaledTypes[dataPoint['type']], addressOffset, size, byteOrder, getBenchmarkMultiplier(scaleFactor)))
+
+    writeLine(fileDescriptor, '}')
+    writeLine(fileDescriptor)
+
+
+def writeBenchmarkSource(fileDescriptor):
+    # Reproduction of the scaled values in processBlockData() of each model using the SunSpecDataPoint decoding, with
+    # pow() for each value like before, with the cached multipliers like now and in batches of adjacent data points.
+    print('Writing scale factor decoding benchmark source')
+    writeLicenseHeader(fileDescriptor)
+    writeLine(fileDescriptor, '#include "sunspecmodelsbenchmark.h"')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, '#include <math.h>')
+    writeLine(fileDescriptor)
+
+    benchmarkModels = []
+    for className in classes:
+        modelId = classes[className]
+        if useWhiteList and modelId not in modelWhiteList:
+            continue
+
+        modelData = models[modelId]
+        scaleFactors, scaledDataPoints = getBenchmarkDecoding(modelData)
+        if len(scaledDataPoints) == 0:
+            continue
+
+        if len(scaledDataPoints) > 256 or len(scaleFactors) > 64:
+            print('Error: the model %s exceeds the capacity of SunSpecDecodedValues' % className)
+            exit(1)
+
+        blockLength = getGroupBlockLength(modelData['group']['points'])
+        if 'groups' in modelData['group']:
+            blockLength += getGroupBlockLength(modelData['group']['groups'][0]['points'])
+
+        offsetsName = className[0].lower() + className[1:] + 'ScaleFactorOffsets'
+        writeLine(fileDescriptor, '// %s (%s)' % (className, modelId))
+        writeLine(fileDescriptor, 'static const quint16 %s[] = { %s };' % (offsetsName, ', '.join(str(offset) for offset in scaleFactors) if len(scaleFactors) > 0 else '0'))
+        writeLine(fileDescriptor)
+        for variant in ['Pow', 'Cached', 'Batched']:
+            writeBenchmarkDecodeFunction(fileDescriptor, className, variant, scaleFactors, scaledDataPoints)
+
+        benchmarkModels.append('{ %s, "%s", %s, %s, %s, %s, %s, decode%sPow, decode%sCached, decode%sBatched }' % (modelId, className, blockLength, len(scaledDataPoints), len(getBenchmarkBatches(scaledDataPoints)), offsetsName, len(scaleFactors), className, className, className))
+
+    writeLine(fileDescriptor, 'const SunSpecBenchmarkModel sunSpecBenchmarkModels[] = {')
+    for benchmarkModel in benchmarkModels:
+        writeLine(fileDescriptor, '    %s,' % benchmarkModel)
+
+    writeLine(fileDescriptor, '};')
+    writeLine(fileDescriptor)
+    writeLine(fileDescriptor, 'const int sunSpecBenchmarkModelCount = %s;' % len(benchmarkModels))
+
+
 ############################################################################################
 # Main
 ############################################################################################
 
 parser = argparse.ArgumentParser(description='Generate sunspec model classes from specification json definitions.')
 parser.add_argument('-m', '--minimal', action='store_true', help='Generate a minimal set of model classes used in the sunspec plugin. Option to minimize the library size.')
+parser.add_argument('-b', '--benchmark', metavar='<file>', help='Write the scale factor decoding benchmark source of all models to the given file instead of generating the model classes.')
 args = parser.parse_args()
 
 # Paths
@@ -1338,7 +1645,9 @@ if useWhiteList:
 models = {}
 modelHeaderSize = 2
 
-init()
+if not args.benchmark:
+    init()
+
 loadModels()
 
 headerFiles = []
@@ -1361,6 +1670,14 @@ for group in groups.keys():
         className = getClassName(group)
         classes[className] = groups[group][0]
 
+# The benchmark only needs the model definitions, the generated classes stay untouched
+if args.benchmark:
+    print('--> Writing', args.benchmark)
+    benchmarkFile = open(args.benchmark, 'w')
+    writeBenchmarkSource(benchmarkFile)
+    benchmarkFile.close()
+    exit(0)
+
 # Print defined class names for models
 for className in classes.keys():
     print(classes[className], '-->', className)
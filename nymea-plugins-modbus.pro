@@ -4,6 +4,12 @@ TEMPLATE = subdirs
 # dependency on the libs will be defined
 SUBDIRS += nymea-modbus-cli libnymea-modbus libnymea-sunspec
 
+# Tests are not built by default, enable them using: qmake CONFIG+=tests
+tests {
+    SUBDIRS += tests
+    tests.depends = libnymea-modbus libnymea-sunspec
+}
+
 PLUGIN_DIRS = \
     alphainnotec            \
     amperfied               \
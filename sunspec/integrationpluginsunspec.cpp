@@ -60,6 +60,8 @@
 #include "sunspecdiscovery.h"
 #include "solaredgebattery.h"
 
+#include <QTimer>
+#include <QDateTime>
 #include <QHostAddress>
 
 IntegrationPluginSunSpec::IntegrationPluginSunSpec()
@@ -123,6 +125,15 @@ void IntegrationPluginSunSpec::init()
     m_serialNumberParamTypeIds.insert(sunspecSinglePhaseMeterThingClassId, sunspecSinglePhaseMeterThingSerialNumberParamTypeId);
     m_serialNumberParamTypeIds.insert(sunspecSplitPhaseMeterThingClassId, sunspecSplitPhaseMeterThingSerialNumberParamTypeId);
     m_serialNumberParamTypeIds.insert(sunspecThreePhaseMeterThingClassId, sunspecThreePhaseMeterThingSerialNumberParamTypeId);
+
+    m_updateIntervalSettingsParamTypeIds.insert(solarEdgeBatteryThingClassId, solarEdgeBatterySettingsUpdateIntervalParamTypeId);
+    m_updateIntervalSettingsParamTypeIds.insert(sunspecSinglePhaseInverterThingClassId, sunspecSinglePhaseInverterSettingsUpdateIntervalParamTypeId);
+    m_updateIntervalSettingsParamTypeIds.insert(sunspecSplitPhaseInverterThingClassId, sunspecSplitPhaseInverterSettingsUpdateIntervalParamTypeId);
+    m_updateIntervalSettingsParamTypeIds.insert(sunspecThreePhaseInverterThingClassId, sunspecThreePhaseInverterSettingsUpdateIntervalParamTypeId);
+    m_updateIntervalSettingsParamTypeIds.insert(sunspecStorageThingClassId, sunspecStorageSettingsUpdateIntervalParamTypeId);
+    m_updateIntervalSettingsParamTypeIds.insert(sunspecSinglePhaseMeterThingClassId, sunspecSinglePhaseMeterSettingsUpdateIntervalParamTypeId);
+    m_updateIntervalSettingsParamTypeIds.insert(sunspecSplitPhaseMeterThingClassId, sunspecSplitPhaseMeterSettingsUpdateIntervalParamTypeId);
+    m_updateIntervalSettingsParamTypeIds.insert(sunspecThreePhaseMeterThingClassId, sunspecThreePhaseMeterSettingsUpdateIntervalParamTypeId);
 }
 
 void IntegrationPluginSunSpec::discoverThings(ThingDiscoveryInfo *info)
@@ -408,6 +419,10 @@ void IntegrationPluginSunSpec::thingRemoved(Thing *thing)
 
     if (m_sunSpecConnections.contains(thing->id())) {
         m_sunSpecConnections.take(thing->id())->deleteLater();
+
+        pluginStorage()->beginGroup(thing->id().toString());
+        pluginStorage()->remove("");
+        pluginStorage()->endGroup();
     } else if (m_sunSpecThings.contains(thing)) {
         m_sunSpecThings.take(thing)->deleteLater();
     } else if (m_sunSpecInverters.contains(thing)) {
@@ -424,6 +439,9 @@ void IntegrationPluginSunSpec::thingRemoved(Thing *thing)
         hardwareManager()->networkDeviceDiscovery()->unregisterMonitor(m_monitors.take(thing));
     }
 
+    m_lastRefreshTimestamps.remove(thing);
+    m_refreshOverrunCounters.remove(thing);
+
     if (myThings().isEmpty()) {
         qCDebug(dcSunSpec()) << "Stopping refresh timer";
         hardwareManager()->pluginTimerManager()->unregisterTimer(m_refreshTimer);
@@ -686,6 +704,12 @@ SunSpecConnection *IntegrationPluginSunSpec::createConnection(Thing *thing)
     }
     connection->setTimeout(configValue(sunSpecPluginTimeoutParamTypeId).toUInt());
     connection->setNumberOfRetries(configValue(sunSpecPluginNumberOfRetriesParamTypeId).toUInt());
+    connection->setSweepEnabled(configValue(sunSpecPluginSweepReadsParamTypeId).toBool());
+
+    // Restore the model map of the last discovery, it gets verified on connect
+    pluginStorage()->beginGroup(thing->id().toString());
+    connection->setCachedModelMap(pluginStorage()->value("modelMap").toMap());
+    pluginStorage()->endGroup();
 
     // Reconnect on monitor reachable changed
     NetworkDeviceMonitor *monitor = m_monitors.value(thing);
@@ -732,6 +756,10 @@ SunSpecConnection *IntegrationPluginSunSpec::createConnection(Thing *thing)
     connect(connection, &SunSpecConnection::discoveryFinished, thing, [this, connection, thing] (bool success) {
         if (success) {
             qCDebug(dcSunSpec()) << "Discovery finished successfully of" << connection;
+            pluginStorage()->beginGroup(thing->id().toString());
+            pluginStorage()->setValue("modelMap", connection->modelMap());
+            pluginStorage()->endGroup();
+
             processDiscoveryResult(thing, connection);
         } else {
             qCWarning(dcSunSpec()) << "Discovery finished with errors on" << connection;
@@ -1134,34 +1162,127 @@ void IntegrationPluginSunSpec::markThingStatesDisconnected(Thing *thing)
 
 }
 
-void IntegrationPluginSunSpec::onRefreshTimer()
+bool IntegrationPluginSunSpec::refreshDue(Thing *thing, qint64 currentTimestamp, int refreshPeriod) const
 {
-    // Update meters
-    foreach (SunSpecModel *model, m_sunSpecMeters.values()) {
-        if (model->connection()->connected()) {
-            model->readBlockData();
+    if (!m_lastRefreshTimestamps.contains(thing))
+        return true;
+
+    // Things without an own update interval follow the plugin update interval
+    const qint64 updateInterval = thing->setting(m_updateIntervalSettingsParamTypeIds.value(thing->thingClassId())).toUInt() * 1000;
+    if (updateInterval <= refreshPeriod)
+        return true;
+
+    // Allow half a refresh period of timer jitter
+    return currentTimestamp - m_lastRefreshTimestamps.value(thing) >= updateInterval - refreshPeriod / 2;
+}
+
+void IntegrationPluginSunSpec::refreshThings(SunSpecConnection *connection, const QList<Thing *> &things, qint64 refreshTimestamp)
+{
+    if (!connection->connected())
+        return;
+
+    // Skip things still waiting for the replies of the last read, slow devices would pile up requests otherwise
+    QList<SunSpecModel *> models;
+    foreach (Thing *thing, things) {
+        SunSpecModel *model = nullptr;
+        if (m_sunSpecInverters.contains(thing)) {
+            model = m_sunSpecInverters.value(thing);
+        } else if (m_sunSpecMeters.contains(thing)) {
+            model = m_sunSpecMeters.value(thing);
+        } else if (m_sunSpecStorages.contains(thing)) {
+            model = m_sunSpecStorages.value(thing);
+        }
+
+        if (model) {
+            if (model->readPending() || (connection->sweepEnabled() && connection->sweepPending())) {
+                reportRefreshOverrun(thing);
+                continue;
+            }
+
+            models.append(model);
+        } else if (m_sunSpecThings.contains(thing)) {
+            SunSpecThing *sunSpecThing = m_sunSpecThings.value(thing);
+            if (sunSpecThing->readPending()) {
+                reportRefreshOverrun(thing);
+                continue;
+            }
+
+            sunSpecThing->readBlockData();
+        } else {
+            // The thing has been removed in the meantime
+            continue;
         }
+
+        m_lastRefreshTimestamps[thing] = refreshTimestamp;
     }
 
-    // Update storage
-    foreach (SunSpecModel *model, m_sunSpecStorages.values()) {
-        if (model->connection()->connected()) {
+    if (models.isEmpty())
+        return;
+
+    if (connection->sweepEnabled()) {
+        connection->sweepModels(models);
+    } else {
+        foreach (SunSpecModel *model, models) {
             model->readBlockData();
         }
     }
+}
 
-    // Update all other sunspec thing blocks
-    foreach (SunSpecThing *sunSpecThing, m_sunSpecThings) {
-        if (sunSpecThing->connection()->connected()) {
-            sunSpecThing->readBlockData();
+void IntegrationPluginSunSpec::reportRefreshOverrun(Thing *thing)
+{
+    uint overrunCount = ++m_refreshOverrunCounters[thing];
+    if (overrunCount == 1 || overrunCount % 100 == 0) {
+        qCWarning(dcSunSpec()) << "The last read of" << thing->name() << "did not finish within its refresh slot. Skipped" << overrunCount << "refreshes so far.";
+    } else {
+        qCDebug(dcSunSpec()) << "The last read of" << thing->name() << "did not finish within its refresh slot. Skipped" << overrunCount << "refreshes so far.";
+    }
+}
+
+void IntegrationPluginSunSpec::onRefreshTimer()
+{
+    const int refreshPeriod = configValue(sunSpecPluginUpdateIntervalParamTypeId).toInt() * 1000;
+    const qint64 currentTimestamp = QDateTime::currentMSecsSinceEpoch();
+
+    // Collect the things due for a refresh for each connection
+    QHash<SunSpecConnection *, QList<Thing *>> connectionThings;
+    foreach (Thing *thing, m_sunSpecMeters.keys() + m_sunSpecStorages.keys() + m_sunSpecInverters.keys() + m_sunSpecThings.keys()) {
+        SunSpecConnection *connection = m_sunSpecConnections.value(thing->parentId());
+        if (!connection || !connection->connected())
+            continue;
+
+        if (refreshDue(thing, currentTimestamp, refreshPeriod)) {
+            connectionThings[connection].append(thing);
         }
     }
 
-    // Update inverters
-    foreach (SunSpecModel *model, m_sunSpecInverters.values()) {
-        if (model->connection()->connected()) {
-            model->readBlockData();
+    // Spread the reads of each connection across the refresh period instead of sending all requests
+    // on the same tick. Models read using one sweep share a slot. Each connection gets a different
+    // phase within its first slot, so the traffic of all connections does not start at the same instant.
+    int connectionIndex = 0;
+    foreach (SunSpecConnection *connection, connectionThings.keys()) {
+        QList<QList<Thing *>> readGroups;
+        QList<Thing *> sweepThings;
+        foreach (Thing *thing, connectionThings.value(connection)) {
+            if (connection->sweepEnabled() && !m_sunSpecThings.contains(thing)) {
+                sweepThings.append(thing);
+            } else {
+                readGroups.append(QList<Thing *>() << thing);
+            }
+        }
+
+        if (!sweepThings.isEmpty())
+            readGroups.prepend(sweepThings);
+
+        const int slotInterval = refreshPeriod / readGroups.count();
+        const int phase = slotInterval * connectionIndex / connectionThings.count();
+        for (int i = 0; i < readGroups.count(); i++) {
+            const QList<Thing *> things = readGroups.at(i);
+            QTimer::singleShot(phase + i * slotInterval, connection, [this, connection, things, currentTimestamp](){
+                refreshThings(connection, things, currentTimestamp);
+            });
         }
+
+        connectionIndex++;
     }
 }
 
@@ -1188,6 +1309,11 @@ void IntegrationPluginSunSpec::onPluginConfigurationChanged(const ParamTypeId &p
         foreach (SunSpecConnection *connection, m_sunSpecConnections) {
             connection->setTimeout(value.toUInt());
         }
+    } else if (paramTypeId == sunSpecPluginSweepReadsParamTypeId) {
+        qCDebug(dcSunSpec()) << "Updating combined model reads" << value.toBool();
+        foreach (SunSpecConnection *connection, m_sunSpecConnections) {
+            connection->setSweepEnabled(value.toBool());
+        }
     } else {
         qCWarning(dcSunSpec()) << "Unknown plugin configuration" << paramTypeId << "Value" << value;
     }
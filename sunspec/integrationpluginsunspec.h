@@ -73,9 +73,14 @@ private:
     QHash<ThingClassId, ParamTypeId> m_manufacturerParamTypeIds;
     QHash<ThingClassId, ParamTypeId> m_deviceModelParamTypeIds;
     QHash<ThingClassId, ParamTypeId> m_serialNumberParamTypeIds;
+    QHash<ThingClassId, ParamTypeId> m_updateIntervalSettingsParamTypeIds;
 
     PluginTimer *m_refreshTimer = nullptr;
 
+    // Refresh scheduling, timestamps of the refresh tick a thing has been read in last
+    QHash<Thing *, qint64> m_lastRefreshTimestamps;
+    QHash<Thing *, uint> m_refreshOverrunCounters;
+
     QHash<Thing *, NetworkDeviceMonitor *> m_monitors;
 
     QHash<ThingId, SunSpecConnection *> m_sunSpecConnections;
@@ -112,6 +117,10 @@ private:
     bool hasManufacturer(const QStringList &manufacturers, const QString &manufacturer);
     void markThingStatesDisconnected(Thing *thing);
 
+    bool refreshDue(Thing *thing, qint64 currentTimestamp, int refreshPeriod) const;
+    void refreshThings(SunSpecConnection *connection, const QList<Thing *> &things, qint64 refreshTimestamp);
+    void reportRefreshOverrun(Thing *thing);
+
 private slots:
     void onRefreshTimer();
     void onPluginConfigurationChanged(const ParamTypeId &paramTypeId, const QVariant &value);
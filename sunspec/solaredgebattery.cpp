@@ -82,7 +82,9 @@ void SolarEdgeBattery::readBlockData()
     QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister, 0x4C);
     if (QModbusReply *reply = m_connection->modbusTcpClient()->sendReadRequest(request, m_connection->slaveId())) {
         if (!reply->isFinished()) {
+            m_pendingReplyCount++;
             connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);
+            connect(reply, &QModbusReply::finished, this, [this]() { m_pendingReplyCount--; });
             connect(reply, &QModbusReply::finished, this, [=]() {
                 if (reply->error() != QModbusDevice::NoError) {
                     qCWarning(dcSunSpec()) << "SolarEdgeBattery: Read response error:" << reply->error();
@@ -153,7 +155,9 @@ void SolarEdgeBattery::readBlockData()
                 QModbusDataUnit request = QModbusDataUnit(QModbusDataUnit::RegisterType::HoldingRegisters, m_modbusStartRegister + offset, 28);
                 if (QModbusReply *reply = m_connection->modbusTcpClient()->sendReadRequest(request, m_connection->slaveId())) {
                     if (!reply->isFinished()) {
+                        m_pendingReplyCount++;
                         connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);
+                        connect(reply, &QModbusReply::finished, this, [this]() { m_pendingReplyCount--; });
                         connect(reply, &QModbusReply::finished, this, [=]() {
                             if (reply->error() != QModbusDevice::NoError) {
                                 qCWarning(dcSunSpec()) << "SolarEdgeBattery: Read response error:" << reply->error();
@@ -234,6 +238,11 @@ void SolarEdgeBattery::readBlockData()
     }
 }
 
+bool SolarEdgeBattery::readPending() const
+{
+    return m_pendingReplyCount > 0;
+}
+
 QDebug operator<<(QDebug debug, const SolarEdgeBattery::BatteryData &batteryData)
 {
     debug << "SolarEdgeBatteryData(" << batteryData.manufacturerName << "-" << batteryData.model << ")" << endl;
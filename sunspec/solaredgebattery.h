@@ -118,6 +118,7 @@ public:
 
     void init();
     void readBlockData() override;
+    bool readPending() const override;
 
 signals:
     void initFinished(bool success);
@@ -128,6 +129,7 @@ private:
     SunSpecConnection *m_connection = nullptr;
     int m_modbusStartRegister;
     bool m_initFinishedSuccess = false;
+    int m_pendingReplyCount = 0;
     BatteryData m_batteryData;
 
 };
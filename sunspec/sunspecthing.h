@@ -55,6 +55,9 @@ public:
 
     virtual void readBlockData() = 0;
 
+    // True as long as replies of the last block data read are outstanding
+    virtual bool readPending() const = 0;
+
     virtual void executeAction(ThingActionInfo *info);
 
 protected:
@@ -0,0 +1,16 @@
+include(../../../modbus.pri)
+
+TARGET = tst_modbusreachabilitymonitor
+
+QT += testlib
+QT -= gui
+
+CONFIG += c++11 console testcase
+CONFIG -= app_bundle
+
+QMAKE_CXXFLAGS *= -Werror -std=c++11
+QMAKE_LFLAGS *= -std=c++11
+QMAKE_RPATHDIR += $$top_builddir/libnymea-modbus
+
+SOURCES += \
+    tst_modbusreachabilitymonitor.cpp
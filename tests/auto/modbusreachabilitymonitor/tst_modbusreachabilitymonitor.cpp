@@ -0,0 +1,139 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <QtTest>
+
+#include "modbusreachabilitymonitor.h"
+
+class TestModbusReachabilityMonitor : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void consecutiveErrors();
+    void consecutiveErrorsAfterRecovery();
+    void errorWindow();
+    void errorWindowAfterRecovery();
+    void probeIdleTime();
+
+private:
+    void addErrors(ModbusReachabilityMonitor &monitor, int count);
+};
+
+void TestModbusReachabilityMonitor::consecutiveErrors()
+{
+    ModbusReachabilityMonitor monitor(10, 10);
+    QVERIFY(monitor.addReply(true));
+    QVERIFY(monitor.communicationWorking());
+
+    addErrors(monitor, 9);
+    QVERIFY(monitor.communicationWorking());
+
+    QVERIFY(monitor.addReply(false));
+    QVERIFY(!monitor.communicationWorking());
+}
+
+void TestModbusReachabilityMonitor::consecutiveErrorsAfterRecovery()
+{
+    ModbusReachabilityMonitor monitor(10, 10);
+    monitor.addReply(true);
+    addErrors(monitor, 10);
+    QVERIFY(!monitor.communicationWorking());
+
+    // A single successful reply recovers the communication
+    QVERIFY(monitor.addReply(true));
+    QVERIFY(monitor.communicationWorking());
+    QCOMPARE(monitor.errorCount(), 0);
+
+    // ...and the full limit of errors is required again to lose it
+    addErrors(monitor, 9);
+    QVERIFY(monitor.communicationWorking());
+
+    QVERIFY(monitor.addReply(false));
+    QVERIFY(!monitor.communicationWorking());
+}
+
+void TestModbusReachabilityMonitor::errorWindow()
+{
+    ModbusReachabilityMonitor monitor(5, 20);
+    monitor.addReply(true);
+
+    // Every second reply fails, 5 errors within the last 20 replies
+    for (int i = 0; i < 4; i++) {
+        QVERIFY(!monitor.addReply(false));
+        QVERIFY(!monitor.addReply(true));
+    }
+    QVERIFY(monitor.communicationWorking());
+
+    QVERIFY(monitor.addReply(false));
+    QVERIFY(!monitor.communicationWorking());
+}
+
+void TestModbusReachabilityMonitor::errorWindowAfterRecovery()
+{
+    ModbusReachabilityMonitor monitor(5, 20);
+    monitor.addReply(true);
+    addErrors(monitor, 5);
+    QVERIFY(!monitor.communicationWorking());
+
+    QVERIFY(monitor.addReply(true));
+
+    // The errors before the recovery are still within the window but must not count again
+    addErrors(monitor, 4);
+    QVERIFY(monitor.communicationWorking());
+
+    QVERIFY(monitor.addReply(false));
+    QVERIFY(!monitor.communicationWorking());
+}
+
+void TestModbusReachabilityMonitor::probeIdleTime()
+{
+    // Without a probe idle time every update may probe, even right after a reply
+    ModbusReachabilityMonitor monitor(10, 10);
+    QVERIFY(monitor.idle());
+    monitor.addReply(false);
+    QVERIFY(monitor.idle());
+
+    monitor.setProbeIdleTime(60000);
+    QVERIFY(!monitor.idle());
+
+    monitor.reset();
+    QVERIFY(monitor.idle());
+}
+
+void TestModbusReachabilityMonitor::addErrors(ModbusReachabilityMonitor &monitor, int count)
+{
+    for (int i = 0; i < count; i++) {
+        monitor.addReply(false);
+    }
+}
+
+QTEST_GUILESS_MAIN(TestModbusReachabilityMonitor)
+#include "tst_modbusreachabilitymonitor.moc"
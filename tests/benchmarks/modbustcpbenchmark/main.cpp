@@ -0,0 +1,319 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Benchmark of the ModbusTcpMaster and the generated connection classes against modbus-test-server.py.
+//
+// Each round reads the registers of all units once, either as plain read requests on the
+// ModbusTcpMaster or by calling update() on one generated connection per unit. The round
+// latency percentiles and the CPU time of this process (the server runs in its own process)
+// per round are printed for both.
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QCommandLineOption>
+#include <QLoggingCategory>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QProcess>
+#include <QTimer>
+#include <QDebug>
+
+#include <ctime>
+#include <algorithm>
+
+#include "modbustcpmaster.h"
+#include "testmodbustcpconnection.h"
+
+class BenchmarkResult
+{
+public:
+    QVector<qint64> latencies; // ns
+    qint64 duration = 0; // ns
+    clock_t cpuTime = 0;
+    ModbusStatistics statistics;
+};
+
+// Runs the event loop until quit() is called, returns false if the timeout in ms expires first
+bool runEventLoop(QEventLoop &eventLoop, int timeout)
+{
+    QTimer timer;
+    timer.setSingleShot(true);
+    QObject::connect(&timer, &QTimer::timeout, &eventLoop, [&eventLoop](){ eventLoop.exit(1); });
+    timer.start(timeout);
+    return eventLoop.exec() == 0;
+}
+
+bool benchmarkModbusTcpMaster(ModbusTcpMaster *modbusTcpMaster, const QList<quint16> &unitIds, int rounds, int timeout, BenchmarkResult &result)
+{
+    // The same registers the generated connection reads on update()
+    QList<QModbusDataUnit> units;
+    units.append(QModbusDataUnit(QModbusDataUnit::HoldingRegisters, 1, 3));
+    units.append(QModbusDataUnit(QModbusDataUnit::HoldingRegisters, 200, 4));
+
+    QEventLoop eventLoop;
+    int pendingReplies = 0;
+
+    modbusTcpMaster->resetStatistics();
+    QElapsedTimer durationTimer;
+    durationTimer.start();
+    clock_t cpuStart = std::clock();
+    for (int i = 0; i < rounds; i++) {
+        QElapsedTimer timer;
+        timer.start();
+        foreach (quint16 unitId, unitIds) {
+            foreach (const QModbusDataUnit &unit, units) {
+                QModbusReply *reply = modbusTcpMaster->sendReadRequest(unit, unitId);
+                if (!reply)
+                    return false;
+
+                pendingReplies++;
+                QObject::connect(reply, &QModbusReply::finished, reply, &QModbusReply::deleteLater);
+                QObject::connect(reply, &QModbusReply::finished, &eventLoop, [&eventLoop, &pendingReplies](){
+                    pendingReplies--;
+                    if (pendingReplies == 0) {
+                        eventLoop.quit();
+                    }
+                });
+            }
+        }
+
+        if (!runEventLoop(eventLoop, timeout))
+            return false;
+
+        result.latencies.append(timer.nsecsElapsed());
+    }
+
+    result.cpuTime = std::clock() - cpuStart;
+    result.duration = durationTimer.nsecsElapsed();
+    result.statistics = modbusTcpMaster->statistics();
+    return true;
+}
+
+bool benchmarkConnections(ModbusTcpMaster *modbusTcpMaster, const QList<TestModbusTcpConnection *> &connections, int rounds, int timeout, BenchmarkResult &result)
+{
+    QEventLoop eventLoop;
+    int pendingUpdates = 0;
+    foreach (TestModbusTcpConnection *connection, connections) {
+        QObject::connect(connection, &TestModbusTcpConnection::updateFinished, &eventLoop, [&eventLoop, &pendingUpdates](){
+            pendingUpdates--;
+            if (pendingUpdates == 0) {
+                eventLoop.quit();
+            }
+        });
+    }
+
+    modbusTcpMaster->resetStatistics();
+    QElapsedTimer durationTimer;
+    durationTimer.start();
+    clock_t cpuStart = std::clock();
+    for (int i = 0; i < rounds; i++) {
+        QElapsedTimer timer;
+        timer.start();
+        pendingUpdates = connections.count();
+        foreach (TestModbusTcpConnection *connection, connections) {
+            if (!connection->update()) {
+                return false;
+            }
+        }
+
+        if (!runEventLoop(eventLoop, timeout))
+            return false;
+
+        result.latencies.append(timer.nsecsElapsed());
+    }
+
+    result.cpuTime = std::clock() - cpuStart;
+    result.duration = durationTimer.nsecsElapsed();
+    result.statistics = modbusTcpMaster->statistics();
+    return true;
+}
+
+double percentile(const QVector<qint64> &sortedLatencies, double percentile)
+{
+    int index = qBound(0, static_cast<int>(percentile / 100.0 * sortedLatencies.count() + 0.5) - 1, sortedLatencies.count() - 1);
+    return sortedLatencies.at(index) / 1000000.0;
+}
+
+void printResult(const QString &name, BenchmarkResult result)
+{
+    std::sort(result.latencies.begin(), result.latencies.end());
+    int rounds = result.latencies.count();
+    double seconds = result.duration / 1000000000.0;
+    double cpuTimePerRound = static_cast<double>(result.cpuTime) / CLOCKS_PER_SEC / rounds * 1000000.0;
+
+    qInfo().noquote() << name;
+    qInfo().noquote() << QString("    rounds: %1, requests: %2, %3 requests/s, exceptions: %4, timeouts: %5, errors: %6")
+                         .arg(rounds)
+                         .arg(result.statistics.requestCount())
+                         .arg(result.statistics.requestCount() / seconds, 0, 'f', 1)
+                         .arg(result.statistics.exceptionCount())
+                         .arg(result.statistics.timeoutCount())
+                         .arg(result.statistics.errorCount());
+    qInfo().noquote() << QString("    round latency [ms]: p50 %1, p90 %2, p99 %3, max %4")
+                         .arg(percentile(result.latencies, 50), 0, 'f', 3)
+                         .arg(percentile(result.latencies, 90), 0, 'f', 3)
+                         .arg(percentile(result.latencies, 99), 0, 'f', 3)
+                         .arg(result.latencies.last() / 1000000.0, 0, 'f', 3);
+    qInfo().noquote() << QString("    CPU time per round: %1 us").arg(cpuTimePerRound, 0, 'f', 1);
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication application(argc, argv);
+    application.setApplicationName("modbustcpbenchmark");
+    application.setOrganizationName("nymea");
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    parser.setApplicationDescription(QString("\nBenchmark of the ModbusTcpMaster and the generated connection classes against modbus-test-server.py.\n"));
+
+    QCommandLineOption addressOption(QStringList() << "a" << "address", QString("The address of the test server. Default is 127.0.0.1."), "address");
+    addressOption.setDefaultValue("127.0.0.1");
+    parser.addOption(addressOption);
+
+    QCommandLineOption portOption(QStringList() << "p" << "port", QString("The port of the test server. Default is 5020."), "port");
+    portOption.setDefaultValue("5020");
+    parser.addOption(portOption);
+
+    QCommandLineOption unitsOption(QStringList() << "u" << "units", QString("The number of units read in each round, one connection per unit. Default is 1."), "count");
+    unitsOption.setDefaultValue("1");
+    parser.addOption(unitsOption);
+
+    QCommandLineOption roundsOption(QStringList() << "r" << "rounds", QString("The number of measured rounds. Default is 1000."), "count");
+    roundsOption.setDefaultValue("1000");
+    parser.addOption(roundsOption);
+
+    QCommandLineOption latencyOption(QStringList() << "l" << "latency", QString("Latency in ms the started test server adds to each response. Default is 0."), "ms");
+    latencyOption.setDefaultValue("0");
+    parser.addOption(latencyOption);
+
+    QCommandLineOption jitterOption(QStringList() << "jitter", QString("Jitter in ms the started test server adds to the latency. Default is 0."), "ms");
+    jitterOption.setDefaultValue("0");
+    parser.addOption(jitterOption);
+
+    QCommandLineOption exceptionRateOption(QStringList() << "exception-rate", QString("Probability between 0 and 1 the started test server answers with an exception. Default is 0."), "rate");
+    exceptionRateOption.setDefaultValue("0");
+    parser.addOption(exceptionRateOption);
+
+    QCommandLineOption externalServerOption(QStringList() << "external-server", QString("Do not start modbus-test-server.py, use the one already running on the given address and port."));
+    parser.addOption(externalServerOption);
+
+    parser.process(application);
+
+    QHostAddress hostAddress(parser.value(addressOption));
+    uint port = parser.value(portOption).toUInt();
+    int unitCount = qMax(1, parser.value(unitsOption).toInt());
+    int rounds = qMax(1, parser.value(roundsOption).toInt());
+
+    // Only the results are of interest, debug output would be measured as well
+    QLoggingCategory::setFilterRules("*.debug=false");
+
+    QProcess server;
+    server.setProcessChannelMode(QProcess::MergedChannels);
+    if (!parser.isSet(externalServerOption)) {
+        QStringList arguments;
+        arguments << MODBUS_TEST_SERVER << "-j" << MODBUS_TEST_REGISTERS;
+        arguments << "-a" << hostAddress.toString() << "-p" << QString::number(port);
+        arguments << "-u" << QString("1-%1").arg(unitCount) << "-s" << "0";
+        arguments << "-l" << parser.value(latencyOption) << "--jitter" << parser.value(jitterOption);
+        arguments << "--exception-rate" << parser.value(exceptionRateOption);
+
+        QEventLoop eventLoop;
+        QObject::connect(&server, &QProcess::readyRead, &eventLoop, [&server, &eventLoop](){
+            if (server.readAll().contains("Serving")) {
+                eventLoop.quit();
+            }
+        });
+        QObject::connect(&server, static_cast<void (QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished), &eventLoop, [&eventLoop](){
+            eventLoop.exit(1);
+        });
+
+        server.start("python3", arguments);
+        if (!runEventLoop(eventLoop, 10000)) {
+            qWarning() << "Could not start the test server" << MODBUS_TEST_SERVER << server.errorString();
+            return 1;
+        }
+    }
+
+    ModbusTcpMaster modbusTcpMaster(hostAddress, port);
+    modbusTcpMaster.setStatisticsLogInterval(0);
+
+    QList<quint16> unitIds;
+    QList<TestModbusTcpConnection *> connections;
+    for (int i = 1; i <= unitCount; i++) {
+        unitIds.append(i);
+        connections.append(new TestModbusTcpConnection(&modbusTcpMaster, i, &modbusTcpMaster));
+    }
+
+    QEventLoop eventLoop;
+    QObject::connect(&modbusTcpMaster, &ModbusTcpMaster::connectionStateChanged, &eventLoop, [&eventLoop](bool connected){
+        if (connected) {
+            eventLoop.quit();
+        }
+    });
+    if (!modbusTcpMaster.connectDevice() || !runEventLoop(eventLoop, 10000)) {
+        qWarning() << "Could not connect to the test server on" << hostAddress.toString() << port;
+        return 1;
+    }
+
+    // A round fails if it takes longer than all retries of ten requests in a row
+    int timeout = 10 * modbusTcpMaster.timeout() * (modbusTcpMaster.numberOfRetries() + 1);
+
+    // Let the reachability checks and the request window detection settle before measuring
+    BenchmarkResult warmup;
+    if (!benchmarkConnections(&modbusTcpMaster, connections, 10, timeout, warmup)) {
+        qWarning() << "The warm up rounds failed";
+        return 1;
+    }
+
+    qInfo().noquote() << QString("Reading %1 unit(s) on %2:%3 in %4 rounds").arg(unitCount).arg(hostAddress.toString()).arg(port).arg(rounds);
+
+    BenchmarkResult modbusTcpMasterResult;
+    if (!benchmarkModbusTcpMaster(&modbusTcpMaster, unitIds, rounds, timeout, modbusTcpMasterResult)) {
+        qWarning() << "The ModbusTcpMaster benchmark failed";
+        return 1;
+    }
+    printResult("ModbusTcpMaster read requests", modbusTcpMasterResult);
+
+    BenchmarkResult connectionsResult;
+    if (!benchmarkConnections(&modbusTcpMaster, connections, rounds, timeout, connectionsResult)) {
+        qWarning() << "The connection benchmark failed";
+        return 1;
+    }
+    printResult("TestModbusTcpConnection full updates", connectionsResult);
+
+    modbusTcpMaster.disconnectDevice();
+    if (server.state() != QProcess::NotRunning) {
+        server.terminate();
+        server.waitForFinished();
+    }
+
+    return 0;
+}
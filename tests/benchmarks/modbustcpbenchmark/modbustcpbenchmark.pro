@@ -0,0 +1,28 @@
+# Generate the connection classes of the generator test registers
+MODBUS_CONNECTIONS += ../../../libnymea-modbus/tools/test-registers.json
+
+include(../../../modbus.pri)
+
+TARGET = modbustcpbenchmark
+
+QT -= gui
+
+CONFIG += c++11 console link_pkgconfig
+CONFIG -= app_bundle
+PKGCONFIG += nymea
+
+QMAKE_CXXFLAGS *= -Werror -std=c++11
+QMAKE_LFLAGS *= -std=c++11
+QMAKE_RPATHDIR += $$top_builddir/libnymea-modbus
+
+gcc {
+    COMPILER_VERSION = $$system($$QMAKE_CXX " -dumpversion")
+    COMPILER_MAJOR_VERSION = $$str_member($$COMPILER_VERSION)
+    greaterThan(COMPILER_MAJOR_VERSION, 7): QMAKE_CXXFLAGS += -Wno-deprecated-copy
+}
+
+DEFINES += MODBUS_TEST_SERVER=\\\"$$top_srcdir/libnymea-modbus/tools/modbus-test-server.py\\\"
+DEFINES += MODBUS_TEST_REGISTERS=\\\"$$top_srcdir/libnymea-modbus/tools/test-registers.json\\\"
+
+SOURCES += \
+    main.cpp
@@ -0,0 +1,119 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Benchmark of the scaled values decoded in processBlockData() of the SunSpec models.
+//
+// The decode functions are written by generate-models.py --benchmark for every model containing
+// scaled data points and use the SunSpecDataPoint decoding of the library. Each model block gets decoded with pow() for every value (the models before
+// caching the multipliers), with the cached multipliers (the current models) and in batches of
+// adjacent data points sharing a scale factor. All variants must decode the same values.
+
+#include "sunspecmodelsbenchmark.h"
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+double benchmark(SunSpecDecodeFunction decode, const std::vector<quint16> &registers, int iterations, SunSpecDecodedValues &decoded)
+{
+    decoded.reset();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        decode(registers.data(), static_cast<int>(registers.size()), SunSpecDataPoint::ByteOrderBigEndian, decoded);
+
+    std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+    return duration.count() / iterations;
+}
+
+int main(int argc, char *argv[])
+{
+    int iterations = argc > 1 ? atoi(argv[1]) : 100000;
+    if (iterations <= 0) {
+        fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    // Random register values, the scale factors are in the range typically used by devices
+    std::mt19937 generator(4711);
+    std::uniform_int_distribution<int> registerDistribution(0, 0xFFFF);
+    std::uniform_int_distribution<int> scaleFactorDistribution(-3, 2);
+
+    printf("%-45s %6s %7s %10s %11s %12s\n", "Model", "Values", "Batches", "pow [ns]", "cached [ns]", "batched [ns]");
+
+    double totalPow = 0;
+    double totalCached = 0;
+    double totalBatched = 0;
+    int totalValues = 0;
+    int mismatches = 0;
+    for (int i = 0; i < sunSpecBenchmarkModelCount; i++) {
+        const SunSpecBenchmarkModel &model = sunSpecBenchmarkModels[i];
+
+        std::vector<quint16> registers(model.blockLength);
+        for (size_t r = 0; r < registers.size(); r++)
+            registers[r] = static_cast<quint16>(registerDistribution(generator));
+
+        for (int s = 0; s < model.scaleFactorCount; s++)
+            registers[model.scaleFactorOffsets[s]] = static_cast<quint16>(scaleFactorDistribution(generator));
+
+        SunSpecDecodedValues powDecoded;
+        SunSpecDecodedValues cachedDecoded;
+        SunSpecDecodedValues batchedDecoded;
+        double pow = benchmark(model.decodePow, registers, iterations, powDecoded);
+        double cached = benchmark(model.decodeCached, registers, iterations, cachedDecoded);
+        double batched = benchmark(model.decodeBatched, registers, iterations, batchedDecoded);
+
+        const size_t valuesSize = model.valueCount * sizeof(float);
+        bool match = memcmp(powDecoded.values, cachedDecoded.values, valuesSize) == 0 && memcmp(powDecoded.values, batchedDecoded.values, valuesSize) == 0;
+        if (!match)
+            mismatches++;
+
+        printf("%-45s %6d %7d %10.1f %11.1f %12.1f%s\n", model.className, model.valueCount, model.batchCount, pow, cached, batched, match ? "" : " MISMATCH");
+
+        totalPow += pow;
+        totalCached += cached;
+        totalBatched += batched;
+        totalValues += model.valueCount;
+    }
+
+    printf("\n%d models, %d scaled values, decoding each model block once:\n", sunSpecBenchmarkModelCount, totalValues);
+    printf("    pow:     %10.1f ns\n", totalPow);
+    printf("    cached:  %10.1f ns (%.2fx)\n", totalCached, totalPow / totalCached);
+    printf("    batched: %10.1f ns (%.2fx)\n", totalBatched, totalPow / totalBatched);
+
+    if (mismatches > 0) {
+        printf("%d models decoded different values\n", mismatches);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "sunspecmodelsbenchmark.h"
+
+#include <algorithm>
+
+void convertToFloatBatch(const quint16 *registers, int registerCount, int offset, int count, SunSpecDataPoint::DataType dataType, SunSpecDataPoint::ByteOrder byteOrder, double multiplier, float *values)
+{
+    // The loops select instead of branching, so the compiler is able to vectorize them
+    const bool wide = dataType == SunSpecDataPoint::Int32 || dataType == SunSpecDataPoint::UInt32 || dataType == SunSpecDataPoint::Acc32;
+    count = std::min(count, (registerCount - offset) / (wide ? 2 : 1));
+    registers += offset;
+
+    // Register index of the high and low word of 32 bit values
+    const int high = byteOrder == SunSpecDataPoint::ByteOrderBigEndian ? 0 : 1;
+    const int low = 1 - high;
+
+    switch (dataType) {
+    case SunSpecDataPoint::UInt16:
+        for (int i = 0; i < count; i++)
+            values[i] = registers[i] != 0xFFFF ? static_cast<float>(registers[i] * multiplier) : values[i];
+        break;
+    case SunSpecDataPoint::Acc16:
+        for (int i = 0; i < count; i++)
+            values[i] = registers[i] != 0x0000 ? static_cast<float>(registers[i] * multiplier) : values[i];
+        break;
+    case SunSpecDataPoint::Int16:
+        for (int i = 0; i < count; i++)
+            values[i] = registers[i] != 0x8000 ? static_cast<float>(static_cast<qint16>(registers[i]) * multiplier) : values[i];
+        break;
+    case SunSpecDataPoint::UInt32:
+        for (int i = 0; i < count; i++) {
+            const quint32 value = static_cast<quint32>(registers[2 * i + high]) << 16 | registers[2 * i + low];
+            values[i] = value != 0xFFFFFFFF ? static_cast<float>(value * multiplier) : values[i];
+        }
+        break;
+    case SunSpecDataPoint::Acc32:
+        for (int i = 0; i < count; i++) {
+            const quint32 value = static_cast<quint32>(registers[2 * i + high]) << 16 | registers[2 * i + low];
+            values[i] = value != 0x00000000 ? static_cast<float>(value * multiplier) : values[i];
+        }
+        break;
+    case SunSpecDataPoint::Int32:
+        for (int i = 0; i < count; i++) {
+            const quint32 value = static_cast<quint32>(registers[2 * i + high]) << 16 | registers[2 * i + low];
+            values[i] = value != 0x80000000 ? static_cast<float>(static_cast<qint32>(value) * multiplier) : values[i];
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void SunSpecDecodedValues::reset()
+{
+    std::fill(values, values + maxValueCount, 0.0f);
+    std::fill(scaleFactors, scaleFactors + maxScaleFactorCount, 0);
+    std::fill(multipliers, multipliers + maxScaleFactorCount, 1.0);
+}
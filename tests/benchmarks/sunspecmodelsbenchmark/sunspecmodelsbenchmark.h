@@ -0,0 +1,73 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*
+* Copyright 2013 - 2023, nymea GmbH
+* Contact: contact@nymea.io
+*
+* This file is part of nymea.
+* This project including source code and documentation is protected by
+* copyright law, and remains the property of nymea GmbH. All rights, including
+* reproduction, publication, editing and translation, are reserved. The use of
+* this project is subject to the terms of a license agreement to be concluded
+* with nymea GmbH in accordance with the terms of use of nymea GmbH, available
+* under https://nymea.io/license
+*
+* GNU Lesser General Public License Usage
+* Alternatively, this project may be redistributed and/or modified under the
+* terms of the GNU Lesser General Public License as published by the Free
+* Software Foundation; version 3. This project is distributed in the hope that
+* it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with this project. If not, see <https://www.gnu.org/licenses/>.
+*
+* For any further details and any questions please contact us under
+* contact@nymea.io or see our FAQ/Licensing Information on
+* https://nymea.io/license/faq
+*
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef SUNSPECMODELSBENCHMARK_H
+#define SUNSPECMODELSBENCHMARK_H
+
+#include "sunspecdatapoint.h"
+
+// Batch decoding of count adjacent data points of the same type sharing one scale factor,
+// invalid values leave the previous value untouched like in the models.
+void convertToFloatBatch(const quint16 *registers, int registerCount, int offset, int count, SunSpecDataPoint::DataType dataType, SunSpecDataPoint::ByteOrder byteOrder, double multiplier, float *values);
+
+// The decoded properties of a model, index based instead of named members
+class SunSpecDecodedValues
+{
+public:
+    static const int maxValueCount = 256;
+    static const int maxScaleFactorCount = 64;
+
+    float values[maxValueCount];
+    qint16 scaleFactors[maxScaleFactorCount];
+    double multipliers[maxScaleFactorCount];
+
+    void reset();
+};
+
+typedef void (*SunSpecDecodeFunction)(const quint16 *registers, int registerCount, SunSpecDataPoint::ByteOrder byteOrder, SunSpecDecodedValues &decoded);
+
+// Generated by generate-models.py --benchmark for each model containing scaled data points
+typedef struct SunSpecBenchmarkModel {
+    int modelId;
+    const char *className;
+    int blockLength;
+    int valueCount;
+    int batchCount;
+    const quint16 *scaleFactorOffsets;
+    int scaleFactorCount;
+    SunSpecDecodeFunction decodePow;
+    SunSpecDecodeFunction decodeCached;
+    SunSpecDecodeFunction decodeBatched;
+} SunSpecBenchmarkModel;
+
+extern const SunSpecBenchmarkModel sunSpecBenchmarkModels[];
+extern const int sunSpecBenchmarkModelCount;
+
+#endif // SUNSPECMODELSBENCHMARK_H
@@ -0,0 +1,32 @@
+# Benchmark of the scaled values decoded in processBlockData() of the SunSpec models using the SunSpecDataPoint
+# decoding of the library, the decode functions of all models get generated from the SunSpec model definitions on each qmake run.
+
+TARGET = sunspecmodelsbenchmark
+
+QT -= gui
+
+CONFIG += c++11 console
+CONFIG -= app_bundle
+
+QMAKE_CXXFLAGS *= -Werror -std=c++11
+QMAKE_LFLAGS *= -std=c++11
+
+gcc {
+    COMPILER_VERSION = $$system($$QMAKE_CXX " -dumpversion")
+    COMPILER_MAJOR_VERSION = $$str_member($$COMPILER_VERSION)
+    greaterThan(COMPILER_MAJOR_VERSION, 7): QMAKE_CXXFLAGS += -Wno-deprecated-copy
+}
+
+system(python3 $$PWD/../../../libnymea-sunspec/tools/generate-models.py --benchmark $$OUT_PWD/sunspecbenchmarkmodels.cpp)
+
+INCLUDEPATH += $$PWD $$PWD/../../../libnymea-sunspec
+
+HEADERS += \
+    sunspecmodelsbenchmark.h \
+    ../../../libnymea-sunspec/sunspecdatapoint.h
+
+SOURCES += \
+    main.cpp \
+    sunspecmodelsbenchmark.cpp \
+    ../../../libnymea-sunspec/sunspecdatapoint.cpp \
+    $$OUT_PWD/sunspecbenchmarkmodels.cpp